@@ -0,0 +1,60 @@
+#include "benchmark/benchmark_api.h"
+#include "emucore.h"
+#include "eminline.h"
+#include "attotime.h"
+
+#include <cstdlib>
+#include <vector>
+
+// times spread over the first few seconds, as seen by the scheduler
+static std::vector<attotime> make_times(size_t count)
+{
+	std::vector<attotime> result(count);
+	for (auto &time : result)
+		time = attotime(std::rand() % 4, (attoseconds_t(std::rand()) << 29) % ATTOSECONDS_PER_SECOND);
+	return result;
+}
+
+static void BM_attotime_add(benchmark::State& state) {
+	std::vector<attotime> const times = make_times(1024);
+	attotime const step = attotime::from_hz(XTAL(14'318'181));
+	while (state.KeepRunning()) {
+		for (attotime const &time : times)
+			benchmark::DoNotOptimize(time + step);
+	}
+	state.SetItemsProcessed(state.iterations() * times.size());
+}
+
+static void BM_attotime_compare(benchmark::State& state) {
+	std::vector<attotime> const times = make_times(1024);
+	while (state.KeepRunning()) {
+		for (size_t i = 1; i < times.size(); i++)
+			benchmark::DoNotOptimize(times[i - 1] < times[i]);
+	}
+	state.SetItemsProcessed(state.iterations() * (times.size() - 1));
+}
+
+static void BM_attotime_as_ticks(benchmark::State& state) {
+	std::vector<attotime> const times = make_times(1024);
+	u32 const frequency = state.range(0);
+	while (state.KeepRunning()) {
+		for (attotime const &time : times)
+			benchmark::DoNotOptimize(time.as_ticks(frequency));
+	}
+	state.SetItemsProcessed(state.iterations() * times.size());
+}
+
+static void BM_attotime_from_ticks(benchmark::State& state) {
+	u32 const frequency = state.range(0);
+	u64 ticks = 0x332533;
+	while (state.KeepRunning()) {
+		benchmark::DoNotOptimize(attotime::from_ticks(ticks, frequency));
+		ticks += 977;
+	}
+}
+
+// Register the function as a benchmark
+BENCHMARK(BM_attotime_add);
+BENCHMARK(BM_attotime_compare);
+BENCHMARK(BM_attotime_as_ticks)->Arg(44100)->Arg(14318181);
+BENCHMARK(BM_attotime_from_ticks)->Arg(44100)->Arg(14318181);
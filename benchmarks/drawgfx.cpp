@@ -0,0 +1,55 @@
+#include "benchmark/benchmark_api.h"
+#include "emucore.h"
+#include "video/drawspan.h"
+
+#include <cstdlib>
+#include <vector>
+
+// pen data for a run of sprite pixels, about a third transparent
+static std::vector<u8> make_source(size_t count)
+{
+	std::vector<u8> result(count);
+	for (auto &pen : result)
+		pen = (std::rand() % 3) ? (std::rand() & 0x0f) : 0;
+	return result;
+}
+
+template <typename Op, typename Dest>
+static void run_scalar(benchmark::State& state, Op const &op) {
+	std::vector<u8> const src = make_source(state.range(0));
+	std::vector<Dest> dest(src.size());
+	while (state.KeepRunning()) {
+		for (size_t i = 0; i < src.size(); i++)
+			op(dest[i], src[i]);
+		benchmark::DoNotOptimize(dest.data());
+	}
+	state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+template <typename Op, typename Dest>
+static void run_span(benchmark::State& state, Op const &op) {
+	std::vector<u8> const src = make_source(state.range(0));
+	std::vector<Dest> dest(src.size());
+	while (state.KeepRunning()) {
+		op.span(dest.data(), src.data(), src.size());
+		benchmark::DoNotOptimize(dest.data());
+	}
+	state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+static pen_t const palette[256] = { 0 };
+
+static void BM_rebase_opaque_scalar(benchmark::State& state) { run_scalar<drawspan_rebase_opaque, u16>(state, drawspan_rebase_opaque{ 0x100 }); }
+static void BM_rebase_opaque_span(benchmark::State& state) { run_span<drawspan_rebase_opaque, u16>(state, drawspan_rebase_opaque{ 0x100 }); }
+static void BM_rebase_transpen_scalar(benchmark::State& state) { run_scalar<drawspan_rebase_transpen, u16>(state, drawspan_rebase_transpen{ 0, 0x100 }); }
+static void BM_rebase_transpen_span(benchmark::State& state) { run_span<drawspan_rebase_transpen, u16>(state, drawspan_rebase_transpen{ 0, 0x100 }); }
+static void BM_remap_transpen_scalar(benchmark::State& state) { run_scalar<drawspan_remap_transpen, u32>(state, drawspan_remap_transpen{ 0, palette }); }
+static void BM_remap_transpen_span(benchmark::State& state) { run_span<drawspan_remap_transpen, u32>(state, drawspan_remap_transpen{ 0, palette }); }
+
+// Register the function as a benchmark
+BENCHMARK(BM_rebase_opaque_scalar)->Arg(16)->Arg(320);
+BENCHMARK(BM_rebase_opaque_span)->Arg(16)->Arg(320);
+BENCHMARK(BM_rebase_transpen_scalar)->Arg(16)->Arg(320);
+BENCHMARK(BM_rebase_transpen_span)->Arg(16)->Arg(320);
+BENCHMARK(BM_remap_transpen_scalar)->Arg(16)->Arg(320);
+BENCHMARK(BM_remap_transpen_span)->Arg(16)->Arg(320);
@@ -0,0 +1,59 @@
+#include "benchmark/benchmark_api.h"
+#include "emucore.h"
+#include "video/rgbutil.h"
+
+#include <cstdlib>
+#include <vector>
+
+static std::vector<u32> make_pixels(size_t count)
+{
+	std::vector<u32> result(count);
+	for (auto &pixel : result)
+		pixel = (u32(std::rand()) << 16) ^ u32(std::rand());
+	return result;
+}
+
+static void BM_rgbaint_add_clamp(benchmark::State& state) {
+	std::vector<u32> const src = make_pixels(state.range(0));
+	std::vector<u32> dest = make_pixels(state.range(0));
+	while (state.KeepRunning()) {
+		for (size_t i = 0; i < src.size(); i++) {
+			rgbaint_t color(dest[i]);
+			color.add(rgbaint_t(src[i]));
+			dest[i] = color.to_rgba_clamp();
+		}
+		benchmark::DoNotOptimize(dest.data());
+	}
+	state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+static void BM_rgbaint_scale_add(benchmark::State& state) {
+	std::vector<u32> const src = make_pixels(state.range(0));
+	std::vector<u32> dest = make_pixels(state.range(0));
+	rgbaint_t const scale(0x80, 0xc0, 0x40, 0x100);
+	while (state.KeepRunning()) {
+		for (size_t i = 0; i < src.size(); i++) {
+			rgbaint_t color(src[i]);
+			color.scale_add_and_clamp(scale, rgbaint_t(dest[i]));
+			dest[i] = color.to_rgba();
+		}
+		benchmark::DoNotOptimize(dest.data());
+	}
+	state.SetItemsProcessed(state.iterations() * src.size());
+}
+
+static void BM_rgbaint_bilinear(benchmark::State& state) {
+	std::vector<u32> const src = make_pixels(state.range(0) + 1);
+	std::vector<u32> dest(state.range(0));
+	while (state.KeepRunning()) {
+		for (size_t i = 0; i < dest.size(); i++)
+			dest[i] = rgbaint_t::bilinear_filter(src[i], src[i + 1], src[i + 1], src[i], u8(i), u8(i * 3));
+		benchmark::DoNotOptimize(dest.data());
+	}
+	state.SetItemsProcessed(state.iterations() * dest.size());
+}
+
+// Register the function as a benchmark
+BENCHMARK(BM_rgbaint_add_clamp)->Arg(320);
+BENCHMARK(BM_rgbaint_scale_add)->Arg(320);
+BENCHMARK(BM_rgbaint_bilinear)->Arg(320);
@@ -0,0 +1,33 @@
+#include "benchmark/benchmark_api.h"
+#include "osdcore.h"
+
+#include <atomic>
+#include <vector>
+
+// a small fixed amount of work, roughly a short scanline span
+static void *spin_work(void *param, int threadid)
+{
+	uint32_t value = *reinterpret_cast<uint32_t *>(param);
+	for (int i = 0; i < 64; i++)
+		value = value * 1664525 + 1013904223;
+	*reinterpret_cast<uint32_t *>(param) = value;
+	return nullptr;
+}
+
+static void run_queue(benchmark::State& state, int flags) {
+	osd_work_queue *const queue = osd_work_queue_alloc(flags);
+	std::vector<uint32_t> params(state.range(0));
+	while (state.KeepRunning()) {
+		osd_work_item_queue_multiple(queue, spin_work, params.size(), params.data(), sizeof(params[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(queue, osd_ticks_per_second())) { }
+	}
+	state.SetItemsProcessed(state.iterations() * params.size());
+	osd_work_queue_free(queue);
+}
+
+static void BM_workqueue_shared(benchmark::State& state) { run_queue(state, WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ); }
+static void BM_workqueue_steal(benchmark::State& state) { run_queue(state, WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ | WORK_QUEUE_FLAG_STEAL); }
+
+// Register the function as a benchmark
+BENCHMARK(BM_workqueue_shared)->Arg(64)->Arg(1024);
+BENCHMARK(BM_workqueue_steal)->Arg(64)->Arg(1024);
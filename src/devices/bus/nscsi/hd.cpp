@@ -524,6 +524,17 @@ void nscsi_harddisk_device::scsi_command()
 			scsi_unknown_command();
 		break;
 
+	case SC_SYNCHRONIZE_CACHE:
+		LOG("command SYNCHRONIZE CACHE\n");
+		if (image->flush())
+			scsi_status_complete(SS_GOOD);
+		else
+		{
+			scsi_status_complete(SS_CHECK_CONDITION);
+			sense(false, SK_MEDIUM_ERROR);
+		}
+		break;
+
 	default:
 		LOGMASKED(LOG_UNSUPPORTED, "command %02x ***UNKNOWN***\n", scsi_cmdbuf[0]);
 		// Parent may handle this
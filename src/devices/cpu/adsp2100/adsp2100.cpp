@@ -1223,7 +1223,23 @@ void adsp21xx_device::execute_run()
 		if (m_pc != m_loop)
 			m_pc++;
 
-		// handle looping
+		// handle looping; DO UNTIL CE is by far the most common loop, so
+		// its counter is tested here rather than through slow_condition()
+		else if (m_loop_condition == 14)
+		{
+			// counter not expired, keep looping
+			if ((int32_t)--m_cntr > 0)
+				m_pc = pc_stack_top();
+
+			// counter expired; pop the counter, PC and loop stacks and fall through
+			else
+			{
+				cntr_stack_pop();
+				loop_stack_pop();
+				pc_stack_pop_val();
+				m_pc++;
+			}
+		}
 		else
 		{
 			// condition not met, keep looping
@@ -1158,6 +1158,52 @@ void arm1176jzf_s_cpu_device::device_reset()
 	m_r[eR15] += 4; \
 	m_icount +=2; /* Any unexecuted instruction only takes 1 cycle (page 193) */
 
+namespace {
+
+// one 16-bit mask per condition code; bit n is set when the condition
+// passes with CPSR[31:28] (NZCV) equal to n
+constexpr uint16_t make_cond_mask(unsigned cond)
+{
+	uint16_t mask = 0;
+	for (unsigned nzcv = 0; nzcv < 16; nzcv++)
+	{
+		const bool n = nzcv & 8, z = nzcv & 4, c = nzcv & 2, v = nzcv & 1;
+		bool pass = false;
+		switch (cond)
+		{
+			case COND_EQ: pass = z;                 break;
+			case COND_NE: pass = !z;                break;
+			case COND_CS: pass = c;                 break;
+			case COND_CC: pass = !c;                break;
+			case COND_MI: pass = n;                 break;
+			case COND_PL: pass = !n;                break;
+			case COND_VS: pass = v;                 break;
+			case COND_VC: pass = !v;                break;
+			case COND_HI: pass = c && !z;           break;
+			case COND_LS: pass = !c || z;           break;
+			case COND_GE: pass = n == v;            break;
+			case COND_LT: pass = n != v;            break;
+			case COND_GT: pass = !z && (n == v);    break;
+			case COND_LE: pass = z || (n != v);     break;
+			case COND_AL: pass = true;              break;
+			default:      pass = false;             break;
+		}
+		if (pass)
+			mask |= 1 << nzcv;
+	}
+	return mask;
+}
+
+constexpr uint16_t s_cond_pass[16] =
+{
+	make_cond_mask( 0), make_cond_mask( 1), make_cond_mask( 2), make_cond_mask( 3),
+	make_cond_mask( 4), make_cond_mask( 5), make_cond_mask( 6), make_cond_mask( 7),
+	make_cond_mask( 8), make_cond_mask( 9), make_cond_mask(10), make_cond_mask(11),
+	make_cond_mask(12), make_cond_mask(13), make_cond_mask(14), make_cond_mask(15)
+};
+
+} // anonymous namespace
+
 void arm7_cpu_device::update_insn_prefetch(uint32_t curr_pc)
 {
 	curr_pc &= ~3;
@@ -1485,74 +1531,16 @@ void arm7_cpu_device::execute_run()
 
 			int op_offset = 0;
 			/* process condition codes for this instruction */
-			if ((insn >> INSN_COND_SHIFT) != COND_AL)
+			const uint32_t cond = insn >> INSN_COND_SHIFT;
+			if (cond == COND_NV)
 			{
-				switch (insn >> INSN_COND_SHIFT)
-				{
-					case COND_EQ:
-						if (Z_IS_CLEAR(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_NE:
-						if (Z_IS_SET(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_CS:
-						if (C_IS_CLEAR(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_CC:
-						if (C_IS_SET(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_MI:
-						if (N_IS_CLEAR(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_PL:
-						if (N_IS_SET(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_VS:
-						if (V_IS_CLEAR(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_VC:
-						if (V_IS_SET(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_HI:
-						if (C_IS_CLEAR(m_r[eCPSR]) || Z_IS_SET(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_LS:
-						if (C_IS_SET(m_r[eCPSR]) && Z_IS_CLEAR(m_r[eCPSR]))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_GE:
-						if (!(m_r[eCPSR] & N_MASK) != !(m_r[eCPSR] & V_MASK)) /* Use x ^ (x >> ...) method */
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_LT:
-						if (!(m_r[eCPSR] & N_MASK) == !(m_r[eCPSR] & V_MASK))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_GT:
-						if (Z_IS_SET(m_r[eCPSR]) || (!(m_r[eCPSR] & N_MASK) != !(m_r[eCPSR] & V_MASK)))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_LE:
-						if (Z_IS_CLEAR(m_r[eCPSR]) && (!(m_r[eCPSR] & N_MASK) == !(m_r[eCPSR] & V_MASK)))
-							{ UNEXECUTED();  goto skip_exec; }
-						break;
-					case COND_NV:
-						if (m_archRev < 5)
-						  { UNEXECUTED();  goto skip_exec; }
-						else
-							op_offset = 0x10;
-						break;
-				}
+				if (m_archRev < 5)
+					{ UNEXECUTED();  goto skip_exec; }
+				else
+					op_offset = 0x10;
 			}
+			else if (!BIT(s_cond_pass[cond], m_r[eCPSR] >> 28))
+				{ UNEXECUTED();  goto skip_exec; }
 			/*******************************************************************/
 			/* If we got here - condition satisfied, so decode the instruction */
 			/*******************************************************************/
@@ -0,0 +1,4017 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    drcbearm64.cpp
+
+    64-bit ARM (AArch64) back-end for the universal machine language.
+
+****************************************************************************
+
+    Future improvements/changes:
+
+    * Use ADRP for addressing data outside the near cache
+
+    * Resolve address space accessors to avoid the trampolines
+
+    * Optimize flag generation for instructions followed by a compare
+
+    * Fold immediate masks into BFI/UBFX for ROLAND/ROLINS
+
+****************************************************************************
+
+    ---------------
+    ABI/conventions
+    ---------------
+
+    Registers:
+        X0-X7      - volatile, function parameters/return value
+        X8         - volatile, indirect result location
+        X9-X15     - volatile, temporaries
+        X16-X17    - volatile, intra-procedure-call scratch
+        X18        - platform register (reserved, never touched)
+        X19-X28    - non-volatile
+        X29        - frame pointer
+        X30        - link register
+        SP         - stack pointer (must be 16-byte aligned)
+
+        V0-V7      - volatile, FP function parameters/return value
+        V8-V15     - non-volatile (low 64 bits only)
+        V16-V31    - volatile
+
+
+    --------------------------
+    Generated code conventions
+    --------------------------
+
+    Registers:
+        X0         - parameter 1 / return value
+        X1-X3      - parameters 2-4
+        X9         - scratch register
+        X10-X15    - temporary registers
+        X16        - scratch register for memory addressing and calls
+        X17        - scratch register for flag manipulation
+        X19-X26    - UML integer registers I0-I7
+        X27        - base pointer (start of the near cache)
+        X28        - UML integer register I8
+
+        V8-V15     - UML floating-point registers F0-F7
+        V16-V18    - temporary floating-point registers
+
+    Flags:
+        N, Z and V hold the UML S, Z and V flags; the UML U flag is held
+        in V.  The host C flag always holds the inverse of the UML C flag,
+        so that subtraction and comparison results can be used directly;
+        additions explicitly invert the carry when it is requested.
+
+    Entry point:
+        Saves the non-volatile registers, loads the base pointer, saves
+        the host FPCR, selects the UML rounding mode, records the stack
+        pointer and branches to the code pointer passed in X0.
+
+    Exit point:
+        Restores the stack pointer, the host FPCR and the non-volatile
+        registers and returns to the caller with the result in W0.
+
+    Subroutines:
+        Handles are entered with BL; the handle prolog pushes the link
+        register so that RET can pop it back and return.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "drcbearm64.h"
+
+#include "debug/debugcpu.h"
+#include "emuopts.h"
+
+#include <cstddef>
+
+
+namespace drc {
+
+using namespace uml;
+
+using namespace asmjit;
+using namespace asmjit::a64;
+
+
+
+namespace {
+
+//**************************************************************************
+//  DEBUGGING
+//**************************************************************************
+
+#define LOG_HASHJMPS            (0)
+
+
+
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+const uint32_t PTYPE_M    = 1 << parameter::PTYPE_MEMORY;
+const uint32_t PTYPE_I    = 1 << parameter::PTYPE_IMMEDIATE;
+const uint32_t PTYPE_R    = 1 << parameter::PTYPE_INT_REGISTER;
+const uint32_t PTYPE_F    = 1 << parameter::PTYPE_FLOAT_REGISTER;
+//const uint32_t PTYPE_MI   = PTYPE_M | PTYPE_I;
+//const uint32_t PTYPE_RI   = PTYPE_R | PTYPE_I;
+const uint32_t PTYPE_MR   = PTYPE_M | PTYPE_R;
+const uint32_t PTYPE_MRI  = PTYPE_M | PTYPE_R | PTYPE_I;
+const uint32_t PTYPE_MF   = PTYPE_M | PTYPE_F;
+
+// fixed registers
+const a64::Gp REG_PARAM1      = a64::x0;
+const a64::Gp REG_PARAM2      = a64::x1;
+const a64::Gp REG_PARAM3      = a64::x2;
+const a64::Gp REG_PARAM4      = a64::x3;
+
+const a64::Gp SCRATCH_REG1    = a64::x9;
+const a64::Gp SCRATCH_REG2    = a64::x17;
+const a64::Gp TEMP_REG1       = a64::x10;
+const a64::Gp TEMP_REG2       = a64::x11;
+const a64::Gp TEMP_REG3       = a64::x12;
+const a64::Gp TEMP_REG4       = a64::x13;
+const a64::Gp TEMP_REG5       = a64::x14;
+const a64::Gp TEMP_REG6       = a64::x15;
+const a64::Gp MEM_SCRATCH_REG = a64::x16;
+const a64::Gp BASE_REG        = a64::x27;
+
+const a64::Vec TEMPF_REG1     = a64::d16;
+const a64::Vec TEMPF_REG2     = a64::d17;
+const a64::Vec TEMPF_REG3     = a64::d18;
+
+// host NZCV bit positions
+const uint64_t NZCV_N         = 0x80000000;
+const uint64_t NZCV_Z         = 0x40000000;
+const uint64_t NZCV_C         = 0x20000000;
+const uint64_t NZCV_V         = 0x10000000;
+
+// FPCR rounding mode field
+const int FPCR_RMODE_SHIFT    = 22;
+
+
+
+//**************************************************************************
+//  MACROS
+//**************************************************************************
+
+#define ARM_CONDITION(condition)        (condition_map[condition - uml::COND_Z])
+#define ARM_NOT_CONDITION(condition)    negateCond(condition_map[condition - uml::COND_Z])
+
+#define assert_no_condition(inst)       assert((inst).condition() == uml::COND_ALWAYS)
+#define assert_any_condition(inst)      assert((inst).condition() == uml::COND_ALWAYS || ((inst).condition() >= uml::COND_Z && (inst).condition() < uml::COND_MAX))
+#define assert_no_flags(inst)           assert((inst).flags() == 0)
+#define assert_flags(inst, valid)       assert(((inst).flags() & ~(valid)) == 0)
+
+
+
+//**************************************************************************
+//  GLOBAL VARIABLES
+//**************************************************************************
+
+// register mapping tables
+const uint32_t int_register_map[REG_I_COUNT] =
+{
+	19, 20, 21, 22, 23, 24, 25, 26, 28
+};
+
+const uint32_t float_register_map[REG_F_COUNT] =
+{
+	8, 9, 10, 11, 12, 13, 14, 15
+};
+
+// condition mapping table
+const CondCode condition_map[uml::COND_MAX - uml::COND_Z] =
+{
+	CondCode::kEQ,   // COND_Z = 0x80,    requires Z
+	CondCode::kNE,   // COND_NZ,          requires Z
+	CondCode::kMI,   // COND_S,           requires S
+	CondCode::kPL,   // COND_NS,          requires S
+	CondCode::kLO,   // COND_C,           requires C
+	CondCode::kHS,   // COND_NC,          requires C
+	CondCode::kVS,   // COND_V,           requires V
+	CondCode::kVC,   // COND_NV,          requires V
+	CondCode::kVS,   // COND_U,           requires U
+	CondCode::kVC,   // COND_NU,          requires U
+	CondCode::kHI,   // COND_A,           requires CZ
+	CondCode::kLS,   // COND_BE,          requires CZ
+	CondCode::kGT,   // COND_G,           requires SVZ
+	CondCode::kLE,   // COND_LE,          requires SVZ
+	CondCode::kLT,   // COND_L,           requires SV
+	CondCode::kGE,   // COND_GE,          requires SV
+};
+
+// rounding mode mapping table
+const uint64_t fpcr_rmode_map[4] =
+{
+	3,              // ROUND_TRUNC,   round towards zero
+	0,              // ROUND_ROUND,   round to nearest
+	1,              // ROUND_CEIL,    round towards plus infinity
+	2               // ROUND_FLOOR    round towards minus infinity
+};
+
+
+class ThrowableErrorHandler : public ErrorHandler
+{
+public:
+	void handleError(Error err, const char *message, BaseEmitter *origin) override
+	{
+		throw emu_fatalerror("asmjit error %d: %s", err, message);
+	}
+};
+
+
+//-------------------------------------------------
+//  select_register - return a register of the
+//  requested size with the same number
+//-------------------------------------------------
+
+inline a64::Gp select_register(a64::Gp const &reg, uint32_t regsize)
+{
+	if (regsize == 4)
+		return reg.w();
+	return reg.x();
+}
+
+inline a64::Vec select_register(a64::Vec const &reg, uint32_t regsize)
+{
+	if (regsize == 4)
+		return reg.s();
+	return reg.d();
+}
+
+} // anonymous namespace
+
+
+
+//**************************************************************************
+//  TABLES
+//**************************************************************************
+
+drcbe_arm64::opcode_generate_func drcbe_arm64::s_opcode_table[OP_MAX];
+
+const drcbe_arm64::opcode_table_entry drcbe_arm64::s_opcode_table_source[] =
+{
+	// Compile-time opcodes
+	{ uml::OP_HANDLE,  &drcbe_arm64::op_handle },     // HANDLE  handle
+	{ uml::OP_HASH,    &drcbe_arm64::op_hash },       // HASH    mode,pc
+	{ uml::OP_LABEL,   &drcbe_arm64::op_label },      // LABEL   imm
+	{ uml::OP_COMMENT, &drcbe_arm64::op_comment },    // COMMENT string
+	{ uml::OP_MAPVAR,  &drcbe_arm64::op_mapvar },     // MAPVAR  mapvar,value
+
+	// Control Flow Operations
+	{ uml::OP_NOP,     &drcbe_arm64::op_nop },        // NOP
+	{ uml::OP_DEBUG,   &drcbe_arm64::op_debug },      // DEBUG   pc
+	{ uml::OP_EXIT,    &drcbe_arm64::op_exit },       // EXIT    src1[,c]
+	{ uml::OP_HASHJMP, &drcbe_arm64::op_hashjmp },    // HASHJMP mode,pc,handle
+	{ uml::OP_JMP,     &drcbe_arm64::op_jmp },        // JMP     imm[,c]
+	{ uml::OP_EXH,     &drcbe_arm64::op_exh },        // EXH     handle,param[,c]
+	{ uml::OP_CALLH,   &drcbe_arm64::op_callh },      // CALLH   handle[,c]
+	{ uml::OP_RET,     &drcbe_arm64::op_ret },        // RET     [c]
+	{ uml::OP_CALLC,   &drcbe_arm64::op_callc },      // CALLC   func,ptr[,c]
+	{ uml::OP_RECOVER, &drcbe_arm64::op_recover },    // RECOVER dst,mapvar
+
+	// Internal Register Operations
+	{ uml::OP_SETFMOD, &drcbe_arm64::op_setfmod },    // SETFMOD src
+	{ uml::OP_GETFMOD, &drcbe_arm64::op_getfmod },    // GETFMOD dst
+	{ uml::OP_GETEXP,  &drcbe_arm64::op_getexp },     // GETEXP  dst
+	{ uml::OP_GETFLGS, &drcbe_arm64::op_getflgs },    // GETFLGS dst[,f]
+	{ uml::OP_SAVE,    &drcbe_arm64::op_save },       // SAVE    dst
+	{ uml::OP_RESTORE, &drcbe_arm64::op_restore },    // RESTORE dst
+
+	// Integer Operations
+	{ uml::OP_LOAD,    &drcbe_arm64::op_load },       // LOAD    dst,base,index,size
+	{ uml::OP_LOADS,   &drcbe_arm64::op_loads },      // LOADS   dst,base,index,size
+	{ uml::OP_STORE,   &drcbe_arm64::op_store },      // STORE   base,index,src,size
+	{ uml::OP_READ,    &drcbe_arm64::op_read },       // READ    dst,src1,spacesize
+	{ uml::OP_READM,   &drcbe_arm64::op_readm },      // READM   dst,src1,mask,spacesize
+	{ uml::OP_WRITE,   &drcbe_arm64::op_write },      // WRITE   dst,src1,spacesize
+	{ uml::OP_WRITEM,  &drcbe_arm64::op_writem },     // WRITEM  dst,src1,spacesize
+	{ uml::OP_CARRY,   &drcbe_arm64::op_carry },      // CARRY   src,bitnum
+	{ uml::OP_SET,     &drcbe_arm64::op_set },        // SET     dst,c
+	{ uml::OP_MOV,     &drcbe_arm64::op_mov },        // MOV     dst,src[,c]
+	{ uml::OP_SEXT,    &drcbe_arm64::op_sext },       // SEXT    dst,src
+	{ uml::OP_ROLAND,  &drcbe_arm64::op_roland },     // ROLAND  dst,src1,src2,src3
+	{ uml::OP_ROLINS,  &drcbe_arm64::op_rolins },     // ROLINS  dst,src1,src2,src3
+	{ uml::OP_ADD,     &drcbe_arm64::op_add },        // ADD     dst,src1,src2[,f]
+	{ uml::OP_ADDC,    &drcbe_arm64::op_addc },       // ADDC    dst,src1,src2[,f]
+	{ uml::OP_SUB,     &drcbe_arm64::op_sub },        // SUB     dst,src1,src2[,f]
+	{ uml::OP_SUBB,    &drcbe_arm64::op_subc },       // SUBB    dst,src1,src2[,f]
+	{ uml::OP_CMP,     &drcbe_arm64::op_cmp },        // CMP     src1,src2[,f]
+	{ uml::OP_MULU,    &drcbe_arm64::op_mulu },       // MULU    dst,edst,src1,src2[,f]
+	{ uml::OP_MULS,    &drcbe_arm64::op_muls },       // MULS    dst,edst,src1,src2[,f]
+	{ uml::OP_DIVU,    &drcbe_arm64::op_divu },       // DIVU    dst,edst,src1,src2[,f]
+	{ uml::OP_DIVS,    &drcbe_arm64::op_divs },       // DIVS    dst,edst,src1,src2[,f]
+	{ uml::OP_AND,     &drcbe_arm64::op_and },        // AND     dst,src1,src2[,f]
+	{ uml::OP_TEST,    &drcbe_arm64::op_test },       // TEST    src1,src2[,f]
+	{ uml::OP_OR,      &drcbe_arm64::op_or },         // OR      dst,src1,src2[,f]
+	{ uml::OP_XOR,     &drcbe_arm64::op_xor },        // XOR     dst,src1,src2[,f]
+	{ uml::OP_LZCNT,   &drcbe_arm64::op_lzcnt },      // LZCNT   dst,src[,f]
+	{ uml::OP_TZCNT,   &drcbe_arm64::op_tzcnt },      // TZCNT   dst,src[,f]
+	{ uml::OP_BSWAP,   &drcbe_arm64::op_bswap },      // BSWAP   dst,src
+	{ uml::OP_SHL,     &drcbe_arm64::op_shift<Inst::kIdLsl> },      // SHL     dst,src,count[,f]
+	{ uml::OP_SHR,     &drcbe_arm64::op_shift<Inst::kIdLsr> },      // SHR     dst,src,count[,f]
+	{ uml::OP_SAR,     &drcbe_arm64::op_shift<Inst::kIdAsr> },      // SAR     dst,src,count[,f]
+	{ uml::OP_ROL,     &drcbe_arm64::op_rotate<true> },             // ROL     dst,src,count[,f]
+	{ uml::OP_ROLC,    &drcbe_arm64::op_rotc<true> },               // ROLC    dst,src,count[,f]
+	{ uml::OP_ROR,     &drcbe_arm64::op_rotate<false> },            // ROR     dst,src,count[,f]
+	{ uml::OP_RORC,    &drcbe_arm64::op_rotc<false> },              // RORC    dst,src,count[,f]
+
+	// Floating Point Operations
+	{ uml::OP_FLOAD,   &drcbe_arm64::op_fload },      // FLOAD   dst,base,index
+	{ uml::OP_FSTORE,  &drcbe_arm64::op_fstore },     // FSTORE  base,index,src
+	{ uml::OP_FREAD,   &drcbe_arm64::op_fread },      // FREAD   dst,space,src1
+	{ uml::OP_FWRITE,  &drcbe_arm64::op_fwrite },     // FWRITE  space,dst,src1
+	{ uml::OP_FMOV,    &drcbe_arm64::op_fmov },       // FMOV    dst,src1[,c]
+	{ uml::OP_FTOINT,  &drcbe_arm64::op_ftoint },     // FTOINT  dst,src1,size,round
+	{ uml::OP_FFRINT,  &drcbe_arm64::op_ffrint },     // FFRINT  dst,src1,size
+	{ uml::OP_FFRFLT,  &drcbe_arm64::op_ffrflt },     // FFRFLT  dst,src1,size
+	{ uml::OP_FRNDS,   &drcbe_arm64::op_frnds },      // FRNDS   dst,src1
+	{ uml::OP_FADD,    &drcbe_arm64::op_float_alu<Inst::kIdFadd_v> },   // FADD    dst,src1,src2
+	{ uml::OP_FSUB,    &drcbe_arm64::op_float_alu<Inst::kIdFsub_v> },   // FSUB    dst,src1,src2
+	{ uml::OP_FCMP,    &drcbe_arm64::op_fcmp },       // FCMP    src1,src2
+	{ uml::OP_FMUL,    &drcbe_arm64::op_float_alu<Inst::kIdFmul_v> },   // FMUL    dst,src1,src2
+	{ uml::OP_FDIV,    &drcbe_arm64::op_float_alu<Inst::kIdFdiv_v> },   // FDIV    dst,src1,src2
+	{ uml::OP_FNEG,    &drcbe_arm64::op_float_alu2<Inst::kIdFneg_v> },  // FNEG    dst,src1
+	{ uml::OP_FABS,    &drcbe_arm64::op_float_alu2<Inst::kIdFabs_v> },  // FABS    dst,src1
+	{ uml::OP_FSQRT,   &drcbe_arm64::op_float_alu2<Inst::kIdFsqrt_v> }, // FSQRT   dst,src1
+	{ uml::OP_FRECIP,  &drcbe_arm64::op_frecip },     // FRECIP  dst,src1
+	{ uml::OP_FRSQRT,  &drcbe_arm64::op_frsqrt },     // FRSQRT  dst,src1
+	{ uml::OP_FCOPYI,  &drcbe_arm64::op_fcopyi },     // FCOPYI  dst,src
+	{ uml::OP_ICOPYF,  &drcbe_arm64::op_icopyf }      // ICOPYF  dst,src
+};
+
+
+
+//**************************************************************************
+//  INLINE FUNCTIONS
+//**************************************************************************
+
+//-------------------------------------------------
+//  param_normalize - convert a full parameter
+//  into a reduced set
+//-------------------------------------------------
+
+drcbe_arm64::be_parameter::be_parameter(drcbe_arm64 &drcbe, const parameter &param, uint32_t allowed)
+{
+	int regnum;
+
+	switch (param.type())
+	{
+		// immediates pass through
+		case parameter::PTYPE_IMMEDIATE:
+			assert(allowed & PTYPE_I);
+			*this = param.immediate();
+			break;
+
+		// memory passes through
+		case parameter::PTYPE_MEMORY:
+			assert(allowed & PTYPE_M);
+			*this = make_memory(param.memory());
+			break;
+
+		// if a register maps to a register, keep it as a register; otherwise map it to memory
+		case parameter::PTYPE_INT_REGISTER:
+			assert(allowed & PTYPE_R);
+			assert(allowed & PTYPE_M);
+			regnum = int_register_map[param.ireg() - REG_I0];
+			if (regnum != 0)
+				*this = make_ireg(regnum);
+			else
+				*this = make_memory(&drcbe.m_state.r[param.ireg() - REG_I0]);
+			break;
+
+		// if a register maps to a register, keep it as a register; otherwise map it to memory
+		case parameter::PTYPE_FLOAT_REGISTER:
+			assert(allowed & PTYPE_F);
+			assert(allowed & PTYPE_M);
+			regnum = float_register_map[param.freg() - REG_F0];
+			if (regnum != 0)
+				*this = make_freg(regnum);
+			else
+				*this = make_memory(&drcbe.m_state.f[param.freg() - REG_F0]);
+			break;
+
+		// everything else is unexpected
+		default:
+			fatalerror("Unexpected parameter type\n");
+	}
+}
+
+
+//-------------------------------------------------
+//  select_register - select a register to use,
+//  preferring the parameter's own register
+//-------------------------------------------------
+
+inline a64::Gp drcbe_arm64::be_parameter::select_register(a64::Gp const &defreg) const
+{
+	if (m_type == PTYPE_INT_REGISTER)
+		return a64::Gp(defreg, m_value);
+	return defreg;
+}
+
+inline a64::Vec drcbe_arm64::be_parameter::select_register(a64::Vec const &defreg) const
+{
+	if (m_type == PTYPE_FLOAT_REGISTER)
+		return a64::Vec(defreg, m_value);
+	return defreg;
+}
+
+
+//-------------------------------------------------
+//  is_valid_immediate - return true if the value
+//  fits in the given number of unsigned bits
+//-------------------------------------------------
+
+inline bool drcbe_arm64::is_valid_immediate(uint64_t val, int bits)
+{
+	assert(bits < 64);
+	return val < (uint64_t(1) << bits);
+}
+
+
+//-------------------------------------------------
+//  is_valid_immediate_addsub - return true if the
+//  value can be encoded in an ADD/SUB immediate
+//-------------------------------------------------
+
+inline bool drcbe_arm64::is_valid_immediate_addsub(uint64_t val)
+{
+	return !(val & ~uint64_t(0xfff)) || !(val & ~uint64_t(0xfff000));
+}
+
+
+//-------------------------------------------------
+//  is_valid_immediate_mask - return true if the
+//  value can be encoded as a logical immediate
+//-------------------------------------------------
+
+inline bool drcbe_arm64::is_valid_immediate_mask(uint64_t val, size_t bytes)
+{
+	return arm::Utils::isLogicalImm(val, bytes * 8);
+}
+
+
+//-------------------------------------------------
+//  is_near_offset - return true if the pointer
+//  can be reached directly from the base
+//  register by an instruction accessing the
+//  given number of bytes
+//-------------------------------------------------
+
+inline bool drcbe_arm64::is_near_offset(const void *ptr, uint32_t size) const
+{
+	const int64_t offset = reinterpret_cast<const uint8_t *>(ptr) - m_baseptr;
+
+	// unscaled signed 9-bit offset
+	if (offset >= -256 && offset < 256)
+		return true;
+
+	// scaled unsigned 12-bit offset
+	return (offset >= 0) && !(offset % size) && (offset / size < 4096);
+}
+
+
+//-------------------------------------------------
+//  get_mem_absolute - return a memory operand for
+//  an absolute address, using the memory scratch
+//  register if the base register can't reach it
+//-------------------------------------------------
+
+a64::Mem drcbe_arm64::get_mem_absolute(a64::Assembler &a, const void *ptr, uint32_t size) const
+{
+	const int64_t offset = reinterpret_cast<const uint8_t *>(ptr) - m_baseptr;
+
+	// directly addressable from the base register
+	if (is_near_offset(ptr, size))
+		return a64::ptr(BASE_REG, int32_t(offset));
+
+	// within 16MB, add the upper bits of the offset to the base register first
+	if (offset >= 0 && offset < 0x1000000)
+	{
+		const int64_t lo = offset & 0xfff;
+		if (lo < 256 || !(lo % size))
+		{
+			a.add(MEM_SCRATCH_REG, BASE_REG, offset & 0xfff000);                         // add   scratch,base,#hi
+			return a64::ptr(MEM_SCRATCH_REG, int32_t(lo));
+		}
+	}
+
+	// otherwise, load the full address
+	a.mov(MEM_SCRATCH_REG, uintptr_t(ptr));                                             // mov   scratch,ptr
+	return a64::ptr(MEM_SCRATCH_REG);
+}
+
+
+//-------------------------------------------------
+//  get_mem_indexed - return a memory operand for
+//  a base pointer plus a scaled, sign-extended
+//  32-bit index
+//-------------------------------------------------
+
+a64::Mem drcbe_arm64::get_mem_indexed(a64::Assembler &a, const void *base, be_parameter const &indp, int scale, uint32_t size) const
+{
+	// immediate index folds into the address
+	if (indp.is_immediate())
+		return get_mem_absolute(a, reinterpret_cast<const uint8_t *>(base) + (int64_t(int32_t(indp.immediate())) << scale), size);
+
+	// sign-extend the index
+	if (indp.is_int_register())
+		a.sxtw(TEMP_REG3, a64::w(indp.ireg()));                                         // sxtw  temp3,indp
+	else
+	{
+		emit_ldr_mem(a, TEMP_REG3.w(), indp.memory());                                  // ldr   temp3,[indp]
+		a.sxtw(TEMP_REG3, TEMP_REG3.w());                                               // sxtw  temp3,temp3
+	}
+
+	// the register form can only scale by the access size
+	get_imm_relative(a, TEMP_REG1, base);                                               // mov   temp1,base
+	if ((uint32_t(1) << scale) == size)
+		return a64::ptr(TEMP_REG1, TEMP_REG3, a64::lsl(scale));
+
+	a.add(TEMP_REG1, TEMP_REG1, TEMP_REG3, a64::lsl(scale));                            // add   temp1,temp1,temp3,lsl #scale
+	return a64::ptr(TEMP_REG1);
+}
+
+
+//-------------------------------------------------
+//  get_imm_relative - load the address of a
+//  pointer into a register, relative to the base
+//  register when possible
+//-------------------------------------------------
+
+void drcbe_arm64::get_imm_relative(a64::Assembler &a, a64::Gp const &reg, const void *ptr) const
+{
+	const int64_t offset = reinterpret_cast<const uint8_t *>(ptr) - m_baseptr;
+
+	if (offset >= 0 && is_valid_immediate_addsub(offset))
+		a.add(reg, BASE_REG, offset);                                                   // add   reg,base,#offset
+	else if (offset < 0 && is_valid_immediate_addsub(-offset))
+		a.sub(reg, BASE_REG, -offset);                                                  // sub   reg,base,#-offset
+	else
+		mov_r64_imm(a, reg, uintptr_t(ptr));                                            // mov   reg,ptr
+}
+
+
+//-------------------------------------------------
+//  emit_ldr_str_base_mem - emit a load or store
+//  of an absolute address
+//-------------------------------------------------
+
+void drcbe_arm64::emit_ldr_str_base_mem(a64::Assembler &a, a64::Inst::Id opcode, a64::Reg const &reg, uint32_t size, const void *ptr) const
+{
+	a.emit(opcode, reg, get_mem_absolute(a, ptr, size));
+}
+
+void drcbe_arm64::emit_ldr_mem(a64::Assembler &a, a64::Gp const &reg, const void *ptr) const
+{
+	emit_ldr_str_base_mem(a, a64::Inst::kIdLdr, reg, reg.isGpW() ? 4 : 8, ptr);
+}
+
+void drcbe_arm64::emit_ldrb_mem(a64::Assembler &a, a64::Gp const &reg, const void *ptr) const
+{
+	emit_ldr_str_base_mem(a, a64::Inst::kIdLdrb, reg, 1, ptr);
+}
+
+void drcbe_arm64::emit_str_mem(a64::Assembler &a, a64::Gp const &reg, const void *ptr) const
+{
+	emit_ldr_str_base_mem(a, a64::Inst::kIdStr, reg, reg.isGpW() ? 4 : 8, ptr);
+}
+
+void drcbe_arm64::emit_strb_mem(a64::Assembler &a, a64::Gp const &reg, const void *ptr) const
+{
+	emit_ldr_str_base_mem(a, a64::Inst::kIdStrb, reg, 1, ptr);
+}
+
+void drcbe_arm64::emit_float_ldr_mem(a64::Assembler &a, a64::Vec const &reg, const void *ptr) const
+{
+	emit_ldr_str_base_mem(a, a64::Inst::kIdLdr_v, reg, reg.isVecS() ? 4 : 8, ptr);
+}
+
+void drcbe_arm64::emit_float_str_mem(a64::Assembler &a, a64::Vec const &reg, const void *ptr) const
+{
+	emit_ldr_str_base_mem(a, a64::Inst::kIdStr_v, reg, reg.isVecS() ? 4 : 8, ptr);
+}
+
+
+//-------------------------------------------------
+//  call_arm_addr - call a fixed address, using a
+//  direct branch if it is in range
+//-------------------------------------------------
+
+void drcbe_arm64::call_arm_addr(a64::Assembler &a, const void *offs) const
+{
+	const uint64_t codeoffs = a.code()->baseAddress() + a.offset();
+	const int64_t reloffs = int64_t(uintptr_t(offs)) - int64_t(codeoffs);
+
+	if (reloffs >= -(int64_t(1) << 27) && reloffs < (int64_t(1) << 27))
+	{
+		a.bl(Imm(uintptr_t(offs)));                                                     // bl    offs
+	}
+	else
+	{
+		a.mov(MEM_SCRATCH_REG, uintptr_t(offs));                                        // mov   scratch,offs
+		a.blr(MEM_SCRATCH_REG);                                                         // blr   scratch
+	}
+}
+
+
+//-------------------------------------------------
+//  call_arm_handle - call through a code handle,
+//  directly if it has already been resolved
+//-------------------------------------------------
+
+void drcbe_arm64::call_arm_handle(a64::Assembler &a, code_handle &handle) const
+{
+	drccodeptr *const targetptr = handle.codeptr_addr();
+
+	if (*targetptr != nullptr)
+	{
+		call_arm_addr(a, *targetptr);                                                   // bl    *targetptr
+	}
+	else
+	{
+		emit_ldr_mem(a, MEM_SCRATCH_REG, targetptr);                                    // ldr   scratch,[targetptr]
+		a.blr(MEM_SCRATCH_REG);                                                         // blr   scratch
+	}
+}
+
+
+//-------------------------------------------------
+//  emit_skip - branch around the following code
+//  if the condition is not met
+//-------------------------------------------------
+
+void drcbe_arm64::emit_skip(a64::Assembler &a, condition_t cond, Label &skip)
+{
+	// nothing to do if the condition is always true
+	if (cond == uml::COND_ALWAYS)
+		return;
+
+	skip = a.newLabel();
+	a.b(ARM_NOT_CONDITION(cond), skip);                                                 // b.!cc skip
+}
+
+
+
+//**************************************************************************
+//  BACKEND CALLBACKS
+//**************************************************************************
+
+//-------------------------------------------------
+//  drcbe_arm64 - constructor
+//-------------------------------------------------
+
+drcbe_arm64::drcbe_arm64(drcuml_state &drcuml, device_t &device, drc_cache &cache, uint32_t flags, int modes, int addrbits, int ignorebits)
+	: drcbe_interface(drcuml, cache, device)
+	, m_hash(cache, modes, addrbits, ignorebits)
+	, m_map(cache, 0xaaaaaaaa5555)
+	, m_log_asmjit(nullptr)
+	, m_baseptr(cache.near())
+	, m_entry(nullptr)
+	, m_exit(nullptr)
+	, m_nocode(nullptr)
+	, m_near(*(near_state *)cache.alloc_near(sizeof(m_near)))
+{
+	// build up necessary arrays
+	for (int mode = 0; mode < std::size(m_near.fpcrmode); mode++)
+		m_near.fpcrmode[mode] = fpcr_rmode_map[mode] << FPCR_RMODE_SHIFT;
+	m_near.hostfpcr = 0;
+	m_near.single1 = 1.0f;
+	m_near.double1 = 1.0;
+	m_near.hashstacksave = nullptr;
+
+	// get pointers to C functions we need to call
+	using debugger_hook_func = void (*)(device_debug *, offs_t);
+	static const debugger_hook_func debugger_inst_hook = [] (device_debug *dbg, offs_t pc) { dbg->instruction_hook(pc); }; // TODO: kill trampoline if possible
+	m_near.debug_cpu_instruction_hook = (void *)debugger_inst_hook;
+	if (LOG_HASHJMPS)
+	{
+		m_near.debug_log_hashjmp = (void *)debug_log_hashjmp;
+		m_near.debug_log_hashjmp_fail = (void *)debug_log_hashjmp_fail;
+	}
+	m_near.drcmap_get_value = (void *)&drc_map_variables::static_get_value;
+
+	// build the flags map (index is the host NZCV nibble)
+	for (int entry = 0; entry < std::size(m_near.flagsmap); entry++)
+	{
+		uint8_t flags = 0;
+		if (!(entry & 0x2)) flags |= FLAG_C;
+		if (entry & 0x1) flags |= FLAG_V | FLAG_U;
+		if (entry & 0x4) flags |= FLAG_Z;
+		if (entry & 0x8) flags |= FLAG_S;
+		m_near.flagsmap[entry] = flags;
+	}
+	for (int entry = 0; entry < std::size(m_near.flagsunmap); entry++)
+	{
+		uint32_t flags = 0;
+		if (!(entry & FLAG_C)) flags |= NZCV_C;
+		if (entry & (FLAG_V | FLAG_U)) flags |= NZCV_V;
+		if (entry & FLAG_Z) flags |= NZCV_Z;
+		if (entry & FLAG_S) flags |= NZCV_N;
+		m_near.flagsunmap[entry] = flags;
+	}
+
+	// build the opcode table (static but it doesn't hurt to regenerate it)
+	for (auto & elem : s_opcode_table_source)
+		s_opcode_table[elem.opcode] = elem.func;
+
+	// create the log
+	if (device.machine().options().drc_log_native())
+		m_log_asmjit = fopen(std::string("drcbearm64_asmjit_").append(device.shortname()).append(".asm").c_str(), "w");
+}
+
+
+//-------------------------------------------------
+//  ~drcbe_arm64 - destructor
+//-------------------------------------------------
+
+drcbe_arm64::~drcbe_arm64()
+{
+	if (m_log_asmjit)
+		fclose(m_log_asmjit);
+}
+
+size_t drcbe_arm64::emit(CodeHolder &ch)
+{
+	Error err;
+
+	size_t const alignment = ch.baseAddress() - uint64_t(m_cache.top());
+	size_t const code_size = ch.codeSize();
+
+	// test if enough room remains in drc cache
+	drccodeptr *cachetop = m_cache.begin_codegen(alignment + code_size);
+	if (cachetop == nullptr)
+		return 0;
+
+	err = ch.copyFlattenedData(drccodeptr(ch.baseAddress()), code_size, CopySectionFlags::kPadTargetBuffer);
+	if (err)
+		throw emu_fatalerror("asmjit::CodeHolder::copyFlattenedData() error %d", err);
+
+	// update the drc cache and end codegen
+	*cachetop += alignment + code_size;
+	m_cache.end_codegen();
+
+	return code_size;
+}
+
+//-------------------------------------------------
+//  reset - reset back-end specific state
+//-------------------------------------------------
+
+void drcbe_arm64::reset()
+{
+	// generate a little bit of glue code to set up the environment
+	uint8_t *dst = (uint8_t *)(uint64_t(m_cache.top() + 3) & ~3);
+
+	CodeHolder ch;
+	ch.init(Environment::host(), uint64_t(dst));
+	ThrowableErrorHandler e;
+	ch.setErrorHandler(&e);
+
+	FileLogger logger(m_log_asmjit);
+	if (logger.file())
+	{
+		logger.setFlags(FormatFlags::kHexOffsets | FormatFlags::kHexImms | FormatFlags::kMachineCode);
+		logger.setIndentation(FormatIndentationGroup::kCode, 4);
+		ch.setLogger(&logger);
+		logger.log("\n\n===========\nCACHE RESET\n===========\n\n");
+	}
+
+	a64::Assembler a(&ch);
+	if (logger.file())
+		a.addDiagnosticOptions(DiagnosticOptions::kValidateIntermediate);
+
+	// generate an entry point
+	m_entry = (arm64_entry_point_func)dst;
+	a.bind(a.newNamedLabel("entry_point"));
+
+	// save the frame record and the non-volatile registers
+	a.stp(a64::x29, a64::x30, a64::ptr_pre(a64::sp, -160));                            // stp   x29,x30,[sp,#-160]!
+	a.mov(a64::x29, a64::sp);                                                           // mov   x29,sp
+	a.stp(a64::x19, a64::x20, a64::ptr(a64::sp, 16));                                   // stp   x19,x20,[sp,#16]
+	a.stp(a64::x21, a64::x22, a64::ptr(a64::sp, 32));                                   // stp   x21,x22,[sp,#32]
+	a.stp(a64::x23, a64::x24, a64::ptr(a64::sp, 48));                                   // stp   x23,x24,[sp,#48]
+	a.stp(a64::x25, a64::x26, a64::ptr(a64::sp, 64));                                   // stp   x25,x26,[sp,#64]
+	a.stp(a64::x27, a64::x28, a64::ptr(a64::sp, 80));                                   // stp   x27,x28,[sp,#80]
+	a.stp(a64::d8, a64::d9, a64::ptr(a64::sp, 96));                                     // stp   d8,d9,[sp,#96]
+	a.stp(a64::d10, a64::d11, a64::ptr(a64::sp, 112));                                  // stp   d10,d11,[sp,#112]
+	a.stp(a64::d12, a64::d13, a64::ptr(a64::sp, 128));                                  // stp   d12,d13,[sp,#128]
+	a.stp(a64::d14, a64::d15, a64::ptr(a64::sp, 144));                                  // stp   d14,d15,[sp,#144]
+
+	// set up the base register and the floating-point environment
+	mov_r64_imm(a, BASE_REG, uintptr_t(m_baseptr));                                     // mov   base,baseptr
+	a.mrs(SCRATCH_REG1, Predicate::SysReg::kFPCR);                                      // mrs   scratch,fpcr
+	emit_str_mem(a, SCRATCH_REG1, &m_near.hostfpcr);                                    // str   scratch,[hostfpcr]
+	emit_ldrb_mem(a, SCRATCH_REG1.w(), &m_state.fmod);                                  // ldrb  scratch,[fmod]
+	get_imm_relative(a, TEMP_REG1, &m_near.fpcrmode[0]);                                // add   temp1,base,#fpcrmode
+	a.ldr(SCRATCH_REG1, a64::ptr(TEMP_REG1, SCRATCH_REG1, a64::lsl(3)));                // ldr   scratch,[temp1,scratch,lsl #3]
+	a.msr(Predicate::SysReg::kFPCR, SCRATCH_REG1);                                      // msr   fpcr,scratch
+
+	// save the stack pointer for HASHJMP/RECOVER and jump to the code
+	a.mov(SCRATCH_REG1, a64::sp);                                                       // mov   scratch,sp
+	emit_str_mem(a, SCRATCH_REG1, &m_near.hashstacksave);                               // str   scratch,[hashstacksave]
+	a.br(REG_PARAM1);                                                                   // br    x0
+
+	// generate an exit point
+	m_exit = dst + a.offset();
+	a.bind(a.newNamedLabel("exit_point"));
+	emit_ldr_mem(a, SCRATCH_REG1, &m_near.hashstacksave);                               // ldr   scratch,[hashstacksave]
+	a.mov(a64::sp, SCRATCH_REG1);                                                       // mov   sp,scratch
+	emit_ldr_mem(a, SCRATCH_REG1, &m_near.hostfpcr);                                    // ldr   scratch,[hostfpcr]
+	a.msr(Predicate::SysReg::kFPCR, SCRATCH_REG1);                                      // msr   fpcr,scratch
+	a.ldp(a64::d14, a64::d15, a64::ptr(a64::sp, 144));                                  // ldp   d14,d15,[sp,#144]
+	a.ldp(a64::d12, a64::d13, a64::ptr(a64::sp, 128));                                  // ldp   d12,d13,[sp,#128]
+	a.ldp(a64::d10, a64::d11, a64::ptr(a64::sp, 112));                                  // ldp   d10,d11,[sp,#112]
+	a.ldp(a64::d8, a64::d9, a64::ptr(a64::sp, 96));                                     // ldp   d8,d9,[sp,#96]
+	a.ldp(a64::x27, a64::x28, a64::ptr(a64::sp, 80));                                   // ldp   x27,x28,[sp,#80]
+	a.ldp(a64::x25, a64::x26, a64::ptr(a64::sp, 64));                                   // ldp   x25,x26,[sp,#64]
+	a.ldp(a64::x23, a64::x24, a64::ptr(a64::sp, 48));                                   // ldp   x23,x24,[sp,#48]
+	a.ldp(a64::x21, a64::x22, a64::ptr(a64::sp, 32));                                   // ldp   x21,x22,[sp,#32]
+	a.ldp(a64::x19, a64::x20, a64::ptr(a64::sp, 16));                                   // ldp   x19,x20,[sp,#16]
+	a.ldp(a64::x29, a64::x30, a64::ptr_post(a64::sp, 160));                            // ldp   x29,x30,[sp],#160
+	a.ret(a64::x30);                                                                    // ret
+
+	// generate a no code point
+	m_nocode = dst + a.offset();
+	a.bind(a.newNamedLabel("nocode_point"));
+	a.ret(a64::x30);                                                                    // ret
+
+	// emit the generated code
+	emit(ch);
+
+	// reset our hash tables
+	m_hash.reset();
+	m_hash.set_default_codeptr(m_nocode);
+}
+
+
+//-------------------------------------------------
+//  execute - execute a block of code referenced
+//  by the given handle
+//-------------------------------------------------
+
+int drcbe_arm64::execute(code_handle &entry)
+{
+	// call our entry point which will jump to the destination
+	m_cache.codegen_complete();
+	return (*m_entry)(entry.codeptr());
+}
+
+
+//-------------------------------------------------
+//  generate - generate code
+//-------------------------------------------------
+
+void drcbe_arm64::generate(drcuml_block &block, const instruction *instlist, uint32_t numinst)
+{
+	// tell all of our utility objects that a block is beginning
+	m_hash.block_begin(block, instlist, numinst);
+	m_map.block_begin(block);
+
+	// compute the base by aligning the cache top to a cache line (assumed to be 64 bytes)
+	uint8_t *dst = (uint8_t *)(uint64_t(m_cache.top() + 63) & ~63);
+
+	CodeHolder ch;
+	ch.init(Environment::host(), uint64_t(dst));
+	ThrowableErrorHandler e;
+	ch.setErrorHandler(&e);
+
+	FileLogger logger(m_log_asmjit);
+	if (logger.file())
+	{
+		logger.setFlags(FormatFlags::kHexOffsets | FormatFlags::kHexImms | FormatFlags::kMachineCode);
+		logger.setIndentation(FormatIndentationGroup::kCode, 4);
+		ch.setLogger(&logger);
+	}
+
+	a64::Assembler a(&ch);
+	if (logger.file())
+		a.addDiagnosticOptions(DiagnosticOptions::kValidateIntermediate);
+
+	// generate code
+	for (int inum = 0; inum < numinst; inum++)
+	{
+		const instruction &inst = instlist[inum];
+		assert(inst.opcode() < std::size(s_opcode_table));
+
+		// must remain in scope until output
+		std::string dasm;
+
+		// add a comment
+		if (logger.file())
+		{
+			dasm = inst.disasm(&m_drcuml);
+			a.setInlineComment(dasm.c_str());
+		}
+
+		// generate code
+		(this->*s_opcode_table[inst.opcode()])(a, inst);
+	}
+
+	// emit the generated code
+	if (!emit(ch))
+		block.abort();
+
+	// tell all of our utility objects that the block is finished
+	m_hash.block_end(block);
+	m_map.block_end(block);
+}
+
+
+//-------------------------------------------------
+//  hash_exists - return true if the given mode/pc
+//  exists in the hash table
+//-------------------------------------------------
+
+bool drcbe_arm64::hash_exists(uint32_t mode, uint32_t pc)
+{
+	return m_hash.code_exists(mode, pc);
+}
+
+
+//-------------------------------------------------
+//  get_info - return information about the
+//  back-end implementation
+//-------------------------------------------------
+
+void drcbe_arm64::get_info(drcbe_info &info)
+{
+	for (info.direct_iregs = 0; info.direct_iregs < REG_I_COUNT; info.direct_iregs++)
+		if (int_register_map[info.direct_iregs] == 0)
+			break;
+	for (info.direct_fregs = 0; info.direct_fregs < REG_F_COUNT; info.direct_fregs++)
+		if (float_register_map[info.direct_fregs] == 0)
+			break;
+}
+
+
+//-------------------------------------------------
+//  alu_op_param - emit a three-operand ALU
+//  instruction, materializing the parameter in
+//  the scratch register if it can't be encoded
+//-------------------------------------------------
+
+void drcbe_arm64::alu_op_param(a64::Assembler &a, a64::Inst::Id const opcode, a64::Gp const &dst, a64::Gp const &src, be_parameter const &param, bool logical)
+{
+	const uint32_t regsize = dst.isGpW() ? 4 : 8;
+
+	if (param.is_immediate())
+	{
+		const uint64_t val = (regsize == 4) ? uint32_t(param.immediate()) : param.immediate();
+		const bool encodable = logical ? is_valid_immediate_mask(val, regsize) : is_valid_immediate_addsub(val);
+		if (encodable)
+		{
+			a.emit(opcode, dst, src, val);                                              // op    dst,src,#param
+		}
+		else
+		{
+			const a64::Gp scratch = select_register(SCRATCH_REG1, regsize);
+			mov_r64_imm(a, scratch, val);                                               // mov   scratch,param
+			a.emit(opcode, dst, src, scratch);                                          // op    dst,src,scratch
+		}
+	}
+	else if (param.is_memory())
+	{
+		const a64::Gp scratch = select_register(SCRATCH_REG1, regsize);
+		emit_ldr_mem(a, scratch, param.memory());                                       // ldr   scratch,[param]
+		a.emit(opcode, dst, src, scratch);                                              // op    dst,src,scratch
+	}
+	else
+	{
+		a.emit(opcode, dst, src, select_register(a64::x(param.ireg()), regsize));       // op    dst,src,param
+	}
+}
+
+
+//-------------------------------------------------
+//  store_carry_reg - set the UML carry flag from
+//  bit 0 of a register
+//-------------------------------------------------
+
+void drcbe_arm64::store_carry_reg(a64::Assembler &a, a64::Gp const &reg) const
+{
+	// host C is set by 0 - reg only when reg is zero, giving the inverted sense we keep
+	a.and_(reg.w(), reg.w(), 1);                                                        // and   reg,reg,#1
+	a.cmp(a64::wzr, reg.w());                                                           // cmp   wzr,reg
+}
+
+
+//-------------------------------------------------
+//  get_carry - load the UML carry flag into a
+//  register as 0 or 1
+//-------------------------------------------------
+
+void drcbe_arm64::get_carry(a64::Assembler &a, a64::Gp const &reg) const
+{
+	a.cset(reg, Imm(CondCode::kLO));                                                    // cset  reg,lo
+}
+
+
+//-------------------------------------------------
+//  invert_carry - flip the host carry flag
+//-------------------------------------------------
+
+void drcbe_arm64::invert_carry(a64::Assembler &a) const
+{
+	a.mrs(SCRATCH_REG2, Predicate::SysReg::kNZCV);                                      // mrs   scratch2,nzcv
+	a.eor(SCRATCH_REG2, SCRATCH_REG2, NZCV_C);                                          // eor   scratch2,scratch2,#C
+	a.msr(Predicate::SysReg::kNZCV, SCRATCH_REG2);                                      // msr   nzcv,scratch2
+}
+
+
+//-------------------------------------------------
+//  set_flags_nzv - set the host flags from the
+//  zero-ness of one register, the sign of another
+//  and the non-zero-ness of a third; the UML
+//  carry is cleared
+//-------------------------------------------------
+
+void drcbe_arm64::set_flags_nzv(a64::Assembler &a, a64::Gp const &zreg, a64::Gp const &nreg, a64::Gp const &vreg) const
+{
+	const a64::Gp nscratch = select_register(SCRATCH_REG1, nreg.isGpW() ? 4 : 8);
+
+	a.cmp(vreg, 0);                                                                     // cmp   vreg,#0
+	a.cset(SCRATCH_REG2.w(), Imm(CondCode::kNE));                                       // cset  scratch2,ne
+	a.cmp(zreg, 0);                                                                     // cmp   zreg,#0
+	a.cset(SCRATCH_REG1.w(), Imm(CondCode::kEQ));                                       // cset  scratch1,eq
+	a.bfi(SCRATCH_REG2.w(), SCRATCH_REG1.w(), 2, 1);                                    // bfi   scratch2,scratch1,#2,#1
+	a.lsr(nscratch, nreg, nreg.isGpW() ? 31 : 63);                                      // lsr   scratch1,nreg,#sign
+	a.bfi(SCRATCH_REG2.w(), SCRATCH_REG1.w(), 3, 1);                                    // bfi   scratch2,scratch1,#3,#1
+	a.orr(SCRATCH_REG2.w(), SCRATCH_REG2.w(), 2);                                       // orr   scratch2,scratch2,#2
+	a.lsl(SCRATCH_REG2.w(), SCRATCH_REG2.w(), 28);                                      // lsl   scratch2,scratch2,#28
+	a.msr(Predicate::SysReg::kNZCV, SCRATCH_REG2);                                      // msr   nzcv,scratch2
+}
+
+
+//-------------------------------------------------
+//  set_flags_nzc - set the host flags from the
+//  sign and zero-ness of the result and the UML
+//  carry in bit 0 of a register
+//-------------------------------------------------
+
+void drcbe_arm64::set_flags_nzc(a64::Assembler &a, a64::Gp const &result, a64::Gp const &carry) const
+{
+	a.eor(SCRATCH_REG1.w(), carry.w(), 1);                                              // eor   scratch1,carry,#1
+	a.tst(result, result);                                                              // tst   result,result
+	a.mrs(SCRATCH_REG2, Predicate::SysReg::kNZCV);                                      // mrs   scratch2,nzcv
+	a.bfi(SCRATCH_REG2, SCRATCH_REG1, 29, 1);                                           // bfi   scratch2,scratch1,#29,#1
+	a.msr(Predicate::SysReg::kNZCV, SCRATCH_REG2);                                      // msr   nzcv,scratch2
+}
+
+
+//-------------------------------------------------
+//  mov_reg_param - move a parameter into a
+//  register
+//-------------------------------------------------
+
+void drcbe_arm64::mov_reg_param(a64::Assembler &a, uint32_t regsize, a64::Gp const &dst, be_parameter const &src) const
+{
+	const a64::Gp dstreg = select_register(dst, regsize);
+
+	if (src.is_immediate())
+		mov_r64_imm(a, dstreg, (regsize == 4) ? uint32_t(src.immediate()) : src.immediate());   // mov   dst,#src
+	else if (src.is_int_register() && dstreg.id() != src.ireg())
+		a.mov(dstreg, select_register(a64::x(src.ireg()), regsize));                   // mov   dst,src
+	else if (src.is_memory())
+		emit_ldr_mem(a, dstreg, src.memory());                                          // ldr   dst,[src]
+}
+
+
+//-------------------------------------------------
+//  mov_param_reg - move a register into a
+//  parameter
+//-------------------------------------------------
+
+void drcbe_arm64::mov_param_reg(a64::Assembler &a, uint32_t regsize, be_parameter const &dst, a64::Gp const &src) const
+{
+	assert(!dst.is_immediate());
+
+	const a64::Gp srcreg = select_register(src, regsize);
+
+	if (dst.is_memory())
+		emit_str_mem(a, srcreg, dst.memory());                                          // str   src,[dst]
+	else if (dst.is_int_register() && srcreg.id() != dst.ireg())
+		a.mov(select_register(a64::x(dst.ireg()), regsize), srcreg);                   // mov   dst,src
+}
+
+
+//-------------------------------------------------
+//  mov_param_imm - move an immediate into a
+//  parameter
+//-------------------------------------------------
+
+void drcbe_arm64::mov_param_imm(a64::Assembler &a, uint32_t regsize, be_parameter const &dst, uint64_t src) const
+{
+	assert(!dst.is_immediate());
+
+	if (regsize == 4)
+		src = uint32_t(src);
+
+	if (dst.is_memory())
+	{
+		if (src == 0)
+		{
+			emit_str_mem(a, select_register(a64::xzr, regsize), dst.memory());          // str   zr,[dst]
+		}
+		else
+		{
+			const a64::Gp scratch = select_register(SCRATCH_REG1, regsize);
+			mov_r64_imm(a, scratch, src);                                               // mov   scratch,#src
+			emit_str_mem(a, scratch, dst.memory());                                     // str   scratch,[dst]
+		}
+	}
+	else if (dst.is_int_register())
+	{
+		mov_r64_imm(a, select_register(a64::x(dst.ireg()), regsize), src);             // mov   dst,#src
+	}
+}
+
+
+//-------------------------------------------------
+//  mov_param_param - move one parameter into
+//  another
+//-------------------------------------------------
+
+void drcbe_arm64::mov_param_param(a64::Assembler &a, uint32_t regsize, be_parameter const &dst, be_parameter const &src) const
+{
+	assert(!dst.is_immediate());
+
+	if (src.is_immediate())
+	{
+		mov_param_imm(a, regsize, dst, src.immediate());
+	}
+	else if (dst.is_int_register())
+	{
+		mov_reg_param(a, regsize, a64::x(dst.ireg()), src);
+	}
+	else if (src.is_int_register())
+	{
+		mov_param_reg(a, regsize, dst, a64::x(src.ireg()));
+	}
+	else if (dst != src)
+	{
+		const a64::Gp scratch = select_register(SCRATCH_REG1, regsize);
+		emit_ldr_mem(a, scratch, src.memory());                                         // ldr   scratch,[src]
+		emit_str_mem(a, scratch, dst.memory());                                         // str   scratch,[dst]
+	}
+}
+
+
+//-------------------------------------------------
+//  mov_mem_param - move a parameter into memory
+//-------------------------------------------------
+
+void drcbe_arm64::mov_mem_param(a64::Assembler &a, uint32_t regsize, void *dst, be_parameter const &src) const
+{
+	mov_param_param(a, regsize, be_parameter::make_memory(dst), src);
+}
+
+
+//-------------------------------------------------
+//  mov_r64_imm - move an immediate into a
+//  register
+//-------------------------------------------------
+
+void drcbe_arm64::mov_r64_imm(a64::Assembler &a, a64::Gp const &dst, uint64_t const src) const
+{
+	a.mov(dst, dst.isGpW() ? uint64_t(uint32_t(src)) : src);                            // mov   dst,#src
+}
+
+
+
+/***************************************************************************
+    FLOATING POINT HELPERS
+***************************************************************************/
+
+//-------------------------------------------------
+//  mov_float_reg_param - move a floating-point
+//  parameter into a register
+//-------------------------------------------------
+
+void drcbe_arm64::mov_float_reg_param(a64::Assembler &a, uint32_t regsize, a64::Vec const &dst, be_parameter const &src) const
+{
+	assert(!src.is_immediate());
+
+	const a64::Vec dstreg = select_register(dst, regsize);
+
+	if (src.is_memory())
+		emit_float_ldr_mem(a, dstreg, src.memory());                                    // ldr   dst,[src]
+	else if (src.is_float_register() && dstreg.id() != src.freg())
+		a.fmov(dstreg, select_register(a64::d(src.freg()), regsize));                  // fmov  dst,src
+}
+
+
+//-------------------------------------------------
+//  mov_float_param_reg - move a floating-point
+//  register into a parameter
+//-------------------------------------------------
+
+void drcbe_arm64::mov_float_param_reg(a64::Assembler &a, uint32_t regsize, be_parameter const &dst, a64::Vec const &src) const
+{
+	assert(!dst.is_immediate());
+
+	const a64::Vec srcreg = select_register(src, regsize);
+
+	if (dst.is_memory())
+		emit_float_str_mem(a, srcreg, dst.memory());                                    // str   src,[dst]
+	else if (dst.is_float_register() && srcreg.id() != dst.freg())
+		a.fmov(select_register(a64::d(dst.freg()), regsize), srcreg);                  // fmov  dst,src
+}
+
+
+//-------------------------------------------------
+//  mov_float_param_param - move one floating-point
+//  parameter into another
+//-------------------------------------------------
+
+void drcbe_arm64::mov_float_param_param(a64::Assembler &a, uint32_t regsize, be_parameter const &dst, be_parameter const &src) const
+{
+	assert(!src.is_immediate());
+	assert(!dst.is_immediate());
+
+	if (dst.is_float_register())
+	{
+		mov_float_reg_param(a, regsize, a64::d(dst.freg()), src);
+	}
+	else if (src.is_float_register())
+	{
+		mov_float_param_reg(a, regsize, dst, a64::d(src.freg()));
+	}
+	else if (dst != src)
+	{
+		// memory to memory copies don't need to go through the vector unit
+		const a64::Gp scratch = select_register(SCRATCH_REG1, regsize);
+		emit_ldr_mem(a, scratch, src.memory());                                         // ldr   scratch,[src]
+		emit_str_mem(a, scratch, dst.memory());                                         // str   scratch,[dst]
+	}
+}
+
+
+
+/***************************************************************************
+    DEBUG HELPERS
+***************************************************************************/
+
+//-------------------------------------------------
+//  debug_log_hashjmp - callback to handle
+//  logging of hashjmps
+//-------------------------------------------------
+
+void drcbe_arm64::debug_log_hashjmp(offs_t pc, int mode)
+{
+	printf("mode=%d PC=%08X\n", mode, pc);
+}
+
+
+//-------------------------------------------------
+//  debug_log_hashjmp - callback to handle
+//  logging of hashjmps
+//-------------------------------------------------
+
+void drcbe_arm64::debug_log_hashjmp_fail()
+{
+	printf("  (FAIL)\n");
+}
+
+
+
+/***************************************************************************
+    COMPILE-TIME OPCODES
+***************************************************************************/
+
+//-------------------------------------------------
+//  op_handle - process a HANDLE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_handle(a64::Assembler &a, const instruction &inst)
+{
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 1);
+	assert(inst.param(0).is_code_handle());
+
+	// make a label for documentation
+	Label handle = a.newNamedLabel(inst.param(0).handle().string());
+	a.bind(handle);
+
+	// emit a jump around the stack adjust in case code falls through here
+	Label skip = a.newLabel();
+	a.b(skip);                                                                          // b     skip
+
+	// register the current pointer for the handle
+	inst.param(0).handle().set_codeptr(drccodeptr(a.code()->baseAddress() + a.offset()));
+
+	// by default, the handle points to prolog code that saves the return address
+	a.str(a64::x30, a64::ptr_pre(a64::sp, -16));                                        // str   x30,[sp,#-16]!
+	a.bind(skip);                                                                   // skip:
+}
+
+
+//-------------------------------------------------
+//  op_hash - process a HASH opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_hash(a64::Assembler &a, const instruction &inst)
+{
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 2);
+	assert(inst.param(0).is_immediate());
+	assert(inst.param(1).is_immediate());
+
+	// register the current pointer for the mode/PC
+	m_hash.set_codeptr(inst.param(0).immediate(), inst.param(1).immediate(), drccodeptr(a.code()->baseAddress() + a.offset()));
+}
+
+
+//-------------------------------------------------
+//  op_label - process a LABEL opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_label(a64::Assembler &a, const instruction &inst)
+{
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 1);
+	assert(inst.param(0).is_code_label());
+
+	std::string labelName = util::string_format("PC$%x", inst.param(0).label());
+	Label label = a.labelByName(labelName.c_str());
+	if (!label.isValid())
+		label = a.newNamedLabel(labelName.c_str());
+
+	// register the current pointer for the label
+	a.bind(label);
+}
+
+
+//-------------------------------------------------
+//  op_comment - process a COMMENT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_comment(a64::Assembler &a, const instruction &inst)
+{
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 1);
+	assert(inst.param(0).is_string());
+
+	// do nothing
+}
+
+
+//-------------------------------------------------
+//  op_mapvar - process a MAPVAR opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_mapvar(a64::Assembler &a, const instruction &inst)
+{
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 2);
+	assert(inst.param(0).is_mapvar());
+	assert(inst.param(1).is_immediate());
+
+	// set the value of the specified mapvar
+	m_map.set_value(drccodeptr(a.code()->baseAddress() + a.offset()), inst.param(0).mapvar(), inst.param(1).immediate());
+}
+
+
+
+/***************************************************************************
+    CONTROL FLOW OPCODES
+***************************************************************************/
+
+//-------------------------------------------------
+//  op_nop - process a NOP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_nop(a64::Assembler &a, const instruction &inst)
+{
+	// nothing
+}
+
+
+//-------------------------------------------------
+//  op_debug - process a DEBUG opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_debug(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	if ((m_device.machine().debug_flags & DEBUG_FLAG_ENABLED) != 0)
+	{
+		// normalize parameters
+		be_parameter pcp(*this, inst.param(0), PTYPE_MRI);
+
+		// test and branch
+		emit_ldr_mem(a, TEMP_REG1.w(), &m_device.machine().debug_flags);                 // ldr   temp1,[debug_flags]
+		Label skip = a.newLabel();
+		a.tst(TEMP_REG1.w(), DEBUG_FLAG_CALL_HOOK);                                       // tst   temp1,#DEBUG_FLAG_CALL_HOOK
+		a.b(CondCode::kEQ, skip);                                                       // b.eq  skip
+
+		// push the parameter
+		mov_r64_imm(a, REG_PARAM1, (uintptr_t)m_device.debug());                        // mov   param1,device.debug
+		mov_reg_param(a, 4, REG_PARAM2, pcp);                                           // mov   param2,pcp
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &m_near.debug_cpu_instruction_hook);           // ldr   scratch,[debug_cpu_instruction_hook]
+		a.blr(MEM_SCRATCH_REG);                                                         // blr   scratch
+
+		a.bind(skip);
+	}
+}
+
+
+//-------------------------------------------------
+//  op_exit - process an EXIT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_exit(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter retp(*this, inst.param(0), PTYPE_MRI);
+
+	// a conditional branch can't reach the exit point from anywhere in the cache
+	Label skip;
+	emit_skip(a, inst.condition(), skip);
+
+	// load the parameter into W0
+	mov_reg_param(a, 4, REG_PARAM1, retp);                                              // mov   w0,retp
+	a.b(Imm(uintptr_t(m_exit)));                                                        // b     exit
+
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.bind(skip);                                                               // skip:
+}
+
+
+//-------------------------------------------------
+//  op_hashjmp - process a HASHJMP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_hashjmp(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter modep(*this, inst.param(0), PTYPE_MRI);
+	be_parameter pcp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &exp = inst.param(2);
+	assert(exp.is_code_handle());
+
+	if (LOG_HASHJMPS)
+	{
+		mov_reg_param(a, 4, REG_PARAM1, pcp);
+		mov_reg_param(a, 4, REG_PARAM2, modep);
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &m_near.debug_log_hashjmp);
+		a.blr(MEM_SCRATCH_REG);
+	}
+
+	// reset the stack to the top level
+	emit_ldr_mem(a, TEMP_REG1, &m_near.hashstacksave);                                  // ldr   temp1,[hashstacksave]
+	a.mov(a64::sp, TEMP_REG1);                                                          // mov   sp,temp1
+
+	const uint32_t l2bits = population_count_32(m_hash.l2mask());
+
+	// fixed mode cases
+	if (modep.is_immediate() && m_hash.is_mode_populated(modep.immediate()))
+	{
+		// a straight immediate jump is direct
+		if (pcp.is_immediate())
+		{
+			uint32_t l1val = (pcp.immediate() >> m_hash.l1shift()) & m_hash.l1mask();
+			uint32_t l2val = (pcp.immediate() >> m_hash.l2shift()) & m_hash.l2mask();
+			emit_ldr_mem(a, TEMP_REG1, &m_hash.base()[modep.immediate()][l1val][l2val]); // ldr   temp1,hash[modep][l1val][l2val]
+		}
+
+		// a fixed mode but variable PC
+		else
+		{
+			mov_reg_param(a, 4, TEMP_REG2, pcp);                                        // mov   temp2,pcp
+			get_imm_relative(a, TEMP_REG1, m_hash.base()[modep.immediate()]);           // mov   temp1,hash[modep]
+			a.lsr(TEMP_REG3.w(), TEMP_REG2.w(), m_hash.l1shift());                      // lsr   temp3,temp2,#l1shift
+			a.ldr(TEMP_REG1, a64::ptr(TEMP_REG1, TEMP_REG3, a64::lsl(3)));              // ldr   temp1,[temp1,temp3,lsl #3]
+			a.ubfx(TEMP_REG2.w(), TEMP_REG2.w(), m_hash.l2shift(), l2bits);             // ubfx  temp2,temp2,#l2shift,#l2bits
+			a.ldr(TEMP_REG1, a64::ptr(TEMP_REG1, TEMP_REG2, a64::lsl(3)));              // ldr   temp1,[temp1,temp2,lsl #3]
+		}
+	}
+	else
+	{
+		// variable mode
+		mov_reg_param(a, 4, TEMP_REG3, modep);                                          // mov   temp3,modep
+		get_imm_relative(a, TEMP_REG1, m_hash.base());                                  // mov   temp1,hash
+		a.ldr(TEMP_REG1, a64::ptr(TEMP_REG1, TEMP_REG3, a64::lsl(3)));                  // ldr   temp1,[temp1,temp3,lsl #3]
+
+		// fixed PC
+		if (pcp.is_immediate())
+		{
+			uint32_t l1val = (pcp.immediate() >> m_hash.l1shift()) & m_hash.l1mask();
+			uint32_t l2val = (pcp.immediate() >> m_hash.l2shift()) & m_hash.l2mask();
+			if (is_valid_immediate(l1val, 12))
+			{
+				a.ldr(TEMP_REG1, a64::ptr(TEMP_REG1, l1val * 8));                       // ldr   temp1,[temp1,#l1val*8]
+			}
+			else
+			{
+				a.mov(TEMP_REG2, l1val);                                                // mov   temp2,#l1val
+				a.ldr(TEMP_REG1, a64::ptr(TEMP_REG1, TEMP_REG2, a64::lsl(3)));          // ldr   temp1,[temp1,temp2,lsl #3]
+			}
+			if (is_valid_immediate(l2val, 12))
+			{
+				a.ldr(TEMP_REG1, a64::ptr(TEMP_REG1, l2val * 8));                       // ldr   temp1,[temp1,#l2val*8]
+			}
+			else
+			{
+				a.mov(TEMP_REG2, l2val);                                                // mov   temp2,#l2val
+				a.ldr(TEMP_REG1, a64::ptr(TEMP_REG1, TEMP_REG2, a64::lsl(3)));          // ldr   temp1,[temp1,temp2,lsl #3]
+			}
+		}
+
+		// variable PC
+		else
+		{
+			mov_reg_param(a, 4, TEMP_REG2, pcp);                                        // mov   temp2,pcp
+			a.lsr(TEMP_REG3.w(), TEMP_REG2.w(), m_hash.l1shift());                      // lsr   temp3,temp2,#l1shift
+			a.ldr(TEMP_REG1, a64::ptr(TEMP_REG1, TEMP_REG3, a64::lsl(3)));              // ldr   temp1,[temp1,temp3,lsl #3]
+			a.ubfx(TEMP_REG2.w(), TEMP_REG2.w(), m_hash.l2shift(), l2bits);             // ubfx  temp2,temp2,#l2shift,#l2bits
+			a.ldr(TEMP_REG1, a64::ptr(TEMP_REG1, TEMP_REG2, a64::lsl(3)));              // ldr   temp1,[temp1,temp2,lsl #3]
+		}
+	}
+	a.blr(TEMP_REG1);                                                                   // blr   temp1
+
+	// in all cases, if there is no code, we return here to generate the exception
+	if (LOG_HASHJMPS)
+	{
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &m_near.debug_log_hashjmp_fail);
+		a.blr(MEM_SCRATCH_REG);
+	}
+
+	mov_mem_param(a, 4, &m_state.exp, pcp);                                             // str   pcp,[exp]
+	call_arm_handle(a, exp.handle());                                                   // bl    exp
+}
+
+
+//-------------------------------------------------
+//  op_jmp - process a JMP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_jmp(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	const parameter &labelp = inst.param(0);
+	assert(labelp.is_code_label());
+
+	std::string labelName = util::string_format("PC$%x", labelp.label());
+	Label jmptarget = a.labelByName(labelName.c_str());
+	if (!jmptarget.isValid())
+		jmptarget = a.newNamedLabel(labelName.c_str());
+
+	if (inst.condition() == uml::COND_ALWAYS)
+		a.b(jmptarget);                                                                 // b     target
+	else
+		a.b(ARM_CONDITION(inst.condition()), jmptarget);                                // b.cc  target
+}
+
+
+//-------------------------------------------------
+//  op_exh - process an EXH opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_exh(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	const parameter &handp = inst.param(0);
+	assert(handp.is_code_handle());
+	be_parameter exp(*this, inst.param(1), PTYPE_MRI);
+
+	// perform the exception processing
+	Label no_exception;
+	emit_skip(a, inst.condition(), no_exception);
+
+	mov_mem_param(a, 4, &m_state.exp, exp);                                             // str   exp,[exp]
+	call_arm_handle(a, handp.handle());                                                 // bl    handle
+
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.bind(no_exception);
+}
+
+
+//-------------------------------------------------
+//  op_callh - process a CALLH opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_callh(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	const parameter &handp = inst.param(0);
+	assert(handp.is_code_handle());
+
+	// skip if conditional
+	Label skip;
+	emit_skip(a, inst.condition(), skip);
+
+	// jump through the handle; directly if a normal jump
+	call_arm_handle(a, handp.handle());                                                 // bl    handle
+
+	// resolve the conditional link
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.bind(skip);                                                               // skip:
+}
+
+
+//-------------------------------------------------
+//  op_ret - process a RET opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_ret(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+	assert(inst.numparams() == 0);
+
+	// skip if conditional
+	Label skip;
+	emit_skip(a, inst.condition(), skip);
+
+	// return
+	a.ldr(a64::x30, a64::ptr_post(a64::sp, 16));                                        // ldr   x30,[sp],#16
+	a.ret(a64::x30);                                                                    // ret
+
+	// resolve the conditional link
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.bind(skip);                                                               // skip:
+}
+
+
+//-------------------------------------------------
+//  op_callc - process a CALLC opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_callc(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	const parameter &funcp = inst.param(0);
+	assert(funcp.is_c_function());
+	be_parameter paramp(*this, inst.param(1), PTYPE_M);
+
+	// skip if conditional
+	Label skip;
+	emit_skip(a, inst.condition(), skip);
+
+	// perform the call
+	mov_r64_imm(a, REG_PARAM1, (uintptr_t)paramp.memory());                             // mov   param1,paramp
+	call_arm_addr(a, (const void *)(uintptr_t)funcp.cfunc());                           // bl    funcp
+
+	// resolve the conditional link
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.bind(skip);                                                               // skip:
+}
+
+
+//-------------------------------------------------
+//  op_recover - process a RECOVER opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_recover(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+
+	// the return address saved by the outermost handle prolog points after its call
+	emit_ldr_mem(a, SCRATCH_REG1, &m_near.hashstacksave);                               // ldr   scratch,[hashstacksave]
+	a.ldr(REG_PARAM2, a64::ptr(SCRATCH_REG1, -16));                                     // ldr   param2,[scratch,#-16]
+	a.sub(REG_PARAM2, REG_PARAM2, 4);                                                   // sub   param2,param2,#4
+	mov_r64_imm(a, REG_PARAM1, (uintptr_t)&m_map);                                      // mov   param1,m_map
+	a.mov(REG_PARAM3.w(), inst.param(1).mapvar());                                      // mov   param3,param[1].value
+	emit_ldr_mem(a, MEM_SCRATCH_REG, &m_near.drcmap_get_value);                         // ldr   scratch,[drcmap_get_value]
+	a.blr(MEM_SCRATCH_REG);                                                             // blr   scratch
+	mov_param_reg(a, 4, dstp, REG_PARAM1);                                              // mov   dstp,w0
+}
+
+
+
+/***************************************************************************
+    INTERNAL REGISTER OPCODES
+***************************************************************************/
+
+//-------------------------------------------------
+//  op_setfmod - process a SETFMOD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_setfmod(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter srcp(*this, inst.param(0), PTYPE_MRI);
+
+	// immediate case
+	if (srcp.is_immediate())
+	{
+		int value = srcp.immediate() & 3;
+		a.mov(SCRATCH_REG1.w(), value);                                                 // mov   scratch,#srcp
+		emit_strb_mem(a, SCRATCH_REG1.w(), &m_state.fmod);                              // strb  scratch,[fmod]
+		emit_ldr_mem(a, SCRATCH_REG1, &m_near.fpcrmode[value]);                         // ldr   scratch,fpcrmode[srcp]
+	}
+
+	// register/memory case
+	else
+	{
+		mov_reg_param(a, 4, SCRATCH_REG1, srcp);                                        // mov   scratch,srcp
+		a.and_(SCRATCH_REG1.w(), SCRATCH_REG1.w(), 3);                                  // and   scratch,scratch,#3
+		emit_strb_mem(a, SCRATCH_REG1.w(), &m_state.fmod);                              // strb  scratch,[fmod]
+		get_imm_relative(a, TEMP_REG1, &m_near.fpcrmode[0]);                            // add   temp1,base,#fpcrmode
+		a.ldr(SCRATCH_REG1, a64::ptr(TEMP_REG1, SCRATCH_REG1, a64::lsl(3)));            // ldr   scratch,[temp1,scratch,lsl #3]
+	}
+	a.msr(Predicate::SysReg::kFPCR, SCRATCH_REG1);                                      // msr   fpcr,scratch
+}
+
+
+//-------------------------------------------------
+//  op_getfmod - process a GETFMOD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_getfmod(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	const a64::Gp dstreg = dstp.select_register(TEMP_REG1.w());
+
+	// fetch the current mode and store to the destination
+	emit_ldrb_mem(a, dstreg, &m_state.fmod);                                            // ldrb  dstreg,[fmod]
+	mov_param_reg(a, 4, dstp, dstreg);                                                  // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_getexp - process a GETEXP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_getexp(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	const a64::Gp dstreg = dstp.select_register(TEMP_REG1.w());
+
+	// fetch the exception parameter and store to the destination
+	emit_ldr_mem(a, dstreg, &m_state.exp);                                              // ldr   dstreg,[exp]
+	mov_param_reg(a, 4, dstp, dstreg);                                                  // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_getflgs - process a GETFLGS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_getflgs(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter maskp(*this, inst.param(1), PTYPE_I);
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = dstp.select_register(TEMP_REG1.w());
+	const uint32_t allflags = FLAG_C | FLAG_V | FLAG_Z | FLAG_S | FLAG_U;
+	const uint32_t mask = maskp.immediate() & allflags;
+
+	// translate the host NZCV nibble through the flags map
+	a.mrs(SCRATCH_REG1, Predicate::SysReg::kNZCV);                                      // mrs   scratch,nzcv
+	a.lsr(SCRATCH_REG1.w(), SCRATCH_REG1.w(), 28);                                      // lsr   scratch,scratch,#28
+	get_imm_relative(a, TEMP_REG2, &m_near.flagsmap[0]);                                // add   temp2,base,#flagsmap
+	a.ldrb(dstreg, a64::ptr(TEMP_REG2, SCRATCH_REG1));                                  // ldrb  dstreg,[temp2,scratch]
+
+	// keep only the requested flags
+	if (mask != allflags)
+		alu_op_param(a, a64::Inst::kIdAnd, dstreg, dstreg, be_parameter(mask), true);  // and   dstreg,dstreg,#mask
+
+	mov_param_reg(a, 4, dstp, dstreg);                                                  // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_save - process a SAVE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_save(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_M);
+
+	// copy live state to the destination
+	get_imm_relative(a, TEMP_REG1, dstp.memory());                                      // mov   temp1,dstp
+
+	// copy flags
+	a.mrs(SCRATCH_REG1, Predicate::SysReg::kNZCV);                                      // mrs   scratch,nzcv
+	a.lsr(SCRATCH_REG1.w(), SCRATCH_REG1.w(), 28);                                      // lsr   scratch,scratch,#28
+	get_imm_relative(a, TEMP_REG2, &m_near.flagsmap[0]);                                // add   temp2,base,#flagsmap
+	a.ldrb(SCRATCH_REG1.w(), a64::ptr(TEMP_REG2, SCRATCH_REG1));                        // ldrb  scratch,[temp2,scratch]
+	a.strb(SCRATCH_REG1.w(), a64::ptr(TEMP_REG1, offsetof(drcuml_machine_state, flags)));   // strb  scratch,state->flags
+
+	// copy fmod and exp
+	emit_ldrb_mem(a, SCRATCH_REG1.w(), &m_state.fmod);                                  // ldrb  scratch,[fmod]
+	a.strb(SCRATCH_REG1.w(), a64::ptr(TEMP_REG1, offsetof(drcuml_machine_state, fmod)));    // strb  scratch,state->fmod
+	emit_ldr_mem(a, SCRATCH_REG1.w(), &m_state.exp);                                    // ldr   scratch,[exp]
+	a.str(SCRATCH_REG1.w(), a64::ptr(TEMP_REG1, offsetof(drcuml_machine_state, exp)));  // str   scratch,state->exp
+
+	// copy integer registers
+	int regoffs = offsetof(drcuml_machine_state, r);
+	for (int regnum = 0; regnum < std::size(m_state.r); regnum++)
+	{
+		if (int_register_map[regnum] != 0)
+		{
+			a.str(a64::x(int_register_map[regnum]), a64::ptr(TEMP_REG1, regoffs + 8 * regnum));
+		}
+		else
+		{
+			emit_ldr_mem(a, SCRATCH_REG1, &m_state.r[regnum].d);
+			a.str(SCRATCH_REG1, a64::ptr(TEMP_REG1, regoffs + 8 * regnum));
+		}
+	}
+
+	// copy FP registers
+	regoffs = offsetof(drcuml_machine_state, f);
+	for (int regnum = 0; regnum < std::size(m_state.f); regnum++)
+	{
+		if (float_register_map[regnum] != 0)
+		{
+			a.str(a64::d(float_register_map[regnum]), a64::ptr(TEMP_REG1, regoffs + 8 * regnum));
+		}
+		else
+		{
+			emit_ldr_mem(a, SCRATCH_REG1, &m_state.f[regnum].d);
+			a.str(SCRATCH_REG1, a64::ptr(TEMP_REG1, regoffs + 8 * regnum));
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  op_restore - process a RESTORE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_restore(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4);
+	assert_no_condition(inst);
+
+	// normalize parameters
+	be_parameter srcp(*this, inst.param(0), PTYPE_M);
+
+	// copy live state from the source
+	get_imm_relative(a, TEMP_REG1, srcp.memory());                                      // mov   temp1,srcp
+
+	// copy integer registers
+	int regoffs = offsetof(drcuml_machine_state, r);
+	for (int regnum = 0; regnum < std::size(m_state.r); regnum++)
+	{
+		if (int_register_map[regnum] != 0)
+		{
+			a.ldr(a64::x(int_register_map[regnum]), a64::ptr(TEMP_REG1, regoffs + 8 * regnum));
+		}
+		else
+		{
+			a.ldr(SCRATCH_REG1, a64::ptr(TEMP_REG1, regoffs + 8 * regnum));
+			emit_str_mem(a, SCRATCH_REG1, &m_state.r[regnum].d);
+		}
+	}
+
+	// copy FP registers
+	regoffs = offsetof(drcuml_machine_state, f);
+	for (int regnum = 0; regnum < std::size(m_state.f); regnum++)
+	{
+		if (float_register_map[regnum] != 0)
+		{
+			a.ldr(a64::d(float_register_map[regnum]), a64::ptr(TEMP_REG1, regoffs + 8 * regnum));
+		}
+		else
+		{
+			a.ldr(SCRATCH_REG1, a64::ptr(TEMP_REG1, regoffs + 8 * regnum));
+			emit_str_mem(a, SCRATCH_REG1, &m_state.f[regnum].d);
+		}
+	}
+
+	// copy fmod and exp
+	a.ldrb(SCRATCH_REG1.w(), a64::ptr(TEMP_REG1, offsetof(drcuml_machine_state, fmod)));    // ldrb  scratch,state->fmod
+	a.and_(SCRATCH_REG1.w(), SCRATCH_REG1.w(), 3);                                      // and   scratch,scratch,#3
+	emit_strb_mem(a, SCRATCH_REG1.w(), &m_state.fmod);                                  // strb  scratch,[fmod]
+	get_imm_relative(a, TEMP_REG2, &m_near.fpcrmode[0]);                                // add   temp2,base,#fpcrmode
+	a.ldr(SCRATCH_REG1, a64::ptr(TEMP_REG2, SCRATCH_REG1, a64::lsl(3)));                // ldr   scratch,[temp2,scratch,lsl #3]
+	a.msr(Predicate::SysReg::kFPCR, SCRATCH_REG1);                                      // msr   fpcr,scratch
+	a.ldr(SCRATCH_REG1.w(), a64::ptr(TEMP_REG1, offsetof(drcuml_machine_state, exp)));  // ldr   scratch,state->exp
+	emit_str_mem(a, SCRATCH_REG1.w(), &m_state.exp);                                    // str   scratch,[exp]
+
+	// copy flags
+	a.ldrb(SCRATCH_REG1.w(), a64::ptr(TEMP_REG1, offsetof(drcuml_machine_state, flags)));   // ldrb  scratch,state->flags
+	get_imm_relative(a, TEMP_REG2, &m_near.flagsunmap[0]);                              // add   temp2,base,#flagsunmap
+	a.ldr(SCRATCH_REG1.w(), a64::ptr(TEMP_REG2, SCRATCH_REG1, a64::lsl(2)));            // ldr   scratch,[temp2,scratch,lsl #2]
+	a.msr(Predicate::SysReg::kNZCV, SCRATCH_REG1);                                      // msr   nzcv,scratch
+}
+
+
+
+
+/***************************************************************************
+    INTEGER OPERATIONS
+***************************************************************************/
+
+//-------------------------------------------------
+//  op_load - process a LOAD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_load(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter basep(*this, inst.param(1), PTYPE_M);
+	be_parameter indp(*this, inst.param(2), PTYPE_MRI);
+	const parameter &scalesizep = inst.param(3);
+	assert(scalesizep.is_size_scale());
+	const int size = scalesizep.size();
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG2), inst.size());
+
+	// compute the address
+	const a64::Mem mem = get_mem_indexed(a, basep.memory(), indp, scalesizep.scale(), 1 << size);
+
+	if (size == SIZE_BYTE)
+		a.ldrb(dstreg.w(), mem);                                                        // ldrb  dstreg,[basep + scale*indp]
+	else if (size == SIZE_WORD)
+		a.ldrh(dstreg.w(), mem);                                                        // ldrh  dstreg,[basep + scale*indp]
+	else if (size == SIZE_DWORD)
+		a.ldr(dstreg.w(), mem);                                                         // ldr   dstreg,[basep + scale*indp]
+	else if (size == SIZE_QWORD)
+		a.ldr(dstreg.x(), mem);                                                         // ldr   dstreg,[basep + scale*indp]
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_loads - process a LOADS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_loads(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter basep(*this, inst.param(1), PTYPE_M);
+	be_parameter indp(*this, inst.param(2), PTYPE_MRI);
+	const parameter &scalesizep = inst.param(3);
+	assert(scalesizep.is_size_scale());
+	const int size = scalesizep.size();
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG2), inst.size());
+
+	// compute the address
+	const a64::Mem mem = get_mem_indexed(a, basep.memory(), indp, scalesizep.scale(), 1 << size);
+
+	if (size == SIZE_BYTE)
+		a.ldrsb(dstreg, mem);                                                           // ldrsb dstreg,[basep + scale*indp]
+	else if (size == SIZE_WORD)
+		a.ldrsh(dstreg, mem);                                                           // ldrsh dstreg,[basep + scale*indp]
+	else if (size == SIZE_DWORD && inst.size() == 8)
+		a.ldrsw(dstreg, mem);                                                           // ldrsw dstreg,[basep + scale*indp]
+	else if (size == SIZE_DWORD)
+		a.ldr(dstreg.w(), mem);                                                         // ldr   dstreg,[basep + scale*indp]
+	else if (size == SIZE_QWORD)
+		a.ldr(dstreg.x(), mem);                                                         // ldr   dstreg,[basep + scale*indp]
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_store - process a STORE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_store(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter basep(*this, inst.param(0), PTYPE_M);
+	be_parameter indp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter srcp(*this, inst.param(2), PTYPE_MRI);
+	const parameter &scalesizep = inst.param(3);
+	assert(scalesizep.is_size_scale());
+	const int size = scalesizep.size();
+
+	// get the source value into a register; zero can come straight from the zero register
+	a64::Gp srcreg = select_register(srcp.select_register(TEMP_REG2), inst.size());
+	if (srcp.is_immediate_value(0))
+		srcreg = select_register(a64::xzr, inst.size());
+	else
+		mov_reg_param(a, inst.size(), srcreg, srcp);                                    // mov   srcreg,srcp
+
+	// compute the address
+	const a64::Mem mem = get_mem_indexed(a, basep.memory(), indp, scalesizep.scale(), 1 << size);
+
+	if (size == SIZE_BYTE)
+		a.strb(srcreg.w(), mem);                                                        // strb  srcreg,[basep + scale*indp]
+	else if (size == SIZE_WORD)
+		a.strh(srcreg.w(), mem);                                                        // strh  srcreg,[basep + scale*indp]
+	else if (size == SIZE_DWORD)
+		a.str(srcreg.w(), mem);                                                         // str   srcreg,[basep + scale*indp]
+	else if (size == SIZE_QWORD)
+		a.str(srcreg.x(), mem);                                                         // str   srcreg,[basep + scale*indp]
+}
+
+
+//-------------------------------------------------
+//  op_read - process a READ opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_read(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter addrp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &spacesizep = inst.param(2);
+	assert(spacesizep.is_size_space());
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG2), inst.size());
+
+	// set up a call to the read handler
+	auto &trampolines = m_accessors[spacesizep.space()];
+	mov_reg_param(a, 4, REG_PARAM2, addrp);                                             // mov   param2,addrp
+	mov_r64_imm(a, REG_PARAM1, (uintptr_t)m_space[spacesizep.space()]);                 // mov   param1,space
+	if (spacesizep.size() == SIZE_BYTE)
+	{
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.read_byte);                       // ldr   scratch,[read_byte]
+		a.blr(MEM_SCRATCH_REG);                                                         // blr   scratch
+		a.uxtb(dstreg.w(), REG_PARAM1.w());                                             // uxtb  dstreg,w0
+	}
+	else if (spacesizep.size() == SIZE_WORD)
+	{
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.read_word);                       // ldr   scratch,[read_word]
+		a.blr(MEM_SCRATCH_REG);                                                         // blr   scratch
+		a.uxth(dstreg.w(), REG_PARAM1.w());                                             // uxth  dstreg,w0
+	}
+	else if (spacesizep.size() == SIZE_DWORD)
+	{
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.read_dword);                      // ldr   scratch,[read_dword]
+		a.blr(MEM_SCRATCH_REG);                                                         // blr   scratch
+		a.mov(dstreg.w(), REG_PARAM1.w());                                              // mov   dstreg,w0
+	}
+	else if (spacesizep.size() == SIZE_QWORD)
+	{
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.read_qword);                      // ldr   scratch,[read_qword]
+		a.blr(MEM_SCRATCH_REG);                                                         // blr   scratch
+		a.mov(dstreg.x(), REG_PARAM1);                                                  // mov   dstreg,x0
+	}
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_readm - process a READM opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_readm(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter addrp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter maskp(*this, inst.param(2), PTYPE_MRI);
+	const parameter &spacesizep = inst.param(3);
+	assert(spacesizep.is_size_space());
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG2), inst.size());
+
+	// set up a call to the read handler
+	auto &trampolines = m_accessors[spacesizep.space()];
+	mov_reg_param(a, 4, REG_PARAM2, addrp);                                             // mov   param2,addrp
+	mov_reg_param(a, (spacesizep.size() != SIZE_QWORD) ? 4 : 8, REG_PARAM3, maskp);     // mov   param3,maskp
+	mov_r64_imm(a, REG_PARAM1, (uintptr_t)m_space[spacesizep.space()]);                 // mov   param1,space
+	if (spacesizep.size() == SIZE_WORD)
+	{
+		a.uxth(REG_PARAM3.w(), REG_PARAM3.w());                                         // uxth  param3,param3
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.read_word_masked);                // ldr   scratch,[read_word_masked]
+		a.blr(MEM_SCRATCH_REG);                                                         // blr   scratch
+		a.uxth(dstreg.w(), REG_PARAM1.w());                                             // uxth  dstreg,w0
+	}
+	else if (spacesizep.size() == SIZE_DWORD)
+	{
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.read_dword_masked);               // ldr   scratch,[read_dword_masked]
+		a.blr(MEM_SCRATCH_REG);                                                         // blr   scratch
+		a.mov(dstreg.w(), REG_PARAM1.w());                                              // mov   dstreg,w0
+	}
+	else if (spacesizep.size() == SIZE_QWORD)
+	{
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.read_qword_masked);               // ldr   scratch,[read_qword_masked]
+		a.blr(MEM_SCRATCH_REG);                                                         // blr   scratch
+		a.mov(dstreg.x(), REG_PARAM1);                                                  // mov   dstreg,x0
+	}
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_write - process a WRITE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_write(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter addrp(*this, inst.param(0), PTYPE_MRI);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &spacesizep = inst.param(2);
+	assert(spacesizep.is_size_space());
+
+	// set up a call to the write handler
+	auto &trampolines = m_accessors[spacesizep.space()];
+	mov_reg_param(a, 4, REG_PARAM2, addrp);                                             // mov   param2,addrp
+	mov_reg_param(a, (spacesizep.size() != SIZE_QWORD) ? 4 : 8, REG_PARAM3, srcp);      // mov   param3,srcp
+	mov_r64_imm(a, REG_PARAM1, (uintptr_t)m_space[spacesizep.space()]);                 // mov   param1,space
+	if (spacesizep.size() == SIZE_BYTE)
+	{
+		a.uxtb(REG_PARAM3.w(), REG_PARAM3.w());                                         // uxtb  param3,param3
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.write_byte);                      // ldr   scratch,[write_byte]
+	}
+	else if (spacesizep.size() == SIZE_WORD)
+	{
+		a.uxth(REG_PARAM3.w(), REG_PARAM3.w());                                         // uxth  param3,param3
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.write_word);                      // ldr   scratch,[write_word]
+	}
+	else if (spacesizep.size() == SIZE_DWORD)
+	{
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.write_dword);                     // ldr   scratch,[write_dword]
+	}
+	else if (spacesizep.size() == SIZE_QWORD)
+	{
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.write_qword);                     // ldr   scratch,[write_qword]
+	}
+	a.blr(MEM_SCRATCH_REG);                                                             // blr   scratch
+}
+
+
+//-------------------------------------------------
+//  op_writem - process a WRITEM opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_writem(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter addrp(*this, inst.param(0), PTYPE_MRI);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter maskp(*this, inst.param(2), PTYPE_MRI);
+	const parameter &spacesizep = inst.param(3);
+	assert(spacesizep.is_size_space());
+
+	// set up a call to the write handler
+	auto &trampolines = m_accessors[spacesizep.space()];
+	const uint32_t regsize = (spacesizep.size() != SIZE_QWORD) ? 4 : 8;
+	mov_reg_param(a, 4, REG_PARAM2, addrp);                                             // mov   param2,addrp
+	mov_reg_param(a, regsize, REG_PARAM3, srcp);                                        // mov   param3,srcp
+	mov_reg_param(a, regsize, REG_PARAM4, maskp);                                       // mov   param4,maskp
+	mov_r64_imm(a, REG_PARAM1, (uintptr_t)m_space[spacesizep.space()]);                 // mov   param1,space
+	if (spacesizep.size() == SIZE_WORD)
+	{
+		a.uxth(REG_PARAM3.w(), REG_PARAM3.w());                                         // uxth  param3,param3
+		a.uxth(REG_PARAM4.w(), REG_PARAM4.w());                                         // uxth  param4,param4
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.write_word_masked);               // ldr   scratch,[write_word_masked]
+	}
+	else if (spacesizep.size() == SIZE_DWORD)
+	{
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.write_dword_masked);              // ldr   scratch,[write_dword_masked]
+	}
+	else if (spacesizep.size() == SIZE_QWORD)
+	{
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.write_qword_masked);              // ldr   scratch,[write_qword_masked]
+	}
+	a.blr(MEM_SCRATCH_REG);                                                             // blr   scratch
+}
+
+
+//-------------------------------------------------
+//  op_carry - process a CARRY opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_carry(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C);
+
+	// normalize parameters
+	be_parameter srcp(*this, inst.param(0), PTYPE_MRI);
+	be_parameter bitp(*this, inst.param(1), PTYPE_MRI);
+
+	const uint32_t bits = inst.size() * 8;
+
+	// degenerate case: source is immediate
+	if (srcp.is_immediate() && bitp.is_immediate())
+	{
+		a.mov(SCRATCH_REG1.w(), BIT(srcp.immediate(), bitp.immediate() & (bits - 1)));  // mov   scratch,#bit
+	}
+	else
+	{
+		const a64::Gp src = select_register(srcp.select_register(TEMP_REG1), inst.size());
+		mov_reg_param(a, inst.size(), src, srcp);                                       // mov   src,srcp
+
+		// extract the bit into the scratch register
+		if (bitp.is_immediate())
+		{
+			a.ubfx(select_register(SCRATCH_REG1, inst.size()), src, bitp.immediate() & (bits - 1), 1);   // ubfx  scratch,src,#bitp,#1
+		}
+		else
+		{
+			const a64::Gp shift = select_register(TEMP_REG2, inst.size());
+			mov_reg_param(a, inst.size(), shift, bitp);                                 // mov   shift,bitp
+			a.lsr(select_register(SCRATCH_REG1, inst.size()), src, shift);              // lsr   scratch,src,shift
+		}
+	}
+
+	store_carry_reg(a, SCRATCH_REG1);
+}
+
+
+//-------------------------------------------------
+//  op_set - process a SET opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_set(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+
+	if (inst.condition() == uml::COND_ALWAYS)
+		a.mov(dstreg, 1);                                                               // mov   dstreg,#1
+	else
+		a.cset(dstreg, Imm(ARM_CONDITION(inst.condition())));                           // cset  dstreg,cc
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_mov - process a MOV opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_mov(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+
+	// conditional moves into registers can use a conditional select
+	if (inst.condition() != uml::COND_ALWAYS && dstp.is_int_register())
+	{
+		const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+		a64::Gp srcreg = select_register(srcp.select_register(TEMP_REG1), inst.size());
+		if (srcp.is_immediate_value(0))
+			srcreg = select_register(a64::xzr, inst.size());
+		else
+			mov_reg_param(a, inst.size(), srcreg, srcp);                                // mov   srcreg,srcp
+		a.csel(dstreg, srcreg, dstreg, Imm(ARM_CONDITION(inst.condition())));           // csel  dstp,srcreg,dstp,cc
+		return;
+	}
+
+	// add a conditional branch otherwise
+	Label skip;
+	emit_skip(a, inst.condition(), skip);
+
+	mov_param_param(a, inst.size(), dstp, srcp);                                        // mov   dstp,srcp
+
+	// resolve the jump
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.bind(skip);
+}
+
+
+//-------------------------------------------------
+//  op_sext - process a SEXT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_sext(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_S | FLAG_Z);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &sizep = inst.param(2);
+	assert(sizep.is_size());
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+
+	if (srcp.is_memory())
+	{
+		// memory sources can be sign extended by the load itself
+		if (sizep.size() == SIZE_BYTE)
+			emit_ldr_str_base_mem(a, a64::Inst::kIdLdrsb, dstreg, 1, srcp.memory());   // ldrsb dstreg,[srcp]
+		else if (sizep.size() == SIZE_WORD)
+			emit_ldr_str_base_mem(a, a64::Inst::kIdLdrsh, dstreg, 2, srcp.memory());   // ldrsh dstreg,[srcp]
+		else if (sizep.size() == SIZE_DWORD && inst.size() == 8)
+			emit_ldr_str_base_mem(a, a64::Inst::kIdLdrsw, dstreg, 4, srcp.memory());   // ldrsw dstreg,[srcp]
+		else
+			emit_ldr_mem(a, dstreg, srcp.memory());                                     // ldr   dstreg,[srcp]
+	}
+	else
+	{
+		const a64::Gp srcreg = select_register(srcp.select_register(dstreg), inst.size());
+		mov_reg_param(a, inst.size(), srcreg, srcp);                                    // mov   srcreg,srcp
+		if (sizep.size() == SIZE_BYTE)
+			a.sxtb(dstreg, srcreg.w());                                                 // sxtb  dstreg,srcreg
+		else if (sizep.size() == SIZE_WORD)
+			a.sxth(dstreg, srcreg.w());                                                 // sxth  dstreg,srcreg
+		else if (sizep.size() == SIZE_DWORD && inst.size() == 8)
+			a.sxtw(dstreg, srcreg.w());                                                 // sxtw  dstreg,srcreg
+		else if (dstreg.id() != srcreg.id())
+			a.mov(dstreg, srcreg);                                                      // mov   dstreg,srcreg
+	}
+
+	if (inst.flags())
+		a.tst(dstreg, dstreg);                                                          // tst   dstreg,dstreg
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_roland - process an ROLAND opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_roland(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_S | FLAG_Z);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter shiftp(*this, inst.param(2), PTYPE_MRI);
+	be_parameter maskp(*this, inst.param(3), PTYPE_MRI);
+
+	const uint32_t bits = inst.size() * 8;
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+	const a64::Gp srcreg = select_register(srcp.select_register(TEMP_REG1), inst.size());
+	mov_reg_param(a, inst.size(), srcreg, srcp);                                        // mov   srcreg,srcp
+
+	// rotate left by rotating right by the complement
+	a64::Gp rotreg = srcreg;
+	if (!shiftp.is_immediate())
+	{
+		const a64::Gp shift = select_register(SCRATCH_REG1, inst.size());
+		mov_reg_param(a, inst.size(), shift, shiftp);                                   // mov   shift,shiftp
+		a.neg(shift, shift);                                                            // neg   shift,shift
+		a.ror(dstreg, srcreg, shift);                                                   // ror   dstreg,srcreg,shift
+		rotreg = dstreg;
+	}
+	else if (shiftp.immediate() & (bits - 1))
+	{
+		a.ror(dstreg, srcreg, (bits - shiftp.immediate()) & (bits - 1));                // ror   dstreg,srcreg,#-shiftp
+		rotreg = dstreg;
+	}
+
+	// apply the mask
+	alu_op_param(a, inst.flags() ? a64::Inst::kIdAnds : a64::Inst::kIdAnd, dstreg, rotreg, maskp, true);
+																						// and   dstreg,rotreg,maskp
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_rolins - process an ROLINS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_rolins(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_S | FLAG_Z);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter shiftp(*this, inst.param(2), PTYPE_MRI);
+	be_parameter maskp(*this, inst.param(3), PTYPE_MRI);
+
+	const uint32_t bits = inst.size() * 8;
+
+	// pick registers; the destination is also an input
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG2), inst.size());
+	const a64::Gp srcreg = select_register(srcp.select_register(TEMP_REG1), inst.size());
+	const a64::Gp rotreg = select_register(TEMP_REG1, inst.size());
+	mov_reg_param(a, inst.size(), dstreg, dstp);                                        // mov   dstreg,dstp
+	mov_reg_param(a, inst.size(), srcreg, srcp);                                        // mov   srcreg,srcp
+
+	// rotate the source into the temporary register
+	if (!shiftp.is_immediate())
+	{
+		const a64::Gp shift = select_register(SCRATCH_REG1, inst.size());
+		mov_reg_param(a, inst.size(), shift, shiftp);                                   // mov   shift,shiftp
+		a.neg(shift, shift);                                                            // neg   shift,shift
+		a.ror(rotreg, srcreg, shift);                                                   // ror   rotreg,srcreg,shift
+	}
+	else if (shiftp.immediate() & (bits - 1))
+	{
+		a.ror(rotreg, srcreg, (bits - shiftp.immediate()) & (bits - 1));                // ror   rotreg,srcreg,#-shiftp
+	}
+	else if (rotreg.id() != srcreg.id())
+	{
+		a.mov(rotreg, srcreg);                                                          // mov   rotreg,srcreg
+	}
+
+	// merge the masked bits
+	const uint64_t instmask = (inst.size() == 4) ? 0xffffffffU : ~uint64_t(0);
+	if (maskp.is_immediate() && is_valid_immediate_mask(maskp.immediate() & instmask, inst.size()))
+	{
+		a.and_(rotreg, rotreg, maskp.immediate() & instmask);                           // and   rotreg,rotreg,#maskp
+		a.and_(dstreg, dstreg, ~maskp.immediate() & instmask);                          // and   dstreg,dstreg,#~maskp
+	}
+	else
+	{
+		const a64::Gp maskreg = select_register(TEMP_REG3, inst.size());
+		mov_reg_param(a, inst.size(), maskreg, maskp);                                  // mov   maskreg,maskp
+		a.and_(rotreg, rotreg, maskreg);                                                // and   rotreg,rotreg,maskreg
+		a.bic(dstreg, dstreg, maskreg);                                                 // bic   dstreg,dstreg,maskreg
+	}
+	a.orr(dstreg, dstreg, rotreg);                                                      // orr   dstreg,dstreg,rotreg
+
+	if (inst.flags())
+		a.tst(dstreg, dstreg);                                                          // tst   dstreg,dstreg
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_add - process a ADD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_add(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+
+	// immediates can only be encoded in the second operand
+	if (src1p.is_immediate() && !src2p.is_immediate())
+		std::swap(src1p, src2p);
+
+	const a64::Gp src1reg = select_register(src1p.select_register(TEMP_REG1), inst.size());
+	mov_reg_param(a, inst.size(), src1reg, src1p);                                      // mov   src1reg,src1p
+	alu_op_param(a, inst.flags() ? a64::Inst::kIdAdds : a64::Inst::kIdAdd, dstreg, src1reg, src2p, false);
+																						// add   dstreg,src1reg,src2p
+
+	// the host carry holds the inverse of the UML carry
+	if (inst.flags() & FLAG_C)
+		invert_carry(a);
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_addc - process a ADDC opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_addc(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+
+	// add with carry has no immediate form
+	const a64::Gp src1reg = select_register(src1p.select_register(TEMP_REG1), inst.size());
+	const a64::Gp src2reg = select_register(src2p.select_register(TEMP_REG2), inst.size());
+	mov_reg_param(a, inst.size(), src1reg, src1p);                                      // mov   src1reg,src1p
+	mov_reg_param(a, inst.size(), src2reg, src2p);                                      // mov   src2reg,src2p
+
+	invert_carry(a);
+	if (inst.flags())
+		a.adcs(dstreg, src1reg, src2reg);                                               // adcs  dstreg,src1reg,src2reg
+	else
+		a.adc(dstreg, src1reg, src2reg);                                                // adc   dstreg,src1reg,src2reg
+
+	// the host carry holds the inverse of the UML carry
+	if (inst.flags() & FLAG_C)
+		invert_carry(a);
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_sub - process a SUB opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_sub(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+
+	// the host borrow is already inverted, matching the UML carry
+	const a64::Gp src1reg = select_register(src1p.select_register(TEMP_REG1), inst.size());
+	mov_reg_param(a, inst.size(), src1reg, src1p);                                      // mov   src1reg,src1p
+	alu_op_param(a, inst.flags() ? a64::Inst::kIdSubs : a64::Inst::kIdSub, dstreg, src1reg, src2p, false);
+																						// sub   dstreg,src1reg,src2p
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_subc - process a SUBC opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_subc(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+
+	// subtract with carry has no immediate form
+	const a64::Gp src1reg = select_register(src1p.select_register(TEMP_REG1), inst.size());
+	const a64::Gp src2reg = select_register(src2p.select_register(TEMP_REG2), inst.size());
+	mov_reg_param(a, inst.size(), src1reg, src1p);                                      // mov   src1reg,src1p
+	mov_reg_param(a, inst.size(), src2reg, src2p);                                      // mov   src2reg,src2p
+
+	// the host carry is already the inverse of the UML borrow
+	if (inst.flags())
+		a.sbcs(dstreg, src1reg, src2reg);                                               // sbcs  dstreg,src1reg,src2reg
+	else
+		a.sbc(dstreg, src1reg, src2reg);                                                // sbc   dstreg,src1reg,src2reg
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_cmp - process a CMP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_cmp(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter src1p(*this, inst.param(0), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(1), PTYPE_MRI);
+
+	// compare against the zero register
+	const a64::Gp src1reg = select_register(src1p.select_register(TEMP_REG1), inst.size());
+	mov_reg_param(a, inst.size(), src1reg, src1p);                                      // mov   src1reg,src1p
+	alu_op_param(a, a64::Inst::kIdSubs, select_register(a64::xzr, inst.size()), src1reg, src2p, false);
+																						// cmp   src1reg,src2p
+}
+
+
+//-------------------------------------------------
+//  op_mulu - process a MULU opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_mulu(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter edstp(*this, inst.param(1), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(2), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(3), PTYPE_MRI);
+	const bool compute_hi = (dstp != edstp);
+
+	const a64::Gp src1reg = select_register(src1p.select_register(TEMP_REG1), inst.size());
+	const a64::Gp src2reg = select_register(src2p.select_register(TEMP_REG2), inst.size());
+	const a64::Gp lo = TEMP_REG3;
+	const a64::Gp hi = TEMP_REG4;
+	mov_reg_param(a, inst.size(), src1reg, src1p);                                      // mov   src1reg,src1p
+	mov_reg_param(a, inst.size(), src2reg, src2p);                                      // mov   src2reg,src2p
+
+	if (inst.size() == 4)
+	{
+		a.umull(lo, src1reg, src2reg);                                                  // umull lo,src1reg,src2reg
+		a.lsr(hi, lo, 32);                                                              // lsr   hi,lo,#32
+	}
+	else
+	{
+		a.mul(lo, src1reg, src2reg);                                                    // mul   lo,src1reg,src2reg
+		a.umulh(hi, src1reg, src2reg);                                                  // umulh hi,src1reg,src2reg
+	}
+
+	// store the high part first so the low part wins if they are the same
+	if (compute_hi)
+		mov_param_reg(a, inst.size(), edstp, hi);                                       // mov   edstp,hi
+	mov_param_reg(a, inst.size(), dstp, lo);                                            // mov   dstp,lo
+
+	if (inst.flags())
+	{
+		if (inst.size() == 4)
+		{
+			// flags reflect the full 64-bit product
+			set_flags_nzv(a, lo, lo, hi);
+		}
+		else
+		{
+			// zero only if both halves are zero; sign comes from the high half
+			a.orr(TEMP_REG5, lo, hi);                                                   // orr   temp5,lo,hi
+			set_flags_nzv(a, TEMP_REG5, hi, hi);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  op_muls - process a MULS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_muls(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter edstp(*this, inst.param(1), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(2), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(3), PTYPE_MRI);
+	const bool compute_hi = (dstp != edstp);
+
+	const a64::Gp src1reg = select_register(src1p.select_register(TEMP_REG1), inst.size());
+	const a64::Gp src2reg = select_register(src2p.select_register(TEMP_REG2), inst.size());
+	const a64::Gp lo = TEMP_REG3;
+	const a64::Gp hi = TEMP_REG4;
+	mov_reg_param(a, inst.size(), src1reg, src1p);                                      // mov   src1reg,src1p
+	mov_reg_param(a, inst.size(), src2reg, src2p);                                      // mov   src2reg,src2p
+
+	if (inst.size() == 4)
+	{
+		a.smull(lo, src1reg, src2reg);                                                  // smull lo,src1reg,src2reg
+		a.asr(hi, lo, 32);                                                              // asr   hi,lo,#32
+	}
+	else
+	{
+		a.mul(lo, src1reg, src2reg);                                                    // mul   lo,src1reg,src2reg
+		a.smulh(hi, src1reg, src2reg);                                                  // smulh hi,src1reg,src2reg
+	}
+
+	// store the high part first so the low part wins if they are the same
+	if (compute_hi)
+		mov_param_reg(a, inst.size(), edstp, hi);                                       // mov   edstp,hi
+	mov_param_reg(a, inst.size(), dstp, lo);                                            // mov   dstp,lo
+
+	if (inst.flags())
+	{
+		if (inst.size() == 4)
+		{
+			// overflow if the product doesn't fit in 32 bits
+			a.sxtw(TEMP_REG5, lo.w());                                                  // sxtw  temp5,lo
+			a.eor(TEMP_REG5, TEMP_REG5, lo);                                            // eor   temp5,temp5,lo
+			set_flags_nzv(a, lo.w(), lo.w(), TEMP_REG5);
+		}
+		else
+		{
+			// overflow if the high half isn't the sign extension of the low half
+			a.asr(TEMP_REG5, lo, 63);                                                   // asr   temp5,lo,#63
+			a.eor(TEMP_REG5, TEMP_REG5, hi);                                            // eor   temp5,temp5,hi
+			a.orr(TEMP_REG6, lo, hi);                                                   // orr   temp6,lo,hi
+			set_flags_nzv(a, TEMP_REG6, hi, TEMP_REG5);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  op_divu - process a DIVU opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_divu(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter edstp(*this, inst.param(1), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(2), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(3), PTYPE_MRI);
+	const bool compute_rem = (dstp != edstp);
+
+	const a64::Gp src1reg = select_register(src1p.select_register(TEMP_REG1), inst.size());
+	const a64::Gp src2reg = select_register(src2p.select_register(TEMP_REG2), inst.size());
+	const a64::Gp quo = select_register(TEMP_REG3, inst.size());
+	const a64::Gp rem = select_register(TEMP_REG4, inst.size());
+	mov_reg_param(a, inst.size(), src1reg, src1p);                                      // mov   src1reg,src1p
+	mov_reg_param(a, inst.size(), src2reg, src2p);                                      // mov   src2reg,src2p
+
+	// division by zero sets V and leaves the destinations alone
+	Label skip = a.newLabel();
+	Label divide = a.newLabel();
+	a.cbnz(src2reg, divide);                                                            // cbnz  src2reg,divide
+	if (inst.flags())
+	{
+		a.mov(SCRATCH_REG1, NZCV_V | NZCV_C);                                           // mov   scratch,#V
+		a.msr(Predicate::SysReg::kNZCV, SCRATCH_REG1);                                  // msr   nzcv,scratch
+	}
+	a.b(skip);                                                                          // b     skip
+
+	a.bind(divide);                                                                 // divide:
+	a.udiv(quo, src1reg, src2reg);                                                      // udiv  quo,src1reg,src2reg
+	if (compute_rem)
+	{
+		a.msub(rem, quo, src2reg, src1reg);                                             // msub  rem,quo,src2reg,src1reg
+		mov_param_reg(a, inst.size(), edstp, rem);                                      // mov   edstp,rem
+	}
+	mov_param_reg(a, inst.size(), dstp, quo);                                           // mov   dstp,quo
+	if (inst.flags())
+		a.tst(quo, quo);                                                                // tst   quo,quo
+
+	a.bind(skip);                                                                   // skip:
+}
+
+
+//-------------------------------------------------
+//  op_divs - process a DIVS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_divs(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_V | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter edstp(*this, inst.param(1), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(2), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(3), PTYPE_MRI);
+	const bool compute_rem = (dstp != edstp);
+
+	const a64::Gp src1reg = select_register(src1p.select_register(TEMP_REG1), inst.size());
+	const a64::Gp src2reg = select_register(src2p.select_register(TEMP_REG2), inst.size());
+	const a64::Gp quo = select_register(TEMP_REG3, inst.size());
+	const a64::Gp rem = select_register(TEMP_REG4, inst.size());
+	mov_reg_param(a, inst.size(), src1reg, src1p);                                      // mov   src1reg,src1p
+	mov_reg_param(a, inst.size(), src2reg, src2p);                                      // mov   src2reg,src2p
+
+	// division by zero sets V and leaves the destinations alone
+	Label skip = a.newLabel();
+	Label divide = a.newLabel();
+	a.cbnz(src2reg, divide);                                                            // cbnz  src2reg,divide
+	if (inst.flags())
+	{
+		a.mov(SCRATCH_REG1, NZCV_V | NZCV_C);                                           // mov   scratch,#V
+		a.msr(Predicate::SysReg::kNZCV, SCRATCH_REG1);                                  // msr   nzcv,scratch
+	}
+	a.b(skip);                                                                          // b     skip
+
+	a.bind(divide);                                                                 // divide:
+	a.sdiv(quo, src1reg, src2reg);                                                      // sdiv  quo,src1reg,src2reg
+	if (compute_rem)
+	{
+		a.msub(rem, quo, src2reg, src1reg);                                             // msub  rem,quo,src2reg,src1reg
+		mov_param_reg(a, inst.size(), edstp, rem);                                      // mov   edstp,rem
+	}
+	mov_param_reg(a, inst.size(), dstp, quo);                                           // mov   dstp,quo
+	if (inst.flags())
+		a.tst(quo, quo);                                                                // tst   quo,quo
+
+	a.bind(skip);                                                                   // skip:
+}
+
+
+//-------------------------------------------------
+//  op_and - process a AND opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_and(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+
+	// immediates can only be encoded in the second operand
+	if (src1p.is_immediate() && !src2p.is_immediate())
+		std::swap(src1p, src2p);
+
+	const a64::Gp src1reg = select_register(src1p.select_register(TEMP_REG1), inst.size());
+	mov_reg_param(a, inst.size(), src1reg, src1p);                                      // mov   src1reg,src1p
+	alu_op_param(a, inst.flags() ? a64::Inst::kIdAnds : a64::Inst::kIdAnd, dstreg, src1reg, src2p, true);
+																						// and   dstreg,src1reg,src2p
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_test - process a TEST opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_test(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter src1p(*this, inst.param(0), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(1), PTYPE_MRI);
+
+	// immediates can only be encoded in the second operand
+	if (src1p.is_immediate() && !src2p.is_immediate())
+		std::swap(src1p, src2p);
+
+	const a64::Gp src1reg = select_register(src1p.select_register(TEMP_REG1), inst.size());
+	mov_reg_param(a, inst.size(), src1reg, src1p);                                      // mov   src1reg,src1p
+	alu_op_param(a, a64::Inst::kIdAnds, select_register(a64::xzr, inst.size()), src1reg, src2p, true);
+																						// tst   src1reg,src2p
+}
+
+
+//-------------------------------------------------
+//  op_or - process a OR opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_or(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+
+	// immediates can only be encoded in the second operand
+	if (src1p.is_immediate() && !src2p.is_immediate())
+		std::swap(src1p, src2p);
+
+	const a64::Gp src1reg = select_register(src1p.select_register(TEMP_REG1), inst.size());
+	mov_reg_param(a, inst.size(), src1reg, src1p);                                      // mov   src1reg,src1p
+	alu_op_param(a, a64::Inst::kIdOrr, dstreg, src1reg, src2p, true);                   // orr   dstreg,src1reg,src2p
+
+	if (inst.flags())
+		a.tst(dstreg, dstreg);                                                          // tst   dstreg,dstreg
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_xor - process a XOR opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_xor(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MRI);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MRI);
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+
+	// immediates can only be encoded in the second operand
+	if (src1p.is_immediate() && !src2p.is_immediate())
+		std::swap(src1p, src2p);
+
+	const a64::Gp src1reg = select_register(src1p.select_register(TEMP_REG1), inst.size());
+	mov_reg_param(a, inst.size(), src1reg, src1p);                                      // mov   src1reg,src1p
+	alu_op_param(a, a64::Inst::kIdEor, dstreg, src1reg, src2p, true);                   // eor   dstreg,src1reg,src2p
+
+	if (inst.flags())
+		a.tst(dstreg, dstreg);                                                          // tst   dstreg,dstreg
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_lzcnt - process a LZCNT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_lzcnt(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+	const a64::Gp srcreg = select_register(srcp.select_register(TEMP_REG1), inst.size());
+
+	mov_reg_param(a, inst.size(), srcreg, srcp);                                        // mov   srcreg,srcp
+	a.clz(dstreg, srcreg);                                                              // clz   dstreg,srcreg
+
+	if (inst.flags())
+		a.tst(dstreg, dstreg);                                                          // tst   dstreg,dstreg
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_tzcnt - process a TZCNT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_tzcnt(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+	const a64::Gp srcreg = select_register(srcp.select_register(TEMP_REG1), inst.size());
+
+	mov_reg_param(a, inst.size(), srcreg, srcp);                                        // mov   srcreg,srcp
+	a.rbit(dstreg, srcreg);                                                             // rbit  dstreg,srcreg
+	a.clz(dstreg, dstreg);                                                              // clz   dstreg,dstreg
+
+	if (inst.flags())
+	{
+		// Z is set when there were no set bits; the result is never negative
+		a.cmp(dstreg, inst.size() * 8);                                                 // cmp   dstreg,#bits
+		a.cset(SCRATCH_REG1.w(), Imm(CondCode::kEQ));                                   // cset  scratch,eq
+		a.lsl(SCRATCH_REG1.w(), SCRATCH_REG1.w(), 30);                                  // lsl   scratch,scratch,#30
+		a.orr(SCRATCH_REG1.w(), SCRATCH_REG1.w(), NZCV_C);                              // orr   scratch,scratch,#C
+		a.msr(Predicate::SysReg::kNZCV, SCRATCH_REG1);                                  // msr   nzcv,scratch
+	}
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_bswap - process a BSWAP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_bswap(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+	const a64::Gp srcreg = select_register(srcp.select_register(TEMP_REG1), inst.size());
+
+	mov_reg_param(a, inst.size(), srcreg, srcp);                                        // mov   srcreg,srcp
+	a.rev(dstreg, srcreg);                                                              // rev   dstreg,srcreg
+
+	if (inst.flags())
+		a.tst(dstreg, dstreg);                                                          // tst   dstreg,dstreg
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_shift - process a SHL/SHR/SAR opcode
+//-------------------------------------------------
+
+template <a64::Inst::Id Opcode> void drcbe_arm64::op_shift(a64::Assembler &a, const uml::instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter shiftp(*this, inst.param(2), PTYPE_MRI);
+
+	const uint32_t bits = inst.size() * 8;
+	const bool left = (Opcode == a64::Inst::kIdLsl);
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+	const a64::Gp srcreg = select_register(srcp.select_register(TEMP_REG2), inst.size());
+	const a64::Gp carry = select_register(SCRATCH_REG1, inst.size());
+	mov_reg_param(a, inst.size(), srcreg, srcp);                                        // mov   srcreg,srcp
+
+	if (shiftp.is_immediate())
+	{
+		const uint32_t shift = shiftp.immediate() & (bits - 1);
+
+		if (shift == 0)
+		{
+			// a zero shift count leaves the flags alone
+			if (dstreg.id() != srcreg.id())
+				a.mov(dstreg, srcreg);                                                  // mov   dstreg,srcreg
+		}
+		else
+		{
+			// the carry is the last bit shifted out
+			if (inst.flags() & FLAG_C)
+				a.ubfx(carry, srcreg, left ? (bits - shift) : (shift - 1), 1);          // ubfx  carry,srcreg,#lastbit,#1
+			a.emit(Opcode, dstreg, srcreg, shift);                                      // op    dstreg,srcreg,#shift
+			if (inst.flags() & FLAG_C)
+				set_flags_nzc(a, dstreg, carry);
+			else if (inst.flags())
+				a.tst(dstreg, dstreg);                                                  // tst   dstreg,dstreg
+		}
+	}
+	else
+	{
+		const a64::Gp shift = select_register(TEMP_REG3, inst.size());
+		mov_reg_param(a, inst.size(), shift, shiftp);                                   // mov   shift,shiftp
+
+		if (inst.flags())
+		{
+			a.and_(shift, shift, bits - 1);                                             // and   shift,shift,#bits-1
+
+			// the carry is the last bit shifted out
+			const a64::Gp lastbit = select_register(TEMP_REG4, inst.size());
+			if (left)
+			{
+				a.mov(lastbit, bits);                                                   // mov   lastbit,#bits
+				a.sub(lastbit, lastbit, shift);                                         // sub   lastbit,lastbit,shift
+			}
+			else
+			{
+				a.sub(lastbit, shift, 1);                                               // sub   lastbit,shift,#1
+			}
+			a.lsr(carry, srcreg, lastbit);                                              // lsr   carry,srcreg,lastbit
+			a.emit(Opcode, dstreg, srcreg, shift);                                      // op    dstreg,srcreg,shift
+
+			// a zero shift count leaves the flags alone
+			Label skip = a.newLabel();
+			a.cbz(shift, skip);                                                         // cbz   shift,skip
+			set_flags_nzc(a, dstreg, carry);
+			a.bind(skip);                                                           // skip:
+		}
+		else
+		{
+			a.emit(Opcode, dstreg, srcreg, shift);                                      // op    dstreg,srcreg,shift
+		}
+	}
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_rotate - process a ROL/ROR opcode
+//-------------------------------------------------
+
+template <bool Left> void drcbe_arm64::op_rotate(a64::Assembler &a, const uml::instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter shiftp(*this, inst.param(2), PTYPE_MRI);
+
+	const uint32_t bits = inst.size() * 8;
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+	const a64::Gp srcreg = select_register(srcp.select_register(TEMP_REG2), inst.size());
+	const a64::Gp carry = select_register(SCRATCH_REG1, inst.size());
+	mov_reg_param(a, inst.size(), srcreg, srcp);                                        // mov   srcreg,srcp
+
+	if (shiftp.is_immediate())
+	{
+		const uint32_t shift = shiftp.immediate() & (bits - 1);
+
+		// only right rotates exist; rotate left by rotating right by the complement
+		if (shift != 0)
+			a.ror(dstreg, srcreg, Left ? (bits - shift) : shift);                       // ror   dstreg,srcreg,#shift
+		else if (dstreg.id() != srcreg.id())
+			a.mov(dstreg, srcreg);                                                      // mov   dstreg,srcreg
+
+		if (inst.flags())
+		{
+			// the carry is the bit rotated into the far end
+			if (shift == 0)
+			{
+				// ROL leaves the flags alone; ROR sets sign and zero with carry clear
+				if (!Left)
+					set_flags_nzc(a, dstreg, a64::wzr);
+			}
+			else if (Left)
+			{
+				set_flags_nzc(a, dstreg, dstreg);
+			}
+			else
+			{
+				a.lsr(carry, dstreg, bits - 1);                                         // lsr   carry,dstreg,#bits-1
+				set_flags_nzc(a, dstreg, carry);
+			}
+		}
+	}
+	else
+	{
+		const a64::Gp shift = select_register(TEMP_REG3, inst.size());
+		mov_reg_param(a, inst.size(), shift, shiftp);                                   // mov   shift,shiftp
+		if (inst.flags())
+			a.and_(shift, shift, bits - 1);                                             // and   shift,shift,#bits-1
+
+		if (Left)
+		{
+			const a64::Gp negshift = select_register(TEMP_REG4, inst.size());
+			a.neg(negshift, shift);                                                     // neg   negshift,shift
+			a.ror(dstreg, srcreg, negshift);                                            // ror   dstreg,srcreg,negshift
+		}
+		else
+		{
+			a.ror(dstreg, srcreg, shift);                                               // ror   dstreg,srcreg,shift
+		}
+
+		if (inst.flags())
+		{
+			if (Left)
+			{
+				// a zero rotate count leaves the flags alone
+				Label skip = a.newLabel();
+				a.cbz(shift, skip);                                                     // cbz   shift,skip
+				set_flags_nzc(a, dstreg, dstreg);
+				a.bind(skip);                                                       // skip:
+			}
+			else
+			{
+				// the carry is clear for a zero rotate count
+				a.lsr(carry, dstreg, bits - 1);                                         // lsr   carry,dstreg,#bits-1
+				a.cmp(shift, 0);                                                        // cmp   shift,#0
+				a.csel(carry, carry, select_register(a64::xzr, inst.size()), Imm(CondCode::kNE));
+																						// csel  carry,carry,zr,ne
+				set_flags_nzc(a, dstreg, carry);
+			}
+		}
+	}
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_rotc - process a ROLC/RORC opcode
+//-------------------------------------------------
+
+template <bool Left> void drcbe_arm64::op_rotc(a64::Assembler &a, const uml::instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_Z | FLAG_S);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter shiftp(*this, inst.param(2), PTYPE_MRI);
+
+	const uint32_t bits = inst.size() * 8;
+
+	// pick a target register for the general case
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+	const a64::Gp srcreg = select_register(srcp.select_register(TEMP_REG2), inst.size());
+	const a64::Gp shift = select_register(TEMP_REG3, inst.size());
+	const a64::Gp result = select_register(TEMP_REG4, inst.size());
+	const a64::Gp remain = select_register(TEMP_REG5, inst.size());
+	const a64::Gp temp = select_register(TEMP_REG6, inst.size());
+	const a64::Gp carry = select_register(SCRATCH_REG1, inst.size());
+	mov_reg_param(a, inst.size(), srcreg, srcp);                                        // mov   srcreg,srcp
+
+	// a zero rotate count just sets sign and zero, with carry clear
+	Label zero = a.newLabel();
+	Label done = a.newLabel();
+	if (shiftp.is_immediate())
+	{
+		if (!(shiftp.immediate() & (bits - 1)))
+		{
+			if (dstreg.id() != srcreg.id())
+				a.mov(dstreg, srcreg);                                                  // mov   dstreg,srcreg
+			if (inst.flags())
+				set_flags_nzc(a, dstreg, a64::wzr);
+			mov_param_reg(a, inst.size(), dstp, dstreg);                                // mov   dstp,dstreg
+			return;
+		}
+		a.mov(shift, shiftp.immediate() & (bits - 1));                                  // mov   shift,#shiftp
+	}
+	else
+	{
+		mov_reg_param(a, inst.size(), shift, shiftp);                                   // mov   shift,shiftp
+		a.and_(shift, shift, bits - 1);                                                 // and   shift,shift,#bits-1
+		a.cbz(shift, zero);                                                             // cbz   shift,zero
+	}
+
+	// rotate through the carry using three shifted pieces
+	get_carry(a, carry);                                                                // cset  carry,lo
+	a.mov(remain, bits);                                                                // mov   remain,#bits
+	a.sub(remain, remain, shift);                                                       // sub   remain,remain,shift
+	if (Left)
+	{
+		a.lsl(result, srcreg, shift);                                                   // lsl   result,srcreg,shift
+		a.sub(temp, shift, 1);                                                          // sub   temp,shift,#1
+		a.lsl(carry, carry, temp);                                                      // lsl   carry,carry,temp
+		a.orr(result, result, carry);                                                   // orr   result,result,carry
+		a.lsr(temp, srcreg, 1);                                                         // lsr   temp,srcreg,#1
+		a.lsr(temp, temp, remain);                                                      // lsr   temp,temp,remain
+		a.orr(result, result, temp);                                                    // orr   result,result,temp
+
+		// the carry is the last bit rotated out
+		a.lsr(carry, srcreg, remain);                                                   // lsr   carry,srcreg,remain
+	}
+	else
+	{
+		a.lsr(result, srcreg, shift);                                                   // lsr   result,srcreg,shift
+		a.lsl(carry, carry, remain);                                                    // lsl   carry,carry,remain
+		a.orr(result, result, carry);                                                   // orr   result,result,carry
+		a.lsl(temp, srcreg, 1);                                                         // lsl   temp,srcreg,#1
+		a.lsl(temp, temp, remain);                                                      // lsl   temp,temp,remain
+		a.orr(result, result, temp);                                                    // orr   result,result,temp
+	}
+	a.mov(dstreg, result);                                                              // mov   dstreg,result
+	if (inst.flags())
+		set_flags_nzc(a, dstreg, Left ? carry : select_register(a64::xzr, inst.size()));
+	a.b(done);                                                                          // b     done
+
+	a.bind(zero);                                                                   // zero:
+	if (dstreg.id() != srcreg.id())
+		a.mov(dstreg, srcreg);                                                          // mov   dstreg,srcreg
+	if (inst.flags())
+		set_flags_nzc(a, dstreg, a64::wzr);
+
+	a.bind(done);                                                                   // done:
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+
+
+
+/***************************************************************************
+    FLOATING POINT OPERATIONS
+***************************************************************************/
+
+//-------------------------------------------------
+//  op_fload - process a FLOAD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fload(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter basep(*this, inst.param(1), PTYPE_M);
+	be_parameter indp(*this, inst.param(2), PTYPE_MRI);
+
+	// pick a target register for the general case
+	const a64::Vec dstreg = select_register(dstp.select_register(TEMPF_REG1), inst.size());
+
+	a.ldr(dstreg, get_mem_indexed(a, basep.memory(), indp, (inst.size() == 4) ? 2 : 3, inst.size()));
+																						// ldr   dstreg,[basep + size*indp]
+
+	// store result
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_fstore - process a FSTORE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fstore(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter basep(*this, inst.param(0), PTYPE_M);
+	be_parameter indp(*this, inst.param(1), PTYPE_MRI);
+	be_parameter srcp(*this, inst.param(2), PTYPE_MF);
+
+	// get the source value into a register
+	const a64::Vec srcreg = select_register(srcp.select_register(TEMPF_REG1), inst.size());
+	mov_float_reg_param(a, inst.size(), srcreg, srcp);                                  // fmov  srcreg,srcp
+
+	a.str(srcreg, get_mem_indexed(a, basep.memory(), indp, (inst.size() == 4) ? 2 : 3, inst.size()));
+																						// str   srcreg,[basep + size*indp]
+}
+
+
+//-------------------------------------------------
+//  op_fread - process a FREAD opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fread(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter addrp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &spacep = inst.param(2);
+	assert(spacep.is_size_space());
+	assert((1 << spacep.size()) == inst.size());
+
+	// pick a target register for the general case
+	const a64::Vec dstreg = select_register(dstp.select_register(TEMPF_REG1), inst.size());
+
+	// set up a call to the read handler
+	auto &trampolines = m_accessors[spacep.space()];
+	mov_reg_param(a, 4, REG_PARAM2, addrp);                                             // mov   param2,addrp
+	mov_r64_imm(a, REG_PARAM1, (uintptr_t)m_space[spacep.space()]);                     // mov   param1,space
+	if (inst.size() == 4)
+	{
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.read_dword);                      // ldr   scratch,[read_dword]
+		a.blr(MEM_SCRATCH_REG);                                                         // blr   scratch
+		a.fmov(dstreg, REG_PARAM1.w());                                                 // fmov  dstreg,w0
+	}
+	else
+	{
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.read_qword);                      // ldr   scratch,[read_qword]
+		a.blr(MEM_SCRATCH_REG);                                                         // blr   scratch
+		a.fmov(dstreg, REG_PARAM1);                                                     // fmov  dstreg,x0
+	}
+
+	// store result
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_fwrite - process a FWRITE opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fwrite(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter addrp(*this, inst.param(0), PTYPE_MRI);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+	const parameter &spacep = inst.param(2);
+	assert(spacep.is_size_space());
+	assert((1 << spacep.size()) == inst.size());
+
+	// set up a call to the write handler
+	auto &trampolines = m_accessors[spacep.space()];
+	const a64::Vec srcreg = select_register(srcp.select_register(TEMPF_REG1), inst.size());
+	mov_reg_param(a, 4, REG_PARAM2, addrp);                                             // mov   param2,addrp
+	mov_float_reg_param(a, inst.size(), srcreg, srcp);                                  // fmov  srcreg,srcp
+	mov_r64_imm(a, REG_PARAM1, (uintptr_t)m_space[spacep.space()]);                     // mov   param1,space
+	if (inst.size() == 4)
+	{
+		a.fmov(REG_PARAM3.w(), srcreg);                                                 // fmov  w2,srcreg
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.write_dword);                     // ldr   scratch,[write_dword]
+	}
+	else
+	{
+		a.fmov(REG_PARAM3, srcreg);                                                     // fmov  x2,srcreg
+		emit_ldr_mem(a, MEM_SCRATCH_REG, &trampolines.write_qword);                     // ldr   scratch,[write_qword]
+	}
+	a.blr(MEM_SCRATCH_REG);                                                             // blr   scratch
+}
+
+
+//-------------------------------------------------
+//  op_fmov - process a FMOV opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fmov(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_any_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+
+	// conditional moves into registers can use a conditional select
+	if (inst.condition() != uml::COND_ALWAYS && dstp.is_float_register())
+	{
+		const a64::Vec dstreg = select_register(dstp.select_register(TEMPF_REG1), inst.size());
+		const a64::Vec srcreg = select_register(srcp.select_register(TEMPF_REG2), inst.size());
+		mov_float_reg_param(a, inst.size(), srcreg, srcp);                              // fmov  srcreg,srcp
+		a.fcsel(dstreg, srcreg, dstreg, Imm(ARM_CONDITION(inst.condition())));          // fcsel dstreg,srcreg,dstreg,cc
+		return;
+	}
+
+	// add a conditional branch otherwise
+	Label skip;
+	emit_skip(a, inst.condition(), skip);
+
+	mov_float_param_param(a, inst.size(), dstp, srcp);                                  // fmov  dstp,srcp
+
+	// resolve the jump
+	if (inst.condition() != uml::COND_ALWAYS)
+		a.bind(skip);
+}
+
+
+//-------------------------------------------------
+//  op_ftoint - process a FTOINT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_ftoint(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+	const parameter &sizep = inst.param(2);
+	assert(sizep.is_size());
+	const parameter &roundp = inst.param(3);
+	assert(roundp.is_rounding());
+
+	const uint32_t dstsize = 1 << sizep.size();
+
+	// pick registers for the general case
+	const a64::Vec srcreg = select_register(srcp.select_register(TEMPF_REG1), inst.size());
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), dstsize);
+	mov_float_reg_param(a, inst.size(), srcreg, srcp);                                  // fmov  srcreg,srcp
+
+	switch (roundp.rounding())
+	{
+		case ROUND_ROUND:
+			a.fcvtns(dstreg, srcreg);                                                   // fcvtns dstreg,srcreg
+			break;
+
+		case ROUND_CEIL:
+			a.fcvtps(dstreg, srcreg);                                                   // fcvtps dstreg,srcreg
+			break;
+
+		case ROUND_FLOOR:
+			a.fcvtms(dstreg, srcreg);                                                   // fcvtms dstreg,srcreg
+			break;
+
+		case ROUND_TRUNC:
+			a.fcvtzs(dstreg, srcreg);                                                   // fcvtzs dstreg,srcreg
+			break;
+
+		case ROUND_DEFAULT:
+		default:
+		{
+			// round with the current FPCR mode first, then convert exactly
+			const a64::Vec tempreg = select_register(TEMPF_REG2, inst.size());
+			a.frinti(tempreg, srcreg);                                                  // frinti temp,srcreg
+			a.fcvtzs(dstreg, tempreg);                                                  // fcvtzs dstreg,temp
+			break;
+		}
+	}
+
+	// store result
+	mov_param_reg(a, dstsize, dstp, dstreg);                                            // mov   dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_ffrint - process a FFRINT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_ffrint(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MRI);
+	const parameter &sizep = inst.param(2);
+	assert(sizep.is_size());
+
+	const uint32_t srcsize = 1 << sizep.size();
+
+	// pick registers for the general case
+	const a64::Vec dstreg = select_register(dstp.select_register(TEMPF_REG1), inst.size());
+	const a64::Gp srcreg = select_register(srcp.select_register(TEMP_REG1), srcsize);
+	mov_reg_param(a, srcsize, srcreg, srcp);                                            // mov   srcreg,srcp
+
+	a.scvtf(dstreg, srcreg);                                                            // scvtf dstreg,srcreg
+
+	// store result
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_ffrflt - process a FFRFLT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_ffrflt(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+	const parameter &sizep = inst.param(2);
+	assert(sizep.is_size());
+
+	const uint32_t srcsize = 1 << sizep.size();
+
+	// same size is just a move
+	if (srcsize == inst.size())
+	{
+		mov_float_param_param(a, inst.size(), dstp, srcp);                              // fmov  dstp,srcp
+		return;
+	}
+
+	// pick registers for the general case
+	const a64::Vec dstreg = select_register(dstp.select_register(TEMPF_REG1), inst.size());
+	const a64::Vec srcreg = select_register(srcp.select_register(TEMPF_REG2), srcsize);
+	mov_float_reg_param(a, srcsize, srcreg, srcp);                                      // fmov  srcreg,srcp
+
+	a.fcvt(dstreg, srcreg);                                                             // fcvt  dstreg,srcreg
+
+	// store result
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_frnds - process a FRNDS opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_frnds(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+
+	// pick registers for the general case
+	const a64::Vec dstreg = dstp.select_register(TEMPF_REG1).d();
+	const a64::Vec srcreg = srcp.select_register(TEMPF_REG2).d();
+	mov_float_reg_param(a, 8, srcreg, srcp);                                            // fmov  srcreg,srcp
+
+	// round to single precision and widen again
+	a.fcvt(TEMPF_REG3.s(), srcreg);                                                     // fcvt  temp,srcreg
+	a.fcvt(dstreg, TEMPF_REG3.s());                                                     // fcvt  dstreg,temp
+
+	// store result
+	mov_float_param_reg(a, 8, dstp, dstreg);                                            // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_float_alu - process a FADD/FSUB/FMUL/FDIV
+//  opcode
+//-------------------------------------------------
+
+template <a64::Inst::Id Opcode> void drcbe_arm64::op_float_alu(a64::Assembler &a, const uml::instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter src1p(*this, inst.param(1), PTYPE_MF);
+	be_parameter src2p(*this, inst.param(2), PTYPE_MF);
+
+	// pick registers for the general case
+	const a64::Vec dstreg = select_register(dstp.select_register(TEMPF_REG3), inst.size());
+	const a64::Vec src1reg = select_register(src1p.select_register(TEMPF_REG1), inst.size());
+	const a64::Vec src2reg = select_register(src2p.select_register(TEMPF_REG2), inst.size());
+	mov_float_reg_param(a, inst.size(), src1reg, src1p);                                // fmov  src1reg,src1p
+	mov_float_reg_param(a, inst.size(), src2reg, src2p);                                // fmov  src2reg,src2p
+
+	a.emit(Opcode, dstreg, src1reg, src2reg);                                           // op    dstreg,src1reg,src2reg
+
+	// store result
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_float_alu2 - process a FNEG/FABS/FSQRT
+//  opcode
+//-------------------------------------------------
+
+template <a64::Inst::Id Opcode> void drcbe_arm64::op_float_alu2(a64::Assembler &a, const uml::instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+
+	// pick registers for the general case
+	const a64::Vec dstreg = select_register(dstp.select_register(TEMPF_REG2), inst.size());
+	const a64::Vec srcreg = select_register(srcp.select_register(TEMPF_REG1), inst.size());
+	mov_float_reg_param(a, inst.size(), srcreg, srcp);                                  // fmov  srcreg,srcp
+
+	a.emit(Opcode, dstreg, srcreg);                                                     // op    dstreg,srcreg
+
+	// store result
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_fcmp - process a FCMP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fcmp(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_flags(inst, FLAG_C | FLAG_Z | FLAG_U);
+
+	// normalize parameters
+	be_parameter src1p(*this, inst.param(0), PTYPE_MF);
+	be_parameter src2p(*this, inst.param(1), PTYPE_MF);
+
+	const a64::Vec src1reg = select_register(src1p.select_register(TEMPF_REG1), inst.size());
+	const a64::Vec src2reg = select_register(src2p.select_register(TEMPF_REG2), inst.size());
+	mov_float_reg_param(a, inst.size(), src1reg, src1p);                                // fmov  src1reg,src1p
+	mov_float_reg_param(a, inst.size(), src2reg, src2p);                                // fmov  src2reg,src2p
+
+	// less than clears the host carry, unordered sets V
+	a.fcmp(src1reg, src2reg);                                                           // fcmp  src1reg,src2reg
+}
+
+
+//-------------------------------------------------
+//  op_frecip - process a FRECIP opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_frecip(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+
+	// pick registers for the general case
+	const a64::Vec dstreg = select_register(dstp.select_register(TEMPF_REG2), inst.size());
+	const a64::Vec srcreg = select_register(srcp.select_register(TEMPF_REG1), inst.size());
+	const a64::Vec onereg = select_register(TEMPF_REG3, inst.size());
+	mov_float_reg_param(a, inst.size(), srcreg, srcp);                                  // fmov  srcreg,srcp
+
+	if (inst.size() == 4)
+		emit_float_ldr_mem(a, onereg, &m_near.single1);                                 // ldr   one,[single1]
+	else
+		emit_float_ldr_mem(a, onereg, &m_near.double1);                                 // ldr   one,[double1]
+	a.fdiv(dstreg, onereg, srcreg);                                                     // fdiv  dstreg,one,srcreg
+
+	// store result
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_frsqrt - process a FRSQRT opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_frsqrt(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+
+	// pick registers for the general case
+	const a64::Vec dstreg = select_register(dstp.select_register(TEMPF_REG2), inst.size());
+	const a64::Vec srcreg = select_register(srcp.select_register(TEMPF_REG1), inst.size());
+	const a64::Vec onereg = select_register(TEMPF_REG3, inst.size());
+	mov_float_reg_param(a, inst.size(), srcreg, srcp);                                  // fmov  srcreg,srcp
+
+	if (inst.size() == 4)
+		emit_float_ldr_mem(a, onereg, &m_near.single1);                                 // ldr   one,[single1]
+	else
+		emit_float_ldr_mem(a, onereg, &m_near.double1);                                 // ldr   one,[double1]
+	a.fsqrt(dstreg, srcreg);                                                            // fsqrt dstreg,srcreg
+	a.fdiv(dstreg, onereg, dstreg);                                                     // fdiv  dstreg,one,dstreg
+
+	// store result
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_fcopyi - process a FCOPYI opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_fcopyi(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MF);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MR);
+
+	const a64::Vec dstreg = select_register(dstp.select_register(TEMPF_REG1), inst.size());
+	const a64::Gp srcreg = select_register(srcp.select_register(TEMP_REG1), inst.size());
+
+	if (srcp.is_memory())
+	{
+		// load the bits straight into the vector register
+		emit_float_ldr_mem(a, dstreg, srcp.memory());                                   // ldr   dstreg,[srcp]
+	}
+	else
+	{
+		a.fmov(dstreg, srcreg);                                                         // fmov  dstreg,srcreg
+	}
+
+	// store result
+	mov_float_param_reg(a, inst.size(), dstp, dstreg);                                  // fmov  dstp,dstreg
+}
+
+
+//-------------------------------------------------
+//  op_icopyf - process a ICOPYF opcode
+//-------------------------------------------------
+
+void drcbe_arm64::op_icopyf(a64::Assembler &a, const instruction &inst)
+{
+	// validate instruction
+	assert(inst.size() == 4 || inst.size() == 8);
+	assert_no_condition(inst);
+	assert_no_flags(inst);
+
+	// normalize parameters
+	be_parameter dstp(*this, inst.param(0), PTYPE_MR);
+	be_parameter srcp(*this, inst.param(1), PTYPE_MF);
+
+	const a64::Gp dstreg = select_register(dstp.select_register(TEMP_REG1), inst.size());
+	const a64::Vec srcreg = select_register(srcp.select_register(TEMPF_REG1), inst.size());
+
+	if (srcp.is_memory())
+	{
+		// the bits can be loaded straight into the integer register
+		emit_ldr_mem(a, dstreg, srcp.memory());                                         // ldr   dstreg,[srcp]
+	}
+	else
+	{
+		a.fmov(dstreg, srcreg);                                                         // fmov  dstreg,srcreg
+	}
+
+	// store result
+	mov_param_reg(a, inst.size(), dstp, dstreg);                                        // mov   dstp,dstreg
+}
+
+} // namespace drc
@@ -38,6 +38,11 @@ typedef delegate<void (drccodeptr *, void *, void *)> drc_oob_delegate;
 
 
 // drc_cache
+//
+// A cache is owned by a single CPU and is not thread-safe.  Code generation
+// may change the protection of the whole cache on hosts that don't allow
+// pages to be writable and executable at once, so nothing may execute from
+// the cache while a block is being generated.
 class drc_cache
 {
 public:
@@ -27,6 +27,16 @@ namespace {
 
 constexpr u32 MAX_STACK_DEPTH = 100;
 
+// instructions after which register liveness can't be carried into the next sequence
+constexpr u32 OPFLAG_SEQUENCE_BARRIER = OPFLAG_IS_BRANCH | OPFLAG_WILL_CAUSE_EXCEPTION | OPFLAG_REDISPATCH | OPFLAG_RETURN_TO_START | OPFLAG_CAN_CHANGE_MODES | OPFLAG_MODIFIES_TRANSLATION;
+
+// instructions with side effects that rule out a loop being an idle loop
+constexpr u32 OPFLAG_IDLE_LOOP_BARRIER = OPFLAG_WRITES_MEMORY | OPFLAG_CAN_TRIGGER_SW_INT | OPFLAG_CAN_EXPOSE_EXTERNAL_INT | OPFLAG_WILL_CAUSE_EXCEPTION | OPFLAG_PRIVILEGED | OPFLAG_MODIFIES_TRANSLATION | OPFLAG_COMPILER_PAGE_FAULT | OPFLAG_COMPILER_UNMAPPED | OPFLAG_INVALID_OPCODE | OPFLAG_CAN_CHANGE_MODES;
+
+// idle loop body length limits
+constexpr u32 DEFAULT_IDLE_LOOP_LIMIT = 8;
+constexpr u32 MAX_IDLE_LOOP_LIMIT = 32;
+
 
 
 //**************************************************************************
@@ -56,6 +66,7 @@ drc_frontend::drc_frontend(device_t &cpu, u32 window_start, u32 window_end, u32
 	: m_window_start(window_start)
 	, m_window_end(window_end)
 	, m_max_sequence(max_sequence)
+	, m_idle_loop_limit(DEFAULT_IDLE_LOOP_LIMIT)
 	, m_cpudevice(downcast<cpu_device &>(cpu))
 	, m_program(m_cpudevice.space(AS_PROGRAM))
 	, m_pageshift(m_cpudevice.space_config(AS_PROGRAM)->page_shift())
@@ -146,6 +157,10 @@ const opcode_desc *drc_frontend::describe_code(offs_t startpc)
 		}
 	}
 
+	// tag backward branches that close idle polling loops while all descriptions are still indexed by PC
+	if (m_idle_loop_limit != 0)
+		detect_idle_loops(minpc, maxpc);
+
 	// now build the list of descriptions in order
 	// first from startpc -> maxpc, then from minpc -> startpc
 	build_sequence(startpc - minpc, maxpc - minpc, OPFLAG_REDISPATCH);
@@ -154,6 +169,105 @@ const opcode_desc *drc_frontend::describe_code(offs_t startpc)
 }
 
 
+//-------------------------------------------------
+//  code_hash - compute a hash of the opcode
+//  bytes making up a described block, including
+//  any delay slots
+//-------------------------------------------------
+
+u32 drc_frontend::code_hash(opcode_desc const *desclist)
+{
+	util::crc32_creator crc;
+	for (opcode_desc const *desc = desclist; desc != nullptr; desc = desc->next())
+	{
+		crc.append(&desc->pc, sizeof(desc->pc));
+		crc.append(&desc->opptr, std::min<u32>(desc->length, sizeof(desc->opptr)));
+		for (opcode_desc const *delay = desc->delay.first(); delay != nullptr; delay = delay->next())
+			crc.append(&delay->opptr, std::min<u32>(delay->length, sizeof(delay->opptr)));
+	}
+	return crc.finish();
+}
+
+
+//-------------------------------------------------
+//  detect_idle_loops - flag backward branches
+//  that close loops which only poll state
+//-------------------------------------------------
+
+void drc_frontend::detect_idle_loops(offs_t minpc, offs_t maxpc)
+{
+	for (offs_t curpc = minpc; curpc < maxpc; curpc++)
+	{
+		opcode_desc *const desc = m_desc_array[curpc - minpc];
+		if (desc != nullptr && (desc->flags & OPFLAG_IS_BRANCH) && desc->targetpc != BRANCH_TARGET_DYNAMIC && desc->targetpc >= minpc && desc->targetpc <= desc->pc)
+		{
+			if (is_idle_loop(*desc, minpc))
+				desc->flags |= OPFLAG_IDLE_LOOP;
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  is_idle_loop - determine whether the loop
+//  closed by a backward branch can only spin
+//  until something outside the CPU changes:
+//  it must be short, free of side effects, and
+//  compute nothing that carries over from one
+//  iteration to the next
+//-------------------------------------------------
+
+bool drc_frontend::is_idle_loop(opcode_desc const &branch, offs_t minpc) const
+{
+	// gather the loop body in execution order, ending with the branch's delay slots
+	opcode_desc const *body[MAX_IDLE_LOOP_LIMIT];
+	u32 const limit = (std::min)(m_idle_loop_limit, MAX_IDLE_LOOP_LIMIT);
+	u32 count = 0;
+	for (offs_t curpc = branch.targetpc; curpc <= branch.pc; )
+	{
+		opcode_desc const *const desc = m_desc_array[curpc - minpc];
+		if (desc == nullptr || desc->length == 0 || count >= limit)
+			return false;
+
+		// the only branch allowed is the one closing the loop
+		if (desc != &branch && (desc->flags & OPFLAG_IS_BRANCH))
+			return false;
+		body[count++] = desc;
+		curpc += desc->length;
+	}
+	for (opcode_desc const *desc = branch.delay.first(); desc != nullptr; desc = desc->next())
+	{
+		if (count >= limit)
+			return false;
+		body[count++] = desc;
+	}
+
+	// reject anything with side effects, and note every register the loop writes
+	u32 loopout[4] = { 0, 0, 0, 0 };
+	for (u32 index = 0; index < count; index++)
+	{
+		if (body[index]->flags & OPFLAG_IDLE_LOOP_BARRIER)
+			return false;
+		for (int regset = 0; regset < 4; regset++)
+			loopout[regset] |= body[index]->regout[regset];
+	}
+
+	// a register read before the loop writes it in the same iteration carries
+	// state between iterations (a counter, for example), so the loop makes progress
+	u32 written[4] = { 0, 0, 0, 0 };
+	for (u32 index = 0; index < count; index++)
+	{
+		for (int regset = 0; regset < 4; regset++)
+		{
+			if (body[index]->regin[regset] & loopout[regset] & ~written[regset])
+				return false;
+			written[regset] |= body[index]->regout[regset];
+		}
+	}
+	return true;
+}
+
+
 //-------------------------------------------------
 //  describe_one - describe a single instruction,
 //  recursively describing opcodes in delay
@@ -302,15 +416,15 @@ void drc_frontend::build_sequence(int start, int end, u32 endflag)
 			if (curdesc->flags & OPFLAG_END_SEQUENCE)
 				consecutive = 0;
 
-			// if this is the end of a sequence, work backwards
+			// if this is the end of a sequence, remember it so we can work backwards later
 			if (curdesc->flags & OPFLAG_END_SEQUENCE)
 			{
-				// figure out which registers we *must* generate, assuming at the end all must be
-				u32 reqmask[4] = { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff };
 				if (seqstart != -1)
-					for (int backdesc = descnum; backdesc != seqstart - 1; backdesc--)
-						if (m_desc_array[backdesc] != nullptr)
-							accumulate_required_backwards(*m_desc_array[backdesc], reqmask);
+				{
+					// note whether execution simply falls into the following sequence
+					bool const fallthrough = (nextdesc != nullptr) && (skipsleft == 0) && (curdesc->skipslots == 0) && !(curdesc->flags & OPFLAG_SEQUENCE_BARRIER);
+					m_sequences.push_back(sequence{ seqstart, descnum, fallthrough ? nextdescnum : -1 });
+				}
 
 				// reset the register states
 				seqstart = -1;
@@ -335,6 +449,22 @@ void drc_frontend::build_sequence(int start, int end, u32 endflag)
 				skipsleft--;
 		}
 
+	// figure out which registers we *must* generate, working backwards through the
+	// sequences; at the end of a sequence all registers are assumed to be required,
+	// unless it falls straight into the next one, where that sequence's inputs are
+	u32 reqmask[4] = { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff };
+	int nextstart = -1;
+	for (auto seq = m_sequences.rbegin(); seq != m_sequences.rend(); ++seq)
+	{
+		if (seq->fallthrough == -1 || seq->fallthrough != nextstart)
+			reqmask[0] = reqmask[1] = reqmask[2] = reqmask[3] = 0xffffffff;
+		for (int backdesc = seq->end; backdesc != seq->start - 1; backdesc--)
+			if (m_desc_array[backdesc] != nullptr)
+				accumulate_required_backwards(*m_desc_array[backdesc], reqmask);
+		nextstart = seq->start;
+	}
+	m_sequences.clear();
+
 	// zap the array
 	memset(&m_desc_array[start], 0, (end - start) * sizeof(m_desc_array[0]));
 }
@@ -77,6 +77,9 @@ constexpr u32 OPFLAG_CAN_CHANGE_MODES        = 0x00080000;       // instruction
 constexpr u32 OPFLAG_READS_MEMORY            = 0x00100000;       // instruction reads memory
 constexpr u32 OPFLAG_WRITES_MEMORY           = 0x00200000;       // instruction writes memory
 
+// loop analysis flags
+constexpr u32 OPFLAG_IDLE_LOOP               = 0x00400000;       // instruction branches back to the start of a side-effect free polling loop
+
 
 
 //**************************************************************************
@@ -136,6 +139,12 @@ public:
 	// get last opcode of block
 	opcode_desc const *get_last() { return m_desc_live_list.last(); }
 
+	// compute a hash of the opcode bytes in a described block
+	static u32 code_hash(opcode_desc const *desclist);
+
+	// set the longest loop body (in instructions) considered for idle loop detection, or 0 to disable
+	void set_idle_loop_limit(u32 max_instructions) { m_idle_loop_limit = max_instructions; }
+
 protected:
 	// required overrides
 	virtual bool describe(opcode_desc &desc, opcode_desc const *prev) = 0;
@@ -144,6 +153,8 @@ private:
 	// internal helpers
 	opcode_desc *describe_one(offs_t curpc, opcode_desc const *prevdesc, bool in_delay_slot = false);
 	void build_sequence(int start, int end, u32 endflag);
+	void detect_idle_loops(offs_t minpc, offs_t maxpc);
+	bool is_idle_loop(opcode_desc const &branch, offs_t minpc) const;
 	void accumulate_required_backwards(opcode_desc &desc, u32 *reqmask);
 	void release_descriptions();
 
@@ -151,6 +162,7 @@ private:
 	u32                 m_window_start;             // code window start offset = startpc - window_start
 	u32                 m_window_end;               // code window end offset = startpc + window_end
 	u32                 m_max_sequence;             // maximum instructions to include in a sequence
+	u32                 m_idle_loop_limit;          // maximum instructions in a detected idle loop
 
 	// CPU parameters
 	cpu_device &        m_cpudevice;                // CPU device object
@@ -161,6 +173,15 @@ private:
 	simple_list<opcode_desc> m_desc_live_list;      // list of live descriptions
 	fixed_allocator<opcode_desc> m_desc_allocator;  // fixed allocator for descriptions
 	std::vector<opcode_desc *> m_desc_array;        // array of descriptions in PC order
+
+	// sequences found while building, for liveness analysis
+	struct sequence
+	{
+		int             start;                      // index of the first description
+		int             end;                        // index of the last description
+		int             fallthrough;                // index of the sequence we fall into, or -1
+	};
+	std::vector<sequence> m_sequences;              // sequences in the range being built
 };
 
 #endif // MAME_CPU_DRCFE_H
@@ -35,12 +35,17 @@
 #include "drcuml.h"
 
 #include "emuopts.h"
+#include "fileio.h"
 #include "drcbec.h"
 #ifdef NATIVE_DRC
 #include "drcbex86.h"
 #include "drcbex64.h"
+#include "drcbearm64.h"
 #endif
 
+#include "corestr.h"
+#include "multibyte.h"
+
 #include <fstream>
 
 
@@ -54,6 +59,20 @@
 
 
 
+//**************************************************************************
+//  CONSTANTS
+//**************************************************************************
+
+namespace {
+
+// block journal file signature and limits
+constexpr u8 JOURNAL_MAGIC[8] = { 'M', 'A', 'M', 'E', 'D', 'R', 'C', '1' };
+constexpr size_t JOURNAL_MAX_ENTRIES = 65536;
+
+} // anonymous namespace
+
+
+
 //**************************************************************************
 //  TYPE DEFINITIONS
 //**************************************************************************
@@ -148,7 +167,17 @@ drcuml_state::drcuml_state(device_t &device, drc_cache &cache, u32 flags, int mo
 	, m_blocklist()
 	, m_handlelist()
 	, m_symlist()
+	, m_journaling(device.machine().options().drc_journal())
+	, m_journal()
 {
+	if (m_journaling)
+	{
+		journal_load();
+
+		// exit notifiers run before devices are stopped, so this state is
+		// still alive; the destructor may run after the machine is gone
+		device.machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&drcuml_state::journal_save, this));
+	}
 }
 
 
@@ -236,6 +265,103 @@ uml::code_handle *drcuml_state::handle_alloc(char const *name)
 }
 
 
+//-------------------------------------------------
+//  journal_block - record that a block was
+//  compiled so it can be precompiled next run
+//-------------------------------------------------
+
+void drcuml_state::journal_block(u32 mode, u32 pc, u32 hash)
+{
+	if (m_journaling && (m_journal.size() < JOURNAL_MAX_ENTRIES))
+		m_journal[(u64(mode) << 32) | pc] = hash;
+}
+
+
+//-------------------------------------------------
+//  journal - return a snapshot of the journaled
+//  blocks
+//-------------------------------------------------
+
+std::vector<drcuml_state::journal_entry> drcuml_state::journal() const
+{
+	std::vector<journal_entry> result;
+	result.reserve(m_journal.size());
+	for (auto const &entry : m_journal)
+		result.push_back(journal_entry{ u32(entry.first >> 32), u32(entry.first), entry.second });
+	return result;
+}
+
+
+//-------------------------------------------------
+//  journal_filename - return the name of the
+//  block journal file for this CPU
+//-------------------------------------------------
+
+std::string drcuml_state::journal_filename() const
+{
+	std::string tag(m_device.tag() + 1);
+	strreplacechr(tag, ':', '_');
+	return util::string_format("%s" PATH_SEPARATOR "%s.drc", m_device.machine().basename(), tag);
+}
+
+
+//-------------------------------------------------
+//  journal_load - read the block journal left
+//  by a previous run
+//-------------------------------------------------
+
+void drcuml_state::journal_load()
+{
+	emu_file file(m_device.machine().options().nvram_directory(), OPEN_FLAG_READ);
+	if (file.open(journal_filename()))
+		return;
+
+	// validate the header
+	u8 header[sizeof(JOURNAL_MAGIC) + 4];
+	if ((file.read(header, sizeof(header)) != sizeof(header)) || memcmp(header, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)))
+		return;
+	u32 const count = get_u32le(&header[sizeof(JOURNAL_MAGIC)]);
+
+	// read the entries
+	for (u32 index = 0; (index < count) && (index < JOURNAL_MAX_ENTRIES); index++)
+	{
+		u8 entry[12];
+		if (file.read(entry, sizeof(entry)) != sizeof(entry))
+			break;
+		m_journal[(u64(get_u32le(&entry[0])) << 32) | get_u32le(&entry[4])] = get_u32le(&entry[8]);
+	}
+}
+
+
+//-------------------------------------------------
+//  journal_save - write the block journal for
+//  the next run
+//-------------------------------------------------
+
+void drcuml_state::journal_save()
+{
+	if (m_journal.empty())
+		return;
+
+	emu_file file(m_device.machine().options().nvram_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(journal_filename()))
+		return;
+
+	u8 header[sizeof(JOURNAL_MAGIC) + 4];
+	memcpy(header, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+	put_u32le(&header[sizeof(JOURNAL_MAGIC)], m_journal.size());
+	file.write(header, sizeof(header));
+	for (auto const &block : m_journal)
+	{
+		u8 entry[12];
+		put_u32le(&entry[0], u32(block.first >> 32));
+		put_u32le(&entry[4], u32(block.first));
+		put_u32le(&entry[8], block.second);
+		file.write(entry, sizeof(entry));
+	}
+}
+
+
 //-------------------------------------------------
 //  symbol_add - add a symbol to the internal
 //  symbol table
@@ -396,27 +522,24 @@ void drcuml_block::optimize()
 {
 	u32 mapvar[uml::MAPVAR_COUNT] = { 0 };
 
-	// iterate over instructions
-	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	// first compute what flags we need with a single backwards pass; flags read
+	// after an instruction stay live until an unconditional instruction
+	// modifies them
+	u8 liveflags(0);
+	for (int instnum = m_nextinst - 1; instnum >= 0; instnum--)
 	{
 		uml::instruction &inst(m_inst[instnum]);
+		inst.set_flags(inst.output_flags() & liveflags);
 
-		// first compute what flags we need
-		u8 accumflags(0);
-		u8 remainingflags(inst.output_flags());
-
-		// scan ahead until we run out of possible remaining flags
-		for (int scannum = instnum + 1; remainingflags != 0 && scannum < m_nextinst; scannum++)
-		{
-			// any input flags are required
-			uml::instruction const &scan(m_inst[scannum]);
-			accumflags |= scan.input_flags();
+		if (inst.condition() == uml::COND_ALWAYS)
+			liveflags &= ~inst.modified_flags();
+		liveflags |= inst.input_flags();
+	}
 
-			// if the scanahead instruction is unconditional, assume his flags are modified
-			if (scan.condition() == uml::COND_ALWAYS)
-				remainingflags &= ~scan.modified_flags();
-		}
-		inst.set_flags(accumflags);
+	// iterate over instructions
+	for (int instnum = 0; instnum < m_nextinst; instnum++)
+	{
+		uml::instruction &inst(m_inst[instnum]);
 
 		// track mapvars
 		if (inst.opcode() == uml::OP_MAPVAR)
@@ -17,6 +17,7 @@
 
 #include <iostream>
 #include <list>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -181,6 +182,17 @@ public:
 	// handle management
 	uml::code_handle *handle_alloc(char const *name);
 
+	// block journal for warm starts
+	struct journal_entry
+	{
+		u32     mode;       // CPU mode the block was compiled for
+		u32     pc;         // starting PC of the block
+		u32     hash;       // hash of the opcode bytes that were compiled
+	};
+	bool journaling() const { return m_journaling; }
+	void journal_block(u32 mode, u32 pc, u32 hash);
+	std::vector<journal_entry> journal() const;
+
 	// symbol management
 	void symbol_add(void *base, u32 length, char const *name);
 	char const *symbol_find(void *base, u32 *offset = nullptr);
@@ -220,6 +232,11 @@ private:
 		std::string m_name;     // name of the symbol
 	};
 
+	// internal helpers
+	std::string journal_filename() const;
+	void journal_load();
+	void journal_save();
+
 	// internal state
 	device_t &                              m_device;           // CPU device we are associated with
 	drc_cache &                             m_cache;            // pointer to the codegen cache
@@ -228,6 +245,8 @@ private:
 	std::list<drcuml_block>                 m_blocklist;        // list of active blocks
 	std::list<uml::code_handle>             m_handlelist;       // list of active handles
 	std::list<symbol>                       m_symlist;          // list of symbols
+	bool const                              m_journaling;       // whether compiled blocks are journaled
+	std::map<u64, u32>                      m_journal;          // mode/pc -> hash of compiled blocks
 };
 
 
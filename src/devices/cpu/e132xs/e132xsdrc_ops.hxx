@@ -922,9 +922,76 @@ void hyperstone_device::generate_sum(drcuml_block &block, compiler_state &compil
 template <hyperstone_device::reg_bank DST_GLOBAL, hyperstone_device::reg_bank SRC_GLOBAL>
 void hyperstone_device::generate_sums(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
 {
-	printf("Unimplemented: generate_sums (%08x)\n", desc->pc);
-	fflush(stdout);
-	fatalerror(" ");
+	UML_MOV(block, I7, mem(&m_core->clock_cycles_1));
+
+	uint16_t op = desc->opptr.w[0];
+	const uint32_t src_code = op & 0xf;
+	const uint32_t dst_code = (op & 0xf0) >> 4;
+
+	generate_decode_const(block, compiler, desc);
+	generate_check_delay_pc(block, compiler, desc);
+
+	if (!SRC_GLOBAL || !DST_GLOBAL)
+	{
+		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+	}
+
+	if (SRC_GLOBAL)
+	{
+		if (src_code == SR_REGISTER)
+			UML_AND(block, I2, DRC_SR, 1);
+		else
+			UML_LOAD(block, I2, (void *)m_core->global_regs, src_code, SIZE_DWORD, SCALE_x4);
+	}
+	else
+	{
+		UML_ADD(block, I2, I3, src_code);
+		UML_AND(block, I2, I2, 0x3f);
+		UML_LOAD(block, I2, (void *)m_core->local_regs, I2, SIZE_DWORD, SCALE_x4);
+	}
+
+	UML_ADD(block, I5, I1, I2);
+
+	UML_AND(block, DRC_SR, DRC_SR, ~(V_MASK | Z_MASK | N_MASK));
+
+	UML_XOR(block, I6, I5, I1);
+	UML_XOR(block, I4, I5, I2);
+	UML_AND(block, I4, I4, I6);
+	UML_ROLINS(block, DRC_SR, I4, 4, V_MASK);
+
+	UML_TEST(block, I5, ~0);
+	UML_SETc(block, uml::COND_Z, I6);
+	UML_ROLINS(block, DRC_SR, I6, Z_SHIFT, Z_MASK);
+
+	UML_ROLINS(block, DRC_SR, I5, 3, N_MASK);
+
+	if (DST_GLOBAL)
+	{
+		if (dst_code < 2)
+		{
+			UML_MOV(block, I4, dst_code);
+			generate_set_global_register(block, compiler, desc);
+			if (dst_code == PC_REGISTER)
+				generate_branch(block, desc->targetpc, desc);
+		}
+		else
+		{
+			UML_STORE(block, (void *)m_core->global_regs, dst_code, I5, SIZE_DWORD, SCALE_x4);
+		}
+	}
+	else
+	{
+		UML_ADD(block, I0, I3, dst_code);
+		UML_AND(block, I0, I0, 0x3f);
+		UML_STORE(block, (void *)m_core->local_regs, I0, I5, SIZE_DWORD, SCALE_x4);
+	}
+
+	// no range error when the source is the carry flag
+	if (!SRC_GLOBAL || (src_code != SR_REGISTER))
+	{
+		UML_TEST(block, DRC_SR, V_MASK);
+		UML_EXHc(block, uml::COND_NZ, *m_exception[EXCEPTION_RANGE_ERROR], 0);
+	}
 }
 
 
@@ -1176,9 +1243,81 @@ void hyperstone_device::generate_add(drcuml_block &block, compiler_state &compil
 template <hyperstone_device::reg_bank DST_GLOBAL, hyperstone_device::reg_bank SRC_GLOBAL>
 void hyperstone_device::generate_adds(drcuml_block &block, compiler_state &compiler, const opcode_desc *desc)
 {
-	printf("Unimplemented: generate_adds (%08x)\n", desc->pc);
-	fflush(stdout);
-	fatalerror(" ");
+	UML_MOV(block, I7, mem(&m_core->clock_cycles_1));
+
+	uint16_t op = desc->opptr.w[0];
+	const uint32_t src_code = op & 0xf;
+	const uint32_t dst_code = (op & 0xf0) >> 4;
+
+	generate_check_delay_pc(block, compiler, desc);
+
+	if (!SRC_GLOBAL || !DST_GLOBAL)
+		UML_ROLAND(block, I3, DRC_SR, 7, 0x7f);
+
+	if (SRC_GLOBAL)
+	{
+		if (src_code == SR_REGISTER)
+			UML_AND(block, I0, DRC_SR, 1);
+		else
+			UML_LOAD(block, I0, (void *)m_core->global_regs, src_code, SIZE_DWORD, SCALE_x4);
+	}
+	else
+	{
+		UML_ADD(block, I2, I3, src_code);
+		UML_AND(block, I2, I2, 0x3f);
+		UML_LOAD(block, I0, (void *)m_core->local_regs, I2, SIZE_DWORD, SCALE_x4);
+	}
+
+	if (DST_GLOBAL)
+	{
+		UML_LOAD(block, I1, (void *)m_core->global_regs, dst_code, SIZE_DWORD, SCALE_x4);
+	}
+	else
+	{
+		UML_ADD(block, I3, I3, dst_code);
+		UML_AND(block, I3, I3, 0x3f);
+		UML_LOAD(block, I1, (void *)m_core->local_regs, I3, SIZE_DWORD, SCALE_x4);
+	}
+
+	UML_ADD(block, I2, I0, I1);
+
+	UML_AND(block, DRC_SR, DRC_SR, ~(V_MASK | Z_MASK | N_MASK));
+
+	UML_XOR(block, I4, I0, I2);
+	UML_XOR(block, I5, I1, I2);
+	UML_AND(block, I4, I4, I5);
+	UML_ROLINS(block, DRC_SR, I4, 4, V_MASK);
+
+	UML_TEST(block, I2, ~0);
+	UML_SETc(block, uml::COND_Z, I4);
+	UML_ROLINS(block, DRC_SR, I4, Z_SHIFT, Z_MASK);
+	UML_ROLINS(block, DRC_SR, I2, 3, N_MASK);
+
+	if (DST_GLOBAL)
+	{
+		if (dst_code < 2)
+		{
+			UML_MOV(block, I4, dst_code);
+			UML_MOV(block, I5, I2);
+			generate_set_global_register(block, compiler, desc);
+
+			if (dst_code == PC_REGISTER)
+			{
+				generate_branch(block, desc->targetpc, desc);
+			}
+		}
+		else
+		{
+			UML_STORE(block, (void *)m_core->global_regs, dst_code, I2, SIZE_DWORD, SCALE_x4);
+		}
+	}
+	else
+	{
+		UML_STORE(block, (void *)m_core->local_regs, I3, I2, SIZE_DWORD, SCALE_x4);
+	}
+
+	UML_TEST(block, DRC_SR, V_MASK);
+	UML_EXHc(block, uml::COND_NZ, *m_exception[EXCEPTION_RANGE_ERROR], 0);
 }
 
 
@@ -109,6 +109,25 @@ public:
 		ram_cycle_t cycle; // cycle type
 	};
 
+	// an instruction word split into its fields, with the table lookups done
+	struct decoded_instr_t {
+		uint8_t aReg;
+		uint8_t bReg;
+		uint8_t cReg;
+		uint8_t dReg;
+		uint8_t alu_op;
+		int alu_operands;
+		op_src_dst_t alu_src;
+		op_src_dst_t alu_dst;
+		op_src_dst_t mac_src;
+		op_src_dst_t mac_dst;
+		bool accumulate;
+		bool skippable;
+		bool update_ccr;
+		ram_cycle_t ram_cycle;
+		ram_control_access_t ram_access;
+	};
+
 	// direct access to the 'HALT' pin - not just through the
 	void set_HALT(bool halt) { halt_asserted = halt; }
 	bool get_HALT() { return halt_asserted; }
@@ -117,7 +136,7 @@ public:
 	void list_program(void(p)(const char *, ...));
 
 	// for testing purposes
-	uint64_t &_instr(int pc) { return instr[pc % 160]; }
+	uint64_t &_instr(int pc) { program_changed = true; return instr[pc % 160]; }
 	int16_t &_dram(int addr) { return dram[addr & DRAM_MASK]; }
 
 	// publicly visible for testing purposes
@@ -128,6 +147,7 @@ public:
 protected:
 	virtual void device_start() override;
 	virtual void device_reset() override;
+	virtual void device_post_load() override;
 	virtual space_config_vector memory_space_config() const override;
 	virtual uint64_t execute_clocks_to_cycles(uint64_t clocks) const noexcept override;
 	virtual uint64_t execute_cycles_to_clocks(uint64_t cycles) const noexcept override;
@@ -140,6 +160,7 @@ protected:
 
 	int32_t alu_operation(uint8_t op, int32_t aValue, int32_t bValue, uint8_t &flags);
 	void alu_operation_end();
+	void decode_program();
 
 private:
 	int icount;
@@ -176,6 +197,11 @@ private:
 	std::unique_ptr<uint64_t[]> instr;
 	std::unique_ptr<int16_t[]> dram;
 
+	// the program only changes through host writes, so execution works from
+	// a decoded copy that is rebuilt before running after any change
+	std::unique_ptr<decoded_instr_t[]> decoded;
+	bool program_changed;
+
 	// TODO : Masked address?
 	int16_t dram_r(int addr) { return dram[addr & DRAM_MASK]; }
 	void dram_w(int addr, int16_t data) { dram[addr & DRAM_MASK] = data; }
@@ -28,6 +28,18 @@
 #include "debug/debugcpu.h"
 #include "debug/express.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define I386_VECTOR_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define I386_VECTOR_NEON
+#include <arm_neon.h>
+// 32-bit NEON flushes denormals, so only use it for packed floats on AArch64
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define I386_VECTOR_NEON_FLOAT
+#endif
+#endif
+
 #define LOG_MSR             (1U << 1)
 #define LOG_INVALID_OPCODE  (1U << 2)
 #define LOG_LIMIT_CHECK     (1U << 3)
@@ -359,14 +371,19 @@ uint16_t i386_device::FETCH16()
 	uint16_t value;
 	uint32_t address = m_pc, error;
 
-	if( !WORD_ALIGNED(address) ) {       /* Unaligned read */
+	if( (address & 0xfff) == 0xfff ) {      /* Read crossing a page boundary */
 		value = (FETCH() << 0);
 		value |= (FETCH() << 8);
 	} else {
 		if(!translate_address(m_CPL,TR_FETCH,&address,&error))
 			PF_THROW(error);
 		address &= m_a20_mask;
-		value = mem_pr16(address);
+		if( !WORD_ALIGNED(address) ) {      /* Unaligned read within a page only needs one translation */
+			value = mem_pr8(address) << 0;
+			value |= mem_pr8(address + 1) << 8;
+		} else {
+			value = mem_pr16(address);
+		}
 		m_eip += 2;
 		m_pc += 2;
 	}
@@ -377,7 +394,7 @@ uint32_t i386_device::FETCH32()
 	uint32_t value;
 	uint32_t address = m_pc, error;
 
-	if( !DWORD_ALIGNED(m_pc) ) {      /* Unaligned read */
+	if( (address & 0xfff) > 0xffc ) {       /* Read crossing a page boundary */
 		value = (FETCH() << 0);
 		value |= (FETCH() << 8);
 		value |= (FETCH() << 16);
@@ -387,7 +404,14 @@ uint32_t i386_device::FETCH32()
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value = mem_pr32(address);
+		if( !DWORD_ALIGNED(address) ) {     /* Unaligned read within a page only needs one translation */
+			value = mem_pr8(address) << 0;
+			value |= mem_pr8(address + 1) << 8;
+			value |= mem_pr8(address + 2) << 16;
+			value |= mem_pr8(address + 3) << 24;
+		} else {
+			value = mem_pr32(address);
+		}
 		m_eip += 4;
 		m_pc += 4;
 	}
@@ -402,7 +426,7 @@ uint8_t i386_device::READ8PL(uint32_t ea, uint8_t privilege)
 		PF_THROW(error);
 
 	address &= m_a20_mask;
-	return m_program->read_byte(address);
+	return m_pdata32.read_byte(address);
 }
 
 uint16_t i386_device::READ16PL(uint32_t ea, uint8_t privilege)
@@ -419,7 +443,7 @@ uint16_t i386_device::READ16PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value = m_program->read_word(address);
+		value = m_pdata32.read_word(address);
 		break;
 
 	case 1:
@@ -427,7 +451,7 @@ uint16_t i386_device::READ16PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value = m_program->read_dword(address - 1, 0x00ffff00) >> 8;
+		value = m_pdata32.read_dword(address - 1, 0x00ffff00) >> 8;
 		break;
 
 	case 3:
@@ -452,7 +476,7 @@ uint32_t i386_device::READ32PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value = m_program->read_dword(address);
+		value = m_pdata32.read_dword(address);
 		break;
 
 	case 1:
@@ -460,7 +484,7 @@ uint32_t i386_device::READ32PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value = m_program->read_dword(address - 1, 0xffffff00) >> 8;
+		value = m_pdata32.read_dword(address - 1, 0xffffff00) >> 8;
 		value |= READ8PL(ea + 3, privilege) << 24;
 		break;
 
@@ -477,7 +501,7 @@ uint32_t i386_device::READ32PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value |= m_program->read_dword(address, 0x00ffffff) << 8;
+		value |= m_pdata32.read_dword(address, 0x00ffffff) << 8;
 		break;
 	}
 
@@ -502,7 +526,7 @@ uint64_t i386_device::READ64PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value = m_program->read_dword(address - 1, 0xffffff00) >> 8;
+		value = m_pdata32.read_dword(address - 1, 0xffffff00) >> 8;
 		value |= uint64_t(READ32PL(ea + 3, privilege)) << 24;
 		value |= uint64_t(READ8PL(ea + 7, privilege)) << 56;
 		break;
@@ -522,13 +546,24 @@ uint64_t i386_device::READ64PL(uint32_t ea, uint8_t privilege)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		value |= uint64_t(m_program->read_dword(address, 0x00ffffff)) << 40;
+		value |= uint64_t(m_pdata32.read_dword(address, 0x00ffffff)) << 40;
 		break;
 	}
 
 	return value;
 }
 
+uint8_t i386sx_device::READ8PL(uint32_t ea, uint8_t privilege)
+{
+	uint32_t address = ea, error;
+
+	if(!translate_address(privilege,TR_READ,&address,&error))
+		PF_THROW(error);
+
+	address &= m_a20_mask;
+	return m_program->read_byte(address);
+}
+
 uint16_t i386sx_device::READ16PL(uint32_t ea, uint8_t privilege)
 {
 	uint16_t value;
@@ -607,7 +642,7 @@ void i386_device::WRITE8PL(uint32_t ea, uint8_t privilege, uint8_t value)
 		PF_THROW(error);
 
 	address &= m_a20_mask;
-	m_program->write_byte(address, value);
+	m_pdata32.write_byte(address, value);
 }
 
 void i386_device::WRITE16PL(uint32_t ea, uint8_t privilege, uint16_t value)
@@ -622,7 +657,7 @@ void i386_device::WRITE16PL(uint32_t ea, uint8_t privilege, uint16_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_word(address, value);
+		m_pdata32.write_word(address, value);
 		break;
 
 	case 1:
@@ -630,7 +665,7 @@ void i386_device::WRITE16PL(uint32_t ea, uint8_t privilege, uint16_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_dword(address - 1, value << 8, 0x00ffff00);
+		m_pdata32.write_dword(address - 1, value << 8, 0x00ffff00);
 		break;
 
 	case 3:
@@ -651,7 +686,7 @@ void i386_device::WRITE32PL(uint32_t ea, uint8_t privilege, uint32_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_dword(address, value);
+		m_pdata32.write_dword(address, value);
 		break;
 
 	case 1:
@@ -659,7 +694,7 @@ void i386_device::WRITE32PL(uint32_t ea, uint8_t privilege, uint32_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_dword(address - 1, (value << 8) & 0xffffff00, 0xffffff00);
+		m_pdata32.write_dword(address - 1, (value << 8) & 0xffffff00, 0xffffff00);
 		WRITE8PL(ea + 3, privilege, (value >> 24) & 0xff);
 		break;
 
@@ -676,7 +711,7 @@ void i386_device::WRITE32PL(uint32_t ea, uint8_t privilege, uint32_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_dword(address, value >> 8, 0x00ffffff);
+		m_pdata32.write_dword(address, value >> 8, 0x00ffffff);
 		break;
 	}
 }
@@ -697,7 +732,7 @@ void i386_device::WRITE64PL(uint32_t ea, uint8_t privilege, uint64_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_dword(address - 1, value << 8, 0xffffff00);
+		m_pdata32.write_dword(address - 1, value << 8, 0xffffff00);
 		WRITE32PL(ea + 3, privilege, (value >> 24) & 0xffffffff);
 		WRITE8PL(ea + 7, privilege, (value >> 56) & 0xff );
 		break;
@@ -717,11 +752,21 @@ void i386_device::WRITE64PL(uint32_t ea, uint8_t privilege, uint64_t value)
 			PF_THROW(error);
 
 		address &= m_a20_mask;
-		m_program->write_dword(address, (value >> 40) & 0x00ffffff, 0x00ffffff);
+		m_pdata32.write_dword(address, (value >> 40) & 0x00ffffff, 0x00ffffff);
 		break;
 	}
 }
 
+void i386sx_device::WRITE8PL(uint32_t ea, uint8_t privilege, uint8_t value)
+{
+	uint32_t address = ea, error;
+	if(!translate_address(privilege,TR_WRITE,&address,&error))
+		PF_THROW(error);
+
+	address &= m_a20_mask;
+	m_program->write_byte(address, value);
+}
+
 void i386sx_device::WRITE16PL(uint32_t ea, uint8_t privilege, uint16_t value)
 {
 	uint32_t address = ea, error;
@@ -1958,6 +2003,7 @@ void i386_device::i386_common_init()
 		m_program->cache(macache16);
 	} else {
 		m_program->cache(macache32);
+		m_program->specific(m_pdata32);
 	}
 
 	m_io = &space(AS_IO);
@@ -350,6 +350,7 @@ protected:
 	uint32_t m_a20_mask;
 	memory_access<32, 1, 0, ENDIANNESS_LITTLE>::cache macache16;
 	memory_access<32, 2, 0, ENDIANNESS_LITTLE>::cache macache32;
+	memory_access<32, 2, 0, ENDIANNESS_LITTLE>::specific m_pdata32;
 
 	int m_cpuid_max_input_value_eax; // Highest CPUID standard function available
 	uint32_t m_cpuid_id0, m_cpuid_id1, m_cpuid_id2;
@@ -1576,9 +1577,11 @@ protected:
 	virtual u16 mem_pr16(offs_t address) override { return macache16.read_word(address); }
 	virtual u32 mem_pr32(offs_t address) override { return macache16.read_dword(address); }
 
+	virtual uint8_t READ8PL(uint32_t ea, uint8_t privilege) override;
 	virtual uint16_t READ16PL(uint32_t ea, uint8_t privilege) override;
 	virtual uint32_t READ32PL(uint32_t ea, uint8_t privilege) override;
 	virtual uint64_t READ64PL(uint32_t ea, uint8_t privilege) override;
+	virtual void WRITE8PL(uint32_t ea, uint8_t privilege, uint8_t value) override;
 	virtual void WRITE16PL(uint32_t ea, uint8_t privilege, uint16_t value) override;
 	virtual void WRITE32PL(uint32_t ea, uint8_t privilege, uint32_t value) override;
 	virtual void WRITE64PL(uint32_t ea, uint8_t privilege, uint64_t value) override;
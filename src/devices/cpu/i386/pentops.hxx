@@ -5,6 +5,29 @@
 extern flag float32_is_nan( float32 a ); // since its not defined in softfloat.h
 extern flag float64_is_nan( float64 a ); // since its not defined in softfloat.h
 
+// packed SSE operations map lane for lane onto host SIMD where available;
+// results match the scalar fallbacks bit for bit
+#if defined(I386_VECTOR_SSE2)
+#define XMM_VI(r)               _mm_loadu_si128(reinterpret_cast<const __m128i *>((r).b))
+#define XMM_VF(r)               _mm_loadu_ps((r).f)
+#define XMM_STORE_VI(r, v)      _mm_storeu_si128(reinterpret_cast<__m128i *>((r).b), (v))
+#define XMM_STORE_VF(r, v)      _mm_storeu_ps((r).f, (v))
+#elif defined(I386_VECTOR_NEON)
+static inline int16x8_t xmm_neon_mulhi_s16(int16x8_t a, int16x8_t b)
+{
+	int32x4_t const lo = vmull_s16(vget_low_s16(a), vget_low_s16(b));
+	int32x4_t const hi = vmull_s16(vget_high_s16(a), vget_high_s16(b));
+	return vcombine_s16(vshrn_n_s32(lo, 16), vshrn_n_s32(hi, 16));
+}
+
+static inline uint16x8_t xmm_neon_mulhi_u16(uint16x8_t a, uint16x8_t b)
+{
+	uint32x4_t const lo = vmull_u16(vget_low_u16(a), vget_low_u16(b));
+	uint32x4_t const hi = vmull_u16(vget_high_u16(a), vget_high_u16(b));
+	return vcombine_u16(vshrn_n_u32(lo, 16), vshrn_n_u32(hi, 16));
+}
+#endif
+
 void i386_device::MMXPROLOG()
 {
 	if (m_cr[0] & (CR0_TS | CR0_EM))
@@ -3577,20 +3600,22 @@ void i386_device::sse_xorpd_r128_rm128() // Opcode 66 0f 57
 void i386_device::sse_addps() // Opcode 0f 58
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		XMM((modrm >> 3) & 0x7).f[0] = XMM((modrm >> 3) & 0x7).f[0] + XMM(modrm & 0x7).f[0];
-		XMM((modrm >> 3) & 0x7).f[1] = XMM((modrm >> 3) & 0x7).f[1] + XMM(modrm & 0x7).f[1];
-		XMM((modrm >> 3) & 0x7).f[2] = XMM((modrm >> 3) & 0x7).f[2] + XMM(modrm & 0x7).f[2];
-		XMM((modrm >> 3) & 0x7).f[3] = XMM((modrm >> 3) & 0x7).f[3] + XMM(modrm & 0x7).f[3];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG src;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		XMM((modrm >> 3) & 0x7).f[0] = XMM((modrm >> 3) & 0x7).f[0] + src.f[0];
-		XMM((modrm >> 3) & 0x7).f[1] = XMM((modrm >> 3) & 0x7).f[1] + src.f[1];
-		XMM((modrm >> 3) & 0x7).f[2] = XMM((modrm >> 3) & 0x7).f[2] + src.f[2];
-		XMM((modrm >> 3) & 0x7).f[3] = XMM((modrm >> 3) & 0x7).f[3] + src.f[3];
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VF(dst, _mm_add_ps(XMM_VF(dst), XMM_VF(src)));
+#elif defined(I386_VECTOR_NEON_FLOAT)
+	vst1q_f32(dst.f, vaddq_f32(vld1q_f32(dst.f), vld1q_f32(src.f)));
+#else
+	for (int n=0;n < 4;n++)
+		dst.f[n] = dst.f[n] + src.f[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
@@ -3753,40 +3778,44 @@ void i386_device::sse_orpd_r128_rm128() // Opcode 66 0f 56
 void i386_device::sse_mulps() // Opcode 0f 59 ????
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		XMM((modrm >> 3) & 0x7).f[0] = XMM((modrm >> 3) & 0x7).f[0] * XMM(modrm & 0x7).f[0];
-		XMM((modrm >> 3) & 0x7).f[1] = XMM((modrm >> 3) & 0x7).f[1] * XMM(modrm & 0x7).f[1];
-		XMM((modrm >> 3) & 0x7).f[2] = XMM((modrm >> 3) & 0x7).f[2] * XMM(modrm & 0x7).f[2];
-		XMM((modrm >> 3) & 0x7).f[3] = XMM((modrm >> 3) & 0x7).f[3] * XMM(modrm & 0x7).f[3];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG src;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		XMM((modrm >> 3) & 0x7).f[0] = XMM((modrm >> 3) & 0x7).f[0] * src.f[0];
-		XMM((modrm >> 3) & 0x7).f[1] = XMM((modrm >> 3) & 0x7).f[1] * src.f[1];
-		XMM((modrm >> 3) & 0x7).f[2] = XMM((modrm >> 3) & 0x7).f[2] * src.f[2];
-		XMM((modrm >> 3) & 0x7).f[3] = XMM((modrm >> 3) & 0x7).f[3] * src.f[3];
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VF(dst, _mm_mul_ps(XMM_VF(dst), XMM_VF(src)));
+#elif defined(I386_VECTOR_NEON_FLOAT)
+	vst1q_f32(dst.f, vmulq_f32(vld1q_f32(dst.f), vld1q_f32(src.f)));
+#else
+	for (int n=0;n < 4;n++)
+		dst.f[n] = dst.f[n] * src.f[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_subps() // Opcode 0f 5c
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		XMM((modrm >> 3) & 0x7).f[0] = XMM((modrm >> 3) & 0x7).f[0] - XMM(modrm & 0x7).f[0];
-		XMM((modrm >> 3) & 0x7).f[1] = XMM((modrm >> 3) & 0x7).f[1] - XMM(modrm & 0x7).f[1];
-		XMM((modrm >> 3) & 0x7).f[2] = XMM((modrm >> 3) & 0x7).f[2] - XMM(modrm & 0x7).f[2];
-		XMM((modrm >> 3) & 0x7).f[3] = XMM((modrm >> 3) & 0x7).f[3] - XMM(modrm & 0x7).f[3];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG src;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		XMM((modrm >> 3) & 0x7).f[0] = XMM((modrm >> 3) & 0x7).f[0] - src.f[0];
-		XMM((modrm >> 3) & 0x7).f[1] = XMM((modrm >> 3) & 0x7).f[1] - src.f[1];
-		XMM((modrm >> 3) & 0x7).f[2] = XMM((modrm >> 3) & 0x7).f[2] - src.f[2];
-		XMM((modrm >> 3) & 0x7).f[3] = XMM((modrm >> 3) & 0x7).f[3] - src.f[3];
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VF(dst, _mm_sub_ps(XMM_VF(dst), XMM_VF(src)));
+#elif defined(I386_VECTOR_NEON_FLOAT)
+	vst1q_f32(dst.f, vsubq_f32(vld1q_f32(dst.f), vld1q_f32(src.f)));
+#else
+	for (int n=0;n < 4;n++)
+		dst.f[n] = dst.f[n] - src.f[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
@@ -3839,20 +3868,22 @@ void i386_device::sse_minps() // Opcode 0f 5d
 void i386_device::sse_divps() // Opcode 0f 5e
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		XMM((modrm >> 3) & 0x7).f[0] = XMM((modrm >> 3) & 0x7).f[0] / XMM(modrm & 0x7).f[0];
-		XMM((modrm >> 3) & 0x7).f[1] = XMM((modrm >> 3) & 0x7).f[1] / XMM(modrm & 0x7).f[1];
-		XMM((modrm >> 3) & 0x7).f[2] = XMM((modrm >> 3) & 0x7).f[2] / XMM(modrm & 0x7).f[2];
-		XMM((modrm >> 3) & 0x7).f[3] = XMM((modrm >> 3) & 0x7).f[3] / XMM(modrm & 0x7).f[3];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG src;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		XMM((modrm >> 3) & 0x7).f[0] = XMM((modrm >> 3) & 0x7).f[0] / src.f[0];
-		XMM((modrm >> 3) & 0x7).f[1] = XMM((modrm >> 3) & 0x7).f[1] / src.f[1];
-		XMM((modrm >> 3) & 0x7).f[2] = XMM((modrm >> 3) & 0x7).f[2] / src.f[2];
-		XMM((modrm >> 3) & 0x7).f[3] = XMM((modrm >> 3) & 0x7).f[3] / src.f[3];
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VF(dst, _mm_div_ps(XMM_VF(dst), XMM_VF(src)));
+#elif defined(I386_VECTOR_NEON_FLOAT)
+	vst1q_f32(dst.f, vdivq_f32(vld1q_f32(dst.f), vld1q_f32(src.f)));
+#else
+	for (int n=0;n < 4;n++)
+		dst.f[n] = dst.f[n] / src.f[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
@@ -4703,16 +4734,22 @@ void i386_device::sse_pminub_r64_rm64() // Opcode 0f da
 void i386_device::sse_pminub_r128_rm128() // Opcode 66 0f da
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).b[n] = XMM((modrm >> 3) & 0x7).b[n] < XMM(modrm & 0x7).b[n] ? XMM((modrm >> 3) & 0x7).b[n] : XMM(modrm & 0x7).b[n];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).b[n] = XMM((modrm >> 3) & 0x7).b[n] < s.b[n] ? XMM((modrm >> 3) & 0x7).b[n] : s.b[n];
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_min_epu8(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u8(dst.b, vminq_u8(vld1q_u8(dst.b), vld1q_u8(src.b)));
+#else
+	for (int n=0;n < 16;n++)
+		dst.b[n] = dst.b[n] < src.b[n] ? dst.b[n] : src.b[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
@@ -4899,16 +4936,22 @@ void i386_device::sse_psubq_r64_rm64()  // Opcode 0f fb
 void i386_device::sse_psubq_r128_rm128()  // Opcode 66 0f fb
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		XMM((modrm >> 3) & 0x7).q[0]=XMM((modrm >> 3) & 0x7).q[0] - XMM(modrm & 7).q[0];
-		XMM((modrm >> 3) & 0x7).q[1]=XMM((modrm >> 3) & 0x7).q[1] - XMM(modrm & 7).q[1];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		XMM((modrm >> 3) & 0x7).q[0]=XMM((modrm >> 3) & 0x7).q[0] - s.q[0];
-		XMM((modrm >> 3) & 0x7).q[1]=XMM((modrm >> 3) & 0x7).q[1] - s.q[1];
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_sub_epi64(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u64(dst.q, vsubq_u64(vld1q_u64(dst.q), vld1q_u64(src.q)));
+#else
+	for (int n=0;n < 2;n++)
+		dst.q[n]=dst.q[n] - src.q[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
@@ -5068,60 +5111,66 @@ void i386_device::sse_packssdw_r128_rm128() // Opcode 66 0f 6b
 void i386_device::sse_pcmpgtb_r128_rm128() // Opcode 66 0f 64
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		int s,d;
-		s=modrm & 0x7;
-		d=(modrm >> 3) & 0x7;
-		for (int c=0;c <= 15;c++)
-			XMM(d).b[c]=(XMM(d).c[c] > XMM(s).c[c]) ? 0xff : 0;
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
-		int d=(modrm >> 3) & 0x7;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int c=0;c <= 15;c++)
-			XMM(d).b[c]=(XMM(d).c[c] > s.c[c]) ? 0xff : 0;
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_cmpgt_epi8(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u8(dst.b, vcgtq_s8(vld1q_s8(dst.c), vld1q_s8(src.c)));
+#else
+	for (int n=0;n < 16;n++)
+		dst.b[n]=(dst.c[n] > src.c[n]) ? 0xff : 0;
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_pcmpgtw_r128_rm128() // Opcode 66 0f 65
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		int s,d;
-		s=modrm & 0x7;
-		d=(modrm >> 3) & 0x7;
-		for (int c=0;c <= 7;c++)
-			XMM(d).w[c]=(XMM(d).s[c] > XMM(s).s[c]) ? 0xffff : 0;
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
-		int d=(modrm >> 3) & 0x7;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int c=0;c <= 7;c++)
-			XMM(d).w[c]=(XMM(d).s[c] > s.s[c]) ? 0xffff : 0;
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_cmpgt_epi16(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u16(dst.w, vcgtq_s16(vld1q_s16(dst.s), vld1q_s16(src.s)));
+#else
+	for (int n=0;n < 8;n++)
+		dst.w[n]=(dst.s[n] > src.s[n]) ? 0xffff : 0;
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_pcmpgtd_r128_rm128() // Opcode 66 0f 66
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		int s,d;
-		s=modrm & 0x7;
-		d=(modrm >> 3) & 0x7;
-		for (int c=0;c <= 3;c++)
-			XMM(d).d[c]=(XMM(d).i[c] > XMM(s).i[c]) ? 0xffffffff : 0;
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
-		int d=(modrm >> 3) & 0x7;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int c=0;c <= 3;c++)
-			XMM(d).d[c]=(XMM(d).i[c] > s.i[c]) ? 0xffffffff : 0;
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_cmpgt_epi32(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u32(dst.d, vcgtq_s32(vld1q_s32(dst.i), vld1q_s32(src.i)));
+#else
+	for (int n=0;n < 4;n++)
+		dst.d[n]=(dst.i[n] > src.i[n]) ? 0xffffffff : 0;
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
@@ -5255,181 +5304,220 @@ void i386_device::sse_punpckhqdq_r128_rm128() // Opcode 66 0f 6d
 void i386_device::sse_pcmpeqb_r128_rm128() // Opcode 66 0f 74
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		int s,d;
-		s=modrm & 0x7;
-		d=(modrm >> 3) & 0x7;
-		for (int c=0;c <= 15;c++)
-			XMM(d).b[c]=(XMM(d).c[c] == XMM(s).c[c]) ? 0xff : 0;
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
-		int d=(modrm >> 3) & 0x7;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int c=0;c <= 15;c++)
-			XMM(d).b[c]=(XMM(d).c[c] == s.c[c]) ? 0xff : 0;
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_cmpeq_epi8(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u8(dst.b, vceqq_s8(vld1q_s8(dst.c), vld1q_s8(src.c)));
+#else
+	for (int n=0;n < 16;n++)
+		dst.b[n]=(dst.c[n] == src.c[n]) ? 0xff : 0;
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_pcmpeqw_r128_rm128() // Opcode 66 0f 75
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		int s,d;
-		s=modrm & 0x7;
-		d=(modrm >> 3) & 0x7;
-		for (int c=0;c <= 7;c++)
-			XMM(d).w[c]=(XMM(d).s[c] == XMM(s).s[c]) ? 0xffff : 0;
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
-		int d=(modrm >> 3) & 0x7;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int c=0;c <= 7;c++)
-			XMM(d).w[c]=(XMM(d).s[c] == s.s[c]) ? 0xffff : 0;
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_cmpeq_epi16(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u16(dst.w, vceqq_s16(vld1q_s16(dst.s), vld1q_s16(src.s)));
+#else
+	for (int n=0;n < 8;n++)
+		dst.w[n]=(dst.s[n] == src.s[n]) ? 0xffff : 0;
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_pcmpeqd_r128_rm128() // Opcode 66 0f 76
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		int s,d;
-		s=modrm & 0x7;
-		d=(modrm >> 3) & 0x7;
-		for (int c=0;c <= 3;c++)
-			XMM(d).d[c]=(XMM(d).i[c] == XMM(s).i[c]) ? 0xffffffff : 0;
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
-		int d=(modrm >> 3) & 0x7;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int c=0;c <= 3;c++)
-			XMM(d).d[c]=(XMM(d).i[c] == s.i[c]) ? 0xffffffff : 0;
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_cmpeq_epi32(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u32(dst.d, vceqq_s32(vld1q_s32(dst.i), vld1q_s32(src.i)));
+#else
+	for (int n=0;n < 4;n++)
+		dst.d[n]=(dst.i[n] == src.i[n]) ? 0xffffffff : 0;
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_paddq_r128_rm128()  // Opcode 66 0f d4
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		int s,d;
-		s=modrm & 0x7;
-		d=(modrm >> 3) & 0x7;
-		XMM(d).q[0]=XMM(d).q[0]+XMM(s).q[0];
-		XMM(d).q[1]=XMM(d).q[1]+XMM(s).q[1];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG src;
-		int d=(modrm >> 3) & 0x7;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		XMM(d).q[0]=XMM(d).q[0]+src.q[0];
-		XMM(d).q[1]=XMM(d).q[1]+src.q[1];
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_add_epi64(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u64(dst.q, vaddq_u64(vld1q_u64(dst.q), vld1q_u64(src.q)));
+#else
+	for (int n=0;n < 2;n++)
+		dst.q[n]=dst.q[n] + src.q[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_pmullw_r128_rm128()  // Opcode 66 0f d5
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		int s,d;
-		s=modrm & 0x7;
-		d=(modrm >> 3) & 0x7;
-		for (int n = 0; n < 8;n++)
-			XMM(d).w[n]=(uint32_t)((int32_t)XMM(d).s[n]*(int32_t)XMM(s).s[n]) & 0xffff;
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG src;
-		int d;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		d=(modrm >> 3) & 0x7;
-		for (int n = 0; n < 8;n++)
-			XMM(d).w[n]=(uint32_t)((int32_t)XMM(d).s[n]*(int32_t)src.s[n]) & 0xffff;
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_mullo_epi16(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u16(dst.w, vmulq_u16(vld1q_u16(dst.w), vld1q_u16(src.w)));
+#else
+	for (int n=0;n < 8;n++)
+		dst.w[n]=(uint32_t)((int32_t)dst.s[n]*(int32_t)src.s[n]) & 0xffff;
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_paddb_r128_rm128()  // Opcode 66 0f fc
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).b[n]=XMM((modrm >> 3) & 0x7).b[n] + XMM(modrm & 7).b[n];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).b[n]=XMM((modrm >> 3) & 0x7).b[n] + s.b[n];
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_add_epi8(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u8(dst.b, vaddq_u8(vld1q_u8(dst.b), vld1q_u8(src.b)));
+#else
+	for (int n=0;n < 16;n++)
+		dst.b[n]=dst.b[n] + src.b[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_paddw_r128_rm128()  // Opcode 66 0f fd
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).w[n]=XMM((modrm >> 3) & 0x7).w[n] + XMM(modrm & 7).w[n];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).w[n]=XMM((modrm >> 3) & 0x7).w[n] + s.w[n];
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_add_epi16(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u16(dst.w, vaddq_u16(vld1q_u16(dst.w), vld1q_u16(src.w)));
+#else
+	for (int n=0;n < 8;n++)
+		dst.w[n]=dst.w[n] + src.w[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_paddd_r128_rm128()  // Opcode 66 0f fe
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 4;n++)
-			XMM((modrm >> 3) & 0x7).d[n]=XMM((modrm >> 3) & 0x7).d[n] + XMM(modrm & 7).d[n];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 4;n++)
-			XMM((modrm >> 3) & 0x7).d[n]=XMM((modrm >> 3) & 0x7).d[n] + s.d[n];
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_add_epi32(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u32(dst.d, vaddq_u32(vld1q_u32(dst.d), vld1q_u32(src.d)));
+#else
+	for (int n=0;n < 4;n++)
+		dst.d[n]=dst.d[n] + src.d[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_psubusb_r128_rm128()  // Opcode 66 0f d8
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).b[n]=XMM((modrm >> 3) & 0x7).b[n] < XMM(modrm & 7).b[n] ? 0 : XMM((modrm >> 3) & 0x7).b[n]-XMM(modrm & 7).b[n];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG src;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).b[n]=XMM((modrm >> 3) & 0x7).b[n] < src.b[n] ? 0 : XMM((modrm >> 3) & 0x7).b[n]-src.b[n];
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_subs_epu8(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u8(dst.b, vqsubq_u8(vld1q_u8(dst.b), vld1q_u8(src.b)));
+#else
+	for (int n=0;n < 16;n++)
+		dst.b[n]=dst.b[n] < src.b[n] ? 0 : dst.b[n]-src.b[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_psubusw_r128_rm128()  // Opcode 66 0f d9
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).w[n]=XMM((modrm >> 3) & 0x7).w[n] < XMM(modrm & 7).w[n] ? 0 : XMM((modrm >> 3) & 0x7).w[n]-XMM(modrm & 7).w[n];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG src;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).w[n]=XMM((modrm >> 3) & 0x7).w[n] < src.w[n] ? 0 : XMM((modrm >> 3) & 0x7).w[n]-src.w[n];
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_subs_epu16(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u16(dst.w, vqsubq_u16(vld1q_u16(dst.w), vld1q_u16(src.w)));
+#else
+	for (int n=0;n < 8;n++)
+		dst.w[n]=dst.w[n] < src.w[n] ? 0 : dst.w[n]-src.w[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
@@ -5468,176 +5556,242 @@ void i386_device::sse_pandn_r128_rm128()  // Opcode 66 0f df
 void i386_device::sse_paddusb_r128_rm128()  // Opcode 66 0f dc
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).b[n]=XMM((modrm >> 3) & 0x7).b[n] > (0xff-XMM(modrm & 7).b[n]) ? 0xff : XMM((modrm >> 3) & 0x7).b[n]+XMM(modrm & 7).b[n];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG src;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).b[n]=XMM((modrm >> 3) & 0x7).b[n] > (0xff-src.b[n]) ? 0xff : XMM((modrm >> 3) & 0x7).b[n]+src.b[n];
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_adds_epu8(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u8(dst.b, vqaddq_u8(vld1q_u8(dst.b), vld1q_u8(src.b)));
+#else
+	for (int n=0;n < 16;n++)
+		dst.b[n]=dst.b[n] > (0xff-src.b[n]) ? 0xff : dst.b[n]+src.b[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_paddusw_r128_rm128()  // Opcode 66 0f dd
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).w[n]=XMM((modrm >> 3) & 0x7).w[n] > (0xffff-XMM(modrm & 7).w[n]) ? 0xffff : XMM((modrm >> 3) & 0x7).w[n]+XMM(modrm & 7).w[n];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG src;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).w[n]=XMM((modrm >> 3) & 0x7).w[n] > (0xffff-src.w[n]) ? 0xffff : XMM((modrm >> 3) & 0x7).w[n]+src.w[n];
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_adds_epu16(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u16(dst.w, vqaddq_u16(vld1q_u16(dst.w), vld1q_u16(src.w)));
+#else
+	for (int n=0;n < 8;n++)
+		dst.w[n]=dst.w[n] > (0xffff-src.w[n]) ? 0xffff : dst.w[n]+src.w[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_pmaxub_r128_rm128() // Opcode 66 0f de
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).b[n] = XMM((modrm >> 3) & 0x7).b[n] > XMM(modrm & 0x7).b[n] ? XMM((modrm >> 3) & 0x7).b[n] : XMM(modrm & 0x7).b[n];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).b[n] = XMM((modrm >> 3) & 0x7).b[n] > s.b[n] ? XMM((modrm >> 3) & 0x7).b[n] : s.b[n];
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_max_epu8(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u8(dst.b, vmaxq_u8(vld1q_u8(dst.b), vld1q_u8(src.b)));
+#else
+	for (int n=0;n < 16;n++)
+		dst.b[n] = dst.b[n] > src.b[n] ? dst.b[n] : src.b[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_pmulhuw_r128_rm128()  // Opcode 66 0f e4
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).w[n]=((uint32_t)XMM((modrm >> 3) & 0x7).w[n]*(uint32_t)XMM(modrm & 7).w[n]) >> 16;
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).w[n]=((uint32_t)XMM((modrm >> 3) & 0x7).w[n]*(uint32_t)s.w[n]) >> 16;
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_mulhi_epu16(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u16(dst.w, xmm_neon_mulhi_u16(vld1q_u16(dst.w), vld1q_u16(src.w)));
+#else
+	for (int n=0;n < 8;n++)
+		dst.w[n]=((uint32_t)dst.w[n]*(uint32_t)src.w[n]) >> 16;
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_pmulhw_r128_rm128()  // Opcode 66 0f e5
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).w[n]=(uint32_t)((int32_t)XMM((modrm >> 3) & 0x7).s[n]*(int32_t)XMM(modrm & 7).s[n]) >> 16;
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG src;
 		uint32_t ea = GetEA(modrm, 0);
 		READXMM(ea, src);
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).w[n]=(uint32_t)((int32_t)XMM((modrm >> 3) & 0x7).s[n]*(int32_t)src.s[n]) >> 16;
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_mulhi_epi16(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_s16(dst.s, xmm_neon_mulhi_s16(vld1q_s16(dst.s), vld1q_s16(src.s)));
+#else
+	for (int n=0;n < 8;n++)
+		dst.w[n]=(uint32_t)((int32_t)dst.s[n]*(int32_t)src.s[n]) >> 16;
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_psubsb_r128_rm128()  // Opcode 66 0f e8
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).c[n]=SaturatedSignedWordToSignedByte((int16_t)XMM((modrm >> 3) & 0x7).c[n] - (int16_t)XMM(modrm & 7).c[n]);
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).c[n]=SaturatedSignedWordToSignedByte((int16_t)XMM((modrm >> 3) & 0x7).c[n] - (int16_t)s.c[n]);
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_subs_epi8(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_s8(dst.c, vqsubq_s8(vld1q_s8(dst.c), vld1q_s8(src.c)));
+#else
+	for (int n=0;n < 16;n++)
+		dst.c[n]=SaturatedSignedWordToSignedByte((int16_t)dst.c[n] - (int16_t)src.c[n]);
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_psubsw_r128_rm128()  // Opcode 66 0f e9
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).s[n]=SaturatedSignedDwordToSignedWord((int32_t)XMM((modrm >> 3) & 0x7).s[n] - (int32_t)XMM(modrm & 7).s[n]);
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).s[n]=SaturatedSignedDwordToSignedWord((int32_t)XMM((modrm >> 3) & 0x7).s[n] - (int32_t)s.s[n]);
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_subs_epi16(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_s16(dst.s, vqsubq_s16(vld1q_s16(dst.s), vld1q_s16(src.s)));
+#else
+	for (int n=0;n < 8;n++)
+		dst.s[n]=SaturatedSignedDwordToSignedWord((int32_t)dst.s[n] - (int32_t)src.s[n]);
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_pminsw_r128_rm128() // Opcode 66 0f ea
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).s[n] = XMM((modrm >> 3) & 0x7).s[n] < XMM(modrm & 0x7).s[n] ? XMM((modrm >> 3) & 0x7).s[n] : XMM(modrm & 0x7).s[n];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).s[n] = XMM((modrm >> 3) & 0x7).s[n] < s.s[n] ? XMM((modrm >> 3) & 0x7).s[n] : s.s[n];
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_min_epi16(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_s16(dst.s, vminq_s16(vld1q_s16(dst.s), vld1q_s16(src.s)));
+#else
+	for (int n=0;n < 8;n++)
+		dst.s[n] = dst.s[n] < src.s[n] ? dst.s[n] : src.s[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_pmaxsw_r128_rm128() // Opcode 66 0f ee
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).s[n] = XMM((modrm >> 3) & 0x7).s[n] > XMM(modrm & 0x7).s[n] ? XMM((modrm >> 3) & 0x7).s[n] : XMM(modrm & 0x7).s[n];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).s[n] = XMM((modrm >> 3) & 0x7).s[n] > s.s[n] ? XMM((modrm >> 3) & 0x7).s[n] : s.s[n];
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_max_epi16(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_s16(dst.s, vmaxq_s16(vld1q_s16(dst.s), vld1q_s16(src.s)));
+#else
+	for (int n=0;n < 8;n++)
+		dst.s[n] = dst.s[n] > src.s[n] ? dst.s[n] : src.s[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_paddsb_r128_rm128()  // Opcode 66 0f ec
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).c[n]=SaturatedSignedWordToSignedByte((int16_t)XMM((modrm >> 3) & 0x7).c[n] + (int16_t)XMM(modrm & 7).c[n]);
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).c[n]=SaturatedSignedWordToSignedByte((int16_t)XMM((modrm >> 3) & 0x7).c[n] + (int16_t)s.c[n]);
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_adds_epi8(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_s8(dst.c, vqaddq_s8(vld1q_s8(dst.c), vld1q_s8(src.c)));
+#else
+	for (int n=0;n < 16;n++)
+		dst.c[n]=SaturatedSignedWordToSignedByte((int16_t)dst.c[n] + (int16_t)src.c[n]);
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_paddsw_r128_rm128()  // Opcode 66 0f ed
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).s[n]=SaturatedSignedDwordToSignedWord((int32_t)XMM((modrm >> 3) & 0x7).s[n] + (int32_t)XMM(modrm & 7).s[n]);
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).s[n]=SaturatedSignedDwordToSignedWord((int32_t)XMM((modrm >> 3) & 0x7).s[n] + (int32_t)s.s[n]);
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_adds_epi16(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_s16(dst.s, vqaddq_s16(vld1q_s16(dst.s), vld1q_s16(src.s)));
+#else
+	for (int n=0;n < 8;n++)
+		dst.s[n]=SaturatedSignedDwordToSignedWord((int32_t)dst.s[n] + (int32_t)src.s[n]);
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
@@ -5694,48 +5848,66 @@ void i386_device::sse_pmaddwd_r128_rm128()  // Opcode 66 0f f5
 void i386_device::sse_psubb_r128_rm128()  // Opcode 66 0f f8
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).b[n]=XMM((modrm >> 3) & 0x7).b[n] - XMM(modrm & 7).b[n];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).b[n]=XMM((modrm >> 3) & 0x7).b[n] - s.b[n];
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_sub_epi8(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u8(dst.b, vsubq_u8(vld1q_u8(dst.b), vld1q_u8(src.b)));
+#else
+	for (int n=0;n < 16;n++)
+		dst.b[n]=dst.b[n] - src.b[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_psubw_r128_rm128()  // Opcode 66 0f f9
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).w[n]=XMM((modrm >> 3) & 0x7).w[n] - XMM(modrm & 7).w[n];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).w[n]=XMM((modrm >> 3) & 0x7).w[n] - s.w[n];
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_sub_epi16(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u16(dst.w, vsubq_u16(vld1q_u16(dst.w), vld1q_u16(src.w)));
+#else
+	for (int n=0;n < 8;n++)
+		dst.w[n]=dst.w[n] - src.w[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_psubd_r128_rm128()  // Opcode 66 0f fa
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 4;n++)
-			XMM((modrm >> 3) & 0x7).d[n]=XMM((modrm >> 3) & 0x7).d[n] - XMM(modrm & 7).d[n];
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 4;n++)
-			XMM((modrm >> 3) & 0x7).d[n]=XMM((modrm >> 3) & 0x7).d[n] - s.d[n];
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_sub_epi32(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u32(dst.d, vsubq_u32(vld1q_u32(dst.d), vld1q_u32(src.d)));
+#else
+	for (int n=0;n < 4;n++)
+		dst.d[n]=dst.d[n] - src.d[n];
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
@@ -5771,32 +5943,44 @@ void i386_device::sse_psadbw_r128_rm128() // Opcode 66 0f f6
 void i386_device::sse_pavgb_r128_rm128() // Opcode 66 0f e0
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).b[n] = ((uint16_t)XMM((modrm >> 3) & 0x7).b[n] + (uint16_t)XMM(modrm & 0x7).b[n] + 1) >> 1;
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 16;n++)
-			XMM((modrm >> 3) & 0x7).b[n] = ((uint16_t)XMM((modrm >> 3) & 0x7).b[n] + (uint16_t)s.b[n] + 1) >> 1;
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_avg_epu8(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u8(dst.b, vrhaddq_u8(vld1q_u8(dst.b), vld1q_u8(src.b)));
+#else
+	for (int n=0;n < 16;n++)
+		dst.b[n] = ((uint16_t)dst.b[n] + (uint16_t)src.b[n] + 1) >> 1;
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
 void i386_device::sse_pavgw_r128_rm128() // Opcode 66 0f e3
 {
 	uint8_t modrm = FETCH();
+	XMM_REG src;
 	if( modrm >= 0xc0 ) {
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).w[n] = ((uint32_t)XMM((modrm >> 3) & 0x7).w[n] + (uint32_t)XMM(modrm & 0x7).w[n] + 1) >> 1;
+		src = XMM(modrm & 0x7);
 	} else {
-		XMM_REG s;
 		uint32_t ea = GetEA(modrm, 0);
-		READXMM(ea, s);
-		for (int n=0;n < 8;n++)
-			XMM((modrm >> 3) & 0x7).w[n] = ((uint32_t)XMM((modrm >> 3) & 0x7).w[n] + (uint32_t)s.w[n] + 1) >> 1;
+		READXMM(ea, src);
 	}
+	XMM_REG &dst = XMM((modrm >> 3) & 0x7);
+#if defined(I386_VECTOR_SSE2)
+	XMM_STORE_VI(dst, _mm_avg_epu16(XMM_VI(dst), XMM_VI(src)));
+#elif defined(I386_VECTOR_NEON)
+	vst1q_u16(dst.w, vrhaddq_u16(vld1q_u16(dst.w), vld1q_u16(src.w)));
+#else
+	for (int n=0;n < 8;n++)
+		dst.w[n] = ((uint32_t)dst.w[n] + (uint32_t)src.w[n] + 1) >> 1;
+#endif
 	CYCLES(1);     // TODO: correct cycle count
 }
 
@@ -111,15 +111,26 @@ void m68000_device::execute_run()
 		if(m_icount > 0 && m_inst_substate)
 			(this->*(m_handlers_p[m_inst_state]))();
 
-		while(m_icount > 0) {
-			if(m_inst_state >= S_first_instruction) {
-				m_ipc = m_pc - 2;
-				m_irdi = m_ird;
-
-				if(machine().debug_flags & DEBUG_FLAG_ENABLED)
+		if(machine().debug_flags & DEBUG_FLAG_ENABLED) {
+			while(m_icount > 0) {
+				if(m_inst_state >= S_first_instruction) {
+					m_ipc = m_pc - 2;
+					m_irdi = m_ird;
 					debugger_instruction_hook(m_ipc);
+				}
+				(this->*(m_handlers_f[m_inst_state]))();
+			}
+		} else {
+			// Without the debugger, chain the full handlers straight from one
+			// to the next with the handler table kept in a local
+			const handler *const handlers = m_handlers_f;
+			while(m_icount > 0) {
+				if(m_inst_state >= S_first_instruction) {
+					m_ipc = m_pc - 2;
+					m_irdi = m_ird;
+				}
+				(this->*(handlers[m_inst_state]))();
 			}
-			(this->*(m_handlers_f[m_inst_state]))();
 		}
 
 		if(m_post_run)
@@ -29,15 +29,24 @@ void m68000_mcu_device::execute_run()
 			if(m_icount > m_bcount && m_inst_substate)
 				(this->*(m_handlers_p[m_inst_state]))();
 
-			while(m_icount > m_bcount) {
-				if(m_inst_state >= S_first_instruction) {
-					m_ipc = m_pc - 2;
-					m_irdi = m_ird;
-
-					if(machine().debug_flags & DEBUG_FLAG_ENABLED)
+			if(machine().debug_flags & DEBUG_FLAG_ENABLED) {
+				while(m_icount > m_bcount) {
+					if(m_inst_state >= S_first_instruction) {
+						m_ipc = m_pc - 2;
+						m_irdi = m_ird;
 						debugger_instruction_hook(m_ipc);
+					}
+					(this->*(m_handlers_f[m_inst_state]))();
+				}
+			} else {
+				const handler *const handlers = m_handlers_f;
+				while(m_icount > m_bcount) {
+					if(m_inst_state >= S_first_instruction) {
+						m_ipc = m_pc - 2;
+						m_irdi = m_ird;
+					}
+					(this->*(handlers[m_inst_state]))();
 				}
-				(this->*(m_handlers_f[m_inst_state]))();
 			}
 
 			if(m_post_run)
@@ -1502,6 +1502,10 @@ void mcs51_cpu_device::update_timer_t2(int cycles)
 
 void mcs51_cpu_device::update_timers(int cycles)
 {
+	/* Nothing counts while all timers are stopped (in timer 0 mode 3, timer 1 runs regardless of TR1) */
+	if (!GET_TR0 && !GET_TR1 && ((GET_M0_1<<1) | GET_M0_0) != 3 && !((m_features & FEATURE_I8052) && GET_TR2))
+		return;
+
 	while (cycles--)
 	{
 		update_timer_t0(1);
@@ -176,6 +176,7 @@ mips3_device::mips3_device(const machine_config &mconfig, device_type type, cons
 	, m_drcfe(nullptr)
 	, m_drcoptions(0)
 	, m_drc_cache_dirty(0)
+	, m_drc_journal_replayed(false)
 	, m_entry(nullptr)
 	, m_nocode(nullptr)
 	, m_out_of_cycles(nullptr)
@@ -5320,6 +5321,10 @@ void mips3_device::execute_run()
 			code_flush_cache();
 		m_drc_cache_dirty = false;
 
+		/* precompile blocks remembered from the previous run */
+		if (!m_drc_journal_replayed)
+			code_replay_journal();
+
 		/* execute */
 		do
 		{
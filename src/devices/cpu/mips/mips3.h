@@ -481,6 +481,7 @@ protected:
 
 												/* internal stuff */
 	uint8_t         m_drc_cache_dirty;          /* true if we need to flush the cache */
+	bool            m_drc_journal_replayed;     /* true once journaled blocks have been precompiled */
 
 												/* tables */
 	uint8_t         m_fpmode[4];                /* FPU mode table */
@@ -603,6 +604,7 @@ private:
 	void save_fast_iregs(drcuml_block &block);
 	void code_flush_cache();
 	void code_compile_block(uint8_t mode, offs_t pc);
+	void code_replay_journal();
 public:
 	void func_get_cycles();
 	void func_printf_exception();
@@ -1043,6 +1045,7 @@ COMPILER-SPECIFIC OPTIONS
 #define MIPS3DRC_CHECK_OVERFLOWS    0x0020          /* actually check overflows on add/sub instructions */
 #define MIPS3DRC_ACCURATE_DIVZERO   0x0040          /* load correct values into HI/LO on integer divide-by-zero */
 #define MIPS3DRC_EXTRA_INSTR_CHECK  0x0080          /* adds the last instruction value to all validation entry locations, used with STRICT_VERIFY */
+#define MIPS3DRC_DETECT_IDLE_LOOPS  0x0100          /* end the timeslice when a side-effect free polling loop branches back */
 
 #define MIPS3DRC_COMPATIBLE_OPTIONS (MIPS3DRC_STRICT_VERIFY | MIPS3DRC_STRICT_COP1 | MIPS3DRC_STRICT_COP0 | MIPS3DRC_STRICT_COP2)
 #define MIPS3DRC_FASTEST_OPTIONS    (0)
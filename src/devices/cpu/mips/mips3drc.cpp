@@ -402,6 +402,35 @@ void mips3_device::code_compile_block(uint8_t mode, offs_t pc)
 			code_flush_cache();
 		}
 	}
+
+	/* remember this block for the next run */
+	if (m_drcuml->journaling())
+		m_drcuml->journal_block(mode, pc, drc_frontend::code_hash(desclist));
+}
+
+
+/*-------------------------------------------------
+    code_replay_journal - precompile blocks that
+    were compiled during a previous run, skipping
+    any whose code has changed
+-------------------------------------------------*/
+
+void mips3_device::code_replay_journal()
+{
+	m_drc_journal_replayed = true;
+	if (!m_drcuml->journaling())
+		return;
+
+	for (const drcuml_state::journal_entry &entry : m_drcuml->journal())
+	{
+		/* only blocks for the current mode can be described correctly */
+		if (entry.mode != m_core->mode || m_drcuml->hash_exists(entry.mode, entry.pc))
+			continue;
+
+		/* compile the block only if the code still matches */
+		if (drc_frontend::code_hash(m_drcfe->describe_code(entry.pc)) == entry.hash)
+			code_compile_block(entry.mode, entry.pc);
+	}
 }
 
 
@@ -1500,6 +1529,10 @@ void mips3_device::generate_delay_slot_and_branch(drcuml_block &block, compiler_
 	assert(desc->delay.first() != nullptr);
 	generate_sequence_instruction(block, compiler_temp, desc->delay.first());       // <next instruction>
 
+	/* a polling loop can't exit until another device runs, so give up the rest of the timeslice */
+	if ((m_drcoptions & MIPS3DRC_DETECT_IDLE_LOOPS) && (desc->flags & OPFLAG_IDLE_LOOP))
+		UML_MOV(block, mem(&m_core->icount), 0);                                    // mov     [icount],0
+
 	/* update the cycles and jump through the hash table to the target */
 	if (desc->targetpc != BRANCH_TARGET_DYNAMIC)
 	{
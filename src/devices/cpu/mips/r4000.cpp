@@ -240,6 +240,7 @@ void r4000_base_device::device_reset()
 		m_tlb_mru[TR_WRITE][i] = i;
 		m_tlb_mru[TR_FETCH][i] = i;
 	}
+	m_fetch_cache.valid = false;
 
 	// initialize statistics
 	m_tlb_scans = 0;
@@ -258,6 +259,12 @@ void r4000_base_device::device_stop()
 		LOGMASKED(LOG_STATS, "tlb scans %d loops %d average %.3f loops per scan\n", m_tlb_scans, m_tlb_loops, double(m_tlb_loops) / double(m_tlb_scans));
 }
 
+void r4000_base_device::device_post_load()
+{
+	// tlb contents may have changed
+	m_fetch_cache.valid = false;
+}
+
 device_memory_interface::space_config_vector r4000_base_device::memory_space_config() const
 {
 	return space_config_vector{
@@ -1583,6 +1590,8 @@ void r4000_base_device::cp0_tlbwi(u8 const index)
 {
 	if (index < std::size(m_tlb))
 	{
+		m_fetch_cache.valid = false;
+
 		tlb_entry &entry = m_tlb[index];
 
 		entry.mask = m_cp0[CP0_PageMask];
@@ -3923,19 +3932,41 @@ bool r4000_base_device::fetch(u64 address, std::function<void(u32)> &&apply)
 		return false;
 	}
 
-	translate_result const t = translate(TR_FETCH, false, address);
-
-	// address error
-	if (t == ERROR)
+	/*
+	 * Sequential fetches almost always hit the same page, so the result of the
+	 * last successful translation is reused while the mode bits, address space
+	 * identifier and tlb contents are unchanged. Pages are at least 4KiB, so a
+	 * match on the 4KiB program address page is sufficient.
+	 */
+	u64 const key = (SR & (SR_KSU | SR_ERL | SR_EXL | SR_UX | SR_SX | SR_KX)) | ((m_cp0[CP0_EntryHi] & EH_ASID) << 32);
+	translate_result t;
+	if (m_fetch_cache.valid && m_fetch_cache.key == key && m_fetch_cache.vpage == (address & ~u64(0xfff)))
 	{
-		address_error(TR_FETCH, address);
-
-		return false;
+		address = m_fetch_cache.ppage | (address & 0xfff);
+		t = m_fetch_cache.result;
 	}
+	else
+	{
+		t = translate(TR_FETCH, false, address);
 
-	// tlb miss
-	if (t == MISS)
-		return false;
+		// address error
+		if (t == ERROR)
+		{
+			address_error(TR_FETCH, address);
+
+			return false;
+		}
+
+		// tlb miss
+		if (t == MISS)
+			return false;
+
+		m_fetch_cache.key = key;
+		m_fetch_cache.vpage = program_address & ~u64(0xfff);
+		m_fetch_cache.ppage = address & ~u64(0xfff);
+		m_fetch_cache.result = t;
+		m_fetch_cache.valid = true;
+	}
 
 	if (ICACHE)
 	{
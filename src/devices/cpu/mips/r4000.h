@@ -319,6 +319,7 @@ protected:
 	virtual void device_start() override;
 	virtual void device_reset() override;
 	virtual void device_stop() override;
+	virtual void device_post_load() override;
 
 	// device_memory_interface overrides
 	virtual space_config_vector memory_space_config() const override;
@@ -456,6 +457,17 @@ protected:
 	m_tlb[48];
 	unsigned m_tlb_mru[3][48];
 
+	// last instruction fetch translation
+	struct fetch_cache
+	{
+		u64 key;   // status mode bits and asid
+		u64 vpage; // program address page
+		u64 ppage; // physical address page
+		translate_result result;
+		bool valid;
+	}
+	m_fetch_cache;
+
 	// cp1 state
 	u64 m_f[32]; // floating point registers
 	u32 m_fcr0;  // implementation and revision register
@@ -154,6 +154,7 @@ enum
 #define PPCDRC_STRICT_VERIFY        0x0001          /* verify all instructions */
 #define PPCDRC_FLUSH_PC             0x0002          /* flush the PC value before each memory access */
 #define PPCDRC_ACCURATE_SINGLES     0x0004          /* do excessive rounding to make single-precision results "accurate" */
+#define PPCDRC_DETECT_IDLE_LOOPS    0x0008          /* end the timeslice when a side-effect free polling loop branches back */
 
 
 /* common sets of options */
@@ -560,6 +561,7 @@ protected:
 
 	/* internal stuff */
 	uint8_t               m_cache_dirty;                /* true if we need to flush the cache */
+	bool                  m_journal_replayed;           /* true once journaled blocks have been precompiled */
 
 	/* register mappings */
 	uml::parameter   m_regmap[32];                 /* parameter to register mappings for all 32 integer registers */
@@ -656,6 +658,7 @@ protected:
 	uint32_t compute_spr(uint32_t spr);
 	void code_flush_cache();
 	void code_compile_block(uint8_t mode, offs_t pc);
+	void code_replay_journal();
 	void static_generate_entry_point();
 	void static_generate_nocode_handler();
 	void static_generate_out_of_cycles();
@@ -952,6 +952,7 @@ void ppc_device::device_start()
 
 	/* mark the cache dirty so it is updated on next execute */
 	m_cache_dirty = true;
+	m_journal_replayed = false;
 }
 
 void ppc_device::state_export(const device_state_entry &entry)
@@ -231,6 +231,10 @@ void ppc_device::execute_run()
 		code_flush_cache();
 	m_cache_dirty = false;
 
+	/* precompile blocks remembered from the previous run */
+	if (!m_journal_replayed)
+		code_replay_journal();
+
 	/* execute */
 	do
 	{
@@ -473,6 +477,35 @@ void ppc_device::code_compile_block(uint8_t mode, offs_t pc)
 			code_flush_cache();
 		}
 	}
+
+	/* remember this block for the next run */
+	if (m_drcuml->journaling())
+		m_drcuml->journal_block(mode, pc, drc_frontend::code_hash(desclist));
+}
+
+
+/*-------------------------------------------------
+    code_replay_journal - precompile blocks that
+    were compiled during a previous run, skipping
+    any whose code has changed
+-------------------------------------------------*/
+
+void ppc_device::code_replay_journal()
+{
+	m_journal_replayed = true;
+	if (!m_drcuml->journaling())
+		return;
+
+	for (const drcuml_state::journal_entry &entry : m_drcuml->journal())
+	{
+		/* only blocks for the current mode can be described correctly */
+		if (entry.mode != m_core->mode || m_drcuml->hash_exists(entry.mode, entry.pc))
+			continue;
+
+		/* compile the block only if the code still matches */
+		if (drc_frontend::code_hash(m_drcfe->describe_code(entry.pc)) == entry.hash)
+			code_compile_block(entry.mode, entry.pc);
+	}
 }
 
 
@@ -1072,12 +1105,19 @@ void ppc_device::static_generate_memory_accessor(int mode, int size, int iswrite
 				void *fastbase = (uint8_t *)m_fastram[ramnum].base - m_fastram[ramnum].start;
 				uint32_t skip = label++;
 
-				if (m_fastram[ramnum].end != 0xffffffff)
+				/* bounded at both ends: rebase and do a single unsigned range check */
+				if (m_fastram[ramnum].start != 0x00000000 && m_fastram[ramnum].end != 0xffffffff)
+				{
+					UML_SUB(block, I3, I0, m_fastram[ramnum].start);     // sub     i3,i0,fastram_start
+					UML_CMP(block, I3, m_fastram[ramnum].end - m_fastram[ramnum].start); // cmp     i3,end-start
+					UML_JMPc(block, COND_A, skip);                                              // ja      skip
+				}
+				else if (m_fastram[ramnum].end != 0xffffffff)
 				{
 					UML_CMP(block, I0, m_fastram[ramnum].end);         // cmp     i0,end
 					UML_JMPc(block, COND_A, skip);                                              // ja      skip
 				}
-				if (m_fastram[ramnum].start != 0x00000000)
+				else if (m_fastram[ramnum].start != 0x00000000)
 				{
 					UML_CMP(block, I0, m_fastram[ramnum].start);           // cmp     i0,fastram_start
 					UML_JMPc(block, COND_B, skip);                                              // jb      skip
@@ -1936,6 +1976,10 @@ void ppc_device::generate_branch(drcuml_block &block, compiler_state *compiler,
 		UML_MOV(block, SPR32(SPR_LR), desc->pc + 4);                                    // mov     [lr],desc->pc + 4
 	}
 
+	/* a polling loop can't exit until another device runs, so give up the rest of the timeslice */
+	if ((m_drcoptions & PPCDRC_DETECT_IDLE_LOOPS) && (desc->flags & OPFLAG_IDLE_LOOP))
+		UML_MOV(block, mem(&m_core->icount), 0);                                        // mov     [icount],0
+
 	/* update the cycles and jump through the hash table to the target */
 	if (desc->targetpc != BRANCH_TARGET_DYNAMIC)
 	{
@@ -2573,6 +2573,19 @@ void sh_common_execution::generate_delay_slot(drcuml_block &block, compiler_stat
 	compiler.labelnum = compiler_temp.labelnum;
 }
 
+/*------------------------------------------------------------------
+    generate_idle_loop_check - give up the rest
+    of the timeslice when a polling loop that
+    can't exit until another device runs
+    branches back
+------------------------------------------------------------------*/
+
+void sh_common_execution::generate_idle_loop_check(drcuml_block &block, const opcode_desc *desc)
+{
+	if ((m_drcoptions & SH2DRC_DETECT_IDLE_LOOPS) && (desc->flags & OPFLAG_IDLE_LOOP))
+		UML_MOV(block, mem(&m_sh2_state->icount), 0);   // mov icount, 0
+}
+
 void sh_common_execution::func_unimplemented()
 {
 	// set up an invalid opcode exception
@@ -2772,6 +2785,7 @@ bool sh_common_execution::generate_opcode(drcuml_block &block, compiler_state &c
 
 			generate_delay_slot(block, compiler, desc, m_sh2_state->ea-2);
 
+			generate_idle_loop_check(block, desc);
 			generate_update_cycles(block, compiler, m_sh2_state->ea, true);    // <subtract cycles>
 			UML_HASHJMP(block, 0, m_sh2_state->ea, *m_nocode);   // hashjmp m_sh2_state->ea
 			return true;
@@ -2786,6 +2800,7 @@ bool sh_common_execution::generate_opcode(drcuml_block &block, compiler_state &c
 
 			generate_delay_slot(block, compiler, desc, m_sh2_state->ea-2);
 
+			generate_idle_loop_check(block, desc);
 			generate_update_cycles(block, compiler, m_sh2_state->ea, true);    // <subtract cycles>
 			UML_HASHJMP(block, 0, m_sh2_state->ea, *m_nocode);   // hashjmp m_sh2_state->ea
 			return true;
@@ -3318,6 +3333,7 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 		disp = util::sext(opcode, 8);
 		m_sh2_state->ea = (desc->pc + 2) + disp * 2 + 2;    // m_sh2_state->ea = destination
 
+		generate_idle_loop_check(block, desc);
 		generate_update_cycles(block, compiler, m_sh2_state->ea, true);    // <subtract cycles>
 		UML_HASHJMP(block, 0, m_sh2_state->ea, *m_nocode);   // jmp m_sh2_state->ea
 
@@ -3331,6 +3347,7 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 		disp = util::sext(opcode, 8);
 		m_sh2_state->ea = (desc->pc + 2) + disp * 2 + 2;        // m_sh2_state->ea = destination
 
+		generate_idle_loop_check(block, desc);
 		generate_update_cycles(block, compiler, m_sh2_state->ea, true);    // <subtract cycles>
 		UML_HASHJMP(block, 0, m_sh2_state->ea, *m_nocode);   // jmp m_sh2_state->ea
 
@@ -3350,6 +3367,7 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 			compiler.labelnum++;               // make sure the delay slot doesn't use it
 			generate_delay_slot(block, compiler, desc, m_sh2_state->ea-2);
 
+			generate_idle_loop_check(block, desc);
 			generate_update_cycles(block, compiler, m_sh2_state->ea, true);    // <subtract cycles>
 			UML_HASHJMP(block, 0, m_sh2_state->ea, *m_nocode);   // jmp m_sh2_state->ea
 
@@ -3371,6 +3389,7 @@ bool sh_common_execution::generate_group_8(drcuml_block &block, compiler_state &
 			compiler.labelnum++;               // make sure the delay slot doesn't use it
 			generate_delay_slot(block, compiler, desc, m_sh2_state->ea-2); // delay slot only if the branch is taken
 
+			generate_idle_loop_check(block, desc);
 			generate_update_cycles(block, compiler, m_sh2_state->ea, true);    // <subtract cycles>
 			UML_HASHJMP(block, 0, m_sh2_state->ea, *m_nocode);   // jmp m_sh2_state->ea
 
@@ -33,6 +33,14 @@
 #include "sh_dasm.h"
 #include "cpu/drcumlsh.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define SH4_VECTOR_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define SH4_VECTOR_NEON
+#include <arm_neon.h>
+#endif
+
 
 DEFINE_DEVICE_TYPE(SH3LE, sh3_device,   "sh3le", "Hitachi SH-3 (little)")
 DEFINE_DEVICE_TYPE(SH3BE, sh3be_device, "sh3be", "Hitachi SH-3 (big)")
@@ -1505,9 +1513,17 @@ inline void sh34_base_device::FIPR(const uint16_t opcode)
 	uint32_t m = (n & 3) << 2;
 	n = n & 12;
 
+	float const *const fr = reinterpret_cast<float const *>(m_sh2_state->m_fr);
 	float ml[4];
+#if defined(SH4_VECTOR_SSE2)
+	_mm_storeu_ps(ml, _mm_mul_ps(_mm_loadu_ps(fr + n), _mm_loadu_ps(fr + m)));
+#elif defined(SH4_VECTOR_NEON)
+	vst1q_f32(ml, vmulq_f32(vld1q_f32(fr + n), vld1q_f32(fr + m)));
+#else
 	for (int a = 0; a < 4; a++)
-		ml[a] = FP_RFS(n + a) * FP_RFS(m + a);
+		ml[a] = fr[n + a] * fr[m + a];
+#endif
+	// sum in the same order as the scalar code so results are unchanged
 	FP_RFS(n + 3) = ml[0] + ml[1] + ml[2] + ml[3];
 }
 
@@ -1517,15 +1533,36 @@ void sh34_base_device::FTRV(const uint16_t opcode)
 	uint32_t n = REG_N;
 	n = n & 12;
 
+	// each column of XMTRX is four consecutive registers, so the product
+	// is a sum of scaled columns; accumulating them one at a time keeps the
+	// rounding identical to the scalar order (the initial add of zero
+	// matters for the sign of zero results)
+	float *const fr = reinterpret_cast<float *>(m_sh2_state->m_fr);
+	float const *const xf = reinterpret_cast<float const *>(m_sh2_state->m_xf);
+#if defined(SH4_VECTOR_SSE2)
+	__m128 sum = _mm_add_ps(_mm_setzero_ps(), _mm_mul_ps(_mm_loadu_ps(xf + 0), _mm_set1_ps(fr[n + 0])));
+	sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(xf + 4), _mm_set1_ps(fr[n + 1])));
+	sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(xf + 8), _mm_set1_ps(fr[n + 2])));
+	sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(xf + 12), _mm_set1_ps(fr[n + 3])));
+	_mm_storeu_ps(fr + n, sum);
+#elif defined(SH4_VECTOR_NEON)
+	// multiply and add separately rather than with vmlaq, which may fuse
+	float32x4_t sum = vaddq_f32(vdupq_n_f32(0.0f), vmulq_n_f32(vld1q_f32(xf + 0), fr[n + 0]));
+	sum = vaddq_f32(sum, vmulq_n_f32(vld1q_f32(xf + 4), fr[n + 1]));
+	sum = vaddq_f32(sum, vmulq_n_f32(vld1q_f32(xf + 8), fr[n + 2]));
+	sum = vaddq_f32(sum, vmulq_n_f32(vld1q_f32(xf + 12), fr[n + 3]));
+	vst1q_f32(fr + n, sum);
+#else
 	float sum[4];
 	for (int i = 0; i < 4; i++)
 	{
 		sum[i] = 0;
 		for (int j = 0; j < 4; j++)
-			sum[i] += FP_XFS((j << 2) + i)*FP_RFS(n + j);
+			sum[i] += xf[(j << 2) + i] * fr[n + j];
 	}
 	for (int i = 0; i < 4; i++)
-		FP_RFS(n + i) = sum[i];
+		fr[n + i] = sum[i];
+#endif
 }
 
 inline void sh34_base_device::op1111_0xf13(const uint16_t opcode)
@@ -525,22 +525,13 @@ void sh34_base_device::sh4_dma_ddt(struct sh4_ddt_dma *s)
 		{
 			if ((s->direction) == 0)
 			{
-				uint32_t *p32bits = (uint32_t *)s->buffer;
-				for (uint32_t pos = 0; pos < s->length; pos++)
-				{
-					*p32bits++ = m_program->read_dword(s->source);
-					s->source = s->source + 4;
-				}
+				m_program->read_block(s->source, (uint32_t *)s->buffer, s->length);
+				s->source = s->source + 4 * s->length;
 			}
 			else
 			{
-				uint32_t *p32bits = (uint32_t *)s->buffer;
-				for (uint32_t pos = 0; pos < s->length; pos++)
-				{
-					m_program->write_dword(s->destination, *p32bits);
-					p32bits++;
-					s->destination = s->destination + 4;
-				}
+				m_program->write_block(s->destination, (const uint32_t *)s->buffer, s->length);
+				s->destination = s->destination + 4 * s->length;
 			}
 		}
 		if (s->size == 32)
@@ -556,13 +547,8 @@ void sh34_base_device::sh4_dma_ddt(struct sh4_ddt_dma *s)
 			}
 			else
 			{
-				uint64_t *p32bytes = (uint64_t *)s->buffer;
-				for (uint32_t pos = 0; pos < s->length * 4; pos++)
-				{
-					m_program->write_qword(s->destination, *p32bytes);
-					p32bytes++;
-					s->destination = s->destination + 8;
-				}
+				m_program->write_block(s->destination, (const uint64_t *)s->buffer, s->length * 4);
+				s->destination = s->destination + 32 * s->length;
 			}
 		}
 	}
@@ -2728,7 +2728,48 @@ bool adsp21062_device::generate_opcode(drcuml_block &block, compiler_state &comp
 						}
 						case 5:     // XOR
 						{
-							return false;
+							// sets BTF if the register equals the immediate, the register is left unchanged
+							switch (sreg)
+							{
+								case 0x0: // USTAT1
+									UML_CMP(block, USTAT1, data);
+									UML_SETc(block, COND_E, ASTAT_BTF);
+									break;
+								case 0x1: // USTAT2
+									UML_CMP(block, USTAT2, data);
+									UML_SETc(block, COND_E, ASTAT_BTF);
+									break;
+								case 0x9: // IRPTL
+									UML_CMP(block, IRPTL, data);
+									UML_SETc(block, COND_E, ASTAT_BTF);
+									break;
+								case 0xa: // MODE2
+									UML_CMP(block, MODE2, data);
+									UML_SETc(block, COND_E, ASTAT_BTF);
+									break;
+								case 0xb: // MODE1
+									UML_CMP(block, MODE1, data);
+									UML_SETc(block, COND_E, ASTAT_BTF);
+									break;
+								case 0xc: // ASTAT
+									return false;
+								case 0xd: // IMASK
+									UML_CMP(block, IMASK, data);
+									UML_SETc(block, COND_E, ASTAT_BTF);
+									break;
+								case 0xe: // STKY
+									UML_CMP(block, STKY, data);
+									UML_SETc(block, COND_E, ASTAT_BTF);
+									break;
+								case 0xf: // IMASKP
+									UML_CMP(block, IMASKP, data);
+									UML_SETc(block, COND_E, ASTAT_BTF);
+									break;
+
+								default:
+									return false;
+							}
+							return true;
 						}
 
 						default:
@@ -974,6 +974,24 @@ void tms3203x_device::execute_run()
 	{
 		while (m_icount > 0)
 		{
+			// RPTS fetches the repeated instruction once; run it back to back here
+			// and leave the final iteration to the block-repeat check below
+			if (m_delayed && (IREG(TMR_ST) & RMFLAG) && m_pc == IREG(TMR_RS) && IREG(TMR_RS) == IREG(TMR_RE))
+			{
+				uint32_t const op = ROPCODE(m_pc);
+				while (true)
+				{
+					burn_cycle(1);
+					m_pc++;
+					(this->*s_tms32031ops[op >> 21])(op);
+					if (m_icount <= 0 || !(IREG(TMR_ST) & RMFLAG) || m_pc != IREG(TMR_RE) + 1 || IREG(TMR_RS) != IREG(TMR_RE) || (int32_t)IREG(TMR_RC) <= 0)
+						break;
+					IREG(TMR_RC)--;
+					m_pc = IREG(TMR_RS);
+				}
+				continue;
+			}
+
 			if ((IREG(TMR_ST) & RMFLAG) && m_pc == IREG(TMR_RE) + 1)
 			{
 				if ((int32_t)--IREG(TMR_RC) >= 0)
@@ -1033,6 +1033,32 @@ void FUNCTION_NAME(tms340x0_device::pixblt)(int src_is_linear, int dst_is_linear
 			uint8_t dstbit = daddr & 15;
 			uint32_t srcword, dstword = 0;
 
+			/* word-aligned replace copies between RAM areas move whole rows at once */
+			if (!PIXEL_OP_REQUIRES_SOURCE && !TRANSPARENCY && !((saddr | daddr | (dx * BITS_PER_PIXEL)) & 15) && (word_write == &tms340x0_device::memory_w))
+			{
+				uint32_t const words = dx * BITS_PER_PIXEL / 16;
+				uint16_t const *const src = direct_vram(saddr, words);
+				uint16_t *const dst = src ? direct_vram(daddr, words) : nullptr;
+
+				/* overlapping rows are left to the loop below, which reads ahead of its writes */
+				if (dst && ((dst + words <= src) || (src + words <= dst)))
+				{
+					std::memcpy(dst, src, words * 2);
+					readwrites += words * 2;
+					if (!yreverse)
+					{
+						saddr += SPTCH();
+						daddr += DPTCH();
+					}
+					else
+					{
+						saddr -= SPTCH();
+						daddr -= DPTCH();
+					}
+					continue;
+				}
+			}
+
 			/* fetch the initial source word */
 			srcword = (this->*word_read)(srcwordaddr++ << 4);
 			readwrites++;
@@ -1177,45 +1203,57 @@ void FUNCTION_NAME(tms340x0_device::pixblt)(int src_is_linear, int dst_is_linear
 				(this->*word_write)(dwordaddr++ << 4, dstword);
 			}
 
-			/* loop over full words */
-			for (words = 0; words < full_words; words++)
+			/* replace fills of whole words in RAM write straight to memory */
+			uint16_t *const direct = (!PIXEL_OP_REQUIRES_SOURCE && !TRANSPARENCY && full_words && (word_write == &tms340x0_device::memory_w))
+					? direct_vram(dwordaddr << 4, full_words)
+					: nullptr;
+			if (direct)
 			{
-				/* fetch the destination word (if necessary) */
-				if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
-					dstword = (this->*word_read)(dwordaddr << 4);
-				else
-					dstword = 0;
-				dstmask = PIXEL_MASK;
-
-				/* loop over partials */
-				for (x = 0; x < PIXELS_PER_WORD; x++)
+				std::fill_n(direct, full_words, uint16_t(COLOR1()));
+				dwordaddr += full_words;
+			}
+			else
+			{
+				/* loop over full words */
+				for (words = 0; words < full_words; words++)
 				{
-					/* fetch another word if necessary */
-					if (srcmask == 0)
-					{
-						srcword = (this->*word_read)(swordaddr++ << 4);
-						srcmask = PIXEL_MASK;
-					}
-
-					/* process the pixel */
-					pixel = srcword & srcmask;
-					if (dstmask > srcmask)
-						pixel <<= bitshift;
+					/* fetch the destination word (if necessary) */
+					if (PIXEL_OP_REQUIRES_SOURCE || TRANSPARENCY)
+						dstword = (this->*word_read)(dwordaddr << 4);
 					else
-						pixel >>= bitshift_alt;
-					PIXEL_OP(dstword, dstmask, pixel);
-					if (!TRANSPARENCY || pixel != 0)
-						dstword = (dstword & ~dstmask) | pixel;
+						dstword = 0;
+					dstmask = PIXEL_MASK;
 
-					/* update the source */
-					srcmask <<= BITS_PER_PIXEL;
+					/* loop over partials */
+					for (x = 0; x < PIXELS_PER_WORD; x++)
+					{
+						/* fetch another word if necessary */
+						if (srcmask == 0)
+						{
+							srcword = (this->*word_read)(swordaddr++ << 4);
+							srcmask = PIXEL_MASK;
+						}
+
+						/* process the pixel */
+						pixel = srcword & srcmask;
+						if (dstmask > srcmask)
+							pixel <<= bitshift;
+						else
+							pixel >>= bitshift_alt;
+						PIXEL_OP(dstword, dstmask, pixel);
+						if (!TRANSPARENCY || pixel != 0)
+							dstword = (dstword & ~dstmask) | pixel;
+
+						/* update the source */
+						srcmask <<= BITS_PER_PIXEL;
+
+						/* update the destination */
+						dstmask <<= BITS_PER_PIXEL;
+					}
 
-					/* update the destination */
-					dstmask <<= BITS_PER_PIXEL;
+					/* write the result */
+					(this->*word_write)(dwordaddr++ << 4, dstword);
 				}
-
-				/* write the result */
-				(this->*word_write)(dwordaddr++ << 4, dstword);
 			}
 
 			/* handle the right partial word */
@@ -289,6 +289,32 @@ int32_t tms34020_device::PARAM_LONG_NO_INC()
 	return m_cache.read_dword_unaligned(m_pc);
 }
 
+/* returns a host pointer to a run of 16-bit words in RAM, or nullptr if the
+   words aren't in a single block of memory in host order; the debugger must
+   see every access, so this is never used while it's enabled */
+uint16_t *tms340x0_device::direct_vram(offs_t bitaddr, uint32_t words)
+{
+	address_space &program = space(AS_PROGRAM);
+	uint32_t const unitmask = (program.data_width() / 16) - 1;
+	if ((machine().debug_flags & DEBUG_FLAG_ENABLED) || !words)
+		return nullptr;
+	if (unitmask && ((ENDIANNESS_NATIVE != ENDIANNESS_LITTLE) || ((bitaddr >> 4) & unitmask)))
+		return nullptr;
+
+	uint16_t *const base = reinterpret_cast<uint16_t *>(program.get_write_ptr(bitaddr));
+	if (!base)
+		return nullptr;
+	for (uint32_t offset = 0x800; offset < words; offset += 0x800)
+	{
+		if (reinterpret_cast<uint16_t *>(program.get_write_ptr(bitaddr + (offset << 4))) != (base + offset))
+			return nullptr;
+	}
+	uint32_t const last = (words - 1) & ~unitmask;
+	if (reinterpret_cast<uint16_t *>(program.get_write_ptr(bitaddr + (last << 4))) != (base + last))
+		return nullptr;
+	return base;
+}
+
 uint32_t tms34010_device::TMS34010_RDMEM_WORD(offs_t A)
 {
 	return m_program.read_word(A);
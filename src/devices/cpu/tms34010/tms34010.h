@@ -356,6 +356,7 @@ protected:
 	virtual uint32_t TMS34010_RDMEM_DWORD(offs_t A) = 0;
 	virtual void TMS34010_WRMEM_WORD(offs_t A, uint32_t V) = 0;
 	virtual void TMS34010_WRMEM_DWORD(offs_t A, uint32_t V) = 0;
+	uint16_t *direct_vram(offs_t bitaddr, uint32_t words);
 	void SET_ST(uint32_t st);
 	void RESET_ST();
 	virtual uint16_t ROPCODE() = 0;
@@ -166,9 +166,7 @@ private:
 	memory_access<32, 1, 0, ENDIANNESS_LITTLE>::cache m_cache16;
 	memory_access<32, 2, 0, ENDIANNESS_LITTLE>::cache m_cache32;
 
-	std::function<u8  (offs_t)> m_pr8;
-	std::function<u16 (offs_t)> m_pr16;
-	std::function<u32 (offs_t)> m_pr32;
+	bool                m_bus16;
 	address_space *m_io;
 	uint32_t              m_PPC;
 	int                 m_icount;
@@ -409,7 +409,9 @@ u8 z80_device::rop()
 {
 	u8 res = opcode_read();
 	T(m_m1_cycles - 2);
-	m_refresh_cb((m_i << 8) | (m_r2 & 0x80) | (m_r & 0x7f), 0x00, 0xff);
+	// most systems don't watch refresh cycles, so skip the no-op callback on every M1
+	if (!m_refresh_cb.isunset())
+		m_refresh_cb((m_i << 8) | (m_r2 & 0x80) | (m_r & 0x7f), 0x00, 0xff);
 	T(2);
 	PC++;
 	m_r++;
@@ -10,6 +10,7 @@
 
 #include "emu.h"
 #include "cassette.h"
+#include "emuopts.h"
 #include "softlist_dev.h"
 
 #include "formats/imageutl.h"
@@ -50,7 +51,9 @@ cassette_image_device::cassette_image_device(const machine_config &mconfig, cons
 	m_create_opts(nullptr),
 	m_default_state(CASSETTE_PLAY),
 	m_interface(nullptr),
-	m_stereo(false)
+	m_stereo(false),
+	m_turbo(false),
+	m_turbo_active(false)
 {
 }
 
@@ -116,6 +119,18 @@ void cassette_image_device::update()
 		m_position = new_position;
 	}
 	m_position_time = cur_time;
+	update_turbo();
+}
+
+void cassette_image_device::update_turbo()
+{
+	// only give up fast-forward if this device asked for it
+	bool const want = m_turbo && m_cassette && is_playing() && motor_on();
+	if (want != m_turbo_active)
+	{
+		m_turbo_active = want;
+		machine().video().set_fastforward(want);
+	}
 }
 
 void cassette_image_device::change_state(cassette_state state, cassette_state mask)
@@ -130,6 +145,7 @@ void cassette_image_device::change_state(cassette_state state, cassette_state ma
 	{
 		update();
 		m_state = new_state;
+		update_turbo();
 	}
 }
 
@@ -241,6 +257,7 @@ void cassette_image_device::device_start()
 	m_cassette = nullptr;
 	m_state = m_default_state;
 	m_value = 0;
+	m_turbo = machine().options().cassette_turbo();
 
 	stream_alloc(0, m_stereo? 2:1, machine().sample_rate());
 }
@@ -437,6 +454,7 @@ std::string cassette_image_device::call_display()
 				if (get_position() > get_length())
 				{
 					m_state = ((m_state & ~CASSETTE_MASK_UISTATE) | CASSETTE_STOPPED);
+					update_turbo();
 				}
 			}
 		}
@@ -114,6 +114,7 @@ protected:
 	virtual const software_list_loader &get_software_list_loader() const override;
 
 	void update();
+	void update_turbo();
 
 private:
 	cassette_image::ptr m_cassette;
@@ -134,6 +135,8 @@ private:
 	bool has_any_extension(std::string_view candidate_extensions) const;
 	bool            m_stereo;
 	std::vector<s16> m_samples;
+	bool            m_turbo;        // fast-forward while playing with the motor on
+	bool            m_turbo_active; // fast-forward currently requested by this device
 };
 
 // device type definition
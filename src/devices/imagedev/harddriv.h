@@ -77,6 +77,8 @@ public:
 	const hard_disk_file::info &get_info() const;
 	bool read(uint32_t lbasector, void *buffer);
 	bool write(uint32_t lbasector, const void *buffer);
+	bool flush() { return m_hard_disk_handle->flush(); }
+	chd_async_read::ptr read_async(uint32_t lbasector, void *buffer) { return m_hard_disk_handle->read_async(lbasector, buffer); }
 
 	bool set_block_size(uint32_t blocksize);
 
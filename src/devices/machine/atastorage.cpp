@@ -30,7 +30,8 @@ ata_mass_storage_device_base::ata_mass_storage_device_base(const machine_config
 	m_num_heads(0), m_cur_lba(0), m_block_count(0), m_sectors_until_int(0), m_master_password_enable(0), m_user_password_enable(0),
 	m_master_password(nullptr),
 	m_user_password(nullptr),
-	m_dma_transfer_time(attotime::zero)
+	m_dma_transfer_time(attotime::zero),
+	m_pending_lba(0)
 {
 }
 
@@ -214,10 +215,18 @@ void ata_mass_storage_device_base::device_start()
 	save_item(NAME(m_block_count));
 }
 
+void ata_mass_storage_device_base::device_pre_save()
+{
+	// the sector buffer is part of the saved state
+	finish_pending_read();
+}
+
 void ata_mass_storage_device_base::soft_reset()
 {
 	ata_hle_device_base::soft_reset();
 
+	finish_pending_read();
+
 	m_cur_lba = 0;
 	m_status |= IDE_STATUS_DSC;
 
@@ -295,6 +304,15 @@ void ata_mass_storage_device_base::finished_command()
 		set_irq(ASSERT_LINE);
 		break;
 
+	case IDE_COMMAND_CACHE_FLUSH:
+		if (!flush_sectors())
+		{
+			m_status |= IDE_STATUS_ERR;
+			m_error = IDE_ERROR_ABRT;
+		}
+		ata_hle_device_base::finished_command();
+		break;
+
 	default:
 		ata_hle_device_base::finished_command();
 		break;
@@ -432,15 +450,36 @@ void ata_mass_storage_device_base::fill_buffer()
 		{
 			set_dasp(ASSERT_LINE);
 			if (m_command == IDE_COMMAND_READ_DMA)
-				start_busy(TIME_BETWEEN_SECTORS + m_dma_transfer_time, PARAM_COMMAND);
+				start_read(TIME_BETWEEN_SECTORS + m_dma_transfer_time);
 			else
-				start_busy(TIME_BETWEEN_SECTORS, PARAM_COMMAND);
+				start_read(TIME_BETWEEN_SECTORS);
 		}
 		break;
 	}
 }
 
 
+void ata_mass_storage_device_base::start_read(const attotime &time)
+{
+	// fetch the sector on a worker thread while the busy period elapses; the
+	// result is collected when the busy timer fires, so timing is unaffected
+	finish_pending_read();
+	m_pending_lba = lba_address();
+	m_pending_read = read_sector_async(m_pending_lba, &m_buffer[0]);
+	start_busy(time, PARAM_COMMAND);
+}
+
+
+void ata_mass_storage_device_base::finish_pending_read()
+{
+	if (m_pending_read)
+	{
+		m_pending_read->wait();
+		m_pending_read.reset();
+	}
+}
+
+
 void ata_mass_storage_device_base::finished_read()
 {
 	int lba = lba_address(), read_status;
@@ -452,8 +491,14 @@ void ata_mass_storage_device_base::finished_read()
 	{
 		read_status = 1;
 	}
+	else if (m_pending_read && m_pending_lba == lba)
+	{
+		read_status = !m_pending_read->wait();
+		m_pending_read.reset();
+	}
 	else
 	{
+		finish_pending_read();
 		read_status = read_sector(lba, &m_buffer[0]);
 	}
 
@@ -517,7 +562,7 @@ void ata_mass_storage_device_base::read_first_sector()
 		}
 		else
 		{
-			start_busy(seek_time(), PARAM_COMMAND);
+			start_read(seek_time());
 		}
 	}
 }
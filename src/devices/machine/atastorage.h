@@ -43,9 +43,12 @@ protected:
 	ata_mass_storage_device_base(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
 
 	virtual void device_start() override;
+	virtual void device_pre_save() override;
 
 	virtual int read_sector(uint32_t lba, void *buffer) = 0;
 	virtual int write_sector(uint32_t lba, const void *buffer) = 0;
+	virtual chd_async_read::ptr read_sector_async(uint32_t lba, void *buffer) { return nullptr; }
+	virtual bool flush_sectors() { return true; }
 	virtual attotime seek_time();
 
 	virtual void ide_build_identify_device();
@@ -69,6 +72,8 @@ protected:
 
 private:
 	void set_geometry(uint8_t sectors, uint8_t heads) { m_num_sectors = sectors; m_num_heads = heads; }
+	void start_read(const attotime &time);
+	void finish_pending_read();
 	void finished_read();
 	void finished_write();
 	void next_sector();
@@ -86,6 +91,10 @@ private:
 	const uint8_t *   m_user_password;
 	// DMA data transfer time for 1 sector
 	attotime          m_dma_transfer_time;
+
+	// sector being read in the background during the busy period
+	chd_async_read::ptr m_pending_read;
+	uint32_t          m_pending_lba;
 };
 
 // ======================> ide_hdd_device_base
@@ -103,6 +112,8 @@ protected:
 
 	virtual int read_sector(uint32_t lba, void *buffer) override { return !m_image->exists() ? 0 : m_image->read(lba, buffer); }
 	virtual int write_sector(uint32_t lba, const void *buffer) override { return !m_image->exists() ? 0 : m_image->write(lba, buffer); }
+	virtual chd_async_read::ptr read_sector_async(uint32_t lba, void *buffer) override { return !m_image->exists() ? nullptr : m_image->read_async(lba, buffer); }
+	virtual bool flush_sectors() override { return !m_image->exists() || m_image->flush(); }
 	virtual uint8_t calculate_status() override;
 
 	required_device<harddisk_image_device> m_image;
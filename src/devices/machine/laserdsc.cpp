@@ -88,6 +88,8 @@ laserdisc_device::laserdisc_device(const machine_config &mconfig, device_type ty
 	, m_readresult()
 	, m_chdtracks(0)
 	, m_work_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_IO))
+	, m_queued_hunknum(0)
+	, m_prefetch_hunknum(0)
 	, m_audiosquelch(0)
 	, m_videosquelch(0)
 	, m_fieldnum(0)
@@ -1062,6 +1064,11 @@ void laserdisc_device::read_track_data()
 		m_readresult = m_disc->codec_configure(CHD_CODEC_AVHUFF, AVHUFF_CODEC_DECOMPRESS_CONFIG, &m_avhuff_config);
 		if (!m_readresult)
 		{
+			// guess the next hunk from the step just taken, so the worker can
+			// fetch it from disk while this field is on screen
+			int32_t const step = int32_t(readhunk - m_queued_hunknum);
+			uint32_t const next = readhunk + ((step >= -2 && step <= 2 && step != 0) ? step : 1);
+			m_prefetch_hunknum = (next < m_disc->hunk_count()) ? next : readhunk;
 			m_queued_hunknum = readhunk;
 			m_readresult = chd_file::error::OPERATION_PENDING;
 			osd_work_item_queue(m_work_queue, read_async_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
@@ -1079,6 +1086,8 @@ void *laserdisc_device::read_async_static(void *param, int threadid)
 {
 	laserdisc_device &ld = *reinterpret_cast<laserdisc_device *>(param);
 	ld.m_readresult = ld.m_disc->read_hunk(ld.m_queued_hunknum, nullptr);
+	if (!ld.m_readresult && ld.m_prefetch_hunknum != ld.m_queued_hunknum)
+		ld.m_disc->prefetch_hunk(ld.m_prefetch_hunknum);
 	return nullptr;
 }
 
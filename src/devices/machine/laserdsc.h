@@ -287,6 +287,7 @@ private:
 	// async operations
 	osd_work_queue *    m_work_queue;           // work queue
 	uint32_t            m_queued_hunknum;       // queued hunk
+	uint32_t            m_prefetch_hunknum;     // hunk predicted to be read next
 
 	// core states
 	uint8_t             m_audiosquelch;         // audio squelch state: bit 0 = audio 1, bit 1 = audio 2
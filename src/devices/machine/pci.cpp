@@ -180,12 +180,28 @@ void pci_device::address_base_w(offs_t offset, uint32_t data)
 	}
 
 	int bid = bank_reg_infos[offset].bank;
+	uint64_t const old_start = bank_decode_start(bid);
 	if(bank_reg_infos[offset].hi)
 		bank_infos[bid].adr = (bank_infos[bid].adr & 0xffffffff) | (uint64_t(data) << 32);
 	else {
 		bank_infos[bid].adr = (bank_infos[bid].adr & 0xffffffff00000000U) | data;
 	}
-	remap_cb();
+
+	// BAR sizing writes all-ones and restores the old value, normally with decoding
+	// switched off in the command register; only remap when the window really moves
+	if(bank_decode_start(bid) != old_start)
+		remap_cb();
+}
+
+// Start of the window bank bid decodes, as map_device would install it, or ~0 when the bank is not mapped
+uint64_t pci_device::bank_decode_start(int bid) const
+{
+	const bank_info &bi = bank_infos[bid];
+	if(uint32_t(bi.adr) >= 0xfffffffc || !bi.size || (bi.flags & M_DISABLED))
+		return ~uint64_t(0);
+	if(~command & (bi.flags & M_IO ? 1 : 2))
+		return ~uint64_t(0);
+	return bi.adr & ~uint64_t(bi.size - 1);
 }
 
 uint16_t pci_device::vendor_r()
@@ -267,6 +283,7 @@ uint32_t pci_device::expansion_base_r()
 
 void pci_device::expansion_base_w(offs_t offset, uint32_t data, uint32_t mem_mask)
 {
+	uint32_t const old = expansion_rom_base;
 	COMBINE_DATA(&expansion_rom_base);
 	if(!expansion_rom_size)
 		expansion_rom_base = 0;
@@ -274,7 +291,8 @@ void pci_device::expansion_base_w(offs_t offset, uint32_t data, uint32_t mem_mas
 		// Trick to get an address resolution at expansion_rom_size with minimal granularity of 0x800, plus bit 1 set to keep the on/off information
 		expansion_rom_base &= 0xfffff801 & (1-expansion_rom_size);
 	}
-	remap_cb();
+	if(expansion_rom_base != old)
+		remap_cb();
 }
 
 // if non-zero a CAPability PoinTeR marks an offset in PCI config space where a standard extension is located
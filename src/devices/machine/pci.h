@@ -116,6 +116,7 @@ protected:
 	virtual void device_start() override;
 	virtual void device_reset() override;
 
+	uint64_t bank_decode_start(int bid) const;
 	void skip_map_regs(int count);
 	void add_map(uint64_t size, int flags, const address_map_constructor &map, device_t *relative_to = nullptr);
 	template <typename T> void add_map(uint64_t size, int flags, void (T::*map)(address_map &map), const char *name) {
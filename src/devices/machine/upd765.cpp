@@ -846,34 +846,40 @@ void upd765_family_device::live_run(attotime limit)
 	for(;;) {
 		switch(cur_live.state) {
 		case SEARCH_ADDRESS_MARK_HEADER:
-			if(read_one_bit(limit))
-				return;
-
-			LOGSHIFT("%s: shift = %04x data=%02x c=%d\n", cur_live.tm.to_string(), cur_live.shift_reg,
-					(cur_live.shift_reg & 0x4000 ? 0x80 : 0x00) |
-					(cur_live.shift_reg & 0x1000 ? 0x40 : 0x00) |
-					(cur_live.shift_reg & 0x0400 ? 0x20 : 0x00) |
-					(cur_live.shift_reg & 0x0100 ? 0x10 : 0x00) |
-					(cur_live.shift_reg & 0x0040 ? 0x08 : 0x00) |
-					(cur_live.shift_reg & 0x0010 ? 0x04 : 0x00) |
-					(cur_live.shift_reg & 0x0004 ? 0x02 : 0x00) |
-					(cur_live.shift_reg & 0x0001 ? 0x01 : 0x00),
-					cur_live.bit_counter);
+			// stay in here until a mark turns up rather than going
+			// round the state machine for every bit of the revolution
+			for(;;) {
+				if(search_one_bit(limit))
+					return;
 
-			if(mfm && cur_live.shift_reg == 0x4489) {
-				cur_live.crc = 0x443b;
-				cur_live.data_separator_phase = false;
-				cur_live.bit_counter = 0;
-				cur_live.state = READ_HEADER_BLOCK_HEADER;
-				LOGLIVE("%s: Found A1\n", cur_live.tm.to_string());
-			}
+				LOGSHIFT("%s: shift = %04x data=%02x c=%d\n", cur_live.tm.to_string(), cur_live.shift_reg,
+						(cur_live.shift_reg & 0x4000 ? 0x80 : 0x00) |
+						(cur_live.shift_reg & 0x1000 ? 0x40 : 0x00) |
+						(cur_live.shift_reg & 0x0400 ? 0x20 : 0x00) |
+						(cur_live.shift_reg & 0x0100 ? 0x10 : 0x00) |
+						(cur_live.shift_reg & 0x0040 ? 0x08 : 0x00) |
+						(cur_live.shift_reg & 0x0010 ? 0x04 : 0x00) |
+						(cur_live.shift_reg & 0x0004 ? 0x02 : 0x00) |
+						(cur_live.shift_reg & 0x0001 ? 0x01 : 0x00),
+						cur_live.bit_counter);
+
+				if(mfm && cur_live.shift_reg == 0x4489) {
+					cur_live.crc = 0x443b;
+					cur_live.data_separator_phase = false;
+					cur_live.bit_counter = 0;
+					cur_live.state = READ_HEADER_BLOCK_HEADER;
+					LOGLIVE("%s: Found A1\n", cur_live.tm.to_string());
+					break;
+				}
 
-			if(!mfm && cur_live.shift_reg == 0xf57e) {
-				cur_live.crc = 0xef21;
-				cur_live.data_separator_phase = false;
-				cur_live.bit_counter = 0;
-				cur_live.state = READ_ID_BLOCK;
-				LOGLIVE("%s: Found IDAM\n", cur_live.tm.to_string());
+				if(!mfm && cur_live.shift_reg == 0xf57e) {
+					cur_live.crc = 0xef21;
+					cur_live.data_separator_phase = false;
+					cur_live.bit_counter = 0;
+					cur_live.state = READ_ID_BLOCK;
+					LOGLIVE("%s: Found IDAM\n", cur_live.tm.to_string());
+					break;
+				}
 			}
 			break;
 
@@ -2692,6 +2698,19 @@ bool upd765_family_device::read_one_bit(const attotime &limit)
 	return false;
 }
 
+// Cheaper read_one_bit for mark searches: the CRC is reset when a mark
+// is found and the data register refills before it is next looked at.
+bool upd765_family_device::search_one_bit(const attotime &limit)
+{
+	int bit = cur_live.pll.get_next_bit(cur_live.tm, cur_live.fi->dev, limit);
+	if(bit < 0)
+		return true;
+	cur_live.shift_reg = (cur_live.shift_reg << 1) | bit;
+	cur_live.bit_counter++;
+	cur_live.data_separator_phase = !cur_live.data_separator_phase;
+	return false;
+}
+
 bool upd765_family_device::write_one_bit(const attotime &limit)
 {
 	bool bit = cur_live.shift_reg & 0x8000;
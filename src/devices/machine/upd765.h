@@ -347,6 +347,7 @@ protected:
 	void live_write_mfm(uint8_t mfm);
 
 	bool read_one_bit(const attotime &limit);
+	bool search_one_bit(const attotime &limit);
 	bool write_one_bit(const attotime &limit);
 
 	virtual u8 get_drive_busy() const { return 0; }
@@ -1685,6 +1685,19 @@ bool wd_fdc_device_base::read_one_bit(const attotime &limit)
 	return false;
 }
 
+// Cheaper read_one_bit for mark searches: the data register and CRC
+// are reset when a mark is found, so they aren't updated here.
+bool wd_fdc_device_base::search_one_bit(const attotime &limit)
+{
+	int bit = pll_get_next_bit(cur_live.tm, floppy, limit);
+	if(bit < 0)
+		return true;
+	cur_live.shift_reg = (cur_live.shift_reg << 1) | bit;
+	cur_live.bit_counter++;
+	cur_live.data_separator_phase = !cur_live.data_separator_phase;
+	return false;
+}
+
 void wd_fdc_device_base::reset_data_sync()
 {
 	cur_live.data_separator_phase = false;
@@ -1773,26 +1786,32 @@ void wd_fdc_device_base::live_run(attotime limit)
 		switch(cur_live.state) {
 		case SEARCH_ADDRESS_MARK_HEADER:
 			LOGLIVE("%s - SEARCH_ADDRESS_MARK_HEADER\n", FUNCNAME);
-			if(read_one_bit(limit))
-				return;
+			// stay in here until a mark turns up rather than going
+			// round the state machine for every bit of the revolution
+			for(;;) {
+				if(search_one_bit(limit))
+					return;
 
-			LOGSHIFT("%s: shift = %08x data=%02x c=%d\n", cur_live.tm.to_string(), cur_live.shift_reg,
-					cur_live.shift_reg_data(),
-					cur_live.bit_counter);
+				LOGSHIFT("%s: shift = %08x data=%02x c=%d\n", cur_live.tm.to_string(), cur_live.shift_reg,
+						cur_live.shift_reg_data(),
+						cur_live.bit_counter);
 
-			if(!dden && cur_live.shift_reg_low<16>() == 0x4489) {
-				cur_live.crc = 0x443b;
-				reset_data_sync();
-				cur_live.state = READ_HEADER_BLOCK_HEADER;
-			}
+				if(!dden && cur_live.shift_reg_low<16>() == 0x4489) {
+					cur_live.crc = 0x443b;
+					reset_data_sync();
+					cur_live.state = READ_HEADER_BLOCK_HEADER;
+					break;
+				}
 
-			if(dden && cur_live.shift_reg_low<23>() == 0x2af57e) {
-				cur_live.crc = 0xef21;
-				reset_data_sync();
-				if(main_state == READ_ID)
-					cur_live.state = READ_ID_BLOCK_TO_DMA;
-				else
-					cur_live.state = READ_ID_BLOCK_TO_LOCAL;
+				if(dden && cur_live.shift_reg_low<23>() == 0x2af57e) {
+					cur_live.crc = 0xef21;
+					reset_data_sync();
+					if(main_state == READ_ID)
+						cur_live.state = READ_ID_BLOCK_TO_DMA;
+					else
+						cur_live.state = READ_ID_BLOCK_TO_LOCAL;
+					break;
+				}
 			}
 			break;
 
@@ -361,6 +361,7 @@ private:
 	void live_sync();
 	void live_run(attotime limit = attotime::never);
 	bool read_one_bit(const attotime &limit);
+	bool search_one_bit(const attotime &limit);
 	bool write_one_bit(const attotime &limit);
 	void reset_data_sync();
 	void live_write_raw(uint16_t raw);
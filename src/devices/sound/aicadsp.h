@@ -8,10 +8,20 @@
 //the DSP Context
 struct AICADSP
 {
+	//decoded MPRO step
+	struct STEP
+	{
+		u8 TRA, TWT, TWA;
+		u8 XSEL, YSEL, IRA, IWT, IWA;
+		u8 TABLE, MWT, MRD, EWT, EWA, ADRL, FRCL, SHIFT, YRL, NEGB, ZERO, BSEL;
+		u8 NOFL, COEF, MASA, ADREB, NXADR;
+	};
+
 	void init();
 	void setsample(s32 sample, u8 SEL, s32 MXL);
 	void step();
 	void start();
+	void decode();
 
 //Config
 	memory_access<23, 1, 0, ENDIANNESS_LITTLE>::cache cache;
@@ -37,6 +47,10 @@ struct AICADSP
 
 	bool Stopped;
 	int LastStep;
+
+//decoded program, rebuilt after MPRO changes
+	STEP Program[128];
+	bool dirty;
 };
 
 #endif // MAME_SOUND_AICADSP_H
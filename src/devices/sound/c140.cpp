@@ -119,7 +119,7 @@ void c140_device::device_start()
 
 	m_int1_timer = timer_alloc(FUNC(c140_device::int1_on), this);
 
-	m_stream = stream_alloc(0, 2, m_sample_rate);
+	m_stream = stream_alloc(0, 2, m_sample_rate, STREAM_THREAD_SAFE);
 
 	// make decompress pcm table (Verified from Wii Virtual Console Arcade Starblade)
 	for (int i = 0; i < 256; i++)
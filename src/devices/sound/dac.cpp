@@ -75,7 +75,8 @@ dac_device_base::dac_device_base(const machine_config &mconfig, device_type type
 	m_mapper(mapper),
 	m_gain(gain),
 	m_range_min((bits == 1) ? 0.0 : -1.0),
-	m_range_max(1.0)
+	m_range_max(1.0),
+	m_write_queue_enabled(true)
 {
 }
 
@@ -98,6 +99,61 @@ void dac_device_base::device_start()
 
 	// save data
 	save_item(NAME(m_curval));
+
+	m_write_queue.reserve(WRITE_QUEUE_SIZE);
+}
+
+
+//-------------------------------------------------
+//  device_pre_save - render any queued writes so
+//  that m_curval holds the current value
+//-------------------------------------------------
+
+void dac_device_base::device_pre_save()
+{
+	if (!m_write_queue.empty())
+	{
+		m_stream->update();
+		if (!m_write_queue.empty())
+		{
+			m_curval = m_write_queue.back().second;
+			m_write_queue.clear();
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  device_post_load - drop writes queued on the
+//  timeline that was just replaced
+//-------------------------------------------------
+
+void dac_device_base::device_post_load()
+{
+	m_write_queue.clear();
+}
+
+
+//-------------------------------------------------
+//  queue_value - record a write to be applied at
+//  the current time during the next stream update
+//-------------------------------------------------
+
+void dac_device_base::queue_value(stream_buffer::sample_t value)
+{
+	if (m_write_queue.size() >= WRITE_QUEUE_SIZE)
+	{
+		m_stream->update();
+
+		// anything left falls on the first sample of the next update,
+		// where only the last value matters
+		if (m_write_queue.size() >= WRITE_QUEUE_SIZE)
+		{
+			m_curval = m_write_queue.back().second;
+			m_write_queue.clear();
+		}
+	}
+	m_write_queue.emplace_back(machine().time(), value);
 }
 
 
@@ -108,11 +164,51 @@ void dac_device_base::device_start()
 void dac_device_base::sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
 {
 	auto &out = outputs[0];
+	int const samples = out.samples();
 
+	// apply queued writes from the first sample starting at or after their
+	// time, which is the sample an immediate update would have switched on
+	int start = 0;
+	unsigned consumed = 0;
+	if (!m_write_queue.empty())
+	{
+		attotime const first = out.start_time();
+		attoseconds_t const period = out.sample_period_attoseconds();
+		for ( ; consumed < m_write_queue.size(); consumed++)
+		{
+			auto const &entry = m_write_queue[consumed];
+			int index = 0;
+			if (entry.first > first)
+			{
+				attoseconds_t const delta = (entry.first - first).as_attoseconds();
+				index = int((delta + period - 1) / period);
+			}
+			if (index >= samples)
+				break;
+			if (index > start)
+			{
+				render(out, inputs, start, index);
+				start = index;
+			}
+			m_curval = entry.second;
+		}
+		m_write_queue.erase(m_write_queue.begin(), m_write_queue.begin() + consumed);
+	}
+	render(out, inputs, start, samples);
+}
+
+
+//-------------------------------------------------
+//  render - generate samples [start, end) using
+//  the current value
+//-------------------------------------------------
+
+void dac_device_base::render(write_stream_view &out, std::vector<read_stream_view> const &inputs, int start, int end) const
+{
 	// rails are constant
 	if (inputs.size() == 0)
 	{
-		out.fill(m_range_min + m_curval * (m_range_max - m_range_min));
+		out.fill(m_range_min + m_curval * (m_range_max - m_range_min), start, end - start);
 		return;
 	}
 
@@ -122,21 +218,21 @@ void dac_device_base::sound_stream_update(sound_stream &stream, std::vector<read
 	// constant lo, streaming hi
 	if (!BIT(m_specified_inputs_mask, DAC_INPUT_RANGE_LO))
 	{
-		for (int sampindex = 0; sampindex < out.samples(); sampindex++)
+		for (int sampindex = start; sampindex < end; sampindex++)
 			out.put(sampindex, m_range_min + m_curval * (hi.get(sampindex) - m_range_min));
 	}
 
 	// constant hi, streaming lo
 	else if (!BIT(m_specified_inputs_mask, DAC_INPUT_RANGE_HI))
 	{
-		for (int sampindex = 0; sampindex < out.samples(); sampindex++)
+		for (int sampindex = start; sampindex < end; sampindex++)
 			out.put(sampindex, lo.get(sampindex) + m_curval * (m_range_max - lo.get(sampindex)));
 	}
 
 	// both streams provided
 	else
 	{
-		for (int sampindex = 0; sampindex < out.samples(); sampindex++)
+		for (int sampindex = start; sampindex < end; sampindex++)
 			out.put(sampindex, lo.get(sampindex) + m_curval * (hi.get(sampindex) - lo.get(sampindex)));
 	}
 }
@@ -18,6 +18,8 @@
 #pragma once
 
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 
 //**************************************************************************
@@ -86,6 +88,8 @@ protected:
 
 	// device startup
 	virtual void device_start() override;
+	virtual void device_pre_save() override;
+	virtual void device_post_load() override;
 
 	// stream generation
 	virtual void sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs) override;
@@ -93,8 +97,14 @@ protected:
 	// set the current value
 	void set_value(u32 value)
 	{
-		m_stream->update();
-		m_curval = m_value_map[value & (m_value_map.size() - 1)];
+		stream_buffer::sample_t const newval = m_value_map[value & (m_value_map.size() - 1)];
+		if (m_write_queue_enabled)
+			queue_value(newval);
+		else
+		{
+			m_stream->update();
+			m_curval = newval;
+		}
 	}
 
 public:
@@ -108,7 +118,19 @@ public:
 	}
 	dac_device_base &set_output_range(stream_buffer::sample_t vref) { return set_output_range(-vref, vref); }
 
+	// configuration: by default writes are timestamped and applied during the
+	// next stream update, landing on the same sample as an immediate update
+	// would; disabling this updates the stream on every write instead
+	dac_device_base &set_write_queue(bool enable) { m_write_queue_enabled = enable; return *this; }
+
 private:
+	// number of queued writes that forces a stream update
+	static constexpr unsigned WRITE_QUEUE_SIZE = 1024;
+
+	// internal helpers
+	void queue_value(stream_buffer::sample_t value);
+	void render(write_stream_view &out, std::vector<read_stream_view> const &inputs, int start, int end) const;
+
 	// internal state
 	sound_stream *m_stream;
 	stream_buffer::sample_t m_curval;
@@ -120,6 +142,10 @@ private:
 	stream_buffer::sample_t const m_gain;
 	stream_buffer::sample_t m_range_min;
 	stream_buffer::sample_t m_range_max;
+	bool m_write_queue_enabled;
+
+	// writes not yet rendered, in time order
+	std::vector<std::pair<attotime, stream_buffer::sample_t>> m_write_queue;
 };
 
 
@@ -83,6 +83,18 @@ static constexpr int MAX_SAMPLES_PER_TASK_SLICE = 960 / 4;
 
 #define USE_DISCRETE_TASKS          (1)
 
+/*
+ * Systems that don't define tasks have their running order split
+ * into up to AUTO_TASK_MAX_STAGES pipelined tasks of at least
+ * AUTO_TASK_MIN_NODES nodes each.  A split is only made where no
+ * feedback or node_output_ptr reference crosses it, so every node
+ * sees exactly the values it would when run in a single task.
+ */
+
+#define USE_AUTO_TASKS              (1)
+static constexpr int AUTO_TASK_MAX_STAGES = 4;
+static constexpr int AUTO_TASK_MIN_NODES = 16;
+
 /*************************************
  *
  *  Internal classes
@@ -124,6 +136,7 @@ public:
 
 	void check(discrete_task &dest_task);
 	void prepare_for_queue(int samples);
+	void reserve_links(size_t count) { source_list.reserve(count); m_buffers.reserve(count); }
 
 	static void *task_callback(void *param, int threadid);
 
@@ -285,9 +298,8 @@ void discrete_task::prepare_for_queue(int samples)
 
 void discrete_task::check(discrete_task &dest_task)
 {
-	// FIXME: this function takes addresses of elements of a vector that has items added later
-	// 16 is enough for the systems in MAME, but the code should be fixed properly
-	m_buffers.reserve(16);
+	// this function takes addresses of elements of vectors that have items added later;
+	// link_tasks reserves enough space in both for every possible link up front
 
 	/* Determine, which nodes in the task are referenced by nodes in dest_task
 	 * and add them to the list of nodes to be buffered for further processing
@@ -454,6 +466,9 @@ const double *discrete_device::node_output_ptr(int onode)
 
 	if (node != nullptr)
 	{
+		// remember who holds direct references, as they can't be split across tasks
+		if (m_tracking_node)
+			m_hidden_refs.emplace_back(m_tracking_node, onode);
 		return &(node->m_output[NODE_CHILD_NODE_NUM(onode)]);
 	}
 	else
@@ -782,8 +797,123 @@ void discrete_device::init_nodes(const sound_block_list_t &block_list)
 		node.save_state();
 	}
 
+	// split the single task once the resets have shown which nodes hold direct references
 	if (!has_tasks)
+		m_split_pending = USE_DISCRETE_TASKS && USE_AUTO_TASKS;
+}
+
+
+/*************************************
+ *
+ *  Automatic task splitting
+ *
+ *************************************/
+
+void discrete_device::split_tasks()
+{
+	node_step_list_t const steps = std::move(task_list[0]->step_list);
+	int const count = steps.size();
+	int const stages = std::min(AUTO_TASK_MAX_STAGES, count / AUTO_TASK_MIN_NODES);
+	task_list[0]->step_list = steps;
+	if (stages < 2)
+		return;
+
+	// find each stepping node's position in the running order
+	std::map<int, int> position;
+	for (int pos = 0; pos < count; pos++)
+		position[NODE_DEFAULT_NODE(steps[pos]->self->block_node())] = pos;
+
+	// mark every span of the running order that has to stay in one task:
+	// feedback from a later node, and direct references in either direction
+	std::vector<int> spans(count + 1, 0);
+	auto const keep_together = [&spans] (int first, int last)
+	{
+		if (first > last)
+			std::swap(first, last);
+		spans[first + 1]++;
+		spans[last + 1]--;
+	};
+	for (int pos = 0; pos < count; pos++)
+	{
+		discrete_base_node &node = *steps[pos]->self;
+		for (int inputnum = 0; inputnum < node.active_inputs(); inputnum++)
+		{
+			int const inputnode = node.input_node(inputnum);
+			if (IS_VALUE_A_NODE(inputnode))
+			{
+				auto const found = position.find(NODE_DEFAULT_NODE(inputnode));
+				if (found != position.end() && found->second > pos)
+					keep_together(pos, found->second);
+			}
+		}
+	}
+	for (auto const &ref : m_hidden_refs)
+	{
+		auto const holder = position.find(NODE_DEFAULT_NODE(ref.first->block_node()));
+		auto const target = position.find(NODE_DEFAULT_NODE(ref.second));
+		if (holder != position.end() && target != position.end())
+			keep_together(holder->second, target->second);
+	}
+
+	// a split before position pos is allowed if no span covers it
+	std::vector<bool> allowed(count, false);
+	for (int pos = 1, depth = spans[0] + spans[1]; pos < count; depth += spans[++pos])
+		allowed[pos] = (depth == 0);
+
+	// pick the allowed split nearest to each evenly spaced target
+	std::vector<int> splits;
+	int const window = count / stages / 2;
+	for (int stage = 1; stage < stages; stage++)
+	{
+		int const target = stage * count / stages;
+		int const floor = splits.empty() ? 0 : splits.back();
+		for (int offset = 0; offset <= window; offset++)
+		{
+			if (target - offset > floor + AUTO_TASK_MIN_NODES - 1 && allowed[target - offset])
+			{
+				splits.push_back(target - offset);
+				break;
+			}
+			if (target + offset < count - AUTO_TASK_MIN_NODES + 1 && allowed[target + offset])
+			{
+				splits.push_back(target + offset);
+				break;
+			}
+		}
+	}
+	if (splits.empty())
+		return;
+
+	// move each range into its own task; later groups consume earlier ones
+	splits.push_back(count);
+	task_list[0]->step_list.assign(steps.begin(), steps.begin() + splits[0]);
+	for (int index = 1; index < splits.size(); index++)
 	{
+		task_list.push_back(std::make_unique<discrete_task>(*this));
+		discrete_task &task = *task_list.back();
+		task.task_group = index;
+		task.step_list.assign(steps.begin() + splits[index - 1], steps.begin() + splits[index]);
+	}
+	discrete_log("split_tasks - %d nodes split into %d tasks", count, int(task_list.size()));
+}
+
+
+void discrete_device::link_tasks()
+{
+	// reserve room for every link so pointers into the lists stay valid
+	size_t links = 0;
+	for (const auto &node : m_node_list)
+		links += node->active_inputs();
+	for (const auto &task : task_list)
+		task->reserve_links(links);
+
+	for (const auto &task : task_list)
+	{
+		for (const auto &dest_task : task_list)
+		{
+			if (task->task_group > dest_task->task_group)
+				dest_task->check(*task);
+		}
 	}
 }
 
@@ -825,6 +955,8 @@ discrete_device::discrete_device(const machine_config &mconfig, device_type type
 		m_sample_time(0),
 		m_neg_sample_time(0),
 		m_indexed_node(nullptr),
+		m_split_pending(false),
+		m_tracking_node(nullptr),
 		m_disclogfile(nullptr),
 		m_queue(nullptr),
 		m_profiling(0),
@@ -898,7 +1030,7 @@ void discrete_device::device_start()
 	}
 
 	/* allocate a queue */
-	m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ | WORK_QUEUE_FLAG_STEAL);
 
 	/* Process nodes which have a start func */
 	for (const auto &node : m_node_list)
@@ -906,15 +1038,9 @@ void discrete_device::device_start()
 		node->start();
 	}
 
-	/* Now set up tasks */
-	for (const auto &task : task_list)
-	{
-		for (const auto &dest_task : task_list)
-		{
-			if (task->task_group > dest_task->task_group)
-				dest_task->check(*task);
-		}
-	}
+	/* Now set up tasks, unless they are still to be split */
+	if (!m_split_pending)
+		link_tasks();
 }
 
 void discrete_device::device_stop()
@@ -1002,8 +1128,24 @@ void discrete_device::device_reset()
 		/* Fimxe : node_level */
 		node->m_output[0] = 0;
 
+		m_tracking_node = m_split_pending ? node.get() : nullptr;
 		node->reset();
 	}
+	m_tracking_node = nullptr;
+
+	/* on the first reset, split into tasks and reset again so nothing holds stale input pointers */
+	if (m_split_pending)
+	{
+		m_split_pending = false;
+		split_tasks();
+		link_tasks();
+		m_hidden_refs.clear();
+		for (const auto &node : m_node_list)
+		{
+			node->m_output[0] = 0;
+			node->reset();
+		}
+	}
 }
 
 void discrete_sound_device::device_reset()
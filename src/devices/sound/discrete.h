@@ -4254,6 +4254,8 @@ private:
 	void discrete_sanity_check(const sound_block_list_t &block_list);
 	void display_profiling();
 	void init_nodes(const sound_block_list_t &block_list);
+	void split_tasks();
+	void link_tasks();
 
 	/* internal node tracking */
 	std::unique_ptr<discrete_base_node * []>   m_indexed_node;
@@ -4261,6 +4263,11 @@ private:
 	/* tasks */
 	task_list_t             task_list;      /* discrete_task_context * */
 
+	/* automatic task splitting for systems that don't define tasks */
+	bool                    m_split_pending;
+	discrete_base_node *    m_tracking_node;    /* node whose reset is being tracked */
+	std::vector<std::pair<discrete_base_node *, int> > m_hidden_refs; /* node outputs fetched with node_output_ptr */
+
 	/* debugging statistics */
 	FILE *                  m_disclogfile;
 
@@ -434,12 +434,29 @@ void filter_biquad_device::sound_stream_update(sound_stream &stream, std::vector
 		m_last_sample_rate = m_stream->sample_rate();
 	}
 
-	for (int sampindex = 0; sampindex < dst.samples(); sampindex++)
+	// run the filter on local copies of the state so it stays in registers
+	stream_buffer::sample_t const gain = src.gain();
+	stream_buffer::sample_t input = m_input, output = m_output;
+	double w0 = m_w0, w1 = m_w1, w2 = m_w2;
+	double const a1 = m_a1, a2 = m_a2, b0 = m_b0, b1 = m_b1, b2 = m_b2;
+	dst.process(src, [&] (stream_buffer::sample_t *out, stream_buffer::sample_t const *in, s32 count)
 	{
-		m_input = src.get(sampindex);
-		step();
-		dst.put(sampindex, m_output);
-	}
+		for (s32 sampindex = 0; sampindex < count; sampindex++)
+		{
+			// same as step()
+			input = in[sampindex] * gain;
+			w2 = w1;
+			w1 = w0;
+			w0 = (-a1 * w1) + (-a2 * w2) + input;
+			output = (b0 * w0) + (b1 * w1) + (b2 * w2);
+			out[sampindex] = output;
+		}
+	});
+	m_input = input;
+	m_output = output;
+	m_w0 = w0;
+	m_w1 = w1;
+	m_w2 = w2;
 }
 
 
@@ -67,23 +67,32 @@ void filter_rc_device::sound_stream_update(sound_stream &stream, std::vector<rea
 		m_last_sample_rate = m_stream->sample_rate();
 	}
 
+	stream_buffer::sample_t const gain = src.gain();
+	stream_buffer::sample_t const k = m_k;
 	switch (m_type)
 	{
 		case LOWPASS_3R:
 		case LOWPASS:
-			for (int sampindex = 0; sampindex < dst.samples(); sampindex++)
+			dst.process(src, [&memory, gain, k] (stream_buffer::sample_t *out, stream_buffer::sample_t const *in, s32 count)
 			{
-				memory += (src.get(sampindex) - memory) * m_k;
-				dst.put(sampindex, memory);
-			}
+				for (s32 sampindex = 0; sampindex < count; sampindex++)
+				{
+					memory += (in[sampindex] * gain - memory) * k;
+					out[sampindex] = memory;
+				}
+			});
 			break;
 		case HIGHPASS:
 		case AC:
-			for (int sampindex = 0; sampindex < dst.samples(); sampindex++)
+			dst.process(src, [&memory, gain, k] (stream_buffer::sample_t *out, stream_buffer::sample_t const *in, s32 count)
 			{
-				dst.put(sampindex, src.get(sampindex) - memory);
-				memory += (src.get(sampindex) - memory) * m_k;
-			}
+				for (s32 sampindex = 0; sampindex < count; sampindex++)
+				{
+					stream_buffer::sample_t const sample = in[sampindex] * gain;
+					out[sampindex] = sample - memory;
+					memory += (sample - memory) * k;
+				}
+			});
 			break;
 	}
 	m_memory = memory;
@@ -37,8 +37,7 @@ void filter_volume_device::device_start()
 
 void filter_volume_device::sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
 {
-	for (int i = 0; i < outputs[0].samples(); i++)
-		outputs[0].put(i, inputs[0].get(i) * m_gain);
+	outputs[0].copy(read_stream_view(inputs[0]).apply_gain(m_gain));
 }
 
 
@@ -118,7 +118,7 @@ void okim6295_device::device_start()
 
 	// create the stream
 	int divisor = m_pin7_state ? 132 : 165;
-	m_stream = stream_alloc(0, 1, clock() / divisor);
+	m_stream = stream_alloc(0, 1, clock() / divisor, STREAM_THREAD_SAFE);
 
 	save_item(NAME(m_command));
 	save_item(NAME(m_pin7_state));
@@ -177,6 +177,13 @@ void okim6295_device::device_clock_changed()
 
 void okim6295_device::sound_stream_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs)
 {
+	// nothing to generate if all voices are idle
+	if (std::none_of(std::begin(m_voice), std::end(m_voice), [] (okim_voice const &voice) { return voice.m_playing; }))
+	{
+		outputs[0].silence();
+		return;
+	}
+
 	// reset the output stream
 	outputs[0].fill(0);
 
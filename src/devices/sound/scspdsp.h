@@ -8,6 +8,15 @@
 //the DSP Context
 struct SCSPDSP
 {
+	//decoded MPRO step
+	struct STEP
+	{
+		u8 TRA, TWT, TWA;
+		u8 XSEL, YSEL, IRA, IWT, IWA;
+		u8 TABLE, MWT, MRD, EWT, EWA, ADRL, FRCL, SHIFT, YRL, NEGB, ZERO, BSEL;
+		u8 NOFL, COEF, MASA, ADREB, NXADR;
+	};
+
 //Config
 	address_space *space;
 	u32 RBP; //Ring buf pointer
@@ -32,10 +41,15 @@ struct SCSPDSP
 	bool Stopped;
 	int LastStep;
 
+//decoded program, rebuilt after MPRO changes
+	STEP Program[128];
+	bool Dirty;
+
 	void Init();
 	void SetSample(s32 sample, s32 SEL, s32 MXL);
 	void Step();
 	void Start();
+	void Decode();
 };
 
 #endif // MAME_SOUND_SCSPDSP_H
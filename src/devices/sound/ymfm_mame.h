@@ -268,11 +268,19 @@ protected:
 		{
 			int cursamples = std::min(numsamples - sampindex, MAX_SAMPLES);
 			m_chip.generate(output, cursamples);
+
+			// convert each output straight into the contiguous runs of its buffer
 			for (int outnum = 0; outnum < outcount; outnum++)
 			{
-				int eff_outnum = (outnum + output_shift) % OUTPUTS;
-				for (int index = 0; index < cursamples; index++)
-					outputs[eff_outnum].put_int(sampindex + index, output[index].data[outnum], 32768);
+				auto &view = outputs[(outnum + output_shift) % OUTPUTS];
+				for (int index = 0; index < cursamples; )
+				{
+					s32 run = cursamples - index;
+					stream_buffer::sample_t *const dest = view.segment(sampindex + index, run);
+					for (s32 runindex = 0; runindex < run; runindex++)
+						dest[runindex] = stream_buffer::sample_t(output[index + runindex].data[outnum]) * (1.0f / 32768.0f);
+					index += run;
+				}
 			}
 		}
 	}
@@ -1599,55 +1599,33 @@ void sega315_5313_device::get_nametable(gfx_element *tile_gfx, u16 tile_base, na
 
 inline void sega315_5313_device::draw_tile(nametable_t tile, int start, int end, int &dpos, bool is_fg)
 {
-	if (!tile.xflip)
+	/* the priority and layer only change per tile, so pick the pixel loop once up front */
+	const int step = tile.xflip ? -1 : 1;
+	const int colour = tile.colour << 4;
+	int shift = tile.xflip ? (tile.gfx->width() - start - 1) : start;
+
+	if (!tile.pri)
 	{
-		/* 8 pixels */
-		for (int shift = start; shift < end; shift++)
+		for (int count = start; count < end; count++, shift += step, dpos++)
 		{
 			const u8 dat = tile.addr[shift];
-			if (!tile.pri)
-			{
-				if (dat) m_video_renderline[dpos] = dat | (tile.colour << 4);
-			}
-			else
-			{
-				if (is_fg)
-				{
-					if (dat) m_highpri_renderline[dpos] = dat | (tile.colour << 4) | 0x80;
-					else m_highpri_renderline[dpos] = m_highpri_renderline[dpos] | 0x80;
-				}
-				else
-				{
-					m_highpri_renderline[dpos] = dat | (tile.colour << 4) | 0x80;
-				}
-			}
-			dpos++;
+			if (dat) m_video_renderline[dpos] = dat | colour;
 		}
 	}
-	else
+	else if (is_fg)
 	{
-		for (int tmp = tile.gfx->width() - start - 1, shift = start; shift < end; tmp--, shift++)
+		for (int count = start; count < end; count++, shift += step, dpos++)
 		{
-			const u8 dat = tile.addr[tmp];
-			if (!tile.pri)
-			{
-				if (dat) m_video_renderline[dpos] = dat | (tile.colour << 4);
-			}
-			else
-			{
-				if (is_fg)
-				{
-					if (dat) m_highpri_renderline[dpos] = dat | (tile.colour << 4) | 0x80;
-					else m_highpri_renderline[dpos] = m_highpri_renderline[dpos] | 0x80;
-				}
-				else
-				{
-					m_highpri_renderline[dpos] = dat | (tile.colour << 4) | 0x80;
-				}
-			}
-			dpos++;
+			const u8 dat = tile.addr[shift];
+			if (dat) m_highpri_renderline[dpos] = dat | colour | 0x80;
+			else m_highpri_renderline[dpos] = m_highpri_renderline[dpos] | 0x80;
 		}
 	}
+	else
+	{
+		for (int count = start; count < end; count++, shift += step, dpos++)
+			m_highpri_renderline[dpos] = tile.addr[shift] | colour | 0x80;
+	}
 }
 
 /* Clean up this function (!) */
@@ -1994,109 +1972,89 @@ void sega315_5313_device::render_videoline_to_videobuffer(int scanline)
 		/* END */
 
 /* MEGADRIVE_REG0C_SHADOW_HIGLIGHT */
-	/* Low Priority Sprites */
-	for (int x = 0; x < horz; x++)
+	/* Low priority sprites, then high priority A+B tiles, then high priority sprites; each
+	   pixel only depends on its own column, so all three layers are combined in one pass */
+	if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
 	{
-		if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
+		for (int x = 0; x < horz; x++)
 		{
-			if (m_sprite_renderline[x + 128] & 0x40)
-			{
-				m_video_renderline[x] = m_sprite_renderline[x + 128] & 0x3f;
-				m_video_renderline[x] |= 0x10000; // mark as sprite pixel
-			}
+			const u8 spritedat = m_sprite_renderline[x + 128];
+			const u8 highpridat = m_highpri_renderline[x];
+			u32 dat = m_video_renderline[x];
+
+			if (spritedat & 0x40)
+				dat = (spritedat & 0x3f) | 0x10000; // mark as sprite pixel
+
+			if ((highpridat & 0x80) && (highpridat & 0x0f))
+				dat = highpridat & 0x3f;
+
+			if (spritedat & 0x80)
+				dat = (spritedat & 0x3f) | 0x10000; // mark as sprite pixel
+
+			m_video_renderline[x] = dat;
 		}
-		else
+	}
+	else
+	{
+		/* Special Shadow / Highlight processing */
+		for (int x = 0; x < horz; x++)
 		{
-			/* Special Shadow / Highlight processing */
-			if (m_sprite_renderline[x + 128] & 0x40)
+			const u8 spritedat = m_sprite_renderline[x + 128];
+			const u8 highpridat = m_highpri_renderline[x];
+			u32 dat = m_video_renderline[x];
+
+			if (spritedat & 0x40)
 			{
-				const u8 spritedata = m_sprite_renderline[x + 128] & 0x3f;
+				const u8 spritedata = spritedat & 0x3f;
 
 				if ((spritedata == 0x0e) || (spritedata == 0x1e) || (spritedata == 0x2e))
 				{
 					/* BUG in sprite chip, these colours are always normal intensity */
-					m_video_renderline[x] = spritedata | 0x4000;
-					m_video_renderline[x] |= 0x10000; // mark as sprite pixel
+					dat = spritedata | 0x4000 | 0x10000; // mark as sprite pixel
 				}
 				else if (spritedata == 0x3e)
 				{
 					/* Everything below this is half colour, mark with 0x8000 to mark highlight' */
-					m_video_renderline[x] = m_video_renderline[x] | 0x8000; // spiderwebs..
+					dat |= 0x8000; // spiderwebs..
 				}
 				else if (spritedata == 0x3f)
 				{
 					/* This is a Shadow operator, but everything below is already low pri, no effect */
-					m_video_renderline[x] = m_video_renderline[x] | 0x2000;
+					dat |= 0x2000;
 				}
 				else
 				{
-					m_video_renderline[x] = spritedata;
-					m_video_renderline[x] |= 0x10000; // mark as sprite pixel
+					dat = spritedata | 0x10000; // mark as sprite pixel
 				}
 			}
-		}
-	}
-
-	/* High Priority A+B Tiles */
-	for (int x = 0; x < horz; x++)
-	{
-		if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
-		{
-			/* Normal Processing */
-			const int dat = m_highpri_renderline[x];
-
-			if (dat & 0x80)
-			{
-				if (dat & 0x0f) m_video_renderline[x] = m_highpri_renderline[x] & 0x3f;
-			}
-		}
-		else
-		{
-			/* Shadow / Highlight Mode */
-			const int dat = m_highpri_renderline[x];
 
-			if (dat & 0x80)
+			if (highpridat & 0x80)
 			{
-				if (dat & 0x0f) m_video_renderline[x] = (m_highpri_renderline[x] & 0x3f) | 0x4000;
-				else m_video_renderline[x] = m_video_renderline[x] | 0x4000; // set 'normal'
+				if (highpridat & 0x0f) dat = (highpridat & 0x3f) | 0x4000;
+				else dat |= 0x4000; // set 'normal'
 			}
-		}
-	}
 
-	/* High Priority Sprites */
-	for (int x = 0; x < horz; x++)
-	{
-		if (!MEGADRIVE_REG0C_SHADOW_HIGLIGHT)
-		{
-			/* Normal */
-			if (m_sprite_renderline[x + 128] & 0x80)
-			{
-				m_video_renderline[x] = m_sprite_renderline[x + 128] & 0x3f;
-				m_video_renderline[x] |= 0x10000; // mark as sprite pixel
-			}
-		}
-		else
-		{
-			if (m_sprite_renderline[x + 128] & 0x80)
+			if (spritedat & 0x80)
 			{
-				const u8 spritedata = m_sprite_renderline[x + 128] & 0x3f;
+				const u8 spritedata = spritedat & 0x3f;
 
 				if (spritedata == 0x3e)
 				{
 					/* set flag 0x8000 to indicate highlight */
-					m_video_renderline[x] = m_video_renderline[x] | 0x8000;
+					dat |= 0x8000;
 				}
 				else if (spritedata == 0x3f)
 				{
 					/* This is a Shadow operator set shadow bit */
-					m_video_renderline[x] = m_video_renderline[x] | 0x2000;
+					dat |= 0x2000;
 				}
 				else
 				{
-					m_video_renderline[x] = spritedata | 0x4000;
-					m_video_renderline[x] |= 0x10000; // mark as sprite pixel
+					dat = spritedata | 0x4000 | 0x10000; // mark as sprite pixel
 				}
 			}
+
+			m_video_renderline[x] = dat;
 		}
 	}
 }
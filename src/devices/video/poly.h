@@ -471,7 +471,7 @@ poly_manager<BaseType, ObjectType, MaxParams, Flags>::poly_manager(running_machi
 {
 	// create the work queue
 	if (!(Flags & POLY_FLAG_NO_WORK_QUEUE))
-		m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+		m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ | WORK_QUEUE_FLAG_STEAL);
 
 	// initialize the buckets to empty
 	std::fill_n(&m_unit_bucket[0], std::size(m_unit_bucket), 0xffffffff);
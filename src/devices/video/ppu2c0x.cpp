@@ -605,15 +605,21 @@ void ppu2c0x_device::draw_tile(uint8_t* line_priority, int color_byte, int color
 
 	read_tile_plane_data(address, color);
 
+	// a tile can only use four pens, and palette RAM and the emphasis bits can't
+	// change part way through it, so resolve them once rather than per pixel
+	uint32_t pens[4];
+	pens[0] = m_nespens[apply_grayscale_and_emphasis(back_pen)];
+	for (int pix = 1; pix < 4; pix++)
+		pens[pix] = m_nespens[apply_grayscale_and_emphasis(m_palette_ram[((4 * color) + pix) & 0x1f])];
+
 	/* render the pixel */
 	for (int i = 0; i < 8; i++)
 	{
-		uint8_t pix;
-		shift_tile_plane_data(pix);
+		const uint8_t pix = BIT(m_planebuf[0], 7 - i) | (BIT(m_planebuf[1], 7 - i) << 1);
 
 		if ((start_x + i) >= 0 && (start_x + i) < VISIBLE_SCREEN_WIDTH)
 		{
-			draw_tile_pixel(pix, color, back_pen, dest);
+			*dest = pens[pix];
 
 			// priority marking
 			if (pix)
@@ -552,6 +552,30 @@ void ppu_vt03_device::draw_tile_pixel(uint8_t pix, int color, uint32_t back_pen,
 	}
 }
 
+void ppu_vt03_device::draw_tile(uint8_t* line_priority, int color_byte, int color_bits, int address, int start_x, uint32_t back_pen, uint32_t*& dest)
+{
+	int color = (color_byte >> color_bits) & 0x03;
+
+	read_tile_plane_data(address, color);
+
+	// extended modes can have more than four pens per tile, so go through the per-pixel hooks
+	for (int i = 0; i < 8; i++)
+	{
+		uint8_t pix;
+		shift_tile_plane_data(pix);
+
+		if ((start_x + i) >= 0 && (start_x + i) < VISIBLE_SCREEN_WIDTH)
+		{
+			draw_tile_pixel(pix, color, back_pen, dest);
+
+			// priority marking
+			if (pix)
+				line_priority[start_x + i] |= 0x02;
+		}
+		dest++;
+	}
+}
+
 void ppu_vt03_device::read_extra_sprite_bits(int sprite_index)
 {
 	m_extra_sprite_bits = (m_spriteram[sprite_index + 2] & 0x1c) >> 2;
@@ -46,6 +46,7 @@ public:
 	virtual void read_tile_plane_data(int address, int color) override;
 	virtual void shift_tile_plane_data(uint8_t &pix) override;
 	virtual void draw_tile_pixel(uint8_t pix, int color, uint32_t back_pen, uint32_t *&dest) override;
+	virtual void draw_tile(uint8_t *line_priority, int color_byte, int color_bits, int address, int start_x, uint32_t back_pen, uint32_t *&dest) override;
 	inline void draw_tile_pixel_inner(uint8_t pen, uint32_t *dest);
 	virtual void draw_back_pen(uint32_t* dst, int back_pen) override;
 
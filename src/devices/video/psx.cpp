@@ -46,6 +46,7 @@ psxgpu_device::psxgpu_device(const machine_config &mconfig, device_type type, co
 	: device_t(mconfig, type, tag, owner, clock)
 	, device_video_interface(mconfig, *this)
 	, device_palette_interface(mconfig, *this)
+	, m_polyqueue(nullptr)
 	, m_vblank_handler(*this)
 {
 }
@@ -67,13 +68,29 @@ void psxgpu_device::device_start()
 	{
 		psx_gpu_init( 2 );
 	}
+
+	m_polywork = std::make_unique<polygon_work[]>( POLYGON_QUEUE_SIZE );
+	m_polyqueue = osd_work_queue_alloc( WORK_QUEUE_FLAG_HIGH_FREQ );
+	m_n_polyhead = 0;
+	m_n_polytail = 0;
 }
 
 void psxgpu_device::device_reset()
 {
+	wait_polygons();
 	gpu_reset();
 }
 
+void psxgpu_device::device_stop()
+{
+	wait_polygons();
+	if( m_polyqueue )
+	{
+		osd_work_queue_free( m_polyqueue );
+		m_polyqueue = nullptr;
+	}
+}
+
 cxd8514q_device::cxd8514q_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock, uint32_t vram_size, psxcpu_device *cpu)
 	: psxgpu_device(mconfig, CXD8514Q, tag, owner, clock, vram_size, cpu)
 {
@@ -637,8 +654,14 @@ void psxgpu_device::psx_gpu_init( int n_gputype )
 	save_item(NAME(m_check_stp));
 }
 
+void psxgpu_device::device_pre_save()
+{
+	wait_polygons();
+}
+
 void psxgpu_device::device_post_load()
 {
+	wait_polygons();
 	updatevisiblearea();
 }
 
@@ -674,6 +697,9 @@ uint32_t psxgpu_device::update_screen(screen_device &screen, bitmap_rgb32 &bitma
 	}
 	else
 	{
+		/* polygons still being drawn into another buffer can carry on */
+		wait_for_vram( rectangle( 0, -1, 0, -1 ), vram_rect( 0, n_displaystarty, 1024, n_screenheight ) );
+
 		if( b_reverseflag )
 		{
 			n_displaystartx = ( 1023 - m_n_displaystartx );
@@ -800,9 +826,9 @@ uint32_t psxgpu_device::update_screen(screen_device &screen, bitmap_rgb32 &bitma
 
 #define WRITE_PIXEL( p ) \
 	{ \
-		if( !m_check_stp || ( *( p_vram ) & 0x8000 ) == 0 ) \
+		if( !s.m_check_stp || ( *( p_vram ) & 0x8000 ) == 0 ) \
 		{ \
-			if( m_draw_stp ) \
+			if( s.m_draw_stp ) \
 				*( p_vram ) = ( p ) | 0x8000; \
 			else \
 				*( p_vram ) = p; \
@@ -872,7 +898,7 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 
 #define SPRITESETUP \
 	int n_dv; \
-	if( n_iy != 0 ) \
+	if( s.n_iy != 0 ) \
 	{ \
 		n_dv = -1; \
 	} \
@@ -881,7 +907,7 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 		n_dv = 1; \
 	} \
 	int n_du; \
-	if( n_ix != 0 ) \
+	if( s.n_ix != 0 ) \
 	{ \
 		n_du = -1; \
 	} \
@@ -902,7 +928,7 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 	switch( n_cmd & 0x02 ) \
 	{ \
 	case 0x02: \
-		switch( n_abr ) \
+		switch( s.n_abr ) \
 		{ \
 		case 0x00: \
 			p_n_f = p_n_f05; \
@@ -952,22 +978,22 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 	TRANSPARENCYSETUP
 
 #define TEXTURESETUP \
-	int n_tx = m_n_tx; \
-	int n_ty = m_n_ty; \
+	int n_tx = s.m_n_tx; \
+	int n_ty = s.m_n_ty; \
 	uint16_t *p_clut = p_p_vram[ n_cluty ] + n_clutx; \
-	switch( n_tp ) \
+	switch( s.n_tp ) \
 	{ \
 	case 0: \
-		n_tx += n_twx >> 2; \
-		n_ty += n_twy; \
+		n_tx += s.n_twx >> 2; \
+		n_ty += s.n_twy; \
 		break; \
 	case 1: \
-		n_tx += n_twx >> 1; \
-		n_ty += n_twy; \
+		n_tx += s.n_twx >> 1; \
+		n_ty += s.n_twy; \
 		break; \
 	case 2: \
-		n_tx += n_twx >> 0; \
-		n_ty += n_twy; \
+		n_tx += s.n_twx >> 0; \
+		n_ty += s.n_twy; \
 		break; \
 	} \
 	TRANSPARENCYSETUP
@@ -980,9 +1006,9 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 	n_b.d += n_db;
 
 #define SOLIDFILL( PIXELUPDATE ) \
-	if( n_distance > ( (int32_t)n_drawarea_x2 - drawx ) + 1 ) \
+	if( n_distance > ( (int32_t)s.n_drawarea_x2 - drawx ) + 1 ) \
 	{ \
-		n_distance = ( n_drawarea_x2 - drawx ) + 1; \
+		n_distance = ( s.n_drawarea_x2 - drawx ) + 1; \
 	} \
 	uint16_t *p_vram = p_p_vram[ drawy ] + drawx; \
 	\
@@ -1048,9 +1074,9 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 	TEXTURE_LOOP \
 		uint16_t n_bgr = *( p_p_vram[ n_ty + TXV ] + n_tx + TXU );
 
-#define TEXTUREWINDOW4BIT( TXV, TXU ) TEXTURE4BIT( ( TXV & n_twh ), ( TXU & n_tww ) )
-#define TEXTUREWINDOW8BIT( TXV, TXU ) TEXTURE8BIT( ( TXV & n_twh ), ( TXU & n_tww ) )
-#define TEXTUREWINDOW15BIT( TXV, TXU ) TEXTURE15BIT( ( TXV & n_twh ), ( TXU & n_tww ) )
+#define TEXTUREWINDOW4BIT( TXV, TXU ) TEXTURE4BIT( ( TXV & s.n_twh ), ( TXU & s.n_tww ) )
+#define TEXTUREWINDOW8BIT( TXV, TXU ) TEXTURE8BIT( ( TXV & s.n_twh ), ( TXU & s.n_tww ) )
+#define TEXTUREWINDOW15BIT( TXV, TXU ) TEXTURE15BIT( ( TXV & s.n_twh ), ( TXU & s.n_tww ) )
 
 #define TEXTUREINTERLEAVED4BIT( TXV, TXU ) \
 	TEXTURE_LOOP \
@@ -1070,9 +1096,9 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 		int n_yi = TXV; \
 		uint16_t n_bgr = *( p_p_vram[ n_ty + n_yi ] + n_tx + n_xi );
 
-#define TEXTUREWINDOWINTERLEAVED4BIT( TXV, TXU ) TEXTUREINTERLEAVED4BIT( ( TXV & n_twh ), ( TXU & n_tww ) )
-#define TEXTUREWINDOWINTERLEAVED8BIT( TXV, TXU ) TEXTUREINTERLEAVED8BIT( ( TXV & n_twh ), ( TXU & n_tww ) )
-#define TEXTUREWINDOWINTERLEAVED15BIT( TXV, TXU ) TEXTUREINTERLEAVED15BIT( ( TXV & n_twh ), ( TXU & n_tww ) )
+#define TEXTUREWINDOWINTERLEAVED4BIT( TXV, TXU ) TEXTUREINTERLEAVED4BIT( ( TXV & s.n_twh ), ( TXU & s.n_tww ) )
+#define TEXTUREWINDOWINTERLEAVED8BIT( TXV, TXU ) TEXTUREINTERLEAVED8BIT( ( TXV & s.n_twh ), ( TXU & s.n_tww ) )
+#define TEXTUREWINDOWINTERLEAVED15BIT( TXV, TXU ) TEXTUREINTERLEAVED15BIT( ( TXV & s.n_twh ), ( TXU & s.n_tww ) )
 
 #define SHADEDPIXEL( PIXELUPDATE ) \
 		if( n_bgr != 0 ) \
@@ -1113,26 +1139,26 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 	TEXTURE_ENDLOOP
 
 #define TEXTUREFILL( PIXELUPDATE, TXU, TXV ) \
-	if( n_distance > ( (int32_t)n_drawarea_x2 - drawx ) + 1 ) \
+	if( n_distance > ( (int32_t)s.n_drawarea_x2 - drawx ) + 1 ) \
 	{ \
-		n_distance = ( n_drawarea_x2 - drawx ) + 1; \
+		n_distance = ( s.n_drawarea_x2 - drawx ) + 1; \
 	} \
 	uint16_t *p_vram = p_p_vram[ drawy ] + drawx; \
 	\
-	if( n_ti != 0 ) \
+	if( s.n_ti != 0 ) \
 	{ \
 		/* interleaved texture */ \
-		if( n_twh != 255 || \
-			n_tww != 255 || \
-			n_twx != 0 || \
-			n_twy != 0 ) \
+		if( s.n_twh != 255 || \
+			s.n_tww != 255 || \
+			s.n_twx != 0 || \
+			s.n_twy != 0 ) \
 		{ \
 			/* texture window */ \
 			switch( n_cmd & 0x02 ) \
 			{ \
 			case 0x00: \
 				/* shading */ \
-				switch( n_tp ) \
+				switch( s.n_tp ) \
 				{ \
 				case 0: \
 					/* 4 bit clut */ \
@@ -1153,7 +1179,7 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 				break; \
 			case 0x02: \
 				/* semi transparency */ \
-				switch( n_tp ) \
+				switch( s.n_tp ) \
 				{ \
 				case 0: \
 					/* 4 bit clut */ \
@@ -1181,7 +1207,7 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 			{ \
 			case 0x00: \
 				/* shading */ \
-				switch( n_tp ) \
+				switch( s.n_tp ) \
 				{ \
 				case 0: \
 					/* 4 bit clut */ \
@@ -1202,7 +1228,7 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 				break; \
 			case 0x02: \
 				/* semi transparency */ \
-				switch( n_tp ) \
+				switch( s.n_tp ) \
 				{ \
 				case 0: \
 					/* 4 bit clut */ \
@@ -1227,17 +1253,17 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 	else \
 	{ \
 		/* standard texture */ \
-		if( n_twh != 255 || \
-			n_tww != 255 || \
-			n_twx != 0 || \
-			n_twy != 0 ) \
+		if( s.n_twh != 255 || \
+			s.n_tww != 255 || \
+			s.n_twx != 0 || \
+			s.n_twy != 0 ) \
 		{ \
 			/* texture window */ \
 			switch( n_cmd & 0x02 ) \
 			{ \
 			case 0x00: \
 				/* shading */ \
-				switch( n_tp ) \
+				switch( s.n_tp ) \
 				{ \
 				case 0: \
 					/* 4 bit clut */ \
@@ -1258,7 +1284,7 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 				break; \
 			case 0x02: \
 				/* semi transparency */ \
-				switch( n_tp ) \
+				switch( s.n_tp ) \
 				{ \
 				case 0: \
 					/* 4 bit clut */ \
@@ -1286,7 +1312,7 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 			{ \
 			case 0x00: \
 				/* shading */ \
-				switch( n_tp ) \
+				switch( s.n_tp ) \
 				{ \
 				case 0: \
 					TEXTURE4BIT( TXV, TXU ) \
@@ -1306,7 +1332,7 @@ void psxgpu_device::decode_tpage( uint32_t tpage )
 				break; \
 			case 0x02: \
 				/* semi transparency */ \
-				switch( n_tp ) \
+				switch( s.n_tp ) \
 				{ \
 				case 0: \
 					/* 4 bit clut */ \
@@ -1346,8 +1372,8 @@ static inline int CullVertex( int a, int b )
 
 #define CULLPOINT( PacketType, p1, p2 ) \
 ( \
-	CullVertex( COORD_Y( m_packet.PacketType.vertex[ p1 ].n_coord ), COORD_Y( m_packet.PacketType.vertex[ p2 ].n_coord ) ) || \
-	CullVertex( COORD_X( m_packet.PacketType.vertex[ p1 ].n_coord ), COORD_X( m_packet.PacketType.vertex[ p2 ].n_coord ) ) \
+	CullVertex( COORD_Y( s.m_packet.PacketType.vertex[ p1 ].n_coord ), COORD_Y( s.m_packet.PacketType.vertex[ p2 ].n_coord ) ) || \
+	CullVertex( COORD_X( s.m_packet.PacketType.vertex[ p1 ].n_coord ), COORD_X( s.m_packet.PacketType.vertex[ p2 ].n_coord ) ) \
 )
 
 #define CULLTRIANGLE( PacketType, start ) \
@@ -1358,7 +1384,7 @@ static inline int CullVertex( int a, int b )
 #define FINDTOPLEFT( PacketType ) \
 	for( int n_point = 0; n_point < n_points; n_point++ ) \
 	{ \
-		GET_COORD( m_packet.PacketType.vertex[ n_point ].n_coord ); \
+		GET_COORD( s.m_packet.PacketType.vertex[ n_point ].n_coord ); \
 	} \
 	\
 	const int *p_n_rightpointlist; \
@@ -1401,16 +1427,16 @@ static inline int CullVertex( int a, int b )
 	\
 	for( int n_point = n_leftpoint + 1; n_point < n_points; n_point++ ) \
 	{ \
-		if( COORD_Y( m_packet.PacketType.vertex[ n_point ].n_coord ) < COORD_Y( m_packet.PacketType.vertex[ n_leftpoint ].n_coord ) || \
-			( COORD_Y( m_packet.PacketType.vertex[ n_point ].n_coord ) == COORD_Y( m_packet.PacketType.vertex[ n_leftpoint ].n_coord ) && \
-			COORD_X( m_packet.PacketType.vertex[ n_point ].n_coord ) < COORD_X( m_packet.PacketType.vertex[ n_leftpoint ].n_coord ) ) ) \
+		if( COORD_Y( s.m_packet.PacketType.vertex[ n_point ].n_coord ) < COORD_Y( s.m_packet.PacketType.vertex[ n_leftpoint ].n_coord ) || \
+			( COORD_Y( s.m_packet.PacketType.vertex[ n_point ].n_coord ) == COORD_Y( s.m_packet.PacketType.vertex[ n_leftpoint ].n_coord ) && \
+			COORD_X( s.m_packet.PacketType.vertex[ n_point ].n_coord ) < COORD_X( s.m_packet.PacketType.vertex[ n_leftpoint ].n_coord ) ) ) \
 		{ \
 			n_leftpoint = n_point; \
 		} \
 	} \
 	int n_rightpoint = n_leftpoint;
 
-void psxgpu_device::FlatPolygon( int n_points )
+void psxgpu_device::FlatPolygon( psxgpu_draw_state &s, int n_points )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 1 )
@@ -1419,34 +1445,34 @@ void psxgpu_device::FlatPolygon( int n_points )
 	}
 	for( int n_point = 0; n_point < n_points; n_point++ )
 	{
-		DebugMesh( S11_COORD_X( m_packet.FlatPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
+		DebugMesh( S11_COORD_X( s.m_packet.FlatPolygon.vertex[ n_point ].n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.FlatPolygon.vertex[ n_point ].n_coord ) + s.n_drawoffset_y );
 	}
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatPolygon.n_bgr );
+	uint8_t n_cmd = BGR_C( s.m_packet.FlatPolygon.n_bgr );
 
 	PAIR n_cx1; n_cx1.d = 0;
 	PAIR n_cx2; n_cx2.d = 0;
 
 	SOLIDSETUP
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatPolygon.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatPolygon.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatPolygon.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( s.m_packet.FlatPolygon.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( s.m_packet.FlatPolygon.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( s.m_packet.FlatPolygon.n_bgr ); n_b.w.l = 0;
 
 	FINDTOPLEFT( FlatPolygon )
 
 	int32_t n_dx1 = 0;
 	int32_t n_dx2 = 0;
 
-	int16_t n_y = COORD_Y( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord );
+	int16_t n_y = COORD_Y( s.m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord );
 
 	for( ;; )
 	{
-		if( n_y == COORD_Y( m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) )
+		if( n_y == COORD_Y( s.m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.FlatPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( s.m_packet.FlatPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
 			{
 				n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 				if( n_leftpoint == n_rightpoint )
@@ -1455,21 +1481,21 @@ void psxgpu_device::FlatPolygon( int n_points )
 				}
 			}
 
-			n_cx1.sw.h = COORD_X( m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
+			n_cx1.sw.h = COORD_X( s.m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
 			n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( s.m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx1 = (int32_t)( ( COORD_X( m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
+			n_dx1 = (int32_t)( ( COORD_X( s.m_packet.FlatPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
 		}
 
-		if( n_y == COORD_Y( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) )
+		if( n_y == COORD_Y( s.m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.FlatPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( s.m_packet.FlatPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
 			{
 				n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 				if( n_rightpoint == n_leftpoint )
@@ -1478,21 +1504,21 @@ void psxgpu_device::FlatPolygon( int n_points )
 				}
 			}
 
-			n_cx2.sw.h = COORD_X( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
+			n_cx2.sw.h = COORD_X( s.m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
 			n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( s.m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx2 = (int32_t)( ( COORD_X( m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
+			n_dx2 = (int32_t)( ( COORD_X( s.m_packet.FlatPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
 		}
 
-		int drawy = n_y + n_drawoffset_y;
+		int drawy = n_y + s.n_drawoffset_y;
 
-		if( (int16_t)n_cx1.sw.h != (int16_t)n_cx2.sw.h && drawy >= (int32_t)n_drawarea_y1 && drawy <= (int32_t)n_drawarea_y2 )
+		if( (int16_t)n_cx1.sw.h != (int16_t)n_cx2.sw.h && drawy >= (int32_t)s.n_drawarea_y1 && drawy <= (int32_t)s.n_drawarea_y2 )
 		{
 			int16_t n_x;
 			int32_t n_distance;
@@ -1508,12 +1534,12 @@ void psxgpu_device::FlatPolygon( int n_points )
 				n_distance = (int16_t)n_cx1.sw.h - n_x;
 			}
 
-			int drawx = n_x + n_drawoffset_x;
+			int drawx = n_x + s.n_drawoffset_x;
 
-			if( ( (int32_t)n_drawarea_x1 - drawx ) > 0 )
+			if( ( (int32_t)s.n_drawarea_x1 - drawx ) > 0 )
 			{
-				n_distance -= ( n_drawarea_x1 - drawx );
-				drawx = n_drawarea_x1;
+				n_distance -= ( s.n_drawarea_x1 - drawx );
+				drawx = s.n_drawarea_x1;
 			}
 
 			SOLIDFILL( FLATPOLYGONUPDATE )
@@ -1525,7 +1551,7 @@ void psxgpu_device::FlatPolygon( int n_points )
 	}
 }
 
-void psxgpu_device::FlatTexturedPolygon( int n_points )
+void psxgpu_device::FlatTexturedPolygon( psxgpu_draw_state &s, int n_points )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 2 )
@@ -1534,15 +1560,15 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 	}
 	for( int n_point = 0; n_point < n_points; n_point++ )
 	{
-		DebugMesh( S11_COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
+		DebugMesh( S11_COORD_X( s.m_packet.FlatTexturedPolygon.vertex[ n_point ].n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.FlatTexturedPolygon.vertex[ n_point ].n_coord ) + s.n_drawoffset_y );
 	}
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatTexturedPolygon.n_bgr );
+	uint8_t n_cmd = BGR_C( s.m_packet.FlatTexturedPolygon.n_bgr );
 
-	uint32_t n_clutx = ( m_packet.FlatTexturedPolygon.vertex[ 0 ].n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.FlatTexturedPolygon.vertex[ 0 ].n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( s.m_packet.FlatTexturedPolygon.vertex[ 0 ].n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( s.m_packet.FlatTexturedPolygon.vertex[ 0 ].n_texture.w.h >> 6 ) & 0x3ff;
 
 	PAIR n_cx1; n_cx1.d = 0;
 	PAIR n_cu1; n_cu1.d = 0;
@@ -1551,12 +1577,11 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 	PAIR n_cu2; n_cu2.d = 0;
 	PAIR n_cv2; n_cv2.d = 0;
 
-	decode_tpage( m_packet.FlatTexturedPolygon.vertex[ 1 ].n_texture.w.h );
 	TEXTURESETUP
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.FlatTexturedPolygon.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.FlatTexturedPolygon.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.FlatTexturedPolygon.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( s.m_packet.FlatTexturedPolygon.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( s.m_packet.FlatTexturedPolygon.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( s.m_packet.FlatTexturedPolygon.n_bgr ); n_b.w.l = 0;
 
 	FINDTOPLEFT( FlatTexturedPolygon )
 
@@ -1567,13 +1592,13 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 	int32_t n_dv1 = 0;
 	int32_t n_dv2 = 0;
 
-	int16_t n_y = COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord );
+	int16_t n_y = COORD_Y( s.m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord );
 
 	for( ;; )
 	{
-		if( n_y == COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) )
+		if( n_y == COORD_Y( s.m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.FlatTexturedPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( s.m_packet.FlatTexturedPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
 			{
 				n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 				if( n_leftpoint == n_rightpoint )
@@ -1582,25 +1607,25 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 				}
 			}
 
-			n_cx1.sw.h = COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
-			n_cu1.w.h = TEXTURE_U( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cu1.w.l = 0;
-			n_cv1.w.h = TEXTURE_V( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cv1.w.l = 0;
+			n_cx1.sw.h = COORD_X( s.m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
+			n_cu1.w.h = TEXTURE_U( s.m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cu1.w.l = 0;
+			n_cv1.w.h = TEXTURE_V( s.m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cv1.w.l = 0;
 			n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( s.m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx1 = (int32_t)( ( COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
-			n_du1 = (int32_t)( ( TEXTURE_U( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cu1.d ) / n_distance;
-			n_dv1 = (int32_t)( ( TEXTURE_V( m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cv1.d ) / n_distance;
+			n_dx1 = (int32_t)( ( COORD_X( s.m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
+			n_du1 = (int32_t)( ( TEXTURE_U( s.m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cu1.d ) / n_distance;
+			n_dv1 = (int32_t)( ( TEXTURE_V( s.m_packet.FlatTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cv1.d ) / n_distance;
 		}
 
-		if( n_y == COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) )
+		if( n_y == COORD_Y( s.m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.FlatTexturedPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( s.m_packet.FlatTexturedPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
 			{
 				n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 				if( n_rightpoint == n_leftpoint )
@@ -1609,25 +1634,25 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 				}
 			}
 
-			n_cx2.sw.h = COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
-			n_cu2.w.h = TEXTURE_U( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cu2.w.l = 0;
-			n_cv2.w.h = TEXTURE_V( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cv2.w.l = 0;
+			n_cx2.sw.h = COORD_X( s.m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
+			n_cu2.w.h = TEXTURE_U( s.m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cu2.w.l = 0;
+			n_cv2.w.h = TEXTURE_V( s.m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cv2.w.l = 0;
 			n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( s.m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx2 = (int32_t)( ( COORD_X( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
-			n_du2 = (int32_t)( ( TEXTURE_U( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cu2.d ) / n_distance;
-			n_dv2 = (int32_t)( ( TEXTURE_V( m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cv2.d ) / n_distance;
+			n_dx2 = (int32_t)( ( COORD_X( s.m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
+			n_du2 = (int32_t)( ( TEXTURE_U( s.m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cu2.d ) / n_distance;
+			n_dv2 = (int32_t)( ( TEXTURE_V( s.m_packet.FlatTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cv2.d ) / n_distance;
 		}
 
-		int drawy = n_y + n_drawoffset_y;
+		int drawy = n_y + s.n_drawoffset_y;
 
-		if( (int16_t)n_cx1.sw.h != (int16_t)n_cx2.sw.h && drawy >= (int32_t)n_drawarea_y1 && drawy <= (int32_t)n_drawarea_y2 )
+		if( (int16_t)n_cx1.sw.h != (int16_t)n_cx2.sw.h && drawy >= (int32_t)s.n_drawarea_y1 && drawy <= (int32_t)s.n_drawarea_y2 )
 		{
 			int16_t n_x;
 			int32_t n_distance;
@@ -1657,14 +1682,14 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 				n_dv = (int32_t)( n_cv1.d - n_cv2.d ) / n_distance;
 			}
 
-			int drawx = n_x + n_drawoffset_x;
+			int drawx = n_x + s.n_drawoffset_x;
 
-			if( ( (int32_t)n_drawarea_x1 - drawx ) > 0 )
+			if( ( (int32_t)s.n_drawarea_x1 - drawx ) > 0 )
 			{
-				n_u.d += n_du * ( n_drawarea_x1 - drawx );
-				n_v.d += n_dv * ( n_drawarea_x1 - drawx );
-				n_distance -= ( n_drawarea_x1 - drawx );
-				drawx = n_drawarea_x1;
+				n_u.d += n_du * ( s.n_drawarea_x1 - drawx );
+				n_v.d += n_dv * ( s.n_drawarea_x1 - drawx );
+				n_distance -= ( s.n_drawarea_x1 - drawx );
+				drawx = s.n_drawarea_x1;
 			}
 
 			TEXTUREFILL( FLATTEXTUREDPOLYGONUPDATE, n_u.w.h, n_v.w.h );
@@ -1680,7 +1705,7 @@ void psxgpu_device::FlatTexturedPolygon( int n_points )
 	}
 }
 
-void psxgpu_device::GouraudPolygon( int n_points )
+void psxgpu_device::GouraudPolygon( psxgpu_draw_state &s, int n_points )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 3 )
@@ -1689,12 +1714,12 @@ void psxgpu_device::GouraudPolygon( int n_points )
 	}
 	for( int n_point = 0; n_point < n_points; n_point++ )
 	{
-		DebugMesh( S11_COORD_X( m_packet.GouraudPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.GouraudPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
+		DebugMesh( S11_COORD_X( s.m_packet.GouraudPolygon.vertex[ n_point ].n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.GouraudPolygon.vertex[ n_point ].n_coord ) + s.n_drawoffset_y );
 	}
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.GouraudPolygon.vertex[ 0 ].n_bgr );
+	uint8_t n_cmd = BGR_C( s.m_packet.GouraudPolygon.vertex[ 0 ].n_bgr );
 
 	PAIR n_cx1; n_cx1.d = 0;
 	PAIR n_cr1; n_cr1.d = 0;
@@ -1718,13 +1743,13 @@ void psxgpu_device::GouraudPolygon( int n_points )
 	int32_t n_db1 = 0;
 	int32_t n_db2 = 0;
 
-	int16_t n_y = COORD_Y( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord );
+	int16_t n_y = COORD_Y( s.m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord );
 
 	for( ;; )
 	{
-		if( n_y == COORD_Y( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) )
+		if( n_y == COORD_Y( s.m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.GouraudPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( s.m_packet.GouraudPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
 			{
 				n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 				if( n_leftpoint == n_rightpoint )
@@ -1733,27 +1758,27 @@ void psxgpu_device::GouraudPolygon( int n_points )
 				}
 			}
 
-			n_cx1.sw.h = COORD_X( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
-			n_cr1.w.h = BGR_R( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cr1.w.l = 0;
-			n_cg1.w.h = BGR_G( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cg1.w.l = 0;
-			n_cb1.w.h = BGR_B( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cb1.w.l = 0;
+			n_cx1.sw.h = COORD_X( s.m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
+			n_cr1.w.h = BGR_R( s.m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cr1.w.l = 0;
+			n_cg1.w.h = BGR_G( s.m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cg1.w.l = 0;
+			n_cb1.w.h = BGR_B( s.m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ); n_cb1.w.l = 0;
 			n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( s.m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx1 = (int32_t)( ( COORD_X( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
-			n_dr1 = (int32_t)( ( BGR_R( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cr1.d ) / n_distance;
-			n_dg1 = (int32_t)( ( BGR_G( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cg1.d ) / n_distance;
-			n_db1 = (int32_t)( ( BGR_B( m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cb1.d ) / n_distance;
+			n_dx1 = (int32_t)( ( COORD_X( s.m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
+			n_dr1 = (int32_t)( ( BGR_R( s.m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cr1.d ) / n_distance;
+			n_dg1 = (int32_t)( ( BGR_G( s.m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cg1.d ) / n_distance;
+			n_db1 = (int32_t)( ( BGR_B( s.m_packet.GouraudPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cb1.d ) / n_distance;
 		}
 
-		if( n_y == COORD_Y( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) )
+		if( n_y == COORD_Y( s.m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.GouraudPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( s.m_packet.GouraudPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
 			{
 				n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 				if( n_rightpoint == n_leftpoint )
@@ -1762,27 +1787,27 @@ void psxgpu_device::GouraudPolygon( int n_points )
 				}
 			}
 
-			n_cx2.sw.h = COORD_X( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
-			n_cr2.w.h = BGR_R( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cr2.w.l = 0;
-			n_cg2.w.h = BGR_G( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cg2.w.l = 0;
-			n_cb2.w.h = BGR_B( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cb2.w.l = 0;
+			n_cx2.sw.h = COORD_X( s.m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
+			n_cr2.w.h = BGR_R( s.m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cr2.w.l = 0;
+			n_cg2.w.h = BGR_G( s.m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cg2.w.l = 0;
+			n_cb2.w.h = BGR_B( s.m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ); n_cb2.w.l = 0;
 			n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( s.m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx2 = (int32_t)( ( COORD_X( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
-			n_dr2 = (int32_t)( ( BGR_R( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cr2.d ) / n_distance;
-			n_dg2 = (int32_t)( ( BGR_G( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cg2.d ) / n_distance;
-			n_db2 = (int32_t)( ( BGR_B( m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cb2.d ) / n_distance;
+			n_dx2 = (int32_t)( ( COORD_X( s.m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
+			n_dr2 = (int32_t)( ( BGR_R( s.m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cr2.d ) / n_distance;
+			n_dg2 = (int32_t)( ( BGR_G( s.m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cg2.d ) / n_distance;
+			n_db2 = (int32_t)( ( BGR_B( s.m_packet.GouraudPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cb2.d ) / n_distance;
 		}
 
-		int drawy = n_y + n_drawoffset_y;
+		int drawy = n_y + s.n_drawoffset_y;
 
-		if( (int16_t)n_cx1.sw.h != (int16_t)n_cx2.sw.h && drawy >= (int32_t)n_drawarea_y1 && drawy <= (int32_t)n_drawarea_y2 )
+		if( (int16_t)n_cx1.sw.h != (int16_t)n_cx2.sw.h && drawy >= (int32_t)s.n_drawarea_y1 && drawy <= (int32_t)s.n_drawarea_y2 )
 		{
 			int16_t n_x;
 			int32_t n_distance;
@@ -1818,15 +1843,15 @@ void psxgpu_device::GouraudPolygon( int n_points )
 				n_db = (int32_t)( n_cb1.d - n_cb2.d ) / n_distance;
 			}
 
-			int drawx = n_x + n_drawoffset_x;
+			int drawx = n_x + s.n_drawoffset_x;
 
-			if( ( (int32_t)n_drawarea_x1 - drawx ) > 0 )
+			if( ( (int32_t)s.n_drawarea_x1 - drawx ) > 0 )
 			{
-				n_r.d += n_dr * ( n_drawarea_x1 - drawx );
-				n_g.d += n_dg * ( n_drawarea_x1 - drawx );
-				n_b.d += n_db * ( n_drawarea_x1 - drawx );
-				n_distance -= ( n_drawarea_x1 - drawx );
-				drawx = n_drawarea_x1;
+				n_r.d += n_dr * ( s.n_drawarea_x1 - drawx );
+				n_g.d += n_dg * ( s.n_drawarea_x1 - drawx );
+				n_b.d += n_db * ( s.n_drawarea_x1 - drawx );
+				n_distance -= ( s.n_drawarea_x1 - drawx );
+				drawx = s.n_drawarea_x1;
 			}
 
 			SOLIDFILL( GOURAUDPOLYGONUPDATE )
@@ -1844,7 +1869,7 @@ void psxgpu_device::GouraudPolygon( int n_points )
 	}
 }
 
-void psxgpu_device::GouraudTexturedPolygon( int n_points )
+void psxgpu_device::GouraudTexturedPolygon( psxgpu_draw_state &s, int n_points )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 4 )
@@ -1853,15 +1878,15 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 	}
 	for( int n_point = 0; n_point < n_points; n_point++ )
 	{
-		DebugMesh( S11_COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_point ].n_coord ) + n_drawoffset_y );
+		DebugMesh( S11_COORD_X( s.m_packet.GouraudTexturedPolygon.vertex[ n_point ].n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.GouraudTexturedPolygon.vertex[ n_point ].n_coord ) + s.n_drawoffset_y );
 	}
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.GouraudTexturedPolygon.vertex[ 0 ].n_bgr );
+	uint8_t n_cmd = BGR_C( s.m_packet.GouraudTexturedPolygon.vertex[ 0 ].n_bgr );
 
-	uint32_t n_clutx = ( m_packet.GouraudTexturedPolygon.vertex[ 0 ].n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.GouraudTexturedPolygon.vertex[ 0 ].n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( s.m_packet.GouraudTexturedPolygon.vertex[ 0 ].n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( s.m_packet.GouraudTexturedPolygon.vertex[ 0 ].n_texture.w.h >> 6 ) & 0x3ff;
 
 	PAIR n_cx1; n_cx1.d = 0;
 	PAIR n_cr1; n_cr1.d = 0;
@@ -1876,7 +1901,6 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 	PAIR n_cu2; n_cu2.d = 0;
 	PAIR n_cv2; n_cv2.d = 0;
 
-	decode_tpage( m_packet.GouraudTexturedPolygon.vertex[ 1 ].n_texture.w.h );
 	TEXTURESETUP
 
 	FINDTOPLEFT( GouraudTexturedPolygon )
@@ -1894,13 +1918,13 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 	int32_t n_dv1 = 0;
 	int32_t n_dv2 = 0;
 
-	int16_t n_y = COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord );
+	int16_t n_y = COORD_Y( s.m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord );
 
 	for( ;; )
 	{
-		if( n_y == COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) )
+		if( n_y == COORD_Y( s.m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( s.m_packet.GouraudTexturedPolygon.vertex[ p_n_leftpointlist[ n_leftpoint ] ].n_coord ) )
 			{
 				n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 				if( n_leftpoint == n_rightpoint )
@@ -1909,31 +1933,31 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 				}
 			}
 
-			n_cx1.sw.h = COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
-			n_cr1.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cr1.w.l = 0;
-			n_cg1.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cg1.w.l = 0;
-			n_cb1.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cb1.w.l = 0;
-			n_cu1.w.h = TEXTURE_U( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cu1.w.l = 0;
-			n_cv1.w.h = TEXTURE_V( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cv1.w.l = 0;
+			n_cx1.sw.h = COORD_X( s.m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ); n_cx1.sw.l = 0;
+			n_cr1.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( s.m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cr1.w.l = 0;
+			n_cg1.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( s.m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cg1.w.l = 0;
+			n_cb1.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( s.m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ); n_cb1.w.l = 0;
+			n_cu1.w.h = TEXTURE_U( s.m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cu1.w.l = 0;
+			n_cv1.w.h = TEXTURE_V( s.m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ); n_cv1.w.l = 0;
 			n_leftpoint = p_n_leftpointlist[ n_leftpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( s.m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx1 = (int32_t)( ( COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
-			n_dr1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_R( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cr1.d ) / n_distance;
-			n_dg1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_G( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cg1.d ) / n_distance;
-			n_db1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_B( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cb1.d ) / n_distance;
-			n_du1 = (int32_t)( ( TEXTURE_U( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cu1.d ) / n_distance;
-			n_dv1 = (int32_t)( ( TEXTURE_V( m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cv1.d ) / n_distance;
+			n_dx1 = (int32_t)( ( COORD_X( s.m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_coord ) << 16 ) - n_cx1.d ) / n_distance;
+			n_dr1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_R( s.m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cr1.d ) / n_distance;
+			n_dg1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_G( s.m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cg1.d ) / n_distance;
+			n_db1 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_B( s.m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_bgr ) << 16 ) - n_cb1.d ) / n_distance;
+			n_du1 = (int32_t)( ( TEXTURE_U( s.m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cu1.d ) / n_distance;
+			n_dv1 = (int32_t)( ( TEXTURE_V( s.m_packet.GouraudTexturedPolygon.vertex[ n_leftpoint ].n_texture ) << 16 ) - n_cv1.d ) / n_distance;
 		}
 
-		if( n_y == COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) )
+		if( n_y == COORD_Y( s.m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) )
 		{
-			while( n_y == COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
+			while( n_y == COORD_Y( s.m_packet.GouraudTexturedPolygon.vertex[ p_n_rightpointlist[ n_rightpoint ] ].n_coord ) )
 			{
 				n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 				if( n_rightpoint == n_leftpoint )
@@ -1942,31 +1966,31 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 				}
 			}
 
-			n_cx2.sw.h = COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
-			n_cr2.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cr2.w.l = 0;
-			n_cg2.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cg2.w.l = 0;
-			n_cb2.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cb2.w.l = 0;
-			n_cu2.w.h = TEXTURE_U( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cu2.w.l = 0;
-			n_cv2.w.h = TEXTURE_V( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cv2.w.l = 0;
+			n_cx2.sw.h = COORD_X( s.m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ); n_cx2.sw.l = 0;
+			n_cr2.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( s.m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cr2.w.l = 0;
+			n_cg2.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( s.m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cg2.w.l = 0;
+			n_cb2.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( s.m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ); n_cb2.w.l = 0;
+			n_cu2.w.h = TEXTURE_U( s.m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cu2.w.l = 0;
+			n_cv2.w.h = TEXTURE_V( s.m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ); n_cv2.w.l = 0;
 			n_rightpoint = p_n_rightpointlist[ n_rightpoint ];
 
-			int32_t n_distance = COORD_Y( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
+			int32_t n_distance = COORD_Y( s.m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) - n_y;
 			if( n_distance < 1 )
 			{
 				break;
 			}
 
-			n_dx2 = (int32_t)( ( COORD_X( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
-			n_dr2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_R( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cr2.d ) / n_distance;
-			n_dg2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_G( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cg2.d ) / n_distance;
-			n_db2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_B( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cb2.d ) / n_distance;
-			n_du2 = (int32_t)( ( TEXTURE_U( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cu2.d ) / n_distance;
-			n_dv2 = (int32_t)( ( TEXTURE_V( m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cv2.d ) / n_distance;
+			n_dx2 = (int32_t)( ( COORD_X( s.m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_coord ) << 16 ) - n_cx2.d ) / n_distance;
+			n_dr2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_R( s.m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cr2.d ) / n_distance;
+			n_dg2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_G( s.m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cg2.d ) / n_distance;
+			n_db2 = n_cmd & 0x01 ? 0 : (int32_t)( ( BGR_B( s.m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_bgr ) << 16 ) - n_cb2.d ) / n_distance;
+			n_du2 = (int32_t)( ( TEXTURE_U( s.m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cu2.d ) / n_distance;
+			n_dv2 = (int32_t)( ( TEXTURE_V( s.m_packet.GouraudTexturedPolygon.vertex[ n_rightpoint ].n_texture ) << 16 ) - n_cv2.d ) / n_distance;
 		}
 
-		int drawy = n_y + n_drawoffset_y;
+		int drawy = n_y + s.n_drawoffset_y;
 
-		if( (int16_t)n_cx1.sw.h != (int16_t)n_cx2.sw.h && drawy >= (int32_t)n_drawarea_y1 && drawy <= (int32_t)n_drawarea_y2 )
+		if( (int16_t)n_cx1.sw.h != (int16_t)n_cx2.sw.h && drawy >= (int32_t)s.n_drawarea_y1 && drawy <= (int32_t)s.n_drawarea_y2 )
 		{
 			int16_t n_x;
 			int32_t n_distance;
@@ -2014,17 +2038,17 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 				n_dv = (int32_t)( n_cv1.d - n_cv2.d ) / n_distance;
 			}
 
-			int drawx = n_x + n_drawoffset_x;
+			int drawx = n_x + s.n_drawoffset_x;
 
-			if( ( (int32_t)n_drawarea_x1 - drawx ) > 0 )
+			if( ( (int32_t)s.n_drawarea_x1 - drawx ) > 0 )
 			{
-				n_r.d += n_dr * ( n_drawarea_x1 - drawx );
-				n_g.d += n_dg * ( n_drawarea_x1 - drawx );
-				n_b.d += n_db * ( n_drawarea_x1 - drawx );
-				n_u.d += n_du * ( n_drawarea_x1 - drawx );
-				n_v.d += n_dv * ( n_drawarea_x1 - drawx );
-				n_distance -= ( n_drawarea_x1 - drawx );
-				drawx = n_drawarea_x1;
+				n_r.d += n_dr * ( s.n_drawarea_x1 - drawx );
+				n_g.d += n_dg * ( s.n_drawarea_x1 - drawx );
+				n_b.d += n_db * ( s.n_drawarea_x1 - drawx );
+				n_u.d += n_du * ( s.n_drawarea_x1 - drawx );
+				n_v.d += n_dv * ( s.n_drawarea_x1 - drawx );
+				n_distance -= ( s.n_drawarea_x1 - drawx );
+				drawx = s.n_drawarea_x1;
 			}
 
 			TEXTUREFILL( GOURAUDTEXTUREDPOLYGONUPDATE, n_u.w.h, n_v.w.h );
@@ -2046,27 +2070,27 @@ void psxgpu_device::GouraudTexturedPolygon( int n_points )
 	}
 }
 
-void psxgpu_device::MonochromeLine()
+void psxgpu_device::MonochromeLine( psxgpu_draw_state &s )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 5 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.MonochromeLine.vertex[ 0 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.MonochromeLine.vertex[ 0 ].n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.MonochromeLine.vertex[ 1 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.MonochromeLine.vertex[ 1 ].n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.MonochromeLine.vertex[ 0 ].n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.MonochromeLine.vertex[ 0 ].n_coord ) + s.n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.MonochromeLine.vertex[ 1 ].n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.MonochromeLine.vertex[ 1 ].n_coord ) + s.n_drawoffset_y );
 	DebugMeshEnd();
 #endif
 
-	int32_t n_xstart = S11_COORD_X( m_packet.MonochromeLine.vertex[ 0 ].n_coord );
-	int32_t n_xend = S11_COORD_X( m_packet.MonochromeLine.vertex[ 1 ].n_coord );
-	int32_t n_ystart = S11_COORD_Y( m_packet.MonochromeLine.vertex[ 0 ].n_coord );
-	int32_t n_yend = S11_COORD_Y( m_packet.MonochromeLine.vertex[ 1 ].n_coord );
+	int32_t n_xstart = S11_COORD_X( s.m_packet.MonochromeLine.vertex[ 0 ].n_coord );
+	int32_t n_xend = S11_COORD_X( s.m_packet.MonochromeLine.vertex[ 1 ].n_coord );
+	int32_t n_ystart = S11_COORD_Y( s.m_packet.MonochromeLine.vertex[ 0 ].n_coord );
+	int32_t n_yend = S11_COORD_Y( s.m_packet.MonochromeLine.vertex[ 1 ].n_coord );
 
-	uint8_t n_cmd = BGR_C( m_packet.MonochromeLine.n_bgr );
-	uint8_t n_r = BGR_R( m_packet.MonochromeLine.n_bgr );
-	uint8_t n_g = BGR_G( m_packet.MonochromeLine.n_bgr );
-	uint8_t n_b = BGR_B( m_packet.MonochromeLine.n_bgr );
+	uint8_t n_cmd = BGR_C( s.m_packet.MonochromeLine.n_bgr );
+	uint8_t n_r = BGR_R( s.m_packet.MonochromeLine.n_bgr );
+	uint8_t n_g = BGR_G( s.m_packet.MonochromeLine.n_bgr );
+	uint8_t n_b = BGR_B( s.m_packet.MonochromeLine.n_bgr );
 
 	TRANSPARENCYSETUP
 
@@ -2113,11 +2137,11 @@ void psxgpu_device::MonochromeLine()
 
 	while( n_len > 0 )
 	{
-		int drawx = n_x.sw.h + n_drawoffset_x;
-		int drawy = n_y.sw.h + n_drawoffset_y;
+		int drawx = n_x.sw.h + s.n_drawoffset_x;
+		int drawy = n_y.sw.h + s.n_drawoffset_y;
 
-		if( drawx >= (int32_t)n_drawarea_x1 && drawy >= (int32_t)n_drawarea_y1 &&
-			drawx <= (int32_t)n_drawarea_x2 && drawy <= (int32_t)n_drawarea_y2 )
+		if( drawx >= (int32_t)s.n_drawarea_x1 && drawy >= (int32_t)s.n_drawarea_y1 &&
+			drawx <= (int32_t)s.n_drawarea_x2 && drawy <= (int32_t)s.n_drawarea_y2 )
 		{
 			uint16_t *p_vram = p_p_vram[ drawy ] + drawx;
 
@@ -2146,33 +2170,33 @@ void psxgpu_device::MonochromeLine()
 	}
 }
 
-void psxgpu_device::GouraudLine()
+void psxgpu_device::GouraudLine( psxgpu_draw_state &s )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 6 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.GouraudLine.vertex[ 0 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.GouraudLine.vertex[ 0 ].n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.GouraudLine.vertex[ 1 ].n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.GouraudLine.vertex[ 1 ].n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.GouraudLine.vertex[ 0 ].n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.GouraudLine.vertex[ 0 ].n_coord ) + s.n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.GouraudLine.vertex[ 1 ].n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.GouraudLine.vertex[ 1 ].n_coord ) + s.n_drawoffset_y );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.GouraudLine.vertex[ 0 ].n_bgr );
+	uint8_t n_cmd = BGR_C( s.m_packet.GouraudLine.vertex[ 0 ].n_bgr );
 
 	TRANSPARENCYSETUP
 
-	int32_t n_xstart = S11_COORD_X( m_packet.GouraudLine.vertex[ 0 ].n_coord );
-	int32_t n_ystart = S11_COORD_Y( m_packet.GouraudLine.vertex[ 0 ].n_coord );
-	PAIR n_cr1; n_cr1.w.h = BGR_R( m_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cr1.w.l = 0;
-	PAIR n_cg1; n_cg1.w.h = BGR_G( m_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cg1.w.l = 0;
-	PAIR n_cb1; n_cb1.w.h = BGR_B( m_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cb1.w.l = 0;
+	int32_t n_xstart = S11_COORD_X( s.m_packet.GouraudLine.vertex[ 0 ].n_coord );
+	int32_t n_ystart = S11_COORD_Y( s.m_packet.GouraudLine.vertex[ 0 ].n_coord );
+	PAIR n_cr1; n_cr1.w.h = BGR_R( s.m_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cr1.w.l = 0;
+	PAIR n_cg1; n_cg1.w.h = BGR_G( s.m_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cg1.w.l = 0;
+	PAIR n_cb1; n_cb1.w.h = BGR_B( s.m_packet.GouraudLine.vertex[ 0 ].n_bgr ); n_cb1.w.l = 0;
 
-	int32_t n_xend = S11_COORD_X( m_packet.GouraudLine.vertex[ 1 ].n_coord );
-	int32_t n_yend = S11_COORD_Y( m_packet.GouraudLine.vertex[ 1 ].n_coord );
-	PAIR n_cr2; n_cr2.w.h = BGR_R( m_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cr2.w.l = 0;
-	PAIR n_cg2; n_cg2.w.h = BGR_G( m_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cg2.w.l = 0;
-	PAIR n_cb2; n_cb2.w.h = BGR_B( m_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cb2.w.l = 0;
+	int32_t n_xend = S11_COORD_X( s.m_packet.GouraudLine.vertex[ 1 ].n_coord );
+	int32_t n_yend = S11_COORD_Y( s.m_packet.GouraudLine.vertex[ 1 ].n_coord );
+	PAIR n_cr2; n_cr2.w.h = BGR_R( s.m_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cr2.w.l = 0;
+	PAIR n_cg2; n_cg2.w.h = BGR_G( s.m_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cg2.w.l = 0;
+	PAIR n_cb2; n_cb2.w.h = BGR_B( s.m_packet.GouraudLine.vertex[ 1 ].n_bgr ); n_cb2.w.l = 0;
 
 
 	PAIR n_x; n_x.sw.h = n_xstart; n_x.sw.l = 0;
@@ -2224,11 +2248,11 @@ void psxgpu_device::GouraudLine()
 
 	while( n_distance > 0 )
 	{
-		int drawx = n_x.sw.h + n_drawoffset_x;
-		int drawy = n_y.sw.h + n_drawoffset_y;
+		int drawx = n_x.sw.h + s.n_drawoffset_x;
+		int drawy = n_y.sw.h + s.n_drawoffset_y;
 
-		if( drawx >= (int32_t)n_drawarea_x1 && drawy >= (int32_t)n_drawarea_y1 &&
-			drawx <= (int32_t)n_drawarea_x2 && drawy <= (int32_t)n_drawarea_y2 )
+		if( drawx >= (int32_t)s.n_drawarea_x1 && drawy >= (int32_t)s.n_drawarea_y1 &&
+			drawx <= (int32_t)s.n_drawarea_x2 && drawy <= (int32_t)s.n_drawarea_y2 )
 		{
 			uint16_t *p_vram = p_p_vram[ drawy ] + drawx;
 
@@ -2260,31 +2284,31 @@ void psxgpu_device::GouraudLine()
 	}
 }
 
-void psxgpu_device::FrameBufferRectangleDraw()
+void psxgpu_device::FrameBufferRectangleDraw( psxgpu_draw_state &s )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 7 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + SIZE_W( m_packet.FlatRectangle.n_size ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + SIZE_H( m_packet.FlatRectangle.n_size ) );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + SIZE_W( m_packet.FlatRectangle.n_size ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + SIZE_H( m_packet.FlatRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatRectangle.n_coord ), S11_COORD_Y( s.m_packet.FlatRectangle.n_coord ) );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatRectangle.n_coord ) + SIZE_W( s.m_packet.FlatRectangle.n_size ), S11_COORD_Y( s.m_packet.FlatRectangle.n_coord ) );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatRectangle.n_coord ), S11_COORD_Y( s.m_packet.FlatRectangle.n_coord ) + SIZE_H( s.m_packet.FlatRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatRectangle.n_coord ) + SIZE_W( s.m_packet.FlatRectangle.n_size ), S11_COORD_Y( s.m_packet.FlatRectangle.n_coord ) + SIZE_H( s.m_packet.FlatRectangle.n_size ) );
 	DebugMeshEnd();
 #endif
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatRectangle.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( s.m_packet.FlatRectangle.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( s.m_packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( s.m_packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_y = COORD_Y( m_packet.FlatRectangle.n_coord );
-	int32_t n_h = SIZE_H( m_packet.FlatRectangle.n_size );
+	int16_t n_y = COORD_Y( s.m_packet.FlatRectangle.n_coord );
+	int32_t n_h = SIZE_H( s.m_packet.FlatRectangle.n_size );
 
 	while( n_h > 0 )
 	{
-		int16_t n_x = COORD_X( m_packet.FlatRectangle.n_coord );
-		int32_t n_distance = SIZE_W( m_packet.FlatRectangle.n_size );
+		int16_t n_x = COORD_X( s.m_packet.FlatRectangle.n_coord );
+		int32_t n_distance = SIZE_W( s.m_packet.FlatRectangle.n_size );
 
 		while( n_distance > 0 )
 		{
@@ -2301,45 +2325,45 @@ void psxgpu_device::FrameBufferRectangleDraw()
 	}
 }
 
-void psxgpu_device::FlatRectangle()
+void psxgpu_device::FlatRectangle( psxgpu_draw_state &s )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 8 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + n_drawoffset_x + SIZE_W( m_packet.FlatRectangle.n_size ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + n_drawoffset_y + SIZE_H( m_packet.FlatRectangle.n_size ) );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle.n_coord ) + n_drawoffset_x + SIZE_W( m_packet.FlatRectangle.n_size ), S11_COORD_Y( m_packet.FlatRectangle.n_coord ) + n_drawoffset_y + SIZE_H( m_packet.FlatRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatRectangle.n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.FlatRectangle.n_coord ) + s.n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatRectangle.n_coord ) + s.n_drawoffset_x + SIZE_W( s.m_packet.FlatRectangle.n_size ), S11_COORD_Y( s.m_packet.FlatRectangle.n_coord ) + s.n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatRectangle.n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.FlatRectangle.n_coord ) + s.n_drawoffset_y + SIZE_H( s.m_packet.FlatRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatRectangle.n_coord ) + s.n_drawoffset_x + SIZE_W( s.m_packet.FlatRectangle.n_size ), S11_COORD_Y( s.m_packet.FlatRectangle.n_coord ) + s.n_drawoffset_y + SIZE_H( s.m_packet.FlatRectangle.n_size ) );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatRectangle.n_bgr );
+	uint8_t n_cmd = BGR_C( s.m_packet.FlatRectangle.n_bgr );
 
 	SOLIDSETUP
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatRectangle.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( s.m_packet.FlatRectangle.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( s.m_packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( s.m_packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.FlatRectangle.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.FlatRectangle.n_coord );
-	int32_t n_h = SIZE_H( m_packet.FlatRectangle.n_size );
+	int16_t n_x = S11_COORD_X( s.m_packet.FlatRectangle.n_coord );
+	int16_t n_y = S11_COORD_Y( s.m_packet.FlatRectangle.n_coord );
+	int32_t n_h = SIZE_H( s.m_packet.FlatRectangle.n_size );
 
 	while( n_h > 0 )
 	{
-		int32_t n_distance = SIZE_W( m_packet.FlatRectangle.n_size );
-		int drawy = n_y + n_drawoffset_y;
+		int32_t n_distance = SIZE_W( s.m_packet.FlatRectangle.n_size );
+		int drawy = n_y + s.n_drawoffset_y;
 
-		if( n_distance > 0 && drawy >= (int32_t)n_drawarea_y1 && drawy <= (int32_t)n_drawarea_y2 )
+		if( n_distance > 0 && drawy >= (int32_t)s.n_drawarea_y1 && drawy <= (int32_t)s.n_drawarea_y2 )
 		{
-			int drawx = n_x + n_drawoffset_x;
+			int drawx = n_x + s.n_drawoffset_x;
 
-			if( ( (int32_t)n_drawarea_x1 - drawx ) > 0 )
+			if( ( (int32_t)s.n_drawarea_x1 - drawx ) > 0 )
 			{
-				n_distance -= ( n_drawarea_x1 - drawx );
-				drawx = n_drawarea_x1;
+				n_distance -= ( s.n_drawarea_x1 - drawx );
+				drawx = s.n_drawarea_x1;
 			}
 
 			SOLIDFILL( FLATRECTANGEUPDATE )
@@ -2350,45 +2374,45 @@ void psxgpu_device::FlatRectangle()
 	}
 }
 
-void psxgpu_device::FlatRectangle8x8()
+void psxgpu_device::FlatRectangle8x8( psxgpu_draw_state &s )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 9 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x + 8, S11_COORD_Y( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y + 8 );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_x + 8, S11_COORD_Y( m_packet.FlatRectangle8x8.n_coord ) + n_drawoffset_y + 8 );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatRectangle8x8.n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.FlatRectangle8x8.n_coord ) + s.n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatRectangle8x8.n_coord ) + s.n_drawoffset_x + 8, S11_COORD_Y( s.m_packet.FlatRectangle8x8.n_coord ) + s.n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatRectangle8x8.n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.FlatRectangle8x8.n_coord ) + s.n_drawoffset_y + 8 );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatRectangle8x8.n_coord ) + s.n_drawoffset_x + 8, S11_COORD_Y( s.m_packet.FlatRectangle8x8.n_coord ) + s.n_drawoffset_y + 8 );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatRectangle8x8.n_bgr );
+	uint8_t n_cmd = BGR_C( s.m_packet.FlatRectangle8x8.n_bgr );
 
 	SOLIDSETUP
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatRectangle8x8.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatRectangle8x8.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatRectangle8x8.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( s.m_packet.FlatRectangle8x8.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( s.m_packet.FlatRectangle8x8.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( s.m_packet.FlatRectangle8x8.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.FlatRectangle8x8.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.FlatRectangle8x8.n_coord );
+	int16_t n_x = S11_COORD_X( s.m_packet.FlatRectangle8x8.n_coord );
+	int16_t n_y = S11_COORD_Y( s.m_packet.FlatRectangle8x8.n_coord );
 	int32_t n_h = 8;
 
 	while( n_h > 0 )
 	{
 		int32_t n_distance = 8;
-		int drawy = n_y + n_drawoffset_y;
+		int drawy = n_y + s.n_drawoffset_y;
 
-		if( n_distance > 0 && drawy >= (int32_t)n_drawarea_y1 && drawy <= (int32_t)n_drawarea_y2 )
+		if( n_distance > 0 && drawy >= (int32_t)s.n_drawarea_y1 && drawy <= (int32_t)s.n_drawarea_y2 )
 		{
-			int drawx = n_x + n_drawoffset_x;
+			int drawx = n_x + s.n_drawoffset_x;
 
-			if( ( (int32_t)n_drawarea_x1 - drawx ) > 0 )
+			if( ( (int32_t)s.n_drawarea_x1 - drawx ) > 0 )
 			{
-				n_distance -= ( n_drawarea_x1 - drawx );
-				drawx = n_drawarea_x1;
+				n_distance -= ( s.n_drawarea_x1 - drawx );
+				drawx = s.n_drawarea_x1;
 			}
 
 			SOLIDFILL( FLATRECTANGEUPDATE )
@@ -2399,45 +2423,45 @@ void psxgpu_device::FlatRectangle8x8()
 	}
 }
 
-void psxgpu_device::FlatRectangle16x16()
+void psxgpu_device::FlatRectangle16x16( psxgpu_draw_state &s )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 10 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x + 16, S11_COORD_Y( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y + 16 );
-	DebugMesh( S11_COORD_X( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_x + 16, S11_COORD_Y( m_packet.FlatRectangle16x16.n_coord ) + n_drawoffset_y + 16 );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatRectangle16x16.n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.FlatRectangle16x16.n_coord ) + s.n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatRectangle16x16.n_coord ) + s.n_drawoffset_x + 16, S11_COORD_Y( s.m_packet.FlatRectangle16x16.n_coord ) + s.n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatRectangle16x16.n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.FlatRectangle16x16.n_coord ) + s.n_drawoffset_y + 16 );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatRectangle16x16.n_coord ) + s.n_drawoffset_x + 16, S11_COORD_Y( s.m_packet.FlatRectangle16x16.n_coord ) + s.n_drawoffset_y + 16 );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatRectangle16x16.n_bgr );
+	uint8_t n_cmd = BGR_C( s.m_packet.FlatRectangle16x16.n_bgr );
 
 	SOLIDSETUP
 
-	PAIR n_r; n_r.w.h = BGR_R( m_packet.FlatRectangle16x16.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = BGR_G( m_packet.FlatRectangle16x16.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = BGR_B( m_packet.FlatRectangle16x16.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = BGR_R( s.m_packet.FlatRectangle16x16.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = BGR_G( s.m_packet.FlatRectangle16x16.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = BGR_B( s.m_packet.FlatRectangle16x16.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.FlatRectangle16x16.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.FlatRectangle16x16.n_coord );
+	int16_t n_x = S11_COORD_X( s.m_packet.FlatRectangle16x16.n_coord );
+	int16_t n_y = S11_COORD_Y( s.m_packet.FlatRectangle16x16.n_coord );
 	int32_t n_h = 16;
 
 	while( n_h > 0 )
 	{
 		int32_t n_distance = 16;
-		int drawy = n_y + n_drawoffset_y;
+		int drawy = n_y + s.n_drawoffset_y;
 
-		if( n_distance > 0 && n_y >= (int32_t)n_drawarea_y1 && n_y <= (int32_t)n_drawarea_y2 )
+		if( n_distance > 0 && n_y >= (int32_t)s.n_drawarea_y1 && n_y <= (int32_t)s.n_drawarea_y2 )
 		{
-			int drawx = n_x + n_drawoffset_x;
+			int drawx = n_x + s.n_drawoffset_x;
 
-			if( ( (int32_t)n_drawarea_x1 - drawx ) > 0 )
+			if( ( (int32_t)s.n_drawarea_x1 - drawx ) > 0 )
 			{
-				n_distance -= ( n_drawarea_x1 - drawx );
-				drawx = n_drawarea_x1;
+				n_distance -= ( s.n_drawarea_x1 - drawx );
+				drawx = s.n_drawarea_x1;
 			}
 
 			SOLIDFILL( FLATRECTANGEUPDATE )
@@ -2448,52 +2472,52 @@ void psxgpu_device::FlatRectangle16x16()
 	}
 }
 
-void psxgpu_device::FlatTexturedRectangle()
+void psxgpu_device::FlatTexturedRectangle( psxgpu_draw_state &s )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 11 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x + SIZE_W( m_packet.FlatTexturedRectangle.n_size ), S11_COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y + SIZE_H( m_packet.FlatTexturedRectangle.n_size ) );
-	DebugMesh( S11_COORD_X( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_x + SIZE_W( m_packet.FlatTexturedRectangle.n_size ), S11_COORD_Y( m_packet.FlatTexturedRectangle.n_coord ) + n_drawoffset_y + SIZE_H( m_packet.FlatTexturedRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatTexturedRectangle.n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.FlatTexturedRectangle.n_coord ) + s.n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatTexturedRectangle.n_coord ) + s.n_drawoffset_x + SIZE_W( s.m_packet.FlatTexturedRectangle.n_size ), S11_COORD_Y( s.m_packet.FlatTexturedRectangle.n_coord ) + s.n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatTexturedRectangle.n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.FlatTexturedRectangle.n_coord ) + s.n_drawoffset_y + SIZE_H( s.m_packet.FlatTexturedRectangle.n_size ) );
+	DebugMesh( S11_COORD_X( s.m_packet.FlatTexturedRectangle.n_coord ) + s.n_drawoffset_x + SIZE_W( s.m_packet.FlatTexturedRectangle.n_size ), S11_COORD_Y( s.m_packet.FlatTexturedRectangle.n_coord ) + s.n_drawoffset_y + SIZE_H( s.m_packet.FlatTexturedRectangle.n_size ) );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.FlatTexturedRectangle.n_bgr );
+	uint8_t n_cmd = BGR_C( s.m_packet.FlatTexturedRectangle.n_bgr );
 
-	uint32_t n_clutx = ( m_packet.FlatTexturedRectangle.n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.FlatTexturedRectangle.n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( s.m_packet.FlatTexturedRectangle.n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( s.m_packet.FlatTexturedRectangle.n_texture.w.h >> 6 ) & 0x3ff;
 
 	TEXTURESETUP
 	SPRITESETUP
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.FlatTexturedRectangle.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.FlatTexturedRectangle.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.FlatTexturedRectangle.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( s.m_packet.FlatTexturedRectangle.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( s.m_packet.FlatTexturedRectangle.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( s.m_packet.FlatTexturedRectangle.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.FlatTexturedRectangle.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.FlatTexturedRectangle.n_coord );
-	uint8_t n_v = TEXTURE_V( m_packet.FlatTexturedRectangle.n_texture );
-	uint32_t n_h = SIZE_H( m_packet.FlatTexturedRectangle.n_size );
+	int16_t n_x = S11_COORD_X( s.m_packet.FlatTexturedRectangle.n_coord );
+	int16_t n_y = S11_COORD_Y( s.m_packet.FlatTexturedRectangle.n_coord );
+	uint8_t n_v = TEXTURE_V( s.m_packet.FlatTexturedRectangle.n_texture );
+	uint32_t n_h = SIZE_H( s.m_packet.FlatTexturedRectangle.n_size );
 
 	while( n_h > 0 )
 	{
-		uint8_t n_u = TEXTURE_U( m_packet.FlatTexturedRectangle.n_texture );
-		int16_t n_distance = SIZE_W( m_packet.FlatTexturedRectangle.n_size );
-		int drawy = n_y + n_drawoffset_y;
+		uint8_t n_u = TEXTURE_U( s.m_packet.FlatTexturedRectangle.n_texture );
+		int16_t n_distance = SIZE_W( s.m_packet.FlatTexturedRectangle.n_size );
+		int drawy = n_y + s.n_drawoffset_y;
 
-		if( n_distance > 0 && drawy >= (int32_t)n_drawarea_y1 && drawy <= (int32_t)n_drawarea_y2 )
+		if( n_distance > 0 && drawy >= (int32_t)s.n_drawarea_y1 && drawy <= (int32_t)s.n_drawarea_y2 )
 		{
-			int drawx = n_x + n_drawoffset_x;
+			int drawx = n_x + s.n_drawoffset_x;
 
-			if( ( (int32_t)n_drawarea_x1 - drawx ) > 0 )
+			if( ( (int32_t)s.n_drawarea_x1 - drawx ) > 0 )
 			{
-				n_u += ( n_drawarea_x1 - drawx ) * n_du;
-				n_distance -= ( n_drawarea_x1 - drawx );
-				drawx = n_drawarea_x1;
+				n_u += ( s.n_drawarea_x1 - drawx ) * n_du;
+				n_distance -= ( s.n_drawarea_x1 - drawx );
+				drawx = s.n_drawarea_x1;
 			}
 
 			TEXTUREFILL( FLATTEXTUREDRECTANGLEUPDATE, n_u, n_v );
@@ -2505,53 +2529,53 @@ void psxgpu_device::FlatTexturedRectangle()
 	}
 }
 
-void psxgpu_device::Sprite8x8()
+void psxgpu_device::Sprite8x8( psxgpu_draw_state &s )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 12 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.Sprite8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.Sprite8x8.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.Sprite8x8.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( m_packet.Sprite8x8.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.Sprite8x8.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.Sprite8x8.n_coord ) + n_drawoffset_y + 7 );
-	DebugMesh( S11_COORD_X( m_packet.Sprite8x8.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( m_packet.Sprite8x8.n_coord ) + n_drawoffset_y + 7 );
+	DebugMesh( S11_COORD_X( s.m_packet.Sprite8x8.n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.Sprite8x8.n_coord ) + s.n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.Sprite8x8.n_coord ) + s.n_drawoffset_x + 7, S11_COORD_Y( s.m_packet.Sprite8x8.n_coord ) + s.n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.Sprite8x8.n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.Sprite8x8.n_coord ) + s.n_drawoffset_y + 7 );
+	DebugMesh( S11_COORD_X( s.m_packet.Sprite8x8.n_coord ) + s.n_drawoffset_x + 7, S11_COORD_Y( s.m_packet.Sprite8x8.n_coord ) + s.n_drawoffset_y + 7 );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.Sprite8x8.n_bgr );
+	uint8_t n_cmd = BGR_C( s.m_packet.Sprite8x8.n_bgr );
 
-	uint32_t n_clutx = ( m_packet.Sprite8x8.n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.Sprite8x8.n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( s.m_packet.Sprite8x8.n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( s.m_packet.Sprite8x8.n_texture.w.h >> 6 ) & 0x3ff;
 
 	TEXTURESETUP
 	SPRITESETUP
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.Sprite8x8.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.Sprite8x8.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.Sprite8x8.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( s.m_packet.Sprite8x8.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( s.m_packet.Sprite8x8.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( s.m_packet.Sprite8x8.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.Sprite8x8.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.Sprite8x8.n_coord );
-	uint8_t n_v = TEXTURE_V( m_packet.Sprite8x8.n_texture );
+	int16_t n_x = S11_COORD_X( s.m_packet.Sprite8x8.n_coord );
+	int16_t n_y = S11_COORD_Y( s.m_packet.Sprite8x8.n_coord );
+	uint8_t n_v = TEXTURE_V( s.m_packet.Sprite8x8.n_texture );
 	uint32_t n_h = 8;
 
 	while( n_h > 0 )
 	{
-		uint8_t n_u = TEXTURE_U( m_packet.Sprite8x8.n_texture );
+		uint8_t n_u = TEXTURE_U( s.m_packet.Sprite8x8.n_texture );
 		int16_t n_distance = 8;
 
-		int drawy = n_y + n_drawoffset_y;
+		int drawy = n_y + s.n_drawoffset_y;
 
-		if( n_distance > 0 && drawy >= (int32_t)n_drawarea_y1 && drawy <= (int32_t)n_drawarea_y2 )
+		if( n_distance > 0 && drawy >= (int32_t)s.n_drawarea_y1 && drawy <= (int32_t)s.n_drawarea_y2 )
 		{
-			int drawx = n_x + n_drawoffset_x;
+			int drawx = n_x + s.n_drawoffset_x;
 
-			if( ( (int32_t)n_drawarea_x1 - drawx ) > 0 )
+			if( ( (int32_t)s.n_drawarea_x1 - drawx ) > 0 )
 			{
-				n_u += ( n_drawarea_x1 - drawx ) * n_du;
-				n_distance -= ( n_drawarea_x1 - drawx );
-				drawx = n_drawarea_x1;
+				n_u += ( s.n_drawarea_x1 - drawx ) * n_du;
+				n_distance -= ( s.n_drawarea_x1 - drawx );
+				drawx = s.n_drawarea_x1;
 			}
 
 			TEXTUREFILL( FLATTEXTUREDRECTANGLEUPDATE, n_u, n_v );
@@ -2563,53 +2587,53 @@ void psxgpu_device::Sprite8x8()
 	}
 }
 
-void psxgpu_device::Sprite16x16()
+void psxgpu_device::Sprite16x16( psxgpu_draw_state &s )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 13 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.Sprite16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.Sprite16x16.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.Sprite16x16.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( m_packet.Sprite16x16.n_coord ) + n_drawoffset_y );
-	DebugMesh( S11_COORD_X( m_packet.Sprite16x16.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.Sprite16x16.n_coord ) + n_drawoffset_y + 7 );
-	DebugMesh( S11_COORD_X( m_packet.Sprite16x16.n_coord ) + n_drawoffset_x + 7, S11_COORD_Y( m_packet.Sprite16x16.n_coord ) + n_drawoffset_y + 7 );
+	DebugMesh( S11_COORD_X( s.m_packet.Sprite16x16.n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.Sprite16x16.n_coord ) + s.n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.Sprite16x16.n_coord ) + s.n_drawoffset_x + 7, S11_COORD_Y( s.m_packet.Sprite16x16.n_coord ) + s.n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.Sprite16x16.n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.Sprite16x16.n_coord ) + s.n_drawoffset_y + 7 );
+	DebugMesh( S11_COORD_X( s.m_packet.Sprite16x16.n_coord ) + s.n_drawoffset_x + 7, S11_COORD_Y( s.m_packet.Sprite16x16.n_coord ) + s.n_drawoffset_y + 7 );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.Sprite16x16.n_bgr );
+	uint8_t n_cmd = BGR_C( s.m_packet.Sprite16x16.n_bgr );
 
-	uint32_t n_clutx = ( m_packet.Sprite16x16.n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.Sprite16x16.n_texture.w.h >> 6 ) & 0x3ff;
+	uint32_t n_clutx = ( s.m_packet.Sprite16x16.n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( s.m_packet.Sprite16x16.n_texture.w.h >> 6 ) & 0x3ff;
 
 	TEXTURESETUP
 	SPRITESETUP
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.Sprite16x16.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.Sprite16x16.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.Sprite16x16.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( s.m_packet.Sprite16x16.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( s.m_packet.Sprite16x16.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( s.m_packet.Sprite16x16.n_bgr ); n_b.w.l = 0;
 
-	int16_t n_x = S11_COORD_X( m_packet.Sprite16x16.n_coord );
-	int16_t n_y = S11_COORD_Y( m_packet.Sprite16x16.n_coord );
-	uint8_t n_v = TEXTURE_V( m_packet.Sprite16x16.n_texture );
+	int16_t n_x = S11_COORD_X( s.m_packet.Sprite16x16.n_coord );
+	int16_t n_y = S11_COORD_Y( s.m_packet.Sprite16x16.n_coord );
+	uint8_t n_v = TEXTURE_V( s.m_packet.Sprite16x16.n_texture );
 	uint32_t n_h = 16;
 
 	while( n_h > 0 )
 	{
-		uint8_t n_u = TEXTURE_U( m_packet.Sprite16x16.n_texture );
+		uint8_t n_u = TEXTURE_U( s.m_packet.Sprite16x16.n_texture );
 		int16_t n_distance = 16;
 
-		int drawy = n_y + n_drawoffset_y;
+		int drawy = n_y + s.n_drawoffset_y;
 
-		if( n_distance > 0 && drawy >= (int32_t)n_drawarea_y1 && drawy <= (int32_t)n_drawarea_y2 )
+		if( n_distance > 0 && drawy >= (int32_t)s.n_drawarea_y1 && drawy <= (int32_t)s.n_drawarea_y2 )
 		{
-			int drawx = n_x + n_drawoffset_x;
+			int drawx = n_x + s.n_drawoffset_x;
 
-			if( ( (int32_t)n_drawarea_x1 - drawx ) > 0 )
+			if( ( (int32_t)s.n_drawarea_x1 - drawx ) > 0 )
 			{
-				n_u += ( n_drawarea_x1 - drawx ) * n_du;
-				n_distance -= ( n_drawarea_x1 - drawx );
-				drawx = n_drawarea_x1;
+				n_u += ( s.n_drawarea_x1 - drawx ) * n_du;
+				n_distance -= ( s.n_drawarea_x1 - drawx );
+				drawx = s.n_drawarea_x1;
 			}
 
 			TEXTUREFILL( FLATTEXTUREDRECTANGLEUPDATE, n_u, n_v );
@@ -2621,31 +2645,31 @@ void psxgpu_device::Sprite16x16()
 	}
 }
 
-void psxgpu_device::Dot()
+void psxgpu_device::Dot( psxgpu_draw_state &s )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 14 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.Dot.vertex.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.Dot.vertex.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.Dot.vertex.n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.Dot.vertex.n_coord ) + s.n_drawoffset_y );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.Dot.n_bgr );
-	uint8_t n_r = BGR_R( m_packet.Dot.n_bgr );
-	uint8_t n_g = BGR_G( m_packet.Dot.n_bgr );
-	uint8_t n_b = BGR_B( m_packet.Dot.n_bgr );
-	int32_t n_x = S11_COORD_X( m_packet.Dot.vertex.n_coord );
-	int32_t n_y = S11_COORD_Y( m_packet.Dot.vertex.n_coord );
+	uint8_t n_cmd = BGR_C( s.m_packet.Dot.n_bgr );
+	uint8_t n_r = BGR_R( s.m_packet.Dot.n_bgr );
+	uint8_t n_g = BGR_G( s.m_packet.Dot.n_bgr );
+	uint8_t n_b = BGR_B( s.m_packet.Dot.n_bgr );
+	int32_t n_x = S11_COORD_X( s.m_packet.Dot.vertex.n_coord );
+	int32_t n_y = S11_COORD_Y( s.m_packet.Dot.vertex.n_coord );
 
 	TRANSPARENCYSETUP
 
-	int drawx = n_x + n_drawoffset_x;
-	int drawy = n_y + n_drawoffset_y;
+	int drawx = n_x + s.n_drawoffset_x;
+	int drawy = n_y + s.n_drawoffset_y;
 
-	if( drawx >= (int32_t)n_drawarea_x1 && drawy >= (int32_t)n_drawarea_y1 &&
-		drawx <= (int32_t)n_drawarea_x2 && drawy <= (int32_t)n_drawarea_y2 )
+	if( drawx >= (int32_t)s.n_drawarea_x1 && drawy >= (int32_t)s.n_drawarea_y1 &&
+		drawx <= (int32_t)s.n_drawarea_x2 && drawy <= (int32_t)s.n_drawarea_y2 )
 	{
 		uint16_t *p_vram = p_p_vram[ drawy ] + drawx;
 
@@ -2669,67 +2693,67 @@ void psxgpu_device::Dot()
 	}
 }
 
-void psxgpu_device::TexturedDot()
+void psxgpu_device::TexturedDot( psxgpu_draw_state &s )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if (m_debug.n_skip == 15)
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.TexturedDot.vertex.n_coord ) + n_drawoffset_x, S11_COORD_Y( m_packet.TexturedDot.vertex.n_coord ) + n_drawoffset_y );
+	DebugMesh( S11_COORD_X( s.m_packet.TexturedDot.vertex.n_coord ) + s.n_drawoffset_x, S11_COORD_Y( s.m_packet.TexturedDot.vertex.n_coord ) + s.n_drawoffset_y );
 	DebugMeshEnd();
 #endif
 
-	uint8_t n_cmd = BGR_C( m_packet.TexturedDot.n_bgr );
+	uint8_t n_cmd = BGR_C( s.m_packet.TexturedDot.n_bgr );
 
-	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( m_packet.TexturedDot.n_bgr ); n_r.w.l = 0;
-	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( m_packet.TexturedDot.n_bgr ); n_g.w.l = 0;
-	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( m_packet.TexturedDot.n_bgr ); n_b.w.l = 0;
+	PAIR n_r; n_r.w.h = n_cmd & 0x01 ? 0x80 : BGR_R( s.m_packet.TexturedDot.n_bgr ); n_r.w.l = 0;
+	PAIR n_g; n_g.w.h = n_cmd & 0x01 ? 0x80 : BGR_G( s.m_packet.TexturedDot.n_bgr ); n_g.w.l = 0;
+	PAIR n_b; n_b.w.h = n_cmd & 0x01 ? 0x80 : BGR_B( s.m_packet.TexturedDot.n_bgr ); n_b.w.l = 0;
 
-	int32_t n_x = S11_COORD_X( m_packet.TexturedDot.vertex.n_coord );
-	int32_t n_y = S11_COORD_Y( m_packet.TexturedDot.vertex.n_coord );
-	uint8_t n_u = TEXTURE_U(m_packet.TexturedDot.vertex.n_texture );
-	uint8_t n_v = TEXTURE_V(m_packet.TexturedDot.vertex.n_texture );
-	uint32_t n_clutx = ( m_packet.TexturedDot.vertex.n_texture.w.h & 0x3f ) << 4;
-	uint32_t n_cluty = ( m_packet.TexturedDot.vertex.n_texture.w.h >> 6 ) & 0x3ff;
+	int32_t n_x = S11_COORD_X( s.m_packet.TexturedDot.vertex.n_coord );
+	int32_t n_y = S11_COORD_Y( s.m_packet.TexturedDot.vertex.n_coord );
+	uint8_t n_u = TEXTURE_U(s.m_packet.TexturedDot.vertex.n_texture );
+	uint8_t n_v = TEXTURE_V(s.m_packet.TexturedDot.vertex.n_texture );
+	uint32_t n_clutx = ( s.m_packet.TexturedDot.vertex.n_texture.w.h & 0x3f ) << 4;
+	uint32_t n_cluty = ( s.m_packet.TexturedDot.vertex.n_texture.w.h >> 6 ) & 0x3ff;
 
 	TEXTURESETUP
 
 	int32_t n_distance = 1;
 
-	int drawx = n_x + n_drawoffset_x;
-	int drawy = n_y + n_drawoffset_y;
+	int drawx = n_x + s.n_drawoffset_x;
+	int drawy = n_y + s.n_drawoffset_y;
 
-	if( drawx >= (int32_t)n_drawarea_x1 && drawy >= (int32_t)n_drawarea_y1 &&
-		drawx <= (int32_t)n_drawarea_x2 && drawy <= (int32_t)n_drawarea_y2 )
+	if( drawx >= (int32_t)s.n_drawarea_x1 && drawy >= (int32_t)s.n_drawarea_y1 &&
+		drawx <= (int32_t)s.n_drawarea_x2 && drawy <= (int32_t)s.n_drawarea_y2 )
 	{
 		TEXTUREFILL( {}, n_u, n_v );
 	}
 }
 
-void psxgpu_device::MoveImage()
+void psxgpu_device::MoveImage( psxgpu_draw_state &s )
 {
 #if PSXGPU_DEBUG_VIEWER
 	if( m_debug.n_skip == 16 )
 	{
 		return;
 	}
-	DebugMesh( S11_COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ), S11_COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ) );
-	DebugMesh( S11_COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_W( m_packet.MoveImage.n_size ), S11_COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ) );
-	DebugMesh( S11_COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ), S11_COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ) ) + SIZE_H( m_packet.MoveImage.n_size ) );
-	DebugMesh( S11_COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_W( m_packet.MoveImage.n_size ), S11_COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_H( m_packet.MoveImage.n_size ) );
+	DebugMesh( S11_COORD_X( s.m_packet.MoveImage.vertex[ 1 ].n_coord ), S11_COORD_Y( s.m_packet.MoveImage.vertex[ 1 ].n_coord ) );
+	DebugMesh( S11_COORD_X( s.m_packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_W( s.m_packet.MoveImage.n_size ), S11_COORD_Y( s.m_packet.MoveImage.vertex[ 1 ].n_coord ) );
+	DebugMesh( S11_COORD_X( s.m_packet.MoveImage.vertex[ 1 ].n_coord ), S11_COORD_Y( s.m_packet.MoveImage.vertex[ 1 ].n_coord ) ) + SIZE_H( s.m_packet.MoveImage.n_size ) );
+	DebugMesh( S11_COORD_X( s.m_packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_W( s.m_packet.MoveImage.n_size ), S11_COORD_Y( s.m_packet.MoveImage.vertex[ 1 ].n_coord ) + SIZE_H( s.m_packet.MoveImage.n_size ) );
 	DebugMeshEnd();
 #endif
 
-	int16_t n_srcy = COORD_Y( m_packet.MoveImage.vertex[ 0 ].n_coord );
-	int16_t n_dsty = COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord );
-	int16_t n_h = SIZE_H( m_packet.MoveImage.n_size );
+	int16_t n_srcy = COORD_Y( s.m_packet.MoveImage.vertex[ 0 ].n_coord );
+	int16_t n_dsty = COORD_Y( s.m_packet.MoveImage.vertex[ 1 ].n_coord );
+	int16_t n_h = SIZE_H( s.m_packet.MoveImage.n_size );
 
 	while( n_h > 0 )
 	{
-		int16_t n_srcx = COORD_X( m_packet.MoveImage.vertex[ 0 ].n_coord );
-		int16_t n_dstx = COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord );
-		int16_t n_w = SIZE_W( m_packet.MoveImage.n_size );
+		int16_t n_srcx = COORD_X( s.m_packet.MoveImage.vertex[ 0 ].n_coord );
+		int16_t n_dstx = COORD_X( s.m_packet.MoveImage.vertex[ 1 ].n_coord );
+		int16_t n_w = SIZE_W( s.m_packet.MoveImage.n_size );
 
 		while( n_w > 0 )
 		{
@@ -2746,6 +2770,165 @@ void psxgpu_device::MoveImage()
 	}
 }
 
+static inline bool vram_overlap( const rectangle &a, const rectangle &b )
+{
+	return !a.empty() && !b.empty() &&
+		a.left() <= b.right() && b.left() <= a.right() &&
+		a.top() <= b.bottom() && b.top() <= a.bottom();
+}
+
+rectangle psxgpu_device::vram_rect( int32_t n_x, int32_t n_y, int32_t n_w, int32_t n_h )
+{
+	/* accesses wrap around vram, so a range that crosses an edge is widened to cover it */
+	n_x &= 1023;
+	n_y &= 1023;
+	n_w = std::max( n_w, 1 );
+	n_h = std::max( n_h, 1 );
+	if( n_x + n_w > 1024 )
+	{
+		n_x = 0;
+		n_w = 1024;
+	}
+	if( n_y + n_h > 1024 )
+	{
+		n_y = 0;
+		n_h = 1024;
+	}
+	return rectangle( n_x, n_x + n_w - 1, n_y, n_y + n_h - 1 );
+}
+
+rectangle psxgpu_device::clut_rect( uint32_t n_clut )
+{
+	uint32_t n_clutx = ( n_clut & 0x3f ) << 4;
+	uint32_t n_cluty = ( n_clut >> 6 ) & 0x3ff;
+
+	/* reading past the end of a row carries on into the next one */
+	return vram_rect( n_clutx, n_cluty, 256, n_clutx + 256 > 1024 ? 2 : 1 );
+}
+
+rectangle psxgpu_device::drawarea_rect() const
+{
+	return rectangle( n_drawarea_x1, n_drawarea_x2, n_drawarea_y1, n_drawarea_y2 );
+}
+
+rectangle psxgpu_device::texture_rect() const
+{
+	/* matches TEXTURESETUP, with the whole 256x256 texel range for every depth */
+	int32_t n_tx = m_n_tx + ( n_twx >> ( n_tp < 2 ? 2 - n_tp : 0 ) );
+	int32_t n_ty = m_n_ty + n_twy;
+
+	return vram_rect( n_tx, n_ty, 256, n_tx + 256 > 1024 ? 257 : 256 );
+}
+
+void psxgpu_device::queue_polygon( polygon_func func, int n_points, int n_stride, bool b_textured )
+{
+	rectangle texture( 0, -1, 0, -1 );
+	rectangle clut( 0, -1, 0, -1 );
+	if( b_textured )
+	{
+		decode_tpage( m_packet.n_entry[ 2 + n_stride ] >> 16 );
+		texture = texture_rect();
+		clut = clut_rect( m_packet.n_entry[ 2 ] >> 16 );
+	}
+
+#if PSXGPU_DEBUG_VIEWER
+	( this->*func )( *this, n_points );
+#else
+	/* bounding box of the vertices with a pixel of slack, clipped to the drawing area */
+	rectangle dest;
+	for( int n_point = 0; n_point < n_points; n_point++ )
+	{
+		PAIR n_coord;
+		n_coord.d = m_packet.n_entry[ 1 + ( n_point * n_stride ) ];
+		int32_t n_x = S11_COORD_X( n_coord ) + n_drawoffset_x;
+		int32_t n_y = S11_COORD_Y( n_coord ) + n_drawoffset_y;
+		rectangle const point( n_x - 1, n_x + 1, n_y - 1, n_y + 1 );
+		if( n_point == 0 )
+			dest = point;
+		else
+			dest |= point;
+	}
+	dest &= drawarea_rect();
+
+	/* pick up anything that has already finished, and make room if the queue is full */
+	while( m_n_polytail != m_n_polyhead && osd_work_item_wait( m_polywork[ m_n_polytail % POLYGON_QUEUE_SIZE ].item, 0 ) )
+	{
+		retire_polygons( m_n_polytail + 1 );
+	}
+	if( m_n_polyhead - m_n_polytail >= POLYGON_QUEUE_SIZE )
+	{
+		retire_polygons( m_n_polytail + 1 );
+	}
+
+	polygon_work &work = m_polywork[ m_n_polyhead % POLYGON_QUEUE_SIZE ];
+	work.device = this;
+	work.func = func;
+	work.n_points = n_points;
+	work.dest = dest;
+	work.texture = texture;
+	work.clut = clut;
+	work.state = static_cast<const psxgpu_draw_state &>( *this );
+	work.item = m_polyqueue ? osd_work_item_queue( m_polyqueue, polygon_callback, &work, 0 ) : nullptr;
+	if( !work.item )
+	{
+		wait_polygons();
+		( this->*func )( work.state, n_points );
+		return;
+	}
+
+	if( m_n_polytail == m_n_polyhead )
+		m_polybounds = rectangle( 1024, -1, 1024, -1 );
+	for( const rectangle *rect : { &dest, &texture, &clut } )
+	{
+		if( !rect->empty() )
+			m_polybounds |= *rect;
+	}
+	m_n_polyhead++;
+#endif
+}
+
+void *psxgpu_device::polygon_callback( void *param, int threadid )
+{
+	polygon_work &work = *reinterpret_cast<polygon_work *>( param );
+	( work.device->*work.func )( work.state, work.n_points );
+	return nullptr;
+}
+
+void psxgpu_device::retire_polygons( uint32_t n_end )
+{
+	while( m_n_polytail != n_end )
+	{
+		polygon_work &work = m_polywork[ m_n_polytail % POLYGON_QUEUE_SIZE ];
+		osd_work_item_wait( work.item, 100 * osd_ticks_per_second() );
+		osd_work_item_release( work.item );
+		work.item = nullptr;
+		m_n_polytail++;
+	}
+}
+
+void psxgpu_device::wait_for_vram( const rectangle &write, const rectangle &texture, const rectangle &clut )
+{
+	if( m_n_polytail == m_n_polyhead ||
+		( !vram_overlap( write, m_polybounds ) && !vram_overlap( texture, m_polybounds ) && !vram_overlap( clut, m_polybounds ) ) )
+	{
+		return;
+	}
+
+	/* polygons are drawn in order, so waiting for the newest one this access
+	   depends on also covers everything queued before it */
+	for( uint32_t n_index = m_n_polyhead; n_index != m_n_polytail; )
+	{
+		n_index--;
+		const polygon_work &work = m_polywork[ n_index % POLYGON_QUEUE_SIZE ];
+		if( vram_overlap( write, work.dest ) || vram_overlap( write, work.texture ) || vram_overlap( write, work.clut ) ||
+			vram_overlap( texture, work.dest ) || vram_overlap( clut, work.dest ) )
+		{
+			retire_polygons( n_index + 1 );
+			break;
+		}
+	}
+}
+
 void psxgpu_device::dma_write( uint32_t *p_n_psxram, uint32_t n_address, int32_t n_size )
 {
 	gpu_write( &p_n_psxram[ n_address / 4 ], n_size );
@@ -2776,7 +2959,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: frame buffer rectangle %u,%u %u,%u\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 1 ] & 0xffff, m_packet.n_entry[ 1 ] >> 16, m_packet.n_entry[ 2 ] & 0xffff, m_packet.n_entry[ 2 ] >> 16 );
-				FrameBufferRectangleDraw();
+				wait_for_vram( vram_rect( COORD_X( m_packet.FlatRectangle.n_coord ), COORD_Y( m_packet.FlatRectangle.n_coord ), SIZE_W( m_packet.FlatRectangle.n_size ), SIZE_H( m_packet.FlatRectangle.n_size ) ) );
+				FrameBufferRectangleDraw( *this );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2791,7 +2975,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, machine().describe_context(), "%s: %02x: monochrome 3 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				FlatPolygon( 3 );
+				queue_polygon( &psxgpu_device::FlatPolygon, 3, 1, false );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2806,7 +2990,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: textured 3 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				FlatTexturedPolygon( 3 );
+				queue_polygon( &psxgpu_device::FlatTexturedPolygon, 3, 2, true );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2821,7 +3005,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: monochrome 4 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				FlatPolygon( 4 );
+				queue_polygon( &psxgpu_device::FlatPolygon, 4, 1, false );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2836,7 +3020,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: textured 4 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				FlatTexturedPolygon( 4 );
+				queue_polygon( &psxgpu_device::FlatTexturedPolygon, 4, 2, true );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2851,7 +3035,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud 3 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24 );
-				GouraudPolygon( 3 );
+				queue_polygon( &psxgpu_device::GouraudPolygon, 3, 2, false );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2866,7 +3050,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud textured 3 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				GouraudTexturedPolygon( 3 );
+				queue_polygon( &psxgpu_device::GouraudTexturedPolygon, 3, 3, true );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2881,7 +3065,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud 4 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				GouraudPolygon( 4 );
+				queue_polygon( &psxgpu_device::GouraudPolygon, 4, 2, false );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2896,7 +3080,7 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud textured 4 point polygon\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				GouraudTexturedPolygon( 4 );
+				queue_polygon( &psxgpu_device::GouraudTexturedPolygon, 4, 3, true );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2911,7 +3095,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: monochrome line\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				MonochromeLine();
+				wait_for_vram( drawarea_rect() );
+				MonochromeLine( *this );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2926,7 +3111,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: monochrome polyline\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				MonochromeLine();
+				wait_for_vram( drawarea_rect() );
+				MonochromeLine( *this );
 				if( ( m_packet.n_entry[ 3 ] & 0xf000f000 ) != 0x50005000 )
 				{
 					m_packet.n_entry[ 1 ] = m_packet.n_entry[ 2 ];
@@ -2950,7 +3136,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud line\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				GouraudLine();
+				wait_for_vram( drawarea_rect() );
+				GouraudLine( *this );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -2966,7 +3153,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			else
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: gouraud polyline\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24);
-				GouraudLine();
+				wait_for_vram( drawarea_rect() );
+				GouraudLine( *this );
 				if( ( m_packet.n_entry[ 4 ] & 0xf000f000 ) != 0x50005000 )
 				{
 					m_packet.n_entry[ 0 ] = ( m_packet.n_entry[ 0 ] & 0xff000000 ) | ( m_packet.n_entry[ 2 ] & 0x00ffffff );
@@ -2995,7 +3183,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 					m_packet.n_entry[ 0 ] >> 24,
 					(int16_t)( m_packet.n_entry[ 1 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 1 ] >> 16 ),
 					(int16_t)( m_packet.n_entry[ 2 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 2 ] >> 16 ) );
-				FlatRectangle();
+				wait_for_vram( drawarea_rect() );
+				FlatRectangle( *this );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3014,7 +3203,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 					(int16_t)( m_packet.n_entry[ 1 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 1 ] >> 16 ),
 					m_packet.n_entry[ 3 ] & 0xffff, m_packet.n_entry[ 3 ] >> 16,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 2 ] );
-				FlatTexturedRectangle();
+				wait_for_vram( drawarea_rect(), texture_rect(), clut_rect( m_packet.n_entry[ 2 ] >> 16 ) );
+				FlatTexturedRectangle( *this );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3032,7 +3222,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 					m_packet.n_entry[ 0 ] >> 24,
 					(int16_t)( m_packet.n_entry[ 1 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 1 ] >> 16 ),
 					m_packet.n_entry[ 0 ] & 0xffffff );
-				Dot();
+				wait_for_vram( drawarea_rect() );
+				Dot( *this );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3050,7 +3241,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 					m_packet.n_entry[ 0 ] >> 24,
 					(int16_t)( m_packet.n_entry[ 1 ] & 0xffff ), (int16_t)( m_packet.n_entry[ 1 ] >> 16 ),
 					m_packet.n_entry[ 0 ] & 0xffffff );
-				TexturedDot();
+				wait_for_vram( drawarea_rect(), texture_rect(), clut_rect( m_packet.n_entry[ 2 ] >> 16 ) );
+				TexturedDot( *this );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3067,7 +3259,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s; %02x: 16x16 rectangle %08x %08x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ] );
-				FlatRectangle8x8();
+				wait_for_vram( drawarea_rect() );
+				FlatRectangle8x8( *this );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3083,7 +3276,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: 8x8 sprite %08x %08x %08x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ], m_packet.n_entry[ 2 ] );
-				Sprite8x8();
+				wait_for_vram( drawarea_rect(), texture_rect(), clut_rect( m_packet.n_entry[ 2 ] >> 16 ) );
+				Sprite8x8( *this );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3100,7 +3294,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: 16x16 rectangle %08x %08x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ] );
-				FlatRectangle16x16();
+				wait_for_vram( drawarea_rect() );
+				FlatRectangle16x16( *this );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3116,7 +3311,8 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s: %02x: 16x16 sprite %08x %08x %08x\n", machine().describe_context(), m_packet.n_entry[ 0 ] >> 24,
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ], m_packet.n_entry[ 2 ] );
-				Sprite16x16();
+				wait_for_vram( drawarea_rect(), texture_rect(), clut_rect( m_packet.n_entry[ 2 ] >> 16 ) );
+				Sprite16x16( *this );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3129,7 +3325,10 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			{
 				LOGMASKED(LOG_WRITE, "%s: move image in frame buffer %08x %08x %08x %08x\n", machine().describe_context(),
 					m_packet.n_entry[ 0 ], m_packet.n_entry[ 1 ], m_packet.n_entry[ 2 ], m_packet.n_entry[ 3 ]);
-				MoveImage();
+				wait_for_vram(
+					vram_rect( COORD_X( m_packet.MoveImage.vertex[ 1 ].n_coord ), COORD_Y( m_packet.MoveImage.vertex[ 1 ].n_coord ), SIZE_W( m_packet.MoveImage.n_size ), SIZE_H( m_packet.MoveImage.n_size ) ),
+					vram_rect( COORD_X( m_packet.MoveImage.vertex[ 0 ].n_coord ), COORD_Y( m_packet.MoveImage.vertex[ 0 ].n_coord ), SIZE_W( m_packet.MoveImage.n_size ), SIZE_H( m_packet.MoveImage.n_size ) ) );
+				MoveImage( *this );
 				n_gpu_buffer_offset = 0;
 			}
 			break;
@@ -3137,9 +3336,14 @@ void psxgpu_device::gpu_write( uint32_t *p_ram, int32_t n_size )
 			if( n_gpu_buffer_offset < 3 )
 			{
 				n_gpu_buffer_offset++;
+				if( n_gpu_buffer_offset == 3 )
+				{
+					wait_for_vram( vram_rect( m_packet.n_entry[ 1 ] & 0xffff, m_packet.n_entry[ 1 ] >> 16, m_packet.n_entry[ 2 ] & 0xffff, m_packet.n_entry[ 2 ] >> 16 ) );
+				}
 			}
 			else
 			{
+				psxgpu_draw_state &s = *this;
 				for( int n_pixel = 0; n_pixel < 2; n_pixel++ )
 				{
 					LOGMASKED(LOG_WRITE, "%s: send image to framebuffer ( pixel %u,%u = %u )\n",
@@ -3407,6 +3611,11 @@ void psxgpu_device::dma_read( uint32_t *p_n_psxram, uint32_t n_address, int32_t
 
 void psxgpu_device::gpu_read( uint32_t *p_ram, int32_t n_size )
 {
+	if( ( n_gpustatus & ( 1L << 0x1b ) ) != 0 )
+	{
+		wait_for_vram( rectangle( 0, -1, 0, -1 ), vram_rect( m_packet.n_entry[ 1 ] & 0xffff, m_packet.n_entry[ 1 ] >> 16, m_packet.n_entry[ 2 ] & 0xffff, m_packet.n_entry[ 2 ] >> 16 ) );
+	}
+
 	while( n_size > 0 )
 	{
 		if( ( n_gpustatus & ( 1L << 0x1b ) ) != 0 )
@@ -23,57 +23,10 @@ DECLARE_DEVICE_TYPE(CXD8654Q,  cxd8654q_device)
 
 class psxcpu_device;
 
-class psxgpu_device : public device_t, public device_video_interface, public device_palette_interface
+// state read while drawing a primitive; each polygon queued for the worker
+// thread carries its own copy so later commands can't change it mid-draw
+struct psxgpu_draw_state
 {
-public:
-	// configuration helpers
-	auto vblank_callback() { return m_vblank_handler.bind(); }
-	void set_vram_size(int size) { vramSize = size; }
-
-	void write(offs_t offset, uint32_t data, uint32_t mem_mask = ~0);
-	uint32_t read(offs_t offset, uint32_t mem_mask = ~0);
-	void dma_read( uint32_t *ram, uint32_t n_address, int32_t n_size );
-	void dma_write( uint32_t *ram, uint32_t n_address, int32_t n_size );
-	void lightgun_set( int, int );
-
-	static constexpr feature_type imperfect_features() { return feature::GRAPHICS; }
-
-protected:
-	static constexpr unsigned MAX_LEVEL = 32;
-	static constexpr unsigned MID_LEVEL = (MAX_LEVEL / 2) << 8;
-	static constexpr unsigned MAX_SHADE = 0x100;
-	static constexpr unsigned MID_SHADE = 0x80;
-
-	// construction/destruction
-	psxgpu_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock, uint32_t vram_size, psxcpu_device *cpu_tag);
-	psxgpu_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
-
-	virtual void device_start() override;
-	virtual void device_post_load() override;
-	virtual void device_reset() override;
-	virtual void device_config_complete() override;
-
-	// device_palette_interface overrides
-	virtual uint32_t palette_entries() const noexcept override { return 32*32*32*2; }
-
-	int vramSize;
-
-private:
-	static constexpr unsigned DEBUG_COORDS = 10;
-
-	struct psx_gpu_debug
-	{
-		std::unique_ptr<bitmap_ind16> mesh;
-		int b_clear;
-		int b_mesh;
-		int n_skip;
-		int b_texture;
-		int n_interleave;
-		int n_coord;
-		int n_coordx[ DEBUG_COORDS ];
-		int n_coordy[ DEBUG_COORDS ];
-	};
-
 	struct FLATVERTEX
 	{
 		PAIR n_coord;
@@ -196,28 +149,7 @@ private:
 		} TexturedDot;
 	};
 
-	void updatevisiblearea();
-	void decode_tpage( uint32_t tpage );
-	void FlatPolygon( int n_points );
-	void FlatTexturedPolygon( int n_points );
-	void GouraudPolygon( int n_points );
-	void GouraudTexturedPolygon( int n_points );
-	void MonochromeLine();
-	void GouraudLine();
-	void FrameBufferRectangleDraw();
-	void FlatRectangle();
-	void FlatRectangle8x8();
-	void FlatRectangle16x16();
-	void FlatTexturedRectangle();
-	void Sprite8x8();
-	void Sprite16x16();
-	void Dot();
-	void TexturedDot();
-	void MoveImage();
-	void psx_gpu_init( int n_gputype );
-	void gpu_reset();
-	void gpu_read( uint32_t *p_ram, int32_t n_size );
-	void gpu_write( uint32_t *p_ram, int32_t n_size );
+	PACKET m_packet;
 
 	int32_t m_n_tx;
 	int32_t m_n_ty;
@@ -227,9 +159,6 @@ private:
 	int32_t n_iy;
 	int32_t n_ti;
 
-	std::unique_ptr<uint16_t[]> p_vram;
-	uint32_t n_vramx;
-	uint32_t n_vramy;
 	uint32_t n_twy;
 	uint32_t n_twx;
 	uint32_t n_twh;
@@ -238,13 +167,108 @@ private:
 	uint32_t n_drawarea_y1;
 	uint32_t n_drawarea_x2;
 	uint32_t n_drawarea_y2;
+	int32_t n_drawoffset_x;
+	int32_t n_drawoffset_y;
+	bool m_draw_stp;
+	bool m_check_stp;
+};
+
+class psxgpu_device : public device_t, public device_video_interface, public device_palette_interface, protected psxgpu_draw_state
+{
+public:
+	// configuration helpers
+	auto vblank_callback() { return m_vblank_handler.bind(); }
+	void set_vram_size(int size) { vramSize = size; }
+
+	void write(offs_t offset, uint32_t data, uint32_t mem_mask = ~0);
+	uint32_t read(offs_t offset, uint32_t mem_mask = ~0);
+	void dma_read( uint32_t *ram, uint32_t n_address, int32_t n_size );
+	void dma_write( uint32_t *ram, uint32_t n_address, int32_t n_size );
+	void lightgun_set( int, int );
+
+	static constexpr feature_type imperfect_features() { return feature::GRAPHICS; }
+
+protected:
+	static constexpr unsigned MAX_LEVEL = 32;
+	static constexpr unsigned MID_LEVEL = (MAX_LEVEL / 2) << 8;
+	static constexpr unsigned MAX_SHADE = 0x100;
+	static constexpr unsigned MID_SHADE = 0x80;
+
+	// construction/destruction
+	psxgpu_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock, uint32_t vram_size, psxcpu_device *cpu_tag);
+	psxgpu_device(const machine_config &mconfig, device_type type, const char *tag, device_t *owner, uint32_t clock);
+
+	virtual void device_start() override;
+	virtual void device_pre_save() override;
+	virtual void device_post_load() override;
+	virtual void device_reset() override;
+	virtual void device_stop() override;
+	virtual void device_config_complete() override;
+
+	// device_palette_interface overrides
+	virtual uint32_t palette_entries() const noexcept override { return 32*32*32*2; }
+
+	int vramSize;
+
+private:
+	static constexpr unsigned DEBUG_COORDS = 10;
+
+	struct psx_gpu_debug
+	{
+		std::unique_ptr<bitmap_ind16> mesh;
+		int b_clear;
+		int b_mesh;
+		int n_skip;
+		int b_texture;
+		int n_interleave;
+		int n_coord;
+		int n_coordx[ DEBUG_COORDS ];
+		int n_coordy[ DEBUG_COORDS ];
+	};
+
+	void updatevisiblearea();
+	void decode_tpage( uint32_t tpage );
+	void FlatPolygon( psxgpu_draw_state &s, int n_points );
+	void FlatTexturedPolygon( psxgpu_draw_state &s, int n_points );
+	void GouraudPolygon( psxgpu_draw_state &s, int n_points );
+	void GouraudTexturedPolygon( psxgpu_draw_state &s, int n_points );
+	void MonochromeLine( psxgpu_draw_state &s );
+	void GouraudLine( psxgpu_draw_state &s );
+	void FrameBufferRectangleDraw( psxgpu_draw_state &s );
+	void FlatRectangle( psxgpu_draw_state &s );
+	void FlatRectangle8x8( psxgpu_draw_state &s );
+	void FlatRectangle16x16( psxgpu_draw_state &s );
+	void FlatTexturedRectangle( psxgpu_draw_state &s );
+	void Sprite8x8( psxgpu_draw_state &s );
+	void Sprite16x16( psxgpu_draw_state &s );
+	void Dot( psxgpu_draw_state &s );
+	void TexturedDot( psxgpu_draw_state &s );
+	void MoveImage( psxgpu_draw_state &s );
+
+	typedef void ( psxgpu_device::*polygon_func )( psxgpu_draw_state &s, int n_points );
+	void queue_polygon( polygon_func func, int n_points, int n_stride, bool b_textured );
+	static void *polygon_callback( void *param, int threadid );
+	void retire_polygons( uint32_t n_end );
+	void wait_polygons() { retire_polygons( m_n_polyhead ); }
+	void wait_for_vram( const rectangle &write, const rectangle &texture = rectangle( 0, -1, 0, -1 ), const rectangle &clut = rectangle( 0, -1, 0, -1 ) );
+	static rectangle vram_rect( int32_t n_x, int32_t n_y, int32_t n_w, int32_t n_h );
+	static rectangle clut_rect( uint32_t n_clut );
+	rectangle drawarea_rect() const;
+	rectangle texture_rect() const;
+	void psx_gpu_init( int n_gputype );
+	void gpu_reset();
+	void gpu_read( uint32_t *p_ram, int32_t n_size );
+	void gpu_write( uint32_t *p_ram, int32_t n_size );
+
+
+	std::unique_ptr<uint16_t[]> p_vram;
+	uint32_t n_vramx;
+	uint32_t n_vramy;
 	uint32_t n_horiz_disstart;
 	uint32_t n_horiz_disend;
 	uint32_t n_vert_disstart;
 	uint32_t n_vert_disend;
 	uint32_t b_reverseflag;
-	int32_t n_drawoffset_x;
-	int32_t n_drawoffset_y;
 	uint32_t m_n_displaystartx;
 	uint32_t n_displaystarty;
 	int m_n_gputype;
@@ -255,10 +279,6 @@ private:
 	uint32_t n_lightgun_y;
 	uint32_t n_screenwidth;
 	uint32_t n_screenheight;
-	bool m_draw_stp;
-	bool m_check_stp;
-
-	PACKET m_packet;
 
 	uint16_t *p_p_vram[ 1024 ];
 
@@ -290,6 +310,28 @@ private:
 	uint32_t p_n_r1[ 0x10000 ];
 	uint32_t p_n_b1g1[ 0x10000 ];
 
+	// polygons queued for the worker thread; the regions each one writes and
+	// reads are kept so that only overlapping VRAM accesses have to wait
+	static constexpr unsigned POLYGON_QUEUE_SIZE = 256;
+
+	struct polygon_work
+	{
+		psxgpu_device *device;
+		osd_work_item *item;
+		polygon_func func;
+		int n_points;
+		rectangle dest;
+		rectangle texture;
+		rectangle clut;
+		psxgpu_draw_state state;
+	};
+
+	std::unique_ptr<polygon_work[]> m_polywork;
+	osd_work_queue *m_polyqueue;
+	uint32_t m_n_polyhead;
+	uint32_t m_n_polytail;
+	rectangle m_polybounds;
+
 	devcb_write_line m_vblank_handler;
 
 	void vblank(screen_device &screen, bool vblank_state);
@@ -585,8 +585,15 @@ TIMER_CALLBACK_MEMBER(s3virge_vga_device::op_timer_cb)
 				if (m_xfer_fifo.empty())
 					return;
 				m_bitblt.image_xfer = m_xfer_fifo.dequeue();
+				bitblt_step();
+			}
+			else
+			{
+				// VRAM sourced blits don't wait on the host, so process a batch of
+				// steps per tick rather than paying for a timer callback per pixel
+				for (int i = 0; (i < BITBLT_STEPS_PER_TICK) && (m_s3d_state == S3D_STATE_BITBLT); i++)
+					bitblt_step();
 			}
-			bitblt_step();
 			break;
 		case S3D_STATE_2DLINE:
 			line2d_step();
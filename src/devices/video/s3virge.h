@@ -97,6 +97,8 @@ protected:
 		S3D_STATE_3DPOLY
 	};
 
+	static constexpr int BITBLT_STEPS_PER_TICK = 16;
+
 	struct {
 		u8 psidf = 0;
 		u8 pshfc = 0;
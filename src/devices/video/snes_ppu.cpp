@@ -193,6 +193,9 @@ snes_ppu_device::snes_ppu_device(const machine_config &mconfig, const char *tag,
 	: device_t(mconfig, SNES_PPU, tag, owner, clock)
 	, device_video_interface(mconfig, *this)
 	, device_palette_interface(mconfig, *this)
+	, m_threaded(false)
+	, m_line_queue(nullptr)
+	, m_line_head(0)
 	, m_openbus_cb(*this, 0)
 	, m_options(*this, ":OPTIONS")
 	, m_debug1(*this, ":DEBUG1")
@@ -208,13 +211,16 @@ snes_ppu_device::snes_ppu_device(const machine_config &mconfig, const char *tag,
 
 void snes_ppu_device::device_start()
 {
-	m_vram = std::make_unique<uint8_t[]>(SNES_VRAM_SIZE);
+	m_vram_buffer = std::make_unique<uint8_t[]>(SNES_VRAM_SIZE);
+	m_vram = m_vram_buffer.get();
 	m_cgram = std::make_unique<uint16_t[]>(SNES_CGRAM_SIZE/2);
+	m_cgram_pens = m_cgram.get();
 
-	m_light_table = std::make_unique<std::unique_ptr<uint16_t[]>[]>(16);
+	m_light_table_buffer = std::make_unique<uint16_t[]>(16 * 32768);
+	m_light_table = m_light_table_buffer.get();
 	for (uint8_t l = 0; l < 16; l++)
 	{
-		m_light_table[l] = std::make_unique<uint16_t[]>(32768);
+		uint16_t *const light = &m_light_table_buffer[l * 32768];
 		for (uint8_t r = 0; r < 32; r++)
 		{
 			for (uint8_t g = 0; g < 32; g++)
@@ -225,7 +231,7 @@ void snes_ppu_device::device_start()
 					uint8_t ar = (uint8_t)(luma * r + 0.5);
 					uint8_t ag = (uint8_t)(luma * g + 0.5);
 					uint8_t ab = (uint8_t)(luma * b + 0.5);
-					m_light_table[l][r << 0 | g << 5 | b << 10] = ar << 0 | ag << 5 | ab << 10;
+					light[r << 0 | g << 5 | b << 10] = ar << 0 | ag << 5 | ab << 10;
 				}
 			}
 		}
@@ -249,6 +255,15 @@ void snes_ppu_device::device_start()
 		}
 	}
 
+	// the worker renderer shares VRAM, which is only written once queued lines are finished
+	if (m_threaded)
+	{
+		m_line_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_HIGH_FREQ);
+		m_line_jobs = std::make_unique<line_job[]>(LINE_QUEUE_SIZE);
+		m_line_renderer.m_vram = m_vram;
+		m_line_renderer.m_light_table = m_light_table;
+	}
+
 	save_item(STRUCT_MEMBER(m_scanlines, enable));
 	save_item(STRUCT_MEMBER(m_scanlines, clip));
 	save_item(STRUCT_MEMBER(m_scanlines, buffer));
@@ -368,6 +383,8 @@ void snes_ppu_device::device_start()
 
 void snes_ppu_device::device_reset()
 {
+	finish_lines();
+
 #if SNES_LAYER_DEBUG
 	memset(&m_debug_options, 0, sizeof(m_debug_options));
 #endif
@@ -401,7 +418,7 @@ void snes_ppu_device::device_reset()
 	}
 
 	/* Init VRAM */
-	memset(m_vram.get(), 0, SNES_VRAM_SIZE);
+	memset(m_vram, 0, SNES_VRAM_SIZE);
 
 	/* Init Palette RAM */
 	memset((uint8_t *)m_cgram.get(), 0, SNES_CGRAM_SIZE);
@@ -409,6 +426,7 @@ void snes_ppu_device::device_reset()
 		set_pen_indirect(i, m_cgram[i]);
 
 	set_pen_indirect(FIXED_COLOUR, 0);
+	m_fixed_colour = 0;
 
 	// other initializations to 0
 	memset(m_regs, 0, sizeof(m_regs));
@@ -450,6 +468,18 @@ void snes_ppu_device::device_reset()
 	}
 }
 
+void snes_ppu_device::device_stop()
+{
+	finish_lines();
+	if (m_line_queue)
+		osd_work_queue_free(m_line_queue);
+}
+
+void snes_ppu_device::device_pre_save()
+{
+	finish_lines();
+}
+
 /*************************************************************************************************
  * SNES tiles
  *
@@ -473,7 +503,7 @@ void snes_ppu_device::device_reset()
  * XNOR: ###...##...###     ...###..###...
  *****************************************/
 
-void snes_ppu_device::render_window(uint16_t layer_idx, uint8_t enable, uint8_t *output)
+void snes_ppu_renderer::render_window(uint16_t layer_idx, uint8_t enable, uint8_t *output)
 {
 	layer_t &self = m_layer[layer_idx];
 	if (!enable || (!self.window1_enabled && !self.window2_enabled))
@@ -535,7 +565,7 @@ void snes_ppu_device::render_window(uint16_t layer_idx, uint8_t enable, uint8_t
  * but in general it works as described.
  *************************************************************************************************/
 
-inline uint32_t snes_ppu_device::get_tile( uint8_t layer_idx, uint32_t hoffset, uint32_t voffset )
+inline uint32_t snes_ppu_renderer::get_tile( uint8_t layer_idx, uint32_t hoffset, uint32_t voffset )
 {
 	layer_t &self = m_layer[layer_idx];
 	bool hires = m_mode == 5 || m_mode == 6;
@@ -559,7 +589,7 @@ inline uint32_t snes_ppu_device::get_tile( uint8_t layer_idx, uint32_t hoffset,
  * priority.
  *********************************************/
 
-inline void snes_ppu_device::plot_above( uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception )
+inline void snes_ppu_renderer::plot_above( uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception )
 {
 	if (priority > m_scanlines[SNES_MAINSCREEN].priority[x])
 	{
@@ -577,7 +607,7 @@ inline void snes_ppu_device::plot_above( uint16_t x, uint8_t source, uint8_t pri
  * priority.
  *********************************************/
 
-inline void snes_ppu_device::plot_below( uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception )
+inline void snes_ppu_renderer::plot_below( uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception )
 {
 	if (priority > m_scanlines[SNES_SUBSCREEN].priority[x])
 	{
@@ -594,7 +624,7 @@ inline void snes_ppu_device::plot_below( uint16_t x, uint8_t source, uint8_t pri
  * Update an entire line of tiles.
  *********************************************/
 
-void snes_ppu_device::update_line( uint16_t curline, uint8_t layer_idx, uint8_t direct_colors )
+void snes_ppu_renderer::update_line( uint16_t curline, uint8_t layer_idx, uint8_t direct_colors )
 {
 	layer_t &layer = m_layer[layer_idx];
 
@@ -749,7 +779,7 @@ void snes_ppu_device::update_line( uint16_t curline, uint8_t layer_idx, uint8_t
 				}
 				else
 				{
-					mosaic_color = pen_indirect((palette_index + mosaic_palette) & 0xff);
+					mosaic_color = m_cgram_pens[(palette_index + mosaic_palette) & 0xff];
 				}
 			}
 			if (!mosaic_palette) continue;
@@ -784,7 +814,7 @@ void snes_ppu_device::update_line( uint16_t curline, uint8_t layer_idx, uint8_t
 
 #define MODE7_CLIP(x) (((x) & 0x2000) ? ((x) | ~0x03ff) : ((x) & 0x03ff))
 
-void snes_ppu_device::update_line_mode7( uint16_t curline, uint8_t layer_idx )
+void snes_ppu_renderer::update_line_mode7( uint16_t curline, uint8_t layer_idx )
 {
 	layer_t &self = m_layer[layer_idx];
 	int _y = self.mosaic_enabled ? self.mosaic_offset : curline;
@@ -847,7 +877,7 @@ void snes_ppu_device::update_line_mode7( uint16_t curline, uint8_t layer_idx )
 			}
 			else
 			{
-				mosaic_color = pen_indirect(palette);
+				mosaic_color = m_cgram_pens[palette];
 			}
 		}
 		if (!mosaic_palette) continue;
@@ -860,11 +890,15 @@ void snes_ppu_device::update_line_mode7( uint16_t curline, uint8_t layer_idx )
 /*********************************************
  * update_objects()
  *
- * Update an entire line of sprites.
+ * Fetch the sprite tiles for a line, which
+ * draw_objects() then renders.
  *********************************************/
 
 void snes_ppu_device::update_objects( uint16_t curline )
 {
+	object_tile *const tiles = m_tiles;
+	memset(tiles, 0, sizeof(object_tile) * 34);
+
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.bg_disabled[SNES_OAM])
 		return;
@@ -873,17 +907,10 @@ void snes_ppu_device::update_objects( uint16_t curline )
 	if (!m_layer[SNES_OAM].main_bg_enabled && !m_layer[SNES_OAM].sub_bg_enabled)
 		return;
 
-	uint8_t window_above[256];
-	uint8_t window_below[256];
-	render_window(SNES_OAM, m_layer[SNES_OAM].main_window_enabled, window_above);
-	render_window(SNES_OAM, m_layer[SNES_OAM].sub_window_enabled, window_below);
-
 	uint32_t item_count = 0;
 	uint32_t tile_count = 0;
 	object_item items[32];
-	object_tile tiles[34];
 	memset(items, 0, sizeof(object_item) * 32);
-	memset(tiles, 0, sizeof(object_tile) * 34);
 
 	for (uint32_t n = 0; n < 128; n++)
 	{
@@ -957,7 +984,7 @@ void snes_ppu_device::update_objects( uint16_t curline )
 			object_tile tile = { true, 0, 0, 0, 0, 0, 0 };
 			tile.x = object_x;
 			tile.y = y;
-			tile.pri = obj.pri;
+			tile.pri = m_oam.priority[obj.pri];
 			tile.pal = 128 + (obj.pal << 4);
 			tile.hflip = obj.hflip;
 
@@ -981,13 +1008,30 @@ void snes_ppu_device::update_objects( uint16_t curline )
 	/* set Time Over flag if necessary */
 	if (tile_count > 34)
 		m_stat77 |= 0x80;
+}
+
+/*********************************************
+ * draw_objects()
+ *
+ * Update an entire line of sprites.
+ *********************************************/
+
+void snes_ppu_renderer::draw_objects()
+{
+	if (!m_layer[SNES_OAM].main_bg_enabled && !m_layer[SNES_OAM].sub_bg_enabled)
+		return;
+
+	uint8_t window_above[256];
+	uint8_t window_below[256];
+	render_window(SNES_OAM, m_layer[SNES_OAM].main_window_enabled, window_above);
+	render_window(SNES_OAM, m_layer[SNES_OAM].sub_window_enabled, window_below);
 
 	uint8_t palbuf[256] = {};
 	uint8_t pribuf[256] = {};
 
 	for (uint32_t n = 0; n < 34; n++)
 	{
-		object_tile &tile = tiles[n];
+		object_tile &tile = m_tiles[n];
 		if (!tile.valid) continue;
 
 		uint32_t tile_x = tile.x;
@@ -1004,7 +1048,7 @@ void snes_ppu_device::update_objects( uint16_t curline )
 				if (color)
 				{
 					palbuf[tile_x] = tile.pal + color;
-					pribuf[tile_x] = m_oam.priority[tile.pri];
+					pribuf[tile_x] = tile.pri;
 				}
 			}
 			tile_x++;
@@ -1015,8 +1059,8 @@ void snes_ppu_device::update_objects( uint16_t curline )
 	{
 		if (!pribuf[x]) continue;
 		int blend = (palbuf[x] < 192) ? 1 : 0;
-		if (m_layer[SNES_OAM].main_bg_enabled && window_above[x] == 0) plot_above(x, SNES_OAM, pribuf[x], pen_indirect(palbuf[x]), blend);
-		if (m_layer[SNES_OAM].sub_bg_enabled  && window_below[x] == 0) plot_below(x, SNES_OAM, pribuf[x], pen_indirect(palbuf[x]), blend);
+		if (m_layer[SNES_OAM].main_bg_enabled && window_above[x] == 0) plot_above(x, SNES_OAM, pribuf[x], m_cgram_pens[palbuf[x]], blend);
+		if (m_layer[SNES_OAM].sub_bg_enabled  && window_below[x] == 0) plot_below(x, SNES_OAM, pribuf[x], m_cgram_pens[palbuf[x]], blend);
 	}
 }
 
@@ -1038,7 +1082,7 @@ void snes_ppu_device::oam_set_first_object( void )
  * Update Mode X line.
  *********************************************/
 
-void snes_ppu_device::update_mode_0( uint16_t curline )
+void snes_ppu_renderer::update_mode_0( uint16_t curline )
 {
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.mode_disabled[0])
@@ -1051,7 +1095,7 @@ void snes_ppu_device::update_mode_0( uint16_t curline )
 	update_line(curline, SNES_BG4, 0);
 }
 
-void snes_ppu_device::update_mode_1( uint16_t curline )
+void snes_ppu_renderer::update_mode_1( uint16_t curline )
 {
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.mode_disabled[1])
@@ -1063,7 +1107,7 @@ void snes_ppu_device::update_mode_1( uint16_t curline )
 	update_line(curline, SNES_BG3, 0);
 }
 
-void snes_ppu_device::update_mode_2( uint16_t curline )
+void snes_ppu_renderer::update_mode_2( uint16_t curline )
 {
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.mode_disabled[2])
@@ -1074,7 +1118,7 @@ void snes_ppu_device::update_mode_2( uint16_t curline )
 	update_line(curline, SNES_BG2, 0);
 }
 
-void snes_ppu_device::update_mode_3( uint16_t curline )
+void snes_ppu_renderer::update_mode_3( uint16_t curline )
 {
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.mode_disabled[3])
@@ -1085,7 +1129,7 @@ void snes_ppu_device::update_mode_3( uint16_t curline )
 	update_line(curline, SNES_BG2, 0);
 }
 
-void snes_ppu_device::update_mode_4( uint16_t curline )
+void snes_ppu_renderer::update_mode_4( uint16_t curline )
 {
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.mode_disabled[4])
@@ -1096,7 +1140,7 @@ void snes_ppu_device::update_mode_4( uint16_t curline )
 	update_line(curline, SNES_BG2, 0);
 }
 
-void snes_ppu_device::update_mode_5( uint16_t curline )
+void snes_ppu_renderer::update_mode_5( uint16_t curline )
 {
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.mode_disabled[5])
@@ -1107,7 +1151,7 @@ void snes_ppu_device::update_mode_5( uint16_t curline )
 	update_line(curline, SNES_BG2, 0);
 }
 
-void snes_ppu_device::update_mode_6( uint16_t curline )
+void snes_ppu_renderer::update_mode_6( uint16_t curline )
 {
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.mode_disabled[6])
@@ -1117,7 +1161,7 @@ void snes_ppu_device::update_mode_6( uint16_t curline )
 	update_line(curline, SNES_BG1, 0);
 }
 
-void snes_ppu_device::update_mode_7( uint16_t curline )
+void snes_ppu_renderer::update_mode_7( uint16_t curline )
 {
 #if SNES_LAYER_DEBUG
 	if (m_debug_options.mode_disabled[7])
@@ -1141,7 +1185,7 @@ void snes_ppu_device::update_mode_7( uint16_t curline )
  * Draw the whole screen (Mode 0 -> 7).
  *********************************************/
 
-void snes_ppu_device::draw_screens( uint16_t curline )
+void snes_ppu_renderer::draw_screens( uint16_t curline )
 {
 	switch (m_mode)
 	{
@@ -1169,7 +1213,7 @@ void snes_ppu_device::draw_screens( uint16_t curline )
  * XNOR: ###...##...###     ...###..###...
  *********************************************/
 
-void snes_ppu_device::update_color_windowmasks( uint8_t mask, uint8_t *output )
+void snes_ppu_renderer::update_color_windowmasks( uint8_t mask, uint8_t *output )
 {
 	layer_t &self = m_layer[SNES_COLOR];
 	uint8_t set = 0, clear = 0;
@@ -1256,6 +1300,60 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, uint16_t curline )
 
 	cache_background();
 
+	if (!m_screen_disabled)
+	{
+#if SNES_LAYER_DEBUG
+		if (dbg_video(curline))
+			return;
+#endif
+
+		/* Fetch OAM tiles here, as this sets the Range/Time Over flags */
+		update_objects(curline);
+	}
+
+	m_fixed_colour = pen_indirect(FIXED_COLOUR);
+
+	if (!m_line_queue)
+	{
+		render_line(bitmap, curline, blurring);
+		return;
+	}
+
+	/* Latch the line and draw it in the background */
+	if (m_line_head == LINE_QUEUE_SIZE)
+		finish_lines();
+
+	line_job &job = m_line_jobs[m_line_head++];
+	job.device = this;
+	job.bitmap = &bitmap;
+	job.curline = curline;
+	job.blurring = blurring;
+	memcpy(job.cgram, m_cgram.get(), sizeof(job.cgram));
+	job.state = *this;
+	osd_work_item_queue(m_line_queue, render_line_callback, &job, WORK_ITEM_FLAG_AUTO_RELEASE);
+}
+
+void *snes_ppu_device::render_line_callback(void *param, int threadid)
+{
+	line_job &job = *reinterpret_cast<line_job *>(param);
+	snes_ppu_renderer &renderer = job.device->m_line_renderer;
+	static_cast<snes_ppu_line_state &>(renderer) = job.state;
+	renderer.m_cgram_pens = job.cgram;
+	renderer.render_line(*job.bitmap, job.curline, job.blurring);
+	return nullptr;
+}
+
+void snes_ppu_device::finish_lines()
+{
+	if (!m_line_head)
+		return;
+
+	osd_work_queue_wait(m_line_queue, osd_ticks_per_second() * 10);
+	m_line_head = 0;
+}
+
+void snes_ppu_renderer::render_line( bitmap_rgb32 &bitmap, uint16_t curline, bool blurring )
+{
 	if (m_screen_disabled) /* screen is forced blank */
 		for (int x = 0; x < SNES_SCR_WIDTH * 2; x++)
 			bitmap.pix(0, x) = rgb_t::black();
@@ -1279,9 +1377,6 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, uint16_t curline )
 		struct SNES_SCANLINE *above = &m_scanlines[SNES_MAINSCREEN];
 		struct SNES_SCANLINE *below = &m_scanlines[SNES_SUBSCREEN];
 #if SNES_LAYER_DEBUG
-		if (dbg_video(curline))
-			return;
-
 		/* Toggle drawing of SNES_SUBSCREEN or SNES_MAINSCREEN */
 		if (m_debug_options.draw_subscreen)
 		{
@@ -1291,8 +1386,8 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, uint16_t curline )
 #endif
 
 		const bool hires = m_mode == 5 || m_mode == 6 || m_pseudo_hires;
-		uint16_t above_color = pen_indirect(0);
-		uint16_t below_color = hires ? pen_indirect(0) : pen_indirect(FIXED_COLOUR);
+		uint16_t above_color = m_cgram_pens[0];
+		uint16_t below_color = hires ? m_cgram_pens[0] : m_fixed_colour;
 		for (int x = 0; x < SNES_SCR_WIDTH; x++)
 		{
 			above->buffer[x] = above_color;
@@ -1311,12 +1406,12 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, uint16_t curline )
 		draw_screens(curline);
 
 		/* Draw OAM */
-		update_objects(curline);
+		draw_objects();
 
 		/* Draw the scanline to screen */
 		uint16_t prev = 0;
 
-		uint16_t *luma = &m_light_table[m_screen_brightness][0];
+		const uint16_t *luma = &m_light_table[m_screen_brightness * 32768];
 		for (int x = 0; x < SNES_SCR_WIDTH; x++)
 		{
 			/* in hires, the first pixel (of 512) is subscreen pixel, then the first mainscreen pixel follows, and so on... */
@@ -1324,29 +1419,29 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, uint16_t curline )
 			{
 				const uint16_t c = luma[pixel(x, above, below, window_above, window_below)];
 
-				bitmap.pix(0, x * 2 + 0) = indirect_color(c & 0x7fff);
-				bitmap.pix(0, x * 2 + 1) = indirect_color(c & 0x7fff);
+				bitmap.pix(0, x * 2 + 0) = pal555(c & 0x7fff, 0, 5, 10);
+				bitmap.pix(0, x * 2 + 1) = pal555(c & 0x7fff, 0, 5, 10);
 			}
 			else if (!blurring)
 			{
 				const uint16_t c0 = luma[pixel(x, below, above, window_above, window_below)];
 				const uint16_t c1 = luma[pixel(x, above, below, window_above, window_below)];
 
-				bitmap.pix(0, x * 2 + 0) = indirect_color(c0 & 0x7fff);
-				bitmap.pix(0, x * 2 + 1) = indirect_color(c1 & 0x7fff);
+				bitmap.pix(0, x * 2 + 0) = pal555(c0 & 0x7fff, 0, 5, 10);
+				bitmap.pix(0, x * 2 + 1) = pal555(c1 & 0x7fff, 0, 5, 10);
 			}
 			else
 			{
 				uint16_t curr = luma[pixel(x, below, above, window_above, window_below)];
 
 				uint16_t c0 = (prev + curr - ((prev ^ curr) & 0x0421)) >> 1;
-				bitmap.pix(0, x * 2 + 0) = indirect_color(c0 & 0x7fff);
+				bitmap.pix(0, x * 2 + 0) = pal555(c0 & 0x7fff, 0, 5, 10);
 
 				prev = curr;
 				curr = luma[pixel(x, above, below, window_above, window_below)];
 
 				uint16_t c1 = (prev + curr - ((prev ^ curr) & 0x0421)) >> 1;
-				bitmap.pix(0, x * 2 + 1) = indirect_color(c1 & 0x7fff);
+				bitmap.pix(0, x * 2 + 1) = pal555(c1 & 0x7fff, 0, 5, 10);
 
 				prev = curr;
 			}
@@ -1354,16 +1449,16 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, uint16_t curline )
 	}
 }
 
-uint16_t snes_ppu_device::pixel(uint16_t x, SNES_SCANLINE *above, SNES_SCANLINE *below, uint8_t *window_above, uint8_t *window_below)
+uint16_t snes_ppu_renderer::pixel(uint16_t x, SNES_SCANLINE *above, SNES_SCANLINE *below, uint8_t *window_above, uint8_t *window_below)
 {
 	if (!window_above[x]) above->buffer[x] = 0;
 	if (!window_below[x]) return above->buffer[x];
 	if (!m_layer[above->layer[x]].color_math || (above->layer[x] == SNES_OAM && above->blend_exception[x])) return above->buffer[x];
-	if (!m_sub_add_mode) return blend(above->buffer[x], pen_indirect(FIXED_COLOUR), BIT(m_color_modes, 0) != 0 && window_above[x] != 0);
+	if (!m_sub_add_mode) return blend(above->buffer[x], m_fixed_colour, BIT(m_color_modes, 0) != 0 && window_above[x] != 0);
 	return blend(above->buffer[x], below->buffer[x], BIT(m_color_modes, 0) != 0 && window_above[x] != 0 && below->layer[x] != SNES_COLOR);
 }
 
-inline uint16_t snes_ppu_device::blend( uint16_t x, uint16_t y, bool halve )
+inline uint16_t snes_ppu_renderer::blend( uint16_t x, uint16_t y, bool halve )
 {
 	if (!BIT(m_color_modes, 1)) // add
 	{
@@ -1412,6 +1507,9 @@ void snes_ppu_device::set_latch_hv(int16_t x, int16_t y)
 
 void snes_ppu_device::dynamic_res_change()
 {
+	// the screen may reallocate the bitmaps queued lines are drawn to
+	finish_lines();
+
 	rectangle visarea = screen().visible_area();
 	attoseconds_t refresh;
 
@@ -1508,6 +1606,9 @@ void snes_ppu_device::vram_write(offs_t offset, uint8_t data)
 {
 	offset &= 0xffff; // only 64KB are present on SNES, Robocop 3 relies on this
 
+	// queued lines may still be reading VRAM
+	finish_lines();
+
 	if (m_screen_disabled)
 		m_vram[offset] = data;
 	else
@@ -1713,12 +1814,14 @@ void snes_ppu_device::cgram_write(offs_t offset, uint8_t data)
 	set_pen_indirect(offset >> 1, m_cgram[offset >> 1] & 0x7fff);
 }
 
-uint16_t snes_ppu_device::direct_color(uint16_t palette, uint16_t group)
+uint16_t snes_ppu_renderer::direct_color(uint16_t palette, uint16_t group)
 {
   //palette = -------- BBGGGRRR
   //group   = -------- -----bgr
   //output  = 0BBb00GG Gg0RRRr0
-  return pen_indirect(DIRECT_COLOUR + palette + (group * 256));
+  return (palette << 7 & 0x6000) + (group << 10 & 0x1000)
+       + (palette << 4 & 0x0380) + (group <<  5 & 0x0040)
+       + (palette << 2 & 0x001c) + (group <<  1 & 0x0002);
 }
 
 void snes_ppu_device::set_current_vert(uint16_t value)
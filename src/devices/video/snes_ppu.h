@@ -34,58 +34,12 @@
 #define SNES_LAYER_DEBUG  0
 
 
-// ======================> snes_ppu_device
+// ======================> snes_ppu_line_state
 
-class snes_ppu_device :  public device_t,
-							public device_video_interface,
-							public device_palette_interface
+// PPU state needed to draw a scanline; in threaded mode a copy of this is
+// latched for each line, so it holds only plain register values
+struct snes_ppu_line_state
 {
-public:
-	// construction/destruction
-	snes_ppu_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock);
-
-	// inline configuration helpers
-	auto open_bus_callback() { return m_openbus_cb.bind(); }
-
-	void refresh_scanline(bitmap_rgb32 &bitmap, uint16_t curline);
-
-	int16_t current_x() const { return screen().hpos(); }
-	int16_t current_y() const { return screen().vpos(); }
-	void set_latch_hv(int16_t x, int16_t y);
-
-	uint8_t read(uint32_t offset, uint8_t wrio_bit7);
-	void write(uint32_t offset, uint8_t data);
-
-	int vtotal() const { return ((m_stat78 & 0x10) == SNES_NTSC) ? SNES_VTOTAL_NTSC : SNES_VTOTAL_PAL; }
-	uint16_t htmult() const { return m_htmult; }
-	uint8_t interlace() const { return m_interlace; }
-	bool screen_disabled() const { return bool(m_screen_disabled); }
-	uint8_t last_visible_line() const { return m_beam.last_visible_line; }
-	uint16_t current_vert() const { return m_beam.current_vert; }
-
-	void oam_address_reset();
-	void oam_set_first_object();
-
-	void clear_time_range_over() { m_stat77 &= 0x3f; }
-	void toggle_field() { m_stat78 ^= 0x80; }
-	void reset_interlace()
-	{
-		m_htmult = 1;
-		m_interlace = 1;
-		m_oam.interlace = 0;
-	}
-	void set_current_vert(uint16_t value);
-
-protected:
-	/* offset-per-tile modes */
-	enum
-	{
-		SNES_OPT_NONE = 0,
-		SNES_OPT_MODE2,
-		SNES_OPT_MODE4,
-		SNES_OPT_MODE6
-	};
-
 	/* layers */
 	enum
 	{
@@ -97,21 +51,6 @@ protected:
 		SNES_COLOR
 	};
 
-
-	struct SNES_SCANLINE
-	{
-		int enable, clip;
-
-		uint16_t buffer[SNES_SCR_WIDTH];
-		uint8_t  priority[SNES_SCR_WIDTH];
-		uint8_t  layer[SNES_SCR_WIDTH];
-		uint8_t  blend_exception[SNES_SCR_WIDTH];
-	};
-
-	uint8_t m_regs[0x40];
-
-	SNES_SCANLINE m_scanlines[2];
-
 	struct layer_t
 	{
 		/* clipmasks */
@@ -143,31 +82,18 @@ protected:
 		uint16_t mosaic_offset;
 	};
 
-	layer_t m_layer[6]; // this is for the BG1 - BG2 - BG3 - BG4 - OBJ - color layers
-
-	struct
+	struct object_tile
 	{
-		uint16_t address;
-		uint16_t base_address;
-		uint8_t priority_rotation;
-		uint16_t tile_data_address;
-		uint8_t name_select;
-		uint8_t base_size;
-		uint8_t first;
-		uint16_t write_latch;
-		uint8_t data_latch;
-		uint8_t interlace;
-		uint8_t priority[4];
-	} m_oam;
+		bool valid;
+		uint16_t x;
+		uint8_t y;
+		uint8_t pri;
+		uint8_t pal;
+		uint8_t hflip;
+		uint32_t data;
+	};
 
-	struct
-	{
-		uint16_t latch_horz;
-		uint16_t latch_vert;
-		uint16_t current_vert;
-		uint8_t last_visible_line;
-		uint8_t interlace_count;
-	} m_beam;
+	layer_t m_layer[6]; // this is for the BG1 - BG2 - BG3 - BG4 - OBJ - color layers
 
 	struct
 	{
@@ -197,33 +123,172 @@ protected:
 		uint8_t select_pri[5];
 	};
 	struct DEBUGOPTS m_debug_options;
-	uint8_t dbg_video( uint16_t curline );
 #endif
 
 	uint8_t m_mosaic_size;
 	uint8_t m_clip_to_black;
 	uint8_t m_prevent_color_math;
 	uint8_t m_sub_add_mode;
-	uint8_t m_bg_priority;
 	uint8_t m_direct_color;
+	uint8_t m_window1_left, m_window1_right, m_window2_left, m_window2_right;
+
+	uint8_t m_mode;
+	uint8_t m_interlace; //doubles the visible resolution
+	uint8_t m_screen_brightness;
+	uint8_t m_screen_disabled;
+	uint8_t m_pseudo_hires;
+	uint8_t m_color_modes;
+	uint8_t m_stat78;
+
+	uint16_t m_fixed_colour;            /* fixed colour for colour math, copied from the palette */
+	object_tile m_tiles[34];            /* sprite tiles fetched for this line */
+};
+
+
+// ======================> snes_ppu_renderer
+
+// draws a scanline from the inherited state into a scanline bitmap
+struct snes_ppu_renderer : public snes_ppu_line_state
+{
+	struct SNES_SCANLINE
+	{
+		int enable, clip;
+
+		uint16_t buffer[SNES_SCR_WIDTH];
+		uint8_t  priority[SNES_SCR_WIDTH];
+		uint8_t  layer[SNES_SCR_WIDTH];
+		uint8_t  blend_exception[SNES_SCR_WIDTH];
+	};
+
+	SNES_SCANLINE m_scanlines[2];
+
+	uint8_t *m_vram;                    /* Video RAM (TODO: Should be 16-bit, but it's easier this way) */
+	const uint16_t *m_cgram_pens;       /* Palette RAM contents to draw with */
+	const uint16_t *m_light_table;      /* Luma ramp, 32768 entries for each brightness */
+
+	void render_line(bitmap_rgb32 &bitmap, uint16_t curline, bool blurring);
+
+	inline uint32_t get_tile(uint8_t layer_idx, uint32_t hoffset, uint32_t voffset);
+	void update_line(uint16_t curline, uint8_t layer, uint8_t direct_colors);
+	void update_line_mode7(uint16_t curline, uint8_t layer_idx);
+	void draw_objects();
+	void update_mode_0(uint16_t curline);
+	void update_mode_1(uint16_t curline);
+	void update_mode_2(uint16_t curline);
+	void update_mode_3(uint16_t curline);
+	void update_mode_4(uint16_t curline);
+	void update_mode_5(uint16_t curline);
+	void update_mode_6(uint16_t curline);
+	void update_mode_7(uint16_t curline);
+	void draw_screens(uint16_t curline);
+	void render_window(uint16_t layer_idx, uint8_t enable, uint8_t *output);
+	inline void plot_above(uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception = 0);
+	inline void plot_below(uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception = 0);
+	void update_color_windowmasks(uint8_t mask, uint8_t *output);
+	uint16_t pixel(uint16_t x, SNES_SCANLINE *above, SNES_SCANLINE *below, uint8_t *window_above, uint8_t *window_below);
+	uint16_t direct_color(uint16_t palette, uint16_t group);
+	inline uint16_t blend(uint16_t x, uint16_t y, bool halve);
+};
+
+
+// ======================> snes_ppu_device
+
+class snes_ppu_device :  public device_t,
+							public device_video_interface,
+							public device_palette_interface,
+							protected snes_ppu_renderer
+{
+public:
+	// construction/destruction
+	snes_ppu_device(const machine_config &mconfig, const char *tag, device_t *owner, uint32_t clock);
+
+	// inline configuration helpers
+	auto open_bus_callback() { return m_openbus_cb.bind(); }
+	void set_threaded(bool threaded) { m_threaded = threaded; }
+
+	// in threaded mode lines are drawn in the background, and finish_lines()
+	// must be called before the screen bitmaps are used
+	void refresh_scanline(bitmap_rgb32 &bitmap, uint16_t curline);
+	void finish_lines();
+
+	int16_t current_x() const { return screen().hpos(); }
+	int16_t current_y() const { return screen().vpos(); }
+	void set_latch_hv(int16_t x, int16_t y);
+
+	uint8_t read(uint32_t offset, uint8_t wrio_bit7);
+	void write(uint32_t offset, uint8_t data);
+
+	int vtotal() const { return ((m_stat78 & 0x10) == SNES_NTSC) ? SNES_VTOTAL_NTSC : SNES_VTOTAL_PAL; }
+	uint16_t htmult() const { return m_htmult; }
+	uint8_t interlace() const { return m_interlace; }
+	bool screen_disabled() const { return bool(m_screen_disabled); }
+	uint8_t last_visible_line() const { return m_beam.last_visible_line; }
+	uint16_t current_vert() const { return m_beam.current_vert; }
+
+	void oam_address_reset();
+	void oam_set_first_object();
+
+	void clear_time_range_over() { m_stat77 &= 0x3f; }
+	void toggle_field() { m_stat78 ^= 0x80; }
+	void reset_interlace()
+	{
+		m_htmult = 1;
+		m_interlace = 1;
+		m_oam.interlace = 0;
+	}
+	void set_current_vert(uint16_t value);
+
+protected:
+	/* offset-per-tile modes */
+	enum
+	{
+		SNES_OPT_NONE = 0,
+		SNES_OPT_MODE2,
+		SNES_OPT_MODE4,
+		SNES_OPT_MODE6
+	};
+
+	uint8_t m_regs[0x40];
+
+	struct
+	{
+		uint16_t address;
+		uint16_t base_address;
+		uint8_t priority_rotation;
+		uint16_t tile_data_address;
+		uint8_t name_select;
+		uint8_t base_size;
+		uint8_t first;
+		uint16_t write_latch;
+		uint8_t data_latch;
+		uint8_t interlace;
+		uint8_t priority[4];
+	} m_oam;
+
+	struct
+	{
+		uint16_t latch_horz;
+		uint16_t latch_vert;
+		uint16_t current_vert;
+		uint8_t last_visible_line;
+		uint8_t interlace_count;
+	} m_beam;
+
+#if SNES_LAYER_DEBUG
+	uint8_t dbg_video( uint16_t curline );
+#endif
+
+	uint8_t m_bg_priority;
 	uint8_t m_ppu_last_scroll;      /* as per Anomie's doc and Theme Park, all scroll regs shares (but mode 7 ones) the same
 	                               'previous' scroll value */
 	uint8_t m_mode7_last_scroll;    /* as per Anomie's doc mode 7 scroll regs use a different value, shared with mode 7 matrix! */
 
 	uint8_t m_ppu1_open_bus, m_ppu2_open_bus;
 	uint8_t m_ppu1_version, m_ppu2_version;
-	uint8_t m_window1_left, m_window1_right, m_window2_left, m_window2_right;
 
 	uint16_t m_mosaic_table[16][4096];
 	uint8_t m_clipmasks[6][SNES_SCR_WIDTH];
-	uint8_t m_mode;
-	uint8_t m_interlace; //doubles the visible resolution
-	uint8_t m_screen_brightness;
-	uint8_t m_screen_disabled;
-	uint8_t m_pseudo_hires;
-	uint8_t m_color_modes;
 	uint8_t m_stat77;
-	uint8_t m_stat78;
 
 	uint16_t                m_htmult;     /* in 512 wide, we run HTOTAL double and halve it on latching */
 	uint16_t                m_cgram_address;  /* CGRAM address */
@@ -245,17 +310,6 @@ protected:
 		uint8_t height;
 	};
 
-	struct object_tile
-	{
-		bool valid;
-		uint16_t x;
-		uint8_t y;
-		uint8_t pri;
-		uint8_t pal;
-		uint8_t hflip;
-		uint32_t data;
-	};
-
 	struct object
 	{
 		uint16_t x;
@@ -269,28 +323,9 @@ protected:
 		uint8_t size;
 	};
 
-	inline uint32_t get_tile(uint8_t layer_idx, uint32_t hoffset, uint32_t voffset);
-	void update_line(uint16_t curline, uint8_t layer, uint8_t direct_colors);
-	void update_line_mode7(uint16_t curline, uint8_t layer_idx);
 	void update_objects(uint16_t curline);
-	void update_mode_0(uint16_t curline);
-	void update_mode_1(uint16_t curline);
-	void update_mode_2(uint16_t curline);
-	void update_mode_3(uint16_t curline);
-	void update_mode_4(uint16_t curline);
-	void update_mode_5(uint16_t curline);
-	void update_mode_6(uint16_t curline);
-	void update_mode_7(uint16_t curline);
-	void draw_screens(uint16_t curline);
-	void render_window(uint16_t layer_idx, uint8_t enable, uint8_t *output);
-	inline void plot_above(uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception = 0);
-	inline void plot_below(uint16_t x, uint8_t source, uint8_t priority, uint16_t color, int blend_exception = 0);
-	void update_color_windowmasks(uint8_t mask, uint8_t *output);
 	void update_video_mode(void);
 	void cache_background();
-	uint16_t pixel(uint16_t x, SNES_SCANLINE *above, SNES_SCANLINE *below, uint8_t *window_above, uint8_t *window_below);
-	uint16_t direct_color(uint16_t palette, uint16_t group);
-	inline uint16_t blend(uint16_t x, uint16_t y, bool halve);
 
 	void dynamic_res_change();
 	inline uint32_t get_vram_address();
@@ -306,12 +341,14 @@ protected:
 	void vram_write(offs_t offset, uint8_t data);
 	object m_objects[128]; /* Object Attribute Memory (OAM) */
 	std::unique_ptr<uint16_t[]> m_cgram;   /* Palette RAM */
-	std::unique_ptr<uint8_t[]> m_vram;    /* Video RAM (TODO: Should be 16-bit, but it's easier this way) */
-	std::unique_ptr<std::unique_ptr<uint16_t[]>[]> m_light_table; /* Luma ramp */
+	std::unique_ptr<uint8_t[]> m_vram_buffer;
+	std::unique_ptr<uint16_t[]> m_light_table_buffer;
 
 	// device-level overrides
 	virtual void device_start() override;
 	virtual void device_reset() override;
+	virtual void device_stop() override;
+	virtual void device_pre_save() override;
 
 	// device_palette_interface overrides
 	// 256 word CG RAM data (0x000-0x0ff), 8 group of direct colours (0x100-0x8ff), Fixed color (0x900)
@@ -322,6 +359,26 @@ private:
 	static constexpr uint16_t DIRECT_COLOUR = 0x100; // Position in palette entry for direct colour
 	static constexpr uint16_t FIXED_COLOUR = 0x100 + (0x100 * 8); // Position in palette entry for fixed colour
 
+	// threaded rendering
+	static constexpr unsigned LINE_QUEUE_SIZE = 512;
+	struct line_job
+	{
+		snes_ppu_device *device;
+		bitmap_rgb32 *bitmap;
+		uint16_t curline;
+		bool blurring;
+		uint16_t cgram[256];
+		snes_ppu_line_state state;
+	};
+
+	static void *render_line_callback(void *param, int threadid);
+
+	bool m_threaded;
+	osd_work_queue *m_line_queue;
+	std::unique_ptr<line_job[]> m_line_jobs;
+	unsigned m_line_head;               // lines queued since the last finish_lines()
+	snes_ppu_renderer m_line_renderer;  // renderer used by the worker thread
+
 	devcb_read16  m_openbus_cb;
 	optional_ioport m_options;
 	optional_ioport m_debug1;
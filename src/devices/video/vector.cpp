@@ -161,17 +161,11 @@ uint32_t vector_device::screen_update(screen_device &screen, bitmap_rgb32 &bitma
 	int lastx = 0;
 	int lasty = 0;
 
-	curpoint = m_vector_list.get();
-
-	screen.container().empty();
-	screen.container().add_rect(0.0f, 0.0f, 1.0f, 1.0f, rgb_t(0xff,0x00,0x00,0x00), PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA) | PRIMFLAG_VECTORBUF(1));
-
-	for (int i = 0; i < m_vector_index; i++)
+	// the beam width depends only on the intensity, so work it out once per level
+	float beam_widths[256];
+	for (int intensity = 0; intensity < 256; intensity++)
 	{
-		render_bounds coords;
-
-		float intensity = (float)curpoint->intensity / 255.0f;
-		float intensity_weight = normalized_sigmoid(intensity, vector_options::s_beam_intensity_weight);
+		float intensity_weight = normalized_sigmoid((float)intensity / 255.0f, vector_options::s_beam_intensity_weight);
 
 		// check for static intensity
 		float beam_width = m_min_intensity == m_max_intensity
@@ -179,24 +173,69 @@ uint32_t vector_device::screen_update(screen_device &screen, bitmap_rgb32 &bitma
 			: vector_options::s_beam_width_min + intensity_weight * (vector_options::s_beam_width_max - vector_options::s_beam_width_min);
 
 		// normalize width
-		beam_width *= 1.0f / (float)VECTOR_WIDTH_DENOM;
+		beam_widths[intensity] = beam_width * (1.0f / (float)VECTOR_WIDTH_DENOM);
+	}
 
-		// apply point scale for points
-		if (lastx == curpoint->x && lasty == curpoint->y)
-			beam_width *= vector_options::s_beam_dot_size;
+	curpoint = m_vector_list.get();
 
-		coords.x0 = ((float)lastx - xoffs) * xscale;
-		coords.y0 = ((float)lasty - yoffs) * yscale;
-		coords.x1 = ((float)curpoint->x - xoffs) * xscale;
-		coords.y1 = ((float)curpoint->y - yoffs) * yscale;
+	screen.container().empty();
+	screen.container().add_rect(0.0f, 0.0f, 1.0f, 1.0f, rgb_t(0xff,0x00,0x00,0x00), PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA) | PRIMFLAG_VECTORBUF(1));
 
-		if (curpoint->intensity != 0)
+	// consecutive segments continuing in the same direction with the same
+	// colour are merged into a single line before being handed to the renderer
+	bool pending = false;
+	int pendx0 = 0, pendy0 = 0, pendx1 = 0, pendy1 = 0;
+	rgb_t pendcolor = 0;
+	float pendwidth = 0.0f;
+	auto flush_pending = [&] ()
+	{
+		if (pending)
 		{
 			screen.container().add_line(
-				coords.x0, coords.y0, coords.x1, coords.y1,
-				beam_width,
-				(curpoint->intensity << 24) | (curpoint->col & 0xffffff),
-				flags);
+				((float)pendx0 - xoffs) * xscale, ((float)pendy0 - yoffs) * yscale,
+				((float)pendx1 - xoffs) * xscale, ((float)pendy1 - yoffs) * yscale,
+				pendwidth, pendcolor, flags);
+			pending = false;
+		}
+	};
+
+	for (int i = 0; i < m_vector_index; i++)
+	{
+		if (curpoint->intensity != 0)
+		{
+			float beam_width = beam_widths[curpoint->intensity];
+			rgb_t color = (curpoint->intensity << 24) | (curpoint->col & 0xffffff);
+			bool const dot = lastx == curpoint->x && lasty == curpoint->y;
+
+			// apply point scale for points
+			if (dot)
+				beam_width *= vector_options::s_beam_dot_size;
+
+			int64_t const dx = int64_t(curpoint->x) - lastx;
+			int64_t const dy = int64_t(curpoint->y) - lasty;
+			if (pending && !dot && color == pendcolor && pendx1 == lastx && pendy1 == lasty)
+			{
+				int64_t const pdx = int64_t(pendx1) - pendx0;
+				int64_t const pdy = int64_t(pendy1) - pendy0;
+				if ((pdx || pdy) && (pdx * dy == pdy * dx) && (pdx * dx + pdy * dy > 0))
+				{
+					pendx1 = curpoint->x;
+					pendy1 = curpoint->y;
+					lastx = curpoint->x;
+					lasty = curpoint->y;
+					curpoint++;
+					continue;
+				}
+			}
+
+			flush_pending();
+			pending = true;
+			pendx0 = lastx;
+			pendy0 = lasty;
+			pendx1 = curpoint->x;
+			pendy1 = curpoint->y;
+			pendcolor = color;
+			pendwidth = beam_width;
 		}
 
 		lastx = curpoint->x;
@@ -204,6 +243,7 @@ uint32_t vector_device::screen_update(screen_device &screen, bitmap_rgb32 &bitma
 
 		curpoint++;
 	}
+	flush_pending();
 
 	return 0;
 }
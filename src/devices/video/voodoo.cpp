@@ -1033,6 +1033,7 @@ void voodoo_1_device::device_start()
 void voodoo_1_device::device_stop()
 {
 	m_renderer->wait("device_stop");
+	m_renderer->dump_missed_rasterizers(machine().system().name);
 }
 
 
@@ -1538,8 +1539,8 @@ u32 voodoo_1_device::internal_lfb_r(offs_t offset)
 		return 0xffffffff;
 	}
 
-	// wait for any outstanding work to finish before reading
-	m_renderer->wait("internal_lfb_r");
+	// wait for any outstanding work that could write these pixels
+	m_renderer->wait_for_range(buffer, buffer + 2, "internal_lfb_r");
 
 	// read and assemble two pixels
 	u32 data = buffer[0] | (buffer[1] << 16);
@@ -1627,8 +1628,10 @@ void voodoo_1_device::internal_lfb_w(offs_t offset, u32 data, u32 mem_mask)
 		if (depth != nullptr)
 			depth += scry * m_renderer->rowpixels() + x;
 
-		// wait for any outstanding work to finish
-		m_renderer->wait("internal_lfb_w(raw)");
+		// wait for any outstanding work touching these pixels
+		m_renderer->wait_for_range(dest, dest + 2, "internal_lfb_w(raw)");
+		if (depth != nullptr)
+			m_renderer->wait_for_range(depth, depth + 2, "internal_lfb_w(raw)");
 
 		// loop over up to two pixels
 		voodoo::dither_helper dither(scry, fbzmode);
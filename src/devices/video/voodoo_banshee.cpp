@@ -331,7 +331,9 @@ u32 voodoo_banshee_device::read_lfb(offs_t offset, u32 mem_mask)
 	u32 addr = offset * 4;
 	if (addr <= m_fbmask)
 	{
-		m_renderer->wait("read_lfb");
+		// only wait if pending rendering may write here
+		u16 const *const pixels = (u16 *)&m_fbram[addr];
+		m_renderer->wait_for_range(pixels, pixels + 2, "read_lfb");
 		u32 result = *(u32 *)&m_fbram[addr];
 		if (LOG_LFB)
 			logerror("%s:read_lfb(%X) = %08X\n", machine().describe_context(), addr, result);
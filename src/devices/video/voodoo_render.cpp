@@ -11,6 +11,8 @@
 #include "emu.h"
 #include "voodoo.h"
 
+#include "emuopts.h"
+
 namespace voodoo
 {
 
@@ -1245,7 +1247,9 @@ voodoo_renderer::voodoo_renderer(running_machine &machine, u16 tmu_config, const
 	m_tmu1_reg(tmu1_regs),
 	m_rgb565(rgb565),
 	m_fogdelta_mask(0xff),
-	m_thread_stats(WORK_MAX_THREADS)
+	m_log_rasterizers(LOG_RASTERIZERS || machine.options().voodoo_rasterstats()),
+	m_thread_stats(WORK_MAX_THREADS),
+	m_pending_count(0)
 {
 	// empty the hash table
 	std::fill(std::begin(m_raster_hash), std::end(m_raster_hash), nullptr);
@@ -1318,6 +1322,7 @@ u32 voodoo_renderer::enqueue_fastfill(poly_data &poly)
 	// create a block of 64 identical extents
 	vertex_t v1(poly.clipleft, poly.cliptop);
 	vertex_t v2(poly.clipright, poly.clipbottom);
+	add_pending_rows(poly, poly.cliptop, poly.clipbottom);
 	return render_tile<0>(global_cliprect, render_delegate(&voodoo_renderer::rasterizer_fastfill, this), v1, v2);
 }
 
@@ -1352,12 +1357,29 @@ u32 voodoo_renderer::enqueue_triangle(poly_data &poly, vertex_t const *vert)
 	if (info == nullptr)
 	{
 		// add a new one if we're logging usage
-		if (LOG_RASTERIZERS)
+		if (m_log_rasterizers)
 			info = add_rasterizer(poly.raster, generic_rasterizer(poly.raster.generic()), true);
 		else
 			info = m_generic_rasterizer[poly.raster.generic()];
 	}
 
+	// note the rows this triangle can touch, clipping if enabled
+	s32 ystart = s32(floorf(std::min({ vert[0].y, vert[1].y, vert[2].y })));
+	s32 ystop = s32(ceilf(std::max({ vert[0].y, vert[1].y, vert[2].y }))) + 1;
+	if (poly.raster.fbzmode().enable_clipping())
+	{
+		// clipping applies to screen rows, which are flipped with the Y origin
+		s32 cliptop = poly.cliptop, clipbottom = poly.clipbottom;
+		if (poly.raster.fbzmode().y_origin())
+		{
+			cliptop = m_yorigin - poly.clipbottom + 1;
+			clipbottom = m_yorigin - poly.cliptop + 1;
+		}
+		ystart = std::max(ystart, cliptop);
+		ystop = std::min(ystop, clipbottom);
+	}
+	add_pending_rows(poly, ystart, ystop);
+
 	// set the info and render the triangle
 	info->polys++;
 	poly.info = info;
@@ -1365,6 +1387,66 @@ u32 voodoo_renderer::enqueue_triangle(poly_data &poly, vertex_t const *vert)
 }
 
 
+//-------------------------------------------------
+//  add_pending_rows - note that queued work will
+//  touch rows [ystart, ystop) of the buffers used
+//  by the given poly
+//-------------------------------------------------
+
+void voodoo_renderer::add_pending_rows(poly_data const &poly, s32 ystart, s32 ystop)
+{
+	if (ystart >= ystop)
+		return;
+
+	// convert to screen rows
+	s32 scrystart = ystart, scrystop = ystop;
+	if (poly.raster.fbzmode().y_origin())
+	{
+		scrystart = m_yorigin - (ystop - 1);
+		scrystop = m_yorigin - ystart + 1;
+	}
+	scrystart = std::max(scrystart, 0);
+	if (scrystart >= scrystop)
+		return;
+
+	// depth is read as well as written, so track it regardless of the write masks
+	add_pending_range(poly.destbase + scrystart * m_rowpixels, poly.destbase + scrystop * m_rowpixels);
+	if (poly.depthbase != nullptr)
+		add_pending_range(poly.depthbase + scrystart * m_rowpixels, poly.depthbase + scrystop * m_rowpixels);
+}
+
+
+//-------------------------------------------------
+//  add_pending_range - merge a range of memory
+//  into the pending list
+//-------------------------------------------------
+
+void voodoo_renderer::add_pending_range(u16 const *start, u16 const *end)
+{
+	// extend an existing range if it overlaps or abuts the new one
+	for (int index = 0; index < m_pending_count; index++)
+	{
+		pending_range &range = m_pending[index];
+		if (start <= range.end && end >= range.start)
+		{
+			range.start = std::min(range.start, start);
+			range.end = std::max(range.end, end);
+			return;
+		}
+	}
+
+	// add a new one, or fold into the last if we're out of entries
+	if (m_pending_count < PENDING_RANGES)
+		m_pending[m_pending_count++] = { start, end };
+	else
+	{
+		pending_range &range = m_pending[PENDING_RANGES - 1];
+		range.start = std::min(range.start, start);
+		range.end = std::max(range.end, end);
+	}
+}
+
+
 //-------------------------------------------------
 //  stipple_test - test against the stipple
 //  pattern; the enable flag is not checked here,
@@ -2532,7 +2614,7 @@ rasterizer_info *voodoo_renderer::add_rasterizer(rasterizer_params const &params
 
 	// hook us into the hash table
 	u32 hash = info.fullhash % RASTER_HASH_SIZE;
-	if (!is_generic || LOG_RASTERIZERS)
+	if (!is_generic || m_log_rasterizers)
 	{
 		info.next = m_raster_hash[hash];
 		m_raster_hash[hash] = &info;
@@ -2618,6 +2700,40 @@ void voodoo_renderer::dump_rasterizer_stats()
 }
 
 
+//-------------------------------------------------
+//  dump_missed_rasterizers - list the parameter
+//  combinations that fell back to a generic
+//  rasterizer, most heavily used first, in a form
+//  that can be added to voodoo_rast_extra.ipp
+//-------------------------------------------------
+
+void voodoo_renderer::dump_missed_rasterizers(char const *system)
+{
+	if (!m_log_rasterizers)
+		return;
+
+	// gather the generic entries that actually saw use
+	std::vector<rasterizer_info const *> missed;
+	for (rasterizer_info const &info : m_rasterizer_list)
+		if (info.is_generic && info.polys != 0)
+			missed.push_back(&info);
+	std::sort(missed.begin(), missed.end(), [] (rasterizer_info const *a, rasterizer_info const *b) { return a->scanlines > b->scanlines; });
+
+	osd_printf_info("// %s: %d rasterizer modes without a specialised rasterizer\n", system, int(missed.size()));
+	for (rasterizer_info const *info : missed)
+		osd_printf_info("RASTERIZER( 0x%02X, 0x%08X, 0x%08X, 0x%08X, 0x%08X, 0x%08X, 0x%08X ) // %8d %10d\n",
+			info->params.generic(),
+			info->params.fbzcp().raw(),
+			info->params.alphamode().raw(),
+			info->params.fogmode().raw(),
+			info->params.fbzmode().raw(),
+			info->params.texmode0().raw(),
+			info->params.texmode1().raw(),
+			info->polys,
+			info->scanlines);
+}
+
+
 //**************************************************************************
 //  GAME-SPECIFIC RASTERIZERS
 //**************************************************************************
@@ -2891,6 +3007,12 @@ static_rasterizer_info s_predef_raster_table[] =
 	// gtfore06
 	RASTERIZER( 0x05, 0x00482405, 0x00045119, 0x000000C1, 0x00010FF9, 0x00000ACD, 0xFFFFFFFF ) //    51144    2582597
 
+	// modes collected with -voodoo_rasterstats; paste its output into this
+	// optional file to build specialised rasterizers for them as well
+#if __has_include("voodoo_rast_extra.ipp")
+#include "voodoo_rast_extra.ipp"
+#endif
+
 	{ nullptr, rasterizer_params(0xffffffff) }
 };
 
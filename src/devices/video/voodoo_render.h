@@ -495,6 +495,7 @@ struct thread_stats_block
 class voodoo_renderer : public voodoo_poly_manager
 {
 	static constexpr u32 RASTER_HASH_SIZE = 97; // size of the rasterizer hash table
+	static constexpr int PENDING_RANGES = 4;    // number of framebuffer ranges tracked for pending work
 
 public:
 	using rasterizer_mfp = void (voodoo_renderer::*)(int32_t, const extent_t &, const poly_data &, int);
@@ -523,6 +524,24 @@ public:
 	u32 enqueue_fastfill(poly_data &poly);
 	u32 enqueue_triangle(poly_data &poly, vertex_t const *vert);
 
+	// wait for all outstanding work, forgetting any pending framebuffer ranges
+	void wait(char const *debug_reason = "general")
+	{
+		voodoo_poly_manager::wait(debug_reason);
+		m_pending_count = 0;
+	}
+
+	// wait only if outstanding work may touch framebuffer memory in [start, end)
+	void wait_for_range(u16 const *start, u16 const *end, char const *debug_reason)
+	{
+		for (int index = 0; index < m_pending_count; index++)
+			if (start < m_pending[index].end && end > m_pending[index].start)
+			{
+				wait(debug_reason);
+				return;
+			}
+	}
+
 	// core triangle rasterizer
 	template<u32 GenericFlags, u32 FbzCp, u32 FbzMode, u32 AlphaMode, u32 FogMode, u32 TexMode0, u32 TexMode1>
 	void rasterizer(s32 y, const voodoo::voodoo_renderer::extent_t &extent, const voodoo::poly_data &extra, int threadid);
@@ -570,6 +589,7 @@ public:
 
 	// dump rasterizer statistics if enabled
 	void dump_rasterizer_stats();
+	void dump_missed_rasterizers(char const *system);
 
 private:
 	// pipeline stages, in order
@@ -590,6 +610,15 @@ private:
 	// helpers
 	static rasterizer_mfp generic_rasterizer(u8 texmask);
 	voodoo::rasterizer_info *add_rasterizer(voodoo::rasterizer_params const &params, rasterizer_mfp rasterizer, bool is_generic);
+	void add_pending_rows(voodoo::poly_data const &poly, s32 ystart, s32 ystop);
+	void add_pending_range(u16 const *start, u16 const *end);
+
+	// a range of framebuffer memory with queued writes
+	struct pending_range
+	{
+		u16 const *start;
+		u16 const *end;
+	};
 
 	// internal state
 	u8 m_bilinear_mask;         // mask for bilinear resolution (0xf0 for V1, 0xff for V2)
@@ -603,12 +632,15 @@ private:
 	u8 m_fogblend[64];          // 64-entry fog table
 	u8 m_fogdelta[64];          // 64-entry fog table
 	u8 m_fogdelta_mask;         // mask for for delta (0xff for V1, 0xfc for V2)
+	bool m_log_rasterizers;     // track usage of each distinct set of parameters
 	poly_array<voodoo::rasterizer_texture, 2> m_textures;
 	poly_array<voodoo::rasterizer_palette, 8> m_palettes;
 	voodoo::rasterizer_info *m_raster_hash[RASTER_HASH_SIZE]; // hash table of rasterizers
 	voodoo::rasterizer_info *m_generic_rasterizer[16];
 	std::list<voodoo::rasterizer_info> m_rasterizer_list;
 	std::vector<thread_stats_block> m_thread_stats;
+	pending_range m_pending[PENDING_RANGES]; // framebuffer ranges touched by outstanding work
+	int m_pending_count;        // number of valid entries in m_pending
 };
 
 }
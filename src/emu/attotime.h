@@ -342,7 +342,13 @@ inline constexpr attoseconds_t attotime::as_attoseconds() const noexcept
 /** as_ticks - convert to ticks at @p frequency */
 inline u64 attotime::as_ticks(u32 frequency) const
 {
-	u32 fracticks = (attotime(0, m_attoseconds) * frequency).m_seconds;
+	// same truncation as multiplying attotime(0, m_attoseconds) by the
+	// frequency, but both halves fit in 64 bits so there's no need to
+	// normalize through operator*=
+	u64 const attohi = u64(m_attoseconds) / ATTOSECONDS_PER_SECOND_SQRT;
+	u64 const attolo = u64(m_attoseconds) % ATTOSECONDS_PER_SECOND_SQRT;
+	u64 const scaled = (attolo * frequency) / ATTOSECONDS_PER_SECOND_SQRT + (attohi * frequency);
+	u32 const fracticks = u32(scaled / ATTOSECONDS_PER_SECOND_SQRT);
 	return mulu_32x32(m_seconds, frequency) + fracticks;
 }
 
@@ -96,12 +96,11 @@ inline u64 debugger_commands::cheat_system::byte_swap(u64 value) const
 }
 
 /*-------------------------------------------------
-    cheat_read_extended - read a value from memory
-    in the given address space, sign-extending
-    and swapping if necessary
+    cheat_read_raw - read a value from memory in
+    the given address space
 -------------------------------------------------*/
 
-u64 debugger_commands::cheat_system::read_extended(offs_t address) const
+u64 debugger_commands::cheat_system::read_raw(offs_t address) const
 {
 	address &= space->logaddrmask();
 	u64 value = space->unmap();
@@ -116,9 +115,103 @@ u64 debugger_commands::cheat_system::read_extended(offs_t address) const
 		case 8: value = tspace->read_qword_unaligned(address);   break;
 		}
 	}
+	return value;
+}
+
+/*-------------------------------------------------
+    cheat_decode - convert a value stored as bytes
+    in address order, sign-extending and swapping
+    if necessary
+-------------------------------------------------*/
+
+inline u64 debugger_commands::cheat_system::decode(u8 const *data) const
+{
+	u64 value = 0;
+	if (space->endianness() == ENDIANNESS_LITTLE)
+		for (int i = width - 1; i >= 0; i--)
+			value = (value << 8) | data[i];
+	else
+		for (int i = 0; i < width; i++)
+			value = (value << 8) | data[i];
 	return sign_extend(byte_swap(value));
 }
 
+/*-------------------------------------------------
+    cheat_block_pointer - return a host pointer to
+    a run of memory if its bytes are laid out in
+    address order, or nullptr; a thorough check
+    also verifies the run is contiguous throughout
+-------------------------------------------------*/
+
+u8 const *debugger_commands::cheat_system::block_pointer(address_space &space, u64 offset, u64 length, bool thorough)
+{
+	if (space.addr_shift() || !length)
+		return nullptr;
+
+	auto const pointer =
+			[&space] (u64 address) -> u8 const *
+			{
+				offs_t addr = address & space.logaddrmask();
+				address_space *tspace;
+				if (!space.device().memory().translate(space.spacenum(), device_memory_interface::TR_READ, addr, tspace))
+					return nullptr;
+				if (tspace->addr_shift() || (tspace->endianness() != space.endianness()))
+					return nullptr;
+				if ((tspace->data_width() > 8) && (tspace->endianness() != ENDIANNESS_NATIVE))
+					return nullptr;
+				return reinterpret_cast<u8 const *>(tspace->get_write_ptr(addr));
+			};
+
+	u8 const *const base = pointer(offset);
+	if (!base || (pointer(offset + length - 1) != (base + length - 1)))
+		return nullptr;
+	if (thorough)
+	{
+		for (u64 step = 0x100; step < length; step += 0x100)
+			if (pointer(offset + step) != (base + step))
+				return nullptr;
+	}
+	return base;
+}
+
+/*-------------------------------------------------
+    cheat_capture - read current values of a run
+    of locations in a block as bytes in address
+    order
+-------------------------------------------------*/
+
+void debugger_commands::cheat_system::capture(cheat_block const &block, u8 const *base, u32 index, u32 count, u8 *dest) const
+{
+	if (base)
+	{
+		std::memcpy(dest, base + (index * width), count * width);
+	}
+	else
+	{
+		bool const little = space->endianness() == ENDIANNESS_LITTLE;
+		for (u32 i = 0; i < count; i++, dest += width)
+		{
+			u64 value = read_raw(block.offset + (u64(index + i) * width));
+			for (int b = 0; b < width; b++, value >>= 8)
+				dest[little ? b : (width - 1 - b)] = u8(value);
+		}
+	}
+}
+
+/*-------------------------------------------------
+    cheat_candidates - return the number of
+    locations still matching
+-------------------------------------------------*/
+
+u64 debugger_commands::cheat_system::candidates() const
+{
+	u64 result = 0;
+	for (cheat_block const &block : blocks)
+		for (u64 const live : block.live)
+			result += population_count_64(live);
+	return result;
+}
+
 debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu, debugger_console& console)
 	: m_machine(machine)
 	, m_console(console)
@@ -269,6 +362,11 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 
 	m_console.register_command("rewind",    CMDFLAG_NONE, 0, 0, std::bind(&debugger_commands::execute_rewind, this, _1));
 	m_console.register_command("rw",        CMDFLAG_NONE, 0, 0, std::bind(&debugger_commands::execute_rewind, this, _1));
+	m_console.register_command("rrecord",   CMDFLAG_NONE, 0, 1, std::bind(&debugger_commands::execute_rrecord, this, _1));
+	m_console.register_command("rstep",     CMDFLAG_NONE, 0, 1, std::bind(&debugger_commands::execute_rstep, this, _1));
+	m_console.register_command("rs",        CMDFLAG_NONE, 0, 1, std::bind(&debugger_commands::execute_rstep, this, _1));
+	m_console.register_command("rcontinue", CMDFLAG_NONE, 0, 0, std::bind(&debugger_commands::execute_rcontinue, this, _1));
+	m_console.register_command("rc",        CMDFLAG_NONE, 0, 0, std::bind(&debugger_commands::execute_rcontinue, this, _1));
 
 	m_console.register_command("save",      CMDFLAG_NONE, 3, 3, std::bind(&debugger_commands::execute_save, this, -1, _1));
 	m_console.register_command("saved",     CMDFLAG_NONE, 3, 3, std::bind(&debugger_commands::execute_save, this, AS_DATA, _1));
@@ -347,6 +445,10 @@ debugger_commands::debugger_commands(running_machine& machine, debugger_cpu& cpu
 	m_console.register_command("mapi",      CMDFLAG_NONE, 1, 1, std::bind(&debugger_commands::execute_map, this, AS_IO, _1));
 	m_console.register_command("mapo",      CMDFLAG_NONE, 1, 1, std::bind(&debugger_commands::execute_map, this, AS_OPCODES, _1));
 	m_console.register_command("memdump",   CMDFLAG_NONE, 0, 2, std::bind(&debugger_commands::execute_memdump, this, _1));
+	m_console.register_command("heatmap",   CMDFLAG_NONE, 1, 3, std::bind(&debugger_commands::execute_heatmap, this, -1, _1));
+	m_console.register_command("heatmapd",  CMDFLAG_NONE, 1, 3, std::bind(&debugger_commands::execute_heatmap, this, AS_DATA, _1));
+	m_console.register_command("heatmapi",  CMDFLAG_NONE, 1, 3, std::bind(&debugger_commands::execute_heatmap, this, AS_IO, _1));
+	m_console.register_command("heatmapo",  CMDFLAG_NONE, 1, 3, std::bind(&debugger_commands::execute_heatmap, this, AS_OPCODES, _1));
 
 	m_console.register_command("symlist",   CMDFLAG_NONE, 0, 1, std::bind(&debugger_commands::execute_symlist, this, _1));
 
@@ -1998,6 +2100,73 @@ void debugger_commands::execute_rewind(const std::vector<std::string_view> &para
 }
 
 
+/*-------------------------------------------------
+    execute_rrecord - execute the rrecord command
+-------------------------------------------------*/
+
+void debugger_commands::execute_rrecord(const std::vector<std::string_view> &params)
+{
+	using namespace std::literals;
+	debugger_cpu &debugcpu = m_machine.debugger().cpu();
+	if (!params.empty())
+	{
+		u64 frames = 0;
+		if (!util::streqlower(params[0], "off"sv))
+		{
+			if (!m_console.validate_number_parameter(params[0], frames))
+				return;
+			if (!frames)
+			{
+				m_console.printf("Invalid number of frames\n");
+				return;
+			}
+		}
+		debugcpu.reverse_record(u32(std::min<u64>(frames, ~u32(0))));
+	}
+
+	if (debugcpu.reverse_interval())
+		m_console.printf("Recording a snapshot every %d frames, %d recorded using %d KB\n", debugcpu.reverse_interval(), debugcpu.reverse_snapshot_count(), debugcpu.reverse_memory_used() / 1024);
+	else
+		m_console.printf("Reverse execution recording is off\n");
+}
+
+
+/*-------------------------------------------------
+    execute_rstep - execute the rstep command
+-------------------------------------------------*/
+
+void debugger_commands::execute_rstep(const std::vector<std::string_view> &params)
+{
+	/* if we have a parameter, use it */
+	u64 steps = 1;
+	if (params.size() > 0 && !m_console.validate_number_parameter(params[0], steps))
+		return;
+
+	if (m_machine.debugger().cpu().reverse_step(*m_console.get_visible_cpu(), u32(std::min<u64>(steps, ~u32(0)))))
+		for (device_t &device : device_enumerator(m_machine.root_device()))
+		{
+			device.debug()->track_pc_data_clear();
+			device.debug()->track_mem_data_clear();
+		}
+}
+
+
+/*-------------------------------------------------
+    execute_rcontinue - execute the rcontinue
+    command
+-------------------------------------------------*/
+
+void debugger_commands::execute_rcontinue(const std::vector<std::string_view> &params)
+{
+	if (m_machine.debugger().cpu().reverse_continue(*m_console.get_visible_cpu()))
+		for (device_t &device : device_enumerator(m_machine.root_device()))
+		{
+			device.debug()->track_pc_data_clear();
+			device.debug()->track_mem_data_clear();
+		}
+}
+
+
 /*-------------------------------------------------
     execute_save - execute the save command
 -------------------------------------------------*/
@@ -2753,12 +2922,40 @@ void debugger_commands::execute_cheatrange(bool init, const std::vector<std::str
 		}
 	}
 
-	// determine the writable extent of each region in total
+	// split the regions into blocks, reading through host pointers where possible
+	std::vector<cheat_block> blocks;
 	u64 real_length = 0;
+	u32 const block_locations = cheat_system::BLOCK_BYTES / width;
 	for (unsigned i = 0; i < region_count; i++)
-		for (u64 curaddr = cheat_region[i].offset; curaddr <= cheat_region[i].endoffset; curaddr += width)
-			if (cheat_address_is_valid(*space, curaddr))
-				real_length++;
+	{
+		if (cheat_region[i].endoffset < cheat_region[i].offset)
+			continue;
+
+		u64 const total = (cheat_region[i].endoffset - cheat_region[i].offset) / width + 1;
+		for (u64 index = 0; index < total; index += block_locations)
+		{
+			cheat_block block;
+			block.offset = cheat_region[i].offset + (index * width);
+			block.count = u32(std::min<u64>(total - index, block_locations));
+			block.direct = cheat_system::block_pointer(*space, block.offset, u64(block.count) * width, true) != nullptr;
+			block.live.resize((block.count + 63) / 64, 0);
+
+			u64 valid = 0;
+			for (u32 loc = 0; loc < block.count; loc++)
+			{
+				if (block.direct || cheat_address_is_valid(*space, block.offset + (u64(loc) * width)))
+				{
+					block.live[loc / 64] |= u64(1) << (loc % 64);
+					valid++;
+				}
+			}
+			if (valid)
+			{
+				real_length += valid;
+				blocks.emplace_back(std::move(block));
+			}
+		}
+	}
 
 	if (!real_length)
 	{
@@ -2766,34 +2963,27 @@ void debugger_commands::execute_cheatrange(bool init, const std::vector<std::str
 		return;
 	}
 
-	size_t active_cheat = 0;
 	if (init)
 	{
 		// initialize new cheat system
 		m_cheat.space = space;
 		m_cheat.width = width;
-		m_cheat.undo = 0;
 		m_cheat.signed_cheat = signed_cheat;
 		m_cheat.swapped_cheat = swapped_cheat;
+		m_cheat.blocks.clear();
+		m_cheat.undo.clear();
 	}
-	else
+
+	// record the starting values in the selected space
+	for (cheat_block &block : blocks)
 	{
-		active_cheat = m_cheat.cheatmap.size();
+		u8 const *const base = block.direct ? cheat_system::block_pointer(*space, block.offset, u64(block.count) * width, false) : nullptr;
+		block.first.resize(block.count * width);
+		m_cheat.capture(block, base, 0, block.count, &block.first[0]);
+		block.previous = block.first;
+		m_cheat.blocks.emplace_back(std::move(block));
 	}
-	m_cheat.cheatmap.resize(active_cheat + real_length);
-
-	// initialize cheatmap in the selected space
-	for (unsigned i = 0; i < region_count; i++)
-		for (u64 curaddr = cheat_region[i].offset; curaddr <= cheat_region[i].endoffset; curaddr += width)
-			if (cheat_address_is_valid(*space, curaddr))
-			{
-				m_cheat.cheatmap[active_cheat].previous_value = m_cheat.read_extended(curaddr);
-				m_cheat.cheatmap[active_cheat].first_value = m_cheat.cheatmap[active_cheat].previous_value;
-				m_cheat.cheatmap[active_cheat].offset = curaddr;
-				m_cheat.cheatmap[active_cheat].state = 1;
-				m_cheat.cheatmap[active_cheat].undo = 0;
-				active_cheat++;
-			}
+	u64 const active_cheat = m_cheat.candidates();
 
 	// give a detailed init message to avoid searches being mistakenly carried out on the wrong CPU
 	m_console.printf(
@@ -2873,108 +3063,158 @@ void debugger_commands::execute_cheatnext(bool initial, const std::vector<std::s
 		}
 	}
 
-	m_cheat.undo++;
-
-	// execute the search
-	u32 active_cheat = 0;
-	for (u64 cheatindex = 0; cheatindex < m_cheat.cheatmap.size(); cheatindex += 1)
-		if (m_cheat.cheatmap[cheatindex].state == 1)
-		{
-			u64 cheat_value = m_cheat.read_extended(m_cheat.cheatmap[cheatindex].offset);
-			u64 comp_byte = initial
-					? m_cheat.cheatmap[cheatindex].first_value
-					: m_cheat.cheatmap[cheatindex].previous_value;
-			u8 disable_byte = false;
-
-			switch (condition)
+	auto const disable =
+			[this, condition, comp_value] (u64 cheat_value, u64 comp_byte) -> bool
 			{
+				switch (condition)
+				{
 				case CHEAT_ALL:
-					break;
+					return false;
 
 				case CHEAT_EQUAL:
-					disable_byte = (cheat_value != comp_byte);
-					break;
+					return cheat_value != comp_byte;
 
 				case CHEAT_NOTEQUAL:
-					disable_byte = (cheat_value == comp_byte);
-					break;
+					return cheat_value == comp_byte;
 
 				case CHEAT_EQUALTO:
-					disable_byte = (cheat_value != comp_value);
-					break;
+					return cheat_value != comp_value;
 
 				case CHEAT_NOTEQUALTO:
-					disable_byte = (cheat_value == comp_value);
-					break;
+					return cheat_value == comp_value;
 
 				case CHEAT_DECREASE:
 					if (m_cheat.signed_cheat)
-						disable_byte = (s64(cheat_value) >= s64(comp_byte));
+						return s64(cheat_value) >= s64(comp_byte);
 					else
-						disable_byte = (u64(cheat_value) >= u64(comp_byte));
-					break;
+						return u64(cheat_value) >= u64(comp_byte);
 
 				case CHEAT_INCREASE:
 					if (m_cheat.signed_cheat)
-						disable_byte = (s64(cheat_value) <= s64(comp_byte));
+						return s64(cheat_value) <= s64(comp_byte);
 					else
-						disable_byte = (u64(cheat_value) <= u64(comp_byte));
-					break;
+						return u64(cheat_value) <= u64(comp_byte);
 
 				case CHEAT_DECREASE_OR_EQUAL:
 					if (m_cheat.signed_cheat)
-						disable_byte = (s64(cheat_value) > s64(comp_byte));
+						return s64(cheat_value) > s64(comp_byte);
 					else
-						disable_byte = (u64(cheat_value) > u64(comp_byte));
-					break;
+						return u64(cheat_value) > u64(comp_byte);
 
 				case CHEAT_INCREASE_OR_EQUAL:
 					if (m_cheat.signed_cheat)
-						disable_byte = (s64(cheat_value) < s64(comp_byte));
+						return s64(cheat_value) < s64(comp_byte);
 					else
-						disable_byte = (u64(cheat_value) < u64(comp_byte));
-					break;
+						return u64(cheat_value) < u64(comp_byte);
 
 				case CHEAT_DECREASEOF:
-					disable_byte = (cheat_value != comp_byte - comp_value);
-					break;
+					return cheat_value != comp_byte - comp_value;
 
 				case CHEAT_INCREASEOF:
-					disable_byte = (cheat_value != comp_byte + comp_value);
-					break;
+					return cheat_value != comp_byte + comp_value;
 
 				case CHEAT_SMALLEROF:
 					if (m_cheat.signed_cheat)
-						disable_byte = (s64(cheat_value) >= s64(comp_value));
+						return s64(cheat_value) >= s64(comp_value);
 					else
-						disable_byte = (u64(cheat_value) >= u64(comp_value));
-					break;
+						return u64(cheat_value) >= u64(comp_value);
 
 				case CHEAT_GREATEROF:
 					if (m_cheat.signed_cheat)
-						disable_byte = (s64(cheat_value) <= s64(comp_value));
+						return s64(cheat_value) <= s64(comp_value);
 					else
-						disable_byte = (u64(cheat_value) <= u64(comp_value));
-					break;
+						return u64(cheat_value) <= u64(comp_value);
+
 				case CHEAT_CHANGEDBY:
 					if (cheat_value > comp_byte)
-						disable_byte = (cheat_value != comp_byte + comp_value);
+						return cheat_value != comp_byte + comp_value;
 					else
-						disable_byte = (cheat_value != comp_byte - comp_value);
-					break;
-			}
+						return cheat_value != comp_byte - comp_value;
+				}
+				return false;
+			};
+
+	// conditions relative to the compared value give the same result for
+	// every location that hasn't changed: -1 if not, otherwise the result
+	int unchanged = -1;
+	switch (condition)
+	{
+	case CHEAT_ALL:
+	case CHEAT_EQUAL:
+	case CHEAT_DECREASE_OR_EQUAL:
+	case CHEAT_INCREASE_OR_EQUAL:
+		unchanged = 0;
+		break;
+	case CHEAT_NOTEQUAL:
+	case CHEAT_DECREASE:
+	case CHEAT_INCREASE:
+		unchanged = 1;
+		break;
+	case CHEAT_DECREASEOF:
+	case CHEAT_INCREASEOF:
+	case CHEAT_CHANGEDBY:
+		unchanged = comp_value ? 1 : 0;
+		break;
+	}
 
-			if (disable_byte)
+	// execute the search 64 locations at a time, skipping groups with no candidates
+	std::vector<cheat_undo> &undo = m_cheat.undo.emplace_back();
+	u32 const width = m_cheat.width;
+	std::vector<u8> current(64 * width);
+	u32 active_cheat = 0;
+	for (u32 blockindex = 0; blockindex < m_cheat.blocks.size(); blockindex++)
+	{
+		cheat_block &block = m_cheat.blocks[blockindex];
+		u8 const *const base = block.direct ? cheat_system::block_pointer(*space, block.offset, u64(block.count) * width, false) : nullptr;
+		for (u32 word = 0; word < block.live.size(); word++)
+		{
+			u64 const live = block.live[word];
+			if (!live)
+				continue;
+
+			u32 const index = word * 64;
+			u32 const count = std::min<u32>(block.count - index, 64);
+			m_cheat.capture(block, base, index, count, &current[0]);
+			u8 *const previous = &block.previous[index * width];
+			u8 const *const reference = initial ? &block.first[index * width] : previous;
+
+			u64 disabled = 0;
+			if ((0 <= unchanged) && !std::memcmp(&current[0], reference, count * width))
 			{
-				m_cheat.cheatmap[cheatindex].state = 0;
-				m_cheat.cheatmap[cheatindex].undo = m_cheat.undo;
+				if (unchanged)
+					disabled = live;
 			}
 			else
-				active_cheat++;
+			{
+				for (u32 bit = 0; bit < count; bit++)
+				{
+					if (BIT(live, bit) && disable(m_cheat.decode(&current[bit * width]), m_cheat.decode(&reference[bit * width])))
+						disabled |= u64(1) << bit;
+				}
+			}
 
-			// update previous value
-			m_cheat.cheatmap[cheatindex].previous_value = cheat_value;
+			if (disabled)
+			{
+				block.live[word] = live & ~disabled;
+				undo.emplace_back(cheat_undo{ blockindex, word, disabled });
+			}
+			active_cheat += population_count_64(live & ~disabled);
+
+			// update previous values
+			if (live == ~u64(0))
+			{
+				std::memcpy(previous, &current[0], 64 * width);
+			}
+			else
+			{
+				for (u32 bit = 0; bit < count; bit++)
+				{
+					if (BIT(live, bit))
+						std::memcpy(&previous[bit * width], &current[bit * width], width);
+				}
+			}
 		}
+	}
 
 	if (active_cheat <= 5)
 		execute_cheatlist(std::vector<std::string_view>());
@@ -3053,13 +3293,17 @@ void debugger_commands::execute_cheatlist(const std::vector<std::string_view> &p
 	// write the cheat list
 	u32 active_cheat = 0;
 	util::ovectorstream output;
-	for (u64 cheatindex = 0; cheatindex < m_cheat.cheatmap.size(); cheatindex += 1)
+	for (cheat_block const &block : m_cheat.blocks)
 	{
-		if (m_cheat.cheatmap[cheatindex].state == 1)
+		for (u32 loc = 0; loc < block.count; loc++)
 		{
-			u64 const value = m_cheat.byte_swap(m_cheat.read_extended(m_cheat.cheatmap[cheatindex].offset)) & sizemask;
-			u64 const first_value = m_cheat.byte_swap(m_cheat.cheatmap[cheatindex].first_value) & sizemask;
-			offs_t const address = space->byte_to_address(m_cheat.cheatmap[cheatindex].offset);
+			if (!BIT(block.live[loc / 64], loc % 64))
+				continue;
+
+			u64 const offset = block.offset + (u64(loc) * m_cheat.width);
+			u64 const value = m_cheat.byte_swap(m_cheat.read_extended(offset)) & sizemask;
+			u64 const first_value = m_cheat.byte_swap(m_cheat.decode(&block.first[loc * m_cheat.width])) & sizemask;
+			offs_t const address = space->byte_to_address(offset);
 
 			if (!params.empty())
 			{
@@ -3107,20 +3351,16 @@ void debugger_commands::execute_cheatlist(const std::vector<std::string_view> &p
 
 void debugger_commands::execute_cheatundo(const std::vector<std::string_view> &params)
 {
-	if (m_cheat.undo > 0)
+	if (!m_cheat.undo.empty())
 	{
 		u64 undo_count = 0;
-		for (u64 cheatindex = 0; cheatindex < m_cheat.cheatmap.size(); cheatindex += 1)
+		for (cheat_undo const &step : m_cheat.undo.back())
 		{
-			if (m_cheat.cheatmap[cheatindex].undo == m_cheat.undo)
-			{
-				m_cheat.cheatmap[cheatindex].state = 1;
-				m_cheat.cheatmap[cheatindex].undo = 0;
-				undo_count++;
-			}
+			m_cheat.blocks[step.block].live[step.word] |= step.bits;
+			undo_count += population_count_64(step.bits);
 		}
 
-		m_cheat.undo--;
+		m_cheat.undo.pop_back();
 		m_console.printf("%u cheat reactivated\n", undo_count);
 	}
 	else
@@ -3477,6 +3717,8 @@ void debugger_commands::execute_trace(const std::vector<std::string_view> &param
 	std::string_view action;
 	bool detect_loops = true;
 	bool logerror = false;
+	bool binary = false;
+	bool registers = false;
 	std::string filename(params[0]);
 
 	// replace macros
@@ -3499,6 +3741,10 @@ void debugger_commands::execute_trace(const std::vector<std::string_view> &param
 				detect_loops = false;
 			else if (util::streqlower(flag, "logerror"sv))
 				logerror = true;
+			else if (util::streqlower(flag, "binary"sv))
+				binary = true;
+			else if (util::streqlower(flag, "registers"sv))
+				binary = registers = true;
 			else
 			{
 				m_console.printf("Invalid flag '%s'\n", flag);
@@ -3515,6 +3761,8 @@ void debugger_commands::execute_trace(const std::vector<std::string_view> &param
 	if (!util::streqlower(filename, "off"sv))
 	{
 		std::ios_base::openmode mode = std::ios_base::out;
+		if (binary)
+			mode |= std::ios_base::binary;
 
 		// opening for append?
 		if ((filename[0] == '>') && (filename[1] == '>'))
@@ -3535,7 +3783,7 @@ void debugger_commands::execute_trace(const std::vector<std::string_view> &param
 
 	// do it
 	bool const on(f);
-	cpu->debug()->trace(std::move(f), trace_over, detect_loops, logerror, action);
+	cpu->debug()->trace(std::move(f), trace_over, detect_loops, logerror, action, binary, registers);
 	if (on)
 		m_console.printf("Tracing CPU '%s' to file %s\n", cpu->tag(), filename);
 	else
@@ -3900,6 +4148,103 @@ void debugger_commands::execute_memdump(const std::vector<std::string_view> &par
 }
 
 
+/*-------------------------------------------------
+    execute_heatmap - execute the heatmap command
+-------------------------------------------------*/
+
+void debugger_commands::execute_heatmap(int spacenum, const std::vector<std::string_view> &params)
+{
+	// validate parameters
+	address_space *space;
+	if (!m_console.validate_device_space_parameter((params.size() > 1) ? params[1] : std::string_view(), spacenum, space))
+		return;
+
+	u64 limit = 16;
+	if ((params.size() > 2) && !m_console.validate_number_parameter(params[2], limit))
+		return;
+
+	if (params[0] == "on")
+	{
+		space->set_heatmap_enabled(true);
+		m_console.printf("Counting accesses to %s space of '%s'\n", space->name(), space->device().tag());
+		return;
+	}
+	else if (params[0] == "off")
+	{
+		space->set_heatmap_enabled(false);
+		m_console.printf("Stopped counting accesses to %s space of '%s'\n", space->name(), space->device().tag());
+		return;
+	}
+	else if ((params[0] != "clear") && (params[0] != "list"))
+	{
+		m_console.printf("Invalid heatmap operation '%s' (expected on, off, clear or list)\n", params[0]);
+		return;
+	}
+
+	memory_heatmap *const heatmap = space->heatmap();
+	if (!heatmap)
+	{
+		m_console.printf("Access counting is not enabled for %s space of '%s'\n", space->name(), space->device().tag());
+		return;
+	}
+
+	if (params[0] == "clear")
+	{
+		heatmap->reset();
+		m_console.printf("Cleared access counts for %s space of '%s'\n", space->name(), space->device().tag());
+		return;
+	}
+
+	// print the busiest handlers in each direction
+	auto const list_handlers =
+		[this, space, limit] (const char *what, const std::vector<memory_heatmap::handler_count> &handlers)
+		{
+			std::vector<const memory_heatmap::handler_count *> sorted;
+			for (const memory_heatmap::handler_count &handler : handlers)
+				if (handler.count)
+					sorted.emplace_back(&handler);
+			std::sort(
+					sorted.begin(),
+					sorted.end(),
+					[] (const memory_heatmap::handler_count *a, const memory_heatmap::handler_count *b) { return a->count > b->count; });
+			if (sorted.size() > limit)
+				sorted.resize(limit);
+
+			m_console.printf("%s handlers:\n", what);
+			for (const memory_heatmap::handler_count *handler : sorted)
+				m_console.printf("  %0*X-%0*X %12u %s\n", space->addrchars(), handler->start, space->addrchars(), handler->end, handler->count, handler->name);
+		};
+	list_handlers("Read", heatmap->handler_reads());
+	list_handlers("Write", heatmap->handler_writes());
+
+	// then the busiest pages
+	auto const list_pages =
+		[this, space, limit, heatmap] (const char *what, const std::vector<u64> &pages)
+		{
+			std::vector<offs_t> sorted;
+			for (offs_t page = 0; page != pages.size(); page++)
+				if (pages[page])
+					sorted.emplace_back(page);
+			std::sort(
+					sorted.begin(),
+					sorted.end(),
+					[&pages] (offs_t a, offs_t b) { return pages[a] > pages[b]; });
+			if (sorted.size() > limit)
+				sorted.resize(limit);
+
+			m_console.printf("%s pages:\n", what);
+			for (offs_t page : sorted)
+			{
+				offs_t const start = page << heatmap->page_shift();
+				offs_t const end = start | make_bitmask<offs_t>(heatmap->page_shift());
+				m_console.printf("  %0*X-%0*X %12u\n", space->addrchars(), start, space->addrchars(), end, pages[page]);
+			}
+		};
+	list_pages("Read", heatmap->page_reads());
+	list_pages("Write", heatmap->page_writes());
+}
+
+
 /*-------------------------------------------------
     execute_symlist - execute the symlist command
 -------------------------------------------------*/
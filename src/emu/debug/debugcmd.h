@@ -34,28 +34,47 @@ private:
 	};
 
 
-	struct cheat_map
+	// a run of consecutive cheat locations; values are kept as raw bytes
+	// in address order so unchanged runs can be found with a memcmp
+	struct cheat_block
 	{
-		u64         offset;
-		u64         first_value;
-		u64         previous_value;
-		u8          state:1;
-		u8          undo:7;
+		u64         offset;         // address of the first location
+		u32         count;          // number of locations
+		bool        direct;         // locations can be read through a host pointer
+		std::vector<u8> first;      // values when the search was initialized
+		std::vector<u8> previous;   // values at the last search
+		std::vector<u64> live;      // one bit per location still matching
+	};
+
+	// live bits cleared in one bitmap word by a search
+	struct cheat_undo
+	{
+		u32         block;
+		u32         word;
+		u64         bits;
 	};
 
 	// TODO [RH 31 May 2016]: Move this cheat stuff into its own class
 	struct cheat_system
 	{
+		// address range covered by each block
+		static constexpr u32 BLOCK_BYTES = 0x10000;
+
 		address_space *space;
 		u8          width;
 		u8          signed_cheat;
 		u8          swapped_cheat;
-		std::vector<cheat_map> cheatmap;
-		u8          undo;
+		std::vector<cheat_block> blocks;
+		std::vector<std::vector<cheat_undo> > undo;
 
 		u64 sign_extend(u64 value) const;
 		u64 byte_swap(u64 value) const;
-		u64 read_extended(offs_t address) const;
+		u64 read_raw(offs_t address) const;
+		u64 read_extended(offs_t address) const { return sign_extend(byte_swap(read_raw(address))); }
+		u64 decode(u8 const *data) const;
+		static u8 const *block_pointer(address_space &space, u64 offset, u64 length, bool thorough);
+		void capture(cheat_block const &block, u8 const *base, u32 index, u32 count, u8 *dest) const;
+		u64 candidates() const;
 	};
 
 	struct cheat_region_map
@@ -129,6 +148,9 @@ private:
 	void execute_statesave(const std::vector<std::string_view> &params);
 	void execute_stateload(const std::vector<std::string_view> &params);
 	void execute_rewind(const std::vector<std::string_view> &params);
+	void execute_rrecord(const std::vector<std::string_view> &params);
+	void execute_rstep(const std::vector<std::string_view> &params);
+	void execute_rcontinue(const std::vector<std::string_view> &params);
 	void execute_save(int spacenum, const std::vector<std::string_view> &params);
 	void execute_saveregion(const std::vector<std::string_view> &params);
 	void execute_load(int spacenum, const std::vector<std::string_view> &params);
@@ -152,6 +174,7 @@ private:
 	void execute_source(const std::vector<std::string_view> &params);
 	void execute_map(int spacenum, const std::vector<std::string_view> &params);
 	void execute_memdump(const std::vector<std::string_view> &params);
+	void execute_heatmap(int spacenum, const std::vector<std::string_view> &params);
 	void execute_symlist(const std::vector<std::string_view> &params);
 	void execute_softreset(const std::vector<std::string_view> &params);
 	void execute_hardreset(const std::vector<std::string_view> &params);
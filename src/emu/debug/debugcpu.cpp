@@ -25,9 +25,15 @@
 #include "uiinput.h"
 
 #include "corestr.h"
+#include "disasmtrace.h"
 #include "osdepend.h"
 #include "xmlfile.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 
 const size_t debugger_cpu::NUM_TEMP_VARIABLES = 10;
 
@@ -53,6 +59,25 @@ debugger_cpu::debugger_cpu(running_machine &machine)
 	, m_wpsize(0)
 	, m_last_periodic_update_time(0)
 	, m_comments_loaded(false)
+	, m_reverse_interval(0)
+	, m_reverse_frames(0)
+	, m_reverse_loading(false)
+	, m_reverse_phase(reverse_phase::IDLE)
+	, m_reverse_device(nullptr)
+	, m_reverse_devindex(0)
+	, m_reverse_breakpoints(false)
+	, m_reverse_index(0)
+	, m_reverse_end(0)
+	, m_reverse_count(0)
+	, m_reverse_history_next(0)
+	, m_reverse_history_valid(0)
+	, m_reverse_found(false)
+	, m_reverse_wphit(false)
+	, m_reverse_hit(0)
+	, m_reverse_target_index(0)
+	, m_reverse_target(0)
+	, m_reverse_limit(attotime::never)
+	, m_reverse_loaded(0)
 {
 	m_tempvar = make_unique_clear<u64[]>(NUM_TEMP_VARIABLES);
 
@@ -96,6 +121,11 @@ debugger_cpu::debugger_cpu(running_machine &machine)
 		snprintf(symname, 10, "temp%d", regnum);
 		m_symtable->add(symname, symbol_table::READ_WRITE, &m_tempvar[regnum]);
 	}
+
+	/* snapshots for reverse execution are counted in frames, and invalidated by anything that moves the machine elsewhere */
+	m_machine.add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&debugger_cpu::on_frame, this));
+	m_machine.add_notifier(MACHINE_NOTIFY_RESET, machine_notify_delegate(&debugger_cpu::on_reset, this));
+	m_machine.save().register_postload(save_prepost_delegate(FUNC(debugger_cpu::on_postload), this));
 }
 
 
@@ -409,6 +439,393 @@ void debugger_cpu::halt_on_next_instruction(device_t *device, util::format_argum
 	}
 }
 
+
+//**************************************************************************
+//  REVERSE EXECUTION
+//**************************************************************************
+
+// Snapshots are captured between timeslices every few frames, sharing
+// unchanged pages with the previous one.  Going back loads the latest
+// snapshot before the current instruction and replays forward twice: once
+// to find the cycle count of the instruction or breakpoint hit to stop at,
+// and again to stop there.  Snapshots are only restored between timeslices
+// so the replay interleaves devices the same way as the original run.
+
+void debugger_cpu::on_frame()
+{
+	if (m_reverse_interval && !reversing())
+		m_reverse_frames++;
+}
+
+void debugger_cpu::on_reset()
+{
+	reverse_clear();
+}
+
+void debugger_cpu::on_postload()
+{
+	// a state loaded from elsewhere leaves the snapshots describing a different timeline
+	if (!m_reverse_loading)
+		reverse_clear();
+}
+
+
+//-------------------------------------------------
+//  reverse_record - start or stop capturing
+//  snapshots for reverse execution
+//-------------------------------------------------
+
+void debugger_cpu::reverse_record(u32 frames)
+{
+	reverse_clear();
+	m_reverse_interval = frames;
+
+	// capture the first snapshot at the end of the current timeslice
+	m_reverse_frames = frames;
+	if (m_reverse_devices.empty())
+		for (device_execute_interface &exec : execute_interface_enumerator(m_machine.root_device()))
+			m_reverse_devices.emplace_back(&exec);
+}
+
+
+//-------------------------------------------------
+//  reverse_memory_used - return the memory held
+//  by the reverse execution snapshots
+//-------------------------------------------------
+
+size_t debugger_cpu::reverse_memory_used() const
+{
+	size_t total = 0;
+	for (reverse_snapshot const &snapshot : m_reverse_snapshots)
+		total += snapshot.state->memory_used();
+	return total;
+}
+
+
+//-------------------------------------------------
+//  reverse_clear - discard all snapshots and
+//  abandon any replay in progress
+//-------------------------------------------------
+
+void debugger_cpu::reverse_clear()
+{
+	m_reverse_snapshots.clear();
+	m_reverse_keyframe.clear();
+	m_reverse_frames = m_reverse_interval;
+	m_reverse_phase = reverse_phase::IDLE;
+	m_reverse_device = nullptr;
+}
+
+
+//-------------------------------------------------
+//  reverse_truncate - discard the snapshots after
+//  the one the machine was restored from, as
+//  execution continues from there
+//-------------------------------------------------
+
+void debugger_cpu::reverse_truncate(size_t index)
+{
+	if (index + 1 >= m_reverse_snapshots.size())
+		return;
+	m_reverse_snapshots.erase(m_reverse_snapshots.begin() + index + 1, m_reverse_snapshots.end());
+	m_reverse_keyframe = m_reverse_snapshots.back().state->keyframe_pages();
+	m_reverse_frames = 0;
+}
+
+
+//-------------------------------------------------
+//  reverse_capture - append a snapshot, dropping
+//  the oldest ones past the rewind capacity
+//-------------------------------------------------
+
+void debugger_cpu::reverse_capture()
+{
+	m_reverse_frames = 0;
+
+	reverse_snapshot snapshot;
+	snapshot.state = std::make_unique<ram_state>(m_machine.save());
+	save_error const err = snapshot.state->save(m_reverse_keyframe.empty() ? nullptr : &m_reverse_keyframe);
+	if (err != STATERR_NONE)
+	{
+		m_machine.debugger().console().printf("Unable to capture reverse execution snapshot (error %d), recording stopped\n", int(err));
+		m_reverse_interval = 0;
+		reverse_clear();
+		return;
+	}
+	m_reverse_keyframe = snapshot.state->keyframe_pages();
+	snapshot.cycles.reserve(m_reverse_devices.size());
+	for (device_execute_interface *exec : m_reverse_devices)
+		snapshot.cycles.emplace_back(exec->total_cycles());
+	m_reverse_snapshots.emplace_back(std::move(snapshot));
+
+	// keep at least two so there is always something to go back to
+	size_t const capacity = size_t(m_machine.options().rewind_capacity()) * 1024 * 1024;
+	while (m_reverse_snapshots.size() > 2 && reverse_memory_used() > capacity)
+		m_reverse_snapshots.pop_front();
+}
+
+
+//-------------------------------------------------
+//  reverse_step - go back the given number of
+//  instructions on a device
+//-------------------------------------------------
+
+bool debugger_cpu::reverse_step(device_t &device, u32 count)
+{
+	return reverse_begin(device, false, std::clamp<u32>(count, 1, REVERSE_MAX_STEPS));
+}
+
+
+//-------------------------------------------------
+//  reverse_continue - go back to the last
+//  breakpoint or watchpoint hit on a device
+//-------------------------------------------------
+
+bool debugger_cpu::reverse_continue(device_t &device)
+{
+	return reverse_begin(device, true, 0);
+}
+
+
+//-------------------------------------------------
+//  reverse_begin - find the snapshot to replay
+//  from, and resume execution until the end of
+//  the timeslice so it can be loaded
+//-------------------------------------------------
+
+bool debugger_cpu::reverse_begin(device_t &device, bool breakpoints, u32 count)
+{
+	debugger_console &console = m_machine.debugger().console();
+	auto const found = std::find(m_reverse_devices.begin(), m_reverse_devices.end(), &device.execute());
+	if (!m_reverse_interval || m_reverse_snapshots.empty() || found == m_reverse_devices.end())
+	{
+		console.printf("No snapshots recorded, use rrecord to enable reverse execution\n");
+		return false;
+	}
+	m_reverse_devindex = found - m_reverse_devices.begin();
+
+	// find the latest snapshot taken before the current instruction
+	u64 const cycles = device.execute().total_cycles();
+	size_t index = m_reverse_snapshots.size();
+	while (index > 0 && reverse_cycles(index - 1) >= cycles)
+		index--;
+	if (!index)
+	{
+		console.printf("No snapshot recorded before the current instruction\n");
+		return false;
+	}
+
+	// if nothing earlier is found, the replay comes back here
+	m_reverse_device = &device;
+	m_reverse_breakpoints = breakpoints;
+	m_reverse_index = index - 1;
+	m_reverse_end = cycles;
+	m_reverse_count = count;
+	m_reverse_target_index = m_reverse_index;
+	m_reverse_target = cycles;
+	m_reverse_limit = attotime::never;
+	m_reverse_loaded = m_reverse_snapshots.size();
+	m_reverse_phase = reverse_phase::LOAD_SCAN;
+	set_execution_running();
+	return true;
+}
+
+
+//-------------------------------------------------
+//  reverse_load - restore the snapshot for the
+//  next replay pass
+//-------------------------------------------------
+
+void debugger_cpu::reverse_load()
+{
+	bool const seek = m_reverse_phase == reverse_phase::LOAD_SEEK;
+	size_t const index = seek ? m_reverse_target_index : m_reverse_index;
+
+	// the first load happens just after the point being reversed from
+	if (m_reverse_limit.is_never())
+		m_reverse_limit = m_machine.time();
+
+	m_reverse_loading = true;
+	save_error const err = m_reverse_snapshots[index].state->load();
+	m_reverse_loading = false;
+	m_reverse_loaded = index;
+	if (err != STATERR_NONE)
+	{
+		reverse_clear();
+		m_machine.debugger().console().printf("Unable to restore reverse execution snapshot (error %d)\n", int(err));
+		return;
+	}
+
+	if (seek)
+	{
+		reverse_truncate(index);
+		m_reverse_phase = reverse_phase::SEEK;
+	}
+	else
+	{
+		m_reverse_history.assign(m_reverse_breakpoints ? 0 : m_reverse_count, 0);
+		m_reverse_history_next = 0;
+		m_reverse_history_valid = 0;
+		m_reverse_found = false;
+		m_reverse_wphit = false;
+		m_reverse_phase = reverse_phase::SCAN;
+	}
+}
+
+
+//-------------------------------------------------
+//  reverse_scan_complete - choose the target once
+//  a scan reaches its end point, or scan the
+//  previous snapshot if it isn't there
+//-------------------------------------------------
+
+void debugger_cpu::reverse_scan_complete()
+{
+	bool found;
+	if (m_reverse_breakpoints)
+	{
+		found = m_reverse_found;
+		if (found)
+		{
+			m_reverse_target = m_reverse_hit;
+			m_reverse_target_index = m_reverse_index;
+		}
+	}
+	else
+	{
+		// the oldest instruction still needed, or the oldest this scan saw
+		if (m_reverse_history_valid)
+		{
+			u32 const size = m_reverse_history.size();
+			u32 const back = std::min(m_reverse_count, m_reverse_history_valid);
+			m_reverse_target = m_reverse_history[(m_reverse_history_next + size - back) % size];
+			m_reverse_target_index = m_reverse_index;
+			m_reverse_count -= back;
+		}
+		found = !m_reverse_count;
+	}
+
+	if (!found && m_reverse_index > 0)
+	{
+		m_reverse_end = reverse_cycles(m_reverse_index);
+		m_reverse_index--;
+		m_reverse_phase = reverse_phase::LOAD_SCAN;
+	}
+	else
+	{
+		if (!found && m_reverse_breakpoints)
+			m_machine.debugger().console().printf("No earlier breakpoint or watchpoint hit recorded\n");
+		else if (!found)
+			m_machine.debugger().console().printf("Recorded history ends %d instructions short\n", m_reverse_count);
+		m_reverse_phase = reverse_phase::LOAD_SEEK;
+	}
+}
+
+
+//-------------------------------------------------
+//  reverse_cancel - give up on a replay and stop
+//  on the device being reversed
+//-------------------------------------------------
+
+void debugger_cpu::reverse_cancel(const char *message)
+{
+	device_t *const device = m_reverse_device;
+	reverse_clear();
+	if (device != nullptr)
+		device->debug()->halt_on_next_instruction("%s", message);
+}
+
+
+//-------------------------------------------------
+//  reverse_update - called between timeslices to
+//  capture and restore snapshots
+//-------------------------------------------------
+
+void debugger_cpu::reverse_update()
+{
+	switch (m_reverse_phase)
+	{
+	case reverse_phase::IDLE:
+		// anonymous timers are not saved, so wait until there are none
+		if (m_reverse_interval && m_reverse_frames >= m_reverse_interval && m_machine.scheduler().can_save())
+			reverse_capture();
+		break;
+
+	case reverse_phase::LOAD_SCAN:
+	case reverse_phase::LOAD_SEEK:
+		if (m_machine.scheduler().can_save())
+			reverse_load();
+		break;
+
+	case reverse_phase::SCAN:
+	case reverse_phase::SEEK:
+		// running past the point we started from means the replay didn't repeat the original execution
+		if (m_machine.time() > m_reverse_limit)
+			reverse_cancel("Replay diverged from the recorded execution, snapshots discarded\n");
+		break;
+	}
+}
+
+
+//-------------------------------------------------
+//  reverse_hook - called by the device's
+//  instruction hook during a replay; returns true
+//  if the debugger should stop here
+//-------------------------------------------------
+
+bool debugger_cpu::reverse_hook(device_t &device, u64 cycles, offs_t pc)
+{
+	// something else stopped execution, so let the debugger have it
+	if (is_stopped())
+	{
+		reverse_truncate(m_reverse_loaded);
+		m_reverse_phase = reverse_phase::IDLE;
+		m_reverse_device = nullptr;
+		m_machine.debugger().console().printf("Reverse execution interrupted\n");
+		return true;
+	}
+
+	// nothing else is checked until the device being reversed reaches its target
+	if (&device != m_reverse_device || (m_reverse_phase != reverse_phase::SCAN && m_reverse_phase != reverse_phase::SEEK))
+		return false;
+
+	if (m_reverse_phase == reverse_phase::SEEK)
+	{
+		if (cycles < m_reverse_target)
+			return false;
+		m_reverse_phase = reverse_phase::IDLE;
+		m_reverse_device = nullptr;
+		m_machine.debugger().console().printf("Reversed to cycle %d on CPU '%s'\n", cycles, device.tag());
+		set_execution_stopped();
+		return true;
+	}
+
+	// note where instructions or breakpoint hits happened before the end point
+	if (cycles < m_reverse_end)
+	{
+		if (!m_reverse_breakpoints)
+		{
+			m_reverse_history[m_reverse_history_next] = cycles;
+			m_reverse_history_next = (m_reverse_history_next + 1) % m_reverse_history.size();
+			if (m_reverse_history_valid < m_reverse_history.size())
+				m_reverse_history_valid++;
+		}
+		else if (m_reverse_wphit || device.debug()->breakpoint_hit(pc))
+		{
+			m_reverse_hit = cycles;
+			m_reverse_found = true;
+		}
+		m_reverse_wphit = false;
+		return false;
+	}
+
+	// the next snapshot is loaded at the end of the timeslice
+	reverse_scan_complete();
+	device.execute().abort_timeslice();
+	return false;
+}
+
+
 //**************************************************************************
 //  DEVICE DEBUG
 //**************************************************************************
@@ -437,6 +854,7 @@ device_debug::device_debug(device_t &device)
 	, m_last_total_cycles(0)
 	, m_pc_history_index(0)
 	, m_pc_history_valid(0)
+	, m_dasm_cache_cycles(0)
 	, m_bplist()
 	, m_rplist()
 	, m_eplist()
@@ -462,6 +880,7 @@ device_debug::device_debug(device_t &device)
 	if (m_memory) {
 		int count = m_memory->max_space_count();
 		m_phw.resize(count);
+		m_wptaps.resize(count);
 		for (int i=0; i != count; i++)
 			if (m_memory->has_space(i)) {
 				address_space &space = m_memory->space(i);
@@ -564,6 +983,7 @@ void device_debug::write_tracking(address_space &space, offs_t address, u64 data
 void device_debug::reinstall(address_space &space, read_or_write mode)
 {
 	int id = space.spacenum();
+	watchpoint_update(space, mode);
 	if (u32(mode) & u32(read_or_write::WRITE))
 	{
 		m_phw[id].remove();
@@ -795,6 +1215,13 @@ void device_debug::instruction_hook(offs_t curpc)
 	m_last_total_cycles = m_total_cycles;
 	m_total_cycles = m_exec->total_cycles();
 
+	// while replaying for reverse execution, nothing else happens until the target is reached
+	if (debugcpu.reversing() && !debugcpu.reverse_hook(m_device, m_total_cycles, curpc))
+	{
+		debugcpu.set_within_instruction(false);
+		return;
+	}
+
 	// are we tracking our recent pc visits?
 	if (m_track_pc)
 	{
@@ -1295,6 +1722,7 @@ int device_debug::watchpoint_set(address_space &space, read_or_write type, offs_
 	// allocate a new one
 	u32 id = m_device.machine().debugger().cpu().get_watchpoint_index();
 	m_wplist[space.spacenum()].emplace_back(std::make_unique<debug_watchpoint>(this, *m_symtable, id, space, type, address, length, condition, action));
+	watchpoint_update(space);
 
 	return id;
 }
@@ -1313,7 +1741,9 @@ bool device_debug::watchpoint_clear(int index)
 		for (auto wpi = wpl.begin(); wpi != wpl.end(); wpi++)
 			if ((*wpi)->index() == index)
 			{
+				address_space &space = (*wpi)->space();
 				wpl.erase(wpi);
+				watchpoint_update(space);
 				return true;
 			}
 	}
@@ -1330,7 +1760,14 @@ bool device_debug::watchpoint_clear(int index)
 void device_debug::watchpoint_clear_all()
 {
 	for (auto &wpl : m_wplist)
-		wpl.clear();
+	{
+		if (!wpl.empty())
+		{
+			address_space &space = wpl.front()->space();
+			wpl.clear();
+			watchpoint_update(space);
+		}
+	}
 }
 
 
@@ -1362,10 +1799,141 @@ bool device_debug::watchpoint_enable(int index, bool enable)
 
 void device_debug::watchpoint_enable_all(bool enable)
 {
-	// apply the enable to all watchpoints we own
+	// apply the enable to all watchpoints we own, updating the taps once per space
 	for (auto &wpl : m_wplist)
+	{
 		for (auto &wp : wpl)
-			wp->setEnabled(enable);
+			wp->m_enabled = enable;
+		if (!wpl.empty())
+			watchpoint_update(wpl.front()->space());
+	}
+}
+
+
+//-------------------------------------------------
+//  watchpoint_update - rebuild the merged taps
+//  for all enabled watchpoints in a space
+//-------------------------------------------------
+
+void device_debug::watchpoint_update(address_space &space, read_or_write mode)
+{
+	int const id = space.spacenum();
+	if (id >= int(m_wptaps.size()))
+		return;
+
+	watch_taps &taps = m_wptaps[id];
+	if (taps.installing)
+		return;
+	taps.installing = true;
+
+	// any spans referenced by a tap that is in progress are about to go away
+	taps.generation++;
+	for (read_or_write type : { read_or_write::READ, read_or_write::WRITE })
+	{
+		if (!(u32(mode) & u32(type)))
+			continue;
+
+		if (type == read_or_write::READ)
+			taps.phr.remove();
+		else
+			taps.phw.remove();
+		watchpoint_build_spans(space, type, (type == read_or_write::READ) ? taps.read : taps.write);
+		switch (space.data_width())
+		{
+		case  8: watchpoint_install_taps<u8 >(space, type, taps); break;
+		case 16: watchpoint_install_taps<u16>(space, type, taps); break;
+		case 32: watchpoint_install_taps<u32>(space, type, taps); break;
+		case 64: watchpoint_install_taps<u64>(space, type, taps); break;
+		}
+	}
+
+	taps.installing = false;
+}
+
+
+//-------------------------------------------------
+//  watchpoint_build_spans - collect the ranges
+//  of enabled watchpoints and merge overlapping
+//  ones so each address is tapped at most once
+//-------------------------------------------------
+
+void device_debug::watchpoint_build_spans(address_space &space, read_or_write type, std::vector<watch_span> &spans)
+{
+	spans.clear();
+	if (space.spacenum() >= int(m_wplist.size()))
+		return;
+
+	std::vector<watch_range> ranges;
+	for (auto &wp : m_wplist[space.spacenum()])
+		if (wp->enabled() && (u32(wp->type()) & u32(type)))
+			for (int i = 0; i != 3; i++)
+				if (wp->m_masks[i])
+					ranges.emplace_back(watch_range{ wp->m_start_address[i], wp->m_end_address[i], (space.data_width() == 8) ? 0 : wp->m_masks[i], wp.get() });
+
+	std::stable_sort(
+			ranges.begin(),
+			ranges.end(),
+			[] (const watch_range &a, const watch_range &b) { return a.start < b.start; });
+	for (const watch_range &range : ranges)
+	{
+		if (spans.empty() || (range.start > spans.back().end))
+			spans.emplace_back(watch_span{ range.start, range.end, { } });
+		else
+			spans.back().end = std::max(spans.back().end, range.end);
+		spans.back().ranges.emplace_back(range);
+	}
+}
+
+
+//-------------------------------------------------
+//  watchpoint_install_taps - install one tap per
+//  merged span, sharing a single passthrough
+//  handler
+//-------------------------------------------------
+
+template <typename T>
+void device_debug::watchpoint_install_taps(address_space &space, read_or_write type, watch_taps &taps)
+{
+	if (type == read_or_write::READ)
+	{
+		for (const watch_span &span : taps.read)
+			taps.phr = space.install_read_tap(
+					span.start, span.end, util::string_format("wp@%x", span.start),
+					[this, &taps, &span] (offs_t offset, T &data, T mem_mask) { watchpoint_check(taps, span, read_or_write::READ, offset, data, mem_mask); },
+					&taps.phr);
+	}
+	else
+	{
+		for (const watch_span &span : taps.write)
+			taps.phw = space.install_write_tap(
+					span.start, span.end, util::string_format("wp@%x", span.start),
+					[this, &taps, &span] (offs_t offset, T &data, T mem_mask) { watchpoint_check(taps, span, read_or_write::WRITE, offset, data, mem_mask); },
+					&taps.phw);
+	}
+}
+
+
+//-------------------------------------------------
+//  watchpoint_check - trigger the watchpoints in
+//  a span that cover an access
+//-------------------------------------------------
+
+void device_debug::watchpoint_check(watch_taps &taps, const watch_span &span, read_or_write type, offs_t address, u64 data, u64 mem_mask)
+{
+	u32 const generation = taps.generation;
+	for (const watch_range &range : span.ranges)
+	{
+		if (range.start > address)
+			break;
+		if ((address <= range.end) && (!range.mask || (mem_mask & range.mask)))
+		{
+			range.wp->triggered(type, address, data, mem_mask);
+
+			// an action that changes the watchpoints frees the span
+			if (taps.generation != generation)
+				return;
+		}
+	}
 }
 
 
@@ -1557,6 +2125,54 @@ std::pair<offs_t, bool> device_debug::history_pc(int index) const
 }
 
 
+//-------------------------------------------------
+//  disassemble_cached - return the decoded
+//  instruction at the given PC, reusing the last
+//  decode if the bytes are unchanged
+//-------------------------------------------------
+
+const device_debug::dasm_cache_entry &device_debug::disassemble_cached(const debug_disasm_buffer &buffer, offs_t pc)
+{
+	// disassemblers may depend on CPU state such as the instruction set mode, so anything
+	// decoded before the device last executed can't be trusted
+	if (m_exec != nullptr && m_exec->total_cycles() != m_dasm_cache_cycles)
+	{
+		m_dasm_cache.clear();
+		m_dasm_cache_cycles = m_exec->total_cycles();
+	}
+
+	// memory may have been modified or banked in by other means, so check the bytes
+	auto found = m_dasm_cache.find(pc);
+	if (found != m_dasm_cache.end())
+	{
+		dasm_cache_entry &entry = found->second;
+		buffer.data_get(pc, entry.size, true, m_dasm_scratch);
+		if (m_dasm_scratch == entry.opcode_data)
+		{
+			buffer.data_get(pc, entry.size, false, m_dasm_scratch);
+			if (m_dasm_scratch == entry.param_data)
+				return entry;
+		}
+	}
+	else
+	{
+		if (m_dasm_cache.size() >= DASM_CACHE_SIZE)
+			m_dasm_cache.clear();
+		found = m_dasm_cache.emplace(pc, dasm_cache_entry()).first;
+	}
+
+	dasm_cache_entry &entry = found->second;
+	buffer.disassemble(pc, entry.instruction, entry.next_pc, entry.size, entry.info);
+	buffer.data_get(pc, entry.size, true, entry.opcode_data);
+	buffer.data_get(pc, entry.size, false, entry.param_data);
+	entry.address = buffer.pc_to_string(pc);
+	entry.opcodes = buffer.data_to_string(pc, entry.size, true);
+	entry.params = buffer.data_to_string(pc, entry.size, false);
+	entry.crc = util::crc32_creator::simple(entry.opcode_data.data(), entry.opcode_data.size());
+	return entry;
+}
+
+
 //-------------------------------------------------
 //  set_track_pc - turn visited PC tracking on or
 //  off
@@ -1578,7 +2194,11 @@ bool device_debug::track_pc_visited(offs_t pc) const
 {
 	if (m_track_pc_set.empty())
 		return false;
-	const u32 crc = compute_opcode_crc32(pc);
+	return track_pc_visited(pc, compute_opcode_crc32(pc));
+}
+
+bool device_debug::track_pc_visited(offs_t pc, u32 crc) const
+{
 	return m_track_pc_set.find(dasm_pc_tag(pc, crc)) != m_track_pc_set.end();
 }
 
@@ -1654,9 +2274,8 @@ bool device_debug::comment_remove(offs_t addr)
 //  comment_text - return the text of a comment
 //-------------------------------------------------
 
-const char *device_debug::comment_text(offs_t addr) const
+const char *device_debug::comment_text(offs_t addr, u32 crc) const
 {
-	const u32 crc = compute_opcode_crc32(addr);
 	auto comment = m_comment_set.find(dasm_comment(addr, crc, "", 0));
 	if (comment == m_comment_set.end()) return nullptr;
 	return comment->m_text.c_str();
@@ -1734,14 +2353,14 @@ u32 device_debug::compute_opcode_crc32(offs_t pc) const
 //  trace - trace execution of a given device
 //-------------------------------------------------
 
-void device_debug::trace(std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action)
+void device_debug::trace(std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action, bool binary, bool registers)
 {
 	// delete any existing tracers
 	m_trace = nullptr;
 
 	// if we have a new file, make a new tracer
 	if (file != nullptr)
-		m_trace = std::make_unique<tracer>(*this, std::move(file), trace_over, detect_loops, logerror, action);
+		m_trace = std::make_unique<tracer>(*this, std::move(file), trace_over, detect_loops, logerror, action, binary, registers);
 }
 
 
@@ -1776,6 +2395,10 @@ void device_debug::compute_debug_flags()
 	if (m_trace != nullptr)
 		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
 
+	// or replaying this device for reverse execution
+	if (debugcpu.reverse_device() == &m_device)
+		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
+
 	// if we are stopping at a particular time and that time is within the current timeslice, we need to be called
 	if ((m_flags & DEBUG_FLAG_STOP_TIME) && m_endexectime <= m_stoptime)
 		machine.debug_flags |= DEBUG_FLAG_CALL_HOOK;
@@ -1886,6 +2509,27 @@ void device_debug::breakpoint_update_flags()
 }
 
 
+//-------------------------------------------------
+//  breakpoint_hit - return true if a breakpoint
+//  or registerpoint would stop at the given PC,
+//  without stopping or running its action
+//-------------------------------------------------
+
+bool device_debug::breakpoint_hit(offs_t pc)
+{
+	auto bpitp = m_bplist.equal_range(pc);
+	for (auto bpit = bpitp.first; bpit != bpitp.second; ++bpit)
+		if (bpit->second->hit(pc))
+			return true;
+
+	for (debug_registerpoint &rp : m_rplist)
+		if (rp.hit())
+			return true;
+
+	return false;
+}
+
+
 //-------------------------------------------------
 //  breakpoint_check - check the breakpoints for
 //  a given device
@@ -1945,6 +2589,169 @@ void device_debug::breakpoint_check(offs_t pc)
 
 
 
+//**************************************************************************
+//  BINARY TRACE WRITER
+//**************************************************************************
+
+// collects binary trace records into large blocks, which are handed
+// to a background thread for writing so the CPU never waits on I/O
+class device_debug::tracer::binary_writer
+{
+public:
+	binary_writer(std::ostream &file);
+	~binary_writer();
+
+	void put8(u8 value) { m_block.push_back(value); }
+	void put16(u16 value) { put8(value); put8(value >> 8); }
+	void put32(u32 value) { put16(value); put16(value >> 16); }
+	void put64(u64 value) { put32(value); put32(value >> 32); }
+	void write(const void *data, size_t length);
+	void end_record() { if (m_block.size() >= BLOCK_SIZE) submit(); }
+	void flush();
+
+private:
+	static constexpr size_t BLOCK_SIZE = 0x10000;
+	static constexpr size_t MAX_PENDING = 64;
+
+	void submit();
+	void writer_thread();
+
+	std::ostream &                  m_file;         // destination stream
+	std::vector<u8>                 m_block;        // block currently being filled
+	std::mutex                      m_mutex;        // protects everything below
+	std::condition_variable         m_cond;         // signalled when work is queued or completed
+	std::deque<std::vector<u8> >    m_pending;      // blocks waiting to be written
+	std::vector<std::vector<u8> >   m_free;         // written blocks available for reuse
+	bool                            m_busy;         // true while the thread is writing a block
+	bool                            m_exit;         // true when the thread should exit
+	std::thread                     m_thread;       // writer thread
+};
+
+
+//-------------------------------------------------
+//  binary_writer - constructor
+//-------------------------------------------------
+
+device_debug::tracer::binary_writer::binary_writer(std::ostream &file)
+	: m_file(file)
+	, m_busy(false)
+	, m_exit(false)
+{
+	m_block.reserve(BLOCK_SIZE + 256);
+#if !defined(__EMSCRIPTEN__)
+	m_thread = std::thread([this] () { writer_thread(); });
+#endif
+}
+
+
+//-------------------------------------------------
+//  ~binary_writer - destructor
+//-------------------------------------------------
+
+device_debug::tracer::binary_writer::~binary_writer()
+{
+	flush();
+#if !defined(__EMSCRIPTEN__)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_exit = true;
+	}
+	m_cond.notify_all();
+	m_thread.join();
+#endif
+}
+
+
+//-------------------------------------------------
+//  write - append raw bytes to the current record
+//-------------------------------------------------
+
+void device_debug::tracer::binary_writer::write(const void *data, size_t length)
+{
+	const u8 *const bytes = reinterpret_cast<const u8 *>(data);
+	m_block.insert(m_block.end(), bytes, bytes + length);
+}
+
+
+//-------------------------------------------------
+//  flush - write out everything collected so far
+//  and wait for the writer to go idle
+//-------------------------------------------------
+
+void device_debug::tracer::binary_writer::flush()
+{
+	if (!m_block.empty())
+		submit();
+#if !defined(__EMSCRIPTEN__)
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_cond.wait(lock, [this] () { return m_pending.empty() && !m_busy; });
+#endif
+	m_file.flush();
+}
+
+
+//-------------------------------------------------
+//  submit - hand the current block to the writer
+//  thread, waiting if it has fallen too far
+//  behind
+//-------------------------------------------------
+
+void device_debug::tracer::binary_writer::submit()
+{
+#if defined(__EMSCRIPTEN__)
+	m_file.write(reinterpret_cast<const char *>(m_block.data()), m_block.size());
+	m_block.clear();
+#else
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_cond.wait(lock, [this] () { return m_pending.size() < MAX_PENDING; });
+	m_pending.emplace_back(std::move(m_block));
+	if (!m_free.empty())
+	{
+		m_block = std::move(m_free.back());
+		m_free.pop_back();
+	}
+	else
+	{
+		m_block = std::vector<u8>();
+		m_block.reserve(BLOCK_SIZE + 256);
+	}
+	lock.unlock();
+	m_cond.notify_all();
+#endif
+}
+
+
+//-------------------------------------------------
+//  writer_thread - write queued blocks to the
+//  file until told to exit
+//-------------------------------------------------
+
+void device_debug::tracer::binary_writer::writer_thread()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true)
+	{
+		m_cond.wait(lock, [this] () { return m_exit || !m_pending.empty(); });
+		if (m_pending.empty())
+			break;
+
+		std::vector<u8> block(std::move(m_pending.front()));
+		m_pending.pop_front();
+		m_busy = true;
+		lock.unlock();
+
+		m_file.write(reinterpret_cast<const char *>(block.data()), block.size());
+		block.clear();
+
+		lock.lock();
+		m_busy = false;
+		m_free.emplace_back(std::move(block));
+		m_cond.notify_all();
+	}
+}
+
+
+
 //**************************************************************************
 //  TRACER
 //**************************************************************************
@@ -1953,7 +2760,7 @@ void device_debug::breakpoint_check(offs_t pc)
 //  tracer - constructor
 //-------------------------------------------------
 
-device_debug::tracer::tracer(device_debug &debug, std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action)
+device_debug::tracer::tracer(device_debug &debug, std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action, bool binary, bool registers)
 	: m_debug(debug)
 	, m_file(std::move(file))
 	, m_action(action)
@@ -1963,8 +2770,24 @@ device_debug::tracer::tracer(device_debug &debug, std::unique_ptr<std::ostream>
 	, m_nextdex(0)
 	, m_trace_over(trace_over)
 	, m_trace_over_target(~0)
+	, m_regvalid(false)
 {
 	memset(m_history, 0, sizeof(m_history));
+
+	if (binary)
+	{
+		// collect the registers to record deltas for; generic pseudo-registers are skipped
+		if (registers && m_debug.m_state)
+		{
+			for (auto const &entry : m_debug.m_state->state_entries())
+				if (entry->visible() && !entry->divider() && !entry->is_float() && entry->index() >= 0)
+					m_regentries.emplace_back(entry.get());
+			m_regvalues.resize(m_regentries.size());
+		}
+
+		m_writer = std::make_unique<binary_writer>(*m_file);
+		write_binary_header();
+	}
 }
 
 
@@ -1974,11 +2797,89 @@ device_debug::tracer::tracer(device_debug &debug, std::unique_ptr<std::ostream>
 
 device_debug::tracer::~tracer()
 {
+	// drain the binary writer before the file goes away
+	if (m_writer)
+	{
+		write_binary_loops();
+		m_writer.reset();
+	}
+
 	// make sure we close the file if we can
 	m_file.reset();
 }
 
 
+//-------------------------------------------------
+//  write_binary_header - write the header that
+//  describes a binary trace file
+//-------------------------------------------------
+
+void device_debug::tracer::write_binary_header()
+{
+	address_space &space = m_debug.m_memory->space(AS_PROGRAM);
+	std::string_view const tag(m_debug.device().tag());
+	std::string_view const name(m_debug.device().shortname());
+
+	m_writer->write(util::disasm_trace::MAGIC, sizeof(util::disasm_trace::MAGIC));
+	m_writer->put8(util::disasm_trace::VERSION);
+	m_writer->put8(u8(s8(space.addr_shift())));
+	m_writer->put8(space.logaddr_width());
+	m_writer->put8(0);
+	m_writer->put8(std::min<size_t>(tag.length(), 255));
+	m_writer->write(tag.data(), std::min<size_t>(tag.length(), 255));
+	m_writer->put8(std::min<size_t>(name.length(), 255));
+	m_writer->write(name.data(), std::min<size_t>(name.length(), 255));
+	m_writer->put16(m_regentries.size());
+	for (const device_state_entry *entry : m_regentries)
+	{
+		std::string_view const symbol(entry->symbol());
+		m_writer->put8(entry->datasize());
+		m_writer->put8(std::min<size_t>(symbol.length(), 255));
+		m_writer->write(symbol.data(), std::min<size_t>(symbol.length(), 255));
+	}
+	m_writer->end_record();
+}
+
+
+//-------------------------------------------------
+//  write_binary_registers - record the registers
+//  that changed since the last instruction
+//-------------------------------------------------
+
+void device_debug::tracer::write_binary_registers()
+{
+	for (size_t index = 0; index < m_regentries.size(); index++)
+	{
+		u64 const value = m_regentries[index]->value();
+		if (!m_regvalid || (value != m_regvalues[index]))
+		{
+			m_regvalues[index] = value;
+			m_writer->put8(util::disasm_trace::RECORD_REGISTER);
+			m_writer->put16(index);
+			m_writer->put64(value);
+		}
+	}
+	m_regvalid = true;
+}
+
+
+//-------------------------------------------------
+//  write_binary_loops - record the number of
+//  instructions condensed by loop detection
+//-------------------------------------------------
+
+void device_debug::tracer::write_binary_loops()
+{
+	if (m_loops != 0)
+	{
+		m_writer->put8(util::disasm_trace::RECORD_LOOPS);
+		m_writer->put32(m_loops);
+		m_writer->end_record();
+		m_loops = 0;
+	}
+}
+
+
 //-------------------------------------------------
 //  update - log to the tracefile the data for a
 //  given instruction
@@ -2010,7 +2911,9 @@ void device_debug::tracer::update(offs_t pc)
 		}
 
 		// if we just finished looping, indicate as much
-		if (m_loops != 0)
+		if (m_writer)
+			write_binary_loops();
+		else if (m_loops != 0)
 			util::stream_format(*m_file, "\n   (loops for %d instructions)\n\n", m_loops);
 		m_loops = 0;
 	}
@@ -2020,13 +2923,30 @@ void device_debug::tracer::update(offs_t pc)
 		m_debug.m_device.machine().debugger().console().execute_command(m_action, false);
 
 	debug_disasm_buffer buffer(m_debug.device());
-	std::string instruction;
-	offs_t next_pc, size;
 	u32 dasmresult;
-	buffer.disassemble(pc, instruction, next_pc, size, dasmresult);
+	if (m_writer)
+	{
+		// binary traces record the raw opcode bytes and leave disassembly for later
+		if (!m_regentries.empty())
+			write_binary_registers();
+		dasmresult = buffer.disassemble_info(pc);
+		buffer.data_get(pc, dasmresult & util::disasm_interface::LENGTHMASK, true, m_opbuf);
+		size_t const count = std::min<size_t>(m_opbuf.size(), 255);
+		m_writer->put8(util::disasm_trace::RECORD_INSTRUCTION);
+		m_writer->put32(pc);
+		m_writer->put8(count);
+		m_writer->write(m_opbuf.data(), count);
+		m_writer->end_record();
+	}
+	else
+	{
+		std::string instruction;
+		offs_t next_pc, size;
+		buffer.disassemble(pc, instruction, next_pc, size, dasmresult);
 
-	// output the result
-	util::stream_format(*m_file, "%s: %s\n", buffer.pc_to_string(pc), instruction);
+		// output the result
+		util::stream_format(*m_file, "%s: %s\n", buffer.pc_to_string(pc), instruction);
+	}
 
 	// do we need to step the trace over this instruction?
 	if (m_trace_over && (dasmresult & util::disasm_interface::SUPPORTED) != 0 && (dasmresult & util::disasm_interface::STEP_OVER) != 0)
@@ -2044,7 +2964,8 @@ void device_debug::tracer::update(offs_t pc)
 	// log this PC
 	m_nextdex = (m_nextdex + 1) % TRACE_LOOPS;
 	m_history[m_nextdex] = pc;
-	m_file->flush();
+	if (!m_writer)
+		m_file->flush();
 }
 
 
@@ -2061,6 +2982,17 @@ void device_debug::tracer::interrupt_update(int irqline, offs_t pc)
 		m_trace_over_target = pc;
 	}
 
+	if (m_writer)
+	{
+		if (m_detect_loops)
+			write_binary_loops();
+		m_writer->put8(util::disasm_trace::RECORD_INTERRUPT);
+		m_writer->put32(u32(irqline));
+		m_writer->put32(pc);
+		m_writer->end_record();
+		return;
+	}
+
 	// if we just finished looping, indicate as much
 	*m_file << "\n";
 	if (m_detect_loops && m_loops != 0)
@@ -2080,6 +3012,17 @@ void device_debug::tracer::interrupt_update(int irqline, offs_t pc)
 
 void device_debug::tracer::vprintf(util::format_argument_pack<char> const &args)
 {
+	// binary traces carry text in its own record
+	if (m_writer)
+	{
+		std::string const text(util::string_format(args));
+		m_writer->put8(util::disasm_trace::RECORD_TEXT);
+		m_writer->put32(text.length());
+		m_writer->write(text.data(), text.length());
+		m_writer->end_record();
+		return;
+	}
+
 	// pass through to the file
 	util::stream_format(*m_file, args);
 	m_file->flush();
@@ -2093,7 +3036,10 @@ void device_debug::tracer::vprintf(util::format_argument_pack<char> const &args)
 
 void device_debug::tracer::flush()
 {
-	m_file->flush();
+	if (m_writer)
+		m_writer->flush();
+	else
+		m_file->flush();
 }
 
 
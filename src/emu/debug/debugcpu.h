@@ -13,8 +13,11 @@
 
 #pragma once
 
+#include <deque>
 #include <set>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 
 //**************************************************************************
@@ -29,6 +32,9 @@ constexpr int COMMENT_VERSION       = 1;
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+class debug_disasm_buffer;
+
+
 // ======================> device_debug
 
 // [TODO] This whole thing is terrible.
@@ -94,6 +100,7 @@ public:
 	bool breakpoint_enable(int index, bool enable = true);
 	void breakpoint_enable_all(bool enable = true);
 	debug_breakpoint *triggered_breakpoint() { debug_breakpoint *ret = m_triggered_breakpoint; m_triggered_breakpoint = nullptr; return ret; }
+	bool breakpoint_hit(offs_t pc);
 
 	// watchpoints
 	int watchpoint_space_count() const { return m_wplist.size(); }
@@ -103,6 +110,7 @@ public:
 	void watchpoint_clear_all();
 	bool watchpoint_enable(int index, bool enable = true);
 	void watchpoint_enable_all(bool enable = true);
+	void watchpoint_update(address_space &space, read_or_write mode = read_or_write::READWRITE);
 	void set_triggered_watchpoint(debug_watchpoint *wp) { m_triggered_watchpoint = wp; }
 	debug_watchpoint *triggered_watchpoint() { debug_watchpoint *ret = m_triggered_watchpoint; m_triggered_watchpoint = nullptr; return ret; }
 
@@ -125,7 +133,8 @@ public:
 	// comments
 	void comment_add(offs_t address, const char *comment, rgb_t color);
 	bool comment_remove(offs_t addr);
-	const char *comment_text(offs_t addr) const;
+	const char *comment_text(offs_t addr) const { return comment_text(addr, compute_opcode_crc32(addr)); }
+	const char *comment_text(offs_t addr, u32 crc) const;
 	u32 comment_count() const { return m_comment_set.size(); }
 	u32 comment_change_count() const { return m_comment_change; }
 	bool comment_export(util::xml::data_node &node);
@@ -135,9 +144,26 @@ public:
 	// history
 	std::pair<offs_t, bool> history_pc(int index) const;
 
+	// disassembly cache
+	struct dasm_cache_entry
+	{
+		std::string         instruction;            // disassembled instruction
+		std::string         address;                // address as a string
+		std::string         opcodes;                // opcode bytes as a string
+		std::string         params;                 // parameter bytes as a string
+		std::vector<u8>     opcode_data;            // opcode bytes, to notice changes
+		std::vector<u8>     param_data;             // parameter bytes, to notice changes
+		offs_t              next_pc;                // address of the following instruction
+		offs_t              size;                   // size of the instruction
+		u32                 info;                   // disassembler result flags
+		u32                 crc;                    // CRC of the opcode bytes, as used for comments
+	};
+	const dasm_cache_entry &disassemble_cached(const debug_disasm_buffer &buffer, offs_t pc);
+
 	// pc tracking
 	void set_track_pc(bool value);
 	bool track_pc_visited(offs_t pc) const;
+	bool track_pc_visited(offs_t pc, u32 crc) const;
 	void set_track_pc_visited(offs_t pc);
 	void track_pc_data_clear() { m_track_pc_set.clear(); }
 
@@ -149,7 +175,7 @@ public:
 	void track_mem_data_clear() { m_track_mem_set.clear(); }
 
 	// tracing
-	void trace(std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action);
+	void trace(std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action, bool binary = false, bool registers = false);
 	template <typename Format, typename... Params> void trace_printf(Format &&fmt, Params &&...args)
 	{
 		if (m_trace != nullptr)
@@ -178,6 +204,33 @@ private:
 	void reinstall(address_space &space, read_or_write mode);
 	void write_tracking(address_space &space, offs_t address, u64 data);
 
+	// merged watchpoint taps
+	struct watch_range
+	{
+		offs_t              start;                  // first address checked
+		offs_t              end;                    // last address checked
+		u64                 mask;                   // access mask (0 = any)
+		debug_watchpoint *  wp;                     // watchpoint to trigger
+	};
+	struct watch_span
+	{
+		offs_t              start;                  // first address tapped
+		offs_t              end;                    // last address tapped
+		std::vector<watch_range> ranges;            // overlapping ranges, sorted by start
+	};
+	struct watch_taps
+	{
+		memory_passthrough_handler phr;             // passthrough handler for all read taps
+		memory_passthrough_handler phw;             // passthrough handler for all write taps
+		std::vector<watch_span> read;               // spans tapped for reads
+		std::vector<watch_span> write;              // spans tapped for writes
+		u32                 generation = 0;         // incremented whenever spans are rebuilt
+		bool                installing = false;     // prevent recursive installs
+	};
+	void watchpoint_build_spans(address_space &space, read_or_write type, std::vector<watch_span> &spans);
+	template <typename T> void watchpoint_install_taps(address_space &space, read_or_write type, watch_taps &taps);
+	void watchpoint_check(watch_taps &taps, const watch_span &span, read_or_write type, offs_t address, u64 data, u64 mem_mask);
+
 	// basic device information
 	device_t &                 m_device;                // device we are attached to
 	device_execute_interface * m_exec;                  // execute interface, if present
@@ -210,9 +263,16 @@ private:
 	u32                     m_pc_history_index;         // current history index
 	u32                     m_pc_history_valid;         // number of valid PC history entries
 
+	// disassembly cache
+	static constexpr size_t DASM_CACHE_SIZE = 65536;
+	std::unordered_map<offs_t, dasm_cache_entry> m_dasm_cache; // instructions decoded since the device last executed
+	u64                     m_dasm_cache_cycles;        // total cycles when the cache was last valid
+	std::vector<u8>         m_dasm_scratch;             // bytes read back to validate a cached instruction
+
 	// breakpoints and watchpoints
 	std::multimap<offs_t, std::unique_ptr<debug_breakpoint>> m_bplist;     // list of breakpoints
 	std::vector<std::vector<std::unique_ptr<debug_watchpoint>>> m_wplist;  // watchpoint lists for each address space
+	std::vector<watch_taps> m_wptaps;                                      // merged watchpoint taps for each address space
 	std::forward_list<debug_registerpoint> m_rplist;                       // list of registerpoints
 	std::multimap<offs_t, std::unique_ptr<debug_exceptionpoint>> m_eplist; // list of exception points
 
@@ -223,7 +283,7 @@ private:
 	class tracer
 	{
 	public:
-		tracer(device_debug &debug, std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action);
+		tracer(device_debug &debug, std::unique_ptr<std::ostream> &&file, bool trace_over, bool detect_loops, bool logerror, std::string_view action, bool binary, bool registers);
 		~tracer();
 
 		void update(offs_t pc);
@@ -233,8 +293,14 @@ private:
 		bool logerror() const { return m_logerror; }
 
 	private:
+		class binary_writer;
+
 		static const int TRACE_LOOPS = 64;
 
+		void write_binary_header();
+		void write_binary_registers();
+		void write_binary_loops();
+
 		device_debug &      m_debug;                    // reference to our owner
 		std::unique_ptr<std::ostream> m_file;           // tracing file for this CPU
 		std::string         m_action;                   // action to perform during a trace
@@ -247,6 +313,11 @@ private:
 		offs_t              m_trace_over_target;        // target for tracing over
 														//    (0 = not tracing over,
 														//    ~0 = not currently tracing over)
+		std::unique_ptr<binary_writer> m_writer;        // background writer for binary traces
+		std::vector<const device_state_entry *> m_regentries; // registers recorded in binary traces
+		std::vector<u64>    m_regvalues;                // last recorded register values
+		bool                m_regvalid;                 // true once register values have been recorded
+		std::vector<u8>     m_opbuf;                    // opcode bytes for binary traces
 	};
 	std::unique_ptr<tracer>                m_trace;     // tracer state
 
@@ -373,6 +444,26 @@ public:
 	symbol_table &global_symtable() { return *m_symtable; }
 
 
+	/* ----- reverse execution ----- */
+
+	// capture a snapshot every <frames> frames (0 disables and discards the snapshots)
+	void reverse_record(u32 frames);
+	u32 reverse_interval() const { return m_reverse_interval; }
+	size_t reverse_snapshot_count() const { return m_reverse_snapshots.size(); }
+	size_t reverse_memory_used() const;
+
+	// replay from a snapshot to an earlier instruction or breakpoint hit on a device
+	bool reverse_step(device_t &device, u32 count);
+	bool reverse_continue(device_t &device);
+	bool reversing() const { return m_reverse_phase != reverse_phase::IDLE; }
+	const device_t *reverse_device() const { return m_reverse_device; }
+
+	// hooks used by the rest of the system
+	void reverse_update();
+	bool reverse_hook(device_t &device, u64 cycles, offs_t pc);
+	void reverse_watchpoint_hit() { m_reverse_wphit = true; }
+
+
 	/* ----- debugger comment helpers ----- */
 
 	// save all comments for a given machine
@@ -413,8 +504,32 @@ public:
 private:
 	static const size_t NUM_TEMP_VARIABLES;
 
+	// most instructions rstep will go back in one command
+	static constexpr u32 REVERSE_MAX_STEPS = 65536;
+
+	enum class reverse_phase { IDLE, LOAD_SCAN, SCAN, LOAD_SEEK, SEEK };
+
+	struct reverse_snapshot
+	{
+		std::unique_ptr<ram_state> state;       // captured machine state
+		std::vector<u64>    cycles;             // total cycles of each executing device when captured
+	};
+
 	// internal helpers
 	void on_vblank(screen_device &device, bool vblank_state);
+	void on_frame();
+	void on_reset();
+	void on_postload();
+
+	// reverse execution helpers
+	void reverse_capture();
+	void reverse_clear();
+	void reverse_truncate(size_t index);
+	bool reverse_begin(device_t &device, bool breakpoints, u32 count);
+	void reverse_load();
+	void reverse_scan_complete();
+	void reverse_cancel(const char *message);
+	u64 reverse_cycles(size_t index) const { return m_reverse_snapshots[index].cycles[m_reverse_devindex]; }
 
 	running_machine&    m_machine;
 
@@ -443,6 +558,31 @@ private:
 	osd_ticks_t m_last_periodic_update_time;
 
 	bool        m_comments_loaded;
+
+	// reverse execution
+	std::deque<reverse_snapshot> m_reverse_snapshots;   // snapshots, oldest first
+	std::vector<device_execute_interface *> m_reverse_devices; // executing devices, in snapshot cycle order
+	ram_state::page_list m_reverse_keyframe;            // pages of the latest snapshot, shared by the next
+	u32         m_reverse_interval;                     // frames between snapshots (0 = not recording)
+	u32         m_reverse_frames;                       // frames since the last snapshot
+	bool        m_reverse_loading;                      // true while restoring a snapshot
+	reverse_phase m_reverse_phase;                      // what the replay is doing
+	device_t *  m_reverse_device;                       // device being reversed
+	size_t      m_reverse_devindex;                     // index of the device in the snapshot cycles
+	bool        m_reverse_breakpoints;                  // true to go back to a breakpoint hit rather than by instructions
+	size_t      m_reverse_index;                        // snapshot being scanned
+	u64         m_reverse_end;                          // cycle count the scan stops at
+	u32         m_reverse_count;                        // instructions still to go back
+	std::vector<u64> m_reverse_history;                 // cycle counts of the last instructions scanned
+	u32         m_reverse_history_next;                 // next history entry to write
+	u32         m_reverse_history_valid;                // number of valid history entries
+	bool        m_reverse_found;                        // true if a breakpoint hit was seen in the scan
+	bool        m_reverse_wphit;                        // a watchpoint was hit since the last instruction
+	u64         m_reverse_hit;                          // cycle count of the last breakpoint hit seen
+	size_t      m_reverse_target_index;                 // snapshot to replay the target from
+	u64         m_reverse_target;                       // cycle count to stop at
+	attotime    m_reverse_limit;                        // a replay past this time has diverged
+	size_t      m_reverse_loaded;                       // last snapshot restored by the replay
 };
 
 #endif // MAME_EMU_DEBUG_DEBUGCPU_H
@@ -123,6 +123,7 @@ const help_item f_static_help_list[] =
 		"  mapi <address>[:<space>] -- map logical I/O address to physical address and bank\n"
 		"  mapo <address>[:<space>] -- map logical opcode address to physical address and bank\n"
 		"  memdump [<filename>,[<root>]] -- dump current memory maps to <filename>\n"
+		"  heatmap[{d|i|o}] <on|off|clear|list>[,<space>[,<count>]] -- count accesses per handler and page\n"
 	},
 	{
 		"execution",
@@ -143,6 +144,9 @@ const help_item f_static_help_list[] =
 		"  gt[ime] <milliseconds> -- resumes execution until the given delay has elapsed\n"
 		"  gv[blank] -- resumes execution, setting temp breakpoint on the next VBLANK (F8)\n"
 		"  n[ext] -- executes until the next CPU switch (F6)\n"
+		"  rrecord [<frames>|OFF] -- records snapshots every <frames> frames for reverse execution\n"
+		"  rs[tep] [<count>=1] -- steps back <count> instructions using recorded snapshots\n"
+		"  rc[ontinue] -- goes back to the last breakpoint or watchpoint hit using recorded snapshots\n"
 		"  focus <CPU> -- focuses debugger only on <CPU>\n"
 		"  ignore [<CPU>[,<CPU>[,...]]] -- stops debugging on <CPU>\n"
 		"  observe [<CPU>[,<CPU>[,...]]] -- resumes debugging on <CPU>\n"
@@ -527,6 +531,60 @@ const help_item f_static_help_list[] =
 		"currently echoed into the running machine window.  Previous memory and PC tracking statistics "
 		"are cleared, actual reverse execution does not occur.\n"
 	},
+	{
+		"rrecord",
+		"\n"
+		"  rrecord [<frames>|OFF]\n"
+		"\n"
+		"The rrecord command starts recording snapshots of the machine state every <frames> frames, "
+		"which the rstep and rcontinue commands replay from to execute in reverse.  Unchanged memory is "
+		"shared between consecutive snapshots, and the oldest are dropped to stay within the rewind "
+		"capacity.  Specifying OFF stops recording and discards the snapshots, as do a reset or loading "
+		"a state.  With no parameter, the current recording status is displayed.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"rrecord 10\n"
+		"  Records a snapshot every ten frames.\n"
+		"\n"
+		"rrecord off\n"
+		"  Stops recording snapshots.\n"
+	},
+	{
+		"rstep",
+		"\n"
+		"  rs[tep] [<count>=1]\n"
+		"\n"
+		"The rstep command goes back <count> instructions on the current CPU.  The latest snapshot "
+		"recorded by rrecord before the current instruction is loaded and execution is replayed, ignoring "
+		"breakpoints and watchpoints, until the CPU reaches the earlier instruction.  Replay is only "
+		"faithful if the machine is deterministic and gets the same inputs; if it runs past the point "
+		"reverse execution started from, the snapshots are discarded.  Output from the replay, such as "
+		"trace files, is not written again.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"rs\n"
+		"  Goes back to the previous instruction.\n"
+		"\n"
+		"rstep 10\n"
+		"  Goes back ten instructions.\n"
+	},
+	{
+		"rcontinue",
+		"\n"
+		"  rc[ontinue]\n"
+		"\n"
+		"The rcontinue command goes back to the last time a breakpoint, registerpoint or watchpoint of the "
+		"current CPU would have stopped execution before the current instruction.  Recorded snapshots are "
+		"replayed from the latest backwards until a hit is found; breakpoint actions are not run during "
+		"the replay.  If there is no earlier hit, execution returns to the current instruction.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"rc\n"
+		"  Goes back to the last breakpoint or watchpoint hit.\n"
+	},
 	{
 		"statesave[ss]",
 		"\n"
@@ -1169,7 +1227,7 @@ const help_item f_static_help_list[] =
 	{
 		"trace",
 		"\n"
-		"  trace {<filename>|off}[,<CPU>[,[noloop|logerror][,<action>]]]\n"
+		"  trace {<filename>|off}[,<CPU>[,[noloop|logerror|binary|registers][,<action>]]]\n"
 		"\n"
 		"Starts or stops tracing of the execution of the specified <CPU>, or the currently visible "
 		"CPU if no CPU is specified.  To enable tracing, specify the trace log file name in the "
@@ -1181,7 +1239,10 @@ const help_item f_static_help_list[] =
 		"'logerror'.  Multiple flags must be separated by | (pipe) characters.  By default, loops "
 		"are detected and condensed to a single line.  If the 'noloop' flag is specified, loops "
 		"will not be detected and every instruction will be logged as executed.  If the 'logerror' "
-		"flag is specified, error log output will be included in the trace log.\n"
+		"flag is specified, error log output will be included in the trace log.  If the 'binary' "
+		"flag is specified, a compact binary trace of program counters and opcode bytes is written "
+		"in the background instead of disassembly text; use unidasm -trace to disassemble it.  The "
+		"'registers' flag implies 'binary' and also records register changes.\n"
 		"\n"
 		"The optional <action> parameter is a debugger command to execute before each trace message "
 		"is logged.  Generally, this will include a 'tracelog' or 'tracesym' command to include "
@@ -1209,6 +1270,10 @@ const help_item f_static_help_list[] =
 		"  Begin tracing the execution of CPU #0, logging output (along with logerror output) to "
 		"starswep.tr, with loop detection disabled.\n"
 		"\n"
+		"trace galaga.trb,,binary|noloop\n"
+		"  Begin tracing the execution of the currently visible CPU, writing a binary trace to "
+		"galaga.trb with loop detection disabled.\n"
+		"\n"
 		"trace >>pigskin.tr\n"
 		"  Begin tracing execution of the currently visible CPU, appending log output to "
 		"pigskin.tr.\n"
@@ -1223,7 +1288,7 @@ const help_item f_static_help_list[] =
 	{
 		"traceover",
 		"\n"
-		"  traceover {<filename>|off}[,<CPU>[,[noloop|logerror][,<action>]]]\n"
+		"  traceover {<filename>|off}[,<CPU>[,[noloop|logerror|binary|registers][,<action>]]]\n"
 		"\n"
 		"Starts or stops tracing for execution of the specified **<CPU>**, or the currently visible "
 		"CPU if no CPU is specified.  When a subroutine call is encountered, tracing will skip over "
@@ -1724,6 +1789,31 @@ const help_item f_static_help_list[] =
 		"memdump mylog.log,1\n"
 		"  Dumps memory maps for the CPU 1 and all its child devices to the file mylog.log.\n"
 	},
+	{
+		"heatmap",
+		"\n"
+		"  heatmap[{d|i|o}] <on|off|clear|list>[,<space>[,<count>]]\n"
+		"\n"
+		"Counts reads and writes in an address space, per handler and per page, to show which "
+		"handlers are accessed most.  Counting has no cost until it is turned on with 'on'; 'off' "
+		"stops counting and discards the counts, 'clear' zeroes them, and 'list' prints the busiest "
+		"<count> handlers and pages in each direction (16 by default).  Opcode fetches are counted "
+		"as reads.  The address space may be specified as a device tag, CPU number and/or space "
+		"name; if not specified, the command suffix sets the space of the visible CPU: 'heatmap' "
+		"defaults to the first address space exposed by the device, 'heatmapd' to the data space, "
+		"'heatmapi' to the I/O space, and 'heatmapo' to the opcodes space.\n"
+		"\n"
+		"Examples:\n"
+		"\n"
+		"heatmap on\n"
+		"  Starts counting accesses to the program space of the visible CPU.\n"
+		"\n"
+		"heatmapi list,maincpu,8\n"
+		"  Lists the eight busiest handlers and pages in the I/O space of the CPU ':maincpu'.\n"
+	},
+	{ "heatmapd", "#heatmap" },
+	{ "heatmapi", "#heatmap" },
+	{ "heatmapo", "#heatmap" },
 	{
 		"comlist",
 		"\n"
@@ -222,18 +222,30 @@ void debug_view_disasm::view_click(const int button, const debug_view_xy& pos)
 	end_update();
 }
 
+//-------------------------------------------------
+//  add_line - append the instruction at the given
+//  address, decoded through the device's
+//  disassembly cache, and return the address of
+//  the following instruction
+//-------------------------------------------------
+
+offs_t debug_view_disasm::add_line(debug_disasm_buffer &buffer, offs_t address)
+{
+	const debug_view_disasm_source &source = downcast<const debug_view_disasm_source &>(*m_source);
+	const device_debug::dasm_cache_entry &entry = source.device()->debug()->disassemble_cached(buffer, address);
+	dasm_line &line = m_dasm.emplace_back(address, entry.size, entry.instruction);
+	line.m_tadr = entry.address;
+	line.m_topcodes = entry.opcodes;
+	line.m_tparams = entry.params;
+	line.m_crc = entry.crc;
+	return entry.next_pc;
+}
+
 void debug_view_disasm::generate_from_address(debug_disasm_buffer &buffer, offs_t address)
 {
 	m_dasm.clear();
-	for(int i=0; i != m_total.y; i++) {
-		std::string dasm;
-		offs_t size;
-		offs_t next_address;
-		u32 info;
-		buffer.disassemble(address, dasm, next_address, size, info);
-		m_dasm.emplace_back(address, size, dasm);
-		address = next_address;
-	}
+	for(int i=0; i != m_total.y; i++)
+		address = add_line(buffer, address);
 	m_recompute = false;
 }
 
@@ -262,12 +274,7 @@ bool debug_view_disasm::generate_with_pc(debug_disasm_buffer &buffer, offs_t pc)
 	if(intf.interface_flags() & util::disasm_interface::NONLINEAR_PC) {
 		offs_t lpc = intf.pc_real_to_linear(pc);
 		while(intf.pc_real_to_linear(address) < lpc) {
-			std::string dasm;
-			offs_t size;
-			offs_t next_address;
-			u32 info;
-			buffer.disassemble(address, dasm, next_address, size, info);
-			m_dasm.emplace_back(address, size, dasm);
+			offs_t next_address = add_line(buffer, address);
 			if(intf.pc_real_to_linear(address) > intf.pc_real_to_linear(next_address))
 				return false;
 			address = next_address;
@@ -275,12 +282,7 @@ bool debug_view_disasm::generate_with_pc(debug_disasm_buffer &buffer, offs_t pc)
 
 	} else {
 		while(address < pc) {
-			std::string dasm;
-			offs_t size;
-			offs_t next_address;
-			u32 info;
-			buffer.disassemble(address, dasm, next_address, size, info);
-			m_dasm.emplace_back(address, size, dasm);
+			offs_t next_address = add_line(buffer, address);
 			if(address > next_address)
 				return false;
 			address = next_address;
@@ -293,15 +295,8 @@ bool debug_view_disasm::generate_with_pc(debug_disasm_buffer &buffer, offs_t pc)
 	if(m_dasm.size() > m_backwards_steps)
 		m_dasm.erase(m_dasm.begin(), m_dasm.begin() + (m_dasm.size() - m_backwards_steps));
 
-	while(m_dasm.size() < m_total.y) {
-		std::string dasm;
-		offs_t size;
-		offs_t next_address;
-		u32 info;
-		buffer.disassemble(address, dasm, next_address, size, info);
-		m_dasm.emplace_back(address, size, dasm);
-		address = next_address;
-	}
+	while(m_dasm.size() < m_total.y)
+		address = add_line(buffer, address);
 	return true;
 }
 
@@ -352,21 +347,18 @@ void debug_view_disasm::generate_dasm(debug_disasm_buffer &buffer, offs_t pc)
 	generate_from_address(buffer, pc);
 }
 
-void debug_view_disasm::complete_information(const debug_view_disasm_source &source, debug_disasm_buffer &buffer, offs_t pc)
+void debug_view_disasm::complete_information(const debug_view_disasm_source &source, offs_t pc)
 {
+	// the address and byte strings come from the disassembly cache with the instruction
 	for(auto &dasm : m_dasm) {
 		offs_t adr = dasm.m_address;
 
-		dasm.m_tadr = buffer.pc_to_string(adr);
-		dasm.m_topcodes = buffer.data_to_string(adr, dasm.m_size, true);
-		dasm.m_tparams  = buffer.data_to_string(adr, dasm.m_size, false);
-
 		dasm.m_is_pc = adr == pc;
 
 		dasm.m_is_bp = source.device()->debug()->breakpoint_find(adr) != nullptr;
-		dasm.m_is_visited = source.device()->debug()->track_pc_visited(adr);
+		dasm.m_is_visited = source.device()->debug()->track_pc_visited(adr, dasm.m_crc);
 
-		const char *comment = source.device()->debug()->comment_text(adr);
+		const char *comment = source.device()->debug()->comment_text(adr, dasm.m_crc);
 		if(comment)
 			dasm.m_comment = comment;
 	}
@@ -385,7 +377,7 @@ void debug_view_disasm::view_update()
 
 	generate_dasm(buffer, pc);
 
-	complete_information(source, buffer, pc);
+	complete_information(source, pc);
 	redraw();
 }
 
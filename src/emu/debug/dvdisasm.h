@@ -103,20 +103,22 @@ private:
 		std::string m_topcodes;                 // textual representation of opcode/default values
 		std::string m_tparams;                  // textual representation of parameter values
 		std::string m_comment;                  // comment, when present
+		u32 m_crc;                              // CRC of the opcode bytes
 
 		bool m_is_pc;                           // this line's address is PC
 		bool m_is_bp;                           // this line's address is a breakpoint
 		bool m_is_visited;                      // this line has been visited
 
-		dasm_line(offs_t address, offs_t size, std::string dasm) : m_address(address), m_size(size), m_dasm(dasm), m_is_pc(false), m_is_bp(false), m_is_visited(false) {}
+		dasm_line(offs_t address, offs_t size, std::string dasm) : m_address(address), m_size(size), m_dasm(dasm), m_crc(0), m_is_pc(false), m_is_bp(false), m_is_visited(false) {}
 	};
 
 	// internal helpers
+	offs_t add_line(debug_disasm_buffer &buffer, offs_t address);
 	void generate_from_address(debug_disasm_buffer &buffer, offs_t address);
 	bool generate_with_pc(debug_disasm_buffer &buffer, offs_t pc);
 	int address_position(offs_t pc) const;
 	void generate_dasm(debug_disasm_buffer &buffer, offs_t pc);
-	void complete_information(const debug_view_disasm_source &source, debug_disasm_buffer &buffer, offs_t pc);
+	void complete_information(const debug_view_disasm_source &source, offs_t pc);
 
 	void enumerate_sources();
 	void print(int row, std::string text, int start, int end, u8 attrib);
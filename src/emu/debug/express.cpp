@@ -101,6 +101,13 @@ enum
 	TVL_EXECUTEFUNC
 };
 
+// additional opcodes used by compiled expressions
+enum
+{
+	CVL_NUMBER = TVL_EXECUTEFUNC + 1,   // push a constant
+	CVL_REFERENCE                       // push a symbol or memory reference
+};
+
 
 
 //**************************************************************************
@@ -284,6 +291,80 @@ inline std::pair<device_t &, char const *> get_device_search(running_machine &ma
 	}
 }
 
+
+//-------------------------------------------------
+//  compute_unary - evaluate a unary rval operator
+//-------------------------------------------------
+
+inline u64 compute_unary(u8 optype, u64 a)
+{
+	switch (optype)
+	{
+	case TVL_COMPLEMENT:    return !a;
+	case TVL_NOT:           return ~a;
+	case TVL_UPLUS:         return a;
+	case TVL_UMINUS:        return -a;
+	default:                return 0;
+	}
+}
+
+
+//-------------------------------------------------
+//  compute_binary - evaluate a binary rval
+//  operator; division by zero must be checked
+//  by the caller
+//-------------------------------------------------
+
+inline u64 compute_binary(u8 optype, u64 a, u64 b)
+{
+	switch (optype)
+	{
+	case TVL_MULTIPLY:          return a * b;
+	case TVL_DIVIDE:            return a / b;
+	case TVL_MODULO:            return a % b;
+	case TVL_ADD:               return a + b;
+	case TVL_SUBTRACT:          return a - b;
+	case TVL_LSHIFT:            return a << b;
+	case TVL_RSHIFT:            return a >> b;
+	case TVL_LESS:              return a < b;
+	case TVL_LESSOREQUAL:       return a <= b;
+	case TVL_GREATER:           return a > b;
+	case TVL_GREATEROREQUAL:    return a >= b;
+	case TVL_EQUAL:             return a == b;
+	case TVL_NOTEQUAL:          return a != b;
+	case TVL_BAND:              return a & b;
+	case TVL_BXOR:              return a ^ b;
+	case TVL_BOR:               return a | b;
+	case TVL_LAND:              return a && b;
+	case TVL_LOR:               return a || b;
+	default:                    return 0;
+	}
+}
+
+
+//-------------------------------------------------
+//  compound_operator - return the arithmetic
+//  operator for a compound assignment, or 0
+//-------------------------------------------------
+
+inline u8 compound_operator(u8 optype)
+{
+	switch (optype)
+	{
+	case TVL_ASSIGNMULTIPLY:    return TVL_MULTIPLY;
+	case TVL_ASSIGNDIVIDE:      return TVL_DIVIDE;
+	case TVL_ASSIGNMODULO:      return TVL_MODULO;
+	case TVL_ASSIGNADD:         return TVL_ADD;
+	case TVL_ASSIGNSUBTRACT:    return TVL_SUBTRACT;
+	case TVL_ASSIGNLSHIFT:      return TVL_LSHIFT;
+	case TVL_ASSIGNRSHIFT:      return TVL_RSHIFT;
+	case TVL_ASSIGNBAND:        return TVL_BAND;
+	case TVL_ASSIGNBXOR:        return TVL_BXOR;
+	case TVL_ASSIGNBOR:         return TVL_BOR;
+	default:                    return 0;
+	}
+}
+
 } // anonymous namespace
 
 
@@ -540,10 +621,39 @@ void symbol_table::write_memory(address_space &space, offs_t address, u64 data,
 
 //-------------------------------------------------
 //  expression_get_space - return a space
-//  based on a case insensitive tag search
+//  based on a case insensitive tag search,
+//  remembering successful searches since
+//  expressions such as cheats repeat them every
+//  time they're executed
 //-------------------------------------------------
 
 expression_error symbol_table::expression_get_space(const char *tag, int &spacenum, device_memory_interface *&memory)
+{
+	if (!tag)
+		return find_space(tag, spacenum, memory);
+
+	std::string key(tag);
+	key.push_back(char(spacenum + 1));
+	auto const found = m_space_cache.find(key);
+	if (found != m_space_cache.end())
+	{
+		spacenum = found->second.first;
+		memory = found->second.second;
+		return expression_error::NONE;
+	}
+
+	expression_error const result = find_space(tag, spacenum, memory);
+	if (result == expression_error::NONE)
+		m_space_cache.emplace(std::move(key), std::make_pair(spacenum, memory));
+	return result;
+}
+
+
+//-------------------------------------------------
+//  find_space - search for a space by tag
+//-------------------------------------------------
+
+expression_error symbol_table::find_space(const char *tag, int &spacenum, device_memory_interface *&memory)
 {
 	device_t *device = nullptr;
 	std::string spacename;
@@ -1017,12 +1127,14 @@ expression_error::error_code symbol_table::memory_valid(const char *name, expres
 parsed_expression::parsed_expression(symbol_table &symtable)
 	: m_symtable(symtable)
 	, m_default_base(16)
+	, m_compiled(false)
 {
 }
 
 parsed_expression::parsed_expression(symbol_table &symtable, std::string_view expression, int default_base)
 	: m_symtable(symtable)
 	, m_default_base(default_base)
+	, m_compiled(false)
 {
 	assert(default_base == 8 || default_base == 10 || default_base == 16);
 
@@ -1038,6 +1150,7 @@ parsed_expression::parsed_expression(const parsed_expression &src)
 	: m_symtable(src.m_symtable)
 	, m_default_base(src.m_default_base)
 	, m_original_string(src.m_original_string)
+	, m_compiled(false)
 {
 	if (!m_original_string.empty())
 		parse_string_into_tokens();
@@ -1054,12 +1167,18 @@ void parsed_expression::parse(std::string_view expression)
 	m_original_string.assign(expression);
 	m_tokenlist.clear();
 	m_stringlist.clear();
+	m_compiled = false;
+	m_program.clear();
 
 	// first parse the tokens into the token array in order
 	parse_string_into_tokens();
 
 	// convert the infix order to postfix order
 	infix_to_postfix();
+
+	// compile for fast execution; anything the compiler can't prove
+	// valid is left to the interpreter, which reports the error
+	m_compiled = compile();
 }
 
 
@@ -1072,6 +1191,8 @@ void parsed_expression::copy(const parsed_expression &src)
 	m_symtable = src.m_symtable;
 	m_default_base = src.m_default_base;
 	m_original_string.assign(src.m_original_string);
+	m_compiled = false;
+	m_program.clear();
 	if (!m_original_string.empty())
 		parse_string_into_tokens();
 }
@@ -2145,6 +2266,394 @@ u64 parsed_expression::execute_tokens()
 }
 
 
+//-------------------------------------------------
+//  compile - convert the postfix token list into
+//  a flat program with resolved stack depths and
+//  folded constants; returns false if the
+//  expression must be left to the interpreter
+//-------------------------------------------------
+
+bool parsed_expression::compile()
+{
+	// what each stack position is known to hold
+	enum entry_kind { ENTRY_NUMBER, ENTRY_VALUE, ENTRY_REFERENCE, ENTRY_FUNCTION };
+	struct entry
+	{
+		entry_kind          kind;
+		bool                lval;
+		int                 offset;
+		u64                 value;
+		const parse_token * token;
+	};
+
+	std::vector<entry> stack;
+	size_t slots = 0, maxslots = 0;
+	m_program.clear();
+
+	auto const push = [&] (entry_kind kind, bool lval, int offset, u64 value, const parse_token *token = nullptr)
+	{
+		stack.push_back(entry{ kind, lval, offset, value, token });
+		if (kind != ENTRY_FUNCTION)
+			maxslots = std::max(maxslots, ++slots);
+	};
+	auto const pop = [&] (entry &result, bool lval) -> bool
+	{
+		if (stack.empty() || stack.back().kind == ENTRY_FUNCTION || (lval && !stack.back().lval))
+			return false;
+		result = stack.back();
+		stack.pop_back();
+		slots--;
+		return true;
+	};
+	auto const emit = [this] (u8 opcode, u8 param, int offset, u64 value, const parse_token *token)
+	{
+		m_program.push_back(compiled_op{ opcode, param, offset, value, token });
+	};
+
+	entry t1, t2;
+	for (const parse_token &token : m_tokenlist)
+	{
+		if (token.is_number())
+		{
+			emit(CVL_NUMBER, 0, token.offset(), token.value(), nullptr);
+			push(ENTRY_NUMBER, false, token.offset(), token.value());
+			continue;
+		}
+		if (token.is_symbol())
+		{
+			// function symbols have no slot; the call consumes them
+			if (token.symbol().is_function())
+			{
+				push(ENTRY_FUNCTION, false, token.offset(), 0, &token);
+				continue;
+			}
+			emit(CVL_REFERENCE, 0, token.offset(), 0, &token);
+			push(ENTRY_REFERENCE, token.symbol().is_lval(), token.offset(), 0);
+			continue;
+		}
+		if (token.is_memory())
+		{
+			emit(CVL_REFERENCE, 0, token.offset(), token.address(), &token);
+			push(ENTRY_REFERENCE, true, token.offset(), 0);
+			continue;
+		}
+		if (!token.is_operator())
+			return false;
+
+		u8 const optype = token.optype();
+		switch (optype)
+		{
+			case TVL_PREINCREMENT:
+			case TVL_PREDECREMENT:
+			case TVL_POSTINCREMENT:
+			case TVL_POSTDECREMENT:
+				if (!pop(t1, true))
+					return false;
+				emit(optype, 0, t1.offset, 0, nullptr);
+				push(ENTRY_VALUE, false, t1.offset, 0);
+				break;
+
+			case TVL_COMPLEMENT:
+			case TVL_NOT:
+			case TVL_UPLUS:
+			case TVL_UMINUS:
+				if (!pop(t1, false))
+					return false;
+				if (t1.kind == ENTRY_NUMBER)
+				{
+					u64 const result = compute_unary(optype, t1.value);
+					m_program.back().value = result;
+					push(ENTRY_NUMBER, false, t1.offset, result);
+				}
+				else
+				{
+					emit(optype, 0, t1.offset, 0, nullptr);
+					push(ENTRY_VALUE, false, t1.offset, 0);
+				}
+				break;
+
+			case TVL_MULTIPLY:
+			case TVL_DIVIDE:
+			case TVL_MODULO:
+			case TVL_ADD:
+			case TVL_SUBTRACT:
+			case TVL_LSHIFT:
+			case TVL_RSHIFT:
+			case TVL_LESS:
+			case TVL_LESSOREQUAL:
+			case TVL_GREATER:
+			case TVL_GREATEROREQUAL:
+			case TVL_EQUAL:
+			case TVL_NOTEQUAL:
+			case TVL_BAND:
+			case TVL_BXOR:
+			case TVL_BOR:
+			case TVL_LAND:
+			case TVL_LOR:
+				if (!pop(t2, false) || !pop(t1, false))
+					return false;
+				if (t1.kind == ENTRY_NUMBER && t2.kind == ENTRY_NUMBER && !((optype == TVL_DIVIDE || optype == TVL_MODULO) && t2.value == 0))
+				{
+					// both operands are the last two constants pushed
+					u64 const result = compute_binary(optype, t1.value, t2.value);
+					m_program.pop_back();
+					m_program.back().value = result;
+					push(ENTRY_NUMBER, false, std::min(t1.offset, t2.offset), result);
+				}
+				else
+				{
+					emit(optype, 0, t2.offset, 0, nullptr);
+					push(ENTRY_VALUE, false, std::min(t1.offset, t2.offset), 0);
+				}
+				break;
+
+			case TVL_ASSIGN:
+				if (!pop(t2, false) || !pop(t1, true))
+					return false;
+				emit(optype, 0, t2.offset, 0, nullptr);
+				push(ENTRY_VALUE, false, t2.offset, 0);
+				break;
+
+			case TVL_ASSIGNMULTIPLY:
+			case TVL_ASSIGNDIVIDE:
+			case TVL_ASSIGNMODULO:
+			case TVL_ASSIGNADD:
+			case TVL_ASSIGNSUBTRACT:
+			case TVL_ASSIGNLSHIFT:
+			case TVL_ASSIGNRSHIFT:
+			case TVL_ASSIGNBAND:
+			case TVL_ASSIGNBXOR:
+			case TVL_ASSIGNBOR:
+				if (!pop(t2, false) || !pop(t1, true))
+					return false;
+				emit(optype, compound_operator(optype), t2.offset, 0, nullptr);
+				push(ENTRY_VALUE, false, std::min(t1.offset, t2.offset), 0);
+				break;
+
+			case TVL_COMMA:
+				if (token.is_function_separator())
+					break;
+				if (!pop(t2, false) || !pop(t1, false))
+					return false;
+				if (t1.kind == ENTRY_NUMBER && t2.kind == ENTRY_NUMBER)
+				{
+					// drop the discarded constant
+					m_program.erase(m_program.end() - 2);
+					push(ENTRY_NUMBER, false, t2.offset, t2.value);
+				}
+				else
+				{
+					emit(optype, 0, t2.offset, 0, nullptr);
+					push(ENTRY_VALUE, false, t2.offset, 0);
+				}
+				break;
+
+			case TVL_MEMORYAT:
+				if (!pop(t1, false))
+					return false;
+				emit(optype, 0, t1.offset, 0, &token);
+				push(ENTRY_REFERENCE, true, t1.offset, 0);
+				break;
+
+			case TVL_EXECUTEFUNC:
+			{
+				// find the function symbol below the parameters
+				int paramcount = 0;
+				auto func = stack.rbegin();
+				while (func != stack.rend() && func->kind != ENTRY_FUNCTION)
+					++func, ++paramcount;
+				if (func == stack.rend() || paramcount >= MAX_FUNCTION_PARAMS)
+					return false;
+
+				const parse_token *const functoken = func->token;
+				function_symbol_entry const &function = downcast<function_symbol_entry const &>(functoken->symbol());
+				if (paramcount < function.minparams() || paramcount > function.maxparams())
+					return false;
+
+				stack.resize(stack.size() - paramcount - 1);
+				slots -= paramcount;
+				emit(optype, paramcount, token.offset(), 0, functoken);
+				push(ENTRY_VALUE, false, token.offset(), 0);
+				break;
+			}
+
+			default:
+				return false;
+		}
+	}
+
+	// the program must leave exactly one rval behind
+	if (stack.size() != 1 || stack.back().kind == ENTRY_FUNCTION)
+		return false;
+
+	m_slots.resize(maxslots);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  compiled_read - fetch the value of a compiled
+//  stack slot, resolving symbols and memory
+//-------------------------------------------------
+
+inline u64 parsed_expression::compiled_read(const compiled_slot &slot)
+{
+	if (!slot.ref)
+		return slot.value;
+	else if (slot.ref->is_symbol())
+		return slot.ref->symbol().value();
+	else
+		return symbols().memory_value(slot.ref->memory_source(), slot.ref->memory_space(), u32(slot.value), 1 << slot.ref->memory_size(), slot.ref->memory_side_effects());
+}
+
+
+//-------------------------------------------------
+//  compiled_write - store to the symbol or memory
+//  referenced by a compiled stack slot
+//-------------------------------------------------
+
+inline void parsed_expression::compiled_write(const compiled_slot &slot, u64 value)
+{
+	if (slot.ref->is_symbol())
+		slot.ref->symbol().set_value(value);
+	else
+		symbols().set_memory_value(slot.ref->memory_source(), slot.ref->memory_space(), u32(slot.value), 1 << slot.ref->memory_size(), value, slot.ref->memory_side_effects());
+}
+
+
+//-------------------------------------------------
+//  execute_compiled - run the compiled program;
+//  stack shape and lvals were validated by
+//  compile, so only runtime errors remain
+//-------------------------------------------------
+
+u64 parsed_expression::execute_compiled()
+{
+	compiled_slot *sp = &m_slots[0];
+	for (const compiled_op &op : m_program)
+	{
+		switch (op.opcode)
+		{
+			case CVL_NUMBER:
+				*sp++ = compiled_slot{ op.value, nullptr };
+				break;
+
+			case CVL_REFERENCE:
+				*sp++ = compiled_slot{ op.value, op.token };
+				break;
+
+			case TVL_PREINCREMENT:
+			case TVL_PREDECREMENT:
+			{
+				u64 const result = compiled_read(sp[-1]) + ((op.opcode == TVL_PREINCREMENT) ? 1 : -1);
+				compiled_write(sp[-1], result);
+				sp[-1] = compiled_slot{ result, nullptr };
+				break;
+			}
+
+			case TVL_POSTINCREMENT:
+			case TVL_POSTDECREMENT:
+			{
+				u64 const result = compiled_read(sp[-1]);
+				compiled_write(sp[-1], result + ((op.opcode == TVL_POSTINCREMENT) ? 1 : -1));
+				sp[-1] = compiled_slot{ result, nullptr };
+				break;
+			}
+
+			case TVL_COMPLEMENT:
+			case TVL_NOT:
+			case TVL_UPLUS:
+			case TVL_UMINUS:
+				sp[-1] = compiled_slot{ compute_unary(op.opcode, compiled_read(sp[-1])), nullptr };
+				break;
+
+			case TVL_DIVIDE:
+			case TVL_MODULO:
+			case TVL_MULTIPLY:
+			case TVL_ADD:
+			case TVL_SUBTRACT:
+			case TVL_LSHIFT:
+			case TVL_RSHIFT:
+			case TVL_LESS:
+			case TVL_LESSOREQUAL:
+			case TVL_GREATER:
+			case TVL_GREATEROREQUAL:
+			case TVL_EQUAL:
+			case TVL_NOTEQUAL:
+			case TVL_BAND:
+			case TVL_BXOR:
+			case TVL_BOR:
+			case TVL_LAND:
+			case TVL_LOR:
+			{
+				u64 const b = compiled_read(sp[-1]);
+				u64 const a = compiled_read(sp[-2]);
+				if (b == 0 && (op.opcode == TVL_DIVIDE || op.opcode == TVL_MODULO))
+					throw expression_error(expression_error::DIVIDE_BY_ZERO, op.offset);
+				--sp;
+				sp[-1] = compiled_slot{ compute_binary(op.opcode, a, b), nullptr };
+				break;
+			}
+
+			case TVL_ASSIGN:
+			{
+				u64 const b = compiled_read(sp[-1]);
+				--sp;
+				compiled_write(sp[-1], b);
+				sp[-1] = compiled_slot{ b, nullptr };
+				break;
+			}
+
+			case TVL_ASSIGNMULTIPLY:
+			case TVL_ASSIGNDIVIDE:
+			case TVL_ASSIGNMODULO:
+			case TVL_ASSIGNADD:
+			case TVL_ASSIGNSUBTRACT:
+			case TVL_ASSIGNLSHIFT:
+			case TVL_ASSIGNRSHIFT:
+			case TVL_ASSIGNBAND:
+			case TVL_ASSIGNBXOR:
+			case TVL_ASSIGNBOR:
+			{
+				u64 const b = compiled_read(sp[-1]);
+				if (b == 0 && (op.param == TVL_DIVIDE || op.param == TVL_MODULO))
+					throw expression_error(expression_error::DIVIDE_BY_ZERO, op.offset);
+				--sp;
+				u64 const result = compute_binary(op.param, compiled_read(sp[-1]), b);
+				compiled_write(sp[-1], result);
+				sp[-1] = compiled_slot{ result, nullptr };
+				break;
+			}
+
+			case TVL_COMMA:
+			{
+				u64 const b = compiled_read(sp[-1]);
+				compiled_read(sp[-2]);
+				--sp;
+				sp[-1] = compiled_slot{ b, nullptr };
+				break;
+			}
+
+			case TVL_MEMORYAT:
+				sp[-1] = compiled_slot{ u32(compiled_read(sp[-1])), op.token };
+				break;
+
+			case TVL_EXECUTEFUNC:
+			{
+				u64 funcparams[MAX_FUNCTION_PARAMS];
+				for (int param = op.param - 1; param >= 0; param--)
+					funcparams[param] = compiled_read(*--sp);
+				function_symbol_entry &function = downcast<function_symbol_entry &>(op.token->symbol());
+				*sp++ = compiled_slot{ function.execute(op.param, funcparams), nullptr };
+				break;
+			}
+		}
+	}
+
+	return compiled_read(sp[-1]);
+}
+
+
 
 //**************************************************************************
 //  PARSE TOKEN
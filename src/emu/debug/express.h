@@ -20,6 +20,7 @@
 #include <list>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 
 
@@ -208,6 +209,7 @@ private:
 	void write_program_direct(address_space &space, int opcode, offs_t address, int size, u64 data);
 	void write_memory_region(const char *rgntag, offs_t address, int size, u64 data);
 	expression_error expression_get_space(const char *tag, int &spacenum, device_memory_interface *&memory);
+	expression_error find_space(const char *tag, int &spacenum, device_memory_interface *&memory);
 	void notify_memory_modified();
 
 	// internal state
@@ -216,6 +218,7 @@ private:
 	std::unordered_map<std::string,std::unique_ptr<symbol_entry>> m_symlist;        // list of symbols
 	device_memory_interface *const m_memintf;   // pointer to the local memory interface (if any)
 	memory_modified_func    m_memory_modified;  // memory modified callback
+	std::unordered_map<std::string, std::pair<int, device_memory_interface *>> m_space_cache; // spaces found by tag
 };
 
 
@@ -247,7 +250,7 @@ public:
 
 	// execution
 	void parse(std::string_view string);
-	u64 execute() { return execute_tokens(); }
+	u64 execute() { return m_compiled ? execute_compiled() : execute_tokens(); }
 
 private:
 	// a single token
@@ -301,6 +304,7 @@ private:
 		const char *string() const { assert(m_type == STRING); return m_string; }
 		u32 address() const { assert(m_type == MEMORY); return m_value; }
 		symbol_entry &symbol() const { assert(m_type == SYMBOL); return *m_symbol; }
+		const char *memory_source() const { assert(m_type == OPERATOR || m_type == MEMORY); return m_string; }
 
 		u8 optype() const { assert(m_type == OPERATOR); return (m_flags & TIN_OPTYPE_MASK) >> TIN_OPTYPE_SHIFT; }
 		u8 precedence() const { assert(m_type == OPERATOR); return (m_flags & TIN_PRECEDENCE_MASK) >> TIN_PRECEDENCE_SHIFT; }
@@ -342,6 +346,23 @@ private:
 		symbol_entry *          m_symbol;           // symbol pointer
 	};
 
+	// a single operation in a compiled expression
+	struct compiled_op
+	{
+		u8                      opcode;             // operator type or compiled opcode
+		u8                      param;              // parameter count or arithmetic operator
+		int                     offset;             // offset for reporting errors
+		u64                     value;              // constant value or memory address
+		const parse_token *     token;              // symbol, memory or function token
+	};
+
+	// a value on the compiled execution stack
+	struct compiled_slot
+	{
+		u64                     value;              // value or memory address
+		const parse_token *     ref;                // symbol or memory token, or nullptr for values
+	};
+
 	// internal helpers
 	void copy(const parsed_expression &src);
 	void print_tokens();
@@ -364,6 +385,12 @@ private:
 	u64 execute_tokens();
 	void execute_function(parse_token &token);
 
+	// compiled execution helpers
+	bool compile();
+	u64 execute_compiled();
+	u64 compiled_read(const compiled_slot &slot);
+	void compiled_write(const compiled_slot &slot, u64 value);
+
 	// constants
 	static const int MAX_FUNCTION_PARAMS = 16;
 
@@ -374,6 +401,9 @@ private:
 	std::list<parse_token> m_tokenlist;                 // token list
 	std::list<std::string> m_stringlist;                // string list
 	std::deque<parse_token> m_token_stack;              // token stack (used during execution)
+	bool                m_compiled;                     // true if m_program is valid
+	std::vector<compiled_op> m_program;                 // compiled operations
+	std::vector<compiled_slot> m_slots;                 // value stack for compiled execution
 };
 
 #endif // MAME_EMU_DEBUG_EXPRESS_H
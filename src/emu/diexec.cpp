@@ -64,6 +64,9 @@ device_execute_interface::device_execute_interface(const machine_config &mconfig
 	, m_trigger(0)
 	, m_inttrigger(0)
 	, m_totalcycles(0)
+	, m_timeslices(0)
+	, m_aborts{ 0 }
+	, m_host_ticks(0)
 	, m_divisor(0)
 	, m_divshift(0)
 	, m_cycles_per_second(0)
@@ -91,12 +94,14 @@ device_execute_interface::~device_execute_interface()
 //  run before we run again
 //-------------------------------------------------
 
-void device_execute_interface::abort_timeslice() noexcept
+void device_execute_interface::abort_timeslice(abort_reason reason) noexcept
 {
 	// ignore if not the executing device
 	if (!executing())
 		return;
 
+	m_aborts[reason]++;
+
 	// swallow the remaining cycles
 	if (m_icountptr != nullptr)
 	{
@@ -118,7 +123,7 @@ void device_execute_interface::suspend_resume_changed()
 	m_scheduler->suspend_resume_changed();
 
 	// if we're active, synchronize
-	abort_timeslice();
+	abort_timeslice(ABORT_REASON_SUSPEND);
 }
 
 
@@ -190,7 +195,7 @@ void device_execute_interface::suspend_until_trigger(int trigid, bool eatcycles)
 void device_execute_interface::trigger(int trigid)
 {
 	// if we're executing, for an immediate abort
-	abort_timeslice();
+	abort_timeslice(ABORT_REASON_TRIGGER);
 
 	// see if this is a matching trigger
 	if ((m_nextsuspend & SUSPEND_REASON_TRIGGER) != 0 && m_trigger == trigid)
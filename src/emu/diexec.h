@@ -31,6 +31,17 @@ constexpr u32 SUSPEND_REASON_CLOCK      = 0x0040;   // currently not clocked
 constexpr u32 SUSPEND_ANY_REASON        = ~0;       // all of the above
 
 
+// reasons for cutting a timeslice short, tracked for scheduler statistics
+enum abort_reason : unsigned
+{
+	ABORT_REASON_EXPLICIT = 0,  // abort_timeslice() called directly
+	ABORT_REASON_TRIGGER,       // a trigger was signalled
+	ABORT_REASON_SUSPEND,       // suspend state changed
+	ABORT_REASON_TIMER,         // a timer became due before the end of the timeslice (synchronize, input lines)
+	ABORT_REASON_COUNT
+};
+
+
 // I/O line states
 enum line_state
 {
@@ -158,7 +169,7 @@ public:
 	s32 cycles_remaining() const noexcept { return executing() ? *m_icountptr : 0; } // cycles remaining in this timeslice
 	void eat_cycles(int cycles) noexcept { if (executing()) *m_icountptr = (cycles > *m_icountptr) ? 0 : (*m_icountptr - cycles); }
 	void adjust_icount(int delta) noexcept { if (executing()) *m_icountptr += delta; }
-	void abort_timeslice() noexcept;
+	void abort_timeslice(abort_reason reason = ABORT_REASON_EXPLICIT) noexcept;
 
 	// input and interrupt management
 	void set_input_line(int linenum, int state) { assert(device().started()); m_input[linenum].set_state_synced(state); }
@@ -186,6 +197,11 @@ public:
 	attotime local_time() const noexcept;
 	u64 total_cycles() const noexcept;
 
+	// scheduler statistics
+	u64 timeslice_count() const noexcept { return m_timeslices; }
+	u64 abort_count(abort_reason reason) const noexcept { return m_aborts[reason]; }
+	osd_ticks_t host_ticks() const noexcept { return m_host_ticks; }
+
 	// required operation overrides
 	void run() { execute_run(); }
 
@@ -319,6 +335,9 @@ private:
 
 	// clock and timing information
 	u64                     m_totalcycles;              // total device cycles executed
+	u64                     m_timeslices;               // total timeslices executed
+	u64                     m_aborts[ABORT_REASON_COUNT]; // timeslices cut short, by reason
+	osd_ticks_t             m_host_ticks;               // host time spent executing, when timing is enabled
 	attotime                m_localtime;                // local time, relative to the timer system's global time
 	s32                     m_divisor;                  // 32-bit attoseconds_per_cycle divisor
 	u8                      m_divshift;                 // right shift amount to fit the divisor into 32 bits
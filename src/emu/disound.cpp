@@ -500,9 +500,9 @@ void device_mixer_interface::sound_stream_update(sound_stream &stream, std::vect
 	// loop over inputs
 	for (int inputnum = 0; inputnum < m_auto_allocated_inputs; inputnum++)
 	{
-		// skip if the gain is 0
+		// skip if the gain is 0 or the input is known to be silent
 		auto &input = inputs[inputnum];
-		if (input.gain() == 0)
+		if (input.gain() == 0 || input.silent())
 			continue;
 
 		// either store or accumulate
@@ -519,5 +519,5 @@ void device_mixer_interface::sound_stream_update(sound_stream &stream, std::vect
 	// clear anything unused
 	for (int outputnum = 0; outputnum < m_outputs; outputnum++)
 		if (!m_output_clear[outputnum])
-			outputs[outputnum].fill(0);
+			outputs[outputnum].silence();
 }
@@ -27,6 +27,23 @@ constexpr int readbit(const u8 *src, unsigned int bitnum)
 }
 
 
+/*-------------------------------------------------
+    s_expand_bits - one 0x00 or 0xff mask per
+    pixel for each source byte, most significant
+    bit first, so that a byte of one plane can be
+    merged eight pixels at a time
+-------------------------------------------------*/
+
+const auto s_expand_bits = [] ()
+{
+	std::array<std::array<u8, 8>, 256> result{};
+	for (int b = 0; b < 256; b++)
+		for (int i = 0; i < 8; i++)
+			result[b][i] = BIT(b, 7 - i) ? 0xff : 0x00;
+	return result;
+}();
+
+
 /*-------------------------------------------------
     normalize_xscroll - normalize an X scroll
     value for a bitmap to be positive and less
@@ -96,6 +113,7 @@ gfx_element::gfx_element(device_palette_interface *palette, u8 *base, u16 width,
 		m_gfxdata(base),
 		m_layout_is_raw(true),
 		m_layout_planes(0),
+		m_layout_fast(LAYOUT_FAST_NONE),
 		m_layout_xormask(0),
 		m_layout_charincrement(0)
 {
@@ -121,6 +139,7 @@ gfx_element::gfx_element(device_palette_interface *palette, const gfx_layout &gl
 		m_gfxdata(nullptr),
 		m_layout_is_raw(false),
 		m_layout_planes(0),
+		m_layout_fast(LAYOUT_FAST_NONE),
 		m_layout_xormask(xormask),
 		m_layout_charincrement(0)
 {
@@ -147,6 +166,7 @@ void gfx_element::set_layout(const gfx_layout &gl, const u8 *srcdata)
 	// copy data from the layout
 	m_layout_is_raw = (gl.planeoffset[0] == GFX_RAW);
 	m_layout_planes = gl.planes;
+	m_layout_fast = LAYOUT_FAST_NONE;
 	m_layout_charincrement = gl.charincrement;
 
 	// raw graphics case
@@ -182,6 +202,8 @@ void gfx_element::set_layout(const gfx_layout &gl, const u8 *srcdata)
 		for (int x = 0; x < m_width; x++)
 			m_layout_xoffset[x] = gl.xoffs(x);
 
+		m_layout_fast = classify_layout();
+
 		// we get to pick our own modulos
 		m_line_modulo = m_origwidth;
 		m_char_modulo = m_line_modulo * m_origheight;
@@ -193,6 +215,7 @@ void gfx_element::set_layout(const gfx_layout &gl, const u8 *srcdata)
 
 	// mark everything dirty
 	m_dirty.resize(m_total_elements);
+	m_dirtystamp.resize(m_total_elements);
 	memset(&m_dirty[0], 1, m_total_elements);
 
 	// allocate a pen usage array for entries with 32 pens or less
@@ -203,6 +226,48 @@ void gfx_element::set_layout(const gfx_layout &gl, const u8 *srcdata)
 }
 
 
+//-------------------------------------------------
+//  classify_layout - work out whether the copied
+//  layout offsets fit one of the decode shortcuts;
+//  everything must start on a byte boundary so a
+//  whole source byte can be consumed at once
+//-------------------------------------------------
+
+u8 gfx_element::classify_layout() const
+{
+	if (m_layout_charincrement % 8)
+		return LAYOUT_FAST_NONE;
+	for (u32 offs : m_layout_yoffset)
+		if (offs % 8)
+			return LAYOUT_FAST_NONE;
+
+	// packed: planes are adjacent bits, pixels are whole bytes or nibbles
+	bool packed = (m_layout_planes == 8) || ((m_layout_planes == 4) && !(m_origwidth % 2));
+	for (int p = 0; packed && (p < m_layout_planes); p++)
+		packed = (m_layout_planeoffset[p] == m_layout_planeoffset[0] + p) && !(m_layout_planeoffset[0] % 8);
+	for (int x = 0; packed && (x < m_origwidth); x++)
+	{
+		if ((m_layout_planes == 8) || !(x % 2))
+			packed = !(m_layout_xoffset[x] % 8);
+		else
+			packed = (m_layout_xoffset[x] == m_layout_xoffset[x - 1] + 4);
+	}
+	if (packed)
+		return LAYOUT_FAST_PACKED;
+
+	// bytes: each plane starts on a byte, and runs of eight pixels read one byte left to right
+	for (int p = 0; p < m_layout_planes; p++)
+		if (m_layout_planeoffset[p] % 8)
+			return LAYOUT_FAST_NONE;
+	if (m_origwidth < 8)
+		return LAYOUT_FAST_NONE;
+	for (int x = 0; x < (m_origwidth & ~7); x++)
+		if (m_layout_xoffset[x] != m_layout_xoffset[x & ~7] + (x & 7) || (m_layout_xoffset[x & ~7] % 8))
+			return LAYOUT_FAST_NONE;
+	return LAYOUT_FAST_BYTES;
+}
+
+
 //-------------------------------------------------
 //  set_raw_layout - set the layout for a gfx_element
 //-------------------------------------------------
@@ -245,6 +310,7 @@ void gfx_element::set_source_and_total(const u8 *source, u32 total)
 
 	// mark everything dirty
 	m_dirty.resize(m_total_elements);
+	m_dirtystamp.resize(m_total_elements);
 	memset(&m_dirty[0], 1, m_total_elements);
 
 	// allocate a pen usage array for entries with 32 pens or less
@@ -288,8 +354,34 @@ void gfx_element::set_source_clip(u32 xoffs, u32 width, u32 yoffs, u32 height)
 
 void gfx_element::decode(u32 code)
 {
+	// chunky layouts copy whole source bytes; the XOR mask may be changed after the
+	// layout is set, so it is checked here and must not move bits within a byte
+	if (!m_layout_is_raw && (m_layout_fast == LAYOUT_FAST_PACKED) && !(m_layout_xormask & 7))
+	{
+		u8 *dp = m_gfxdata + code * m_char_modulo;
+		int const charoffs = code * m_layout_charincrement + m_layout_planeoffset[0];
+		for (int y = 0; y < m_origheight; y++, dp += m_line_modulo)
+		{
+			int const yoffs = charoffs + m_layout_yoffset[y];
+			if (m_layout_planes == 8)
+			{
+				for (int x = 0; x < m_origwidth; x++)
+					dp[x] = m_srcdata[((yoffs + m_layout_xoffset[x]) ^ m_layout_xormask) / 8];
+			}
+			else
+			{
+				for (int x = 0; x < m_origwidth; x += 2)
+				{
+					u8 const pair = m_srcdata[((yoffs + m_layout_xoffset[x]) ^ m_layout_xormask) / 8];
+					dp[x] = pair >> 4;
+					dp[x + 1] = pair & 0x0f;
+				}
+			}
+		}
+	}
+
 	// don't decode GFX_RAW
-	if (!m_layout_is_raw)
+	else if (!m_layout_is_raw)
 	{
 		// zap the data to 0
 		u8 *decode_base = m_gfxdata + code * m_char_modulo;
@@ -309,8 +401,18 @@ void gfx_element::decode(u32 code)
 				int yoffs = planeoffs + m_layout_yoffset[y];
 				u8 *dp = decode_base + y * m_line_modulo;
 
-				// iterate over columns
-				for (int x = 0; x < m_origwidth; x++)
+				// iterate over columns, a byte at a time where the layout allows it
+				int x = 0;
+				if ((m_layout_fast == LAYOUT_FAST_BYTES) && !(m_layout_xormask & 7))
+				{
+					for ( ; x < (m_origwidth & ~7); x += 8)
+					{
+						auto const &mask = s_expand_bits[m_srcdata[((yoffs + m_layout_xoffset[x]) ^ m_layout_xormask) / 8]];
+						for (int i = 0; i < 8; i++)
+							dp[x + i] |= mask[i] & planebit;
+					}
+				}
+				for ( ; x < m_origwidth; x++)
 					if (readbit(m_srcdata, (yoffs + m_layout_xoffset[x]) ^ m_layout_xormask))
 						dp[x] |= planebit;
 			}
@@ -354,7 +456,7 @@ void gfx_element::opaque(bitmap_ind16 &dest, const rectangle &cliprect,
 {
 	color = colorbase() + granularity() * (color % colors());
 	code %= elements();
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_OPAQUE(destp, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, drawspan_rebase_opaque{ color });
 }
 
 void gfx_element::opaque(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -395,7 +497,7 @@ void gfx_element::transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, drawspan_rebase_transpen{ trans_pen, color });
 }
 
 void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -422,7 +524,7 @@ void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, paldata](u32 &destp, const u8 &srcp) { PIXEL_OP_REMAP_TRANSPEN(destp, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, drawspan_remap_transpen{ trans_pen, paldata });
 }
 
 
@@ -442,7 +544,7 @@ void gfx_element::transpen_raw(bitmap_ind16 &dest, const rectangle &cliprect,
 		return;
 
 	// render
-	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, [trans_pen, color](u16 &destp, const u8 &srcp) { PIXEL_OP_REBASE_TRANSPEN(destp, srcp); });
+	drawgfx_core(dest, cliprect, code, flipx, flipy, destx, desty, drawspan_rebase_transpen{ trans_pen, color });
 }
 
 void gfx_element::transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
@@ -2547,3 +2649,142 @@ void primask_copyrozbitmap_trans(bitmap_rgb32 &dest, const rectangle &cliprect,
 	else
 		copyrozbitmap_core(dest, cliprect, src, startx, starty, incxx, incxy, incyx, incyy, wraparound, priority, [trans_pen, pcode, pmask](u32 &destp, u8 &pri, const u32 &srcp) { PIXEL_OP_COPY_TRANSPEN_PRIMASK(destp, pri, srcp); });
 }
+
+
+
+/***************************************************************************
+    SPRITE LISTS
+***************************************************************************/
+
+/*-------------------------------------------------
+    gfx_sprite_list - constructor
+-------------------------------------------------*/
+
+gfx_sprite_list::gfx_sprite_list()
+	: m_queue(nullptr)
+{
+}
+
+
+/*-------------------------------------------------
+    ~gfx_sprite_list - destructor
+-------------------------------------------------*/
+
+gfx_sprite_list::~gfx_sprite_list()
+{
+	if (m_queue)
+		osd_work_queue_free(m_queue);
+}
+
+
+/*-------------------------------------------------
+    add - append a sprite to the list; scale
+    factors are 16.16 fixed point, and pmask is
+    only used when drawing with a priority bitmap
+-------------------------------------------------*/
+
+void gfx_sprite_list::add(gfx_element &gfx, u32 code, u32 color, int flipx, int flipy, s32 destx, s32 desty, u32 transpen, u32 scalex, u32 scaley, u32 pmask)
+{
+	m_sprites.push_back(sprite{ &gfx, code, color, bool(flipx), bool(flipy), destx, desty, scalex, scaley, pmask, transpen });
+}
+
+
+/*-------------------------------------------------
+    draw - draw all sprites in the list, with
+    or without a priority bitmap
+-------------------------------------------------*/
+
+void gfx_sprite_list::draw(bitmap_ind16 &dest, const rectangle &cliprect)
+{
+	draw_common(dest, cliprect, nullptr);
+}
+
+void gfx_sprite_list::draw(bitmap_rgb32 &dest, const rectangle &cliprect)
+{
+	draw_common(dest, cliprect, nullptr);
+}
+
+void gfx_sprite_list::draw(bitmap_ind16 &dest, const rectangle &cliprect, bitmap_ind8 &priority)
+{
+	draw_common(dest, cliprect, &priority);
+}
+
+void gfx_sprite_list::draw(bitmap_rgb32 &dest, const rectangle &cliprect, bitmap_ind8 &priority)
+{
+	draw_common(dest, cliprect, &priority);
+}
+
+
+/*-------------------------------------------------
+    draw_common - split the draw into bands if
+    it's big enough to be worth it
+-------------------------------------------------*/
+
+template <typename BitmapType>
+void gfx_sprite_list::draw_common(BitmapType &dest, const rectangle &cliprect, bitmap_ind8 *priority)
+{
+	int const bands = std::min<int>(cliprect.height() / DRAW_BAND_MIN_ROWS, DRAW_BANDS_MAX);
+	if ((bands <= 1) || (m_sprites.size() < DRAW_PARALLEL_MIN_SPRITES))
+	{
+		draw_serial(dest, cliprect, priority);
+		return;
+	}
+
+	// elements decode lazily on first use, which mustn't happen on several threads at once
+	for (sprite const &spr : m_sprites)
+		spr.gfx->get_data(spr.code % spr.gfx->elements());
+
+	if (!m_queue)
+		m_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+
+	// divide the rows evenly between the bands
+	draw_band<BitmapType> band[DRAW_BANDS_MAX];
+	int top = cliprect.top();
+	for (int i = 0; i < bands; i++)
+	{
+		int const bottom = cliprect.top() + ((cliprect.height() * (i + 1)) / bands) - 1;
+		band[i].list = this;
+		band[i].dest = &dest;
+		band[i].priority = priority;
+		band[i].cliprect.set(cliprect.left(), cliprect.right(), top, bottom);
+		top = bottom + 1;
+	}
+
+	// queue the bands and help out until they're all done
+	osd_work_item_queue_multiple(m_queue, draw_band_work<BitmapType>, bands, band, sizeof(band[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	while (!osd_work_queue_wait(m_queue, osd_ticks_per_second()))
+	{
+	}
+}
+
+
+/*-------------------------------------------------
+    draw_serial - draw every sprite in order,
+    clipped to the given rectangle
+-------------------------------------------------*/
+
+template <typename BitmapType>
+void gfx_sprite_list::draw_serial(BitmapType &dest, const rectangle &cliprect, bitmap_ind8 *priority)
+{
+	for (sprite const &spr : m_sprites)
+	{
+		if (priority)
+			spr.gfx->prio_zoom_transpen(dest, cliprect, spr.code, spr.color, spr.flipx, spr.flipy, spr.destx, spr.desty, spr.scalex, spr.scaley, *priority, spr.pmask, spr.transpen);
+		else
+			spr.gfx->zoom_transpen(dest, cliprect, spr.code, spr.color, spr.flipx, spr.flipy, spr.destx, spr.desty, spr.scalex, spr.scaley, spr.transpen);
+	}
+}
+
+
+/*-------------------------------------------------
+    draw_band_work - work queue callback for
+    drawing a single band
+-------------------------------------------------*/
+
+template <typename BitmapType>
+void *gfx_sprite_list::draw_band_work(void *param, int threadid)
+{
+	draw_band<BitmapType> const &band = *reinterpret_cast<draw_band<BitmapType> const *>(param);
+	band.list->draw_serial(*band.dest, band.cliprect, band.priority);
+	return nullptr;
+}
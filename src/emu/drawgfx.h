@@ -170,6 +170,7 @@ public:
 
 	// used by tilemaps
 	u32 dirtyseq() const { return m_dirtyseq; }
+	u32 dirtyseq(u32 code) const { return (code < m_dirtystamp.size()) ? m_dirtystamp[code] : 0; }
 
 	// setters
 	void set_layout(const gfx_layout &gl, const u8 *srcdata);
@@ -184,7 +185,7 @@ public:
 	void set_source_clip(u32 xoffs, u32 width, u32 yoffs, u32 height);
 
 	// operations
-	void mark_dirty(u32 code) { if (code < elements()) { m_dirty[code] = 1; m_dirtyseq++; } }
+	void mark_dirty(u32 code) { if (code < elements()) { m_dirty[code] = 1; m_dirtystamp[code] = ++m_dirtyseq; } }
 	void mark_all_dirty() { memset(&m_dirty[0], 1, elements()); }
 
 	const u8 *get_data(u32 code)
@@ -280,8 +281,17 @@ public:
 	void alphatable(bitmap_rgb32 &dest, const rectangle &cliprect, u32 code, u32 color, int flipx, int flipy, s32 destx, s32 desty, int fixedalpha, u8 *alphatable);
 
 private:
+	// decode shortcuts for common layouts
+	enum : u8
+	{
+		LAYOUT_FAST_NONE = 0,   // decode bit by bit
+		LAYOUT_FAST_BYTES,      // each plane holds 8 pixels per byte, left to right
+		LAYOUT_FAST_PACKED      // 4bpp or 8bpp chunky pixels, most significant first
+	};
+
 	// internal helpers
 	void decode(u32 code);
+	u8 classify_layout() const;
 
 	// internal state
 	device_palette_interface *m_palette;    // palette used for drawing (optional when used as a pure decoder)
@@ -308,10 +318,12 @@ private:
 	u8 *            m_gfxdata;              // pointer to decoded pixel data, 8bpp
 	std::vector<u8> m_gfxdata_allocated;    // allocated decoded pixel data, 8bpp
 	std::vector<u8> m_dirty;                // dirty array for detecting chars that need decoding
+	std::vector<u32> m_dirtystamp;          // value of m_dirtyseq when each element was last marked dirty
 	std::vector<u32>  m_pen_usage;      // bitmask of pens that are used (pens 0-31 only)
 
 	bool            m_layout_is_raw;        // raw layout?
 	u8              m_layout_planes;        // bit planes in the layout
+	u8              m_layout_fast;          // LAYOUT_FAST_xxx shortcut usable by decode
 	u32             m_layout_xormask;       // xor mask applied to each bit offset
 	u32             m_layout_charincrement; // per-character increment in source data
 	std::vector<u32>  m_layout_planeoffset;// plane offsets
@@ -320,6 +332,73 @@ private:
 };
 
 
+// ======================> gfx_sprite_list
+
+// a batch of sprites drawn in the order they were added; large batches are
+// split into horizontal bands drawn on work queue threads, and since every
+// pixel still sees the same sprites in the same order the result (including
+// priority bitmap updates) matches drawing them one at a time
+class gfx_sprite_list
+{
+public:
+	// construction/destruction
+	gfx_sprite_list();
+	~gfx_sprite_list();
+
+	// building the list
+	bool empty() const { return m_sprites.empty(); }
+	void reset() { m_sprites.clear(); }
+	void add(gfx_element &gfx, u32 code, u32 color, int flipx, int flipy, s32 destx, s32 desty, u32 transpen, u32 scalex = 0x10000, u32 scaley = 0x10000, u32 pmask = 0);
+
+	// drawing; the list is left intact so it can be drawn again
+	void draw(bitmap_ind16 &dest, const rectangle &cliprect);
+	void draw(bitmap_rgb32 &dest, const rectangle &cliprect);
+	void draw(bitmap_ind16 &dest, const rectangle &cliprect, bitmap_ind8 &priority);
+	void draw(bitmap_rgb32 &dest, const rectangle &cliprect, bitmap_ind8 &priority);
+
+private:
+	// a single queued sprite
+	struct sprite
+	{
+		gfx_element *       gfx;
+		u32                 code;
+		u32                 color;
+		bool                flipx;
+		bool                flipy;
+		s32                 destx;
+		s32                 desty;
+		u32                 scalex;
+		u32                 scaley;
+		u32                 pmask;
+		u32                 transpen;
+	};
+
+	// a horizontal band drawn on a work queue thread
+	template <typename BitmapType>
+	struct draw_band
+	{
+		gfx_sprite_list *   list;
+		BitmapType *        dest;
+		bitmap_ind8 *       priority;
+		rectangle           cliprect;
+	};
+
+	// limits for splitting draws into parallel bands
+	static constexpr int DRAW_BANDS_MAX = 8;
+	static constexpr int DRAW_BAND_MIN_ROWS = 16;
+	static constexpr int DRAW_PARALLEL_MIN_SPRITES = 32;
+
+	// internal helpers
+	template <typename BitmapType> void draw_common(BitmapType &dest, const rectangle &cliprect, bitmap_ind8 *priority);
+	template <typename BitmapType> void draw_serial(BitmapType &dest, const rectangle &cliprect, bitmap_ind8 *priority);
+	template <typename BitmapType> static void *draw_band_work(void *param, int threadid);
+
+	// internal state
+	std::vector<sprite>     m_sprites;              // sprites in drawing order
+	osd_work_queue *        m_queue;                // allocated on first parallel draw
+};
+
+
 /***************************************************************************
     FUNCTION PROTOTYPES
 ***************************************************************************/
@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include "video/drawspan.h"
+
 
 /***************************************************************************
     PIXEL OPERATIONS
@@ -497,6 +499,13 @@ inline void gfx_element::drawgfx_core(BitmapType &dest, const rectangle &cliprec
 				const u8 *srcptr = srcdata;
 				srcdata += dy;
 
+				// let the pixel operation render the whole row if it can
+				if constexpr (drawgfx_has_span<FunctionClass, typename BitmapType::pixel_t, u8>::value)
+				{
+					pixel_op.span(destptr, srcptr, destendx + 1 - destx);
+					continue;
+				}
+
 				// iterate over unrolled blocks of 4
 				for (s32 curx = 0; curx < numblocks; curx++)
 				{
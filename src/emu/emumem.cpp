@@ -14,6 +14,8 @@
 #include "emuopts.h"
 #include "debug/debugcpu.h"
 
+#include "osdfile.h"
+
 #include "emumem_mud.h"
 #include "emumem_hea.h"
 #include "emumem_hem.h"
@@ -43,6 +45,88 @@ template <typename Format, typename... Params> static void VPRINTF(Format &&, Pa
 
 #define VALIDATE_REFCOUNTS 0
 
+namespace {
+
+// pool of small blocks for handler entries, kept per thread so that address
+// map construction on different machines never contends
+class handler_pool
+{
+public:
+	static constexpr std::size_t GRANULE = 16;
+	static constexpr std::size_t CLASSES = 16;
+	static constexpr std::size_t CHUNK_BYTES = 64 * 1024;
+
+	~handler_pool()
+	{
+		// blocks still in use (or freed on another thread) keep their chunks alive
+		if (!m_live)
+			for (void *chunk : m_chunks)
+				::operator delete(chunk);
+	}
+
+	void *alloc(std::size_t size)
+	{
+		std::size_t const bucket = (size + GRANULE - 1) / GRANULE;
+		if (!bucket || bucket > CLASSES)
+			return ::operator new(size);
+
+		m_live++;
+		if (free_block *const block = m_free[bucket - 1])
+		{
+			m_free[bucket - 1] = block->next;
+			return block;
+		}
+
+		std::size_t const bytes = bucket * GRANULE;
+		if (m_left < bytes)
+		{
+			m_next = reinterpret_cast<u8 *>(::operator new(CHUNK_BYTES));
+			m_left = CHUNK_BYTES;
+			m_chunks.emplace_back(m_next);
+		}
+		void *const result = m_next;
+		m_next += bytes;
+		m_left -= bytes;
+		return result;
+	}
+
+	void release(void *ptr, std::size_t size)
+	{
+		std::size_t const bucket = (size + GRANULE - 1) / GRANULE;
+		if (!bucket || bucket > CLASSES)
+			return ::operator delete(ptr);
+
+		m_live--;
+		free_block *const block = reinterpret_cast<free_block *>(ptr);
+		block->next = m_free[bucket - 1];
+		m_free[bucket - 1] = block;
+	}
+
+private:
+	struct free_block { free_block *next; };
+
+	free_block *        m_free[CLASSES] = { };
+	std::vector<void *> m_chunks;
+	u8 *                m_next = nullptr;
+	std::size_t         m_left = 0;
+	std::ptrdiff_t      m_live = 0;
+};
+
+thread_local handler_pool s_handler_pool;
+
+} // anonymous namespace
+
+void *handler_entry::operator new(std::size_t size)
+{
+	return s_handler_pool.alloc(size);
+}
+
+void handler_entry::operator delete(void *ptr, std::size_t size)
+{
+	if (ptr)
+		s_handler_pool.release(ptr, size);
+}
+
 offs_t handler_entry::dispatch_entry(offs_t address) const
 {
 	fatalerror("dispatch_entry called on non-dispatching class\n");
@@ -332,6 +416,22 @@ memory_region *memory_manager::region_alloc(std::string name, u32 length, u8 wid
 }
 
 
+//-------------------------------------------------
+//  region_alloc - creates a region backed by a
+//  copy-on-write mapping of a file
+//-------------------------------------------------
+
+memory_region *memory_manager::region_alloc(std::string name, u32 length, u8 width, endianness_t endian, std::unique_ptr<osd_file> &&mapping, u8 *data)
+{
+	// make sure we don't have a region of the same name; also find the end of the list
+	if (m_regionlist.find(name) != m_regionlist.end())
+		fatalerror("region_alloc called with duplicate region name \"%s\"\n", name);
+
+	// allocate the region
+	return m_regionlist.emplace(name, std::make_unique<memory_region>(machine(), name, length, width, endian, std::move(mapping), data)).first->second.get();
+}
+
+
 //-------------------------------------------------
 //  region_find - find a region by name
 //-------------------------------------------------
@@ -1070,6 +1170,8 @@ memory_region::memory_region(running_machine &machine, std::string name, u32 len
 	: m_machine(machine),
 		m_name(std::move(name)),
 		m_buffer(length),
+		m_base(length ? m_buffer.data() : nullptr),
+		m_length(length),
 		m_endianness(endian),
 		m_bitwidth(width * 8),
 		m_bytewidth(width)
@@ -1077,6 +1179,23 @@ memory_region::memory_region(running_machine &machine, std::string name, u32 len
 	assert(width == 1 || width == 2 || width == 4 || width == 8);
 }
 
+memory_region::memory_region(running_machine &machine, std::string name, u32 length, u8 width, endianness_t endian, std::unique_ptr<osd_file> &&mapping, u8 *data)
+	: m_machine(machine),
+		m_name(std::move(name)),
+		m_mapping(std::move(mapping)),
+		m_base(data),
+		m_length(length),
+		m_endianness(endian),
+		m_bitwidth(width * 8),
+		m_bytewidth(width)
+{
+	assert(width == 1 || width == 2 || width == 4 || width == 8);
+}
+
+memory_region::~memory_region()
+{
+}
+
 std::string memory_share::compare(u8 width, size_t bytes, endianness_t endianness) const
 {
 	if (width != m_bitwidth)
@@ -1089,3 +1208,169 @@ std::string memory_share::compare(u8 width, size_t bytes, endianness_t endiannes
 								   m_endianness == ENDIANNESS_LITTLE ? "little" : "big");
 	return "";
 }
+
+
+//**************************************************************************
+//  MEMORY HEATMAP
+//**************************************************************************
+
+//-------------------------------------------------
+//  memory_heatmap - constructor
+//-------------------------------------------------
+
+memory_heatmap::memory_heatmap(address_space &space)
+	: m_space(space),
+		m_page_shift(std::max(space.addr_width() - 16, 0)),
+		m_page_reads((space.addrmask() >> m_page_shift) + 1, 0),
+		m_page_writes((space.addrmask() >> m_page_shift) + 1, 0),
+		m_installing(false)
+{
+	m_notifier = m_space.add_change_notifier(
+			[this] (read_or_write mode)
+			{
+				if (!m_installing)
+					rebuild();
+			});
+	rebuild();
+}
+
+
+//-------------------------------------------------
+//  ~memory_heatmap - destructor
+//-------------------------------------------------
+
+memory_heatmap::~memory_heatmap()
+{
+	m_notifier.reset();
+	m_installing = true;
+	m_tap.remove();
+}
+
+
+//-------------------------------------------------
+//  reset - zero all counters
+//-------------------------------------------------
+
+void memory_heatmap::reset()
+{
+	std::fill(m_page_reads.begin(), m_page_reads.end(), 0);
+	std::fill(m_page_writes.begin(), m_page_writes.end(), 0);
+	for (handler_count &handler : m_handler_reads)
+		handler.count = 0;
+	for (handler_count &handler : m_handler_writes)
+		handler.count = 0;
+}
+
+
+//-------------------------------------------------
+//  install - install the counting tap over the
+//  whole space
+//-------------------------------------------------
+
+template<typename uX> void memory_heatmap::install()
+{
+	m_tap = m_space.install_readwrite_tap(
+			0, m_space.addrmask(), "heatmap",
+			[this] (offs_t offset, uX &data, uX mem_mask)
+			{
+				offset &= m_space.addrmask();
+				m_page_reads[offset >> m_page_shift]++;
+				count(m_handler_reads, m_visible_reads, offset);
+			},
+			[this] (offs_t offset, uX &data, uX mem_mask)
+			{
+				offset &= m_space.addrmask();
+				m_page_writes[offset >> m_page_shift]++;
+				count(m_handler_writes, m_visible_writes, offset);
+			},
+			&m_tap);
+}
+
+
+//-------------------------------------------------
+//  rebuild - take a new snapshot of the handlers
+//  and reinstall the tap after a map change
+//-------------------------------------------------
+
+void memory_heatmap::rebuild()
+{
+	m_installing = true;
+	m_tap.remove();
+
+	// the tap is out of the way, so the maps show the real handlers
+	std::vector<memory_entry> read_map, write_map;
+	m_space.dump_maps(read_map, write_map);
+	snapshot(read_map, m_handler_reads, m_read_index, m_visible_reads);
+	snapshot(write_map, m_handler_writes, m_write_index, m_visible_writes);
+
+	switch (m_space.data_width())
+	{
+	case  8: install<u8>();  break;
+	case 16: install<u16>(); break;
+	case 32: install<u32>(); break;
+	case 64: install<u64>(); break;
+	}
+	m_installing = false;
+}
+
+
+//-------------------------------------------------
+//  snapshot - record the ranges of the handlers
+//  currently visible, keeping the counters of
+//  handlers seen before
+//-------------------------------------------------
+
+void memory_heatmap::snapshot(const std::vector<memory_entry> &map, std::vector<handler_count> &handlers, handler_index &index, std::vector<visible_range> &visible)
+{
+	// collect the selected handlers, merging adjacent pieces of the same one
+	std::vector<handler_count> current;
+	for (const memory_entry &entry : map)
+	{
+		bool selected = true;
+		for (const memory_entry_context &context : entry.context)
+		{
+			std::optional<int> const slot = context.view->entry();
+			if (context.disabled ? bool(slot) : (!slot || (*slot != context.slot)))
+				selected = false;
+		}
+		if (!selected)
+			continue;
+
+		std::string name = entry.entry->name();
+		if (!current.empty() && (current.back().end + 1 == entry.start) && (current.back().name == name))
+			current.back().end = entry.end;
+		else
+			current.emplace_back(handler_count{ entry.start, entry.end, std::move(name), 0 });
+	}
+
+	// find or allocate a counter for each of them
+	visible.clear();
+	for (handler_count &handler : current)
+	{
+		auto const found = index.emplace(std::make_tuple(handler.start, handler.end, handler.name), handlers.size());
+		if (found.second)
+			handlers.emplace_back(std::move(handler));
+		visible.emplace_back(visible_range{ std::get<0>(found.first->first), std::get<1>(found.first->first), found.first->second });
+	}
+	std::sort(
+			visible.begin(),
+			visible.end(),
+			[] (const visible_range &a, const visible_range &b) { return a.start < b.start; });
+}
+
+
+//-------------------------------------------------
+//  count - count an access against the handler
+//  covering an address
+//-------------------------------------------------
+
+void memory_heatmap::count(std::vector<handler_count> &handlers, const std::vector<visible_range> &visible, offs_t address)
+{
+	auto const found = std::upper_bound(
+			visible.begin(),
+			visible.end(),
+			address,
+			[] (offs_t addr, const visible_range &range) { return addr < range.start; });
+	if ((found != visible.begin()) && (address <= std::prev(found)->end))
+		handlers[std::prev(found)->index].count++;
+}
@@ -19,8 +19,10 @@
 
 #include "notifier.h"
 
+#include <map>
 #include <optional>
 #include <set>
+#include <tuple>
 #include <type_traits>
 
 using s8 = std::int8_t;
@@ -56,6 +58,7 @@ enum class read_or_write
 //  FORWARD DECLARATIONS
 //**************************************************************************
 
+class osd_file;
 class handler_entry;
 template<int Width, int AddrShift> class handler_entry_read_passthrough;
 template<int Width, int AddrShift> class handler_entry_write_passthrough;
@@ -591,6 +594,7 @@ public:
 	static constexpr u32 F_DISPATCH    = 0x00020000;     // handler that forwards the access to other handlers
 	static constexpr u32 F_UNITS       = 0x00040000;     // handler that merges/splits an access among multiple handlers (unitmask support)
 	static constexpr u32 F_VIEW        = 0x00080000;     // handler for a view (kinda like dispatch except not entirely)
+	static constexpr u32 F_FIXED       = 0x00100000;     // handler accessing fixed host memory (non-banked rom or ram)
 	static constexpr u32 F_PT_BITS     = 24;             // position of the 4-bit priority for a passthrough handler.  The highest the priority the earlier it is called in the chain. 0 = not passthrough
 	static constexpr u32 F_PT_REPLACE  = 1 << F_PT_BITS; // a passthrough with a odd priority can only happen once in a path
 
@@ -617,6 +621,11 @@ public:
 	handler_entry(address_space *space, u32 flags) { m_space = space; m_refcount = 1; m_flags = flags; }
 	virtual ~handler_entry() {}
 
+	// handlers are small and get created and destroyed in bulk on every
+	// remap, so they come from per-size free lists carved out of large chunks
+	static void *operator new(std::size_t size);
+	static void operator delete(void *ptr, std::size_t size);
+
 	inline void ref(int count = 1) const { m_refcount += count; }
 	inline void unref(int count = 1) const { m_refcount -= count; if(!m_refcount) delete this; }
 	inline u32 flags() const { return m_flags; }
@@ -624,6 +633,7 @@ public:
 	inline bool is_dispatch() const { return m_flags & F_DISPATCH; }
 	inline bool is_view() const { return m_flags & F_VIEW; }
 	inline bool is_units() const { return m_flags & F_UNITS; }
+	inline bool is_fixed() const { return m_flags & F_FIXED; }
 	inline bool is_passthrough() const { return f_get_pt() != 0; }
 	inline u32 f_get_pt() const { return (m_flags >> F_PT_BITS) & 15; }
 
@@ -1701,6 +1711,27 @@ template<int Level, int Width, int AddrShift> void dispatch_write_interruptible(
 
 namespace emu::detail {
 
+// returns the host pointer for the start of a range if the handler it
+// resolves to is fixed memory laid out linearly over the whole range,
+// nullptr otherwise
+template<int Width, int AddrShift, typename Handler> handler_entry_size_t<Width> *handler_direct_base(const Handler &handler, offs_t start, offs_t end)
+{
+	if constexpr(Width + AddrShift < 0)
+		return nullptr;
+	else
+	{
+		constexpr offs_t native_mask = make_bitmask<offs_t>(Width + AddrShift);
+		if(!handler.is_fixed() || (start & native_mask))
+			return nullptr;
+
+		auto *const first = reinterpret_cast<handler_entry_size_t<Width> *>(handler.get_ptr(start));
+		auto *const last = reinterpret_cast<handler_entry_size_t<Width> *>(handler.get_ptr(end & ~native_mask));
+		if((last - first) != std::ptrdiff_t((end - start) >> (Width + AddrShift)))
+			return nullptr;
+		return first;
+	}
+}
+
 template<int Level, int Width, int AddrShift, endianness_t Endian> class memory_access_specific
 {
 	friend class ::address_space;
@@ -1715,7 +1746,10 @@ public:
 		: m_space(nullptr),
 		  m_addrmask(0),
 		  m_dispatch_read(nullptr),
-		  m_dispatch_write(nullptr)
+		  m_dispatch_write(nullptr),
+		  m_root_read(nullptr),
+		  m_root_write(nullptr),
+		  m_direct_generation(~u32(0))
 	{
 	}
 
@@ -1824,6 +1858,20 @@ public:
 	}
 
 private:
+	// small direct-mapped table of pages backed by fixed ram/rom, so that
+	// the common case of a memory access skips the handler dispatch
+	static constexpr int    DIRECT_SHIFT = Width + AddrShift;
+	static constexpr u32    DIRECT_PAGE_BITS = 12;
+	static constexpr offs_t DIRECT_PAGE_MASK = make_bitmask<offs_t>(DIRECT_PAGE_BITS);
+	static constexpr u32    DIRECT_ENTRIES = 64;
+	static constexpr offs_t DIRECT_INVALID = ~offs_t(0);
+
+	struct direct_page
+	{
+		offs_t      page;   // address >> DIRECT_PAGE_BITS, DIRECT_INVALID if empty
+		NativeType *base;   // host memory for the start of the page, nullptr to dispatch
+	};
+
 	address_space *             m_space;
 
 	offs_t                      m_addrmask;                // address mask
@@ -1831,13 +1879,19 @@ private:
 	const handler_entry_read<Width, AddrShift> *const *m_dispatch_read;
 	const handler_entry_write<Width, AddrShift> *const *m_dispatch_write;
 
-	NativeType read_native(offs_t address, NativeType mask = ~NativeType(0)) {
-		return dispatch_read<Level, Width, AddrShift>(offs_t(-1), address & m_addrmask, mask, m_dispatch_read);
-	}
+	handler_entry_read <Width, AddrShift> *m_root_read;  // decode tree roots
+	handler_entry_write<Width, AddrShift> *m_root_write;
 
-	void write_native(offs_t address, NativeType data, NativeType mask = ~NativeType(0)) {
-		dispatch_write<Level, Width, AddrShift>(offs_t(-1), address & m_addrmask, data, mask, m_dispatch_write);
-	}
+	direct_page                 m_direct_read[DIRECT_ENTRIES];
+	direct_page                 m_direct_write[DIRECT_ENTRIES];
+	u32                         m_direct_generation;       // address space change count the pages are valid for
+
+	NativeType read_native(offs_t address, NativeType mask = ~NativeType(0));
+	void write_native(offs_t address, NativeType data, NativeType mask = ~NativeType(0));
+
+	NativeType *fill_direct_read(offs_t address);
+	NativeType *fill_direct_write(offs_t address);
+	void flush_direct();
 
 	std::pair<NativeType, u16> read_native_flags(offs_t address, NativeType mask = ~NativeType(0)) {
 		return dispatch_read_flags<Level, Width, AddrShift>(offs_t(-1), address & m_addrmask, mask, m_dispatch_read);
@@ -1855,7 +1909,7 @@ private:
 		return dispatch_lookup_write_flags<Level, Width, AddrShift>(offs_t(-1), address & m_addrmask, mask, m_dispatch_write);
 	}
 
-	void set(address_space *space, std::pair<const void *, const void *> rw);
+	void set(address_space *space, std::pair<const void *, const void *> rw, std::pair<void *, void *> roots);
 };
 
 
@@ -1882,6 +1936,8 @@ public:
 		  m_addrend_w(0),
 		  m_cache_r(nullptr),
 		  m_cache_w(nullptr),
+		  m_direct_r(nullptr),
+		  m_direct_w(nullptr),
 		  m_root_read(nullptr),
 		  m_root_write(nullptr)
 	{
@@ -1894,12 +1950,14 @@ public:
 		if(address >= m_addrstart_r && address <= m_addrend_r)
 			return;
 		m_root_read->lookup(address, m_addrstart_r, m_addrend_r, m_cache_r);
+		m_direct_r = handler_direct_base<Width, AddrShift>(*m_cache_r, m_addrstart_r, m_addrend_r);
 	}
 
 	void check_address_w(offs_t address) {
 		if(address >= m_addrstart_w && address <= m_addrend_w)
 			return;
 		m_root_write->lookup(address, m_addrstart_w, m_addrend_w, m_cache_w);
+		m_direct_w = handler_direct_base<Width, AddrShift>(*m_cache_w, m_addrstart_w, m_addrend_w);
 	}
 
 	// accessor methods
@@ -2017,6 +2075,8 @@ private:
 	offs_t                      m_addrend_w;               // maximum valid address for writing
 	handler_entry_read <Width, AddrShift> *m_cache_r;  // read cache
 	handler_entry_write<Width, AddrShift> *m_cache_w;  // write cache
+	NativeType *                m_direct_r;            // host memory for m_addrstart_r if m_cache_r is fixed memory
+	NativeType *                m_direct_w;            // host memory for m_addrstart_w if m_cache_w is fixed memory
 
 	handler_entry_read <Width, AddrShift> *m_root_read;  // decode tree roots
 	handler_entry_write<Width, AddrShift> *m_root_write;
@@ -2330,6 +2390,8 @@ protected:
 	u8                          m_logaddrchars;     // number of characters to use for logical addresses
 };
 
+class memory_heatmap;
+
 // address_space holds live information about an address space
 class address_space : public address_space_installer
 {
@@ -2374,13 +2436,16 @@ public:
 			fatalerror("Requesting spefific() with endianness %s while the config says %s\n",
 					   util::endian_to_string_view(Endian), util::endian_to_string_view(m_config.endianness()));
 
-		v.set(this, get_specific_info());
+		v.set(this, get_specific_info(), get_cache_info());
 	}
 
 	util::notifier_subscription add_change_notifier(delegate<void (read_or_write)> &&n);
 	template <typename T> util::notifier_subscription add_change_notifier(T &&n) { return add_change_notifier(delegate<void (read_or_write)>(std::forward<T>(n))); }
 
+	u32 cache_generation() const { return m_cache_generation; }
+
 	void invalidate_caches(read_or_write mode) {
+		m_cache_generation++;
 		if(u32(mode) & ~m_in_notification) {
 			u32 old = m_in_notification;
 			m_in_notification |= u32(mode);
@@ -2399,6 +2464,10 @@ public:
 	std::shared_ptr<emu::detail::memory_passthrough_handler_impl> make_mph(memory_passthrough_handler *mph);
 	std::shared_ptr<emu::detail::memory_passthrough_handler_impl> get_default_mpl() { return m_default_mpl; }
 
+	// access counting
+	memory_heatmap *heatmap() const { return m_heatmap.get(); }
+	void set_heatmap_enabled(bool enable);
+
 	// debug helpers
 	virtual std::string get_handler_string(read_or_write readorwrite, offs_t byteaddress) const = 0;
 	virtual void dump_maps(std::vector<memory_entry> &read_map, std::vector<memory_entry> &write_map) const = 0;
@@ -2440,6 +2509,18 @@ public:
 	virtual void write_qword_unaligned(offs_t address, u64 data) = 0;
 	virtual void write_qword_unaligned(offs_t address, u64 data, u64 mask) = 0;
 
+	// block accessors, for count consecutive aligned elements of 1 << width bytes
+	virtual void read_block(offs_t address, int width, void *dest, u32 count) = 0;
+	virtual void write_block(offs_t address, int width, const void *src, u32 count) = 0;
+	void read_block(offs_t address, u8 *dest, u32 count) { read_block(address, 0, dest, count); }
+	void read_block(offs_t address, u16 *dest, u32 count) { read_block(address, 1, dest, count); }
+	void read_block(offs_t address, u32 *dest, u32 count) { read_block(address, 2, dest, count); }
+	void read_block(offs_t address, u64 *dest, u32 count) { read_block(address, 3, dest, count); }
+	void write_block(offs_t address, const u8 *src, u32 count) { write_block(address, 0, src, count); }
+	void write_block(offs_t address, const u16 *src, u32 count) { write_block(address, 1, src, count); }
+	void write_block(offs_t address, const u32 *src, u32 count) { write_block(address, 2, src, count); }
+	void write_block(offs_t address, const u64 *src, u32 count) { write_block(address, 3, src, count); }
+
 	// setup
 	void prepare_map();
 	void prepare_device_map(address_map &map);
@@ -2478,9 +2559,71 @@ protected:
 
 	util::notifier<read_or_write> m_notifiers;  // notifier list for address map change
 	u32                     m_in_notification;  // notification(s) currently being done
+	u32                     m_cache_generation; // incremented on every address map change
 
 	// passthrough handler used for wait states
 	std::shared_ptr<emu::detail::memory_passthrough_handler_impl> m_default_mpl;
+
+	std::unique_ptr<memory_heatmap> m_heatmap;  // access counters, when enabled
+};
+
+
+// ======================> memory_heatmap
+
+// counts accesses per handler and per page of an address space; it is
+// installed as a tap over the whole space, so it costs nothing until enabled
+class memory_heatmap
+{
+public:
+	struct handler_count
+	{
+		offs_t start, end;
+		std::string name;
+		u64 count;
+	};
+
+	// construction/destruction
+	memory_heatmap(address_space &space);
+	~memory_heatmap();
+
+	// getters
+	address_space &space() const { return m_space; }
+	int page_shift() const { return m_page_shift; }
+	const std::vector<u64> &page_reads() const { return m_page_reads; }
+	const std::vector<u64> &page_writes() const { return m_page_writes; }
+	const std::vector<handler_count> &handler_reads() const { return m_handler_reads; }
+	const std::vector<handler_count> &handler_writes() const { return m_handler_writes; }
+
+	// zero all counters
+	void reset();
+
+private:
+	struct visible_range
+	{
+		offs_t start, end;
+		std::size_t index;
+	};
+
+	using handler_index = std::map<std::tuple<offs_t, offs_t, std::string>, std::size_t>;
+
+	template<typename uX> void install();
+	void rebuild();
+	static void snapshot(const std::vector<memory_entry> &map, std::vector<handler_count> &handlers, handler_index &index, std::vector<visible_range> &visible);
+	static void count(std::vector<handler_count> &handlers, const std::vector<visible_range> &visible, offs_t address);
+
+	address_space &             m_space;            // space being counted
+	int                         m_page_shift;       // address bits per page
+	std::vector<u64>            m_page_reads;       // reads per page
+	std::vector<u64>            m_page_writes;      // writes per page
+	std::vector<handler_count>  m_handler_reads;    // reads per read handler ever seen
+	std::vector<handler_count>  m_handler_writes;   // writes per write handler ever seen
+	std::vector<visible_range>  m_visible_reads;    // currently installed read handlers, sorted
+	std::vector<visible_range>  m_visible_writes;   // currently installed write handlers, sorted
+	handler_index               m_read_index;       // read counter lookup by range and name
+	handler_index               m_write_index;      // write counter lookup by range and name
+	memory_passthrough_handler  m_tap;              // counting tap
+	util::notifier_subscription m_notifier;         // address map change notifier
+	bool                        m_installing;       // prevent recursive installs
 };
 
 
@@ -2566,12 +2709,15 @@ class memory_region
 public:
 	// construction/destruction
 	memory_region(running_machine &machine, std::string name, u32 length, u8 width, endianness_t endian);
+	memory_region(running_machine &machine, std::string name, u32 length, u8 width, endianness_t endian, std::unique_ptr<osd_file> &&mapping, u8 *data);
+	~memory_region();
 
 	// getters
 	running_machine &machine() const { return m_machine; }
-	u8 *base() { return (m_buffer.size() > 0) ? &m_buffer[0] : nullptr; }
-	u8 *end() { return base() + m_buffer.size(); }
-	u32 bytes() const { return m_buffer.size(); }
+	u8 *base() { return m_base; }
+	u8 *end() { return base() + m_length; }
+	u32 bytes() const { return m_length; }
+	bool mapped() const { return bool(m_mapping); }
 	const std::string &name() const { return m_name; }
 
 	// flag expansion
@@ -2580,7 +2726,7 @@ public:
 	u8 bytewidth() const { return m_bytewidth; }
 
 	// data access
-	u8 &as_u8(offs_t offset = 0) { return m_buffer[offset]; }
+	u8 &as_u8(offs_t offset = 0) { return m_base[offset]; }
 	u16 &as_u16(offs_t offset = 0) { return reinterpret_cast<u16 *>(base())[offset]; }
 	u32 &as_u32(offs_t offset = 0) { return reinterpret_cast<u32 *>(base())[offset]; }
 	u64 &as_u64(offs_t offset = 0) { return reinterpret_cast<u64 *>(base())[offset]; }
@@ -2590,6 +2736,9 @@ private:
 	running_machine &       m_machine;
 	std::string             m_name;
 	std::vector<u8>         m_buffer;
+	std::unique_ptr<osd_file> m_mapping;    // file mapped copy-on-write in place of the buffer
+	u8 *                    m_base;
+	u32                     m_length;
 	endianness_t            m_endianness;
 	u8                      m_bitwidth;
 	u8                      m_bytewidth;
@@ -2655,6 +2804,7 @@ private:
 	device_t &                                      m_device;
 	std::string                                     m_name;
 	std::map<int, int>                              m_entry_mapping;
+	std::vector<int>                                m_slot_ids;      // dense copy of m_entry_mapping for small slot numbers
 	std::vector<std::unique_ptr<memory_view_entry>> m_entries;
 	const address_space_config *                    m_config;
 	offs_t                                          m_addrstart;
@@ -2711,6 +2861,7 @@ public:
 
 	// regions
 	memory_region *region_alloc(std::string name, u32 length, u8 width, endianness_t endian);
+	memory_region *region_alloc(std::string name, u32 length, u8 width, endianness_t endian, std::unique_ptr<osd_file> &&mapping, u8 *data);
 	memory_region *region_find(std::string name);
 	void region_free(std::string name);
 
@@ -2773,6 +2924,9 @@ read_native(offs_t address, emu::detail::handler_entry_size_t<Width> mask)
 {
 	address &= m_addrmask;
 	check_address_r(address);
+	if constexpr(Width + AddrShift >= 0)
+		if(m_direct_r)
+			return m_direct_r[(address - m_addrstart_r) >> (Width + AddrShift)];
 	return m_cache_r->read(address, mask);
 }
 
@@ -2782,6 +2936,12 @@ write_native(offs_t address, emu::detail::handler_entry_size_t<Width> data, emu:
 {
 	address &= m_addrmask;
 	check_address_w(address);
+	if constexpr(Width + AddrShift >= 0)
+		if(m_direct_w) {
+			auto &target = m_direct_w[(address - m_addrstart_w) >> (Width + AddrShift)];
+			target = (target & ~mask) | (data & mask);
+			return;
+		}
 	m_cache_w->write(address, data, mask);
 }
 
@@ -2793,12 +2953,107 @@ inline void emu::detail::memory_passthrough_handler_impl::remove()
 
 template<int Level, int Width, int AddrShift, endianness_t Endian>
 void emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
-set(address_space *space, std::pair<const void *, const void *> rw)
+set(address_space *space, std::pair<const void *, const void *> rw, std::pair<void *, void *> roots)
 {
 	m_space = space;
 	m_addrmask = space->addrmask();
 	m_dispatch_read  = (const handler_entry_read <Width, AddrShift> *const *)(rw.first);
 	m_dispatch_write = (const handler_entry_write<Width, AddrShift> *const *)(rw.second);
+
+	m_root_read  = (handler_entry_read <Width, AddrShift> *)(roots.first);
+	m_root_write = (handler_entry_write<Width, AddrShift> *)(roots.second);
+
+	flush_direct();
+}
+
+
+template<int Level, int Width, int AddrShift, endianness_t Endian>
+void emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
+flush_direct()
+{
+	for(direct_page &entry : m_direct_read)
+		entry = direct_page{ DIRECT_INVALID, nullptr };
+	for(direct_page &entry : m_direct_write)
+		entry = direct_page{ DIRECT_INVALID, nullptr };
+	m_direct_generation = m_space->cache_generation();
+}
+
+
+template<int Level, int Width, int AddrShift, endianness_t Endian>
+inline emu::detail::handler_entry_size_t<Width>
+emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
+read_native(offs_t address, emu::detail::handler_entry_size_t<Width> mask)
+{
+	address &= m_addrmask;
+	if constexpr(DIRECT_SHIFT >= 0) {
+		if(UNEXPECTED(m_direct_generation != m_space->cache_generation()))
+			flush_direct();
+		direct_page const &entry = m_direct_read[(address >> DIRECT_PAGE_BITS) & (DIRECT_ENTRIES - 1)];
+		NativeType *base = entry.base;
+		if(UNEXPECTED(entry.page != (address >> DIRECT_PAGE_BITS)))
+			base = fill_direct_read(address);
+		if(base)
+			return base[(address & DIRECT_PAGE_MASK) >> DIRECT_SHIFT];
+	}
+	return dispatch_read<Level, Width, AddrShift>(offs_t(-1), address, mask, m_dispatch_read);
+}
+
+
+template<int Level, int Width, int AddrShift, endianness_t Endian>
+inline void emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
+write_native(offs_t address, emu::detail::handler_entry_size_t<Width> data, emu::detail::handler_entry_size_t<Width> mask)
+{
+	address &= m_addrmask;
+	if constexpr(DIRECT_SHIFT >= 0) {
+		if(UNEXPECTED(m_direct_generation != m_space->cache_generation()))
+			flush_direct();
+		direct_page const &entry = m_direct_write[(address >> DIRECT_PAGE_BITS) & (DIRECT_ENTRIES - 1)];
+		NativeType *base = entry.base;
+		if(UNEXPECTED(entry.page != (address >> DIRECT_PAGE_BITS)))
+			base = fill_direct_write(address);
+		if(base) {
+			NativeType &target = base[(address & DIRECT_PAGE_MASK) >> DIRECT_SHIFT];
+			target = (target & ~mask) | (data & mask);
+			return;
+		}
+	}
+	dispatch_write<Level, Width, AddrShift>(offs_t(-1), address, data, mask, m_dispatch_write);
+}
+
+
+template<int Level, int Width, int AddrShift, endianness_t Endian>
+emu::detail::handler_entry_size_t<Width> *
+emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
+fill_direct_read(offs_t address)
+{
+	offs_t const pstart = address & ~DIRECT_PAGE_MASK;
+	offs_t const pend = std::min<offs_t>(pstart | DIRECT_PAGE_MASK, m_addrmask);
+	offs_t start, end;
+	handler_entry_read<Width, AddrShift> *handler;
+	m_root_read->lookup(address, start, end, handler);
+
+	direct_page &entry = m_direct_read[(address >> DIRECT_PAGE_BITS) & (DIRECT_ENTRIES - 1)];
+	entry.page = address >> DIRECT_PAGE_BITS;
+	entry.base = (start <= pstart && end >= pend) ? handler_direct_base<Width, AddrShift>(*handler, pstart, pend) : nullptr;
+	return entry.base;
+}
+
+
+template<int Level, int Width, int AddrShift, endianness_t Endian>
+emu::detail::handler_entry_size_t<Width> *
+emu::detail::memory_access_specific<Level, Width, AddrShift, Endian>::
+fill_direct_write(offs_t address)
+{
+	offs_t const pstart = address & ~DIRECT_PAGE_MASK;
+	offs_t const pend = std::min<offs_t>(pstart | DIRECT_PAGE_MASK, m_addrmask);
+	offs_t start, end;
+	handler_entry_write<Width, AddrShift> *handler;
+	m_root_write->lookup(address, start, end, handler);
+
+	direct_page &entry = m_direct_write[(address >> DIRECT_PAGE_BITS) & (DIRECT_ENTRIES - 1)];
+	entry.page = address >> DIRECT_PAGE_BITS;
+	entry.base = (start <= pstart && end >= pend) ? handler_direct_base<Width, AddrShift>(*handler, pstart, pend) : nullptr;
+	return entry.base;
 }
 
 
@@ -2815,11 +3070,13 @@ set(address_space *space, std::pair<void *, void *> rw)
 				   m_addrend_r = 0;
 				   m_addrstart_r = 1;
 				   m_cache_r = nullptr;
+				   m_direct_r = nullptr;
 			   }
 			   if(u32(mode) & u32(read_or_write::WRITE)) {
 				   m_addrend_w = 0;
 				   m_addrstart_w = 1;
 				   m_cache_w = nullptr;
+				   m_direct_w = nullptr;
 			   }
 		   });
 	m_root_read  = (handler_entry_read <Width, AddrShift> *)(rw.first);
@@ -2829,9 +3086,11 @@ set(address_space *space, std::pair<void *, void *> rw)
 	m_addrstart_r = 1;
 	m_addrend_r = 0;
 	m_cache_r = nullptr;
+	m_direct_r = nullptr;
 	m_addrstart_w = 1;
 	m_addrend_w = 0;
 	m_cache_w = nullptr;
+	m_direct_w = nullptr;
 }
 
 template<int Width, int AddrShift, endianness_t Endian>
@@ -262,6 +262,7 @@ public:
 	}
 
 	virtual ~address_space_specific() {
+		m_heatmap.reset();
 		m_root_read ->unref();
 		m_root_write->unref();
 	}
@@ -397,6 +398,97 @@ public:
 	void write_qword_unaligned(offs_t address, u64 data) override { memory_write_generic<Width, AddrShift, Endian, 3, false>(wop(), address, data, 0xffffffffffffffffU); }
 	void write_qword_unaligned(offs_t address, u64 data, u64 mask) override { memory_write_generic<Width, AddrShift, Endian, 3, false>(wop(), address, data, mask); }
 
+	// block transfers: native-width runs are resolved one handler at a time
+	// and copied directly when the handler covers plain memory
+	void read_block(offs_t address, int width, void *dest, u32 count) override
+	{
+		if constexpr(Width + AddrShift >= 0)
+		{
+			if((width == Width) && !(address & NATIVE_MASK))
+			{
+				constexpr int shift = Width + AddrShift;
+				NativeType *target = reinterpret_cast<NativeType *>(dest);
+				while(count)
+				{
+					address &= m_addrmask;
+					offs_t start, end;
+					handler_entry_read<Width, AddrShift> *handler;
+					m_root_read->lookup(address, start, end, handler);
+
+					u32 const run = std::min<u32>(count, ((end - address) >> shift) + 1);
+					NativeType const *const base = emu::detail::handler_direct_base<Width, AddrShift>(*handler, start, end);
+					if(base)
+						std::copy_n(base + ((address - start) >> shift), run, target);
+					else
+						for(u32 i = 0; i != run; i++)
+							target[i] = read_native(address + (i << shift));
+					target += run;
+					count -= run;
+					address += offs_t(run) << shift;
+				}
+				return;
+			}
+		}
+
+		offs_t const step = block_step(width);
+		switch(width)
+		{
+		case 0: for(u32 i = 0; i != count; i++, address += step) reinterpret_cast<u8 *>(dest)[i] = read_byte(address); break;
+		case 1: for(u32 i = 0; i != count; i++, address += step) reinterpret_cast<u16 *>(dest)[i] = read_word(address); break;
+		case 2: for(u32 i = 0; i != count; i++, address += step) reinterpret_cast<u32 *>(dest)[i] = read_dword(address); break;
+		case 3: for(u32 i = 0; i != count; i++, address += step) reinterpret_cast<u64 *>(dest)[i] = read_qword(address); break;
+		}
+	}
+
+	void write_block(offs_t address, int width, const void *src, u32 count) override
+	{
+		if constexpr(Width + AddrShift >= 0)
+		{
+			if((width == Width) && !(address & NATIVE_MASK))
+			{
+				constexpr int shift = Width + AddrShift;
+				NativeType const *source = reinterpret_cast<NativeType const *>(src);
+				while(count)
+				{
+					address &= m_addrmask;
+					offs_t start, end;
+					handler_entry_write<Width, AddrShift> *handler;
+					m_root_write->lookup(address, start, end, handler);
+
+					u32 const run = std::min<u32>(count, ((end - address) >> shift) + 1);
+					NativeType *const base = emu::detail::handler_direct_base<Width, AddrShift>(*handler, start, end);
+					if(base)
+						std::copy_n(source, run, base + ((address - start) >> shift));
+					else
+						for(u32 i = 0; i != run; i++)
+							write_native(address + (i << shift), source[i]);
+					source += run;
+					count -= run;
+					address += offs_t(run) << shift;
+				}
+				return;
+			}
+		}
+
+		offs_t const step = block_step(width);
+		switch(width)
+		{
+		case 0: for(u32 i = 0; i != count; i++, address += step) write_byte(address, reinterpret_cast<const u8 *>(src)[i]); break;
+		case 1: for(u32 i = 0; i != count; i++, address += step) write_word(address, reinterpret_cast<const u16 *>(src)[i]); break;
+		case 2: for(u32 i = 0; i != count; i++, address += step) write_dword(address, reinterpret_cast<const u32 *>(src)[i]); break;
+		case 3: for(u32 i = 0; i != count; i++, address += step) write_qword(address, reinterpret_cast<const u64 *>(src)[i]); break;
+		}
+	}
+
+	// address increment between consecutive block elements
+	static offs_t block_step(int width)
+	{
+		offs_t const step = AddrShift >= 0 ? offs_t(1 << width) << AddrShift : offs_t(1 << width) >> -AddrShift;
+		if(!step)
+			fatalerror("Block transfer of %d-bit elements is not possible on this address space\n", 8 << width);
+		return step;
+	}
+
 
 	// static access to these functions
 	static u8 read_byte_static(this_type &space, offs_t address) { return Width == 0 ? space.read_native(address & ~NATIVE_MASK) : memory_read_generic<Width, AddrShift, Endian, 0, true>([&space](offs_t offset, NativeType mask) -> NativeType { return space.read_native(offset, mask); }, address, 0xff); }
@@ -614,6 +706,7 @@ address_space::address_space(memory_manager &manager, device_memory_interface &m
 		m_log_unmap(true),
 		m_name(memory.space_config(spacenum)->name()),
 		m_in_notification(0),
+		m_cache_generation(0),
 		m_default_mpl(make_mph(nullptr))
 {
 }
@@ -839,6 +932,8 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void address_
 
 template<int Level, int Width, int AddrShift, endianness_t Endian> void address_space_specific<Level, Width, AddrShift, Endian>::unmap_generic(offs_t addrstart, offs_t addrend, offs_t addrmirror, u16 flags, read_or_write readorwrite, bool quiet)
 {
+	auto profile = g_profiler.start(PROFILER_MEM_REMAP);
+
 	VPRINTF("address_space::unmap(%*x-%*x mirror=%*x, %s, %s)\n",
 			m_addrchars, addrstart, m_addrchars, addrend,
 			m_addrchars, addrmirror,
@@ -1220,6 +1315,8 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void address_
 
 template<int Level, int Width, int AddrShift, endianness_t Endian> void address_space_specific<Level, Width, AddrShift, Endian>::install_bank_generic(offs_t addrstart, offs_t addrend, offs_t addrmirror, u16 flags, memory_bank *rbank, memory_bank *wbank)
 {
+	auto profile = g_profiler.start(PROFILER_MEM_REMAP);
+
 	VPRINTF("address_space::install_readwrite_bank(%*x-%*x mirror=%*x, read=\"%s\" / write=\"%s\")\n",
 			m_addrchars, addrstart, m_addrchars, addrend,
 			m_addrchars, addrmirror,
@@ -1255,6 +1352,8 @@ template<int Level, int Width, int AddrShift, endianness_t Endian> void address_
 
 template<int Level, int Width, int AddrShift, endianness_t Endian> void address_space_specific<Level, Width, AddrShift, Endian>::install_ram_generic(offs_t addrstart, offs_t addrend, offs_t addrmirror, u16 flags, read_or_write readorwrite, void *baseptr)
 {
+	auto profile = g_profiler.start(PROFILER_MEM_REMAP);
+
 	VPRINTF("address_space::install_ram_generic(%s-%s mirror=%s, %s, %p)\n",
 			m_addrchars, addrstart, m_addrchars, addrend,
 			m_addrchars, addrmirror,
@@ -1291,3 +1390,11 @@ util::notifier_subscription address_space::add_change_notifier(delegate<void (re
 {
 	return m_notifiers.subscribe(std::move(n));
 }
+
+void address_space::set_heatmap_enabled(bool enable)
+{
+	if (!enable)
+		m_heatmap.reset();
+	else if (!m_heatmap)
+		m_heatmap = std::make_unique<memory_heatmap>(*this);
+}
@@ -14,7 +14,7 @@ template<int Width, int AddrShift> class handler_entry_read_memory : public hand
 public:
 	using uX = emu::detail::handler_entry_size_t<Width>;
 
-	handler_entry_read_memory(address_space *space, u16 flags, void *base) : handler_entry_read_address<Width, AddrShift>(space, flags), m_base(reinterpret_cast<uX *>(base)) {}
+	handler_entry_read_memory(address_space *space, u16 flags, void *base) : handler_entry_read_address<Width, AddrShift>(space, flags | handler_entry::F_FIXED), m_base(reinterpret_cast<uX *>(base)) {}
 	~handler_entry_read_memory() = default;
 
 	uX read(offs_t offset, uX mem_mask) const override;
@@ -34,7 +34,7 @@ template<int Width, int AddrShift> class handler_entry_write_memory : public han
 public:
 	using uX = emu::detail::handler_entry_size_t<Width>;
 
-	handler_entry_write_memory(address_space *space, u16 flags, void *base) : handler_entry_write_address<Width, AddrShift>(space, flags), m_base(reinterpret_cast<uX *>(base)) {}
+	handler_entry_write_memory(address_space *space, u16 flags, void *base) : handler_entry_write_address<Width, AddrShift>(space, flags | handler_entry::F_FIXED), m_base(reinterpret_cast<uX *>(base)) {}
 	~handler_entry_write_memory() = default;
 
 	void write(offs_t offset, uX data, uX mem_mask) const override;
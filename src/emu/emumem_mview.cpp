@@ -342,6 +342,11 @@ memory_view::memory_view_entry &memory_view::operator[](int slot)
 		m_entries.resize(id+1);
 		m_entries[id].reset(e);
 		m_entry_mapping[slot] = id;
+		if (slot >= 0 && slot < 256) {
+			if (m_slot_ids.size() <= unsigned(slot))
+				m_slot_ids.resize(slot+1, -1);
+			m_slot_ids[slot] = id;
+		}
 		if (m_handler_read) {
 			m_handler_read->select_u(id);
 			m_handler_write->select_u(id);
@@ -505,11 +510,22 @@ void memory_view::register_state()
 {
 	m_device.machine().save().save_item(&m_device, "view", m_device.subtag(m_name).c_str(), 0, NAME(m_cur_slot));
 	m_device.machine().save().save_item(&m_device, "view", m_device.subtag(m_name).c_str(), 0, NAME(m_cur_id));
-	m_device.machine().save().register_postload(save_prepost_delegate(NAME([this]() { m_handler_read->select_a(m_cur_id); m_handler_write->select_a(m_cur_id); })));
+	m_device.machine().save().register_postload(save_prepost_delegate(NAME([this]() {
+		m_handler_read->select_a(m_cur_id);
+		m_handler_write->select_a(m_cur_id);
+		if(m_space)
+			m_space->invalidate_caches(read_or_write::READWRITE);
+	})));
 }
 
 void memory_view::disable()
 {
+	// the dispatch tables for each slot are built once, so switching only
+	// needs to repoint the handlers; skip even that when nothing changes
+	if (m_cur_id == -1)
+		return;
+
+	auto profile = g_profiler.start(PROFILER_MEM_REMAP);
 	m_cur_slot = -1;
 	m_cur_id = -1;
 	m_handler_read->select_a(-1);
@@ -521,12 +537,20 @@ void memory_view::disable()
 
 void memory_view::select(int slot)
 {
-	auto i = m_entry_mapping.find(slot);
-	if (i == m_entry_mapping.end())
-		fatalerror("memory_view %s: select of unknown slot %d", m_name, slot);
+	// common slot numbers are looked up directly, without walking the map
+	int id = (unsigned(slot) < m_slot_ids.size()) ? m_slot_ids[slot] : -1;
+	if (id == -1) {
+		auto i = m_entry_mapping.find(slot);
+		if (i == m_entry_mapping.end())
+			fatalerror("memory_view %s: select of unknown slot %d", m_name, slot);
+		id = i->second;
+	}
+	if (m_cur_id == id)
+		return;
 
+	auto profile = g_profiler.start(PROFILER_MEM_REMAP);
 	m_cur_slot = slot;
-	m_cur_id = i->second;
+	m_cur_id = id;
 	m_handler_read->select_a(m_cur_id);
 	m_handler_write->select_a(m_cur_id);
 
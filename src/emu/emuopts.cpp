@@ -71,13 +71,20 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_AUTOSAVE,                                   "0",         core_options::option_type::BOOLEAN,    "automatically restore state on start and save on exit for supported systems" },
 	{ OPTION_REWIND,                                     "0",         core_options::option_type::BOOLEAN,    "enable rewind savestates" },
 	{ OPTION_REWIND_CAPACITY "(1-2048)",                 "100",       core_options::option_type::INTEGER,    "rewind buffer size in megabytes" },
+	{ OPTION_RUNAHEAD "(0-4)",                           "0",         core_options::option_type::INTEGER,    "frames to emulate ahead of the displayed frame to reduce input latency" },
+	{ OPTION_STATE_COMPRESSION,                          "zlib",      core_options::option_type::STRING,     "compression for saved state files (zlib or zstd)" },
+	{ OPTION_STATE_BACKGROUND,                           "0",         core_options::option_type::BOOLEAN,    "compress and write saved state files on a background thread" },
 	{ OPTION_PLAYBACK ";pb",                             nullptr,     core_options::option_type::STRING,     "playback an input file" },
 	{ OPTION_RECORD ";rec",                              nullptr,     core_options::option_type::STRING,     "record an input file" },
 	{ OPTION_EXIT_AFTER_PLAYBACK,                        "0",         core_options::option_type::BOOLEAN,    "close the program at the end of playback" },
 
 	{ OPTION_MNGWRITE,                                   nullptr,     core_options::option_type::PATH,       "optional filename to write a MNG movie of the current session" },
 	{ OPTION_AVIWRITE,                                   nullptr,     core_options::option_type::PATH,       "optional filename to write an AVI movie of the current session" },
+	{ OPTION_RAWWRITE,                                   nullptr,     core_options::option_type::PATH,       "optional filename (or named pipe) to stream raw video, with raw audio alongside in <filename>.pcm, for an external encoder" },
 	{ OPTION_WAVWRITE,                                   nullptr,     core_options::option_type::PATH,       "optional filename to write a WAV file of the current session" },
+	{ OPTION_WAVONLY,                                    "0",         core_options::option_type::BOOLEAN,    "render only audio for -wavwrite as fast as possible; skips all video work and implies -video none -sound none -nothrottle" },
+	{ OPTION_HASHWRITE,                                  nullptr,     core_options::option_type::PATH,       "optional filename to write CRC-32 hashes of each screen's pixels for regression testing (%g == system name); implies -video none -sound none -nothrottle" },
+	{ OPTION_HASHFRAMES,                                 nullptr,     core_options::option_type::STRING,     "frames to hash for -hashwrite, as a comma-separated list of frame numbers and first-last ranges; exits after the last one (default: every frame)" },
 	{ OPTION_SNAPNAME,                                   "%g/%i",     core_options::option_type::STRING,     "override of the default snapshot/movie naming; %g == gamename, %i == index" },
 	{ OPTION_SNAPSIZE,                                   "auto",      core_options::option_type::STRING,     "specify snapshot/movie resolution (<width>x<height>) or 'auto' to use minimal size " },
 	{ OPTION_SNAPVIEW,                                   "auto",      core_options::option_type::STRING,     "snapshot/movie view - 'auto' for default, or 'native' for per-screen pixel-aspect views" },
@@ -95,6 +102,10 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SPEED "(0.01-100)",                         "1.0",       core_options::option_type::FLOAT,      "controls the speed of gameplay, relative to realtime; smaller numbers are slower" },
 	{ OPTION_REFRESHSPEED ";rs",                         "0",         core_options::option_type::BOOLEAN,    "automatically adjust emulation speed to keep the emulated refresh rate slower than the host screen" },
 	{ OPTION_LOWLATENCY ";lolat",                        "0",         core_options::option_type::BOOLEAN,    "draws new frame before throttling to reduce input latency" },
+	{ OPTION_FRAMETIMING,                                "0",         core_options::option_type::BOOLEAN,    "show frame timings and a frame time histogram with the speed display" },
+	{ OPTION_FRAMETIMING_CSV,                            nullptr,     core_options::option_type::PATH,       "optional filename to write recent per-frame timings to as CSV on exit" },
+	{ OPTION_STARTUP_TRACE,                              nullptr,     core_options::option_type::PATH,       "optional filename to write machine startup phase and device timings to as Chrome trace JSON" },
+	{ OPTION_CASSETTE_TURBO,                             "0",         core_options::option_type::BOOLEAN,    "run unthrottled while a cassette is playing with its motor on" },
 
 	// render options
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE RENDER OPTIONS" },
@@ -145,6 +156,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_SAMPLES,                                    "1",         core_options::option_type::BOOLEAN,    "enable the use of external samples if available" },
 	{ OPTION_VOLUME ";vol",                              "0",         core_options::option_type::INTEGER,    "sound volume in decibels (-32 min, 0 max)" },
 	{ OPTION_COMPRESSOR,                                 "1",         core_options::option_type::BOOLEAN,    "enable compressor for sound" },
+	{ OPTION_RESAMPLER_QUALITY "(0-3)",                  "1",         core_options::option_type::INTEGER,    "sound resampler quality (0=linear, 1-3 for longer windowed-sinc filters)" },
 	{ OPTION_SPEAKER_REPORT "(0-4)",                     "0",         core_options::option_type::INTEGER,    "print report of speaker ouput maxima (0=none, or 1-4 for more detail)" },
 
 	// input options
@@ -166,6 +178,8 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_NATURAL_KEYBOARD ";nat",                    "0",         core_options::option_type::BOOLEAN,    "specifies whether to use a natural keyboard or not" },
 	{ OPTION_JOYSTICK_CONTRADICTORY ";joy_contradictory","0",         core_options::option_type::BOOLEAN,    "enable contradictory direction digital joystick input at the same time" },
 	{ OPTION_COIN_IMPULSE,                               "0",         core_options::option_type::INTEGER,    "set coin impulse time (n<0 disable impulse, n==0 obey driver, 0<n set time n)" },
+	{ OPTION_INPUT_SUBFRAMES "(0-8)",                    "0",         core_options::option_type::INTEGER,    "extra times per frame to poll host inputs and refresh plain digital inputs (ignored while recording or playing back)" },
+	{ OPTION_INPUT_LATE_POLL "(0-16667)",                "0",         core_options::option_type::INTEGER,    "poll host inputs when the emulated system reads a port if at least this many emulated microseconds have passed since the last poll (0 = off; ignored while recording or playing back)" },
 
 	// input autoenable options
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE INPUT AUTOMATIC ENABLE OPTIONS" },
@@ -187,6 +201,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_UPDATEINPAUSE,                              "0",         core_options::option_type::BOOLEAN,    "keep calling video updates while in pause" },
 	{ OPTION_DEBUGSCRIPT,                                nullptr,     core_options::option_type::PATH,       "script for debugger" },
 	{ OPTION_DEBUGLOG,                                   "0",         core_options::option_type::BOOLEAN,    "write debug console output to debug.log" },
+	{ OPTION_SCHEDSTATS,                                 "0",         core_options::option_type::BOOLEAN,    "display per-device scheduler statistics on exit" },
 
 	// comm options
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "CORE COMM OPTIONS" },
@@ -202,9 +217,14 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DRC_USE_C,                                  "0",         core_options::option_type::BOOLEAN,    "force DRC to use C backend" },
 	{ OPTION_DRC_LOG_UML,                                "0",         core_options::option_type::BOOLEAN,    "write DRC UML disassembly log" },
 	{ OPTION_DRC_LOG_NATIVE,                             "0",         core_options::option_type::BOOLEAN,    "write DRC native disassembly log" },
+	{ OPTION_DRC_JOURNAL,                                "0",         core_options::option_type::BOOLEAN,    "remember compiled DRC blocks and precompile them on the next run" },
+	{ OPTION_VOODOO_RASTERSTATS,                         "0",         core_options::option_type::BOOLEAN,    "log Voodoo rasterizer modes without a specialised rasterizer on exit" },
 	{ OPTION_BIOS,                                       nullptr,     core_options::option_type::STRING,     "select the system BIOS to use" },
 	{ OPTION_CHEAT ";c",                                 "0",         core_options::option_type::BOOLEAN,    "enable cheat subsystem" },
 	{ OPTION_SKIP_GAMEINFO,                              "0",         core_options::option_type::BOOLEAN,    "skip displaying the system information screen at startup" },
+	{ OPTION_PARALLEL_LOAD,                              "1",         core_options::option_type::BOOLEAN,    "open, decompress and verify ROM files on multiple threads" },
+	{ OPTION_HASH_CACHE,                                 "",          core_options::option_type::PATH,       "database of ROM hashes reused while files are unchanged (empty to disable)" },
+	{ OPTION_MAP_ROMS,                                   "0",         core_options::option_type::BOOLEAN,    "map ROM regions loaded whole from uncompressed files instead of copying them" },
 	{ OPTION_UI_FONT,                                    "default",   core_options::option_type::STRING,     "specify a font to use" },
 	{ OPTION_UI,                                         "cabinet",   core_options::option_type::STRING,     "type of UI (simple|cabinet)" },
 	{ OPTION_RAMSIZE ";ram",                             nullptr,     core_options::option_type::STRING,     "size of RAM (if supported by driver)" },
@@ -221,6 +241,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_PLUGINS,                                    "1",         core_options::option_type::BOOLEAN,    "enable Lua plugin support" },
 	{ OPTION_PLUGIN,                                     nullptr,     core_options::option_type::STRING,     "list of plugins to enable" },
 	{ OPTION_NO_PLUGIN,                                  nullptr,     core_options::option_type::STRING,     "list of plugins to disable" },
+	{ OPTION_LUA_PROFILE,                                "0",         core_options::option_type::BOOLEAN,    "report time spent in Lua callbacks on exit" },
 
 	{ nullptr,                                           nullptr,     core_options::option_type::HEADER,     "HTTP SERVER OPTIONS" },
 	{ OPTION_HTTP,                                       "0",         core_options::option_type::BOOLEAN,    "enable HTTP server" },
@@ -54,12 +54,19 @@
 #define OPTION_AUTOSAVE             "autosave"
 #define OPTION_REWIND               "rewind"
 #define OPTION_REWIND_CAPACITY      "rewind_capacity"
+#define OPTION_RUNAHEAD             "runahead"
+#define OPTION_STATE_COMPRESSION    "state_compression"
+#define OPTION_STATE_BACKGROUND     "state_background"
 #define OPTION_PLAYBACK             "playback"
 #define OPTION_RECORD               "record"
 #define OPTION_EXIT_AFTER_PLAYBACK  "exit_after_playback"
 #define OPTION_MNGWRITE             "mngwrite"
 #define OPTION_AVIWRITE             "aviwrite"
+#define OPTION_RAWWRITE             "rawwrite"
 #define OPTION_WAVWRITE             "wavwrite"
+#define OPTION_WAVONLY              "wavonly"
+#define OPTION_HASHWRITE            "hashwrite"
+#define OPTION_HASHFRAMES           "hashframes"
 #define OPTION_SNAPNAME             "snapname"
 #define OPTION_SNAPSIZE             "snapsize"
 #define OPTION_SNAPVIEW             "snapview"
@@ -76,6 +83,10 @@
 #define OPTION_SPEED                "speed"
 #define OPTION_REFRESHSPEED         "refreshspeed"
 #define OPTION_LOWLATENCY           "lowlatency"
+#define OPTION_FRAMETIMING          "frametiming"
+#define OPTION_FRAMETIMING_CSV      "frametiming_csv"
+#define OPTION_STARTUP_TRACE        "startup_trace"
+#define OPTION_CASSETTE_TURBO       "cassette_turbo"
 
 // core render options
 #define OPTION_KEEPASPECT           "keepaspect"
@@ -120,6 +131,7 @@
 #define OPTION_SAMPLES              "samples"
 #define OPTION_VOLUME               "volume"
 #define OPTION_COMPRESSOR           "compressor"
+#define OPTION_RESAMPLER_QUALITY    "resampler_quality"
 #define OPTION_SPEAKER_REPORT       "speaker_report"
 
 // core input options
@@ -140,6 +152,8 @@
 #define OPTION_NATURAL_KEYBOARD     "natural"
 #define OPTION_JOYSTICK_CONTRADICTORY   "joystick_contradictory"
 #define OPTION_COIN_IMPULSE         "coin_impulse"
+#define OPTION_INPUT_SUBFRAMES      "input_subframes"
+#define OPTION_INPUT_LATE_POLL      "input_late_poll"
 
 // input autoenable options
 #define OPTION_PADDLE_DEVICE        "paddle_device"
@@ -159,15 +173,21 @@
 #define OPTION_UPDATEINPAUSE        "update_in_pause"
 #define OPTION_DEBUGSCRIPT          "debugscript"
 #define OPTION_DEBUGLOG             "debuglog"
+#define OPTION_SCHEDSTATS           "schedstats"
 
 // core misc options
 #define OPTION_DRC                  "drc"
 #define OPTION_DRC_USE_C            "drc_use_c"
 #define OPTION_DRC_LOG_UML          "drc_log_uml"
 #define OPTION_DRC_LOG_NATIVE       "drc_log_native"
+#define OPTION_DRC_JOURNAL          "drc_journal"
+#define OPTION_VOODOO_RASTERSTATS   "voodoo_rasterstats"
 #define OPTION_BIOS                 "bios"
 #define OPTION_CHEAT                "cheat"
 #define OPTION_SKIP_GAMEINFO        "skip_gameinfo"
+#define OPTION_PARALLEL_LOAD        "parallel_load"
+#define OPTION_HASH_CACHE           "hash_cache"
+#define OPTION_MAP_ROMS             "map_roms"
 #define OPTION_UI_FONT              "uifont"
 #define OPTION_UI                   "ui"
 #define OPTION_RAMSIZE              "ramsize"
@@ -191,6 +211,7 @@
 #define OPTION_PLUGINS              "plugins"
 #define OPTION_PLUGIN               "plugin"
 #define OPTION_NO_PLUGIN            "noplugin"
+#define OPTION_LUA_PROFILE          "luaprofile"
 
 #define OPTION_LANGUAGE             "language"
 
@@ -340,12 +361,19 @@ public:
 	bool autosave() const { return bool_value(OPTION_AUTOSAVE); }
 	int rewind() const { return bool_value(OPTION_REWIND); }
 	int rewind_capacity() const { return int_value(OPTION_REWIND_CAPACITY); }
+	int runahead() const { return int_value(OPTION_RUNAHEAD); }
+	const char *state_compression() const { return value(OPTION_STATE_COMPRESSION); }
+	bool state_background() const { return bool_value(OPTION_STATE_BACKGROUND); }
 	const char *playback() const { return value(OPTION_PLAYBACK); }
 	const char *record() const { return value(OPTION_RECORD); }
 	bool exit_after_playback() const { return bool_value(OPTION_EXIT_AFTER_PLAYBACK); }
 	const char *mng_write() const { return value(OPTION_MNGWRITE); }
 	const char *avi_write() const { return value(OPTION_AVIWRITE); }
+	const char *raw_write() const { return value(OPTION_RAWWRITE); }
 	const char *wav_write() const { return value(OPTION_WAVWRITE); }
+	bool wav_only() const { return bool_value(OPTION_WAVONLY); }
+	const char *hash_write() const { return value(OPTION_HASHWRITE); }
+	const char *hash_frames() const { return value(OPTION_HASHFRAMES); }
 	const char *snap_name() const { return value(OPTION_SNAPNAME); }
 	const char *snap_size() const { return value(OPTION_SNAPSIZE); }
 	const char *snap_view() const { return value(OPTION_SNAPVIEW); }
@@ -362,6 +390,10 @@ public:
 	float speed() const { return float_value(OPTION_SPEED); }
 	bool refresh_speed() const { return m_refresh_speed; }
 	bool low_latency() const { return bool_value(OPTION_LOWLATENCY); }
+	bool frame_timing() const { return bool_value(OPTION_FRAMETIMING); }
+	const char *frame_timing_csv() const { return value(OPTION_FRAMETIMING_CSV); }
+	const char *startup_trace() const { return value(OPTION_STARTUP_TRACE); }
+	bool cassette_turbo() const { return bool_value(OPTION_CASSETTE_TURBO); }
 
 	// core render options
 	bool keep_aspect() const { return bool_value(OPTION_KEEPASPECT); }
@@ -406,6 +438,7 @@ public:
 	bool samples() const { return bool_value(OPTION_SAMPLES); }
 	int volume() const { return int_value(OPTION_VOLUME); }
 	bool compressor() const { return bool_value(OPTION_COMPRESSOR); }
+	int resampler_quality() const { return int_value(OPTION_RESAMPLER_QUALITY); }
 	int speaker_report() const { return int_value(OPTION_SPEAKER_REPORT); }
 
 	// core input options
@@ -434,6 +467,8 @@ public:
 	bool natural_keyboard() const { return bool_value(OPTION_NATURAL_KEYBOARD); }
 	bool joystick_contradictory() const { return m_joystick_contradictory; }
 	int coin_impulse() const { return m_coin_impulse; }
+	int input_subframes() const { return int_value(OPTION_INPUT_SUBFRAMES); }
+	int input_late_poll() const { return int_value(OPTION_INPUT_LATE_POLL); }
 
 	// core debugging options
 	bool log() const { return bool_value(OPTION_LOG); }
@@ -443,15 +478,21 @@ public:
 	const char *debug_script() const { return value(OPTION_DEBUGSCRIPT); }
 	bool update_in_pause() const { return bool_value(OPTION_UPDATEINPAUSE); }
 	bool debuglog() const { return bool_value(OPTION_DEBUGLOG); }
+	bool schedstats() const { return bool_value(OPTION_SCHEDSTATS); }
 
 	// core misc options
 	bool drc() const { return bool_value(OPTION_DRC); }
 	bool drc_use_c() const { return bool_value(OPTION_DRC_USE_C); }
 	bool drc_log_uml() const { return bool_value(OPTION_DRC_LOG_UML); }
 	bool drc_log_native() const { return bool_value(OPTION_DRC_LOG_NATIVE); }
+	bool drc_journal() const { return bool_value(OPTION_DRC_JOURNAL); }
+	bool voodoo_rasterstats() const { return bool_value(OPTION_VOODOO_RASTERSTATS); }
 	const char *bios() const { return value(OPTION_BIOS); }
 	bool cheat() const { return bool_value(OPTION_CHEAT); }
 	bool skip_gameinfo() const { return bool_value(OPTION_SKIP_GAMEINFO); }
+	bool parallel_load() const { return bool_value(OPTION_PARALLEL_LOAD); }
+	const char *hash_cache() const { return value(OPTION_HASH_CACHE); }
+	bool map_roms() const { return bool_value(OPTION_MAP_ROMS); }
 	const char *ui_font() const { return value(OPTION_UI_FONT); }
 	ui_option ui() const { return m_ui; }
 	const char *ram_size() const { return value(OPTION_RAMSIZE); }
@@ -478,6 +519,7 @@ public:
 
 	const char *plugin() const { return value(OPTION_PLUGIN); }
 	const char *no_plugin() const { return value(OPTION_NO_PLUGIN); }
+	bool lua_profile() const { return bool_value(OPTION_LUA_PROFILE); }
 
 	const char *language() const { return value(OPTION_LANGUAGE); }
 
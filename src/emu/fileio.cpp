@@ -11,16 +11,100 @@
 #include "emu.h"
 #include "fileio.h"
 
+#include "hashcache.h"
+
+#include "util/corestr.h"
 #include "util/path.h"
 #include "util/unzip.h"
 
+#include "osdfile.h"
+
+#include <algorithm>
+#include <mutex>
+#include <optional>
 #include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 
 //#define VERBOSE 1
 #define LOG_OUTPUT_FUNC osd_printf_verbose
 #include "logmacro.h"
 
 
+namespace {
+
+//**************************************************************************
+//  DIRECTORY CACHE
+//**************************************************************************
+
+// remembers the contents of directories that read-only opens have looked in,
+// so trying each file name and archive in every search path doesn't cost a
+// failed open (expensive on network shares) for every combination
+class directory_cache
+{
+public:
+	// returns false only if the file is known not to exist
+	bool may_exist(std::string_view path);
+	void clear();
+
+private:
+	// names are kept in lowercase, so a miss means no file exists even on
+	// case-insensitive filesystems; a hit still needs a real open
+	using name_set = std::unordered_set<std::string>;
+
+	std::mutex                                              m_mutex;
+	std::unordered_map<std::string, std::optional<name_set> > m_directories;   // no value if it couldn't be listed
+};
+
+bool directory_cache::may_exist(std::string_view path)
+{
+	// split off the directory part; leave anything unusual to the real open
+	auto const dirsepiter(std::find_if(path.rbegin(), path.rend(), util::is_directory_separator));
+	if (dirsepiter == path.rend())
+		return true;
+	std::string_view::size_type const dirsep(std::distance(path.begin(), dirsepiter.base()) - 1);
+	std::string dirname(path.substr(0, dirsep ? dirsep : 1));
+	if (dirname.back() == ':')
+		return true;
+	std::string const name(strmakelower(path.substr(dirsep + 1)));
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	auto found(m_directories.find(dirname));
+	if (m_directories.end() == found)
+	{
+		std::optional<name_set> names;
+		osd::directory::ptr const dir(osd::directory::open(dirname));
+		if (dir)
+		{
+			names.emplace();
+			for (osd::directory::entry const *entry = dir->read(); entry; entry = dir->read())
+				names->emplace(strmakelower(entry->name));
+		}
+		else if (!std::unique_ptr<osd::directory::entry>(osd_stat(dirname)))
+		{
+			// a directory that doesn't exist contains nothing
+			names.emplace();
+		}
+		found = m_directories.emplace(std::move(dirname), std::move(names)).first;
+	}
+	return !found->second || (found->second->find(name) != found->second->end());
+}
+
+void directory_cache::clear()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_directories.clear();
+}
+
+directory_cache &get_directory_cache()
+{
+	static directory_cache cache;
+	return cache;
+}
+
+} // anonymous namespace
+
+
 template path_iterator::path_iterator(char *&, int);
 template path_iterator::path_iterator(char * const &, int);
 template path_iterator::path_iterator(char const *&, int);
@@ -213,6 +297,8 @@ emu_file::emu_file(u32 openflags, empty_t)
 	, m_openflags(openflags)
 	, m_zipfile(nullptr)
 	, m_ziplength(0)
+	, m_zipcrc(0)
+	, m_ziptime(0)
 	, m_remove_on_close(false)
 	, m_restrict_to_mediapath(0)
 {
@@ -268,28 +354,127 @@ util::hash_collection &emu_file::hashes(std::string_view types)
 	if (needed.empty())
 		return m_hashes;
 
+	// an unchanged file can use the hashes from a previous run without loading anything
+	hash_cache *const cache(hash_cache::global());
+	u64 cachesize;
+	s64 cachetime;
+	u32 cachecrc;
+	bool const cacheable(cache && hash_cache_key(cachesize, cachetime, cachecrc));
+	if (cacheable)
+	{
+		util::hash_collection cached;
+		if (cache->find(m_fullpath, cachesize, cachetime, cachecrc, cached))
+		{
+			std::string const cached_types(cached.hash_types());
+			if (std::all_of(needed.begin(), needed.end(), [&cached_types] (char type) { return cached_types.find(type) != std::string::npos; }))
+			{
+				m_hashes = cached;
+				return m_hashes;
+			}
+		}
+	}
+
 	// load the ZIP file if needed
 	if (compressed_file_ready())
 		return m_hashes;
 	if (m_file == nullptr)
 		return m_hashes;
 
-	// if we have ZIP data, just hash that directly
 	if (!m_zipdata.empty())
 	{
+		// if we have ZIP data, just hash that directly
 		m_hashes.compute(&m_zipdata[0], m_zipdata.size(), needed.c_str());
-		return m_hashes;
+	}
+	else
+	{
+		std::uint64_t length;
+		if (m_file->length(length))
+			return m_hashes;
+
+		// hash the data
+		std::size_t actual;
+		if (m_hashes.compute(*m_file, 0U, length, actual, needed.c_str()) || (actual != length)) // FIXME: need better interface to report errors
+			return m_hashes;
 	}
 
-	std::uint64_t length;
-	if (m_file->length(length))
-		return m_hashes;
+	// remember them for next time
+	if (cacheable)
+		cache->store(m_fullpath, cachesize, cachetime, cachecrc, m_hashes);
+	return m_hashes;
+}
 
-	// hash the data
-	std::size_t actual;
-	(void)m_hashes.compute(*m_file, 0U, length, actual, needed.c_str()); // FIXME: need better interface to report errors
 
-	return m_hashes;
+//-------------------------------------------------
+//  map_private - map the contents of a loose
+//  file or a stored archive member straight
+//  from disk, before anything has loaded them
+//-------------------------------------------------
+
+std::error_condition emu_file::map_private(std::unique_ptr<osd_file> &mapping, void *&data)
+{
+	// a member that has already been inflated into memory can't be mapped
+	std::string const *path;
+	std::uint64_t offset = 0;
+	if (m_zipfile)
+	{
+		std::error_condition const err = m_zipfile->stored_data_offset(offset);
+		if (err)
+			return err;
+		path = &m_zippath;
+	}
+	else if (!m_zipdata.empty())
+		return std::errc::not_supported;
+	else if (m_file)
+		path = &m_fullpath;
+	else
+		return std::errc::bad_file_descriptor;
+
+	// callers access the contents as wider types, so archive members need to be aligned
+	if (offset % 8)
+		return std::errc::not_supported;
+	u64 const length(size());
+	if (!length)
+		return std::errc::not_supported;
+
+	// open a separate handle so the mapping can outlive this file
+	osd_file::ptr file;
+	std::uint64_t filesize;
+	std::error_condition err = osd_file::open(*path, OPEN_FLAG_READ, file, filesize);
+	if (!err)
+		err = file->map_private(offset, length, data);
+	if (!err)
+		mapping = std::move(file);
+	return err;
+}
+
+
+//-------------------------------------------------
+//  hash_cache_key - get the size, modification
+//  time and archive CRC that identify the
+//  current contents of the file
+//-------------------------------------------------
+
+bool emu_file::hash_cache_key(u64 &size, s64 &mtime, u32 &crc) const
+{
+	// archive members are identified by their directory entry
+	if (m_zipfile || !m_zipdata.empty())
+	{
+		size = m_ziplength;
+		mtime = m_ziptime;
+		crc = m_zipcrc;
+		return true;
+	}
+
+	// loose files by what the filesystem says about them
+	if (!m_file)
+		return false;
+	std::unique_ptr<osd::directory::entry> const entry(osd_stat(m_fullpath));
+	if (!entry || (entry->type != osd::directory::entry::entry_type::FILE))
+		return false;
+	size = entry->size;
+	mtime = std::chrono::duration_cast<std::chrono::microseconds>(entry->last_modified.time_since_epoch()).count();
+	crc = 0;
+	return true;
 }
 
 
@@ -322,6 +507,18 @@ std::error_condition emu_file::open(std::string &&name, u32 crc)
 }
 
 
+//-------------------------------------------------
+//  cache_clear - forget cached directory
+//  contents, so files added or removed since
+//  they were listed are noticed
+//-------------------------------------------------
+
+void emu_file::cache_clear()
+{
+	get_directory_cache().clear();
+}
+
+
 //-------------------------------------------------
 //  open_next - open the next file that matches
 //  the filename by iterating over paths
@@ -379,12 +576,20 @@ std::error_condition emu_file::open_next()
 		}
 		m_fullpath.append(m_filename);
 
-		// attempt to open the file directly
+		// attempt to open the file directly, unless we already know it isn't there
+		bool const readonly((m_openflags & (OPEN_FLAG_READ | OPEN_FLAG_WRITE)) == OPEN_FLAG_READ);
 		LOG("emu_file: attempting to open '%s' directly\n", m_fullpath);
-		filerr = util::core_file::open(m_fullpath, m_openflags, m_file);
+		if (!readonly || get_directory_cache().may_exist(m_fullpath))
+			filerr = util::core_file::open(m_fullpath, m_openflags, m_file);
+		else
+			filerr = std::errc::no_such_file_or_directory;
+
+		// anything we write may be read back later in the run
+		if (!filerr && (m_openflags & OPEN_FLAG_WRITE))
+			get_directory_cache().clear();
 
 		// if we're opening for read-only we have other options
-		if (filerr && ((m_openflags & (OPEN_FLAG_READ | OPEN_FLAG_WRITE)) == OPEN_FLAG_READ))
+		if (filerr && readonly)
 		{
 			LOG("emu_file: attempting to open '%s' from archives\n", m_fullpath);
 			filerr = attempt_zipped();
@@ -745,7 +950,9 @@ std::error_condition emu_file::attempt_zipped()
 
 			// attempt to open the archive file
 			util::archive_file::ptr zip;
-			std::error_condition ziperr = open_funcs[i](m_fullpath, zip);
+			std::error_condition ziperr = get_directory_cache().may_exist(m_fullpath)
+					? open_funcs[i](m_fullpath, zip)
+					: std::errc::no_such_file_or_directory;
 
 			// chop the archive suffix back off the filename before continuing
 			m_fullpath = m_fullpath.substr(0, dirsep);
@@ -777,7 +984,10 @@ std::error_condition emu_file::attempt_zipped()
 			if (header >= 0)
 			{
 				m_zipfile = std::move(zip);
+				m_zippath = m_fullpath + suffixes[i];
 				m_ziplength = m_zipfile->current_uncompressed_length();
+				m_zipcrc = m_zipfile->current_crc();
+				m_ziptime = std::chrono::duration_cast<std::chrono::microseconds>(m_zipfile->current_last_modified().time_since_epoch()).count();
 
 				// build a hash with just the CRC
 				m_hashes.reset();
@@ -17,6 +17,7 @@
 #include "hash.h"
 
 #include <iterator>
+#include <memory>
 #include <string>
 #include <system_error>
 #include <type_traits>
@@ -29,6 +30,8 @@
 #undef getc
 #endif
 
+class osd_file;
+
 //**************************************************************************
 //  TYPE DEFINITIONS
 //**************************************************************************
@@ -151,6 +154,9 @@ public:
 	u32 openflags() const { return m_openflags; }
 	util::hash_collection &hashes(std::string_view types);
 
+	// map the whole contents copy-on-write if they're stored uncompressed on disk
+	std::error_condition map_private(std::unique_ptr<osd_file> &mapping, void *&data);
+
 	// setters
 	void remove_on_close() { m_remove_on_close = true; }
 	void set_openflags(u32 openflags) { assert(!m_file); m_openflags = openflags; }
@@ -167,6 +173,9 @@ public:
 	std::error_condition open_ram(const void *data, u32 length);
 	void close();
 
+	// forget cached directory listings used to skip opening missing files
+	static void cache_clear();
+
 	// position
 	std::error_condition seek(s64 offset, int whence);
 	u64 tell();
@@ -216,6 +225,7 @@ private:
 	// internal helpers
 	std::error_condition attempt_zipped();
 	std::error_condition load_zipped_file();
+	bool hash_cache_key(u64 &size, s64 &mtime, u32 &crc) const;
 
 	// internal state
 	std::string             m_filename;             // original filename provided
@@ -231,6 +241,9 @@ private:
 	std::unique_ptr<util::archive_file> m_zipfile;  // ZIP file pointer
 	std::vector<u8>         m_zipdata;              // ZIP file data
 	u64                     m_ziplength;            // ZIP file length
+	u32                     m_zipcrc;               // ZIP file CRC from the archive directory
+	std::string             m_zippath;              // path to the archive containing the file
+	s64                     m_ziptime;              // ZIP file modification time, in microseconds
 
 	bool                    m_remove_on_close;      // flag: remove the file when closing
 	int                     m_restrict_to_mediapath; // flag: restrict to paths inside the media-path
@@ -0,0 +1,161 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    hashcache.cpp
+
+    Persistent cache of file hashes.
+
+***************************************************************************/
+
+#include "emu.h"
+#include "hashcache.h"
+
+#include "sqlite3/sqlite3.h"
+
+
+//**************************************************************************
+//  GLOBAL VARIABLES
+//**************************************************************************
+
+std::unique_ptr<hash_cache> hash_cache::s_global;
+
+
+
+//**************************************************************************
+//  HASH CACHE
+//**************************************************************************
+
+//-------------------------------------------------
+//  hash_cache - constructor; opens or creates
+//  the database, leaving the cache closed (and
+//  every lookup missing) on failure
+//-------------------------------------------------
+
+hash_cache::hash_cache(std::string_view filename)
+	: m_filename(filename)
+	, m_db(nullptr)
+	, m_find(nullptr)
+	, m_store(nullptr)
+{
+	if (sqlite3_open_v2(m_filename.c_str(), &m_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX, nullptr) != SQLITE_OK)
+	{
+		osd_printf_warning("Unable to open hash cache %s: %s\n", m_filename, m_db ? sqlite3_errmsg(m_db) : "out of memory");
+		close();
+		return;
+	}
+
+	// write-ahead logging avoids syncing the disk on every insert
+	char const *const setup =
+			"PRAGMA journal_mode=WAL;"
+			"PRAGMA synchronous=NORMAL;"
+			"CREATE TABLE IF NOT EXISTS hashes ("
+			"path TEXT NOT NULL, crc INTEGER NOT NULL, size INTEGER NOT NULL, mtime INTEGER NOT NULL, hashes TEXT NOT NULL, "
+			"PRIMARY KEY (path, crc));";
+	if ((sqlite3_exec(m_db, setup, nullptr, nullptr, nullptr) != SQLITE_OK) ||
+			(sqlite3_prepare_v2(m_db, "SELECT size, mtime, hashes FROM hashes WHERE path = ?1 AND crc = ?2;", -1, &m_find, nullptr) != SQLITE_OK) ||
+			(sqlite3_prepare_v2(m_db, "INSERT OR REPLACE INTO hashes (path, crc, size, mtime, hashes) VALUES (?1, ?2, ?3, ?4, ?5);", -1, &m_store, nullptr) != SQLITE_OK))
+	{
+		osd_printf_warning("Unable to initialize hash cache %s: %s\n", m_filename, sqlite3_errmsg(m_db));
+		close();
+	}
+}
+
+
+//-------------------------------------------------
+//  ~hash_cache - destructor
+//-------------------------------------------------
+
+hash_cache::~hash_cache()
+{
+	close();
+}
+
+
+//-------------------------------------------------
+//  set_global - replace the cache used by
+//  emu_file; an empty name disables it
+//-------------------------------------------------
+
+void hash_cache::set_global(std::string_view filename)
+{
+	if (s_global && (s_global->m_filename == filename))
+		return;
+
+	s_global.reset();
+	if (!filename.empty())
+	{
+		s_global = std::make_unique<hash_cache>(filename);
+		if (!s_global->is_open())
+			s_global.reset();
+	}
+}
+
+
+//-------------------------------------------------
+//  find - add any cached hashes for a file whose
+//  size and modification time still match
+//-------------------------------------------------
+
+bool hash_cache::find(std::string_view path, u64 size, s64 mtime, u32 crc, util::hash_collection &hashes)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (!m_db)
+		return false;
+
+	bool found = false;
+	sqlite3_bind_text(m_find, 1, path.data(), int(path.length()), SQLITE_TRANSIENT);
+	sqlite3_bind_int64(m_find, 2, crc);
+	if ((sqlite3_step(m_find) == SQLITE_ROW) && (u64(sqlite3_column_int64(m_find, 0)) == size) && (sqlite3_column_int64(m_find, 1) == mtime))
+	{
+		char const *const text = reinterpret_cast<char const *>(sqlite3_column_text(m_find, 2));
+		util::hash_collection cached;
+		if (text && cached.from_internal_string(text))
+		{
+			hashes = cached;
+			found = true;
+		}
+	}
+	sqlite3_reset(m_find);
+	sqlite3_clear_bindings(m_find);
+	return found;
+}
+
+
+//-------------------------------------------------
+//  store - record the hashes for a file,
+//  replacing anything stale
+//-------------------------------------------------
+
+void hash_cache::store(std::string_view path, u64 size, s64 mtime, u32 crc, const util::hash_collection &hashes)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (!m_db)
+		return;
+
+	std::string const text = hashes.internal_string();
+	sqlite3_bind_text(m_store, 1, path.data(), int(path.length()), SQLITE_TRANSIENT);
+	sqlite3_bind_int64(m_store, 2, crc);
+	sqlite3_bind_int64(m_store, 3, sqlite3_int64(size));
+	sqlite3_bind_int64(m_store, 4, mtime);
+	sqlite3_bind_text(m_store, 5, text.c_str(), int(text.length()), SQLITE_TRANSIENT);
+	if (sqlite3_step(m_store) != SQLITE_DONE)
+		osd_printf_verbose("Unable to update hash cache %s: %s\n", m_filename, sqlite3_errmsg(m_db));
+	sqlite3_reset(m_store);
+	sqlite3_clear_bindings(m_store);
+}
+
+
+//-------------------------------------------------
+//  close - release the statements and database
+//-------------------------------------------------
+
+void hash_cache::close()
+{
+	sqlite3_finalize(m_find);
+	sqlite3_finalize(m_store);
+	sqlite3_close(m_db);
+	m_find = nullptr;
+	m_store = nullptr;
+	m_db = nullptr;
+}
@@ -0,0 +1,69 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    hashcache.h
+
+    Persistent cache of file hashes, so unchanged files don't need to be
+    read and hashed again on every audit and every launch.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_HASHCACHE_H
+#define MAME_EMU_HASHCACHE_H
+
+#pragma once
+
+#include "hash.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+
+struct sqlite3;
+struct sqlite3_stmt;
+
+
+//**************************************************************************
+//  TYPE DEFINITIONS
+//**************************************************************************
+
+// ======================> hash_cache
+
+// SQLite database of hashes keyed by path, size, modification time and
+// archive member CRC; safe to use from several threads
+class hash_cache
+{
+public:
+	// construction/destruction
+	hash_cache(std::string_view filename);
+	~hash_cache();
+
+	// the cache used by emu_file, if one has been configured
+	static hash_cache *global() { return s_global.get(); }
+	static void set_global(std::string_view filename);
+
+	// getters
+	bool is_open() const { return m_db != nullptr; }
+
+	// look up or record the hashes for a file; loose files use a CRC of zero
+	bool find(std::string_view path, u64 size, s64 mtime, u32 crc, util::hash_collection &hashes);
+	void store(std::string_view path, u64 size, s64 mtime, u32 crc, const util::hash_collection &hashes);
+
+private:
+	// internal helpers
+	void close();
+
+	// internal state
+	std::mutex              m_mutex;            // statements can't be shared by threads
+	std::string             m_filename;         // database file name
+	sqlite3 *               m_db;               // database connection
+	sqlite3_stmt *          m_find;             // prepared lookup statement
+	sqlite3_stmt *          m_store;            // prepared insert statement
+
+	static std::unique_ptr<hash_cache> s_global;
+};
+
+#endif // MAME_EMU_HASHCACHE_H
@@ -20,6 +20,7 @@
 
 #include "server_ws_impl.hpp"
 #include "server_http_impl.hpp"
+#include <atomic>
 #include <fstream>
 
 #include <inttypes.h>
@@ -254,18 +255,25 @@ struct websocket_connection_impl : public http_manager::websocket_connection {
 	webpp::ws_server *m_wsserver;
 	/* The underlying Commection. */
 	std::weak_ptr<webpp::Connection> m_connection;
+	/** Messages waiting to be written, updated from the I/O thread. */
+	std::shared_ptr<std::atomic<unsigned> > m_queued;
 	websocket_connection_impl(webpp::ws_server *server, std::shared_ptr<webpp::Connection> connection)
-		: m_wsserver(server), m_connection(connection) { }
+		: m_wsserver(server), m_connection(connection), m_queued(std::make_shared<std::atomic<unsigned> >(0)) { }
 
 	/** Sends a message to the client that is connected on the other end of this Websocket connection. */
 	virtual void send_message(const std::string &payload, int opcode) override {
 		if (auto connection = m_connection.lock()) {
 			std::shared_ptr<webpp::ws_server::SendStream> message_stream = std::make_shared<webpp::ws_server::SendStream>();
 			(*message_stream) << payload;
-			m_wsserver->send(connection, message_stream, nullptr, opcode | 0x80);
+			++*m_queued;
+			m_wsserver->send(connection, message_stream, [queued = m_queued] (const std::error_code &) { --*queued; }, opcode | 0x80);
 		}
 	}
 
+	virtual unsigned queued_messages() const override {
+		return *m_queued;
+	}
+
 	/** Closes this open Websocket connection. */
 	virtual void close() override {
 		if (auto connection = m_connection.lock()) {
@@ -88,6 +88,9 @@ public:
 		/** Sends a message to the client that is connected on the other end of this Websocket connection. */
 		virtual void send_message(const std::string &payload, int opcode) = 0;
 
+		/** Returns the number of messages sent that have not been written to the socket yet. */
+		virtual unsigned queued_messages() const = 0;
+
 		/** Closes this open Websocket connection. */
 		virtual void close() = 0;
 
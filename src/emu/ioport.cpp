@@ -288,8 +288,10 @@ class inp_header
 {
 public:
 	// parameters
-	static constexpr unsigned MAJVERSION = 3;
+	// version 4 stores a port only when it differs from the previous frame
+	static constexpr unsigned MAJVERSION = 4;
 	static constexpr unsigned MINVERSION = 0;
+	static constexpr unsigned MAJVERSION_FULL = 3;
 
 	bool read(emu_file &f)
 	{
@@ -375,6 +377,45 @@ private:
 	u8                              m_data[OFFS_END];
 };
 
+
+// append a value to a serialized port state in INP byte order
+template <typename Type>
+void inp_put(std::vector<u8> &buffer, Type value)
+{
+	if constexpr (sizeof(value) == 8)
+		value = little_endianize_int64(value);
+	else if constexpr (sizeof(value) == 4)
+		value = little_endianize_int32(value);
+	else if constexpr (sizeof(value) == 2)
+		value = little_endianize_int16(value);
+	u8 const *const bytes = reinterpret_cast<u8 const *>(&value);
+	buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+}
+
+inline void inp_put(std::vector<u8> &buffer, bool value)
+{
+	buffer.push_back(u8(value));
+}
+
+// extract a value from a serialized port state
+template <typename Type>
+void inp_get(u8 const *&ptr, Type &value)
+{
+	std::memcpy(&value, ptr, sizeof(value));
+	ptr += sizeof(value);
+	if constexpr (sizeof(value) == 8)
+		value = little_endianize_int64(value);
+	else if constexpr (sizeof(value) == 4)
+		value = little_endianize_int32(value);
+	else if constexpr (sizeof(value) == 2)
+		value = little_endianize_int16(value);
+}
+
+inline void inp_get(u8 const *&ptr, bool &value)
+{
+	value = bool(*ptr++);
+}
+
 } // anonymous namespace
 
 
@@ -1316,6 +1357,29 @@ void ioport_field::frame_update(ioport_value &result)
 }
 
 
+//-------------------------------------------------
+//  subframe_update - refresh the state of a plain
+//  digital field between frame updates
+//-------------------------------------------------
+
+void ioport_field::subframe_update(ioport_value &result)
+{
+	// impulse, toggle, joystick and coin fields carry state from frame to
+	// frame, so they only change at the frame update
+	if (!enabled() || m_live->analog || m_live->lockout || m_live->toggle || m_live->joystick || m_digital_value || (m_impulse != 0))
+		return;
+	if (m_type >= IPT_COIN1 && m_type <= IPT_COIN12)
+		return;
+	if (machine().ui().is_menu_active())
+		return;
+
+	if (machine().input().seq_pressed(seq()))
+		result |= m_mask;
+	else
+		result &= ~m_mask;
+}
+
+
 //-------------------------------------------------
 //  crosshair_read - compute the crosshair
 //  position
@@ -1574,6 +1638,9 @@ ioport_value ioport_port::read()
 	if (!manager().safe_to_read())
 		throw emu_fatalerror("Input ports cannot be read at init time!");
 
+	// optionally sample the host again just before the value is used
+	manager().late_poll();
+
 	// start with the digital state
 	ioport_value result = m_live->digital;
 
@@ -1621,6 +1688,18 @@ void ioport_port::frame_update()
 }
 
 
+//-------------------------------------------------
+//  subframe_update - refresh the digital bits of
+//  fields without per-frame state
+//-------------------------------------------------
+
+void ioport_port::subframe_update()
+{
+	for (ioport_field &field : m_fieldlist)
+		field.subframe_update(m_live->digital);
+}
+
+
 //-------------------------------------------------
 //  collapse_fields - remove any fields that are
 //  wholly overlapped by other fields
@@ -1774,8 +1853,14 @@ ioport_manager::ioport_manager(running_machine &machine)
 	, m_safe_to_read(false)
 	, m_last_frame_time(attotime::zero)
 	, m_last_delta_nsec(0)
+	, m_subframe_timer(nullptr)
+	, m_subframes(0)
+	, m_subframes_left(0)
+	, m_late_poll_interval(attotime::zero)
+	, m_last_poll_time(attotime::zero)
 	, m_playback_accumulated_speed(0)
 	, m_playback_accumulated_frames(0)
+	, m_playback_compact(false)
 	, m_deselected_card_config()
 	, m_applied_device_defaults(false)
 {
@@ -1866,6 +1951,15 @@ time_t ioport_manager::initialize()
 	// open playback and record files if specified
 	time_t basetime = playback_init();
 	record_init();
+
+	// mid-frame refreshes would not be captured by the input log, so only allow them live
+	m_subframes = machine().options().input_subframes();
+	if (m_subframes > 0 && !m_playback_file && !m_record_file)
+		m_subframe_timer = machine().scheduler().timer_alloc(timer_expired_delegate(FUNC(ioport_manager::subframe_update), this));
+	int const late_poll_usec = machine().options().input_late_poll();
+	if (late_poll_usec > 0 && !m_playback_file && !m_record_file)
+		m_late_poll_interval = attotime::from_usec(late_poll_usec);
+
 	return basetime;
 }
 
@@ -2166,6 +2260,15 @@ void ioport_manager::frame_update()
 	// track the duration of the previous frame
 	m_last_delta_nsec = (curtime - m_last_frame_time).as_attoseconds() / ATTOSECONDS_PER_NANOSECOND;
 	m_last_frame_time = curtime;
+	m_last_poll_time = curtime;
+
+	// spread the mid-frame refreshes evenly over a frame of the same length
+	if (m_subframe_timer && m_last_delta_nsec > 0)
+	{
+		attotime const period(0, m_last_delta_nsec * ATTOSECONDS_PER_NANOSECOND / (m_subframes + 1));
+		m_subframes_left = m_subframes;
+		m_subframe_timer->adjust(period, 0, period);
+	}
 
 	// update the digital joysticks
 	for (digital_joystick &joystick : m_joystick_list)
@@ -2196,6 +2299,72 @@ void ioport_manager::frame_update()
 }
 
 
+//-------------------------------------------------
+//  subframe_update - poll the host and refresh
+//  plain digital inputs between frame updates
+//-------------------------------------------------
+
+void ioport_manager::subframe_update(s32 param)
+{
+	if (m_subframes_left <= 0)
+	{
+		m_subframe_timer->reset();
+		return;
+	}
+	m_subframes_left--;
+
+	if (machine().paused() || !m_safe_to_read)
+		return;
+
+	refresh_digital();
+}
+
+
+//-------------------------------------------------
+//  late_poll_if_stale - poll the host when a port
+//  is read long enough after the last poll
+//-------------------------------------------------
+
+void ioport_manager::late_poll_if_stale()
+{
+	attotime const curtime = machine().time();
+	if (machine().paused() || ((curtime >= m_last_poll_time) && (curtime < (m_last_poll_time + m_late_poll_interval))))
+		return;
+
+	refresh_digital();
+}
+
+
+//-------------------------------------------------
+//  refresh_digital - poll the host and update the
+//  plain digital fields of every port
+//-------------------------------------------------
+
+void ioport_manager::refresh_digital()
+{
+	auto profile = g_profiler.start(PROFILER_INPUT);
+
+	// stamp first: the write handlers below may read ports again
+	m_last_poll_time = machine().time();
+	machine().osd().input_update(false);
+
+	for (auto &port : m_portlist)
+	{
+		ioport_value const olddigital = port.second->live().digital;
+		port.second->subframe_update();
+
+		// call device line write handlers if anything changed
+		if (port.second->live().digital != olddigital && !port.second->live().writelist.empty())
+		{
+			ioport_value const newvalue = port.second->read();
+			for (dynamic_field &dynfield : port.second->live().writelist)
+				if (dynfield.field().type() != IPT_OUTPUT)
+					dynfield.write(newvalue);
+		}
+	}
+}
+
+
 //-------------------------------------------------
 //  frame_interpolate - interpolate between two
 //  values based on the time between frames
@@ -3007,8 +3176,9 @@ time_t ioport_manager::playback_init()
 		fatalerror("Input file is corrupt or invalid (missing header)\n");
 	if (!header.check_magic())
 		fatalerror("Input file invalid or in an older, unsupported format\n");
-	if (header.get_majversion() != inp_header::MAJVERSION)
+	if (header.get_majversion() != inp_header::MAJVERSION && header.get_majversion() != inp_header::MAJVERSION_FULL)
 		fatalerror("Input file format version mismatch\n");
+	m_playback_compact = header.get_majversion() != inp_header::MAJVERSION_FULL;
 
 	// output info to console
 	osd_printf_info("Input file: %s\n", filename);
@@ -3094,8 +3264,36 @@ void ioport_manager::playback_frame(const attotime &curtime)
 
 void ioport_manager::playback_port(ioport_port &port)
 {
+	// compact files flag whether the port changed since the previous frame
+	if (m_playback_stream && m_playback_compact)
+	{
+		std::vector<u8> &played = port.live().played;
+		u8 changed;
+		if (playback_read(changed))
+		{
+			played.resize(port_state_size(port));
+			auto const [err, actual] = read(*m_playback_stream, played.data(), played.size());
+			if (err || (actual != played.size()))
+			{
+				played.clear();
+				playback_end(err ? "Read error" : "End of file");
+				return;
+			}
+		}
+		else if (!m_playback_stream)
+		{
+			return;
+		}
+		else if (played.empty())
+		{
+			playback_end("Corrupt file");
+			return;
+		}
+		port_state_load(port, played);
+	}
+
 	// if playing back, fetch information about this port
-	if (m_playback_stream)
+	else if (m_playback_stream)
 	{
 		// read the default value and the digital state
 		playback_read(port.live().defvalue);
@@ -3234,21 +3432,73 @@ void ioport_manager::record_port(ioport_port &port)
 	// if recording, store information about this port
 	if (m_record_stream)
 	{
-		// store the default value and digital state
-		record_write(port.live().defvalue);
-		record_write(port.live().digital);
-
-		// loop over analog ports and save their data
-		for (analog_field &analog : port.live().analoglist)
+		// only store the port if it changed since the previous frame
+		port_state_save(port, m_record_buffer);
+		std::vector<u8> &recorded = port.live().recorded;
+		if (m_record_buffer == recorded)
 		{
-			// store current and previous values
-			record_write(analog.m_accum);
-			record_write(analog.m_previous);
-
-			// store configuration information
-			record_write(analog.m_sensitivity);
-			record_write(analog.m_reverse);
+			record_write(u8(0));
 		}
+		else
+		{
+			record_write(u8(1));
+			if (m_record_stream && write(*m_record_stream, m_record_buffer.data(), m_record_buffer.size()).first)
+				record_end("Write error");
+			recorded = m_record_buffer;
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  port_state_size - size of a serialized port
+//  state in an input recording
+//-------------------------------------------------
+
+std::size_t ioport_manager::port_state_size(ioport_port &port)
+{
+	// default value and digital state, then accum, previous, sensitivity and reverse per analog field
+	return (2 * sizeof(ioport_value)) + (port.live().analoglist.size() * ((3 * sizeof(s32)) + 1));
+}
+
+
+//-------------------------------------------------
+//  port_state_save - serialize the recorded
+//  state of a port
+//-------------------------------------------------
+
+void ioport_manager::port_state_save(ioport_port &port, std::vector<u8> &buffer)
+{
+	buffer.clear();
+	inp_put(buffer, port.live().defvalue);
+	inp_put(buffer, port.live().digital);
+	for (analog_field &analog : port.live().analoglist)
+	{
+		inp_put(buffer, analog.m_accum);
+		inp_put(buffer, analog.m_previous);
+		inp_put(buffer, analog.m_sensitivity);
+		inp_put(buffer, analog.m_reverse);
+	}
+}
+
+
+//-------------------------------------------------
+//  port_state_load - apply a serialized port
+//  state from an input recording
+//-------------------------------------------------
+
+void ioport_manager::port_state_load(ioport_port &port, std::vector<u8> const &buffer)
+{
+	assert(buffer.size() == port_state_size(port));
+	u8 const *ptr = buffer.data();
+	inp_get(ptr, port.live().defvalue);
+	inp_get(ptr, port.live().digital);
+	for (analog_field &analog : port.live().analoglist)
+	{
+		inp_get(ptr, analog.m_accum);
+		inp_get(ptr, analog.m_previous);
+		inp_get(ptr, analog.m_sensitivity);
+		inp_get(ptr, analog.m_reverse);
 	}
 }
 
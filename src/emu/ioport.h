@@ -646,6 +646,7 @@ public:
 	float crosshair_read() const;
 	void init_live_state(analog_field *analog);
 	void frame_update(ioport_value &result);
+	void subframe_update(ioport_value &result);
 	void reduce_mask(ioport_value bits_to_remove) { m_mask &= ~bits_to_remove; }
 
 	// user-controllable settings for a field
@@ -781,6 +782,7 @@ public:
 	ioport_field *field(ioport_value mask) const;
 	void collapse_fields(std::string &errorbuf);
 	void frame_update();
+	void subframe_update();
 	void init_live_state();
 	void update_defvalue(bool flush_defaults);
 
@@ -919,6 +921,8 @@ struct ioport_port_live
 	ioport_value            defvalue;           // combined default value across the port
 	ioport_value            digital;            // current value from all digital inputs
 	ioport_value            outputvalue;        // current value for outputs
+	std::vector<u8>         played;             // last state read from an input recording
+	std::vector<u8>         recorded;           // last state written to an input recording
 };
 
 
@@ -941,6 +945,7 @@ public:
 	running_machine &machine() const noexcept { return m_machine; }
 	const ioport_list &ports() const noexcept { return m_portlist; }
 	bool safe_to_read() const noexcept { return m_safe_to_read; }
+	void late_poll() { if (m_late_poll_interval != attotime::zero) late_poll_if_stale(); }
 
 	// type helpers
 	const std::vector<input_type_entry> &types() const noexcept { return m_typelist; }
@@ -966,6 +971,9 @@ private:
 
 	void frame_update_callback();
 	void frame_update();
+	void subframe_update(s32 param);
+	void refresh_digital();
+	void late_poll_if_stale();
 
 	ioport_port *port(const std::string &tag) const { auto search = m_portlist.find(tag); if (search != m_portlist.end()) return search->second.get(); else return nullptr; }
 	void exit();
@@ -996,6 +1004,10 @@ private:
 	void record_frame(const attotime &curtime);
 	void record_port(ioport_port &port);
 
+	static std::size_t port_state_size(ioport_port &port);
+	void port_state_save(ioport_port &port, std::vector<u8> &buffer);
+	void port_state_load(ioport_port &port, std::vector<u8> const &buffer);
+
 	// internal state
 	running_machine &       m_machine;              // reference to owning machine
 	bool                    m_safe_to_read;         // clear at start; set after state is loaded
@@ -1012,6 +1024,13 @@ private:
 	attotime                m_last_frame_time;      // time of the last frame callback
 	attoseconds_t           m_last_delta_nsec;      // nanoseconds that passed since the previous callback
 
+	// mid-frame input refresh
+	emu_timer *             m_subframe_timer;       // timer for refreshing digital inputs within a frame (nullptr if disabled)
+	int                     m_subframes;            // number of refreshes per frame
+	int                     m_subframes_left;       // refreshes still to do in the current frame
+	attotime                m_late_poll_interval;   // minimum time between on-demand polls (zero if disabled)
+	attotime                m_last_poll_time;       // time of the last frame, mid-frame or on-demand poll
+
 	// playback/record information
 	std::unique_ptr<emu_file> m_record_file;        // recording file (nullptr if not recording)
 	std::unique_ptr<emu_file> m_playback_file;      // playback file (nullptr if not recording)
@@ -1019,6 +1038,8 @@ private:
 	util::read_stream::ptr  m_playback_stream;      // playback stream (nullptr if not recording)
 	u64                     m_playback_accumulated_speed; // accumulated speed during playback
 	u32                     m_playback_accumulated_frames; // accumulated frames during playback
+	bool                    m_playback_compact;     // playback file only stores ports that changed
+	std::vector<u8>         m_record_buffer;        // scratch buffer for serializing a port
 
 	// storage for inactive configuration
 	std::unique_ptr<util::xml::file> m_deselected_card_config;
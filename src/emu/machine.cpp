@@ -25,12 +25,14 @@
 #include "network.h"
 #include "render.h"
 #include "romload.h"
+#include "screen.h"
 #include "tilemap.h"
 #include "uiinput.h"
 
 #include "ui/uimain.h"
 
 #include "corestr.h"
+#include "ioprocsvec.h"
 #include "unzip.h"
 
 #include "osdepend.h"
@@ -50,6 +52,52 @@
 //  RUNNING MACHINE
 //**************************************************************************
 
+// a saved state captured on the emulation thread, waiting to be compressed
+// and written out by a worker
+struct running_machine::background_save
+{
+	std::unique_ptr<emu_file>           file;
+	std::string                         filename;
+	std::vector<u8>                     state;
+	save_manager::file_compression      compression;
+	save_error                          result;
+};
+
+// timestamps of startup phases and device starts, written out as a Chrome
+// trace event file once the machine has finished starting
+struct running_machine::startup_trace
+{
+	struct event
+	{
+		std::string     name;
+		char const *    category;
+		osd_ticks_t     start;
+		osd_ticks_t     end;
+	};
+
+	startup_trace() : base(osd_ticks()), phase_start(base) { }
+
+	// close the current phase and open the next one
+	void phase(char const *name)
+	{
+		osd_ticks_t const now = osd_ticks();
+		if (phase_name)
+			events.push_back(event{ phase_name, "phase", phase_start, now });
+		phase_name = name;
+		phase_start = now;
+	}
+
+	void device(device_t const &dev, osd_ticks_t start)
+	{
+		events.push_back(event{ util::string_format("%s '%s'", dev.name(), dev.tag()), "device", start, osd_ticks() });
+	}
+
+	osd_ticks_t             base;
+	osd_ticks_t             phase_start;
+	char const *            phase_name = nullptr;
+	std::vector<event>      events;
+};
+
 osd_interface &running_machine::osd() const
 {
 	return m_manager.osd();
@@ -73,9 +121,11 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 	, m_rand_seed(0x9d14abd7)
 	, m_basename(_config.gamedrv().name)
 	, m_sample_rate(_config.options().sample_rate())
+	, m_logflush_time(0)
 	, m_saveload_schedule(saveload_schedule::NONE)
 	, m_saveload_schedule_time(attotime::zero)
 	, m_saveload_searchpath(nullptr)
+	, m_save_queue(nullptr)
 
 	, m_save(*this)
 	, m_memory(*this)
@@ -102,6 +152,14 @@ running_machine::running_machine(const machine_config &_config, machine_manager
 
 running_machine::~running_machine()
 {
+	// a state may still be in flight if we got here via an exception
+	if (m_save_queue)
+	{
+		while (!osd_work_queue_wait(m_save_queue, osd_ticks_per_second()))
+		{
+		}
+		osd_work_queue_free(m_save_queue);
+	}
 }
 
 
@@ -137,7 +195,13 @@ std::string running_machine::describe_context() const
 
 void running_machine::start()
 {
+	// collect timings if a startup trace was requested
+	if (*options().startup_trace())
+		m_startup_trace = std::make_unique<startup_trace>();
+	auto const trace_phase = [this] (char const *name) { if (m_startup_trace) m_startup_trace->phase(name); };
+
 	// initialize basic can't-fail systems here
+	trace_phase("core managers");
 	m_configuration = std::make_unique<configuration_manager>(*this);
 	m_input = std::make_unique<input_manager>(*this);
 	m_output = std::make_unique<output_manager>(*this);
@@ -151,9 +215,11 @@ void running_machine::start()
 	m_ui_input = std::make_unique<ui_input_manager>(*this);
 
 	// init the OSD layer
+	trace_phase("OSD init");
 	m_manager.osd().init(*this);
 
 	// create the video manager and UI manager
+	trace_phase("video and UI");
 	m_video = std::make_unique<video_manager>(*this);
 	m_ui = manager().create_ui(*this);
 	m_ui->set_startup_text("Initializing...", true);
@@ -164,6 +230,7 @@ void running_machine::start()
 	// initialize the input system and input ports for the game
 	// this must be done before memory_init in order to allow specifying
 	// callbacks based on input port tags
+	trace_phase("input ports");
 	time_t newbase = m_ioport.initialize();
 	if (newbase != 0)
 		m_base_time = newbase;
@@ -172,9 +239,11 @@ void running_machine::start()
 	m_natkeyboard = std::make_unique<natural_keyboard>(*this);
 
 	// initialize the streams engine before the sound devices start
+	trace_phase("sound");
 	m_sound = std::make_unique<sound_manager>(*this);
 
 	// resolve objects that can be used by memory maps
+	trace_phase("resolve pre-map");
 	for (device_t &device : device_enumerator(root_device()))
 		device.resolve_pre_map();
 
@@ -183,19 +252,23 @@ void running_machine::start()
 	// needs rom bases), and finally initialize CPUs (which needs
 	// complete address spaces).  These operations must proceed in this
 	// order
+	trace_phase("ROM load");
 	m_rom_load = std::make_unique<rom_load_manager>(*this);
+	trace_phase("memory");
 	m_memory.initialize();
 
 	// save the random seed or save states might be broken in drivers that use the rand() method
 	save().save_item(NAME(m_rand_seed));
 
 	// initialize image devices
+	trace_phase("images and managers");
 	m_image = std::make_unique<image_manager>(*this);
 	m_tilemap = std::make_unique<tilemap_manager>(*this);
 	m_crosshair = std::make_unique<crosshair_manager>(*this);
 	m_network = std::make_unique<network_manager>(*this);
 
 	// initialize the debugger
+	trace_phase("debugger");
 	if ((debug_flags & DEBUG_FLAG_ENABLED) != 0)
 	{
 		m_debug_view = std::make_unique<debug_view_manager>(*this);
@@ -205,25 +278,35 @@ void running_machine::start()
 	manager().create_custom(*this);
 
 	// resolve objects that are created by memory maps
+	trace_phase("resolve post-map");
 	for (device_t &device : device_enumerator(root_device()))
 		device.resolve_post_map();
 
 	// register callbacks for the devices, then start them
 	add_notifier(MACHINE_NOTIFY_RESET, machine_notify_delegate(&running_machine::reset_all_devices, this));
 	add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&running_machine::stop_all_devices, this));
+	if (options().schedstats())
+	{
+		m_scheduler.set_host_timing(true);
+		add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&device_scheduler::dump_stats, &m_scheduler));
+	}
 	save().register_presave(save_prepost_delegate(FUNC(running_machine::presave_all_devices), this));
+	trace_phase("device start");
 	start_all_devices();
 	save().register_postload(save_prepost_delegate(FUNC(running_machine::postload_all_devices), this));
 
 	// save outputs created before start time
+	trace_phase("outputs and render");
 	output().register_save();
 
 	m_render->resolve_tags();
 
 	// load cheat files
+	trace_phase("cheats");
 	manager().load_cheatfiles(*this);
 
 	// start recording movie if specified
+	trace_phase("movie recording");
 	const char *filename = options().mng_write();
 	if (filename[0] != 0)
 		m_video->begin_recording(filename, movie_recording::format::MNG);
@@ -232,6 +315,10 @@ void running_machine::start()
 	if (filename[0] != 0 && !m_video->is_recording())
 		m_video->begin_recording(filename, movie_recording::format::AVI);
 
+	filename = options().raw_write();
+	if (filename[0] != 0 && !m_video->is_recording())
+		m_video->begin_recording(filename, movie_recording::format::RAW);
+
 	// if we're coming in with a savegame request, process it now
 	const char *savegame = options().state();
 	if (savegame[0] != 0)
@@ -241,7 +328,63 @@ void running_machine::start()
 	else if (options().autosave() && (m_system.flags & MACHINE_SUPPORTS_SAVE) != 0)
 		schedule_load("auto");
 
+	trace_phase("update machine");
 	manager().update_machine();
+
+	if (m_startup_trace)
+	{
+		m_startup_trace->phase(nullptr);
+		write_startup_trace();
+		m_startup_trace.reset();
+	}
+}
+
+
+//-------------------------------------------------
+//  write_startup_trace - write the collected
+//  startup timings as Chrome trace event JSON
+//-------------------------------------------------
+
+void running_machine::write_startup_trace()
+{
+	char const *const filename = options().startup_trace();
+	emu_file file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(filename))
+	{
+		osd_printf_error("Error creating startup trace file %s\n", filename);
+		return;
+	}
+
+	rapidjson::StringBuffer buffer;
+	rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+	double const scale = 1000000.0 / double(osd_ticks_per_second());
+	writer.StartObject();
+	writer.Key("traceEvents");
+	writer.StartArray();
+	for (startup_trace::event const &ev : m_startup_trace->events)
+	{
+		writer.StartObject();
+		writer.Key("name");
+		writer.String(ev.name.c_str(), ev.name.length());
+		writer.Key("cat");
+		writer.String(ev.category);
+		writer.Key("ph");
+		writer.String("X");
+		writer.Key("ts");
+		writer.Double(double(ev.start - m_startup_trace->base) * scale);
+		writer.Key("dur");
+		writer.Double(double(ev.end - ev.start) * scale);
+		writer.Key("pid");
+		writer.Int(1);
+		writer.Key("tid");
+		writer.Int(1);
+		writer.EndObject();
+	}
+	writer.EndArray();
+	writer.Key("displayTimeUnit");
+	writer.String("ms");
+	writer.EndObject();
+	file.write(buffer.GetString(), buffer.GetSize());
 }
 
 
@@ -269,6 +412,8 @@ int running_machine::run(bool quiet)
 			if (filerr)
 				throw emu_fatalerror("running_machine::run: unable to open error.log file");
 
+			m_logflush_time = osd_ticks();
+
 			using namespace std::placeholders;
 			add_logerror_callback(std::bind(&running_machine::logfile_callback, this, _1));
 		}
@@ -330,7 +475,15 @@ int running_machine::run(bool quiet)
 
 			// execute CPUs if not paused
 			if (!m_paused)
+			{
 				m_scheduler.timeslice();
+				if (m_video->runahead_pending())
+					run_ahead();
+
+				// reverse execution snapshots are captured and restored between timeslices
+				if ((debug_flags & DEBUG_FLAG_ENABLED) != 0)
+					debugger().cpu().reverse_update();
+			}
 			// otherwise, just pump video updates through
 			else
 				m_video->frame_update();
@@ -339,7 +492,9 @@ int running_machine::run(bool quiet)
 			if (m_saveload_schedule != saveload_schedule::NONE)
 				handle_saveload();
 		}
+		wait_background_save();
 		m_manager.http()->clear();
+		http_telemetry_stop();
 
 		// and out via the exit phase
 		m_current_phase = machine_phase::EXIT;
@@ -390,8 +545,10 @@ int running_machine::run(bool quiet)
 	// call all exit callbacks registered
 	call_notifiers(MACHINE_NOTIFY_EXIT);
 	util::archive_file::cache_clear();
+	emu_file::cache_clear();
 
 	// close the logfile
+	flush_logfile();
 	m_logfile.reset();
 	return error;
 }
@@ -879,13 +1036,25 @@ void running_machine::handle_saveload()
 		{
 			u32 const openflags = (m_saveload_schedule == saveload_schedule::LOAD) ? OPEN_FLAG_READ : (OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
 
+			// finish writing any earlier state before touching files again
+			wait_background_save();
+
 			// open the file
-			emu_file file(m_saveload_searchpath ? m_saveload_searchpath : "", openflags);
-			auto const filerr = file.open(m_saveload_pending_file);
+			auto file = std::make_unique<emu_file>(m_saveload_searchpath ? m_saveload_searchpath : "", openflags);
+			auto const filerr = file->open(m_saveload_pending_file);
 			if (!filerr)
 			{
 				// read/write the save state
-				save_error saverr = (m_saveload_schedule == saveload_schedule::LOAD) ? m_save.read_file(file) : m_save.write_file(file);
+				save_manager::file_compression const compression = !strcmp(options().state_compression(), "zstd")
+						? save_manager::file_compression::ZSTD
+						: save_manager::file_compression::ZLIB;
+				save_error saverr;
+				if (m_saveload_schedule == saveload_schedule::LOAD)
+					saverr = m_save.read_file(*file);
+				else if (options().state_background())
+					saverr = start_background_save(file, compression);
+				else
+					saverr = m_save.write_file(*file, compression);
 
 				// handle the result
 				switch (saverr)
@@ -918,8 +1087,8 @@ void running_machine::handle_saveload()
 				}
 
 				// close and perhaps delete the file
-				if (saverr != STATERR_NONE && m_saveload_schedule == saveload_schedule::SAVE)
-					file.remove_on_close();
+				if (file && saverr != STATERR_NONE && m_saveload_schedule == saveload_schedule::SAVE)
+					file->remove_on_close();
 			}
 			else if ((openflags == OPEN_FLAG_READ) && (std::errc::no_such_file_or_directory == filerr))
 			{
@@ -940,6 +1109,108 @@ void running_machine::handle_saveload()
 }
 
 
+//-------------------------------------------------
+//  run_ahead - emulate the frames ahead of the
+//  one that just finished so the last of them can
+//  be presented, then restore the machine state
+//-------------------------------------------------
+
+void running_machine::run_ahead()
+{
+	// anonymous timers would be lost when the state is restored
+	if (!m_scheduler.can_save() || m_hard_reset_pending || m_exit_pending)
+	{
+		m_video->end_runahead(false);
+		return;
+	}
+
+	// unchanged pages are shared with the previous capture, so this mostly compares memory
+	if (!m_runahead_state)
+		m_runahead_state = std::make_unique<ram_state>(m_save);
+	save_error err = m_runahead_state->save(m_runahead_pages.empty() ? nullptr : &m_runahead_pages);
+	if (err != STATERR_NONE)
+	{
+		logerror("Runahead: unable to capture state (error %d)\n", int(err));
+		m_runahead_pages.clear();
+		m_video->end_runahead(false);
+		return;
+	}
+	m_runahead_pages = m_runahead_state->keyframe_pages();
+
+	// emulate the speculative frames without producing any audio
+	m_sound->set_speculative(true);
+	m_video->begin_runahead();
+	while (m_video->speculating() && !m_hard_reset_pending && !m_exit_pending)
+		m_scheduler.timeslice();
+	m_sound->set_speculative(false);
+
+	err = m_runahead_state->load();
+	if (err != STATERR_NONE)
+		popmessage("Error: Unable to restore state after runahead (error %d).", int(err));
+	m_video->end_runahead(err == STATERR_NONE);
+}
+
+
+//-------------------------------------------------
+//  start_background_save - capture the state and
+//  hand the file over to a worker to compress and
+//  write it
+//-------------------------------------------------
+
+save_error running_machine::start_background_save(std::unique_ptr<emu_file> &file, save_manager::file_compression compression)
+{
+	auto job = std::make_unique<background_save>();
+	save_error const err = m_save.write_buffer(job->state);
+	if (err != STATERR_NONE)
+		return err;
+
+	if (!m_save_queue)
+		m_save_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	job->file = std::move(file);
+	job->filename = m_saveload_pending_file;
+	job->compression = compression;
+	job->result = STATERR_NONE;
+	m_background_save = std::move(job);
+	osd_work_item_queue(m_save_queue, background_save_work, m_background_save.get(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	return STATERR_NONE;
+}
+
+
+//-------------------------------------------------
+//  wait_background_save - wait for the state being
+//  written in the background, and report errors
+//-------------------------------------------------
+
+void running_machine::wait_background_save()
+{
+	if (!m_background_save)
+		return;
+
+	while (!osd_work_queue_wait(m_save_queue, osd_ticks_per_second()))
+	{
+	}
+	if (m_background_save->result != STATERR_NONE)
+		popmessage("Error: Unable to save state to %s due to a write error. Verify there is enough disk space.", m_background_save->filename);
+	m_background_save.reset();
+}
+
+
+//-------------------------------------------------
+//  background_save_work - work item callback for
+//  writing a state
+//-------------------------------------------------
+
+void *running_machine::background_save_work(void *param, int threadid)
+{
+	background_save &job = *reinterpret_cast<background_save *>(param);
+	job.result = save_manager::write_file(*job.file, job.state, job.compression);
+	if (job.result != STATERR_NONE)
+		job.file->remove_on_close();
+	job.file.reset();
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  soft_reset - actually perform a soft-reset
 //  of the system
@@ -969,9 +1240,29 @@ void running_machine::logfile_callback(const char *buffer)
 {
 	if (m_logfile != nullptr)
 	{
-		m_logfile->puts(buffer);
+		// batch messages rather than writing each one as it arrives; pending
+		// text still reaches the file within a quarter of a second
+		m_logbuffer.append(buffer);
+		if ((m_logbuffer.size() >= 65536) || ((osd_ticks() - m_logflush_time) >= (osd_ticks_per_second() / 4)))
+			flush_logfile();
+	}
+}
+
+
+//-------------------------------------------------
+//  flush_logfile - write out any buffered
+//  error.log text
+//-------------------------------------------------
+
+void running_machine::flush_logfile()
+{
+	if (m_logfile != nullptr && !m_logbuffer.empty())
+	{
+		m_logfile->puts(m_logbuffer);
 		m_logfile->flush();
 	}
+	m_logbuffer.clear();
+	m_logflush_time = osd_ticks();
 }
 
 
@@ -1010,7 +1301,10 @@ void running_machine::start_all_devices()
 
 					// now start the device
 					osd_printf_verbose("Starting %s '%s'\n", device.name(), device.tag());
+					osd_ticks_t const start = m_startup_trace ? osd_ticks() : 0;
 					device.start();
+					if (m_startup_trace)
+						m_startup_trace->device(device, start);
 				}
 				catch (device_missing_dependencies const &)
 				{
@@ -1155,19 +1449,32 @@ void running_machine::nvram_save()
 	{
 		if (nvram.nvram_can_save())
 		{
-			emu_file file(options().nvram_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
-			if (!file.open(nvram_filename(nvram.device())))
+			// serialize to memory first, so unchanged contents needn't be rewritten
+			std::vector<u8> data;
+			util::vector_read_write_adapter<u8> buffer(data);
+			bool const error = !nvram.nvram_save(buffer);
+			std::string const filename = nvram_filename(nvram.device());
+			if (!error && !data.empty())
 			{
-				bool error = false;
-
-				if (!nvram.nvram_save(file))
+				emu_file existing(options().nvram_directory(), OPEN_FLAG_READ);
+				if (!existing.open(filename) && (existing.size() == data.size()))
 				{
-					error = true;
-					osd_printf_error("Error writing NVRAM file %s\n", file.filename());
+					std::vector<u8> previous(data.size());
+					if ((existing.read(previous.data(), previous.size()) == previous.size()) && (previous == data))
+						continue;
 				}
+			}
+
+			emu_file file(options().nvram_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+			if (!file.open(filename))
+			{
+				if (error)
+					osd_printf_error("Error writing NVRAM file %s\n", file.filename());
+				else if (!data.empty())
+					file.write(data.data(), data.size());
 
 				// close and perhaps delete the file
-				if (error || file.size() == 0)
+				if (error || data.empty())
 					file.remove_on_close();
 				file.close();
 			}
@@ -1215,6 +1522,77 @@ running_machine::logerror_callback_item::logerror_callback_item(logerror_callbac
 {
 }
 
+/*-------------------------------------------------
+    Telemetry websocket
+
+    Messages to clients are binary, little-endian,
+    and start with a type byte:
+
+    FRAME     u64 frame number, f64 emulated time
+              in seconds, f32 speed percentage,
+              f32 host milliseconds since the last
+              frame, u64 scheduler timeslices and
+              u64 timers fired, u32 sound samples
+              this update, u16 count of outputs
+              followed by (u32 id, s32 value) for
+              each output changed since the last
+              frame, coalesced by the output
+              manager (all of them at first)
+    OUTPUT    u32 id, u16 len, len bytes of name;
+              sent before an id is first used
+    SCREEN    u8 screen, u16 width, u16 height,
+              then RGB565 pixels, row by row
+
+    Clients with several messages still waiting
+    to be written skip frames rather than letting
+    the queue grow.  "screen <divisor> [<frames>]"
+    from a client requests screen images scaled
+    down by divisor every given number of frames.
+-------------------------------------------------*/
+
+struct running_machine::http_telemetry
+{
+	enum : u8
+	{
+		MESSAGE_FRAME = 1,
+		MESSAGE_OUTPUT,
+		MESSAGE_SCREEN
+	};
+
+	// frames are dropped for clients with more than this many messages pending
+	static constexpr unsigned MAX_QUEUED = 4;
+
+	struct client
+	{
+		http_manager::websocket_connection_ptr connection;
+		bool synced = false;            // has been sent all output names and values
+		unsigned screen_divisor = 0;    // 0 for no screen images
+		unsigned screen_interval = 1;
+	};
+
+	void remove(http_manager::websocket_connection_ptr const &connection)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		clients.erase(
+				std::remove_if(clients.begin(), clients.end(), [&connection] (client const &c) { return c.connection == connection; }),
+				clients.end());
+	}
+
+	template <typename T> static void put(std::string &message, T value)
+	{
+		for (unsigned i = 0; sizeof(T) > i; i++, value >>= 8)
+			message.push_back(char(u8(value)));
+	}
+
+	std::mutex mutex;                               // protects clients
+	std::vector<client> clients;
+	std::vector<std::pair<u32, s32> > changed;      // outputs changed this frame
+	std::vector<bool> named;                        // output ids with names sent
+	osd_ticks_t last_frame;
+	std::vector<u32> pixels;
+};
+
+
 void running_machine::export_http_api()
 {
 	if (m_manager.http()->is_active()) {
@@ -1240,6 +1618,201 @@ void running_machine::export_http_api()
 			response->set_content_type("application/json");
 			response->set_body(s.GetString());
 		});
+
+		// stream statistics to websocket clients once per frame
+		m_http_telemetry = std::make_shared<http_telemetry>();
+		m_http_telemetry->last_frame = osd_ticks();
+		m_manager.http()->remove_endpoint("/api/telemetry");
+		m_manager.http()->add_endpoint(
+				"/api/telemetry",
+				[telemetry = m_http_telemetry] (http_manager::websocket_connection_ptr connection)
+				{
+					std::lock_guard<std::mutex> lock(telemetry->mutex);
+					telemetry->clients.emplace_back(http_telemetry::client{ std::move(connection) });
+				},
+				[telemetry = m_http_telemetry] (http_manager::websocket_connection_ptr connection, const std::string &payload, int opcode)
+				{
+					// "screen <divisor> [<frames>]" sets up screen images, divisor 0 to stop
+					unsigned divisor = 0, interval = 1;
+					if (sscanf(payload.c_str(), "screen %u %u", &divisor, &interval) < 1)
+						return;
+					std::lock_guard<std::mutex> lock(telemetry->mutex);
+					for (http_telemetry::client &client : telemetry->clients)
+					{
+						if (client.connection == connection)
+						{
+							client.screen_divisor = std::min(divisor, 64U);
+							client.screen_interval = std::max(interval, 1U);
+						}
+					}
+				},
+				[telemetry = m_http_telemetry] (http_manager::websocket_connection_ptr connection, int status, std::string const &reason)
+				{
+					telemetry->remove(connection);
+				},
+				[telemetry = m_http_telemetry] (http_manager::websocket_connection_ptr connection, std::error_code const &error_code)
+				{
+					telemetry->remove(connection);
+				});
+		m_output->set_global_batch_notifier(&running_machine::http_telemetry_output, this);
+		add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&running_machine::http_telemetry_frame, this));
+	}
+}
+
+
+void running_machine::http_telemetry_stop()
+{
+	if (!m_http_telemetry)
+		return;
+
+	// clients reconnect to get the next machine
+	m_manager.http()->remove_endpoint("/api/telemetry");
+	{
+		std::lock_guard<std::mutex> lock(m_http_telemetry->mutex);
+		for (auto &client : m_http_telemetry->clients)
+			client.connection->close();
+		m_http_telemetry->clients.clear();
+	}
+	m_http_telemetry.reset();
+}
+
+
+void running_machine::http_telemetry_output(output_manager::output_change const *changes, size_t count, void *param)
+{
+	running_machine &machine = *reinterpret_cast<running_machine *>(param);
+	if (machine.m_http_telemetry)
+	{
+		for (size_t i = 0; i < count; i++)
+			machine.m_http_telemetry->changed.emplace_back(changes[i].id, changes[i].value);
+	}
+}
+
+
+void running_machine::http_telemetry_frame()
+{
+	if (!m_http_telemetry)
+		return;
+
+	http_telemetry &telemetry = *m_http_telemetry;
+	osd_ticks_t const now = osd_ticks();
+	float const frame_ms = float(double(now - telemetry.last_frame) * 1000.0 / double(osd_ticks_per_second()));
+	telemetry.last_frame = now;
+
+	std::lock_guard<std::mutex> lock(telemetry.mutex);
+	if (telemetry.clients.empty())
+	{
+		telemetry.changed.clear();
+		return;
+	}
+
+	screen_device *const screen = screen_device_enumerator(root_device()).first();
+	u64 const frame = screen ? screen->frame_number() : 0;
+
+	// describe any newly seen outputs to everyone, and everything to new clients
+	std::vector<std::pair<u32, s32> > all;
+	bool const syncing = std::any_of(telemetry.clients.begin(), telemetry.clients.end(), [] (auto const &c) { return !c.synced; });
+	if (syncing)
+		output().notify_all([this, &all] (const char *outname, s32 value) { all.emplace_back(output().name_to_id(outname), value); });
+
+	auto const output_message =
+			[this] (u32 id)
+			{
+				std::string message;
+				char const *const name = output().id_to_name(id);
+				size_t const length = std::min<size_t>(strlen(name), 0xffff);
+				http_telemetry::put<u8>(message, http_telemetry::MESSAGE_OUTPUT);
+				http_telemetry::put<u32>(message, id);
+				http_telemetry::put<u16>(message, length);
+				message.append(name, length);
+				return message;
+			};
+	for (auto const &change : telemetry.changed)
+	{
+		if (telemetry.named.size() <= change.first)
+			telemetry.named.resize(change.first + 1, false);
+		if (!telemetry.named[change.first])
+		{
+			telemetry.named[change.first] = true;
+			std::string const message = output_message(change.first);
+			for (auto &client : telemetry.clients)
+				if (client.synced)
+					client.connection->send_message(message, 2);
+		}
+	}
+
+	auto const frame_message =
+			[this, &telemetry, frame, frame_ms] (std::vector<std::pair<u32, s32> > const &outputs)
+			{
+				std::string message;
+				http_telemetry::put<u8>(message, http_telemetry::MESSAGE_FRAME);
+				http_telemetry::put<u64>(message, frame);
+				double const seconds = time().as_double();
+				float const speed = float(video().speed_percent() * 100.0);
+				u64 seconds_bits;
+				u32 speed_bits, frame_bits;
+				std::memcpy(&seconds_bits, &seconds, sizeof(seconds_bits));
+				std::memcpy(&speed_bits, &speed, sizeof(speed_bits));
+				std::memcpy(&frame_bits, &frame_ms, sizeof(frame_bits));
+				http_telemetry::put<u64>(message, seconds_bits);
+				http_telemetry::put<u32>(message, speed_bits);
+				http_telemetry::put<u32>(message, frame_bits);
+				http_telemetry::put<u64>(message, scheduler().timeslice_count());
+				http_telemetry::put<u64>(message, scheduler().timer_fire_count());
+				http_telemetry::put<u32>(message, sound().sample_count());
+				size_t const count = std::min<size_t>(outputs.size(), 0xffff);
+				http_telemetry::put<u16>(message, count);
+				for (size_t i = 0; count > i; i++)
+				{
+					http_telemetry::put<u32>(message, outputs[i].first);
+					http_telemetry::put<s32>(message, outputs[i].second);
+				}
+				return message;
+			};
+	std::string const update = frame_message(telemetry.changed);
+	telemetry.changed.clear();
+
+	for (auto &client : telemetry.clients)
+	{
+		if (!client.synced)
+		{
+			for (auto const &item : all)
+				client.connection->send_message(output_message(item.first), 2);
+			client.connection->send_message(frame_message(all), 2);
+			client.synced = true;
+			continue;
+		}
+
+		// slow clients miss frames entirely rather than receive stale ones
+		if (client.connection->queued_messages() > http_telemetry::MAX_QUEUED)
+			continue;
+		client.connection->send_message(update, 2);
+
+		if (screen && client.screen_divisor && !(frame % client.screen_interval))
+		{
+			rectangle const &visarea = screen->visible_area();
+			u32 const width = visarea.width(), height = visarea.height();
+			telemetry.pixels.resize(width * height);
+			screen->pixels(&telemetry.pixels[0]);
+
+			u32 const divisor = client.screen_divisor;
+			u32 const outwidth = width / divisor, outheight = height / divisor;
+			std::string message;
+			message.reserve(5 + (outwidth * outheight * 2));
+			http_telemetry::put<u8>(message, http_telemetry::MESSAGE_SCREEN);
+			http_telemetry::put<u8>(message, 0);
+			http_telemetry::put<u16>(message, outwidth);
+			http_telemetry::put<u16>(message, outheight);
+			for (u32 y = 0; outheight > y; y++)
+			{
+				u32 const *const row = &telemetry.pixels[y * divisor * width];
+				for (u32 x = 0; outwidth > x; x++)
+				{
+					rgb_t const pixel(row[x * divisor]);
+					http_telemetry::put<u16>(message, ((pixel.r() >> 3) << 11) | ((pixel.g() >> 2) << 5) | (pixel.b() >> 3));
+				}
+			}
+			client.connection->send_message(message, 2);
+		}
 	}
 }
 
@@ -246,6 +246,10 @@ private:
 	void start();
 	void set_saveload_filename(std::string &&filename);
 	void handle_saveload();
+	void run_ahead();
+	save_error start_background_save(std::unique_ptr<emu_file> &file, save_manager::file_compression compression);
+	void wait_background_save();
+	static void *background_save_work(void *param, int threadid);
 	void soft_reset(s32 param = 0);
 	std::string nvram_filename(device_t &device) const;
 	void nvram_load();
@@ -255,6 +259,7 @@ private:
 
 	// internal callbacks
 	void logfile_callback(const char *buffer);
+	void flush_logfile();
 
 	// internal device helpers
 	void start_all_devices();
@@ -299,6 +304,8 @@ private:
 	std::string             m_basename;             // basename used for game-related paths
 	int                     m_sample_rate;          // the digital audio sample rate
 	std::unique_ptr<emu_file>  m_logfile;           // pointer to the active error.log file
+	std::string             m_logbuffer;            // error.log text not yet written out
+	osd_ticks_t             m_logflush_time;        // when error.log was last written
 	std::unique_ptr<emu_file>  m_debuglogfile;      // pointer to the active debug.log file
 
 	// load/save management
@@ -313,6 +320,27 @@ private:
 	std::string             m_saveload_pending_file;
 	const char *            m_saveload_searchpath;
 
+	// saved states being compressed and written on a worker thread
+	struct background_save;
+	osd_work_queue *        m_save_queue;
+	std::unique_ptr<background_save> m_background_save;
+
+	// in-memory state restored after each runahead
+	std::unique_ptr<ram_state> m_runahead_state;
+	ram_state::page_list    m_runahead_pages;
+
+	// phase and device start timings, collected when a startup trace is requested
+	struct startup_trace;
+	std::unique_ptr<startup_trace> m_startup_trace;
+	void write_startup_trace();
+
+	// clients of the telemetry websocket, shared with the HTTP server thread
+	struct http_telemetry;
+	std::shared_ptr<http_telemetry> m_http_telemetry;
+	void http_telemetry_frame();
+	void http_telemetry_stop();
+	static void http_telemetry_output(output_manager::output_change const *changes, size_t count, void *param);
+
 	// notifier callbacks
 	struct notifier_callback_item
 	{
@@ -31,6 +31,7 @@ output_manager::output_item::output_item(
 	, m_name(std::move(name))
 	, m_id(id)
 	, m_value(value)
+	, m_dirty(false)
 	, m_notifylist()
 {
 }
@@ -49,6 +50,13 @@ void output_manager::output_item::notify(s32 value)
 	// call the global notifiers next
 	for (auto const &notify : m_manager.m_global_notifylist)
 		notify(m_name.c_str(), value);
+
+	// batch notifiers only hear about the item once per flush
+	if (!m_dirty && !m_manager.m_batch_notifylist.empty())
+	{
+		m_dirty = true;
+		m_manager.m_dirty.emplace_back(this);
+	}
 }
 
 
@@ -78,6 +86,8 @@ output_manager::output_manager(running_machine &machine)
 	, m_uniqueid(12345)
 {
 	// add callbacks
+	machine.add_notifier(MACHINE_NOTIFY_FRAME, machine_notify_delegate(&output_manager::frame, this));
+	machine.add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&output_manager::flush, this));
 	machine.add_notifier(MACHINE_NOTIFY_PAUSE, machine_notify_delegate(&output_manager::pause, this));
 	machine.add_notifier(MACHINE_NOTIFY_RESUME, machine_notify_delegate(&output_manager::resume, this));
 	machine.save().register_presave(save_prepost_delegate(FUNC(output_manager::presave), this));
@@ -150,18 +160,31 @@ output_manager::output_item &output_manager::find_or_create_item(std::string_vie
 }
 
 
+/*-------------------------------------------------
+    frame - send changes to batch notifiers
+-------------------------------------------------*/
+
+void output_manager::frame()
+{
+	flush();
+}
+
+
 /*-------------------------------------------------
     output_pause - send pause message
 -------------------------------------------------*/
 
 void output_manager::pause()
 {
+	// frames stop while paused, so don't wait for one
 	set_value("pause", 1);
+	flush();
 }
 
 void output_manager::resume()
 {
 	set_value("pause", 0);
+	flush();
 }
 
 
@@ -241,6 +264,40 @@ void output_manager::set_global_notifier(notifier_func callback, void *param)
 }
 
 
+//-------------------------------------------------
+//  set_global_batch_notifier - sets a callback
+//  for coalesced changes to all outputs
+//-------------------------------------------------
+
+void output_manager::set_global_batch_notifier(batch_notifier_func callback, void *param)
+{
+	m_batch_notifylist.emplace_back(callback, param);
+}
+
+
+//-------------------------------------------------
+//  flush - call batch notifiers with outputs
+//  changed since the last flush
+//-------------------------------------------------
+
+void output_manager::flush()
+{
+	if (m_dirty.empty())
+		return;
+
+	m_changes.clear();
+	for (output_item *const item : m_dirty)
+	{
+		item->m_dirty = false;
+		m_changes.emplace_back(output_change{ item->name().c_str(), item->id(), item->get() });
+	}
+	m_dirty.clear();
+
+	for (auto const &notify : m_batch_notifylist)
+		notify.first(&m_changes[0], m_changes.size(), notify.second);
+}
+
+
 /*-------------------------------------------------
     output_name_to_id - returns a unique ID for
     a given name
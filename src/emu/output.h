@@ -51,6 +51,19 @@ private:
 	};
 	using notify_vector = std::vector<output_notify>;
 
+public:
+	// a change delivered to batch notifiers, with the latest value
+	struct output_change
+	{
+		char const *    name;
+		u32             id;
+		s32             value;
+	};
+	typedef void (*batch_notifier_func)(output_change const *changes, size_t count, void *param);
+
+private:
+	using batch_notify_vector = std::vector<std::pair<batch_notifier_func, void *> >;
+
 	class output_item
 	{
 	public:
@@ -74,10 +87,13 @@ private:
 		void set_notifier(notifier_func callback, void *param) { m_notifylist.emplace_back(callback, param); }
 
 	private:
+		friend class output_manager;
+
 		output_manager      &m_manager;     // parent output manager
 		std::string const   m_name;         // string name of the item
 		u32 const           m_id;           // unique ID for this item
 		s32                 m_value;        // current value
+		bool                m_dirty;        // changed since batch notifiers were last called
 		notify_vector       m_notifylist;   // list of notifier callbacks
 	};
 
@@ -181,6 +197,13 @@ public:
 	// set a notifier globally
 	void set_global_notifier(notifier_func callback, void *param);
 
+	// set a notifier called once per frame with all outputs changed since
+	// the last call, each with only its latest value
+	void set_global_batch_notifier(batch_notifier_func callback, void *param);
+
+	// call batch notifiers with changes so far
+	void flush();
+
 	// immdediately call a notifier for all outputs
 	template <typename T> void notify_all(T &&notifier) const
 	{
@@ -200,6 +223,7 @@ private:
 	output_item &find_or_create_item(std::string_view outname, s32 value);
 
 	// event handlers
+	void frame();
 	void pause();
 	void resume();
 	void presave() ATTR_COLD;
@@ -209,6 +233,9 @@ private:
 	running_machine &m_machine;                  // reference to our machine
 	std::unordered_map<std::string, output_item> m_itemtable;
 	notify_vector m_global_notifylist;
+	batch_notify_vector m_batch_notifylist;
+	std::vector<output_item *> m_dirty;              // items changed since the last flush
+	std::vector<output_change> m_changes;            // scratch list passed to batch notifiers
 	std::vector<std::reference_wrapper<output_item> > m_save_order;
 	std::unique_ptr<s32 []> m_save_data;
 	u32 m_uniqueid;
@@ -80,6 +80,7 @@ real_profiler_state::real_profiler_state()
 {
 	memset(m_filo, 0, sizeof(m_filo));
 	memset(m_data, 0, sizeof(m_data));
+	memset(m_cycles, 0, sizeof(m_cycles));
 	reset(false);
 }
 
@@ -194,6 +195,9 @@ void real_profiler_state::update_text(running_machine &machine)
 		return;
 	}
 
+	// guest cycle deltas are only meaningful once we have a previous sample
+	bool const have_cycles = (m_text_time != attotime::never);
+
 	// loop over all types and generate the string
 	device_enumerator iter(machine.root_device());
 	std::ostringstream stream;
@@ -214,7 +218,21 @@ void real_profiler_state::update_text(running_machine &machine)
 
 			// and then the text
 			if (curtype >= PROFILER_DEVICE_FIRST && curtype <= PROFILER_DEVICE_MAX)
-				util::stream_format(stream, "'%s'", iter.byindex(curtype - PROFILER_DEVICE_FIRST)->tag());
+			{
+				device_t *const device = iter.byindex(curtype - PROFILER_DEVICE_FIRST);
+				util::stream_format(stream, "'%s'", device->tag());
+
+				// append the guest cycles executed since the last update
+				device_execute_interface *exec;
+				if ((curtype < PROFILER_DEVICE_MAX) && device->interface(exec))
+				{
+					u64 &last = m_cycles[curtype - PROFILER_DEVICE_FIRST];
+					u64 const cycles = exec->total_cycles();
+					if (have_cycles)
+						util::stream_format(stream, " %u cyc", cycles - last);
+					last = cycles;
+				}
+			}
 			else
 				for (auto & name : names)
 					if (name.type == curtype)
@@ -221,6 +221,7 @@ private:
 	attotime            m_text_time;                // profiler text last update
 	filo_entry          m_filo[32];                 // array of FILO entries
 	osd_ticks_t         m_data[PROFILER_TOTAL + 1]; // array of data
+	u64                 m_cycles[PROFILER_DEVICE_MAX - PROFILER_DEVICE_FIRST]; // device cycle counts at last text update
 };
 
 
@@ -4,7 +4,7 @@
 
     recording.cpp
 
-    MAME AVI/MNG video recording routines.
+    MAME AVI/MNG/raw video recording routines.
 
 ***************************************************************************/
 
@@ -15,8 +15,17 @@
 #include "screen.h"
 
 #include "aviio.h"
+#include "multibyte.h"
 #include "png.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 
 namespace
 {
@@ -55,6 +64,61 @@ namespace
 		std::unique_ptr<emu_file> m_mng_file; // handle to the open movie file
 		std::map<std::string, std::string> m_info_fields;
 	};
+
+
+	// writes buffers to a file (typically a named pipe read by an external
+	// encoder) on a dedicated thread; submitting blocks once the queue is
+	// full so a slow reader applies back pressure rather than growing memory
+	class raw_stream_writer
+	{
+	public:
+		raw_stream_writer(std::unique_ptr<emu_file> &&file, size_t max_pending);
+		~raw_stream_writer();
+
+		bool failed() const { return m_failed; }
+		std::vector<u8> acquire();
+		bool submit(std::vector<u8> &&buffer);
+
+	private:
+		void run();
+
+		std::unique_ptr<emu_file>       m_file;
+		size_t const                    m_max_pending;
+		std::mutex                      m_mutex;
+		std::condition_variable         m_ready;
+		std::condition_variable         m_space;
+		std::deque<std::vector<u8> >    m_pending;
+		std::vector<std::vector<u8> >   m_free;
+		bool                            m_exiting;
+		bool                            m_failed;
+		std::thread                     m_thread;
+	};
+
+
+	class raw_movie_recording : public movie_recording
+	{
+	public:
+		raw_movie_recording(screen_device *screen)
+			: movie_recording(screen)
+		{
+		}
+
+		bool initialize(running_machine &machine, std::unique_ptr<emu_file> &&file, int32_t width, int32_t height);
+		virtual bool add_sound_to_recording(const s16 *sound, int numsamples) override;
+
+	protected:
+		virtual bool append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries) override;
+
+	private:
+		// frames are small enough that a few in flight absorb encoder jitter
+		static constexpr size_t MAX_PENDING_FRAMES = 8;
+		static constexpr size_t MAX_PENDING_SOUND = 32;
+
+		int32_t                             m_width = 0;
+		int32_t                             m_height = 0;
+		std::unique_ptr<raw_stream_writer>  m_video;
+		std::unique_ptr<raw_stream_writer>  m_sound;
+	};
 };
 
 
@@ -140,6 +204,14 @@ movie_recording::ptr movie_recording::create(running_machine &machine, screen_de
 		}
 		break;
 
+	case movie_recording::format::RAW:
+		{
+			auto raw_recording = std::make_unique<raw_movie_recording>(screen);
+			if (raw_recording->initialize(machine, std::move(file), snap_bitmap.width(), snap_bitmap.height()))
+				result = std::move(raw_recording);
+		}
+		break;
+
 	default:
 		throw false;
 	}
@@ -161,6 +233,23 @@ const char *movie_recording::format_file_extension(movie_recording::format fmt)
 	{
 		case format::AVI:   return "avi";
 		case format::MNG:   return "mng";
+		case format::RAW:   return "raw";
+		default:            throw false;
+	}
+}
+
+
+//-------------------------------------------------
+//  movie_recording::format_name
+//-------------------------------------------------
+
+const char *movie_recording::format_name(movie_recording::format fmt)
+{
+	switch (fmt)
+	{
+		case format::AVI:   return "AVI";
+		case format::MNG:   return "MNG";
+		case format::RAW:   return "RAW";
 		default:            throw false;
 	}
 }
@@ -198,7 +287,8 @@ bool avi_movie_recording::initialize(running_machine &machine, std::unique_ptr<e
 	set_frame_period(attotime::from_ticks(info.video_sampletime, info.video_timescale));
 
 	// create the file
-	avi_file::error avierr = avi_file::create(fullpath, info, m_avi_file);
+	// write in the background so disk stalls don't hold up emulation
+	avi_file::error avierr = avi_file::create(fullpath, info, m_avi_file, true);
 	if (avierr != avi_file::error::NONE)
 		osd_printf_error("Error creating AVI: %s\n", avi_file::error_string(avierr));
 	return avierr == avi_file::error::NONE;
@@ -288,7 +378,7 @@ bool mng_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const
 			pnginfo.add_text(ent.first, ent.second);
 	}
 
-	std::error_condition const error = util::mng_capture_frame(*m_mng_file, pnginfo, bitmap, palette_entries, palette);
+	std::error_condition const error = util::mng_capture_frame(*m_mng_file, pnginfo, bitmap, palette_entries, palette, util::png_compression::FAST);
 	return !error;
 }
 
@@ -302,3 +392,209 @@ bool mng_movie_recording::add_sound_to_recording(const s16 *sound, int numsample
 	// not supported; do nothing
 	return true;
 }
+
+
+//-------------------------------------------------
+//  raw_stream_writer - constructor
+//-------------------------------------------------
+
+raw_stream_writer::raw_stream_writer(std::unique_ptr<emu_file> &&file, size_t max_pending)
+	: m_file(std::move(file))
+	, m_max_pending(max_pending)
+	, m_exiting(false)
+	, m_failed(false)
+{
+#if !defined(__EMSCRIPTEN__)
+	m_thread = std::thread([this] () { run(); });
+#endif
+}
+
+
+//-------------------------------------------------
+//  raw_stream_writer - destructor; writes out
+//  anything still queued before closing the file
+//-------------------------------------------------
+
+raw_stream_writer::~raw_stream_writer()
+{
+	{
+		std::lock_guard<std::mutex> guard(m_mutex);
+		m_exiting = true;
+	}
+	m_ready.notify_all();
+	if (m_thread.joinable())
+		m_thread.join();
+	m_file->flush();
+}
+
+
+//-------------------------------------------------
+//  raw_stream_writer::acquire - get an empty
+//  buffer, reusing one already written if possible
+//-------------------------------------------------
+
+std::vector<u8> raw_stream_writer::acquire()
+{
+	std::vector<u8> result;
+	std::lock_guard<std::mutex> guard(m_mutex);
+	if (!m_free.empty())
+	{
+		result = std::move(m_free.back());
+		m_free.pop_back();
+	}
+	result.clear();
+	return result;
+}
+
+
+//-------------------------------------------------
+//  raw_stream_writer::submit - queue a buffer to
+//  be written, waiting for space if necessary
+//-------------------------------------------------
+
+bool raw_stream_writer::submit(std::vector<u8> &&buffer)
+{
+#if defined(__EMSCRIPTEN__)
+	if (!m_failed && (m_file->write(buffer.data(), buffer.size()) != buffer.size()))
+		m_failed = true;
+	buffer.clear();
+	m_free.emplace_back(std::move(buffer));
+	return !m_failed;
+#else
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_space.wait(lock, [this] () { return m_failed || (m_pending.size() < m_max_pending); });
+		if (m_failed)
+			return false;
+		m_pending.emplace_back(std::move(buffer));
+	}
+	m_ready.notify_one();
+	return true;
+#endif
+}
+
+
+//-------------------------------------------------
+//  raw_stream_writer::run - writer thread body
+//-------------------------------------------------
+
+void raw_stream_writer::run()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true)
+	{
+		m_ready.wait(lock, [this] () { return m_exiting || !m_pending.empty(); });
+		if (m_pending.empty())
+			break;
+
+		// write without holding the lock so the emulation thread can keep queueing
+		std::vector<u8> buffer(std::move(m_pending.front()));
+		m_pending.pop_front();
+		lock.unlock();
+		bool const ok = m_file->write(buffer.data(), buffer.size()) == buffer.size();
+		lock.lock();
+
+		if (!ok)
+		{
+			// the reader went away; discard everything and release any waiter
+			m_failed = true;
+			m_pending.clear();
+		}
+		else if (m_free.size() < m_max_pending)
+		{
+			m_free.emplace_back(std::move(buffer));
+		}
+		m_space.notify_all();
+	}
+}
+
+
+//-------------------------------------------------
+//  raw_movie_recording::initialize
+//-------------------------------------------------
+
+bool raw_movie_recording::initialize(running_machine &machine, std::unique_ptr<emu_file> &&file, int32_t width, int32_t height)
+{
+	m_width = width;
+	m_height = height;
+
+	// use the same frame timing as AVI recording
+	set_frame_period(screen() ? screen()->frame_period() : attotime::from_hz(screen_device::DEFAULT_FRAME_RATE));
+
+	// audio goes to a second file alongside the video so each is a plain raw stream
+	std::string const fullpath = file->fullpath();
+	std::string const soundpath = fullpath + ".pcm";
+	auto sound_file = std::make_unique<emu_file>("", OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	std::error_condition const filerr = sound_file->open(soundpath);
+	if (filerr)
+	{
+		osd_printf_error("Error creating raw audio stream %s (%s:%d %s)\n", soundpath, filerr.category().name(), filerr.value(), filerr.message());
+		return false;
+	}
+
+	m_video = std::make_unique<raw_stream_writer>(std::move(file), MAX_PENDING_FRAMES);
+	m_sound = std::make_unique<raw_stream_writer>(std::move(sound_file), MAX_PENDING_SOUND);
+
+	// tell the user how to describe the streams to the encoder
+	osd_printf_info(
+			"Recording raw streams; encoder input options:\n"
+			"  -f rawvideo -pixel_format %s -video_size %dx%d -framerate %.6f -i \"%s\"\n"
+			"  -f s16le -ar %d -ac 2 -i \"%s\"\n",
+			(util::endianness::native == util::endianness::little) ? "bgr0" : "0rgb",
+			width, height, frame_period().as_hz(), fullpath,
+			machine.sample_rate(), soundpath);
+	return true;
+}
+
+
+//-------------------------------------------------
+//  raw_movie_recording::append_single_video_frame
+//-------------------------------------------------
+
+bool raw_movie_recording::append_single_video_frame(bitmap_rgb32 &bitmap, const rgb_t *palette, int palette_entries)
+{
+	auto profile = g_profiler.start(PROFILER_MOVIE_REC);
+
+	// the encoder expects every frame to be the size announced at the start
+	std::vector<u8> buffer = m_video->acquire();
+	size_t const rowbytes = size_t(m_width) * sizeof(u32);
+	buffer.resize(rowbytes * m_height);
+	int32_t const width = std::min<int32_t>(m_width, bitmap.width());
+	int32_t const height = std::min<int32_t>(m_height, bitmap.height());
+	for (int32_t y = 0; y < height; y++)
+	{
+		u8 *const dest = &buffer[y * rowbytes];
+		std::memcpy(dest, &bitmap.pix(y), width * sizeof(u32));
+		if (width < m_width)
+			std::fill(dest + width * sizeof(u32), dest + rowbytes, 0);
+	}
+	if (height < m_height)
+		std::fill(buffer.begin() + height * rowbytes, buffer.end(), 0);
+
+	return m_video->submit(std::move(buffer));
+}
+
+
+//-------------------------------------------------
+//  raw_movie_recording::add_sound_to_recording
+//-------------------------------------------------
+
+bool raw_movie_recording::add_sound_to_recording(const s16 *sound, int numsamples)
+{
+	auto profile = g_profiler.start(PROFILER_MOVIE_REC);
+
+	// samples arrive interleaved stereo; the stream is little-endian
+	std::vector<u8> buffer = m_sound->acquire();
+	buffer.resize(size_t(numsamples) * 2 * sizeof(s16));
+	if (util::endianness::native == util::endianness::little)
+	{
+		std::memcpy(buffer.data(), sound, buffer.size());
+	}
+	else
+	{
+		for (int i = 0; i < numsamples * 2; i++)
+			put_u16le(&buffer[i * 2], u16(sound[i]));
+	}
+
+	return m_sound->submit(std::move(buffer));
+}
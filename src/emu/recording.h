@@ -4,7 +4,7 @@
 
     recording.h
 
-    MAME AVI/MNG video recording routines.
+    MAME AVI/MNG/raw video recording routines.
 
 ***************************************************************************/
 
@@ -38,7 +38,8 @@ public:
 	enum class format
 	{
 		MNG,
-		AVI
+		AVI,
+		RAW     // raw video and audio streams for an external encoder
 	};
 
 	typedef std::unique_ptr<movie_recording> ptr;
@@ -61,6 +62,7 @@ public:
 	// statics
 	static movie_recording::ptr create(running_machine &machine, screen_device *screen, format fmt, std::unique_ptr<emu_file> &&file, bitmap_rgb32 &snap_bitmap);
 	static const char *format_file_extension(format fmt);
+	static const char *format_name(format fmt);
 
 protected:
 	// ctor
@@ -248,14 +248,9 @@ render_primitive_list::~render_primitive_list()
 
 inline void render_primitive_list::add_reference(void *refptr)
 {
-	// skip if we already have one
-	if (has_reference(refptr))
-		return;
-
-	// set the refptr and link us into the list
-	reference *ref = m_reference_allocator.alloc();
-	ref->m_refptr = refptr;
-	m_reflist.append(*ref);
+	// layouts with many elements add hundreds of these per frame, so keep
+	// them hashed rather than scanning a list for duplicates each time
+	m_references.insert(refptr);
 }
 
 
@@ -266,11 +261,7 @@ inline void render_primitive_list::add_reference(void *refptr)
 
 inline bool render_primitive_list::has_reference(void *refptr) const
 {
-	// skip if we already have one
-	for (reference &ref : m_reflist)
-		if (ref.m_refptr == refptr)
-			return true;
-	return false;
+	return m_references.find(refptr) != m_references.end();
 }
 
 
@@ -296,7 +287,7 @@ void render_primitive_list::release_all()
 {
 	// release all the live items while under the lock
 	m_primitive_allocator.reclaim_all(m_primlist);
-	m_reference_allocator.reclaim_all(m_reflist);
+	m_references.clear();
 }
 
 
@@ -333,8 +324,13 @@ render_texture::render_texture()
 		m_old_id(~0ULL),
 		m_scaler(nullptr),
 		m_param(nullptr),
-		m_curseq(0)
+		m_curseq(0),
+		m_track_dirty(false),
+		m_dirty_all(true),
+		m_lookup_container(nullptr),
+		m_lookup_serial(0)
 {
+	m_dirty.set(0, -1, 0, -1);
 	m_sbounds.set(0, -1, 0, -1);
 	for (auto &elem : m_scaled)
 		elem.seqid = 0;
@@ -391,6 +387,10 @@ void render_texture::release()
 	m_format = TEXFORMAT_ARGB32;
 	m_scaler = nullptr;
 	m_curseq = 0;
+	m_track_dirty = false;
+	m_dirty_all = true;
+	m_dirty.set(0, -1, 0, -1);
+	m_lookup_container = nullptr;
 }
 
 
@@ -410,6 +410,10 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 	if (&bitmap != m_bitmap && m_bitmap != nullptr)
 		m_manager->invalidate_all(m_bitmap);
 
+	// anything but new contents in the same place needs a full refresh
+	if (&bitmap != m_bitmap || sbounds != m_sbounds || format != m_format)
+		m_dirty_all = true;
+
 	// set the new bitmap/palette
 	m_bitmap = &bitmap;
 	m_sbounds = sbounds;
@@ -426,6 +430,22 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 }
 
 
+//-------------------------------------------------
+//  mark_dirty - note that part of the source
+//  bitmap has been redrawn
+//-------------------------------------------------
+
+void render_texture::mark_dirty(const rectangle &bounds)
+{
+	if (bounds.empty())
+		return;
+	if (m_dirty.empty())
+		m_dirty = bounds;
+	else
+		m_dirty |= bounds;
+}
+
+
 //-------------------------------------------------
 //  hq_scale - generic high quality resampling
 //  scaler
@@ -472,6 +492,18 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 		texinfo.height = sheight;
 		// palette will be set later
 		texinfo.seqid = ++m_curseq;
+
+		// report the rows redrawn since the previous sequence, if we know them
+		texinfo.dirty_seqid = 0;
+		if (m_track_dirty && !m_dirty_all && texinfo.seqid > 1)
+		{
+			rectangle dirty = m_dirty & m_sbounds;
+			texinfo.dirty_seqid = texinfo.seqid - 1;
+			texinfo.dirty_top = dirty.empty() ? 0 : (dirty.top() - m_sbounds.top());
+			texinfo.dirty_height = dirty.empty() ? 0 : dirty.height();
+		}
+		m_dirty_all = false;
+		m_dirty.set(0, -1, 0, -1);
 	}
 	else
 	{
@@ -527,10 +559,29 @@ void render_texture::get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo
 		texinfo.height = dheight;
 		// palette will be set later
 		texinfo.seqid = scaled->seqid;
+		texinfo.dirty_seqid = 0;
 	}
 }
 
 
+//-------------------------------------------------
+//  lookups_changed - return true if the
+//  container's palette or brightness/contrast/
+//  gamma lookups changed since we last asked, in
+//  which case unchanged rows are stale as well
+//-------------------------------------------------
+
+bool render_texture::lookups_changed(const render_container &container)
+{
+	if (&container == m_lookup_container && container.lookup_serial() == m_lookup_serial)
+		return false;
+
+	m_lookup_container = &container;
+	m_lookup_serial = container.lookup_serial();
+	return true;
+}
+
+
 //-------------------------------------------------
 //  get_adjusted_palette - return the adjusted
 //  palette for a texture
@@ -579,6 +630,7 @@ render_container::render_container(render_manager &manager, screen_device *scree
 	, m_screen(screen)
 	, m_overlaybitmap(nullptr)
 	, m_overlaytexture(nullptr)
+	, m_lookup_serial(0)
 {
 	// make sure it is empty
 	empty();
@@ -842,6 +894,7 @@ void render_container::recompute_lookups()
 		else
 			memcpy(&m_bcglookup[0], adjusted_palette, colors * sizeof(rgb_t));
 	}
+	m_lookup_serial++;
 }
 
 
@@ -889,6 +942,7 @@ void render_container::update_palette()
 		}
 		else
 			memcpy(&m_bcglookup[mindirty], &adjusted_palette[mindirty], (maxdirty - mindirty + 1) * sizeof(rgb_t));
+		m_lookup_serial++;
 	}
 }
 
@@ -2582,6 +2636,8 @@ void render_target::add_container_primitives(render_primitive_list &list, const
 
 					// set the palette
 					prim->texture.palette = curitem.texture()->get_adjusted_palette(container, prim->texture.palette_length);
+					if (curitem.texture()->lookups_changed(container))
+						prim->texture.dirty_seqid = 0;
 
 					// determine UV coordinates
 					prim->texcoords = oriented_texcoords[finalorient];
@@ -2717,6 +2773,21 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 	// limit state range to non-negative values
 	int const state((std::max)(item.element_state(), 0));
 
+	// lamp-heavy layouts have many items that draw nothing in their current state, or that
+	// are fully transparent; skip them before scaling a texture, unless the blend mode
+	// would still darken what is underneath
+	if ((blendmode == BLENDMODE_ALPHA) || (blendmode == BLENDMODE_ADD))
+	{
+		if (((blendmode == BLENDMODE_ALPHA) && (xform.color.a <= 0.0f)) || element.state_blank(state))
+			return;
+	}
+
+	// skip items that would be clipped out entirely
+	float const primx(render_round_nearest(xform.xoffs));
+	float const primy(render_round_nearest(xform.yoffs));
+	if ((primx > m_bounds.x1) || (primy > m_bounds.y1) || ((primx + render_round_nearest(xform.xscale)) < m_bounds.x0) || ((primy + render_round_nearest(xform.yscale)) < m_bounds.y0))
+		return;
+
 	// get a pointer to the relevant texture
 	render_texture *texture = element.state_texture(state);
 	if (texture)
@@ -2734,7 +2805,7 @@ void render_target::add_element_primitives(render_primitive_list &list, const ob
 		// compute the bounds
 		float const primwidth(render_round_nearest(xform.xscale));
 		float const primheight(render_round_nearest(xform.yscale));
-		prim->bounds.set_wh(render_round_nearest(xform.xoffs), render_round_nearest(xform.yoffs), primwidth, primheight);
+		prim->bounds.set_wh(primx, primy, primwidth, primheight);
 		prim->full_bounds = prim->bounds;
 
 		// get the scaled texture and append it
@@ -3323,6 +3394,7 @@ render_manager::render_manager(running_machine &machine)
 	, m_ui_target(nullptr)
 	, m_live_textures(0)
 	, m_texture_id(0)
+	, m_screen_buffers(2)
 {
 	// register callbacks
 	machine.configuration().config_register(
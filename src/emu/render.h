@@ -50,10 +50,12 @@
 
 #include "interface/uievents.h"
 
+#include <algorithm>
 #include <cmath>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -162,6 +164,9 @@ struct render_texinfo
 	u32                 width_margin;       // left margin of the scaled bounds, if applicable
 	u32                 height;             // height of the image
 	u32                 seqid;              // sequence ID
+	u32                 dirty_seqid;        // sequence ID the dirty rows are relative to, or 0 if all changed
+	u32                 dirty_top;          // first row changed since dirty_seqid
+	u32                 dirty_height;       // number of rows changed since dirty_seqid
 	u64                 unique_id;          // unique identifier to pass to osd
 	u64                 old_id;             // previously allocated id, if applicable
 	const rgb_t *       palette;            // palette for PALETTE16 textures, bcg lookup table for RGB32/YUY16
@@ -283,21 +288,11 @@ private:
 	void append(render_primitive &prim) { append_or_return(prim, false); }
 	void append_or_return(render_primitive &prim, bool clipped);
 
-	// a reference is an abstract reference to an internal object of some sort
-	class reference
-	{
-	public:
-		reference *next() const { return m_next; }
-		reference *         m_next;             // link to the next reference
-		void *              m_refptr;           // reference pointer
-	};
-
 	// internal state
 	simple_list<render_primitive> m_primlist;               // list of primitives
-	simple_list<reference> m_reflist;                       // list of references
+	std::unordered_set<void *> m_references;                // abstract references to internal objects
 
 	fixed_allocator<render_primitive> m_primitive_allocator;// allocator for primitives
-	fixed_allocator<reference> m_reference_allocator;       // allocator for references
 
 	std::recursive_mutex     m_lock;                             // lock to protect list accesses
 };
@@ -334,6 +329,11 @@ public:
 	// set a unique identifier
 	void set_id(u64 id) { m_old_id = m_id; m_id = id; }
 
+	// dirty region tracking, letting the OSD refresh only changed rows
+	void set_dirty_tracking(bool track) { m_track_dirty = track; m_dirty_all = true; }
+	void mark_dirty() { m_dirty_all = true; }
+	void mark_dirty(const rectangle &bounds);
+
 	// generic high-quality bitmap scaler
 	static void hq_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param);
 
@@ -341,6 +341,7 @@ private:
 	// internal helpers
 	void get_scaled(u32 dwidth, u32 dheight, render_texinfo &texinfo, render_primitive_list &primlist, u32 flags = 0);
 	const rgb_t *get_adjusted_palette(render_container &container, u32 &out_length);
+	bool lookups_changed(const render_container &container);
 
 	static constexpr int MAX_TEXTURE_SCALES = 100;
 
@@ -365,6 +366,13 @@ private:
 	void *              m_param;                    // scaling callback parameter
 	u32                 m_curseq;                   // current sequence number
 	scaled_texture      m_scaled[MAX_TEXTURE_SCALES];// array of scaled variants of this texture
+
+	// dirty region state
+	bool                m_track_dirty;              // are we reporting dirty rows?
+	bool                m_dirty_all;                // has everything changed since the last sequence?
+	rectangle           m_dirty;                    // area changed since the last sequence
+	const render_container *m_lookup_container;     // container whose lookups we were last adjusted by
+	u32                 m_lookup_serial;            // serial number of those lookups
 };
 
 
@@ -429,6 +437,7 @@ public:
 	u8 apply_brightness_contrast_gamma(u8 value);
 	float apply_brightness_contrast_gamma_fp(float value);
 	const rgb_t *bcg_lookup_table(int texformat, u32 &out_length, palette_t *palette = nullptr);
+	u32 lookup_serial() const { return m_lookup_serial; }
 
 private:
 	// an item describes a high level primitive that is added to a container
@@ -482,6 +491,7 @@ private:
 	std::unique_ptr<palette_client> m_palclient;    // client to the screen palette
 	std::vector<rgb_t>      m_bcglookup;            // copy of screen palette with bcg adjustment
 	rgb_t                   m_bcglookup256[0x400];  // lookup table for brightness/contrast/gamma
+	u32                     m_lookup_serial;        // bumped whenever the lookup tables change
 };
 
 
@@ -688,6 +698,11 @@ public:
 	render_texture *texture_alloc(texture_scaler_func scaler = nullptr, void *param = nullptr);
 	void texture_free(render_texture *texture);
 
+	// screen bitmap buffering; renderers that reference screen bitmap memory
+	// instead of copying it can request more buffers before the screens start
+	int screen_buffers() const { return m_screen_buffers; }
+	void request_screen_buffers(int count) { m_screen_buffers = std::max(m_screen_buffers, count); }
+
 	// fonts
 	std::unique_ptr<render_font> font_alloc(const char *filename = nullptr);
 
@@ -713,6 +728,7 @@ private:
 	u32                             m_live_textures;            // number of live textures
 	u64                             m_texture_id;               // rolling texture ID counter
 	fixed_allocator<render_texture> m_texture_allocator;        // texture allocator
+	int                             m_screen_buffers;           // bitmaps each screen rotates through
 
 	// containers for UI elements and for screens
 	std::list<render_container>     m_ui_containers;            // containers for drawing UI elements
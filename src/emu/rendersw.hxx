@@ -6,6 +6,10 @@
 
     Software-only rasterization system.
 
+    Primitive lists can be drawn in horizontal bands on a work queue; each
+    band draws every primitive clipped to its rows, so the result is the
+    same as drawing the whole list on one thread.
+
 ***************************************************************************/
 
 
@@ -14,6 +18,8 @@
 #include "video/rgbutil.h"
 #include "render.h"
 
+#include "osdcore.h"
+
 
 template <typename PixelType, int SrcShiftR, int SrcShiftG, int SrcShiftB, int DstShiftR, int DstShiftG, int DstShiftB, bool NoDestRead = false, bool BilinearFilter = false>
 class software_renderer
@@ -28,6 +34,20 @@ private:
 		s32 endx, endy;
 	};
 
+	// one band of rows to draw on a worker
+	struct band_params
+	{
+		render_primitive_list const *primlist;
+		PixelType *dstdata;
+		s32 width, height;
+		u32 pitch;
+		s32 top, bottom;
+	};
+
+	// bands are at least this many rows, and there are at most this many of them
+	static constexpr s32 BAND_MIN_ROWS = 32;
+	static constexpr int MAX_BANDS = 16;
+
 	// internal helpers
 	static constexpr bool is_opaque(float alpha) { return (alpha >= (NoDestRead ? 0.5f : 1.0f)); }
 	static constexpr bool is_transparent(float alpha) { return (alpha < (NoDestRead ? 0.5f : 0.0001f)); }
@@ -585,17 +605,17 @@ private:
 	//  draw_rect - draw a solid rectangle
 	//-------------------------------------------------
 
-	static void draw_rect(render_primitive const &prim, PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void draw_rect(render_primitive const &prim, PixelType *dstdata, s32 width, s32 height, u32 pitch, s32 top, s32 bottom)
 	{
 		render_bounds const fpos = prim.bounds;
 		assert(fpos.x0 <= fpos.x1);
 		assert(fpos.y0 <= fpos.y1);
 
-		// clamp to integers and ensure we fit
+		// clamp to integers and ensure we fit, then clip to the band
 		s32 const startx = std::clamp<s32>(round_nearest(fpos.x0), 0, width);
-		s32 const starty = std::clamp<s32>(round_nearest(fpos.y0), 0, height);
+		s32 const starty = std::max(std::clamp<s32>(round_nearest(fpos.y0), 0, height), top);
 		s32 const endx = std::clamp<s32>(round_nearest(fpos.x1), 0, width);
-		s32 const endy = std::clamp<s32>(round_nearest(fpos.y1), 0, height);
+		s32 const endy = std::min(std::clamp<s32>(round_nearest(fpos.y1), 0, height), bottom);
 
 		// bail if nothing left
 		if ((startx > endx) || (starty > endy))
@@ -1736,7 +1756,7 @@ private:
 	//  drawing routine
 	//-------------------------------------------------
 
-	static void setup_and_draw_textured_quad(render_primitive const &prim, PixelType *dstdata, s32 width, s32 height, u32 pitch)
+	static void setup_and_draw_textured_quad(render_primitive const &prim, PixelType *dstdata, s32 width, s32 height, u32 pitch, s32 top, s32 bottom)
 	{
 		assert(prim.bounds.x0 <= prim.bounds.x1);
 		assert(prim.bounds.y0 <= prim.bounds.y1);
@@ -1783,6 +1803,18 @@ private:
 			setup.startv -= 0x8000;
 		}
 
+		// clip to the band, stepping the texture coordinates down to its first row
+		if (setup.starty < top)
+		{
+			setup.startu += (top - setup.starty) * setup.dudy;
+			setup.startv += (top - setup.starty) * setup.dvdy;
+			setup.starty = top;
+		}
+		if (setup.endy > bottom)
+			setup.endy = bottom;
+		if (setup.starty >= setup.endy)
+			return;
+
 		// render based on the texture coordinates
 		switch (prim.flags & (PRIMFLAG_TEXFORMAT_MASK | PRIMFLAG_BLENDMODE_MASK))
 		{
@@ -1854,30 +1886,79 @@ private:
 	//**************************************************************************
 
 	//-------------------------------------------------
-	//  draw_primitives - draw a series of primitives
-	//  using a software rasterizer
+	//  draw_band - draw the parts of a series of
+	//  primitives that fall within a band of rows
 	//-------------------------------------------------
 
-public:
-	static void draw_primitives(render_primitive_list const &primlist, void *dstdata, u32 width, u32 height, u32 pitch)
+	static void draw_band(render_primitive_list const &primlist, PixelType *dstdata, s32 width, s32 height, u32 pitch, s32 top, s32 bottom)
 	{
 		// loop over the list and render each element
 		for (render_primitive const *prim = primlist.first(); prim != nullptr; prim = prim->next())
 			switch (prim->type)
 			{
 				case render_primitive::LINE:
-					draw_line(*prim, reinterpret_cast<PixelType *>(dstdata), width, height, pitch);
+					// lines aren't clipped, so they're only drawn when there's a single band
+					assert((top == 0) && (bottom == height));
+					draw_line(*prim, dstdata, width, height, pitch);
 					break;
 
 				case render_primitive::QUAD:
 					if (!prim->texture.base)
-						draw_rect(*prim, reinterpret_cast<PixelType *>(dstdata), width, height, pitch);
+						draw_rect(*prim, dstdata, width, height, pitch, top, bottom);
 					else
-						setup_and_draw_textured_quad(*prim, reinterpret_cast<PixelType *>(dstdata), width, height, pitch);
+						setup_and_draw_textured_quad(*prim, dstdata, width, height, pitch, top, bottom);
 					break;
 
 				default:
 					throw emu_fatalerror("Unexpected render_primitive type");
 			}
 	}
+
+	static void *draw_band_callback(void *param, int threadid)
+	{
+		band_params const &band = *reinterpret_cast<band_params const *>(param);
+		draw_band(*band.primlist, band.dstdata, band.width, band.height, band.pitch, band.top, band.bottom);
+		return nullptr;
+	}
+
+	//-------------------------------------------------
+	//  draw_primitives - draw a series of primitives
+	//  using a software rasterizer
+	//-------------------------------------------------
+
+public:
+	static void draw_primitives(render_primitive_list const &primlist, void *dstdata, u32 width, u32 height, u32 pitch)
+	{
+		draw_band(primlist, reinterpret_cast<PixelType *>(dstdata), width, height, pitch, 0, height);
+	}
+
+	//-------------------------------------------------
+	//  draw_primitives - draw a series of primitives
+	//  in bands of rows on a work queue
+	//-------------------------------------------------
+
+	static void draw_primitives(render_primitive_list const &primlist, void *dstdata, u32 width, u32 height, u32 pitch, osd_work_queue *queue)
+	{
+		// lines can't be split between bands, and small targets aren't worth it
+		int bands = queue ? std::min<int>(height / BAND_MIN_ROWS, MAX_BANDS) : 1;
+		for (render_primitive const *prim = primlist.first(); (bands > 1) && prim; prim = prim->next())
+			if (prim->type == render_primitive::LINE)
+				bands = 1;
+		if (bands <= 1)
+			return draw_primitives(primlist, dstdata, width, height, pitch);
+
+		band_params params[MAX_BANDS];
+		for (int band = 0; band < bands; band++)
+		{
+			params[band].primlist = &primlist;
+			params[band].dstdata = reinterpret_cast<PixelType *>(dstdata);
+			params[band].width = width;
+			params[band].height = height;
+			params[band].pitch = pitch;
+			params[band].top = s32(u64(height) * band / bands);
+			params[band].bottom = s32(u64(height) * (band + 1) / bands);
+		}
+		osd_work_item_queue_multiple(queue, draw_band_callback, bands, params, sizeof(params[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		osd_work_queue_wait(queue, osd_ticks_per_second() * 10);
+	}
 };
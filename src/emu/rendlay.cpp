@@ -1632,10 +1632,7 @@ void layout_group::resolve_bounds(
 
 render_texture *layout_element::state_texture(int state)
 {
-	if (m_foldhigh && (state & ~m_statemask))
-		state = (state & m_statemask) | (((m_statemask << 1) | 1) & ~m_statemask);
-	else
-		state &= m_statemask;
+	state = fold_state(state);
 	assert(m_elemtex.size() > state);
 	if (!m_elemtex[state].m_texture)
 	{
@@ -1647,6 +1644,41 @@ render_texture *layout_element::state_texture(int state)
 }
 
 
+//-------------------------------------------------
+//  state_blank - true if nothing is drawn for the
+//  given state, so the renderer can skip it
+//  without scaling an empty texture
+//-------------------------------------------------
+
+bool layout_element::state_blank(int state) const
+{
+	if (!m_draw.isnull())
+		return false;
+
+	state = fold_state(state);
+	for (auto const &curcomp : m_complist)
+	{
+		if ((state & curcomp->statemask()) == curcomp->stateval())
+			return false;
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  fold_state - reduce a state value to one of
+//  the textures this element keeps
+//-------------------------------------------------
+
+int layout_element::fold_state(int state) const
+{
+	if (m_foldhigh && (state & ~m_statemask))
+		return (state & m_statemask) | (((m_statemask << 1) | 1) & ~m_statemask);
+	else
+		return state & m_statemask;
+}
+
+
 //-------------------------------------------------
 //  set_draw_callback - set handler called after
 //  drawing components
@@ -83,6 +83,7 @@ public:
 	running_machine &machine() const { return m_machine; }
 	int default_state() const { return m_defstate; }
 	render_texture *state_texture(int state);
+	bool state_blank(int state) const;
 
 	// set handlers
 	void set_draw_callback(draw_delegate &&handler);
@@ -188,6 +189,7 @@ private:
 	typedef std::map<std::string, make_component_func> make_component_map;
 
 	// internal helpers
+	int fold_state(int state) const;
 	static void element_scale(bitmap_argb32 &dest, bitmap_argb32 &source, const rectangle &sbounds, void *param);
 	template <typename T> static component::ptr make_component(environment &env, util::xml::data_node const &compnode);
 
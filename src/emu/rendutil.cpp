@@ -19,6 +19,8 @@
 
 #include <csetjmp>
 #include <cstdlib>
+#include <memory>
+#include <new>
 #include <tuple>
 
 
@@ -192,6 +194,115 @@ static void resample_argb_bitmap_average(u32 *dest, u32 drowpixels, u32 dwidth,
 	u32 const b = color.b * color.a * 256.0f;
 	u32 const a = color.a * 256.0f;
 
+	// the filter is separable, so if we can get scratch space, sum each source
+	// row horizontally once and then accumulate the rows for each target row;
+	// this gives exactly the same result as summing each target pixel's area
+	std::unique_ptr<u64 []> const rowsums(new (std::nothrow) u64[dwidth * 4]);
+	std::unique_ptr<u64 []> const sums(new (std::nothrow) u64[dwidth * 4]);
+	if (rowsums && sums)
+	{
+		// divide by the overall scale factor, estimating with a reciprocal
+		// and correcting so the result is the same as integer division
+		double const recip = 1.0 / double(sumscale);
+		auto const scale = [sumscale, recip] (u64 sum)
+		{
+			u64 quotient = u64(double(sum) * recip);
+			while (quotient && (quotient * sumscale > sum))
+				quotient--;
+			while (((quotient + 1) * sumscale) <= sum)
+				quotient++;
+			return quotient;
+		};
+
+		u32 summedrow = ~u32(0);
+		for (u32 y = 0; y < dheight; y++)
+		{
+			std::fill_n(sums.get(), dwidth * 4, 0);
+
+			// accumulate all source rows that contribute to this row
+			u32 yremaining = dy;
+			u32 ychunk;
+			for (u32 cury = y * dy; yremaining; cury += ychunk)
+			{
+				// determine the Y contribution, clamping to the amount remaining
+				ychunk = 0x1000 - (cury & 0xfff);
+				if (ychunk > yremaining)
+					ychunk = yremaining;
+				yremaining -= ychunk;
+
+				// sum the source row horizontally, unless it's shared with the previous target row
+				if ((cury >> 12) != summedrow)
+				{
+					summedrow = cury >> 12;
+					u32 const *const srow = &source[summedrow * srowpixels];
+					for (u32 x = 0; x < dwidth; x++)
+					{
+						// partial pixels at either end, and whole pixels in between
+						u32 const startx = x * dx;
+						u32 const first = startx >> 12;
+						u32 const last = (startx + dx - 1) >> 12;
+						rgb_t pix = srow[first];
+						u32 xchunk = (first == last) ? dx : (0x1000 - (startx & 0xfff));
+						u64 suma = xchunk * pix.a(), sumr = xchunk * pix.r(), sumg = xchunk * pix.g(), sumb = xchunk * pix.b();
+						if (first != last)
+						{
+							u32 wholea = 0, wholer = 0, wholeg = 0, wholeb = 0;
+							for (u32 curx = first + 1; curx < last; curx++)
+							{
+								pix = srow[curx];
+								wholea += pix.a();
+								wholer += pix.r();
+								wholeg += pix.g();
+								wholeb += pix.b();
+							}
+							suma += u64(wholea) << 12;
+							sumr += u64(wholer) << 12;
+							sumg += u64(wholeg) << 12;
+							sumb += u64(wholeb) << 12;
+
+							pix = srow[last];
+							xchunk = startx + dx - (last << 12);
+							suma += xchunk * pix.a();
+							sumr += xchunk * pix.r();
+							sumg += xchunk * pix.g();
+							sumb += xchunk * pix.b();
+						}
+						rowsums[x * 4 + 0] = suma;
+						rowsums[x * 4 + 1] = sumr;
+						rowsums[x * 4 + 2] = sumg;
+						rowsums[x * 4 + 3] = sumb;
+					}
+				}
+
+				for (u32 i = 0; i < dwidth * 4; i++)
+					sums[i] += ychunk * rowsums[i];
+			}
+
+			for (u32 x = 0; x < dwidth; x++)
+			{
+				// apply scaling
+				u64 suma = scale(sums[x * 4 + 0]) * a / 256;
+				u64 sumr = scale(sums[x * 4 + 1]) * r / 256;
+				u64 sumg = scale(sums[x * 4 + 2]) * g / 256;
+				u64 sumb = scale(sums[x * 4 + 3]) * b / 256;
+
+				// if we're translucent, add in the destination pixel contribution
+				if (a < 256)
+				{
+					rgb_t const dpix = dest[y * drowpixels + x];
+					suma += dpix.a() * (256 - a);
+					sumr += dpix.r() * (256 - a);
+					sumg += dpix.g() * (256 - a);
+					sumb += dpix.b() * (256 - a);
+				}
+
+				// store the target pixel
+				dest[y * drowpixels + x] = rgb_t(suma, sumr, sumg, sumb);
+			}
+		}
+		return;
+	}
+
 	// loop over the target vertically
 	for (u32 y = 0; y < dheight; y++)
 	{
@@ -0,0 +1,158 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    resampler.h
+
+    Polyphase windowed-sinc filter used by the default resampler stream,
+    with the inner product optimized with SIMD where available.
+
+    The coefficients are precomputed for a fixed pair of sample rates as
+    a table of phases; each output sample is the dot product of a run of
+    consecutive input samples with the phase nearest to its fractional
+    input position.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_RESAMPLER_H
+#define MAME_EMU_RESAMPLER_H
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define MAME_RESAMPLER_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define MAME_RESAMPLER_NEON
+#include <arm_neon.h>
+#endif
+
+
+/***************************************************************************
+    INLINE FUNCTIONS
+***************************************************************************/
+
+//-------------------------------------------------
+//  resampler_dot - return the dot product of two
+//  runs of count samples
+//-------------------------------------------------
+
+inline float resampler_dot(float const *a, float const *b, u32 count)
+{
+	float result = 0.0f;
+#if defined(MAME_RESAMPLER_SSE2)
+	__m128 sum0 = _mm_setzero_ps();
+	__m128 sum1 = _mm_setzero_ps();
+	for ( ; count >= 8; count -= 8, a += 8, b += 8)
+	{
+		sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(a + 0), _mm_loadu_ps(b + 0)));
+		sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(a + 4), _mm_loadu_ps(b + 4)));
+	}
+	__m128 sum = _mm_add_ps(sum0, sum1);
+	sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+	sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+	result = _mm_cvtss_f32(sum);
+#elif defined(MAME_RESAMPLER_NEON)
+	float32x4_t sum0 = vdupq_n_f32(0.0f);
+	float32x4_t sum1 = vdupq_n_f32(0.0f);
+	for ( ; count >= 8; count -= 8, a += 8, b += 8)
+	{
+		sum0 = vmlaq_f32(sum0, vld1q_f32(a + 0), vld1q_f32(b + 0));
+		sum1 = vmlaq_f32(sum1, vld1q_f32(a + 4), vld1q_f32(b + 4));
+	}
+	float32x4_t const sum = vaddq_f32(sum0, sum1);
+	float32x2_t const half = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+	result = vget_lane_f32(vpadd_f32(half, half), 0);
+#endif
+	for ( ; count; count--)
+		result += *a++ * *b++;
+	return result;
+}
+
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+// ======================> resampler_polyphase
+
+class resampler_polyphase
+{
+public:
+	// number of fractional positions with precomputed coefficients
+	static constexpr u32 PHASES = 512;
+
+	// construction/destruction
+	resampler_polyphase() : m_input_rate(0), m_output_rate(0), m_quality(0), m_halftaps(0) { }
+
+	// getters
+	u32 taps() const { return m_halftaps * 2; }
+	u32 halftaps() const { return m_halftaps; }
+	bool matches(u32 input_rate, u32 output_rate, u32 quality) const { return m_input_rate == input_rate && m_output_rate == output_rate && m_quality == quality; }
+
+	// compute the coefficients for converting input_rate to output_rate; quality
+	// is the number of zero crossings on each side of the kernel, which is
+	// stretched when downsampling so the cutoff tracks the output rate
+	void configure(u32 input_rate, u32 output_rate, u32 quality)
+	{
+		m_input_rate = input_rate;
+		m_output_rate = output_rate;
+		m_quality = quality;
+
+		double const step = double(input_rate) / double(output_rate);
+		double const stretch = std::max(step, 1.0);
+		double const cutoff = 0.95 / stretch;
+		m_halftaps = quality * u32(std::ceil(stretch));
+
+		// one extra phase so a fraction that rounds up to 1.0 needs no special case
+		u32 const taps = m_halftaps * 2;
+		m_coefficients.resize((PHASES + 1) * taps);
+		for (u32 phase = 0; phase <= PHASES; phase++)
+		{
+			float *const row = &m_coefficients[phase * taps];
+			double const frac = double(phase) / double(PHASES);
+			double total = 0.0;
+			for (u32 tap = 0; tap < taps; tap++)
+			{
+				// distance in input samples from the output position, and a Blackman window
+				double const x = double(s32(tap) - s32(m_halftaps) + 1) - frac;
+				double const t = x / double(m_halftaps);
+				double const window = (std::abs(t) >= 1.0) ? 0.0 : (0.42 + 0.5 * std::cos(M_PI * t) + 0.08 * std::cos(2.0 * M_PI * t));
+				double const arg = M_PI * cutoff * x;
+				double const sinc = (arg == 0.0) ? 1.0 : (std::sin(arg) / arg);
+				row[tap] = float(sinc * window);
+				total += row[tap];
+			}
+
+			// normalize each phase to unity gain at DC
+			for (u32 tap = 0; tap < taps; tap++)
+				row[tap] = float(row[tap] / total);
+		}
+	}
+
+	// compute one output sample; src points to the input sample halftaps() - 1
+	// before the integer part of the input position, and frac is the rest
+	float filter(float const *src, double frac) const
+	{
+		u32 const phase = u32(frac * double(PHASES) + 0.5);
+		return resampler_dot(src, filter_row(phase), taps());
+	}
+
+	// return the coefficients for the given phase
+	float const *filter_row(u32 phase) const { return &m_coefficients[phase * taps()]; }
+
+private:
+	// internal state
+	u32 m_input_rate;                   // input rate the coefficients were built for
+	u32 m_output_rate;                  // output rate the coefficients were built for
+	u32 m_quality;                      // zero crossings on each side of the kernel
+	u32 m_halftaps;                     // input samples on each side of the output position
+	std::vector<float> m_coefficients;  // (PHASES + 1) rows of taps() coefficients
+};
+
+#endif // MAME_EMU_RESAMPLER_H
@@ -725,7 +725,8 @@ std::unique_ptr<emu_file> rom_load_manager::open_rom_file(
 		const std::vector<std::string> &searchpath,
 		const rom_entry *romp,
 		std::vector<std::string> &tried_file_names,
-		bool from_list)
+		bool from_list,
+		u32 openflags)
 {
 	std::error_condition filerr = std::errc::no_such_file_or_directory;
 	u32 const romsize = rom_file_size(romp);
@@ -738,10 +739,11 @@ std::unique_ptr<emu_file> rom_load_manager::open_rom_file(
 	u32 crc = 0;
 	bool const has_crc = util::hash_collection(romp->hashdata()).crc(crc);
 
-	// attempt reading up the chain through the parents
+	// attempt reading up the chain through the parents, unless a worker already did
 	// it also automatically attempts any kind of load by checksum supported by the archives.
-	std::unique_ptr<emu_file> result(
-			open_rom_file(searchpath, tried_file_names, has_crc, crc, ROM_GETNAME(romp), filerr));
+	std::unique_ptr<emu_file> result;
+	if (!take_preloaded_rom(romp, tried_file_names, result, filerr))
+		result = open_rom_file(searchpath, tried_file_names, has_crc, crc, ROM_GETNAME(romp), openflags, filerr);
 
 	// update counters
 	m_romsloaded++;
@@ -761,13 +763,14 @@ std::unique_ptr<emu_file> rom_load_manager::open_rom_file(
 		bool has_crc,
 		u32 crc,
 		std::string_view name,
+		u32 openflags,
 		std::error_condition &filerr)
 {
 	// record the set names we search
 	tried.insert(tried.end(), paths.begin(), paths.end());
 
 	// attempt to open the file
-	std::unique_ptr<emu_file> result(new emu_file(machine().options().media_path(), paths, OPEN_FLAG_READ));
+	std::unique_ptr<emu_file> result(new emu_file(machine().options().media_path(), paths, openflags));
 	result->set_restrict_to_mediapath(1);
 	if (has_crc)
 		filerr = result->open(name, crc);
@@ -1042,7 +1045,7 @@ void rom_load_manager::process_rom_entries(
 			std::unique_ptr<emu_file> file;
 			if (!irrelevantbios)
 			{
-				file = open_rom_file(searchpath, romp, tried_file_names, from_list);
+				file = open_rom_file(searchpath, romp, tried_file_names, from_list, OPEN_FLAG_READ);
 				if (!file)
 					handle_missing_file(romp, tried_file_names, std::error_condition());
 			}
@@ -1462,12 +1465,99 @@ void rom_load_manager::load_software_part_region(device_t &device, software_list
 }
 
 
+/*-------------------------------------------------
+    alloc_rom_region - allocate a ROM region and
+    clear it as requested
+-------------------------------------------------*/
+
+memory_region &rom_load_manager::alloc_rom_region(std::string const &regiontag, const rom_entry *region, u8 width, endianness_t endianness)
+{
+	// remember the base and length
+	memory_region &memregion = *machine().memory().region_alloc(regiontag, ROMREGION_GETLENGTH(region), width, endianness);
+	LOG("Allocated %X bytes @ %p\n", memregion.bytes(), memregion.base());
+
+	if (ROMREGION_ISERASE(region)) // clear the region if it's requested
+		memset(memregion.base(), ROMREGION_GETERASEVAL(region), memregion.bytes());
+	else if (memregion.bytes() <= 0x400000) // or if it's sufficiently small (<= 4MB)
+		memset(memregion.base(), 0, memregion.bytes());
+#ifdef MAME_DEBUG
+	else // if we're debugging, fill region with random data to catch errors
+		fill_random(memregion.base(), memregion.bytes());
+#endif
+
+	return memregion;
+}
+
+
+/*-------------------------------------------------
+    region_can_map - determine whether a region
+    is exactly the unmodified contents of a single
+    file, so a mapping of the file can stand in
+    for it
+-------------------------------------------------*/
+
+bool rom_load_manager::region_can_map(const rom_entry *region, u8 width, endianness_t endianness) const
+{
+	// post-processing would have to modify every page
+	if (ROMREGION_ISINVERTED(region) || ((width > 1) && (endianness != ENDIANNESS_NATIVE)))
+		return false;
+
+	// exactly one plain load covering the whole region, with nothing else in it
+	const rom_entry *const romp = region + 1;
+	if (!ROMENTRY_ISFILE(romp) || !ROMENTRY_ISREGIONEND(romp + 1) || ROM_GETBIOSFLAGS(romp))
+		return false;
+	return (ROM_GETOFFSET(romp) == 0) && (ROM_GETLENGTH(romp) == ROMREGION_GETLENGTH(region)) &&
+			(ROM_GETBITWIDTH(romp) == 8) && (ROM_GETBITSHIFT(romp) == 0) && (ROM_GETSKIPCOUNT(romp) == 0) &&
+			((ROM_GETGROUPSIZE(romp) == 1) || !ROM_ISREVERSED(romp));
+}
+
+
+/*-------------------------------------------------
+    map_rom_region - create a region from a copy-
+    on-write mapping of its file, or load it the
+    usual way if the file can't be mapped
+-------------------------------------------------*/
+
+void rom_load_manager::map_rom_region(const std::vector<std::string> &searchpath, std::string const &regiontag, const rom_entry *region, u8 width, endianness_t endianness)
+{
+	// don't let the file load archive members into memory when opened
+	const rom_entry *const romp = region + 1;
+	std::vector<std::string> tried_file_names;
+	LOG("Opening ROM file: %s\n", ROM_GETNAME(romp));
+	std::unique_ptr<emu_file> file = open_rom_file(searchpath, romp, tried_file_names, false, OPEN_FLAG_READ | OPEN_FLAG_NO_PRELOAD);
+	if (!file)
+		handle_missing_file(romp, tried_file_names, std::error_condition());
+
+	std::unique_ptr<osd_file> mapping;
+	void *data = nullptr;
+	if (file && (file->size() == ROMREGION_GETLENGTH(region)) && !file->map_private(mapping, data))
+	{
+		memory_region const &memregion = *machine().memory().region_alloc(regiontag, ROMREGION_GETLENGTH(region), width, endianness, std::move(mapping), reinterpret_cast<u8 *>(data));
+		LOG("Mapped %X bytes @ %p\n", memregion.bytes(), data);
+	}
+	else
+	{
+		memory_region &memregion = alloc_rom_region(regiontag, region, width, endianness);
+		read_rom_data(file.get(), memregion, region, romp);
+	}
+
+	LOG("Verifying length (%X) and checksums\n", ROM_GETLENGTH(romp));
+	verify_length_and_hash(file.get(), romp->name(), ROM_GETLENGTH(romp), util::hash_collection(romp->hashdata()));
+	LOG("Verify finished\n");
+}
+
+
 /*-------------------------------------------------
     process_region_list - process a region list
 -------------------------------------------------*/
 
 void rom_load_manager::process_region_list()
 {
+	// open, decompress and hash files ahead of time; make sure no worker is left running if loading fails
+	struct preload_guard { rom_load_manager &manager; ~preload_guard() { manager.finish_preloads(); } } const guard{ *this };
+	if (machine().options().parallel_load())
+		start_preloads();
+
 	// loop until we hit the end
 	device_enumerator deviter(machine().root_device());
 	std::vector<std::string> searchpath;
@@ -1493,24 +1583,20 @@ void rom_load_manager::process_region_list()
 				endianness_t endianness = ROMREGION_ISBIGENDIAN(region) ? ENDIANNESS_BIG : ENDIANNESS_LITTLE;
 				normalize_flags_for_device(regiontag, width, endianness);
 
-				// remember the base and length
-				memory_region *const memregion = machine().memory().region_alloc(regiontag, regionlength, width, endianness);
-				LOG("Allocated %X bytes @ %p\n", memregion->bytes(), memregion->base());
-
-				if (ROMREGION_ISERASE(region)) // clear the region if it's requested
-					memset(memregion->base(), ROMREGION_GETERASEVAL(region), memregion->bytes());
-				else if (memregion->bytes() <= 0x400000) // or if it's sufficiently small (<= 4MB)
-					memset(memregion->base(), 0, memregion->bytes());
-#ifdef MAME_DEBUG
-				else // if we're debugging, fill region with random data to catch errors
-					fill_random(memregion->base(), memregion->bytes());
-#endif
-
-				// now process the entries in the region
 				if (searchpath.empty())
 					searchpath = device.searchpath();
 				assert(!searchpath.empty());
-				process_rom_entries(searchpath, device.system_bios(), *memregion, region, region + 1, false);
+				if (machine().options().map_roms() && region_can_map(region, width, endianness))
+				{
+					// a region loaded whole from one file can come straight from the file
+					map_rom_region(searchpath, regiontag, region, width, endianness);
+				}
+				else
+				{
+					// otherwise allocate it and process the entries in the region
+					memory_region &memregion = alloc_rom_region(regiontag, region, width, endianness);
+					process_rom_entries(searchpath, device.system_bios(), memregion, region, region + 1, false);
+				}
 			}
 			else if (ROMREGION_ISDISKDATA(region))
 			{
@@ -1532,6 +1618,7 @@ void rom_load_manager::process_region_list()
 	}
 
 	// now go back and post-process all the regions
+	finish_preloads();
 	for (device_t &device : deviter)
 		for (const rom_entry *region = rom_first_region(device); region != nullptr; region = rom_next_region(region))
 			region_post_process(device.memregion(region->name()), ROMREGION_ISINVERTED(region));
@@ -1548,6 +1635,172 @@ void rom_load_manager::process_region_list()
 }
 
 
+/*-------------------------------------------------
+    start_preloads - list the ROM files the region
+    list will load, in order, and start opening
+    them on a work queue
+-------------------------------------------------*/
+
+void rom_load_manager::start_preloads()
+{
+	// walk the regions in the same order as process_region_list
+	bool const map_roms = machine().options().map_roms();
+	for (device_t &device : device_enumerator(machine().root_device()))
+	{
+		std::vector<std::string> searchpath;
+		for (const rom_entry *region = rom_first_region(device); region != nullptr; region = rom_next_region(region))
+		{
+			if (!ROMREGION_ISROMDATA(region))
+				continue;
+
+			// mapped regions are opened without loading anything
+			if (map_roms)
+			{
+				u8 width = ROMREGION_GETWIDTH(region) / 8;
+				endianness_t endianness = ROMREGION_ISBIGENDIAN(region) ? ENDIANNESS_BIG : ENDIANNESS_LITTLE;
+				normalize_flags_for_device(device.subtag(region->name()), width, endianness);
+				if (region_can_map(region, width, endianness))
+					continue;
+			}
+
+			for (const rom_entry *romp = rom_first_file(region); romp != nullptr; romp = rom_next_file(romp))
+			{
+				// skip files belonging to BIOSes we aren't using
+				if ((ROM_GETBIOSFLAGS(romp) != 0) && (ROM_GETBIOSFLAGS(romp) != device.system_bios()))
+					continue;
+
+				if (searchpath.empty())
+					searchpath = device.searchpath();
+				auto &preload = *m_preloads.emplace_back(std::make_unique<preloaded_rom>());
+				preload.manager = this;
+				preload.romp = romp;
+				preload.size = rom_file_size(romp);
+				preload.searchpath = searchpath;
+				preload.err = std::errc::no_such_file_or_directory;
+			}
+		}
+	}
+
+	// nothing to gain unless there are several files
+	if (m_preloads.size() < 2)
+	{
+		m_preloads.clear();
+		return;
+	}
+	m_preload_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_IO);
+	if (!m_preload_queue)
+	{
+		m_preloads.clear();
+		return;
+	}
+	queue_preloads();
+}
+
+
+/*-------------------------------------------------
+    queue_preloads - keep a window of ROM files
+    being opened ahead of the loader
+-------------------------------------------------*/
+
+void rom_load_manager::queue_preloads()
+{
+	while ((m_preload_queued < m_preloads.size()) &&
+			((m_preload_queued == m_preload_taken) || ((m_preload_bytes + m_preloads[m_preload_queued]->size) <= PRELOAD_WINDOW_BYTES)))
+	{
+		preloaded_rom &preload(*m_preloads[m_preload_queued++]);
+		preload.item = osd_work_item_queue(m_preload_queue, &rom_load_manager::preload_rom_static, &preload, 0);
+		if (!preload.item)
+			preload.failed = true;
+		m_preload_bytes += preload.size;
+	}
+}
+
+
+/*-------------------------------------------------
+    preload_rom_static - open a ROM file and
+    compute the hashes it will be verified with
+-------------------------------------------------*/
+
+void *rom_load_manager::preload_rom_static(void *param, int threadid)
+{
+	preloaded_rom &preload(*reinterpret_cast<preloaded_rom *>(param));
+	try
+	{
+		util::hash_collection const hashes(preload.romp->hashdata());
+		u32 crc = 0;
+		bool const has_crc = hashes.crc(crc);
+		preload.file = preload.manager->open_rom_file(preload.searchpath, preload.tried, has_crc, crc, ROM_GETNAME(preload.romp), OPEN_FLAG_READ, preload.err);
+		if (preload.file && !hashes.flag(util::hash_collection::FLAG_NO_DUMP))
+			preload.file->hashes(hashes.hash_types());
+	}
+	catch (...)
+	{
+		// let the loader try again and report any errors itself
+		preload.file.reset();
+		preload.failed = true;
+	}
+	return nullptr;
+}
+
+
+/*-------------------------------------------------
+    take_preloaded_rom - wait for the given ROM
+    file to be opened ahead of time, if it is the
+    next one the workers were asked to open
+-------------------------------------------------*/
+
+bool rom_load_manager::take_preloaded_rom(const rom_entry *romp, std::vector<std::string> &tried, std::unique_ptr<emu_file> &file, std::error_condition &filerr)
+{
+	if ((m_preload_taken == m_preload_queued) || (m_preloads[m_preload_taken]->romp != romp))
+		return false;
+
+	// wait for the worker and keep the window full
+	std::unique_ptr<preloaded_rom> const preload(std::move(m_preloads[m_preload_taken++]));
+	if (preload->item)
+	{
+		while (!osd_work_item_wait(preload->item, osd_ticks_per_second()))
+			;
+		osd_work_item_release(preload->item);
+	}
+	m_preload_bytes -= preload->size;
+	queue_preloads();
+
+	if (preload->failed)
+		return false;
+	tried.insert(tried.end(), preload->tried.begin(), preload->tried.end());
+	file = std::move(preload->file);
+	filerr = preload->err;
+	return true;
+}
+
+
+/*-------------------------------------------------
+    finish_preloads - wait for any ROM files still
+    being opened and discard them
+-------------------------------------------------*/
+
+void rom_load_manager::finish_preloads()
+{
+	for ( ; m_preload_taken < m_preload_queued; m_preload_taken++)
+	{
+		preloaded_rom &preload(*m_preloads[m_preload_taken]);
+		if (preload.item)
+		{
+			while (!osd_work_item_wait(preload.item, osd_ticks_per_second()))
+				;
+			osd_work_item_release(preload.item);
+		}
+	}
+	if (m_preload_queue)
+		osd_work_queue_free(m_preload_queue);
+	m_preload_queue = nullptr;
+	m_preloads.clear();
+	m_preload_queued = 0;
+	m_preload_taken = 0;
+	m_preload_bytes = 0;
+}
+
+
 /*-------------------------------------------------
     rom_init - load the ROMs and open the disk
     images associated with the given machine
@@ -1563,6 +1816,10 @@ rom_load_manager::rom_load_manager(running_machine &machine)
 	, m_romsloadedsize(0)
 	, m_romstotalsize(0)
 	, m_chd_list()
+	, m_preload_queue(nullptr)
+	, m_preload_queued(0)
+	, m_preload_taken(0)
+	, m_preload_bytes(0)
 	, m_errorstring()
 	, m_softwarningstring()
 {
@@ -1613,6 +1870,12 @@ rom_load_manager::rom_load_manager(running_machine &machine)
 }
 
 
+rom_load_manager::~rom_load_manager()
+{
+	finish_preloads();
+}
+
+
 // -------------------------------------------------
 // rom_build_entries - builds a rom_entry vector
 // from a tiny_rom_entry array
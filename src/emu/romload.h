@@ -402,9 +402,27 @@ class rom_load_manager
 		chd_file    m_diffchd;  // handle to the diff CHD
 	};
 
+	// a ROM file opened and hashed ahead of the loader on a work queue
+	struct preloaded_rom
+	{
+		rom_load_manager *          manager = nullptr;  // manager that queued us
+		const rom_entry *           romp = nullptr;     // ROM entry to open
+		u32                         size = 0;           // expected file size
+		std::vector<std::string>    searchpath;         // paths to search
+		std::vector<std::string>    tried;              // paths actually searched
+		std::unique_ptr<emu_file>   file;               // file, if it was found
+		std::error_condition        err;                // result of opening it
+		osd_work_item *             item = nullptr;     // work item doing the open
+		bool                        failed = false;     // worker gave up; open it again
+	};
+
+	// maximum number of bytes of ROM files held open ahead of the loader
+	static constexpr u64 PRELOAD_WINDOW_BYTES = 64 * 1024 * 1024;
+
 public:
 	// construction/destruction
 	rom_load_manager(running_machine &machine);
+	~rom_load_manager();
 
 	// getters
 	running_machine &machine() const { return m_machine; }
@@ -450,13 +468,15 @@ private:
 			const std::vector<std::string> &searchpath,
 			const rom_entry *romp,
 			std::vector<std::string> &tried_file_names,
-			bool from_list);
+			bool from_list,
+			u32 openflags);
 	std::unique_ptr<emu_file> open_rom_file(
 			const std::vector<std::string> &paths,
 			std::vector<std::string> &tried,
 			bool has_crc,
 			u32 crc,
 			std::string_view name,
+			u32 openflags,
 			std::error_condition &filerr);
 	int rom_fread(emu_file *file, u8 *buffer, int length, const rom_entry *parent_region);
 	int read_rom_data(emu_file *file, memory_region &region, const rom_entry *parent_region, const rom_entry *romp);
@@ -481,7 +501,15 @@ private:
 			std::function<const rom_entry * ()> next_parent,
 			const chd_file::open_parent_func &open_parent);
 	void normalize_flags_for_device(std::string_view rgntag, u8 &width, endianness_t &endian);
+	memory_region &alloc_rom_region(std::string const &regiontag, const rom_entry *region, u8 width, endianness_t endianness);
+	bool region_can_map(const rom_entry *region, u8 width, endianness_t endianness) const;
+	void map_rom_region(const std::vector<std::string> &searchpath, std::string const &regiontag, const rom_entry *region, u8 width, endianness_t endianness);
 	void process_region_list();
+	void start_preloads();
+	void queue_preloads();
+	bool take_preloaded_rom(const rom_entry *romp, std::vector<std::string> &tried, std::unique_ptr<emu_file> &file, std::error_condition &filerr);
+	void finish_preloads();
+	static void *preload_rom_static(void *param, int threadid);
 
 	// internal state
 	running_machine &   m_machine;            // reference to our machine
@@ -497,6 +525,12 @@ private:
 
 	std::vector<std::unique_ptr<open_chd>> m_chd_list;     /* disks */
 
+	osd_work_queue *    m_preload_queue;      // work queue opening ROM files ahead of time
+	std::vector<std::unique_ptr<preloaded_rom>> m_preloads; // ROM files in load order
+	size_t              m_preload_queued;     // number of preloads queued so far
+	size_t              m_preload_taken;      // number of preloads consumed so far
+	u64                 m_preload_bytes;      // bytes queued but not yet consumed
+
 	std::string         m_errorstring;        // error string
 	std::string         m_softwarningstring;  // software warning string
 };
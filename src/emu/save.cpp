@@ -15,7 +15,8 @@
     09      Flags
     0A..1B  Game name padded with \0
     1C..1F  Signature
-    20..end Save game data (compressed)
+    20..end Save game data (compressed with zlib, or with zstd if flag
+            0x04 is set)
 
     Data is always written as native-endian.
     Data is converted from the endiannness it was written upon load.
@@ -30,6 +31,8 @@
 #include "util/ioprocs.h"
 #include "util/ioprocsfilter.h"
 
+#include <zstd.h>
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -51,7 +54,8 @@ const int HEADER_SIZE       = 32;
 // Available flags
 enum
 {
-	SS_MSB_FIRST = 0x02
+	SS_MSB_FIRST = 0x02,
+	SS_ZSTD      = 0x04
 };
 
 #define STATE_MAGIC_NUM         "MAMESAVE"
@@ -85,14 +89,14 @@ void save_manager::allow_registration(bool allowed)
 	{
 		// look for duplicates
 		std::sort(m_entry_list.begin(), m_entry_list.end(),
-				[] (std::unique_ptr<state_entry> const& a, std::unique_ptr<state_entry> const& b) { return a->m_name < b->m_name; });
+				[] (state_entry const &a, state_entry const &b) { return a.m_name < b.m_name; });
 
 		int dupes_found = 0;
 		for (int i = 1; i < m_entry_list.size(); i++)
 		{
-			if (m_entry_list[i - 1]->m_name == m_entry_list[i]->m_name)
+			if (m_entry_list[i - 1].m_name == m_entry_list[i].m_name)
 			{
-				osd_printf_error("Duplicate save state registration entry (%s)\n", m_entry_list[i]->m_name);
+				osd_printf_error("Duplicate save state registration entry (%s)\n", m_entry_list[i].m_name);
 				dupes_found++;
 			}
 		}
@@ -118,7 +122,7 @@ const char *save_manager::indexed_item(int index, void *&base, u32 &valsize, u32
 	if (index >= m_entry_list.size() || index < 0)
 		return nullptr;
 
-	state_entry *entry = m_entry_list.at(index).get();
+	state_entry const *entry = &m_entry_list.at(index);
 	base = entry->m_data;
 	valsize = entry->m_typesize;
 	valcount = entry->m_typecount;
@@ -150,6 +154,27 @@ void save_manager::register_presave(save_prepost_delegate func)
 }
 
 
+//-------------------------------------------------
+//  register_preload - register a pre-load
+//  function callback
+//-------------------------------------------------
+
+void save_manager::register_preload(save_prepost_delegate func)
+{
+	// check for invalid timing
+	if (!m_reg_allowed)
+		fatalerror("Attempt to register callback function after state registration is closed!\n");
+
+	// scan for duplicates and push through to the end
+	for (auto &cb : m_preload_list)
+		if (cb->m_func == func)
+			fatalerror("Duplicate save state function (%s/%s)\n", cb->m_func.name(), func.name());
+
+	// allocate a new entry
+	m_preload_list.push_back(std::make_unique<state_callback>(func));
+}
+
+
 //-------------------------------------------------
 //  state_save_register_postload -
 //  register a post-load function callback
@@ -197,7 +222,7 @@ void save_manager::save_memory(device_t *device, const char *module, const char
 		totalname = string_format("%s/%X/%s", module, index, name);
 
 	// insert us into the list
-	m_entry_list.emplace_back(std::make_unique<state_entry>(val, std::move(totalname), device, module, tag ? tag : "", index, valsize, valcount, blockcount, stride));
+	m_entry_list.emplace_back(val, std::move(totalname), device, module, tag ? tag : "", index, valsize, valcount, blockcount, stride);
 }
 
 
@@ -240,6 +265,18 @@ void save_manager::dispatch_postload()
 }
 
 
+//-------------------------------------------------
+//  dispatch_preload - invoke all registered
+//  preload callbacks before state is overwritten
+//-------------------------------------------------
+
+void save_manager::dispatch_preload()
+{
+	for (auto &func : m_preload_list)
+		func->m_func();
+}
+
+
 //-------------------------------------------------
 //  dispatch_presave - invoke all registered
 //  presave callbacks for updates
@@ -256,8 +293,16 @@ void save_manager::dispatch_presave()
 //  write_file - writes the data to a file
 //-------------------------------------------------
 
-save_error save_manager::write_file(util::core_file &file)
+save_error save_manager::write_file(util::core_file &file, file_compression compression)
 {
+	// zstd compresses the whole state in one go
+	if (file_compression::ZLIB != compression)
+	{
+		std::vector<u8> state;
+		save_error const err = write_buffer(state);
+		return (STATERR_NONE != err) ? err : write_file(file, state, compression);
+	}
+
 	util::write_stream::ptr writer;
 	save_error err = do_write(
 			[] (size_t total_size) { return true; },
@@ -284,12 +329,86 @@ save_error save_manager::write_file(util::core_file &file)
 }
 
 
+//-------------------------------------------------
+//  write_file - compress a state captured with
+//  write_buffer to a file; this doesn't touch the
+//  machine, so it may be called from any thread
+//-------------------------------------------------
+
+save_error save_manager::write_file(util::core_file &file, const std::vector<u8> &state, file_compression compression)
+{
+	if (state.size() < HEADER_SIZE)
+		return STATERR_WRITE_ERROR;
+
+	// the header is always uncompressed
+	u8 header[HEADER_SIZE];
+	memcpy(header, &state[0], HEADER_SIZE);
+	if (file_compression::ZSTD == compression)
+		header[9] |= SS_ZSTD;
+	if (file.seek(0, SEEK_SET))
+		return STATERR_WRITE_ERROR;
+	auto const [headerr, headwritten] = write(file, header, sizeof(header));
+	if (headerr)
+		return STATERR_WRITE_ERROR;
+
+	const u8 *const data = &state[HEADER_SIZE];
+	const size_t size = state.size() - HEADER_SIZE;
+	if (file_compression::ZSTD == compression)
+	{
+		std::vector<u8> compressed(ZSTD_compressBound(size));
+		const size_t compsize = ZSTD_compress(&compressed[0], compressed.size(), data, size, ZSTD_CLEVEL_DEFAULT);
+		if (ZSTD_isError(compsize))
+			return STATERR_WRITE_ERROR;
+		auto const [filerr, written] = write(file, &compressed[0], compsize);
+		return filerr ? STATERR_WRITE_ERROR : STATERR_NONE;
+	}
+	else
+	{
+		util::write_stream::ptr writer = util::zlib_write(file, 6, 16384);
+		if (!writer)
+			return STATERR_WRITE_ERROR;
+		auto const [filerr, written] = write(*writer, data, size);
+		return (filerr || writer->finalize()) ? STATERR_WRITE_ERROR : STATERR_NONE;
+	}
+}
+
+
 //-------------------------------------------------
 //  read_file - read the data from a file
 //-------------------------------------------------
 
 save_error save_manager::read_file(util::core_file &file)
 {
+	// check the header for the compression used
+	u8 header[HEADER_SIZE];
+	if (file.seek(0, SEEK_SET))
+		return STATERR_READ_ERROR;
+	auto const [headerr, headactual] = read(file, header, sizeof(header));
+	if (headerr || (headactual != sizeof(header)))
+		return STATERR_READ_ERROR;
+
+	// zstd-compressed states are decompressed in one go
+	if (header[9] & SS_ZSTD)
+	{
+		if (validate_header(header, machine().system().name, signature(), nullptr, "Error: ") != STATERR_NONE)
+			return STATERR_INVALID_HEADER;
+
+		std::uint64_t length;
+		if (file.length(length) || (length < HEADER_SIZE))
+			return STATERR_READ_ERROR;
+		std::vector<u8> compressed(length - HEADER_SIZE);
+		auto const [filerr, actual] = read(file, &compressed[0], compressed.size());
+		if (filerr || (actual != compressed.size()))
+			return STATERR_READ_ERROR;
+
+		std::vector<u8> state(ram_state::get_size(*this));
+		memcpy(&state[0], header, HEADER_SIZE);
+		const size_t size = ZSTD_decompress(&state[HEADER_SIZE], state.size() - HEADER_SIZE, &compressed[0], compressed.size());
+		if (ZSTD_isError(size) || (size != (state.size() - HEADER_SIZE)))
+			return STATERR_READ_ERROR;
+		return read_buffer(&state[0], state.size());
+	}
+
 	util::read_stream::ptr reader;
 	return do_read(
 			[] (size_t total_size) { return true; },
@@ -371,6 +490,18 @@ save_error save_manager::write_buffer(void *buf, size_t size)
 }
 
 
+//-------------------------------------------------
+//  write_buffer - write the current machine state
+//  to a buffer, resizing it to fit
+//-------------------------------------------------
+
+save_error save_manager::write_buffer(std::vector<u8> &buf)
+{
+	buf.resize(ram_state::get_size(*this));
+	return write_buffer(&buf[0], buf.size());
+}
+
+
 //-------------------------------------------------
 //  read_buffer - restore the machine state from a
 //  buffer
@@ -405,7 +536,7 @@ inline save_error save_manager::do_write(T check_space, U write_block, V start_h
 	// check for sufficient space
 	size_t total_size = HEADER_SIZE;
 	for (const auto &entry : m_entry_list)
-		total_size += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
+		total_size += entry.m_typesize * entry.m_typecount * entry.m_blockcount;
 	if (!check_space(total_size))
 		return STATERR_WRITE_ERROR;
 
@@ -428,9 +559,9 @@ inline save_error save_manager::do_write(T check_space, U write_block, V start_h
 	// then write all the data
 	for (auto &entry : m_entry_list)
 	{
-		const u32 blocksize = entry->m_typesize * entry->m_typecount;
-		const u8 *data = reinterpret_cast<const u8 *>(entry->m_data);
-		for (u32 b = 0; entry->m_blockcount > b; ++b, data += entry->m_stride)
+		const u32 blocksize = entry.m_typesize * entry.m_typecount;
+		const u8 *data = reinterpret_cast<const u8 *>(entry.m_data);
+		for (u32 b = 0; entry.m_blockcount > b; ++b, data += entry.m_stride)
 			if (!write_block(data, blocksize))
 				return STATERR_WRITE_ERROR;
 	}
@@ -448,7 +579,7 @@ inline save_error save_manager::do_read(T check_length, U read_block, V start_he
 	// check for sufficient space
 	size_t total_size = HEADER_SIZE;
 	for (const auto &entry : m_entry_list)
-		total_size += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
+		total_size += entry.m_typesize * entry.m_typecount * entry.m_blockcount;
 	if (!check_length(total_size))
 		return STATERR_READ_ERROR;
 
@@ -465,18 +596,21 @@ inline save_error save_manager::do_read(T check_length, U read_block, V start_he
 	// determine whether or not to flip the data when done
 	const bool flip = NATIVE_ENDIAN_VALUE_LE_BE((header[9] & SS_MSB_FIRST) != 0, (header[9] & SS_MSB_FIRST) == 0);
 
+	// call the pre-load functions
+	dispatch_preload();
+
 	// read all the data, flipping if necessary
 	for (auto &entry : m_entry_list)
 	{
-		const u32 blocksize = entry->m_typesize * entry->m_typecount;
-		u8 *data = reinterpret_cast<u8 *>(entry->m_data);
-		for (u32 b = 0; entry->m_blockcount > b; ++b, data += entry->m_stride)
+		const u32 blocksize = entry.m_typesize * entry.m_typecount;
+		u8 *data = reinterpret_cast<u8 *>(entry.m_data);
+		for (u32 b = 0; entry.m_blockcount > b; ++b, data += entry.m_stride)
 			if (!read_block(data, blocksize))
 				return STATERR_READ_ERROR;
 
 		// handle flipping
 		if (flip)
-			entry->flip_data();
+			entry.flip_data();
 	}
 
 	// call the post-load functions
@@ -498,14 +632,14 @@ u32 save_manager::signature() const
 	for (auto &entry : m_entry_list)
 	{
 		// add the entry name to the CRC
-		crc.append(entry->m_name.data(), entry->m_name.length());
+		crc.append(entry.m_name.data(), entry.m_name.length());
 
 		// add the type and size to the CRC
 		u32 temp[4];
-		temp[0] = little_endianize_int32(entry->m_typesize);
-		temp[1] = little_endianize_int32(entry->m_typecount);
-		temp[2] = little_endianize_int32(entry->m_blockcount);
-		temp[3] = little_endianize_int32(entry->m_stride);
+		temp[0] = little_endianize_int32(entry.m_typesize);
+		temp[1] = little_endianize_int32(entry.m_typecount);
+		temp[2] = little_endianize_int32(entry.m_blockcount);
+		temp[3] = little_endianize_int32(entry.m_stride);
 		crc.append(&temp[0], sizeof(temp));
 	}
 	return crc.finish();
@@ -520,7 +654,7 @@ u32 save_manager::signature() const
 void save_manager::dump_registry() const
 {
 	for (auto &entry : m_entry_list)
-		LOG(("%s: %u x %u x %u (%u)\n", entry->m_name.c_str(), entry->m_typesize, entry->m_typecount, entry->m_blockcount, entry->m_stride));
+		LOG(("%s: %u x %u x %u (%u)\n", entry.m_name.c_str(), entry.m_typesize, entry.m_typecount, entry.m_blockcount, entry.m_stride));
 }
 
 
@@ -587,15 +721,10 @@ save_manager::state_callback::state_callback(save_prepost_delegate callback)
 
 ram_state::ram_state(save_manager &save)
 	: m_save(save)
-	, m_data()
+	, m_size(0)
 	, m_valid(false)
 	, m_time(m_save.machine().time())
 {
-	m_data.reserve(get_size(save));
-	m_data.clear();
-	m_data.rdbuf()->clear();
-	m_data.seekp(0);
-	m_data.seekg(0);
 }
 
 
@@ -609,29 +738,198 @@ size_t ram_state::get_size(save_manager &save)
 	size_t totalsize = 0;
 
 	for (auto &entry : save.m_entry_list)
-		totalsize += entry->m_typesize * entry->m_typecount * entry->m_blockcount;
+		totalsize += entry.m_typesize * entry.m_typecount * entry.m_blockcount;
 
 	return totalsize + HEADER_SIZE;
 }
 
 
+//-------------------------------------------------
+//  memory_used - bytes of page memory held by
+//  this state, with shared pages apportioned
+//  between the states holding them
+//-------------------------------------------------
+
+size_t ram_state::memory_used() const
+{
+	size_t total = 0;
+	for (page const &entry : m_pages)
+		total += (PAGE_BYTES / entry.base.use_count()) + entry.delta.size();
+	return total;
+}
+
+
+//-------------------------------------------------
+//  keyframe_pages - the pages of a state saved in
+//  full, for use as a keyframe
+//-------------------------------------------------
+
+ram_state::page_list ram_state::keyframe_pages() const
+{
+	page_list result;
+	result.reserve(m_pages.size());
+	for (page const &entry : m_pages)
+	{
+		assert(entry.delta.empty());
+		result.emplace_back(entry.base);
+	}
+	return result;
+}
+
+
+//-------------------------------------------------
+//  encode_delta - run-length code the XOR of a
+//  page against its keyframe page as (skip,
+//  count, bytes) records; returns false if the
+//  result isn't worth keeping
+//-------------------------------------------------
+
+bool ram_state::encode_delta(const u8 *base, const u8 *data, size_t size, std::vector<u8> &delta)
+{
+	delta.clear();
+	size_t pos = 0;
+	while (pos < size)
+	{
+		// find the next difference
+		size_t start = pos;
+		while ((start < size) && (base[start] == data[start]))
+			start++;
+		if (start == size)
+			break;
+
+		// extend the run until four bytes in a row match, which would cost as much as a new record
+		size_t end = start;
+		size_t last = start;
+		while ((end < size) && ((end - last) < 4))
+		{
+			if (base[end] != data[end])
+				last = end + 1;
+			end++;
+		}
+
+		const size_t skip = start - pos;
+		const size_t count = last - start;
+		delta.push_back(u8(skip));
+		delta.push_back(u8(skip >> 8));
+		delta.push_back(u8(count));
+		delta.push_back(u8(count >> 8));
+		for (size_t i = start; last > i; i++)
+			delta.push_back(base[i] ^ data[i]);
+		if (delta.size() > (PAGE_BYTES / 2))
+			return false;
+		pos = last;
+	}
+	return true;
+}
+
+
+//-------------------------------------------------
+//  apply_delta - XOR a run-length coded delta
+//  onto a copy of its keyframe page
+//-------------------------------------------------
+
+void ram_state::apply_delta(const std::vector<u8> &delta, u8 *data)
+{
+	const u8 *src = delta.data();
+	const u8 *const end = src + delta.size();
+	while (src < end)
+	{
+		data += src[0] | (src[1] << 8);
+		size_t count = src[2] | (src[3] << 8);
+		src += 4;
+		while (count--)
+			*data++ ^= *src++;
+	}
+}
+
+
 //-------------------------------------------------
 //  save - write the current machine state to the
-//  allocated stream
+//  page list; pages are coded against the given
+//  keyframe unless a full state is requested
 //-------------------------------------------------
 
-save_error ram_state::save()
+save_error ram_state::save(const page_list *keyframe, bool full)
 {
 	// initialize
 	m_valid = false;
-	m_data.seekp(0);
+
+	// pages can only be shared with a state of the same layout
+	const size_t size = get_size(m_save);
+	const size_t count = (size + PAGE_BYTES - 1) / PAGE_BYTES;
+	const page_list *const reference = (keyframe && (keyframe->size() == count)) ? keyframe : nullptr;
+	std::vector<page> pages;
+	pages.swap(m_spare);
+	pages.clear();
+	pages.reserve(count);
+
+	// the page being filled is only copied once it differs from the reference;
+	// repeated captures of a mostly unchanged machine don't touch the heap
+	std::unique_ptr<u8 []> scratch(std::move(m_scratch));
+	if (!scratch)
+		scratch.reset(new u8[PAGE_BYTES]);
+	bool differs = false;
+	size_t fill = 0;
+	auto const finish_page =
+		[&pages, &scratch, &differs, &fill, reference, full] ()
+		{
+			page entry;
+			if (!differs)
+				entry.base = (*reference)[pages.size()];
+			else if (!full && reference && encode_delta(&(*reference)[pages.size()][0], &scratch[0], fill, entry.delta))
+				entry.base = (*reference)[pages.size()];
+			else
+			{
+				entry.delta.clear();
+				entry.base = std::move(scratch);
+				scratch.reset(new u8[PAGE_BYTES]);
+			}
+			pages.emplace_back(std::move(entry));
+			differs = false;
+			fill = 0;
+		};
 
 	// get the save manager to write state
-	const save_error err = m_save.write_stream(m_data);
+	const save_error err = m_save.do_write(
+			[] (size_t total_size) { return true; },
+			[&pages, &scratch, &differs, &fill, reference, &finish_page] (const void *data, size_t size)
+			{
+				const u8 *src = reinterpret_cast<const u8 *>(data);
+				while (size)
+				{
+					const size_t chunk = std::min(size, PAGE_BYTES - fill);
+					if (!differs && (!reference || memcmp(&(*reference)[pages.size()][fill], src, chunk)))
+					{
+						differs = true;
+						if (fill)
+							memcpy(&scratch[0], &(*reference)[pages.size()][0], fill);
+					}
+					if (differs)
+						memcpy(&scratch[fill], src, chunk);
+					src += chunk;
+					size -= chunk;
+					fill += chunk;
+					if (fill == PAGE_BYTES)
+						finish_page();
+				}
+				return true;
+			},
+			[] () { return true; },
+			[] () { return true; });
 	if (err != STATERR_NONE)
+	{
+		m_scratch = std::move(scratch);
 		return err;
-
-	// final confirmation
+	}
+	if (fill)
+		finish_page();
+	m_scratch = std::move(scratch);
+
+	// final confirmation; the old list keeps its capacity for the next capture
+	m_pages.swap(pages);
+	pages.clear();
+	m_spare.swap(pages);
+	m_size = size;
 	m_valid = true;
 	m_time = m_save.machine().time();
 
@@ -641,16 +939,58 @@ save_error ram_state::save()
 
 //-------------------------------------------------
 //  load - restore the machine state from the
-//  stream
+//  page list
 //-------------------------------------------------
 
 save_error ram_state::load()
 {
-	// initialize
-	m_data.seekg(0);
-
 	// get the save manager to load state
-	return m_save.read_stream(m_data);
+	if (!m_scratch)
+		m_scratch.reset(new u8[PAGE_BYTES]);
+	std::unique_ptr<u8 []> &scratch = m_scratch;
+	auto entry = m_pages.cbegin();
+	const u8 *source = nullptr;
+	size_t offset = 0;
+	return m_save.do_read(
+			[this] (size_t total_size) { return total_size == m_size; },
+			[this, &scratch, &entry, &source, &offset] (void *data, size_t size) -> bool
+			{
+				u8 *dest = reinterpret_cast<u8 *>(data);
+				while (size)
+				{
+					if (m_pages.cend() == entry)
+						return false;
+
+					// reconstruct coded pages as we reach them
+					if (!offset)
+					{
+						if (entry->delta.empty())
+						{
+							source = &entry->base[0];
+						}
+						else
+						{
+							memcpy(&scratch[0], &entry->base[0], PAGE_BYTES);
+							apply_delta(entry->delta, &scratch[0]);
+							source = &scratch[0];
+						}
+					}
+
+					const size_t chunk = std::min(size, PAGE_BYTES - offset);
+					memcpy(dest, source + offset, chunk);
+					dest += chunk;
+					size -= chunk;
+					offset += chunk;
+					if (offset == PAGE_BYTES)
+					{
+						++entry;
+						offset = 0;
+					}
+				}
+				return true;
+			},
+			[] () { return true; },
+			[] () { return true; });
 }
 
 
@@ -666,6 +1006,7 @@ rewinder::rewinder(save_manager &save)
 	, m_first_invalid_index(REWIND_INDEX_NONE)
 	, m_first_time_warning(true)
 	, m_first_time_note(true)
+	, m_since_keyframe(0)
 {
 }
 
@@ -735,11 +1076,12 @@ bool rewinder::capture()
 		return false;
 	}
 
+	s32 written;
 	if (current_index_is_last())
 	{
 		// we need to create a new state
 		std::unique_ptr<ram_state> state = std::make_unique<ram_state>(m_save);
-		const save_error error = state->save();
+		const save_error error = save_state(*state);
 
 		// validate the state
 		if (error == STATERR_NONE)
@@ -751,6 +1093,7 @@ bool rewinder::capture()
 			report_error(error, rewind_operation::SAVE);
 			return false;
 		}
+		written = m_state_list.size() - 1;
 	}
 	else
 	{
@@ -759,7 +1102,7 @@ bool rewinder::capture()
 
 		// update the existing state
 		ram_state *state = m_state_list.at(m_current_index).get();
-		const save_error error = state->save();
+		const save_error error = save_state(*state);
 
 		// validate the state
 		if (error != STATERR_NONE)
@@ -768,12 +1111,11 @@ bool rewinder::capture()
 			report_error(error, rewind_operation::SAVE);
 			return false;
 		}
+		written = m_current_index;
 	}
 
-	// make sure we will fit in
-	if (!check_size())
-		// the list keeps growing
-		m_current_index++;
+	// make sure we fit in, dropping old states if necessary
+	m_current_index += 1 - check_size(written);
 
 	// update first invalid index
 	if (current_index_is_last())
@@ -827,64 +1169,62 @@ bool rewinder::step()
 
 
 //-------------------------------------------------
-//  check_size - shrink the state list if it is
-//  about to hit the capacity. returns true if
-//  the list got shrank
+//  save_state - capture a state, coded against
+//  the last keyframe except when a new keyframe
+//  is due
 //-------------------------------------------------
 
-bool rewinder::check_size()
+save_error rewinder::save_state(ram_state &state)
 {
-	if (!m_enabled)
-		return false;
-
-	// state sizes in bytes
-	const size_t singlesize = ram_state::get_size(m_save);
-	size_t totalsize = m_state_list.size() * singlesize;
-
-	// convert our limit from megabytes
-	const size_t capsize = m_capacity * 1024 * 1024;
-
-	// safety check that shouldn't be allowed to trigger
-	if (totalsize > capsize)
+	const bool keyframe = m_keyframe.empty() || (++m_since_keyframe >= KEYFRAME_INTERVAL);
+	const save_error error = state.save(&m_keyframe, keyframe);
+	if ((error == STATERR_NONE) && keyframe)
 	{
-		// states to remove
-		const u32 count = (totalsize - capsize) / singlesize;
-
-		// drop everything that's beyond capacity
-		m_state_list.erase(m_state_list.begin(), m_state_list.begin() + count);
+		// later states are coded against this one; deltas keep their own references to the old keyframe's pages
+		m_keyframe = state.keyframe_pages();
+		m_since_keyframe = 0;
 	}
+	return error;
+}
 
-	// update before new check
-	totalsize = m_state_list.size() * singlesize;
 
-	// check if capacity will be hit by the newly captured state
-	if (totalsize + singlesize >= capsize)
-	{
-		// check if we have spare states ahead
-		if (!current_index_is_last())
-			// no need to move states around
-			return false;
+//-------------------------------------------------
+//  check_size - drop the oldest states until the
+//  list fits in the capacity, keeping the given
+//  state. returns the number of states dropped
+//-------------------------------------------------
+
+u32 rewinder::check_size(s32 keep)
+{
+	if (!m_enabled)
+		return 0;
 
-		// we can now get the first state and invalidate it
-		std::unique_ptr<ram_state> first(std::move(m_state_list.front()));
-		first->m_valid = false;
+	// convert our limit from megabytes
+	const size_t capsize = m_capacity * 1024 * 1024;
 
-		// move it to the end for future use
-		m_state_list.push_back(std::move(first));
-		m_state_list.erase(m_state_list.begin());
+	u32 count = 0;
+	while (s32(count) < keep)
+	{
+		// pages shared between states are only counted once
+		size_t totalsize = 0;
+		for (auto const &state : m_state_list)
+			totalsize += state->memory_used();
+		if (totalsize <= capsize)
+			break;
 
 		if (m_first_time_note)
 		{
 			m_save.machine().logerror("Rewind note: Capacity has been reached. Old savestates will be erased.\n");
 			m_save.machine().logerror("Capacity: %d bytes. Savestate size: %d bytes. Savestate count: %d.\n",
-				totalsize, singlesize, m_state_list.size());
+				totalsize, ram_state::get_size(m_save), m_state_list.size());
 			m_first_time_note = false;
 		}
 
-		return true;
+		m_state_list.erase(m_state_list.begin());
+		count++;
 	}
 
-	return false;
+	return count;
 }
 
 
@@ -19,6 +19,7 @@
 
 #include <array>
 #include <cassert>
+#include <deque>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -151,6 +152,9 @@ public:
 	template <typename T> struct pointer_unwrap<T *> { using underlying_type = typename array_unwrap<T>::underlying_type; };
 	template <typename T> struct pointer_unwrap<std::unique_ptr<T []> > { using underlying_type = typename array_unwrap<T>::underlying_type; };
 
+	// compression used for state files
+	enum class file_compression { ZLIB, ZSTD };
+
 	// construction/destruction
 	save_manager(running_machine &machine);
 
@@ -166,10 +170,12 @@ public:
 
 	// function registration
 	void register_presave(save_prepost_delegate func);
+	void register_preload(save_prepost_delegate func);
 	void register_postload(save_prepost_delegate func);
 
 	// callback dispatching
 	void dispatch_presave();
+	void dispatch_preload();
 	void dispatch_postload();
 
 	// generic memory registration
@@ -300,13 +306,15 @@ public:
 
 	// file processing
 	static save_error check_file(running_machine &machine, util::core_file &file, const char *gamename, void (CLIB_DECL *errormsg)(const char *fmt, ...));
-	save_error write_file(util::core_file &file);
+	save_error write_file(util::core_file &file, file_compression compression = file_compression::ZLIB);
+	static save_error write_file(util::core_file &file, const std::vector<u8> &state, file_compression compression);
 	save_error read_file(util::core_file &file);
 
 	save_error write_stream(std::ostream &str);
 	save_error read_stream(std::istream &str);
 
 	save_error write_buffer(void *buf, size_t size);
+	save_error write_buffer(std::vector<u8> &buf);
 	save_error read_buffer(const void *buf, size_t size);
 
 private:
@@ -334,16 +342,37 @@ private:
 	std::unique_ptr<rewinder> m_rewind;               // rewinder
 	bool                      m_reg_allowed;          // are registrations allowed?
 
-	std::vector<std::unique_ptr<state_entry>>    m_entry_list;       // list of registered entries
+	std::vector<state_entry>                     m_entry_list;       // list of registered entries, stored contiguously
 	std::vector<std::unique_ptr<ram_state>>      m_ramstate_list;    // list of ram states
 	std::vector<std::unique_ptr<state_callback>> m_presave_list;     // list of pre-save functions
+	std::vector<std::unique_ptr<state_callback>> m_preload_list;     // list of pre-load functions
 	std::vector<std::unique_ptr<state_callback>> m_postload_list;    // list of post-load functions
 };
 
+// a ram_state holds its data in fixed-size pages; pages that match the
+// keyframe passed to save() share its memory, and other pages are stored as
+// a run-length coded XOR against the keyframe page when that is small enough
 class ram_state
 {
+public:
+	static constexpr size_t PAGE_BYTES = 4096;
+	using page_list = std::vector<std::shared_ptr<const u8 []> >;
+
+private:
+	struct page
+	{
+		std::shared_ptr<const u8 []> base;            // full page, or keyframe page the delta applies to
+		std::vector<u8>    delta;                     // run-length coded XOR against base, empty if none
+	};
+
+	static bool encode_delta(const u8 *base, const u8 *data, size_t size, std::vector<u8> &delta);
+	static void apply_delta(const std::vector<u8> &delta, u8 *data);
+
 	save_manager &     m_save;                        // reference to save_manager
-	util::vectorstream m_data;                        // save data buffer
+	std::vector<page>  m_pages;                       // save data, PAGE_BYTES per page
+	std::vector<page>  m_spare;                       // page list storage kept between captures
+	std::unique_ptr<u8 []> m_scratch;                 // page buffer kept between captures and loads
+	size_t             m_size;                        // total bytes of save data
 
 public:
 	bool               m_valid;                       // can we load this state?
@@ -351,7 +380,9 @@ public:
 
 	ram_state(save_manager &save);
 	static size_t get_size(save_manager &save);
-	save_error save();
+	size_t memory_used() const;
+	page_list keyframe_pages() const;
+	save_error save(const page_list *keyframe = nullptr, bool full = true);
 	save_error load();
 };
 
@@ -364,7 +395,12 @@ class rewinder
 	s32            m_first_invalid_index;             // all states before this one are guarateed to be valid
 	bool           m_first_time_warning;              // keep track of warnings we report
 	bool           m_first_time_note;                 // keep track of notes
-	std::vector<std::unique_ptr<ram_state>> m_state_list; // rewinder's own ram states
+	std::deque<std::unique_ptr<ram_state>> m_state_list; // rewinder's own ram states, oldest first
+	ram_state::page_list m_keyframe;                  // pages of the most recent keyframe
+	u32            m_since_keyframe;                  // captures since the last keyframe
+
+	// a full keyframe is captured every this many states
+	static constexpr u32 KEYFRAME_INTERVAL = 32;
 
 	// load/save management
 	enum class rewind_operation
@@ -379,7 +415,8 @@ class rewinder
 		REWIND_INDEX_FIRST
 	};
 
-	bool check_size();
+	save_error save_state(ram_state &state);
+	u32 check_size(s32 keep);
 	bool current_index_is_last() { return m_current_index == m_state_list.size() - 1; }
 	void report_error(save_error type, rewind_operation operation);
 
@@ -34,6 +34,9 @@ enum
 	TRIGGER_SUSPENDTIME = -4000
 };
 
+// heap index of timers that are not in the active heap
+constexpr u32 TIMER_HEAP_NONE = ~u32(0);
+
 
 
 //**************************************************************************
@@ -48,6 +51,8 @@ inline emu_timer::emu_timer() noexcept :
 	m_scheduler(nullptr),
 	m_next(nullptr),
 	m_prev(nullptr),
+	m_heapindex(TIMER_HEAP_NONE),
+	m_sequence(0),
 	m_param(0),
 	m_enabled(false),
 	m_temporary(false),
@@ -83,6 +88,7 @@ inline emu_timer &emu_timer::init(
 	m_scheduler = &machine.scheduler();
 	m_next = nullptr;
 	m_prev = nullptr;
+	m_heapindex = TIMER_HEAP_NONE;
 	m_callback = std::move(callback);
 	m_param = param;
 	m_temporary = temporary;
@@ -99,7 +105,7 @@ inline emu_timer &emu_timer::init(
 	// insert into the list
 	m_scheduler->timer_list_insert(*this);
 	if (this == m_scheduler->first_timer())
-		m_scheduler->abort_timeslice();
+		m_scheduler->abort_for_timer();
 
 	return *this;
 }
@@ -161,7 +167,7 @@ void emu_timer::adjust(attotime start_delay, s32 param, const attotime &period)
 
 	// if this was inserted as the head, abort the current timeslice and resync
 	if (this == m_scheduler->first_timer())
-		m_scheduler->abort_timeslice();
+		m_scheduler->abort_for_timer();
 }
 
 
@@ -204,7 +210,7 @@ void emu_timer::register_save(save_manager &manager)
 	// determine our instance number - timers are indexed based on the callback function name
 	int index = 0;
 	std::string name = m_callback.name() ? m_callback.name() : "unnamed";
-	for (const emu_timer *curtimer = m_scheduler->first_timer(); curtimer; curtimer = curtimer->m_next)
+	for (const emu_timer *curtimer : m_scheduler->m_timer_heap)
 	{
 		if (!curtimer->m_temporary)
 		{
@@ -283,21 +289,23 @@ device_scheduler::device_scheduler(running_machine &machine) :
 	m_executing_device(nullptr),
 	m_execute_list(nullptr),
 	m_basetime(attotime::zero),
-	m_timer_list(nullptr),
+	m_timer_sequence(0),
 	m_inactive_timers(nullptr),
 	m_callback_timer(nullptr),
 	m_callback_timer_modified(false),
 	m_callback_timer_expire_time(attotime::zero),
 	m_suspend_changes_pending(true),
+	m_timeslices(0),
+	m_timers_fired(0),
+	m_host_timing(false),
 	m_quantum_minimum(ATTOSECONDS_IN_NSEC(1) / 1000)
 {
-	// append a single never-expiring timer so there is always one in the list
+	// add a single never-expiring timer so there is always one in the heap
 	// need to subvert it because it would naturally be inserted in the inactive list
-	m_timer_list = &timer_list_remove(m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), attotime::never, 0, true));
+	emu_timer &never = timer_list_remove(m_timer_allocator.alloc()->init(machine, timer_expired_delegate(), attotime::never, 0, true));
+	never.m_heapindex = 0;
+	m_timer_heap.push_back(&never);
 
-	assert(m_timer_list);
-	assert(!m_timer_list->m_prev);
-	assert(!m_timer_list->m_next);
 	assert(!m_inactive_timers);
 
 	// register global states
@@ -316,8 +324,8 @@ device_scheduler::~device_scheduler()
 	// remove all timers
 	while (m_inactive_timers)
 		m_timer_allocator.reclaim(timer_list_remove(*m_inactive_timers));
-	while (m_timer_list)
-		m_timer_allocator.reclaim(timer_list_remove(*m_timer_list));
+	while (!m_timer_heap.empty())
+		m_timer_allocator.reclaim(timer_list_remove(*m_timer_heap.back()));
 }
 
 
@@ -345,7 +353,7 @@ attotime device_scheduler::time() const noexcept
 bool device_scheduler::can_save() const
 {
 	// if any live temporary timers exit, fail
-	for (emu_timer *timer = m_timer_list; timer; timer = timer->m_next)
+	for (emu_timer *timer : m_timer_heap)
 	{
 		if (timer->m_temporary && !timer->expire().is_never())
 		{
@@ -402,14 +410,15 @@ void device_scheduler::timeslice()
 		m_quantum_allocator.reclaim(m_quantum_list.detach_head());
 
 	// loop until we hit the next timer
-	while (m_basetime < m_timer_list->m_expire)
+	while (m_basetime < m_timer_heap.front()->m_expire)
 	{
 		// by default, assume our target is the end of the next quantum
 		attotime target(m_basetime + attotime(0, m_quantum_list.first()->m_actual));
+		m_timeslices++;
 
 		// however, if the next timer is going to fire before then, override
-		if (m_timer_list->m_expire < target)
-			target = m_timer_list->m_expire;
+		if (m_timer_heap.front()->m_expire < target)
+			target = m_timer_heap.front()->m_expire;
 
 		LOG("------------------\n");
 		LOG("cpu_timeslice: target = %s\n", target.as_string(PRECISION));
@@ -450,8 +459,10 @@ void device_scheduler::timeslice()
 						// note that this global variable cycles_stolen can be modified
 						// via the call to cpu_execute
 						exec->m_cycles_stolen = 0;
+						exec->m_timeslices++;
 						m_executing_device = exec;
 						*exec->m_icountptr = exec->m_cycles_running;
+						osd_ticks_t const host_start = m_host_timing ? osd_ticks() : 0;
 						if (!call_debugger)
 							exec->run();
 						else
@@ -460,6 +471,8 @@ void device_scheduler::timeslice()
 							exec->run();
 							exec->debugger_stop_cpu_hook();
 						}
+						if (m_host_timing)
+							exec->m_host_ticks += osd_ticks() - host_start;
 
 						// adjust for any cycles we took back
 						assert(ran >= *exec->m_icountptr);
@@ -517,6 +530,18 @@ void device_scheduler::abort_timeslice() noexcept
 }
 
 
+//-------------------------------------------------
+//  abort_for_timer - abort execution because a
+//  timer has become the next to expire
+//-------------------------------------------------
+
+inline void device_scheduler::abort_for_timer() noexcept
+{
+	if (m_executing_device != nullptr)
+		m_executing_device->abort_timeslice(ABORT_REASON_TIMER);
+}
+
+
 //-------------------------------------------------
 //  trigger - generate a global trigger
 //-------------------------------------------------
@@ -694,9 +719,9 @@ void device_scheduler::postload()
 		timer_list_remove(timer).m_next = private_list;
 		private_list = &timer;
 	}
-	while (m_timer_list->m_next)
+	while (m_timer_heap.size() > 1)
 	{
-		emu_timer &timer = *m_timer_list;
+		emu_timer &timer = *m_timer_heap.front();
 
 		if (timer.m_temporary)
 		{
@@ -715,9 +740,9 @@ void device_scheduler::postload()
 	}
 
 	// special dummy timer
-	assert(!m_timer_list->m_enabled);
-	assert(m_timer_list->m_temporary);
-	assert(m_timer_list->m_expire.is_never());
+	assert(!m_timer_heap.front()->m_enabled);
+	assert(m_timer_heap.front()->m_temporary);
+	assert(m_timer_heap.front()->m_expire.is_never());
 
 	// now re-insert them; this effectively re-sorts them by time
 	while (private_list)
@@ -835,44 +860,84 @@ void device_scheduler::rebuild_execute_list()
 
 
 //-------------------------------------------------
-//  timer_list_insert - insert a new timer into
-//  the list at the appropriate location
+//  timer_heap_less - returns true if the first
+//  timer should fire before the second; timers
+//  with equal expiry fire in insertion order
 //-------------------------------------------------
 
-inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
+inline bool device_scheduler::timer_heap_less(const emu_timer &a, const emu_timer &b) noexcept
 {
-	// disabled timers never expire
-	if (!timer.m_expire.is_never() && timer.m_enabled)
+	if (a.expire() != b.expire())
+		return a.expire() < b.expire();
+	return a.m_sequence < b.m_sequence;
+}
+
+
+//-------------------------------------------------
+//  timer_heap_up - move a timer towards the top
+//  of the heap until its parent is earlier
+//-------------------------------------------------
+
+inline void device_scheduler::timer_heap_up(u32 index)
+{
+	emu_timer *const timer = m_timer_heap[index];
+	while (index > 0)
 	{
-		// loop over the timer list
-		emu_timer *prevtimer = nullptr;
-		for (emu_timer *curtimer = m_timer_list; curtimer; prevtimer = curtimer, curtimer = curtimer->m_next)
-		{
-			// if the current list entry expires after us, we should be inserted before it
-			if (curtimer->m_expire > timer.m_expire)
-			{
-				// link the new guy in before the current list entry
-				timer.m_prev = prevtimer;
-				timer.m_next = curtimer;
+		u32 const parent = (index - 1) >> 1;
+		if (!timer_heap_less(*timer, *m_timer_heap[parent]))
+			break;
+		m_timer_heap[index] = m_timer_heap[parent];
+		m_timer_heap[index]->m_heapindex = index;
+		index = parent;
+	}
+	m_timer_heap[index] = timer;
+	timer->m_heapindex = index;
+}
 
-				if (prevtimer)
-					prevtimer->m_next = &timer;
-				else
-					m_timer_list = &timer;
 
-				curtimer->m_prev = &timer;
-				return timer;
-			}
-		}
+//-------------------------------------------------
+//  timer_heap_down - move a timer towards the
+//  bottom of the heap until its children are
+//  later
+//-------------------------------------------------
 
-		// need to insert after the last one
-		if (prevtimer)
-			prevtimer->m_next = &timer;
-		else
-			m_timer_list = &timer;
+inline void device_scheduler::timer_heap_down(u32 index)
+{
+	u32 const count = m_timer_heap.size();
+	emu_timer *const timer = m_timer_heap[index];
+	while (true)
+	{
+		u32 child = (index << 1) + 1;
+		if (child >= count)
+			break;
+		if (((child + 1) < count) && timer_heap_less(*m_timer_heap[child + 1], *m_timer_heap[child]))
+			child++;
+		if (!timer_heap_less(*m_timer_heap[child], *timer))
+			break;
+		m_timer_heap[index] = m_timer_heap[child];
+		m_timer_heap[index]->m_heapindex = index;
+		index = child;
+	}
+	m_timer_heap[index] = timer;
+	timer->m_heapindex = index;
+}
+
+
+//-------------------------------------------------
+//  timer_list_insert - insert a new timer into
+//  the heap or the inactive list
+//-------------------------------------------------
 
-		timer.m_prev = prevtimer;
-		timer.m_next = nullptr;
+inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
+{
+	// disabled timers never expire
+	if (!timer.m_expire.is_never() && timer.m_enabled)
+	{
+		// add at the bottom of the heap and let it rise
+		timer.m_sequence = ++m_timer_sequence;
+		timer.m_heapindex = m_timer_heap.size();
+		m_timer_heap.push_back(&timer);
+		timer_heap_up(timer.m_heapindex);
 	}
 	else
 	{
@@ -891,19 +956,34 @@ inline emu_timer &device_scheduler::timer_list_insert(emu_timer &timer)
 
 //-------------------------------------------------
 //  timer_list_remove - remove a timer from the
-//  linked list
+//  heap or the inactive list
 //-------------------------------------------------
 
 inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 {
-	// remove it from the list
-	if (timer.m_prev)
+	if (timer.m_heapindex != TIMER_HEAP_NONE)
 	{
-		timer.m_prev->m_next = timer.m_next;
+		// replace it with the last entry and restore the heap order
+		u32 const index = timer.m_heapindex;
+		emu_timer *const last = m_timer_heap.back();
+		m_timer_heap.pop_back();
+		timer.m_heapindex = TIMER_HEAP_NONE;
+		if (last != &timer)
+		{
+			m_timer_heap[index] = last;
+			last->m_heapindex = index;
+			if ((index > 0) && timer_heap_less(*last, *m_timer_heap[(index - 1) >> 1]))
+				timer_heap_up(index);
+			else
+				timer_heap_down(index);
+		}
+		return timer;
 	}
-	else if (&timer == m_timer_list)
+
+	// remove it from the inactive list
+	if (timer.m_prev)
 	{
-		m_timer_list = timer.m_next;
+		timer.m_prev->m_next = timer.m_next;
 	}
 	else
 	{
@@ -924,13 +1004,13 @@ inline emu_timer &device_scheduler::timer_list_remove(emu_timer &timer)
 
 inline void device_scheduler::execute_timers()
 {
-	LOG("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), m_timer_list->m_expire.as_string(PRECISION));
+	LOG("execute_timers: new=%s head->expire=%s\n", m_basetime.as_string(PRECISION), m_timer_heap.front()->m_expire.as_string(PRECISION));
 
 	// now process any timers that are overdue
-	while (m_timer_list->m_expire <= m_basetime)
+	while (m_timer_heap.front()->m_expire <= m_basetime)
 	{
 		// if this is a one-shot timer, disable it now
-		emu_timer &timer = *m_timer_list;
+		emu_timer &timer = *m_timer_heap.front();
 		bool was_enabled = timer.m_enabled;
 		if (timer.m_period.is_zero() || timer.m_period.is_never())
 			timer.m_enabled = false;
@@ -944,6 +1024,7 @@ inline void device_scheduler::execute_timers()
 		if (was_enabled)
 		{
 			auto profile = g_profiler.start(PROFILER_TIMER_CALLBACK);
+			m_timers_fired++;
 
 			if (!timer.m_callback.isnull())
 			{
@@ -982,9 +1063,38 @@ void device_scheduler::dump_timers() const
 {
 	machine().logerror("=============================================\n");
 	machine().logerror("Timer Dump: Time = %15s\n", time().as_string(PRECISION));
-	for (emu_timer *timer = m_timer_list; timer; timer = timer->m_next)
+	for (emu_timer *timer : m_timer_heap)
 		timer->dump();
 	for (emu_timer *timer = m_inactive_timers; timer; timer = timer->m_next)
 		timer->dump();
 	machine().logerror("=============================================\n");
 }
+
+
+//-------------------------------------------------
+//  dump_stats - print scheduler statistics for
+//  each executing device
+//-------------------------------------------------
+
+void device_scheduler::dump_stats()
+{
+	double const ticks_per_second = double(osd_ticks_per_second());
+	osd_printf_info("Scheduler statistics: %u timeslices, %u timer callbacks\n", m_timeslices, m_timers_fired);
+	osd_printf_info("%-24s %12s %16s %10s %10s %10s %10s %10s %10s %10s\n", "device", "slices", "cycles", "cyc/slice", "explicit", "trigger", "suspend", "timer", "host ms", "MHz/host");
+	for (device_execute_interface &exec : execute_interface_enumerator(machine().root_device()))
+	{
+		u64 const slices = exec.timeslice_count();
+		double const host_seconds = double(exec.host_ticks()) / ticks_per_second;
+		osd_printf_info("%-24s %12u %16u %10u %10u %10u %10u %10u %10.1f %10.2f\n",
+				exec.device().tag(),
+				slices,
+				exec.total_cycles(),
+				slices ? (exec.total_cycles() / slices) : 0,
+				exec.abort_count(ABORT_REASON_EXPLICIT),
+				exec.abort_count(ABORT_REASON_TRIGGER),
+				exec.abort_count(ABORT_REASON_SUSPEND),
+				exec.abort_count(ABORT_REASON_TIMER),
+				host_seconds * 1000.0,
+				(host_seconds > 0.0) ? (double(exec.total_cycles()) / host_seconds / 1000000.0) : 0.0);
+	}
+}
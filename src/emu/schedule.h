@@ -76,8 +76,10 @@ private:
 
 	// internal state
 	device_scheduler *  m_scheduler;    // reference to the owning machine
-	emu_timer *         m_next;         // next timer in order in the list
-	emu_timer *         m_prev;         // previous timer in order in the list
+	emu_timer *         m_next;         // next timer in the inactive list
+	emu_timer *         m_prev;         // previous timer in the inactive list
+	u32                 m_heapindex;    // position in the active timer heap
+	u64                 m_sequence;     // insertion order, used to break ties
 	timer_expired_delegate m_callback;  // callback function
 	s32                 m_param;        // integer parameter
 	bool                m_enabled;      // is the timer enabled?
@@ -94,6 +96,13 @@ private:
 
 // ======================> device_scheduler
 
+// Executing devices are run one after another on the thread that calls
+// timeslice().  Running "decoupled" devices concurrently is not possible
+// without further work: the currently executing device is a single pointer,
+// emu_timer allocation and the timer list are unsynchronised, memory handlers
+// for latches and shared RAM are called directly from the executing device,
+// and abort_timeslice()/trigger() assume they are called from the device
+// being run.
 class device_scheduler
 {
 	friend class device_execute_interface;
@@ -107,9 +116,15 @@ public:
 	// getters
 	running_machine &machine() const noexcept { return m_machine; }
 	attotime time() const noexcept;
-	emu_timer *first_timer() const noexcept { return m_timer_list; }
+	emu_timer *first_timer() const noexcept { return m_timer_heap.front(); }
 	device_execute_interface *currently_executing() const noexcept { return m_executing_device; }
 	bool can_save() const;
+	u64 timeslice_count() const noexcept { return m_timeslices; }
+	u64 timer_fire_count() const noexcept { return m_timers_fired; }
+	bool host_timing() const noexcept { return m_host_timing; }
+
+	// setters
+	void set_host_timing(bool enable) noexcept { m_host_timing = enable; }
 
 	// execution
 	void timeslice();
@@ -127,6 +142,7 @@ public:
 
 	// debugging
 	void dump_timers() const;
+	void dump_stats();
 
 	// for emergencies only!
 	void eat_all_cycles();
@@ -134,6 +150,7 @@ public:
 private:
 	// callbacks
 	void timed_trigger(s32 param);
+	void abort_for_timer() noexcept;
 	void presave();
 	void postload();
 
@@ -145,6 +162,9 @@ private:
 	// timer helpers
 	emu_timer &timer_list_insert(emu_timer &timer);
 	emu_timer &timer_list_remove(emu_timer &timer);
+	static bool timer_heap_less(const emu_timer &a, const emu_timer &b) noexcept;
+	void timer_heap_up(u32 index);
+	void timer_heap_down(u32 index);
 	void execute_timers();
 
 	// internal state
@@ -153,8 +173,9 @@ private:
 	device_execute_interface *  m_execute_list;             // list of devices to be executed
 	attotime                    m_basetime;                 // global basetime; everything moves forward from here
 
-	// list of active timers
-	emu_timer *                 m_timer_list;               // head of the active list
+	// active timers are kept in a binary min-heap ordered by expiry time
+	std::vector<emu_timer *>    m_timer_heap;               // active timers, soonest first
+	u64                         m_timer_sequence;           // next insertion sequence number
 	emu_timer *                 m_inactive_timers;          // head of the inactive timer list
 	fixed_allocator<emu_timer>  m_timer_allocator;          // allocator for timers
 
@@ -164,6 +185,11 @@ private:
 	attotime                    m_callback_timer_expire_time; // the original expiration time
 	bool                        m_suspend_changes_pending;  // suspend/resume changes are pending
 
+	// statistics
+	u64                         m_timeslices;               // number of timeslices executed
+	u64                         m_timers_fired;             // number of timer callbacks called
+	bool                        m_host_timing;              // measure host time spent in each device
+
 	// scheduling quanta
 	class quantum_slot
 	{
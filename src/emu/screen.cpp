@@ -84,6 +84,10 @@ private:
 
 	std::vector<cached_bitmap> m_cache;
 
+	// the screen alternates between two bitmaps, so remember which state each one shows
+	u64 m_generation;
+	std::pair<void const *, u64> m_rendered[2];
+
 	void output_change(const char *outname, s32 value);
 	void render_state(std::vector<u32> &dest, const std::vector<bool> &state);
 	void compute_initial_bboxes(std::vector<bbox> &bboxes);
@@ -122,6 +126,9 @@ screen_device::svg_renderer::svg_renderer(memory_region *region)
 	m_sx = m_sy = 0;
 	m_scale = 1.0;
 
+	m_generation = 1;
+	m_rendered[0] = m_rendered[1] = std::make_pair(nullptr, 0);
+
 	osd_printf_verbose("Parsed SVG '%s', aspect ratio %f\n", region->name(), (m_image->height == 0.0f) ? 0 : m_image->width / m_image->height);
 }
 
@@ -197,18 +204,24 @@ int screen_device::svg_renderer::render(screen_device &screen, bitmap_rgb32 &bit
 		m_scale = sx > sy ? sy : sx;
 		m_background.resize(m_sx * m_sy);
 		rebuild_cache();
+		m_generation++;
 	}
 
+	// nothing to do if this bitmap already shows the current segment state
+	void const *const base = bitmap.raw_pixptr(0, 0);
+	for(auto &r : m_rendered)
+		if(r.first == base && r.second == m_generation)
+			return 0;
+
 	for(unsigned int y = 0; y < m_sy; y++)
 		memcpy(bitmap.raw_pixptr(y, 0), &m_background[y * m_sx], m_sx * 4);
 
-	std::list<int> to_draw;
+	std::vector<int> to_draw;
 	for(int key = 0; key != m_key_count; key++)
 		if(m_key_state[key])
 			to_draw.push_back(key);
-	while(!to_draw.empty()) {
-		int key = to_draw.front();
-		to_draw.pop_front();
+	for(size_t i = 0; i != to_draw.size(); i++) {
+		int key = to_draw[i];
 		blit(bitmap, m_cache[key]);
 		for(auto p : m_cache[key].pairs) {
 			if(m_key_state[p.key])
@@ -216,6 +229,10 @@ int screen_device::svg_renderer::render(screen_device &screen, bitmap_rgb32 &bit
 		}
 	}
 
+	// replace the older of the two remembered bitmaps
+	auto &slot = (m_rendered[0].first == base || (m_rendered[1].first != base && m_rendered[0].second < m_rendered[1].second)) ? m_rendered[0] : m_rendered[1];
+	slot = std::make_pair(base, m_generation);
+
 	return 0;
 }
 
@@ -229,7 +246,10 @@ void screen_device::svg_renderer::output_change(const char *outname, s32 value)
 	auto l = m_key_ids.find(outname);
 	if (l == m_key_ids.end())
 		return;
-	m_key_state[l->second] = value;
+	if (m_key_state[l->second] != bool(value)) {
+		m_key_state[l->second] = value;
+		m_generation++;
+	}
 }
 
 void screen_device::svg_renderer::compute_initial_bboxes(std::vector<bbox> &bboxes)
@@ -541,6 +561,7 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_yscale(1.0f)
 	, m_screen_update_ind16(*this)
 	, m_screen_update_rgb32(*this)
+	, m_screen_latch(*this)
 	, m_screen_vblank(*this)
 	, m_scanline_cb(*this)
 	, m_palette(*this, finder_base::DUMMY_TAG)
@@ -552,8 +573,10 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_height(100)
 	, m_visarea(0, 99, 0, 99)
 	, m_texformat()
+	, m_buffers(2)
 	, m_curbitmap(0)
 	, m_curtexture(0)
+	, m_handovers(0)
 	, m_changed(true)
 	, m_last_partial_scan(0)
 	, m_partial_scan_hpos(0)
@@ -571,6 +594,8 @@ screen_device::screen_device(const machine_config &mconfig, const char *tag, dev
 	, m_scanline_timer(nullptr)
 	, m_frame_number(0)
 	, m_partial_updates_this_frame(0)
+	, m_deferred_queue(nullptr)
+	, m_deferred_queued(false)
 {
 	m_unique_id = m_id_counter;
 	m_id_counter++;
@@ -598,7 +623,7 @@ void screen_device::destroy_scan_bitmaps()
 	if (m_video_attributes & VIDEO_VARIABLE_WIDTH)
 	{
 		const bool screen16 = !m_screen_update_ind16.isnull();
-		for (int j = 0; j < 2; j++)
+		for (int j = 0; j < m_buffers; j++)
 		{
 			for (bitmap_t* bitmap : m_scan_bitmaps[j])
 			{
@@ -630,7 +655,7 @@ void screen_device::allocate_scan_bitmaps()
 		{
 			for (int i = old_height; i < effheight; i++)
 			{
-				for (int j = 0; j < 2; j++)
+				for (int j = 0; j < m_buffers; j++)
 				{
 					if (screen16)
 						m_scan_bitmaps[j].push_back(new bitmap_ind16(effwidth, 1));
@@ -644,7 +669,7 @@ void screen_device::allocate_scan_bitmaps()
 		{
 			for (int i = old_height - 1; i >= effheight; i--)
 			{
-				for (int j = 0; j < 2; j++)
+				for (int j = 0; j < m_buffers; j++)
 				{
 					if (screen16)
 						delete (bitmap_ind16 *)m_scan_bitmaps[j][i];
@@ -772,6 +797,7 @@ void screen_device::device_resolve_objects()
 	// bind our handlers
 	m_screen_update_ind16.resolve();
 	m_screen_update_rgb32.resolve();
+	m_screen_latch.resolve();
 
 	// assign our format to the palette before it starts
 	if (m_palette)
@@ -812,18 +838,24 @@ void screen_device::device_start()
 	const bool screen16 = !m_screen_update_ind16.isnull();
 	texture_format texformat = screen16 ? TEXFORMAT_PALETTE16 : TEXFORMAT_RGB32;
 
-	for (auto & elem : m_bitmap)
+	// the OSD may reference a bitmap's memory for a while after it's been handed over
+	m_buffers = std::clamp(machine().render().screen_buffers(), 2, MAX_BITMAP_BUFFERS);
+	for (int i = 0; i < m_buffers; i++)
 	{
-		elem.set_format(format(), texformat);
-		register_screen_bitmap(elem);
+		m_bitmap[i].set_format(format(), texformat);
+		register_screen_bitmap(m_bitmap[i]);
 	}
 	register_screen_bitmap(m_priority);
 
-	// allocate raw textures
-	m_texture[0] = machine().render().texture_alloc();
-	m_texture[0]->set_id(u64(m_unique_id) << 57);
-	m_texture[1] = machine().render().texture_alloc();
-	m_texture[1]->set_id((u64(m_unique_id) << 57) | 1);
+	// allocate raw textures, reporting redrawn rows so the OSD can upload just those;
+	// composited variable-width bitmaps are rebuilt whole
+	const bool track_dirty = m_type != SCREEN_TYPE_VECTOR && !(m_video_attributes & (VIDEO_VARIABLE_WIDTH | VIDEO_SELF_RENDER));
+	for (int i = 0; i < m_buffers; i++)
+	{
+		m_texture[i] = machine().render().texture_alloc();
+		m_texture[i]->set_id((u64(m_unique_id) << 57) | i);
+		m_texture[i]->set_dirty_tracking(track_dirty);
+	}
 
 	// configure the default cliparea
 	render_container::user_settings settings = m_container->get_user_settings();
@@ -844,6 +876,14 @@ void screen_device::device_start()
 	if ((m_video_attributes & VIDEO_UPDATE_SCANLINE) != 0 || !m_scanline_cb.isunset())
 		m_scanline_timer = timer_alloc(FUNC(screen_device::scanline_tick), this);
 
+	// deferred updates need a whole bitmap to draw into
+	if (!m_screen_latch.isnull())
+	{
+		if (m_type == SCREEN_TYPE_SVG || (m_video_attributes & VIDEO_VARIABLE_WIDTH))
+			fatalerror("%s: deferred updates are not supported for SVG or variable width screens\n", tag());
+		m_deferred_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	}
+
 	// configure the screen with the default parameters
 	configure(m_width, m_height, m_visarea, m_refresh);
 
@@ -911,8 +951,12 @@ void screen_device::device_reset()
 
 void screen_device::device_stop()
 {
-	machine().render().texture_free(m_texture[0]);
-	machine().render().texture_free(m_texture[1]);
+	flush_deferred_updates();
+	if (m_deferred_queue)
+		osd_work_queue_free(m_deferred_queue);
+
+	for (int i = 0; i < m_buffers; i++)
+		machine().render().texture_free(m_texture[i]);
 	if (m_burnin.valid())
 		finalize_burnin();
 }
@@ -1088,23 +1132,46 @@ void screen_device::realloc_screen_bitmaps()
 	if (m_type == SCREEN_TYPE_VECTOR)
 		return;
 
+	// finish drawing into the old bitmaps first
+	flush_deferred_updates();
+
 	// determine effective size to allocate
 	const bool per_scanline = (m_video_attributes & VIDEO_VARIABLE_WIDTH);
 	s32 effwidth = std::max(per_scanline ? m_max_width : m_width, m_visarea.right() + 1);
 	s32 effheight = std::max(m_height, m_visarea.bottom() + 1);
 
+	// with three or more buffers the renderer may read the bitmaps in place
+	// (see bitmap_buffers()), so memory that growing would free is kept
+	// until the renderer is done with it
+	if (m_buffers >= 3)
+	{
+		for (int i = 0; i < m_buffers; i++)
+		{
+			screen_bitmap &bitmap = m_bitmap[i];
+			if (!bitmap.valid() || ((effwidth <= bitmap.width()) && (effheight <= bitmap.height())))
+				continue;
+
+			retired_bitmap &retired = m_retired_bitmaps.emplace_back();
+			retired.m_handover = m_handovers;
+			if (bitmap.format() == BITMAP_FORMAT_IND16)
+				retired.m_ind16 = std::move(bitmap.as_ind16());
+			else
+				retired.m_rgb32 = std::move(bitmap.as_rgb32());
+		}
+	}
+
 	// resize all registered screen bitmaps
 	for (auto &item : m_auto_bitmap_list)
 		item->m_bitmap.resize(effwidth, effheight);
 
 	// re-set up textures
-	if (m_palette)
+	for (int i = 0; i < m_buffers; i++)
 	{
-		m_bitmap[0].set_palette(m_palette->palette());
-		m_bitmap[1].set_palette(m_palette->palette());
+		if (m_palette)
+			m_bitmap[i].set_palette(m_palette->palette());
+		m_texture[i]->set_bitmap(m_bitmap[i], m_visarea, m_bitmap[i].texformat());
+		m_texture[i]->mark_dirty();
 	}
-	m_texture[0]->set_bitmap(m_bitmap[0], m_visarea, m_bitmap[0].texformat());
-	m_texture[1]->set_bitmap(m_bitmap[1], m_visarea, m_bitmap[1].texformat());
 
 	allocate_scan_bitmaps();
 }
@@ -1208,13 +1275,7 @@ bool screen_device::update_partial(int scanline)
 		{
 			if (m_type != SCREEN_TYPE_SVG)
 			{
-				screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
-				switch (curbitmap.format())
-				{
-					default:
-					case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
-					case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
-				}
+				flags = update_bitmap(clip);
 			}
 			else
 			{
@@ -1227,6 +1288,8 @@ bool screen_device::update_partial(int scanline)
 
 	// if we modified the bitmap, we have to commit
 	m_changed |= ~flags & UPDATE_HAS_NOT_CHANGED;
+	if (!(flags & UPDATE_HAS_NOT_CHANGED))
+		m_texture[m_curbitmap]->mark_dirty(clip);
 
 	// remember where we left off
 	m_last_partial_scan = scanline + 1;
@@ -1311,18 +1374,15 @@ void screen_device::update_now()
 				}
 				else
 				{
-					switch (curbitmap.format())
-					{
-						default:
-						case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
-						case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
-					}
+					flags = update_bitmap(clip);
 				}
 
 				m_partial_updates_this_frame++;
 
 				// if we modified the bitmap, we have to commit
 				m_changed |= ~flags & UPDATE_HAS_NOT_CHANGED;
+				if (!(flags & UPDATE_HAS_NOT_CHANGED))
+					m_texture[m_curbitmap]->mark_dirty(clip);
 			}
 
 			m_partial_scan_hpos = 0;
@@ -1365,18 +1425,15 @@ void screen_device::update_now()
 			}
 			else
 			{
-				switch (curbitmap.format())
-				{
-					default:
-					case BITMAP_FORMAT_IND16:   flags = m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);   break;
-					case BITMAP_FORMAT_RGB32:   flags = m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);   break;
-				}
+				flags = update_bitmap(clip);
 			}
 
 			m_partial_updates_this_frame++;
 
 			// if we modified the bitmap, we have to commit
 			m_changed |= ~flags & UPDATE_HAS_NOT_CHANGED;
+			if (!(flags & UPDATE_HAS_NOT_CHANGED))
+				m_texture[m_curbitmap]->mark_dirty(clip);
 		}
 	}
 
@@ -1400,6 +1457,106 @@ void screen_device::reset_partial_updates()
 }
 
 
+//-------------------------------------------------
+//  update_bitmap - draw a region of the current
+//  screen bitmap, or latch it to be drawn later
+//  if deferred updates are enabled
+//-------------------------------------------------
+
+u32 screen_device::update_bitmap(const rectangle &clip)
+{
+	if (m_deferred_queue)
+	{
+		// bands already handed to the work queue must not move
+		if (m_deferred_queued)
+			flush_deferred_updates();
+
+		// let the driver snapshot its state, and split the range into bands
+		m_screen_latch(*this, clip);
+		rectangle band(clip);
+		for (int y = clip.top(); y <= clip.bottom(); y += DEFERRED_BAND_LINES)
+		{
+			band.sety(y, (std::min)(clip.bottom(), y + DEFERRED_BAND_LINES - 1));
+			m_deferred_list.push_back(deferred_update{ this, band, 0 });
+		}
+
+		// the changed flag is collected when the bands are drawn
+		return UPDATE_HAS_NOT_CHANGED;
+	}
+
+	screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
+	switch (curbitmap.format())
+	{
+		default:
+		case BITMAP_FORMAT_IND16:   return m_screen_update_ind16(*this, curbitmap.as_ind16(), clip);
+		case BITMAP_FORMAT_RGB32:   return m_screen_update_rgb32(*this, curbitmap.as_rgb32(), clip);
+	}
+}
+
+
+//-------------------------------------------------
+//  deferred_update_callback - work item callback
+//  to draw a deferred band
+//-------------------------------------------------
+
+void *screen_device::deferred_update_callback(void *param, int threadid)
+{
+	deferred_update &update = *reinterpret_cast<deferred_update *>(param);
+	screen_device &screen = *update.m_screen;
+	screen_bitmap &curbitmap = screen.m_bitmap[screen.m_curbitmap];
+	switch (curbitmap.format())
+	{
+		default:
+		case BITMAP_FORMAT_IND16:   update.m_flags = screen.m_screen_update_ind16(screen, curbitmap.as_ind16(), update.m_clip);   break;
+		case BITMAP_FORMAT_RGB32:   update.m_flags = screen.m_screen_update_rgb32(screen, curbitmap.as_rgb32(), update.m_clip);   break;
+	}
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  queue_deferred_updates - start drawing all
+//  latched line ranges on the work queue without
+//  waiting for them
+//-------------------------------------------------
+
+void screen_device::queue_deferred_updates()
+{
+	if (m_deferred_list.empty() || m_deferred_queued)
+		return;
+
+	osd_work_item_queue_multiple(m_deferred_queue, deferred_update_callback, m_deferred_list.size(), &m_deferred_list[0], sizeof(m_deferred_list[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	m_deferred_queued = true;
+}
+
+
+//-------------------------------------------------
+//  flush_deferred_updates - draw all latched line
+//  ranges on the work queue and wait for them
+//-------------------------------------------------
+
+void screen_device::flush_deferred_updates()
+{
+	if (m_deferred_list.empty())
+		return;
+
+	auto profile = g_profiler.start(PROFILER_VIDEO);
+
+	queue_deferred_updates();
+	osd_work_queue_wait(m_deferred_queue, osd_ticks_per_second() * 10);
+	m_deferred_queued = false;
+
+	// if any band modified the bitmap, we have to commit
+	for (deferred_update const &update : m_deferred_list)
+	{
+		m_changed |= ~update.m_flags & UPDATE_HAS_NOT_CHANGED;
+		if (!(update.m_flags & UPDATE_HAS_NOT_CHANGED))
+			m_texture[m_curbitmap]->mark_dirty(update.m_clip);
+	}
+	m_deferred_list.clear();
+}
+
+
 //-------------------------------------------------
 //  pixel - returns the RGB value of the specified
 //  pixel location
@@ -1407,6 +1564,8 @@ void screen_device::reset_partial_updates()
 
 u32 screen_device::pixel(s32 x, s32 y)
 {
+	flush_deferred_updates();
+
 	screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
 	if (!curbitmap.valid())
 		return 0;
@@ -1454,6 +1613,8 @@ u32 screen_device::pixel(s32 x, s32 y)
 
 void screen_device::pixels(u32 *buffer)
 {
+	flush_deferred_updates();
+
 	screen_bitmap &curbitmap = m_bitmap[m_curbitmap];
 	if (!curbitmap.valid())
 		return;
@@ -1739,6 +1900,9 @@ void screen_device::create_composited_bitmap()
 
 bool screen_device::update_quads()
 {
+	// finish any deferred drawing before the bitmap is handed over
+	flush_deferred_updates();
+
 	// only update if live
 	if (machine().render().is_live(*this))
 	{
@@ -1754,7 +1918,12 @@ bool screen_device::update_quads()
 				}
 				m_texture[m_curbitmap]->set_bitmap(m_bitmap[m_curbitmap], m_visarea, m_bitmap[m_curbitmap].texformat());
 				m_curtexture = m_curbitmap;
-				m_curbitmap = 1 - m_curbitmap;
+				m_curbitmap = (m_curbitmap + 1) % m_buffers;
+
+				// replaced memory is released on the same schedule a bitmap is reused on
+				m_handovers++;
+				while (!m_retired_bitmaps.empty() && ((m_retired_bitmaps.front().m_handover + m_buffers - 1) <= m_handovers))
+					m_retired_bitmaps.erase(m_retired_bitmaps.begin());
 			}
 
 			// brightness adjusted render color
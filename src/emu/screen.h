@@ -17,6 +17,7 @@
 
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 
 //**************************************************************************
@@ -157,6 +158,7 @@ typedef delegate<void (screen_device &, bool)> vblank_state_delegate;
 
 typedef device_delegate<u32 (screen_device &, bitmap_ind16 &, const rectangle &)> screen_update_ind16_delegate;
 typedef device_delegate<u32 (screen_device &, bitmap_rgb32 &, const rectangle &)> screen_update_rgb32_delegate;
+typedef device_delegate<void (screen_device &, const rectangle &)> screen_latch_delegate;
 
 
 // ======================> screen_device
@@ -199,6 +201,7 @@ public:
 	float xscale() const { return m_xscale; }
 	float yscale() const { return m_yscale; }
 	bool has_screen_update() const { return !m_screen_update_ind16.isnull() || !m_screen_update_rgb32.isnull(); }
+	int bitmap_buffers() const { return m_buffers; }
 
 	// inline configuration helpers
 	void set_type(screen_type_enum type) { assert(!configured()); m_type = type; }
@@ -361,6 +364,21 @@ public:
 		m_screen_update_rgb32.set(std::forward<T>(target), std::forward<F>(callback), name);
 	}
 
+	// opt in to deferred updates: the latch callback is called in place of
+	// the screen update callback for each partial update, and should snapshot
+	// whatever per-scanline state the update uses; the screen update callback
+	// is then called for the accumulated line ranges on worker threads before
+	// the frame is displayed, so it must draw only from latched state and
+	// touch nothing outside the given cliprect; deferred screens are drawn
+	// concurrently with each other at the end of the frame, so their update
+	// callbacks must not share mutable state either; in particular, tilemap
+	// drawing (which realizes instances and updates dirty tiles), gfx_element
+	// decoding and palette changes are not safe from a deferred update, so
+	// tilemaps must be updated and gfx decoded in the latch callback, and the
+	// update may only use them through read-only access to their pixmaps
+	template <typename F> void set_screen_latch(F &&callback, const char *name) { m_screen_latch.set(std::forward<F>(callback), name); }
+	template <typename T, typename F> void set_screen_latch(T &&target, F &&callback, const char *name) { m_screen_latch.set(std::forward<T>(target), std::forward<F>(callback), name); }
+
 	auto screen_vblank() { return m_screen_vblank.bind(); }
 	auto scanline() { m_video_attributes |= VIDEO_UPDATE_SCANLINE; return m_scanline_cb.bind(); }
 	template <typename T> screen_device &set_palette(T &&tag) { m_palette.set_tag(std::forward<T>(tag)); return *this; }
@@ -408,6 +426,8 @@ public:
 	bool update_partial(int scanline);
 	void update_now();
 	void reset_partial_updates();
+	void queue_deferred_updates();
+	void flush_deferred_updates();
 
 	// additional helpers
 	void register_vblank_callback(vblank_state_delegate vblank_callback);
@@ -447,6 +467,8 @@ private:
 	void create_composited_bitmap();
 	void destroy_scan_bitmaps();
 	void allocate_scan_bitmaps();
+	u32 update_bitmap(const rectangle &clip);
+	static void *deferred_update_callback(void *param, int threadid);
 
 	// inline configuration data
 	screen_type_enum    m_type;                     // type of screen
@@ -459,6 +481,7 @@ private:
 	float               m_xscale, m_yscale;         // default X/Y scale factor
 	screen_update_ind16_delegate m_screen_update_ind16; // screen update callback (16-bit palette)
 	screen_update_rgb32_delegate m_screen_update_rgb32; // screen update callback (32-bit RGB)
+	screen_latch_delegate m_screen_latch;           // deferred update latch callback
 	devcb_write_line    m_screen_vblank;            // screen vblank line callback
 	devcb_write32       m_scanline_cb;              // screen scanline callback
 	optional_device<device_palette_interface> m_palette;      // our palette
@@ -477,13 +500,26 @@ private:
 
 	// textures and bitmaps
 	texture_format      m_texformat;                // texture format
-	render_texture *    m_texture[2];               // 2x textures for the screen bitmap
-	screen_bitmap       m_bitmap[2];                // 2x bitmaps for rendering
-	std::vector<bitmap_t *> m_scan_bitmaps[2];      // 2x bitmaps for each individual scanline
+	static constexpr int MAX_BITMAP_BUFFERS = 3;
+	render_texture *    m_texture[MAX_BITMAP_BUFFERS];  // textures for the screen bitmaps
+	screen_bitmap       m_bitmap[MAX_BITMAP_BUFFERS];   // bitmaps for rendering
+	std::vector<bitmap_t *> m_scan_bitmaps[MAX_BITMAP_BUFFERS]; // bitmaps for each individual scanline
 	bitmap_ind8         m_priority;                 // priority bitmap
 	bitmap_ind64        m_burnin;                   // burn-in bitmap
+	u8                  m_buffers;                  // number of bitmaps in rotation
 	u8                  m_curbitmap;                // current bitmap index
 	u8                  m_curtexture;               // current texture index
+	u64                 m_handovers;                // number of bitmaps handed to the renderer
+
+	// bitmap memory replaced while a renderer may still be reading it in place
+	struct retired_bitmap
+	{
+		u64             m_handover;                 // m_handovers when it was replaced
+		bitmap_ind16    m_ind16;
+		bitmap_rgb32    m_rgb32;
+	};
+	std::vector<retired_bitmap> m_retired_bitmaps;
+
 	bool                m_changed;                  // has this bitmap changed?
 	s32                 m_last_partial_scan;        // scanline of last partial update
 	s32                 m_partial_scan_hpos;        // horizontal pixel last rendered on this partial scanline
@@ -508,6 +544,18 @@ private:
 
 	bool                m_is_primary_screen;
 
+	// deferred updates
+	static constexpr int DEFERRED_BAND_LINES = 16;  // maximum height of each deferred work item
+	struct deferred_update
+	{
+		screen_device *             m_screen;
+		rectangle                   m_clip;
+		u32                         m_flags;
+	};
+	std::vector<deferred_update> m_deferred_list;   // line ranges waiting to be drawn
+	osd_work_queue *    m_deferred_queue;           // work queue for deferred updates
+	bool                m_deferred_queued;          // deferred list handed to the work queue
+
 	// VBLANK callbacks
 	class callback_item
 	{
@@ -183,6 +183,7 @@ void software_list_device::release()
 	m_description.clear();
 	m_errors.clear();
 	m_infolist.clear();
+	m_shortnames.clear();
 }
 
 
@@ -258,8 +259,13 @@ const software_info *software_list_device::find(std::string_view look_for)
 
 	const bool iswild = look_for.find_first_of("*?") != std::string::npos;
 
-	// find a match (will cause a parse if needed when calling get_info)
+	// exact names can use the index (will cause a parse if needed when calling get_info)
 	const auto &info_list = get_info();
+	if (!iswild)
+	{
+		auto const found = m_shortnames.find(strmakelower(look_for));
+		return (m_shortnames.end() != found) ? found->second : nullptr;
+	}
 	auto iter = std::find_if(
 			info_list.begin(),
 			info_list.end(),
@@ -298,6 +304,12 @@ void software_list_device::parse()
 		parse_software_list(file, m_filename, m_shortname, m_description, m_infolist, errs);
 		file.close();
 		m_errors = errs.str();
+
+		// index by short name for exact lookups, keeping the first of any duplicates
+		m_shortnames.clear();
+		m_shortnames.reserve(m_infolist.size());
+		for (const software_info &swinfo : m_infolist)
+			m_shortnames.emplace(strmakelower(swinfo.shortname()), &swinfo);
 	}
 	else if (std::errc::no_such_file_or_directory == filerr)
 	{
@@ -16,6 +16,9 @@
 
 #include "softlist.h"
 
+#include <string>
+#include <unordered_map>
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -154,6 +157,7 @@ private:
 	std::string                 m_description;
 	std::string                 m_errors;
 	std::list<software_info>    m_infolist;
+	std::unordered_map<std::string, const software_info *> m_shortnames; // lowercase short name to first entry
 };
 
 
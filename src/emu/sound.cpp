@@ -20,6 +20,16 @@
 
 #include "osdepend.h"
 
+#include <functional>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define MAME_SOUND_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define MAME_SOUND_NEON
+#include <arm_neon.h>
+#endif
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -53,7 +63,9 @@ stream_buffer::stream_buffer(u32 sample_rate) :
 	m_end_sample(0),
 	m_sample_rate(sample_rate),
 	m_sample_attos((sample_rate == 0) ? ATTOSECONDS_PER_SECOND : ((ATTOSECONDS_PER_SECOND + sample_rate - 1) / sample_rate)),
-	m_buffer(sample_rate)
+	m_buffer(sample_rate),
+	m_silent_start(attotime::never),
+	m_silence_hint(false)
 {
 }
 
@@ -71,6 +83,77 @@ stream_buffer::~stream_buffer()
 }
 
 
+//-------------------------------------------------
+//  copy_scaled - store count samples from src
+//  scaled by gain
+//-------------------------------------------------
+
+void stream_buffer::copy_scaled(sample_t *dest, sample_t const *src, sample_t gain, u32 count)
+{
+#if defined(MAME_SOUND_SSE2)
+	__m128 const scale = _mm_set1_ps(gain);
+	for ( ; count >= 4; count -= 4, src += 4, dest += 4)
+		_mm_storeu_ps(dest, _mm_mul_ps(_mm_loadu_ps(src), scale));
+#elif defined(MAME_SOUND_NEON)
+	float32x4_t const scale = vdupq_n_f32(gain);
+	for ( ; count >= 4; count -= 4, src += 4, dest += 4)
+		vst1q_f32(dest, vmulq_f32(vld1q_f32(src), scale));
+#endif
+	for ( ; count; count--)
+		*dest++ = *src++ * gain;
+}
+
+
+//-------------------------------------------------
+//  add_scaled - accumulate count samples from src
+//  scaled by gain
+//-------------------------------------------------
+
+void stream_buffer::add_scaled(sample_t *dest, sample_t const *src, sample_t gain, u32 count)
+{
+#if defined(MAME_SOUND_SSE2)
+	__m128 const scale = _mm_set1_ps(gain);
+	for ( ; count >= 4; count -= 4, src += 4, dest += 4)
+		_mm_storeu_ps(dest, _mm_add_ps(_mm_loadu_ps(dest), _mm_mul_ps(_mm_loadu_ps(src), scale)));
+#elif defined(MAME_SOUND_NEON)
+	float32x4_t const scale = vdupq_n_f32(gain);
+	for ( ; count >= 4; count -= 4, src += 4, dest += 4)
+		vst1q_f32(dest, vaddq_f32(vld1q_f32(dest), vmulq_f32(vld1q_f32(src), scale)));
+#endif
+	for ( ; count; count--)
+		*dest++ += *src++ * gain;
+}
+
+
+//-------------------------------------------------
+//  peak - return the largest absolute value of
+//  count samples
+//-------------------------------------------------
+
+stream_buffer::sample_t stream_buffer::peak(sample_t const *src, u32 count)
+{
+	sample_t result = 0;
+#if defined(MAME_SOUND_SSE2)
+	__m128 const mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+	__m128 curmax = _mm_setzero_ps();
+	for ( ; count >= 4; count -= 4, src += 4)
+		curmax = _mm_max_ps(curmax, _mm_and_ps(_mm_loadu_ps(src), mask));
+	curmax = _mm_max_ps(curmax, _mm_movehl_ps(curmax, curmax));
+	curmax = _mm_max_ss(curmax, _mm_shuffle_ps(curmax, curmax, 1));
+	result = _mm_cvtss_f32(curmax);
+#elif defined(MAME_SOUND_NEON)
+	float32x4_t curmax = vdupq_n_f32(0.0f);
+	for ( ; count >= 4; count -= 4, src += 4)
+		curmax = vmaxq_f32(curmax, vabsq_f32(vld1q_f32(src)));
+	float32x2_t const half = vmax_f32(vget_low_f32(curmax), vget_high_f32(curmax));
+	result = vget_lane_f32(vpmax_f32(half, half), 0);
+#endif
+	for ( ; count; count--, src++)
+		result = std::max(result, std::abs(*src));
+	return result;
+}
+
+
 //-------------------------------------------------
 //  set_sample_rate - set a new sample rate for
 //  this buffer
@@ -82,6 +165,9 @@ void stream_buffer::set_sample_rate(u32 rate, bool resample)
 	if (rate == m_sample_rate)
 		return;
 
+	// the resampled contents are no longer known to be silent
+	m_silent_start = attotime::never;
+
 	// force resampling off if coming to or from an invalid rate, or if we're at time 0 (startup)
 	sound_assert(rate >= SAMPLE_RATE_MINIMUM - 1);
 	if (rate < SAMPLE_RATE_MINIMUM || m_sample_rate < SAMPLE_RATE_MINIMUM || (m_end_second == 0 && m_end_sample == 0))
@@ -556,6 +642,7 @@ sound_stream::sound_stream(device_t &device, u32 inputs, u32 outputs, u32 output
 	m_output_adaptive(sample_rate == SAMPLE_RATE_OUTPUT_ADAPTIVE),
 	m_synchronous((flags & STREAM_SYNCHRONOUS) != 0),
 	m_resampling_disabled((flags & STREAM_DISABLE_INPUT_RESAMPLING) != 0),
+	m_thread_safe((flags & STREAM_THREAD_SAFE) != 0),
 	m_sync_timer(nullptr),
 	m_last_update_end_time(attotime::zero),
 	m_input(inputs),
@@ -662,6 +749,7 @@ void sound_stream::set_input(int index, sound_stream *input_stream, int output_i
 	// wire it up
 	m_input[index].set_source((input_stream != nullptr) ? &input_stream->m_output[output_index] : nullptr);
 	m_input[index].set_gain(gain);
+	m_device.machine().sound().m_stream_groups_dirty = true;
 
 	// update sample rates now that we know the input
 	sample_rate_changed();
@@ -741,6 +829,10 @@ read_stream_view sound_stream::update_view(attotime start, attotime end, u32 out
 			// if we have an extended callback, that's all we need
 			m_callback_ex(*this, m_input_view, m_output_view);
 
+			// note which outputs the callback silenced
+			for (unsigned int outindex = 0; outindex < m_output.size(); outindex++)
+				m_output[outindex].update_silence(update_start);
+
 #if (SOUND_DEBUG)
 			// make sure everything was overwritten
 			for (unsigned int outindex = 0; outindex < m_output.size(); outindex++)
@@ -931,8 +1023,13 @@ read_stream_view sound_stream::empty_view(attotime start, attotime end)
 
 default_resampler_stream::default_resampler_stream(device_t &device) :
 	sound_stream(device, 1, 1, 0, SAMPLE_RATE_OUTPUT_ADAPTIVE, stream_update_delegate(&default_resampler_stream::resampler_sound_update, this), STREAM_DISABLE_INPUT_RESAMPLING),
-	m_max_latency(0)
+	m_max_latency(0),
+	m_quality(0)
 {
+	// map the quality level to the number of zero crossings on each side of the kernel
+	static u32 const s_crossings[] = { 0, 4, 8, 16 };
+	m_quality = s_crossings[std::clamp(device.machine().options().resampler_quality(), 0, 3)];
+
 	// create a name
 	m_name = "Default Resampler '";
 	m_name += device.tag();
@@ -964,6 +1061,27 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 	// optimize_resampler ensures we should not have equal sample rates
 	sound_assert(input.sample_rate() != output.sample_rate());
 
+	// silent input gives silent output, provided the silence reaches back past
+	// the earliest input sample either filter would look at
+	u32 const whole_step = input.sample_rate() / output.sample_rate();
+	u32 const reach = 2 * (m_max_latency + m_quality * (whole_step + 1) + whole_step + 2);
+	attotime const window = reach * input.sample_period();
+	attotime const start = output.start_time();
+	if (input.silent_since((start > window) ? (start - window) : attotime::zero))
+	{
+		output.silence();
+		return;
+	}
+
+	// use the polyphase filter unless the input is so oversampled the kernel would be huge
+	if (m_quality != 0 && input.sample_rate() <= output.sample_rate() * POLYPHASE_MAX_STEP)
+	{
+		if (!m_kernel.matches(input.sample_rate(), output.sample_rate(), m_quality))
+			m_kernel.configure(input.sample_rate(), output.sample_rate(), m_quality);
+		polyphase_update(input, output);
+		return;
+	}
+
 	// compute the stepping value and the inverse
 	stream_buffer::sample_t step = stream_buffer::sample_t(input.sample_rate()) / stream_buffer::sample_t(output.sample_rate());
 	stream_buffer::sample_t stepinv = 1.0 / step;
@@ -1056,6 +1174,60 @@ void default_resampler_stream::resampler_sound_update(sound_stream &stream, std:
 }
 
 
+//-------------------------------------------------
+//  polyphase_update - resample using the
+//  precomputed windowed-sinc kernel
+//-------------------------------------------------
+
+void default_resampler_stream::polyphase_update(read_stream_view const &input, write_stream_view &output)
+{
+	// the output lags the input by enough to cover the far half of the kernel,
+	// and the window starts that much again earlier to cover the near half
+	u32 const halftaps = m_kernel.halftaps();
+	s64 latency_samples = halftaps + 2;
+	if (latency_samples <= m_max_latency)
+		latency_samples = m_max_latency;
+	else
+		m_max_latency = latency_samples;
+	attotime latency = latency_samples * input.sample_period();
+	attotime lead = latency + latency;
+
+	// clamp the latency to the start (only relevant at the beginning)
+	s32 dstindex = 0;
+	attotime output_start = output.start_time();
+	auto numsamples = output.samples();
+	while (lead > output_start && dstindex < numsamples)
+	{
+		output.put(dstindex++, 0);
+		output_start += output.sample_period();
+	}
+	if (dstindex >= numsamples)
+		return;
+
+	// gather the input window into a contiguous buffer, padded so the last taps stay in bounds
+	read_stream_view rebased(input, output_start - lead);
+	u32 const count = rebased.samples();
+	m_history.resize(count + m_kernel.taps());
+	for (u32 srcindex = 0; srcindex < count; srcindex++)
+		m_history[srcindex] = rebased.get(srcindex);
+	std::fill(m_history.begin() + count, m_history.end(), 0);
+
+	// compute the fractional input position of the first output sample
+	attotime delta = output_start - latency - rebased.start_time();
+	sound_assert(delta.seconds() == 0);
+	double srcpos = double(delta.attoseconds()) / double(rebased.sample_period_attoseconds());
+	double const step = double(input.sample_rate()) / double(output.sample_rate());
+	sound_assert(srcpos >= halftaps - 1);
+
+	for ( ; dstindex < numsamples; dstindex++, srcpos += step)
+	{
+		u32 const srcindex = u32(srcpos);
+		sound_assert(srcindex + halftaps <= count);
+		output.put(dstindex, m_kernel.filter(&m_history[srcindex + 1 - halftaps], srcpos - double(srcindex)));
+	}
+}
+
+
 
 //**************************************************************************
 //  SOUND MANAGER
@@ -1083,7 +1255,13 @@ sound_manager::sound_manager(running_machine &machine) :
 	m_attenuation(0),
 	m_unique_id(0),
 	m_wavfile(),
-	m_first_reset(true)
+	m_speculative(false),
+	m_speculative_leftover(0),
+	m_speculative_scale(1.0),
+	m_speculative_counter(0),
+	m_first_reset(true),
+	m_stream_groups_dirty(true),
+	m_update_queue(nullptr)
 {
 	// count the mixers
 #if VERBOSE
@@ -1119,6 +1297,8 @@ sound_manager::sound_manager(running_machine &machine) :
 
 sound_manager::~sound_manager()
 {
+	if (m_update_queue)
+		osd_work_queue_free(m_update_queue);
 }
 
 
@@ -1136,6 +1316,7 @@ sound_stream *sound_manager::stream_alloc(device_t &device, u32 inputs, u32 outp
 			output_base += stream->output_count();
 
 	m_stream_list.push_back(std::make_unique<sound_stream>(device, inputs, outputs, output_base, sample_rate, callback, flags));
+	m_stream_groups_dirty = true;
 	return m_stream_list.back().get();
 }
 
@@ -1156,6 +1337,8 @@ bool sound_manager::start_recording()
 {
 	// open the output WAV file if specified
 	char const *const filename = machine().options().wav_write();
+	if (!*filename && machine().options().wav_only())
+		osd_printf_warning("-%s was given without -%s; no audio will be recorded\n", OPTION_WAVONLY, OPTION_WAVWRITE);
 	return *filename ? start_recording(filename) : false;
 }
 
@@ -1183,6 +1366,33 @@ void sound_manager::set_attenuation(float attenuation)
 }
 
 
+//-------------------------------------------------
+//  set_speculative - start or stop discarding
+//  the mixed output; the mixer state that isn't
+//  part of saved states is put back afterwards
+//-------------------------------------------------
+
+void sound_manager::set_speculative(bool speculative)
+{
+	if (speculative == m_speculative)
+		return;
+
+	m_speculative = speculative;
+	if (speculative)
+	{
+		m_speculative_leftover = m_finalmix_leftover;
+		m_speculative_scale = m_compressor_scale;
+		m_speculative_counter = m_compressor_counter;
+	}
+	else
+	{
+		m_finalmix_leftover = m_speculative_leftover;
+		m_compressor_scale = m_speculative_scale;
+		m_compressor_counter = m_speculative_counter;
+	}
+}
+
+
 //-------------------------------------------------
 //  indexed_mixer_input - return the mixer
 //  device and input index of the global mixer
@@ -1503,6 +1713,112 @@ stream_buffer::sample_t sound_manager::adjust_toward_compressor_scale(stream_buf
 }
 
 
+//-------------------------------------------------
+//  build_stream_groups - partition the thread-safe
+//  streams into groups that share no streams, so
+//  each group can be updated independently
+//-------------------------------------------------
+
+void sound_manager::build_stream_groups()
+{
+	m_stream_groups.clear();
+	m_stream_groups_dirty = false;
+
+	// a stream is eligible if it's thread-safe, not synchronous, and everything it pulls from is eligible
+	std::map<sound_stream *, bool> eligible;
+	std::function<bool (sound_stream &)> is_eligible = [&eligible, &is_eligible] (sound_stream &stream)
+	{
+		auto const found = eligible.find(&stream);
+		if (found != eligible.end())
+			return found->second;
+
+		// mark ineligible while recursing to cut any feedback loops
+		eligible[&stream] = false;
+		bool result = stream.thread_safe() && !stream.synchronous();
+		for (u32 inputnum = 0; result && (inputnum < stream.input_count()); inputnum++)
+		{
+			sound_stream_input &input = stream.input(inputnum);
+			if (input.valid() && !is_eligible(input.source().stream()))
+				result = false;
+		}
+		eligible[&stream] = result;
+		return result;
+	};
+
+	// union streams with their inputs and with other streams of the same device
+	std::map<sound_stream *, sound_stream *> parent;
+	auto const find = [&parent] (sound_stream *stream)
+	{
+		while (parent[stream] != stream)
+			stream = parent[stream] = parent[parent[stream]];
+		return stream;
+	};
+	std::map<device_t *, sound_stream *> device_stream;
+	for (auto &stream : m_stream_list)
+		if (is_eligible(*stream))
+			parent[stream.get()] = stream.get();
+	for (auto &stream : m_stream_list)
+	{
+		if (!eligible[stream.get()])
+			continue;
+		auto const sibling = device_stream.emplace(&stream->device(), stream.get());
+		if (!sibling.second)
+			parent[find(stream.get())] = find(sibling.first->second);
+		for (u32 inputnum = 0; inputnum < stream->input_count(); inputnum++)
+		{
+			sound_stream_input &input = stream->input(inputnum);
+			if (input.valid())
+				parent[find(stream.get())] = find(&input.source().stream());
+		}
+	}
+
+	// collect the groups in stream list order
+	std::map<sound_stream *, size_t> group_index;
+	for (auto &stream : m_stream_list)
+	{
+		if (!eligible[stream.get()])
+			continue;
+		auto const group = group_index.emplace(find(stream.get()), m_stream_groups.size());
+		if (group.second)
+			m_stream_groups.emplace_back();
+		m_stream_groups[group.first->second].push_back(stream.get());
+	}
+
+	LOG("stream groups = %d\n", int(m_stream_groups.size()));
+}
+
+
+//-------------------------------------------------
+//  update_stream_groups - bring the independent
+//  stream groups up to date on worker threads
+//-------------------------------------------------
+
+void sound_manager::update_stream_groups()
+{
+	if (m_stream_groups_dirty)
+		build_stream_groups();
+
+	// the profiler isn't thread-safe, and a single group gains nothing
+	if (m_stream_groups.size() < 2 || g_profiler.enabled())
+		return;
+
+	if (!m_update_queue)
+		m_update_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	if (!m_update_queue)
+		return;
+
+	osd_work_item_queue_multiple(m_update_queue, &sound_manager::update_stream_group, m_stream_groups.size(), &m_stream_groups[0], sizeof(m_stream_groups[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(m_update_queue, osd_ticks_per_second() * 10);
+}
+
+void *sound_manager::update_stream_group(void *param, int threadid)
+{
+	for (sound_stream *stream : *reinterpret_cast<std::vector<sound_stream *> *>(param))
+		stream->update();
+	return nullptr;
+}
+
+
 //-------------------------------------------------
 //  update - mix everything down to its final form
 //  and send it to the OSD layer
@@ -1529,26 +1845,17 @@ void sound_manager::update(s32 param)
 	std::fill_n(&m_leftmix[0], m_samples_this_update, 0);
 	std::fill_n(&m_rightmix[0], m_samples_this_update, 0);
 
+	// bring independent streams up to date in parallel before mixing
+	update_stream_groups();
+
 	// force all the speaker streams to generate the proper number of samples
 	for (speaker_device &speaker : m_speakers)
 		speaker.mix(&m_leftmix[0], &m_rightmix[0], m_last_update, endtime, m_samples_this_update, (m_muted & MUTE_REASON_SYSTEM));
 
 	// determine the maximum in this section
-	stream_buffer::sample_t curmax = 0;
-	for (int sampindex = 0; sampindex < m_samples_this_update; sampindex++)
-	{
-		auto sample = m_leftmix[sampindex];
-		if (sample < 0)
-			sample = -sample;
-		if (sample > curmax)
-			curmax = sample;
-
-		sample = m_rightmix[sampindex];
-		if (sample < 0)
-			sample = -sample;
-		if (sample > curmax)
-			curmax = sample;
-	}
+	stream_buffer::sample_t curmax = std::max(
+			stream_buffer::peak(&m_leftmix[0], m_samples_this_update),
+			stream_buffer::peak(&m_rightmix[0], m_samples_this_update));
 
 	// pull in current compressor scale factor before modifying
 	stream_buffer::sample_t lscale = m_compressor_scale;
@@ -1625,7 +1932,7 @@ void sound_manager::update(s32 param)
 	m_finalmix_leftover = sample - m_samples_this_update * 1000;
 
 	// play the result
-	if (finalmix_offset > 0)
+	if ((finalmix_offset > 0) && !m_speculative)
 	{
 		if (!m_nosound_mode)
 			machine().osd().update_audio_stream(finalmix, finalmix_offset / 2);
@@ -1647,5 +1954,6 @@ void sound_manager::update(s32 param)
 	apply_sample_rate_changes();
 
 	// notify that new samples have been generated
-	emulator_info::sound_hook();
+	if (!m_speculative)
+		emulator_info::sound_hook();
 }
@@ -50,6 +50,11 @@
     By default, the inputs will have been resampled to match the output
     sample rate, unless otherwise specified.
 
+    A callback that knows its outputs are silent for the whole update (an
+    idle chip, say) can call silence() on the output views instead of
+    filling them. Consumers such as the resampler and the mixers check
+    silent() on their input views and skip the work for zero output.
+
 ***************************************************************************/
 
 #pragma once
@@ -61,6 +66,7 @@
 #ifndef MAME_EMU_SOUND_H
 #define MAME_EMU_SOUND_H
 
+#include "resampler.h"
 #include "wavwrite.h"
 
 
@@ -117,6 +123,11 @@ public:
 	// the one public bit is the sample type
 	using sample_t = float;
 
+	// bulk kernels over contiguous runs of samples, optimized with SIMD
+	static void copy_scaled(sample_t *dest, sample_t const *src, sample_t gain, u32 count);
+	static void add_scaled(sample_t *dest, sample_t const *src, sample_t gain, u32 count);
+	static sample_t peak(sample_t const *src, u32 count);
+
 private:
 	// constructor/destructor
 	stream_buffer(u32 sample_rate = 48000);
@@ -144,6 +155,18 @@ private:
 	{
 		m_end_second = time.seconds();
 		m_end_sample = u32(time.attoseconds() / m_sample_attos);
+		m_silent_start = attotime::never;
+	}
+
+	// at the end of an update starting at the given time, extend the run of
+	// known silent samples if the update was silenced or reset it otherwise
+	void update_silence(attotime start)
+	{
+		if (!m_silence_hint)
+			m_silent_start = attotime::never;
+		else if (m_silent_start == attotime::never)
+			m_silent_start = start;
+		m_silence_hint = false;
 	}
 
 	// return the effective buffer size; currently it is a full second of audio
@@ -205,6 +228,8 @@ private:
 	u32 m_sample_rate;                    // sample rate of the data in the buffer
 	attoseconds_t m_sample_attos;         // pre-computed attoseconds per sample
 	std::vector<sample_t> m_buffer;       // vector of actual buffer data
+	attotime m_silent_start;              // start of the trailing run of silent samples, or never
+	bool m_silence_hint;                  // set when the current update was silenced
 
 #if (SOUND_DEBUG)
 public:
@@ -301,6 +326,11 @@ public:
 	attotime start_time() const { return m_buffer->index_time(m_start); }
 	attotime end_time() const { return m_buffer->index_time(m_end); }
 
+	// return true if all samples from the given time through the end of the
+	// view are known to be zero
+	bool silent_since(attotime time) const { return m_buffer != nullptr && m_buffer->m_silent_start <= time; }
+	bool silent() const { return silent_since(start_time()); }
+
 	// set the gain
 	read_stream_view &set_gain(float gain) { m_gain = gain; return *this; }
 
@@ -328,6 +358,52 @@ public:
 		return m_buffer->get(index);
 	}
 
+	// return a pointer to the raw samples starting at the given index, and
+	// reduce count to the number that are contiguous; a view is split in at
+	// most two runs, where it wraps around the end of the buffer
+	sample_t const *raw_segment(s32 index, s32 &count) const
+	{
+		sound_assert(u32(index) < samples());
+		index += m_start;
+		if (index >= m_buffer->size())
+			index -= m_buffer->size();
+		count = std::min<s32>(count, m_buffer->size() - index);
+		return &m_buffer->m_buffer[index];
+	}
+
+	// add gain-scaled samples to a plain array, with an additional gain factor
+	void add_to(sample_t *dest, s32 start, s32 count, sample_t gain = 1.0) const
+	{
+		if (start + count > samples())
+			count = samples() - start;
+		while (count > 0)
+		{
+			s32 run = count;
+			sample_t const *src = raw_segment(start, run);
+			stream_buffer::add_scaled(dest, src, m_gain * gain, run);
+			dest += run;
+			start += run;
+			count -= run;
+		}
+	}
+
+	// return the largest absolute value of the gain-scaled samples in a range
+	sample_t peak(s32 start, s32 count) const
+	{
+		if (start + count > samples())
+			count = samples() - start;
+		sample_t result = 0;
+		while (count > 0)
+		{
+			s32 run = count;
+			sample_t const *src = raw_segment(start, run);
+			result = std::max(result, stream_buffer::peak(src, run));
+			start += run;
+			count -= run;
+		}
+		return result * std::abs(m_gain);
+	}
+
 protected:
 	// normalize start/end
 	void normalize_start_end()
@@ -411,31 +487,71 @@ public:
 		add(index, sample_t(sample) * (1.0f / sample_t(max)));
 	}
 
+	// return a pointer to the samples starting at the given index, and reduce
+	// count to the number that are contiguous
+	sample_t *segment(s32 index, s32 &count)
+	{
+		sound_assert(u32(index) < samples());
+		u32 const bufindex = index_to_buffer_index(index);
+		count = std::min<s32>(count, m_buffer->size() - bufindex);
+		return &m_buffer->m_buffer[bufindex];
+	}
+
+	// call process(dest, src, count) for each contiguous run of our samples
+	// and the matching raw samples of another view; the source gain is not
+	// applied, so process must scale by src.gain() itself
+	template <typename T>
+	void process(read_stream_view const &src, T &&func)
+	{
+		s32 count = std::min(samples(), src.samples());
+		for (s32 start = 0; count > 0; )
+		{
+			s32 run = count;
+			sample_t *dest = segment(start, run);
+			sample_t const *source = src.raw_segment(start, run);
+			func(dest, source, run);
+			start += run;
+			count -= run;
+		}
+	}
+
 	// fill part of the view with the given value
 	void fill(sample_t value, s32 start, s32 count)
 	{
 		if (start + count > samples())
 			count = samples() - start;
-		u32 index = index_to_buffer_index(start);
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
+		while (count > 0)
 		{
-			m_buffer->put(index, value);
-			index = m_buffer->next_index(index);
+			s32 run = count;
+			std::fill_n(segment(start, run), run, value);
+			start += run;
+			count -= run;
 		}
 	}
 	void fill(sample_t value, s32 start) { fill(value, start, samples() - start); }
 	void fill(sample_t value) { fill(value, 0, samples()); }
 
+	// fill the whole view with zeros and tell consumers they may skip it;
+	// only valid from a stream callback, for the view it was given
+	void silence()
+	{
+		fill(0);
+		m_buffer->m_silence_hint = true;
+	}
+
 	// copy data from another view
 	void copy(read_stream_view const &src, s32 start, s32 count)
 	{
 		if (start + count > samples())
 			count = samples() - start;
-		u32 index = index_to_buffer_index(start);
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
+		while (count > 0)
 		{
-			m_buffer->put(index, src.get(start + sampindex));
-			index = m_buffer->next_index(index);
+			s32 run = count;
+			sample_t *dest = segment(start, run);
+			sample_t const *source = src.raw_segment(start, run);
+			stream_buffer::copy_scaled(dest, source, src.gain(), run);
+			start += run;
+			count -= run;
 		}
 	}
 	void copy(read_stream_view const &src, s32 start) { copy(src, start, samples() - start); }
@@ -446,11 +562,14 @@ public:
 	{
 		if (start + count > samples())
 			count = samples() - start;
-		u32 index = index_to_buffer_index(start);
-		for (s32 sampindex = 0; sampindex < count; sampindex++)
+		while (count > 0)
 		{
-			m_buffer->put(index, m_buffer->get(index) + src.get(start + sampindex));
-			index = m_buffer->next_index(index);
+			s32 run = count;
+			sample_t *dest = segment(start, run);
+			sample_t const *source = src.raw_segment(start, run);
+			stream_buffer::add_scaled(dest, source, src.gain(), run);
+			start += run;
+			count -= run;
 		}
 	}
 	void add(read_stream_view const &src, s32 start) { add(src, start, samples() - start); }
@@ -509,6 +628,9 @@ public:
 	// resync the buffer to the given end time
 	void set_end_time(attotime end) { m_buffer.set_end_time(end); }
 
+	// track silence at the end of an update starting at the given time
+	void update_silence(attotime start) { m_buffer.update_silence(start); }
+
 	// attempt to optimize resamplers by reusing them where possible
 	sound_stream_output &optimize_resampler(sound_stream_output *input_resampler);
 
@@ -596,7 +718,12 @@ enum sound_stream_flags : u32
 
 	// specify that input streams should not be resampled; stream update handler
 	// must be able to accommodate multiple strams of differing input rates
-	STREAM_DISABLE_INPUT_RESAMPLING = 0x02
+	STREAM_DISABLE_INPUT_RESAMPLING = 0x02,
+
+	// specify that the update handler only touches state owned by the device,
+	// so the stream may be updated on a worker thread alongside other devices'
+	// streams during the periodic sound update
+	STREAM_THREAD_SAFE = 0x04
 };
 
 
@@ -622,6 +749,7 @@ public:
 	bool output_adaptive() const { return m_output_adaptive; }
 	bool synchronous() const { return m_synchronous; }
 	bool resampling_disabled() const { return m_resampling_disabled; }
+	bool thread_safe() const { return m_thread_safe; }
 
 	// input and output getters
 	u32 input_count() const { return m_input.size(); }
@@ -694,6 +822,7 @@ private:
 	bool m_output_adaptive;                        // adaptive stream that runs at the sample rate of its output
 	bool m_synchronous;                            // synchronous stream that runs at the rate of its input
 	bool m_resampling_disabled;                    // is resampling of input streams disabled?
+	bool m_thread_safe;                            // can this stream be updated on a worker thread?
 	emu_timer *m_sync_timer;                       // update timer for synchronous streams
 
 	attotime m_last_update_end_time;               // last end_time() in update
@@ -726,8 +855,18 @@ public:
 	void resampler_sound_update(sound_stream &stream, std::vector<read_stream_view> const &inputs, std::vector<write_stream_view> &outputs);
 
 private:
+	// largest input/output ratio handled by the polyphase filter; beyond
+	// this the kernel gets too long and the inputs are box filtered instead
+	static constexpr u32 POLYPHASE_MAX_STEP = 4;
+
+	// windowed-sinc resampling of one update
+	void polyphase_update(read_stream_view const &input, write_stream_view &output);
+
 	// internal state
 	u32 m_max_latency;
+	u32 m_quality;                                 // zero crossings per side, or 0 for linear
+	resampler_polyphase m_kernel;                  // precomputed filter for the current rates
+	std::vector<stream_buffer::sample_t> m_history; // contiguous copy of the input window
 };
 
 
@@ -791,6 +930,9 @@ public:
 	void debugger_mute(bool turn_off) { mute(turn_off, MUTE_REASON_DEBUGGER); }
 	void system_mute(bool turn_off) { mute(turn_off, MUTE_REASON_SYSTEM); }
 
+	// suppress output while emulating frames that will be rolled back
+	void set_speculative(bool speculative);
+
 	// return information about the given mixer input, by index
 	bool indexed_mixer_input(int index, mixer_input &info) const;
 
@@ -824,6 +966,11 @@ private:
 	// periodic sound update, called STREAMS_UPDATE_FREQUENCY per second
 	void update(s32 param = 0);
 
+	// parallel update of independent stream subgraphs
+	void build_stream_groups();
+	void update_stream_groups();
+	static void *update_stream_group(void *param, int threadid);
+
 	// internal state
 	running_machine &m_machine;           // reference to the running machine
 	emu_timer *m_update_timer;            // timer that runs the update function
@@ -847,10 +994,21 @@ private:
 	int m_unique_id;                      // unique ID used for stream identification
 	util::wav_file_ptr m_wavfile;         // WAV file for streaming
 
+	// mixer state kept across speculative updates
+	bool m_speculative;                   // true if output is being discarded
+	u32 m_speculative_leftover;           // final mix leftover when speculation began
+	stream_buffer::sample_t m_speculative_scale; // compressor scale when speculation began
+	int m_speculative_counter;            // compressor counter when speculation began
+
 	// streams data
 	std::vector<std::unique_ptr<sound_stream>> m_stream_list; // list of streams
 	std::map<sound_stream *, u8> m_orphan_stream_list; // list of orphaned streams
 	bool m_first_reset;                   // is this our first reset?
+
+	// parallel update state
+	std::vector<std::vector<sound_stream *>> m_stream_groups; // independent groups of thread-safe streams
+	bool m_stream_groups_dirty;           // true if the stream graph changed since the groups were built
+	osd_work_queue *m_update_queue;       // allocated on first parallel update
 };
 
 
@@ -103,11 +103,14 @@ void speaker_device::mix(stream_buffer::sample_t *leftmix, stream_buffer::sample
 	// track maximum sample value for each 0.1s bucket
 	if (machine().options().speaker_report() != 0)
 	{
-		u32 samples_per_bucket = m_mixer_stream->sample_rate() / BUCKETS_PER_SECOND;
-		for (int sample = 0; sample < expected_samples; sample++)
+		u32 samples_per_bucket = std::max<u32>(m_mixer_stream->sample_rate() / BUCKETS_PER_SECOND, 1);
+		for (int sample = 0; sample < expected_samples; )
 		{
-			m_current_max = std::max(m_current_max, fabsf(view.get(sample)));
-			if (++m_samples_this_bucket >= samples_per_bucket)
+			int const count = std::min<int>(expected_samples - sample, samples_per_bucket - m_samples_this_bucket);
+			m_current_max = std::max(m_current_max, view.peak(sample, count));
+			sample += count;
+			m_samples_this_bucket += count;
+			if (m_samples_this_bucket >= samples_per_bucket)
 			{
 				m_max_sample.push_back(m_current_max);
 				m_current_max = 0.0f;
@@ -116,18 +119,16 @@ void speaker_device::mix(stream_buffer::sample_t *leftmix, stream_buffer::sample
 		}
 	}
 
-	// mix if sound is enabled
-	if (!suppress)
+	// mix if sound is enabled and there is something to mix
+	if (!suppress && !view.silent())
 	{
 		// if the speaker is hard panned to the left, send only to the left
 		if (m_pan == -1.0f)
-			for (int sample = 0; sample < expected_samples; sample++)
-				leftmix[sample] += view.get(sample);
+			view.add_to(leftmix, 0, expected_samples);
 
 		// if the speaker is hard panned to the right, send only to the right
 		else if (m_pan == 1.0f)
-			for (int sample = 0; sample < expected_samples; sample++)
-				rightmix[sample] += view.get(sample);
+			view.add_to(rightmix, 0, expected_samples);
 
 		// otherwise, send to both
 		else
@@ -135,12 +136,8 @@ void speaker_device::mix(stream_buffer::sample_t *leftmix, stream_buffer::sample
 			const float leftpan = (m_pan <= 0.0f) ? 1.0f : 1.0f - m_pan;
 			const float rightpan = (m_pan >= 0.0f) ? 1.0f : 1.0f + m_pan;
 
-			for (int sample = 0; sample < expected_samples; sample++)
-			{
-				stream_buffer::sample_t cursample = view.get(sample);
-				leftmix[sample] += cursample * leftpan;
-				rightmix[sample] += cursample * rightpan;
-			}
+			view.add_to(leftmix, 0, expected_samples, leftpan);
+			view.add_to(rightmix, 0, expected_samples, rightpan);
 		}
 	}
 }
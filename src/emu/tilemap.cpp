@@ -75,9 +75,10 @@ inline s32 tilemap_t::effective_colscroll(int index, u32 screen_height)
 
 
 //-------------------------------------------------
-//  gfx_tiles_changed - return true if any
-//  gfx_elements used by this tilemap have
-//  changed
+//  gfx_elements_changed - mark tiles dirty if the
+//  gfx_elements they were drawn from have
+//  changed; returns true if enough has changed
+//  that every tile should be redrawn
 //-------------------------------------------------
 
 inline bool tilemap_t::gfx_elements_changed()
@@ -85,16 +86,32 @@ inline bool tilemap_t::gfx_elements_changed()
 	u32 usedmask = m_gfx_used;
 	bool isdirty = false;
 
-	// iterate over all used gfx types and set the dirty flag if any of them have changed
+	// iterate over all used gfx types and find the ones that have changed
 	for (int gfxnum = 0; usedmask != 0; usedmask >>= 1, gfxnum++)
 		if ((usedmask & 1) != 0)
-			if (m_gfx_dirtyseq[gfxnum] != m_tileinfo.decoder->gfx(gfxnum)->dirtyseq())
-			{
-				m_gfx_dirtyseq[gfxnum] = m_tileinfo.decoder->gfx(gfxnum)->dirtyseq();
-				isdirty = true;
-			}
+		{
+			gfx_element &gfx = *m_tileinfo.decoder->gfx(gfxnum);
+			u32 const lastseq = m_gfx_dirtyseq[gfxnum];
+			if (lastseq == gfx.dirtyseq())
+				continue;
+			m_gfx_dirtyseq[gfxnum] = gfx.dirtyseq();
 
-	return isdirty;
+			// if more elements were dirtied than we have tiles, just redraw everything
+			if ((gfx.dirtyseq() - lastseq) >= m_tilegfx.size())
+				return true;
+
+			// otherwise only invalidate the tiles drawn from elements dirtied since the last check
+			for (logical_index logindex = 0; logindex < m_tilegfx.size(); logindex++)
+				if ((m_tilegfx[logindex] == gfxnum) && (s32(gfx.dirtyseq(m_tilecode[logindex]) - lastseq) > 0))
+				{
+					m_tileflags[logindex] = TILE_FLAG_DIRTY;
+					isdirty = true;
+				}
+		}
+
+	if (isdirty)
+		m_all_tiles_clean = false;
+	return false;
 }
 
 
@@ -701,6 +718,8 @@ void tilemap_t::mappings_create()
 	m_memory_to_logical.resize(max_memory_index);
 	m_logical_to_memory.resize(max_logical_index);
 	m_tileflags.resize(max_logical_index);
+	m_tilegfx.resize(max_logical_index, 0xff);
+	m_tilecode.resize(max_logical_index, 0);
 
 	// update the mappings
 	mappings_update();
@@ -764,7 +783,7 @@ inline void tilemap_t::realize_all_dirty_tiles()
 
 void tilemap_t::pixmap_update()
 {
-	// if the graphics changed, we need to mark everything dirty
+	// if enough of the graphics changed, we need to mark everything dirty
 	if (gfx_elements_changed())
 		mark_all_dirty();
 
@@ -814,6 +833,10 @@ void tilemap_t::tile_update(logical_index logindex, u32 col, u32 row)
 	if ((flags & (TILE_FORCE_LAYER0 | TILE_FORCE_LAYER1 | TILE_FORCE_LAYER2)) == 0 && m_tileinfo.mask_data != nullptr)
 		m_tileflags[logindex] = tile_apply_bitmask(m_tileinfo.mask_data, x0, y0, m_tileinfo.category, flags);
 
+	// remember the element each tile came from so it can be invalidated individually
+	m_tilegfx[logindex] = m_tileinfo.gfxnum;
+	m_tilecode[logindex] = m_tileinfo.code;
+
 	// track which gfx have been used for this tilemap
 	if (m_tileinfo.gfxnum != 0xff && (m_gfx_used & (1 << m_tileinfo.gfxnum)) == 0)
 	{
@@ -981,57 +1004,36 @@ void tilemap_t::configure_blit_parameters(blit_parameters &blit, bitmap_ind8 &pr
 
 
 //-------------------------------------------------
-//  draw_common - draw a tilemap to the
-//  destination with clipping; pixels apply
-//  priority/priority_mask to the priority bitmap
+//  for_each_instance - call the given action for
+//  each instance of the tilemap needed to cover
+//  the clipping rectangle, passing the clipping
+//  rectangle for the rows or columns it covers
 //-------------------------------------------------
 
-template<class _BitmapClass>
-void tilemap_t::draw_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask)
+template <typename T>
+void tilemap_t::for_each_instance(const rectangle &cliprect, u32 xextent, u32 yextent, T &&action)
 {
-	// skip if disabled
-	if (!m_enable)
-		return;
-
-	auto profile = g_profiler.start(PROFILER_TILEMAP_DRAW);
-
-	// configure the blit parameters based on the input parameters
-	blit_parameters blit;
-	configure_blit_parameters(blit, screen.priority(), cliprect, flags, priority, priority_mask);
-	assert(dest.cliprect().contains(cliprect));
-	assert(screen.cliprect().contains(cliprect) || blit.tilemap_priority_code == 0xff00);
-
-	// flush the dirty state to all tiles as appropriate
-	realize_all_dirty_tiles();
-
-	// flip the tilemap around the center of the visible area
-	rectangle const visarea = screen.visible_area();
-	u32 const xextent = visarea.right() + visarea.left() + 1; // x0 + x1 + 1 for calculating horizontal centre as (x0 + x1 + 1) >> 1
-	u32 const yextent = visarea.bottom() + visarea.top() + 1; // y0 + y1 + 1 for calculating vertical centre as (y0 + y1 + 1) >> 1
-
 	// XY scrolling playfield
 	if (m_scrollrows == 1 && m_scrollcols == 1)
 	{
 		// iterate to handle wraparound
 		int scrollx = effective_rowscroll(0, xextent);
 		int scrolly = effective_colscroll(0, yextent);
-		for (int ypos = scrolly - m_height; ypos <= blit.cliprect.bottom(); ypos += m_height)
-			for (int xpos = scrollx - m_width; xpos <= blit.cliprect.right(); xpos += m_width)
-				draw_instance(screen, dest, blit, xpos, ypos);
+		for (int ypos = scrolly - m_height; ypos <= cliprect.bottom(); ypos += m_height)
+			for (int xpos = scrollx - m_width; xpos <= cliprect.right(); xpos += m_width)
+				action(cliprect, xpos, ypos);
 	}
 
 	// scrolling rows + vertical scroll
 	else if (m_scrollcols == 1)
 	{
-		const rectangle original_cliprect = blit.cliprect;
-
 		// iterate over Y to handle wraparound
 		int rowheight = m_height / m_scrollrows;
 		int scrolly = effective_colscroll(0, yextent);
-		for (int ypos = scrolly - m_height; ypos <= original_cliprect.bottom(); ypos += m_height)
+		for (int ypos = scrolly - m_height; ypos <= cliprect.bottom(); ypos += m_height)
 		{
-			int const firstrow = std::max((original_cliprect.top() - ypos) / rowheight, 0);
-			int const lastrow = std::min((original_cliprect.bottom() - ypos) / rowheight, s32(m_scrollrows) - 1);
+			int const firstrow = std::max((cliprect.top() - ypos) / rowheight, 0);
+			int const lastrow = std::min((cliprect.bottom() - ypos) / rowheight, s32(m_scrollrows) - 1);
 
 			// iterate over rows in the tilemap
 			int nextrow;
@@ -1048,12 +1050,13 @@ void tilemap_t::draw_common(screen_device &screen, _BitmapClass &dest, const rec
 					continue;
 
 				// update the cliprect just for this set of rows
-				blit.cliprect.sety(currow * rowheight + ypos, nextrow * rowheight - 1 + ypos);
-				blit.cliprect &= original_cliprect;
+				rectangle rowclip = cliprect;
+				rowclip.sety(currow * rowheight + ypos, nextrow * rowheight - 1 + ypos);
+				rowclip &= cliprect;
 
 				// iterate over X to handle wraparound
-				for (int xpos = scrollx - m_width; xpos <= original_cliprect.right(); xpos += m_width)
-					draw_instance(screen, dest, blit, xpos, ypos);
+				for (int xpos = scrollx - m_width; xpos <= cliprect.right(); xpos += m_width)
+					action(rowclip, xpos, ypos);
 			}
 		}
 	}
@@ -1061,8 +1064,6 @@ void tilemap_t::draw_common(screen_device &screen, _BitmapClass &dest, const rec
 	// scrolling columns + horizontal scroll
 	else if (m_scrollrows == 1)
 	{
-		const rectangle original_cliprect = blit.cliprect;
-
 		// iterate over columns in the tilemap
 		int scrollx = effective_rowscroll(0, xextent);
 		int colwidth = m_width / m_scrollcols;
@@ -1080,20 +1081,142 @@ void tilemap_t::draw_common(screen_device &screen, _BitmapClass &dest, const rec
 				continue;
 
 			// iterate over X to handle wraparound
-			for (int xpos = scrollx - m_width; xpos <= original_cliprect.right(); xpos += m_width)
+			for (int xpos = scrollx - m_width; xpos <= cliprect.right(); xpos += m_width)
 			{
 				// update the cliprect just for this set of columns
-				blit.cliprect.setx(curcol * colwidth + xpos, nextcol * colwidth - 1 + xpos);
-				blit.cliprect &= original_cliprect;
+				rectangle colclip = cliprect;
+				colclip.setx(curcol * colwidth + xpos, nextcol * colwidth - 1 + xpos);
+				colclip &= cliprect;
 
 				// iterate over Y to handle wraparound
-				for (int ypos = scrolly - m_height; ypos <= original_cliprect.bottom(); ypos += m_height)
-					draw_instance(screen, dest, blit, xpos, ypos);
+				for (int ypos = scrolly - m_height; ypos <= cliprect.bottom(); ypos += m_height)
+					action(colclip, xpos, ypos);
 			}
 		}
 	}
 }
 
+
+//-------------------------------------------------
+//  realize_instance - bring the tiles covered by
+//  a single instance of the tilemap up to date,
+//  so it can be drawn without calling back into
+//  the driver
+//-------------------------------------------------
+
+void tilemap_t::realize_instance(const rectangle &cliprect, int xpos, int ypos)
+{
+	// clip to the tilemap exactly as draw_instance does
+	int const x1 = (std::max)(xpos, cliprect.left()) - xpos;
+	int const x2 = (std::min)(xpos + int(m_width), cliprect.right() + 1) - xpos;
+	int const y1 = (std::max)(ypos, cliprect.top()) - ypos;
+	int const y2 = (std::min)(ypos + int(m_height), cliprect.bottom() + 1) - ypos;
+	if (x1 >= x2 || y1 >= y2)
+		return;
+
+	for (u32 row = y1 / m_tileheight; row <= (y2 - 1) / m_tileheight; row++)
+		for (u32 column = x1 / m_tilewidth; column <= (x2 - 1) / m_tilewidth; column++)
+		{
+			logical_index const logindex = row * m_cols + column;
+			if (m_tileflags[logindex] == TILE_FLAG_DIRTY)
+				tile_update(logindex, column, row);
+		}
+}
+
+
+//-------------------------------------------------
+//  draw_band_work - render one horizontal band of
+//  a tilemap on a work queue thread
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void *tilemap_t::draw_band_work(void *param, int threadid)
+{
+	draw_band<_BitmapClass> &band = *reinterpret_cast<draw_band<_BitmapClass> *>(param);
+	blit_parameters blit = band.blit;
+	band.tilemap->for_each_instance(band.cliprect, band.xextent, band.yextent,
+			[&band, &blit] (rectangle const &cliprect, int xpos, int ypos)
+			{
+				blit.cliprect = cliprect;
+				band.tilemap->draw_instance(*band.screen, *band.dest, blit, xpos, ypos);
+			});
+	return nullptr;
+}
+
+
+//-------------------------------------------------
+//  draw_common - draw a tilemap to the
+//  destination with clipping; pixels apply
+//  priority/priority_mask to the priority bitmap
+//-------------------------------------------------
+
+template<class _BitmapClass>
+void tilemap_t::draw_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask)
+{
+	// skip if disabled
+	if (!m_enable)
+		return;
+
+	auto profile = g_profiler.start(PROFILER_TILEMAP_DRAW);
+
+	// configure the blit parameters based on the input parameters
+	blit_parameters blit;
+	configure_blit_parameters(blit, screen.priority(), cliprect, flags, priority, priority_mask);
+	assert(dest.cliprect().contains(cliprect));
+	assert(screen.cliprect().contains(cliprect) || blit.tilemap_priority_code == 0xff00);
+
+	// flush the dirty state to all tiles as appropriate
+	realize_all_dirty_tiles();
+
+	// flip the tilemap around the center of the visible area
+	rectangle const visarea = screen.visible_area();
+	u32 const xextent = visarea.right() + visarea.left() + 1; // x0 + x1 + 1 for calculating horizontal centre as (x0 + x1 + 1) >> 1
+	u32 const yextent = visarea.bottom() + visarea.top() + 1; // y0 + y1 + 1 for calculating vertical centre as (y0 + y1 + 1) >> 1
+
+	// large areas are split into horizontal bands and drawn in parallel; every
+	// pixel is still written by the same instances in the same order, so the
+	// result matches drawing serially
+	int const bands = std::min<int>(cliprect.height() / DRAW_BAND_MIN_ROWS, DRAW_BANDS_MAX);
+	osd_work_queue *const queue = (bands > 1 && (cliprect.width() * cliprect.height()) >= DRAW_PARALLEL_MIN_PIXELS) ? m_manager->draw_queue() : nullptr;
+	if (queue)
+	{
+		// tile updates call back into the driver, so they must happen here first
+		for_each_instance(cliprect, xextent, yextent,
+				[this] (rectangle const &clip, int xpos, int ypos) { realize_instance(clip, xpos, ypos); });
+
+		// divide the rows evenly between the bands
+		draw_band<_BitmapClass> band[DRAW_BANDS_MAX];
+		int top = cliprect.top();
+		for (int i = 0; i < bands; i++)
+		{
+			int const bottom = cliprect.top() + ((cliprect.height() * (i + 1)) / bands) - 1;
+			band[i].tilemap = this;
+			band[i].screen = &screen;
+			band[i].dest = &dest;
+			band[i].blit = blit;
+			band[i].cliprect.set(cliprect.left(), cliprect.right(), top, bottom);
+			band[i].xextent = xextent;
+			band[i].yextent = yextent;
+			top = bottom + 1;
+		}
+
+		// queue the bands and help out until they're all done
+		osd_work_item_queue_multiple(queue, draw_band_work<_BitmapClass>, bands, band, sizeof(band[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+		while (!osd_work_queue_wait(queue, osd_ticks_per_second()))
+		{
+		}
+	}
+	else
+	{
+		for_each_instance(cliprect, xextent, yextent,
+				[this, &screen, &dest, &blit] (rectangle const &clip, int xpos, int ypos)
+				{
+					blit.cliprect = clip;
+					draw_instance(screen, dest, blit, xpos, ypos);
+				});
+	}
+}
+
 void tilemap_t::draw(screen_device &screen, bitmap_ind16 &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask)
 { draw_common(screen, dest, cliprect, flags, priority, priority_mask); }
 
@@ -1585,7 +1708,8 @@ void tilemap_t::get_info_debug(u32 col, u32 row, u8 &gfxnum, u32 &code, u32 &col
 
 tilemap_manager::tilemap_manager(running_machine &machine)
 	: m_machine(machine),
-		m_instance(0)
+		m_instance(0),
+		m_draw_queue(nullptr)
 {
 }
 
@@ -1596,6 +1720,9 @@ tilemap_manager::tilemap_manager(running_machine &machine)
 
 tilemap_manager::~tilemap_manager()
 {
+	if (m_draw_queue)
+		osd_work_queue_free(m_draw_queue);
+
 	// detach all device tilemaps since they will be destroyed as subdevices elsewhere
 	bool found = true;
 	while (found)
@@ -1612,6 +1739,20 @@ tilemap_manager::~tilemap_manager()
 }
 
 
+//-------------------------------------------------
+//  draw_queue - get the work queue used for
+//  drawing tilemaps in parallel, allocating it
+//  on first use
+//-------------------------------------------------
+
+osd_work_queue *tilemap_manager::draw_queue()
+{
+	if (!m_draw_queue)
+		m_draw_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	return m_draw_queue;
+}
+
+
 //-------------------------------------------------
 //  create - allocate a tilemap
 //-------------------------------------------------
@@ -138,6 +138,10 @@
         data is modified, you need to mark the tile dirty so that it is
         re-rendered with the new data the next time the tilemap is drawn.
         Use tilemap_t::mark_tile_dirty() and pass in the memory index.
+        Tiles drawn from a gfx_element are re-rendered automatically when
+        gfx_element::mark_dirty() is called for the code they use. The
+        cached pixmap holds pen indices, so palette changes alone never
+        require tiles to be re-rendered.
 
     4. In your handlers for scrolling, update the scroll values for the
         tilemap via tilemap_t::set_scrollx() and tilemap_t::set_scrolly().
@@ -526,6 +530,24 @@ private:
 		u8                  alpha;
 	};
 
+	// a horizontal band of a tilemap drawn on a work queue thread
+	template<class _BitmapClass>
+	struct draw_band
+	{
+		tilemap_t *         tilemap;
+		screen_device *     screen;
+		_BitmapClass *      dest;
+		blit_parameters     blit;
+		rectangle           cliprect;
+		u32                 xextent;
+		u32                 yextent;
+	};
+
+	// limits for splitting draws into parallel bands
+	static constexpr int DRAW_BANDS_MAX = 8;
+	static constexpr int DRAW_BAND_MIN_ROWS = 16;
+	static constexpr int DRAW_PARALLEL_MIN_PIXELS = 256 * 64;
+
 	// inline helpers
 	s32 effective_rowscroll(int index, u32 screen_width);
 	s32 effective_colscroll(int index, u32 screen_height);
@@ -553,6 +575,9 @@ private:
 	u8 tile_draw(const u8 *pendata, u32 x0, u32 y0, u32 palette_base, u8 category, u8 group, u8 flags, u8 pen_mask);
 	u8 tile_apply_bitmask(const u8 *maskdata, u32 x0, u32 y0, u8 category, u8 flags);
 	void configure_blit_parameters(blit_parameters &blit, bitmap_ind8 &priority_bitmap, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
+	template <typename T> void for_each_instance(const rectangle &cliprect, u32 xextent, u32 yextent, T &&action);
+	void realize_instance(const rectangle &cliprect, int xpos, int ypos);
+	template<class _BitmapClass> static void *draw_band_work(void *param, int threadid);
 	template<class _BitmapClass> void draw_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_roz_common(screen_device &screen, _BitmapClass &dest, const rectangle &cliprect, u32 startx, u32 starty, int incxx, int incxy, int incyx, int incyy, bool wraparound, u32 flags, u8 priority, u8 priority_mask);
 	template<class _BitmapClass> void draw_instance(screen_device &screen, _BitmapClass &dest, const blit_parameters &blit, int xpos, int ypos);
@@ -607,6 +632,8 @@ private:
 	// transparency mapping
 	bitmap_ind8                 m_flagsmap;             // per-pixel flags
 	std::vector<u8>             m_tileflags;            // per-tile flags
+	std::vector<u8>             m_tilegfx;              // per-tile gfx element index, 0xff if untracked
+	std::vector<u32>            m_tilecode;             // per-tile code within the gfx element
 	u8                          m_pen_to_flags[MAX_PEN_TO_FLAGS * TILEMAP_NUM_GROUPS]; // mapping of pens to flags
 };
 
@@ -650,10 +677,14 @@ private:
 	// allocate an instance index
 	int alloc_instance() { return ++m_instance; }
 
+	// work queue for parallel drawing
+	osd_work_queue *draw_queue();
+
 	// internal state
 	running_machine &       m_machine;
 	simple_list<tilemap_t>  m_tilemap_list;
 	int                     m_instance;
+	osd_work_queue *        m_draw_queue;           // allocated on first parallel draw
 };
 
 
@@ -21,6 +21,7 @@
 #include "path.h"
 #include "unicode.h"
 
+#include <algorithm>
 #include <cctype>
 #include <type_traits>
 #include <typeinfo>
@@ -1742,6 +1743,40 @@ void validate_delegates_functoid()
 		osd_printf_error("Error testing delegate with functoid requiring adapter %p (expected %p)\n", addr, static_cast<void const *>(&cb1));
 }
 
+
+//-------------------------------------------------
+//  source_matches - true if the wildstring names
+//  a source file (e.g. galaxian.cpp or sega/*.cpp)
+//  and the given path ends in a matching file;
+//  the pattern is compared against as many
+//  trailing path components as it contains
+//-------------------------------------------------
+
+bool source_matches(const char *wildstring, const char *source)
+{
+	std::string_view const pattern(wildstring);
+	if ((pattern.length() < 4) || (pattern.substr(pattern.length() - 4) != ".cpp"))
+		return false;
+
+	std::string_view const path(source);
+	std::string_view::size_type begin = 0, limit = path.length();
+	for (auto components = std::count(pattern.begin(), pattern.end(), '/') + 1; components && limit; components--)
+	{
+		std::string_view::size_type const sep = path.find_last_of("/\\", limit - 1);
+		if (std::string_view::npos == sep)
+		{
+			begin = 0;
+			break;
+		}
+		begin = sep + 1;
+		limit = sep;
+	}
+
+	std::string tail(path.substr(begin));
+	std::replace(tail.begin(), tail.end(), '\\', '/');
+	return core_strwildcmp(wildstring, tail) == 0;
+}
+
 } // anonymous namespace
 
 
@@ -1887,7 +1922,10 @@ void validity_checker::check_shared_source(const game_driver &driver)
 
 //-------------------------------------------------
 //  check_all_matching - check all drivers whose
-//  names match the given string
+//  names match the given string, or that are
+//  defined in matching source files; passing a
+//  file name lets a build recheck only the
+//  drivers in sources it changed
 //-------------------------------------------------
 
 bool validity_checker::check_all_matching(const char *string)
@@ -1919,9 +1957,10 @@ bool validity_checker::check_all_matching(const char *string)
 	bool validated_any = false;
 	while (m_drivlist.next())
 	{
-		if (driver_list::matches(string, m_drivlist.driver().name))
+		game_driver const &driver(m_drivlist.driver());
+		if (driver_list::matches(string, driver.name) || (string && (driver.name[0] != '_') && source_matches(string, driver.type.source())))
 		{
-			validate_one(m_drivlist.driver());
+			validate_one(driver);
 			validated_any = true;
 		}
 	}
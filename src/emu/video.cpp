@@ -21,6 +21,7 @@
 #include "ui/uimain.h"
 
 #include "corestr.h"
+#include "hashing.h"
 #include "path.h"
 #include "png.h"
 #include "xmlfile.h"
@@ -29,6 +30,8 @@
 
 #include "rendersw.hxx"
 
+#include <algorithm>
+
 
 //**************************************************************************
 //  DEBUGGING
@@ -38,6 +41,51 @@
 
 
 
+//**************************************************************************
+//  SNAPSHOT WRITING
+//**************************************************************************
+
+namespace {
+
+// a snapshot waiting to be encoded and written by a worker
+struct snapshot_job
+{
+	std::unique_ptr<emu_file>   file;
+	bitmap_rgb32                bitmap;
+	std::vector<rgb_t>          palette;
+	util::png_info              pnginfo;
+};
+
+
+void *write_snapshot_job(void *param, int threadid)
+{
+	std::unique_ptr<snapshot_job> const job(reinterpret_cast<snapshot_job *>(param));
+	std::error_condition const error = util::png_write_bitmap(
+			*job->file,
+			&job->pnginfo,
+			job->bitmap,
+			job->palette.size(),
+			job->palette.empty() ? nullptr : &job->palette[0],
+			util::png_compression::FAST);
+	if (error)
+		osd_printf_error("Error generating PNG for snapshot (%s:%d %s)\n", error.category().name(), error.value(), error.message());
+	return nullptr;
+}
+
+
+// add the text entries that describe a snapshot
+void snapshot_text(running_machine &machine, util::png_info &pnginfo)
+{
+	std::string text1 = std::string(emulator_info::get_appname()).append(" ").append(emulator_info::get_build_version());
+	std::string text2 = std::string(machine.system().manufacturer).append(" ").append(machine.system().type.fullname());
+	pnginfo.add_text("Software", text1);
+	pnginfo.add_text("System", text2);
+}
+
+} // anonymous namespace
+
+
+
 //**************************************************************************
 //  GLOBAL VARIABLES
 //**************************************************************************
@@ -99,6 +147,7 @@ video_manager::video_manager(running_machine &machine)
 	, m_auto_frameskip(machine.options().auto_frameskip())
 	, m_speed(original_speed_setting())
 	, m_low_latency(machine.options().low_latency())
+	, m_wav_only(machine.options().wav_only())
 	, m_empty_skip_count(0)
 	, m_frameskip_max(m_auto_frameskip ? machine.options().frameskip() : 0)
 	, m_frameskip_level(m_auto_frameskip ? 0 : machine.options().frameskip())
@@ -106,7 +155,31 @@ video_manager::video_manager(running_machine &machine)
 	, m_frameskip_adjust(0)
 	, m_skipping_this_frame(false)
 	, m_average_oversleep(0)
+	, m_throttle_sleep_ticks(0)
+	, m_throttle_spin_ticks(0)
+	, m_runahead_frames(std::clamp(machine.options().runahead(), 0, 4))
+	, m_runahead_remaining(0)
+	, m_runahead_pending(false)
+	, m_runahead_hide(false)
+	, m_runahead_skipped(false)
+	, m_runahead_emutime(attotime::zero)
+	, m_timing_overlay(machine.options().frame_timing())
+	, m_timing(FRAME_TIMING_HISTORY)
+	, m_timing_total(0)
+	, m_timing_start(0)
+	, m_timing_render(0)
+	, m_timing_throttle(0)
+	, m_timing_present(0)
+	, m_timing_latency(0)
+	, m_timing_input(0)
+	, m_timing_prev_input(0)
+	, m_timing_skipped(false)
+	, m_cost_emulate(0.0)
+	, m_cost_render(0.0)
+	, m_cost_emutime(0.0)
 	, m_snap_target(nullptr)
+	, m_snap_queue(nullptr)
+	, m_snap_write_queue(nullptr)
 	, m_snap_native(true)
 	, m_snap_width(0)
 	, m_snap_height(0)
@@ -171,6 +244,16 @@ video_manager::video_manager(running_machine &machine)
 	if (sscanf(machine.options().snap_size(), "%dx%d", &m_snap_width, &m_snap_height) != 2)
 		m_snap_width = m_snap_height = 0;
 
+	// set up frame hashing if requested
+	m_hash_path = machine.options().hash_write();
+	if (!m_hash_path.empty())
+	{
+		strreplace(m_hash_path, "%g", machine.basename());
+		parse_hash_frames(machine.options().hash_frames());
+		m_hash_last.resize(screen_count, ~u64(0));
+		m_hash_results = util::string_format("# %s %s %s\n", machine.system().name, emulator_info::get_appname(), emulator_info::get_build_version());
+	}
+
 	// if no screens, create a periodic timer to drive updates
 	if (no_screens)
 	{
@@ -212,18 +295,46 @@ void video_manager::set_frameskip(int frameskip)
 
 void video_manager::frame_update(bool from_debugger)
 {
+	// speculative frames only draw the screens, and the last one is presented
+	// in place of the real frame that started the runahead
+	if (m_runahead_remaining && !from_debugger)
+	{
+		finish_screen_updates();
+		if (--m_runahead_remaining == 1)
+		{
+			m_runahead_hide = false;
+		}
+		else if (!m_runahead_remaining)
+		{
+			m_runahead_hide = true;
+			present_frame(m_runahead_emutime, m_runahead_skipped, true);
+		}
+		return;
+	}
+
 	// only render sound and video if we're in the running phase
 	machine_phase const phase = machine().phase();
+	osd_ticks_t const frame_start = osd_ticks();
+	if (!from_debugger && (phase == machine_phase::RUNNING) && !machine().paused())
+		record_frame_timing(frame_start);
+	else
+		m_timing_start = 0;
 	bool skipped_it = m_skipping_this_frame;
 	bool const update_screens = (phase == machine_phase::RUNNING) && (!machine().paused() || machine().options().update_in_pause());
 	bool anything_changed = update_screens && finish_screen_updates();
+	if (update_screens && !from_debugger && !m_hash_path.empty())
+		hash_screens();
 
 	// update inputs and draw the user interface
+	m_timing_prev_input = m_timing_input;
+	m_timing_input = osd_ticks();
 	machine().osd().input_update(true);
 	anything_changed = emulator_info::draw_user_interface(machine()) || anything_changed;
 
 	// let plugins draw over the UI
 	anything_changed = emulator_info::frame_hook() || anything_changed;
+	m_timing_render = osd_ticks() - frame_start;
+	m_timing_skipped = skip_this_frame();
 
 	// if none of the screens changed and we haven't skipped too many frames in a row,
 	// mark this frame as skipped to prevent throttling; this helps for games that
@@ -236,17 +347,25 @@ void video_manager::frame_update(bool from_debugger)
 	// if we're throttling, synchronize before rendering
 	attotime current_time = machine().time();
 	if (!from_debugger && phase > machine_phase::INIT && !m_low_latency && effective_throttle())
+	{
+		osd_ticks_t const throttle_start = osd_ticks();
 		update_throttle(current_time);
+		m_timing_throttle += osd_ticks() - throttle_start;
+	}
 
-	// ask the OSD to update
+	// with runahead, the OSD update waits until the frames ahead have been emulated
+	bool const run_ahead = m_runahead_frames && !from_debugger && (phase == machine_phase::RUNNING) && !machine().paused() && !(machine().debug_flags & DEBUG_FLAG_ENABLED);
+	if (run_ahead)
 	{
-		auto profile = g_profiler.start(PROFILER_BLIT);
-		machine().osd().update(!from_debugger && skipped_it);
+		m_runahead_pending = true;
+		m_runahead_skipped = skipped_it;
+		m_runahead_emutime = current_time;
+	}
+	else
+	{
+		m_runahead_hide = false;
+		present_frame(current_time, !from_debugger && skipped_it, false, from_debugger);
 	}
-
-	// we synchronize after rendering instead of before, if low latency mode is enabled
-	if (!from_debugger && phase > machine_phase::INIT && m_low_latency && effective_throttle())
-		update_throttle(current_time);
 
 	machine().osd().input_update(false);
 	emulator_info::periodic_check();
@@ -278,6 +397,148 @@ void video_manager::frame_update(bool from_debugger)
 }
 
 
+//-------------------------------------------------
+//  present_frame - ask the OSD to update, and
+//  throttle afterwards in low latency mode
+//-------------------------------------------------
+
+void video_manager::present_frame(attotime const &emutime, bool skipped, bool ahead, bool from_debugger)
+{
+	osd_ticks_t const present_start = osd_ticks();
+	{
+		auto profile = g_profiler.start(PROFILER_BLIT);
+		machine().osd().update(skipped);
+	}
+	osd_ticks_t const present_end = osd_ticks();
+	m_timing_present += present_end - present_start;
+
+	// a presented frame normally shows the effect of the input polled a frame earlier,
+	// but a frame emulated ahead shows the effect of the input polled this frame
+	osd_ticks_t const polled = ahead ? m_timing_input : m_timing_prev_input;
+	m_timing_latency = polled ? (present_end - polled) : 0;
+
+	// we synchronize after rendering instead of before, if low latency mode is enabled
+	if (!from_debugger && machine().phase() > machine_phase::INIT && m_low_latency && effective_throttle())
+	{
+		update_throttle(emutime);
+		m_timing_throttle += osd_ticks() - present_end;
+	}
+}
+
+
+//-------------------------------------------------
+//  record_frame_timing - add the timings of the
+//  frame that ends now to the history, and start
+//  measuring the next one
+//-------------------------------------------------
+
+void video_manager::record_frame_timing(osd_ticks_t frame_start)
+{
+	if (m_timing_start)
+	{
+		osd_ticks_t const tps = osd_ticks_per_second();
+		auto const micros = [tps] (osd_ticks_t ticks) { return u32(ticks * 1'000'000 / tps); };
+
+		// whatever wasn't spent rendering, throttling or presenting was spent emulating
+		osd_ticks_t const total = frame_start - m_timing_start;
+		osd_ticks_t const accounted = m_timing_render + m_timing_throttle + m_timing_present;
+
+		frame_timing &entry = m_timing[m_timing_total++ % FRAME_TIMING_HISTORY];
+		entry.emutime = machine().time();
+		entry.emulate = micros((total > accounted) ? (total - accounted) : 0);
+		entry.render = micros(m_timing_render);
+		entry.throttle = micros(m_timing_throttle);
+		entry.present = micros(m_timing_present);
+		entry.latency = micros(m_timing_latency);
+		entry.sound_fill = machine().osd().audio_buffer_fill();
+
+		// keep running averages of the frame costs for the frameskip predictor;
+		// drawing is only measured on frames that weren't skipped
+		constexpr double weight = 1.0 / 16.0;
+		if (m_timing_total > 1)
+		{
+			frame_timing const &prev = m_timing[(m_timing_total - 2) % FRAME_TIMING_HISTORY];
+			double const emutime = (entry.emutime - prev.emutime).as_double() * 1'000'000.0;
+			m_cost_emutime += (emutime - m_cost_emutime) * weight;
+			m_cost_emulate += (double(entry.emulate) - m_cost_emulate) * weight;
+			if (!m_timing_skipped)
+				m_cost_render += (double(entry.render + entry.present) - m_cost_render) * weight;
+		}
+	}
+
+	m_timing_start = frame_start;
+	m_timing_render = 0;
+	m_timing_throttle = 0;
+	m_timing_present = 0;
+	m_timing_latency = 0;
+}
+
+
+//-------------------------------------------------
+//  write_frame_timing_csv - write the timing
+//  history to the file named by the options
+//-------------------------------------------------
+
+void video_manager::write_frame_timing_csv()
+{
+	char const *const filename = machine().options().frame_timing_csv();
+	if (!filename || !*filename || !m_timing_total)
+		return;
+
+	emu_file file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (file.open(filename))
+	{
+		osd_printf_error("Error creating frame timing file %s\n", filename);
+		return;
+	}
+
+	file.puts("emutime,emulate_us,render_us,throttle_us,present_us,frame_us,latency_us,sound_fill\n");
+	for (u32 index = 0; frame_timing_count() > index; index++)
+	{
+		frame_timing const &entry = frame_timing_entry(index);
+		file.printf("%.6f,%u,%u,%u,%u,%u,%u,%d\n",
+				entry.emutime.as_double(),
+				entry.emulate, entry.render, entry.throttle, entry.present,
+				entry.emulate + entry.render + entry.throttle + entry.present,
+				entry.latency, entry.sound_fill);
+	}
+}
+
+
+//-------------------------------------------------
+//  begin_runahead - start emulating the frames
+//  ahead of the one waiting to be presented
+//-------------------------------------------------
+
+void video_manager::begin_runahead()
+{
+	assert(m_runahead_pending);
+	m_runahead_remaining = m_runahead_frames;
+	m_runahead_hide = m_runahead_remaining > 1;
+}
+
+
+//-------------------------------------------------
+//  end_runahead - finish a runahead once the
+//  machine state has been restored; if it didn't
+//  complete, present the real frame instead
+//-------------------------------------------------
+
+void video_manager::end_runahead(bool completed)
+{
+	if (!m_runahead_pending)
+		return;
+
+	m_runahead_pending = false;
+	if (!completed || m_runahead_remaining)
+	{
+		m_runahead_remaining = 0;
+		m_runahead_hide = false;
+		present_frame(m_runahead_emutime, m_runahead_skipped, false);
+	}
+}
+
+
 //-------------------------------------------------
 //  speed_text - print the text to be displayed
 //  into a string buffer
@@ -315,6 +576,30 @@ std::string video_manager::speed_text()
 	if (partials > 1)
 		util::stream_format(str, "\n%d partial updates", partials);
 
+	// summarise the most recent frame timings if requested
+	u32 const timed = std::min<u32>(frame_timing_count(), 60);
+	if (m_timing_overlay && timed)
+	{
+		u64 emulate = 0, render = 0, throttle = 0, present = 0, latency = 0;
+		u32 longest = 0;
+		for (u32 index = frame_timing_count() - timed; frame_timing_count() > index; index++)
+		{
+			frame_timing const &entry = frame_timing_entry(index);
+			emulate += entry.emulate;
+			render += entry.render;
+			throttle += entry.throttle;
+			present += entry.present;
+			latency += entry.latency;
+			longest = std::max(longest, entry.emulate + entry.render + entry.throttle + entry.present);
+		}
+		util::stream_format(str, "\nemu %.2f ui %.2f wait %.2f blit %.2f ms",
+				emulate * 1e-3 / timed, render * 1e-3 / timed, throttle * 1e-3 / timed, present * 1e-3 / timed);
+		util::stream_format(str, "\nframe max %.2f ms latency ~%.1f ms", longest * 1e-3, latency * 1e-3 / timed);
+		s32 const sound_fill = frame_timing_entry(frame_timing_count() - 1).sound_fill;
+		if (sound_fill >= 0)
+			util::stream_format(str, "\naudio queue %d samples", sound_fill);
+	}
+
 	return str.str();
 }
 
@@ -333,21 +618,51 @@ void video_manager::save_snapshot(screen_device *screen, util::core_file &file)
 	create_snapshot_bitmap(screen);
 
 	// add two text entries describing the image
-	std::string text1 = std::string(emulator_info::get_appname()).append(" ").append(emulator_info::get_build_version());
-	std::string text2 = std::string(machine().system().manufacturer).append(" ").append(machine().system().type.fullname());
 	util::png_info pnginfo;
-	pnginfo.add_text("Software", text1);
-	pnginfo.add_text("System", text2);
+	snapshot_text(machine(), pnginfo);
 
 	// now do the actual work
 	const rgb_t *palette = (screen != nullptr && screen->has_palette()) ? screen->palette().palette()->entry_list_adjusted() : nullptr;
 	int entries = (screen != nullptr && screen->has_palette()) ? screen->palette().entries() : 0;
-	std::error_condition const error = util::png_write_bitmap(file, &pnginfo, m_snap_bitmap, entries, palette);
+	std::error_condition const error = util::png_write_bitmap(file, &pnginfo, m_snap_bitmap, entries, palette, util::png_compression::FAST);
 	if (error)
 		osd_printf_error("Error generating PNG for snapshot (%s:%d %s)\n", error.category().name(), error.value(), error.message());
 }
 
 
+//-------------------------------------------------
+//  queue_snapshot - render a snapshot now, and
+//  leave encoding and writing it to a worker
+//-------------------------------------------------
+
+void video_manager::queue_snapshot(screen_device *screen, std::unique_ptr<emu_file> &&file)
+{
+	// validate
+	assert(!m_snap_native || screen != nullptr);
+
+	// render the bitmap and take a copy of everything the encoder needs
+	create_snapshot_bitmap(screen);
+	auto job = std::make_unique<snapshot_job>();
+	job->file = std::move(file);
+	job->bitmap.allocate(m_snap_bitmap.width(), m_snap_bitmap.height());
+	copybitmap(job->bitmap, m_snap_bitmap, 0, 0, 0, 0, m_snap_bitmap.cliprect());
+	if (screen != nullptr && screen->has_palette())
+	{
+		rgb_t const *const palette = screen->palette().palette()->entry_list_adjusted();
+		job->palette.assign(palette, palette + screen->palette().entries());
+	}
+	snapshot_text(machine(), job->pnginfo);
+
+	// hand it off, or write it here if that isn't possible
+	if (!m_snap_write_queue)
+		m_snap_write_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	if (m_snap_write_queue && osd_work_item_queue(m_snap_write_queue, write_snapshot_job, job.get(), WORK_ITEM_FLAG_AUTO_RELEASE))
+		job.release();
+	else
+		write_snapshot_job(job.release(), 0);
+}
+
+
 //-------------------------------------------------
 //  save_active_screen_snapshots - save a
 //  snapshot of all active screens
@@ -361,19 +676,19 @@ void video_manager::save_active_screen_snapshots()
 		for (screen_device &screen : screen_device_enumerator(machine().root_device()))
 			if (machine().render().is_live(screen))
 			{
-				emu_file file(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
-				std::error_condition const filerr = open_next(file, "png");
+				auto file = std::make_unique<emu_file>(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+				std::error_condition const filerr = open_next(*file, "png");
 				if (!filerr)
-					save_snapshot(&screen, file);
+					queue_snapshot(&screen, std::move(file));
 			}
 	}
 	else
 	{
 		// otherwise, just write a single snapshot
-		emu_file file(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
-		std::error_condition const filerr = open_next(file, "png");
+		auto file = std::make_unique<emu_file>(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		std::error_condition const filerr = open_next(*file, "png");
 		if (!filerr)
-			save_snapshot(nullptr, file);
+			queue_snapshot(nullptr, std::move(file));
 	}
 }
 
@@ -498,9 +813,29 @@ void video_manager::exit()
 	// stop recording any movie
 	m_movie_recordings.clear();
 
+	// write out any frame hashes
+	if (!m_hash_path.empty())
+		write_hashes();
+
+	// dump the frame timings if requested
+	write_frame_timing_csv();
+
+	// finish writing any snapshots still in flight
+	if (m_snap_write_queue)
+	{
+		osd_work_queue_wait(m_snap_write_queue, 10 * osd_ticks_per_second());
+		osd_work_queue_free(m_snap_write_queue);
+		m_snap_write_queue = nullptr;
+	}
+
 	// free the snapshot target
 	machine().render().target_free(m_snap_target);
 	m_snap_bitmap.reset();
+	if (m_snap_queue)
+	{
+		osd_work_queue_free(m_snap_queue);
+		m_snap_queue = nullptr;
+	}
 
 	// print a final result if we have at least 2 seconds' worth of data
 	if (!emulator_info::standalone() && m_overall_emutime.seconds() >= 1)
@@ -509,6 +844,11 @@ void video_manager::exit()
 		double final_real_time = (double)m_overall_real_seconds + (double)m_overall_real_ticks / (double)tps;
 		double final_emu_time = m_overall_emutime.as_double();
 		osd_printf_info("Average speed: %.2f%% (%d seconds)\n", 100 * final_emu_time / final_real_time, (m_overall_emutime + attotime(0, ATTOSECONDS_PER_SECOND / 2)).seconds());
+
+		// report how the throttle spent its waiting time
+		osd_ticks_t const waited = m_throttle_sleep_ticks + m_throttle_spin_ticks;
+		if (waited)
+			osd_printf_verbose("Throttle: waited %.2f seconds, %.2f%% asleep and %.2f%% spinning\n", (double)waited / (double)tps, 100.0 * m_throttle_sleep_ticks / waited, 100.0 * m_throttle_spin_ticks / waited);
 	}
 }
 
@@ -532,6 +872,10 @@ void video_manager::screenless_update_callback(s32 param)
 
 void video_manager::postload()
 {
+	// restoring the state after a runahead doesn't change the real timeline
+	if (m_runahead_pending)
+		return;
+
 	attotime const emutime = machine().time();
 	for (const auto &x : m_movie_recordings)
 		x->set_next_frame_time(emutime);
@@ -632,13 +976,23 @@ bool video_manager::finish_screen_updates()
 	bool anything_changed = !has_live_screen || m_output_changed;
 	m_output_changed = false;
 
-	// now add the quads for all the screens
+	// start drawing every screen's deferred updates together so that they
+	// overlap; each is waited for as its quads are added
+	for (screen_device &screen : iter)
+		screen.queue_deferred_updates();
+
+	// now add the quads for all the screens; with -wavonly nothing is
+	// presented, so just finish the deferred drawing
 	for (screen_device &screen : iter)
-		if (screen.update_quads())
+	{
+		if (m_wav_only)
+			screen.flush_deferred_updates();
+		else if (screen.update_quads())
 			anything_changed = true;
+	}
 
 	// update our movie recording and burn-in state
-	if (!machine().paused())
+	if (!machine().paused() && !m_runahead_remaining)
 	{
 		record_frame();
 
@@ -827,10 +1181,16 @@ osd_ticks_t video_manager::throttle_until_ticks(osd_ticks_t target_ticks)
 		osd_ticks_t const new_ticks = osd_ticks();
 
 		// keep some metrics on the sleeping patterns of the OSD layer
-		if (slept)
+		osd_ticks_t const actual_ticks = new_ticks - current_ticks;
+		if (!slept)
+		{
+			m_throttle_spin_ticks += actual_ticks;
+		}
+		else
 		{
+			m_throttle_sleep_ticks += actual_ticks;
+
 			// if we overslept, keep an average of the amount
-			osd_ticks_t const actual_ticks = new_ticks - current_ticks;
 			if (actual_ticks > delta)
 			{
 				// take 99% of the previous average plus 1% of the new value
@@ -855,8 +1215,9 @@ osd_ticks_t video_manager::throttle_until_ticks(osd_ticks_t target_ticks)
 
 void video_manager::update_frameskip()
 {
-	// if we're throttling and autoframeskip is on, adjust
-	if (effective_throttle() && effective_autoframeskip() && m_frameskip_counter == 0)
+	// if we're throttling and autoframeskip is on, adjust, falling back to
+	// speed-based adjustment until enough frames have been measured
+	if (effective_throttle() && effective_autoframeskip() && m_frameskip_counter == 0 && !predict_frameskip())
 	{
 		// calibrate the "adjusted speed" based on the target
 		double adjusted_speed_percent = m_speed_percent / double(m_throttle_rate);
@@ -897,6 +1258,55 @@ void video_manager::update_frameskip()
 }
 
 
+//-------------------------------------------------
+//  predict_frameskip - choose the frameskip level
+//  from the measured costs of emulating and
+//  drawing a frame; returns false if there isn't
+//  enough history to go on
+//-------------------------------------------------
+
+bool video_manager::predict_frameskip()
+{
+	if ((m_timing_total < FRAMESKIP_LEVELS * 2) || (m_cost_emutime <= 0.0) || !m_speed || (m_throttle_rate <= 0.0f))
+		return false;
+
+	// real time available per frame, leaving a little headroom for jitter
+	double const budget = 0.95 * m_cost_emutime * 1000.0 / double(m_speed) / double(m_throttle_rate);
+
+	// over a full cycle of the skip table every frame is emulated, but only
+	// the frames that aren't skipped are drawn, so find the lowest level that
+	// fits: FRAMESKIP_LEVELS * (budget - emulate) >= (FRAMESKIP_LEVELS - level) * render
+	int const max_level = m_frameskip_max ? m_frameskip_max : MAX_FRAMESKIP;
+	int target = 0;
+	if (m_cost_render > 0.0)
+	{
+		double const drawable = FRAMESKIP_LEVELS * (budget - m_cost_emulate) / m_cost_render;
+		target = std::clamp(FRAMESKIP_LEVELS - int(std::floor(drawable)), 0, max_level);
+	}
+
+	// skip more as soon as it's needed, but only skip less once the
+	// prediction has agreed for a few cycles so the level doesn't oscillate
+	if (target > m_frameskip_level)
+	{
+		m_frameskip_level = target;
+		m_frameskip_adjust = 0;
+	}
+	else if (target < m_frameskip_level)
+	{
+		if (++m_frameskip_adjust >= 3)
+		{
+			m_frameskip_adjust = 0;
+			m_frameskip_level--;
+		}
+	}
+	else
+	{
+		m_frameskip_adjust = 0;
+	}
+	return true;
+}
+
+
 //-------------------------------------------------
 //  update_refresh_speed - update the m_speed
 //  based on the maximum refresh rate supported
@@ -989,29 +1399,121 @@ void video_manager::recompute_speed(const attotime &emutime)
 	// if we're past the "time-to-execute" requested, signal an exit
 	if (m_seconds_to_run != 0 && emutime.seconds() >= m_seconds_to_run)
 	{
-		// create a final screenshot
-		if (m_snap_native)
+		// create a final screenshot, unless hashes are standing in for it
+		if (m_hash_path.empty())
 		{
-			for (screen_device &screen : screen_device_enumerator(machine().root_device()))
+			if (m_snap_native)
+			{
+				for (screen_device &screen : screen_device_enumerator(machine().root_device()))
+				{
+					emu_file file(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+					std::error_condition const filerr = open_next(file, "png");
+					if (!filerr)
+						save_snapshot(&screen, file);
+				}
+			}
+			else
 			{
 				emu_file file(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
 				std::error_condition const filerr = open_next(file, "png");
 				if (!filerr)
-					save_snapshot(&screen, file);
+					save_snapshot(nullptr, file);
 			}
 		}
+
+		//printf("Scheduled exit at %f\n", emutime.as_double());
+		// schedule our demise
+		machine().schedule_exit();
+	}
+}
+
+
+//-------------------------------------------------
+//  parse_hash_frames - parse the list of frames
+//  to hash, e.g. "60,120,300-310"
+//-------------------------------------------------
+
+void video_manager::parse_hash_frames(const char *spec)
+{
+	std::string_view remaining(spec ? spec : "");
+	while (!remaining.empty())
+	{
+		std::string_view::size_type const comma = remaining.find(',');
+		std::string item(strtrimspace(remaining.substr(0, comma)));
+		remaining = (std::string_view::npos == comma) ? std::string_view() : remaining.substr(comma + 1);
+		if (item.empty())
+			continue;
+
+		unsigned long long first, last;
+		char dummy;
+		if (sscanf(item.c_str(), "%llu-%llu%c", &first, &last, &dummy) == 2 && first <= last)
+			m_hash_frames.emplace_back(first, last);
+		else if (sscanf(item.c_str(), "%llu%c", &first, &dummy) == 1)
+			m_hash_frames.emplace_back(first, first);
 		else
+			osd_printf_warning("Ignoring invalid frame specification '%s' for -%s\n", item, OPTION_HASHFRAMES);
+	}
+	std::sort(m_hash_frames.begin(), m_hash_frames.end());
+}
+
+
+//-------------------------------------------------
+//  hash_screens - hash the pixels of any screen
+//  that has reached a frame we want, and exit
+//  once every screen is past the last one
+//-------------------------------------------------
+
+void video_manager::hash_screens()
+{
+	bool finished = !m_hash_frames.empty();
+	unsigned index = 0;
+	for (screen_device &screen : screen_device_enumerator(machine().root_device()))
+	{
+		u64 const frame = screen.frame_number();
+		bool const wanted = m_hash_frames.empty() || std::any_of(
+				m_hash_frames.begin(),
+				m_hash_frames.end(),
+				[frame] (std::pair<u64, u64> const &range) { return (frame >= range.first) && (frame <= range.second); });
+		if (wanted && (m_hash_last[index] != frame))
 		{
-			emu_file file(machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
-			std::error_condition const filerr = open_next(file, "png");
-			if (!filerr)
-				save_snapshot(nullptr, file);
+			// grab the visible pixels as RGB and hash them in a byte order that doesn't depend on the host
+			rectangle const &visarea = screen.visible_area();
+			m_hash_pixels.resize(size_t(visarea.width()) * visarea.height());
+			screen.pixels(&m_hash_pixels[0]);
+			if (util::endianness::native != util::endianness::little)
+			{
+				for (u32 &pixel : m_hash_pixels)
+					pixel = little_endianize_int32(pixel);
+			}
+			util::crc32_t const crc = util::crc32_creator::simple(&m_hash_pixels[0], m_hash_pixels.size() * sizeof(u32));
+			m_hash_results.append(util::string_format("%s %u %dx%d %s\n", screen.tag(), frame, visarea.width(), visarea.height(), crc.as_string()));
+			m_hash_last[index] = frame;
 		}
+		if (finished && (frame < m_hash_frames.back().second))
+			finished = false;
+		index++;
+	}
 
-		//printf("Scheduled exit at %f\n", emutime.as_double());
-		// schedule our demise
+	if (finished)
 		machine().schedule_exit();
+}
+
+
+//-------------------------------------------------
+//  write_hashes - write the collected frame
+//  hashes to the results file
+//-------------------------------------------------
+
+void video_manager::write_hashes()
+{
+	emu_file file(OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	std::error_condition const filerr = file.open(m_hash_path);
+	if (filerr)
+	{
+		osd_printf_error("Error creating frame hash file %s (%s:%d %s)\n", m_hash_path, filerr.category().name(), filerr.value(), filerr.message());
+		return;
 	}
+	file.puts(m_hash_results);
 }
 
 
@@ -1042,13 +1544,15 @@ void video_manager::create_snapshot_bitmap(screen_device *screen)
 	if (width != m_snap_bitmap.width() || height != m_snap_bitmap.height())
 		m_snap_bitmap.resize(width, height);
 
-	// render the screen there
+	// render the screen there, in bands on worker threads
+	if (!m_snap_queue)
+		m_snap_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
 	render_primitive_list &primlist = m_snap_target->get_primitives();
 	primlist.acquire_lock();
 	if (machine().options().snap_bilinear())
-		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels(), m_snap_queue);
 	else
-		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix(0), width, height, m_snap_bitmap.rowpixels(), m_snap_queue);
 	primlist.release_lock();
 }
 
@@ -1264,7 +1768,7 @@ void video_manager::toggle_record_movie(movie_recording::format format)
 	if (!is_recording())
 	{
 		begin_recording(nullptr, format);
-		machine().popmessage("REC START (%s)", format == movie_recording::format::MNG ? "MNG" : "AVI");
+		machine().popmessage("REC START (%s)", movie_recording::format_name(format));
 	}
 	else
 	{
@@ -19,7 +19,10 @@
 
 #include "recording.h"
 
+#include <string>
 #include <system_error>
+#include <utility>
+#include <vector>
 
 
 //**************************************************************************
@@ -42,12 +45,27 @@ class video_manager
 	friend class screen_device;
 
 public:
+	// timings measured for a frame, in microseconds
+	struct frame_timing
+	{
+		attotime    emutime;        // emulated time when the frame ended
+		u32         emulate;        // time spent emulating the machine
+		u32         render;         // time spent finishing screens and drawing the UI
+		u32         throttle;       // time spent waiting to stay in sync with real time
+		u32         present;        // time spent in the OSD update
+		u32         latency;        // estimated time from polling input to presenting its result
+		s32         sound_fill;     // stereo samples queued by the OSD, or -1 if unknown
+	};
+
+	// number of frames kept in the timing history
+	static constexpr u32 FRAME_TIMING_HISTORY = 4096;
+
 	// construction/destruction
 	video_manager(running_machine &machine);
 
 	// getters
 	running_machine &machine() const { return m_machine; }
-	bool skip_this_frame() const { return m_skipping_this_frame; }
+	bool skip_this_frame() const { return (m_skipping_this_frame && m_hash_path.empty()) || m_runahead_hide || m_wav_only; }
 	int speed_factor() const { return m_speed; }
 	int frameskip() const { return m_auto_frameskip ? -1 : m_frameskip_level; }
 	bool throttled() const { return m_throttled; }
@@ -70,11 +88,23 @@ public:
 	// render a frame
 	void frame_update(bool from_debugger = false);
 
+	// runahead
+	int runahead_frames() const { return m_runahead_frames; }
+	bool runahead_pending() const { return m_runahead_pending; }
+	bool speculating() const { return m_runahead_remaining != 0; }
+	void begin_runahead();
+	void end_runahead(bool completed);
+
 	// current speed helpers
 	std::string speed_text();
 	double speed_percent() const { return m_speed_percent; }
 	int effective_frameskip() const;
 
+	// frame timing history, oldest first
+	bool show_frame_timing() const { return m_timing_overlay; }
+	u32 frame_timing_count() const { return (m_timing_total < FRAME_TIMING_HISTORY) ? m_timing_total : FRAME_TIMING_HISTORY; }
+	frame_timing const &frame_timing_entry(u32 index) const { return m_timing[(m_timing_total - frame_timing_count() + index) % FRAME_TIMING_HISTORY]; }
+
 	// snapshots
 	bool snap_native() const { return m_snap_native; }
 	render_target &snapshot_target() { return *m_snap_target; }
@@ -100,14 +130,22 @@ private:
 	// speed and throttling helpers
 	int original_speed_setting() const;
 	bool finish_screen_updates();
+	void present_frame(attotime const &emutime, bool skipped, bool ahead, bool from_debugger = false);
+	void record_frame_timing(osd_ticks_t frame_start);
+	void write_frame_timing_csv();
 	void update_throttle(attotime emutime);
 	osd_ticks_t throttle_until_ticks(osd_ticks_t target_ticks);
 	void update_frameskip();
+	bool predict_frameskip();
 	void update_refresh_speed();
 	void recompute_speed(const attotime &emutime);
 
 	// snapshot/movie helpers
 	void create_snapshot_bitmap(screen_device *screen);
+	void parse_hash_frames(const char *spec);
+	void hash_screens();
+	void write_hashes();
+	void queue_snapshot(screen_device *screen, std::unique_ptr<emu_file> &&file);
 	void record_frame();
 
 	// movies
@@ -145,6 +183,7 @@ private:
 	bool                m_auto_frameskip;           // flag: true if we're automatically frameskipping
 	u32                 m_speed;                    // overall speed (*1000)
 	bool                m_low_latency;              // flag: true if we are throttling after blitting
+	bool                m_wav_only;                 // flag: true if only audio is being rendered
 
 	// frameskipping
 	u8                  m_empty_skip_count;         // number of empty frames we have skipped
@@ -154,9 +193,37 @@ private:
 	s8                  m_frameskip_adjust;
 	bool                m_skipping_this_frame;      // flag: true if we are skipping the current frame
 	osd_ticks_t         m_average_oversleep;        // average number of ticks the OSD oversleeps
+	osd_ticks_t         m_throttle_sleep_ticks;     // total ticks the throttle spent asleep
+	osd_ticks_t         m_throttle_spin_ticks;      // total ticks the throttle spent spinning
+
+	// runahead
+	u8                  m_runahead_frames;          // number of frames to emulate ahead of the display
+	u8                  m_runahead_remaining;       // speculative frames left to emulate
+	bool                m_runahead_pending;         // flag: true if a frame is waiting to be presented ahead
+	bool                m_runahead_hide;            // flag: true if screens shouldn't draw this frame
+	bool                m_runahead_skipped;         // skip state of the frame waiting to be presented
+	attotime            m_runahead_emutime;         // emulated time of the frame waiting to be presented
+
+	// frame timing
+	bool                m_timing_overlay;           // flag: true if timings are shown with the speed
+	std::vector<frame_timing> m_timing;             // ring buffer of recently measured frames
+	u32                 m_timing_total;             // total frames measured
+	osd_ticks_t         m_timing_start;             // ticks when the frame being measured started, or 0
+	osd_ticks_t         m_timing_render;            // ticks spent rendering the frame being measured
+	osd_ticks_t         m_timing_throttle;          // ticks spent throttling the frame being measured
+	osd_ticks_t         m_timing_present;           // ticks spent presenting the frame being measured
+	osd_ticks_t         m_timing_latency;           // ticks from input poll to present of the frame being measured
+	osd_ticks_t         m_timing_input;             // ticks when input was polled for this frame
+	osd_ticks_t         m_timing_prev_input;        // ticks when input was polled for the previous frame
+	bool                m_timing_skipped;           // flag: true if the frame being measured skipped drawing
+	double              m_cost_emulate;             // average microseconds spent emulating a frame
+	double              m_cost_render;              // average microseconds spent drawing and presenting a frame
+	double              m_cost_emutime;             // average emulated microseconds per frame
 
 	// snapshot stuff
 	render_target *     m_snap_target;              // screen shapshot target
+	osd_work_queue *    m_snap_queue;               // queue for drawing snapshots in bands
+	osd_work_queue *    m_snap_write_queue;         // queue for encoding and writing snapshots
 	bitmap_rgb32        m_snap_bitmap;              // screen snapshot bitmap
 	bool                m_snap_native;              // are we using native per-screen layouts?
 	s32                 m_snap_width;               // width of snapshots (0 == auto)
@@ -165,6 +232,13 @@ private:
 	// movie recordings
 	std::vector<movie_recording::ptr> m_movie_recordings;
 
+	// frame hashing
+	std::string         m_hash_path;                // file to write screen hashes to, or empty
+	std::vector<std::pair<u64, u64> > m_hash_frames; // ranges of frame numbers to hash (empty == all)
+	std::vector<u64>    m_hash_last;                // last frame hashed for each screen
+	std::vector<u32>    m_hash_pixels;              // scratch buffer for a screen's pixels
+	std::string         m_hash_results;             // results waiting to be written at exit
+
 	static const bool   s_skiptable[FRAMESKIP_LEVELS][FRAMESKIP_LEVELS];
 
 	static const attoseconds_t ATTOSECONDS_PER_SPEED_UPDATE = ATTOSECONDS_PER_SECOND / 4;
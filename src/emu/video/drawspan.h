@@ -0,0 +1,195 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    drawspan.h
+
+    Pixel operations for drawgfx that can also render a run of unflipped
+    source pixels at once, optimized with SIMD where available.
+
+    Each operation can be used as a per-pixel function object by the
+    drawgfx templates, and provides span() to render count consecutive
+    pixels; drawgfx_core calls span() for unflipped rows when it exists.
+    The span() results are bit-identical to applying the per-pixel
+    operation to each pixel in turn.
+
+***************************************************************************/
+
+#ifndef MAME_EMU_VIDEO_DRAWSPAN_H
+#define MAME_EMU_VIDEO_DRAWSPAN_H
+
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define MAME_DRAWSPAN_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define MAME_DRAWSPAN_NEON
+#include <arm_neon.h>
+#endif
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+// ======================> drawgfx_has_span
+
+// true if a pixel operation can render runs of DestType from SourceType
+template <typename FunctionClass, typename DestType, typename SourceType, typename = void>
+struct drawgfx_has_span : std::false_type { };
+
+template <typename FunctionClass, typename DestType, typename SourceType>
+struct drawgfx_has_span<FunctionClass, DestType, SourceType, std::void_t<decltype(std::declval<FunctionClass const &>().span(std::declval<DestType *>(), std::declval<SourceType const *>(), u32(0)))> > : std::true_type { };
+
+
+// ======================> drawspan_rebase_opaque
+
+// render all pixels regardless of pen, adding 'color'; equivalent to PIXEL_OP_REBASE_OPAQUE
+struct drawspan_rebase_opaque
+{
+	u32 color;
+
+	void operator()(u16 &destp, const u8 &srcp) const { destp = color + srcp; }
+
+	void span(u16 *dest, const u8 *src, u32 count) const
+	{
+#if defined(MAME_DRAWSPAN_SSE2)
+		__m128i const zero = _mm_setzero_si128();
+		__m128i const base = _mm_set1_epi16(s16(color));
+		for ( ; count >= 16; count -= 16, src += 16, dest += 16)
+		{
+			__m128i const pens = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 0), _mm_add_epi16(_mm_unpacklo_epi8(pens, zero), base));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 8), _mm_add_epi16(_mm_unpackhi_epi8(pens, zero), base));
+		}
+#elif defined(MAME_DRAWSPAN_NEON)
+		uint16x8_t const base = vdupq_n_u16(u16(color));
+		for ( ; count >= 16; count -= 16, src += 16, dest += 16)
+		{
+			uint8x16_t const pens = vld1q_u8(src);
+			vst1q_u16(dest + 0, vaddq_u16(vmovl_u8(vget_low_u8(pens)), base));
+			vst1q_u16(dest + 8, vaddq_u16(vmovl_u8(vget_high_u8(pens)), base));
+		}
+#endif
+		for ( ; count; count--)
+			(*this)(*dest++, *src++);
+	}
+};
+
+
+// ======================> drawspan_rebase_transpen
+
+// render all pixels except those matching 'trans_pen', adding 'color'; equivalent to PIXEL_OP_REBASE_TRANSPEN
+struct drawspan_rebase_transpen
+{
+	u32 trans_pen;
+	u32 color;
+
+	void operator()(u16 &destp, const u8 &srcp) const { if (srcp != trans_pen) destp = color + srcp; }
+
+	void span(u16 *dest, const u8 *src, u32 count) const
+	{
+		// a pen that can't occur means every pixel is opaque
+		if (trans_pen > 0xff)
+			return drawspan_rebase_opaque{ color }.span(dest, src, count);
+
+#if defined(MAME_DRAWSPAN_SSE2)
+		__m128i const zero = _mm_setzero_si128();
+		__m128i const base = _mm_set1_epi16(s16(color));
+		__m128i const trans = _mm_set1_epi8(s8(trans_pen));
+		for ( ; count >= 16; count -= 16, src += 16, dest += 16)
+		{
+			__m128i const pens = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src));
+			__m128i const keep = _mm_cmpeq_epi8(pens, trans);
+			int const keepbits = _mm_movemask_epi8(keep);
+			if (keepbits == 0xffff)
+				continue;
+
+			__m128i const keep0 = _mm_unpacklo_epi8(keep, keep);
+			__m128i const keep1 = _mm_unpackhi_epi8(keep, keep);
+			__m128i const new0 = _mm_add_epi16(_mm_unpacklo_epi8(pens, zero), base);
+			__m128i const new1 = _mm_add_epi16(_mm_unpackhi_epi8(pens, zero), base);
+			__m128i *const out = reinterpret_cast<__m128i *>(dest);
+			if (!keepbits)
+			{
+				_mm_storeu_si128(out + 0, new0);
+				_mm_storeu_si128(out + 1, new1);
+			}
+			else
+			{
+				_mm_storeu_si128(out + 0, _mm_or_si128(_mm_and_si128(keep0, _mm_loadu_si128(out + 0)), _mm_andnot_si128(keep0, new0)));
+				_mm_storeu_si128(out + 1, _mm_or_si128(_mm_and_si128(keep1, _mm_loadu_si128(out + 1)), _mm_andnot_si128(keep1, new1)));
+			}
+		}
+#elif defined(MAME_DRAWSPAN_NEON)
+		uint16x8_t const base = vdupq_n_u16(u16(color));
+		uint8x16_t const trans = vdupq_n_u8(u8(trans_pen));
+		for ( ; count >= 16; count -= 16, src += 16, dest += 16)
+		{
+			uint8x16_t const pens = vld1q_u8(src);
+			int8x16_t const keep = vreinterpretq_s8_u8(vceqq_u8(pens, trans));
+			uint16x8_t const keep0 = vreinterpretq_u16_s16(vmovl_s8(vget_low_s8(keep)));
+			uint16x8_t const keep1 = vreinterpretq_u16_s16(vmovl_s8(vget_high_s8(keep)));
+			vst1q_u16(dest + 0, vbslq_u16(keep0, vld1q_u16(dest + 0), vaddq_u16(vmovl_u8(vget_low_u8(pens)), base)));
+			vst1q_u16(dest + 8, vbslq_u16(keep1, vld1q_u16(dest + 8), vaddq_u16(vmovl_u8(vget_high_u8(pens)), base)));
+		}
+#endif
+		for ( ; count; count--)
+			(*this)(*dest++, *src++);
+	}
+};
+
+
+// ======================> drawspan_remap_transpen
+
+// render all pixels except those matching 'trans_pen', mapping the pen via
+// 'paldata'; equivalent to PIXEL_OP_REMAP_TRANSPEN; the palette lookup can't
+// be vectorized, but wholly transparent groups of pixels are skipped and
+// wholly opaque groups are drawn without testing each pixel
+struct drawspan_remap_transpen
+{
+	u32 trans_pen;
+	const pen_t *paldata;
+
+	void operator()(u32 &destp, const u8 &srcp) const { if (srcp != trans_pen) destp = paldata[srcp]; }
+
+	void span(u32 *dest, const u8 *src, u32 count) const
+	{
+#if defined(MAME_DRAWSPAN_SSE2) || defined(MAME_DRAWSPAN_NEON)
+		if (trans_pen <= 0xff)
+		{
+#if defined(MAME_DRAWSPAN_SSE2)
+			__m128i const trans = _mm_set1_epi8(s8(trans_pen));
+#else
+			uint8x16_t const trans = vdupq_n_u8(u8(trans_pen));
+#endif
+			for ( ; count >= 16; count -= 16, src += 16, dest += 16)
+			{
+#if defined(MAME_DRAWSPAN_SSE2)
+				u32 const skipbits = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(src)), trans));
+#else
+				uint8x8_t const narrowed = vshrn_n_u16(vreinterpretq_u16_u8(vceqq_u8(vld1q_u8(src), trans)), 4);
+				u64 const skipnibbles = vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+				u32 const skipbits = !skipnibbles ? 0 : !~skipnibbles ? 0xffff : 1;
+#endif
+				if (skipbits == 0xffff)
+					continue;
+				else if (!skipbits)
+					for (int i = 0; i < 16; i++)
+						dest[i] = paldata[src[i]];
+				else
+					for (int i = 0; i < 16; i++)
+						(*this)(dest[i], src[i]);
+			}
+		}
+#endif
+		for ( ; count; count--)
+			(*this)(*dest++, *src++);
+	}
+};
+
+#endif // MAME_EMU_VIDEO_DRAWSPAN_H
@@ -0,0 +1,45 @@
+// license:BSD-3-Clause
+// copyright-holders:Vas Crabb, Ryan Holtz
+/***************************************************************************
+
+    rgbneon.cpp
+
+    NEON optimised RGB utilities.
+
+***************************************************************************/
+
+#include "emu.h"
+
+#if (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && !(defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))) && !defined(__ALTIVEC__) && (defined(__ARM_NEON) || defined(_M_ARM64))
+
+#include "rgbneon.h"
+
+
+/***************************************************************************
+    HIGHER LEVEL OPERATIONS
+***************************************************************************/
+
+void rgbaint_t::blend(const rgbaint_t& other, u8 factor)
+{
+	const s32 scale1 = s32(factor);
+	const s32 scale2 = 0x100 - scale1;
+
+	m_value = vmlaq_n_s32(vmulq_n_s32(m_value, scale1), other.m_value, scale2);
+	sra_imm(8);
+}
+
+void rgbaint_t::scale_and_clamp(const rgbaint_t& scale)
+{
+	mul(scale);
+	sra_imm(8);
+	clamp_to_uint8();
+}
+
+void rgbaint_t::scale_imm_and_clamp(const s32 scale)
+{
+	mul_imm(scale);
+	sra_imm(8);
+	clamp_to_uint8();
+}
+
+#endif // (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__ARM_NEON) || defined(_M_ARM64))
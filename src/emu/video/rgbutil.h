@@ -23,6 +23,12 @@
 #define MAME_RGB_HIGH_PRECISION
 #include "rgbvmx.h"
 
+#elif (!defined(MAME_DEBUG) || defined(__OPTIMIZE__)) && (defined(__ARM_NEON) || defined(_M_ARM64))
+
+// NEON is mandatory on AArch64, so it can be assumed there too
+#define MAME_RGB_HIGH_PRECISION
+#include "rgbneon.h"
+
 #else
 
 #include "rgbgen.h"
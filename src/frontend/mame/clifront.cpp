@@ -24,6 +24,7 @@
 
 #include "emuopts.h"
 #include "fileio.h"
+#include "hashcache.h"
 #include "romload.h"
 #include "softlist_dev.h"
 #include "validity.h"
@@ -38,12 +39,23 @@
 #include "osdepend.h"
 
 #include <algorithm>
+#include <exception>
+#include <functional>
 #include <new>
 #include <set>
 #include <tuple>
 #include <cctype>
+#include <cerrno>
+#include <cstdio>
 #include <iostream>
 
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define MAME_CLIFRONT_FORK_BATCH
+#endif
+
 
 //**************************************************************************
 //  CONSTANTS
@@ -79,9 +91,11 @@
 #define CLICOMMAND_GETSOFTLIST          "getsoftlist"
 #define CLICOMMAND_VERIFYSOFTLIST       "verifysoftlist"
 #define CLICOMMAND_VERSION              "version"
+#define CLICOMMAND_RUNBATCH             "runbatch"
 
 // command options
 #define CLIOPTION_DTD                   "dtd"
+#define CLIOPTION_BATCHJOBS             "batchjobs"
 
 
 namespace {
@@ -125,18 +139,19 @@ const options_entry cli_option_entries[] =
 	{ CLICOMMAND_GETSOFTLIST    ";glist",   "0",       core_options::option_type::COMMAND,    "retrieve software list by name" },
 	{ CLICOMMAND_VERIFYSOFTLIST ";vlist",   "0",       core_options::option_type::COMMAND,    "verify software list by name" },
 	{ CLICOMMAND_VERSION,                   "0",       core_options::option_type::COMMAND,    "get MAME version" },
+	{ CLICOMMAND_RUNBATCH,                  "0",       core_options::option_type::COMMAND,    "run each system matching the given patterns in turn, e.g. for regression testing with -str or -hashwrite" },
 
 	{ nullptr,                              nullptr,   core_options::option_type::HEADER,     "FRONTEND COMMAND OPTIONS" },
 	{ CLIOPTION_DTD,                        "1",       core_options::option_type::BOOLEAN,    "include DTD in XML output" },
+	{ CLIOPTION_BATCHJOBS,                  "1",       core_options::option_type::INTEGER,    "number of worker processes for -runbatch (forked after startup where supported)" },
 	{ nullptr }
 };
 
 
 void print_summary(
-		const media_auditor &auditor, media_auditor::summary summary, bool record_none_needed,
+		std::string_view report, media_auditor::summary summary, bool record_none_needed,
 		const char *type, const char *name, const char *parent,
-		unsigned &correct, unsigned &incorrect, unsigned &notfound,
-		util::ovectorstream &buffer)
+		unsigned &correct, unsigned &incorrect, unsigned &notfound)
 {
 	if (summary == media_auditor::NOTFOUND)
 	{
@@ -146,11 +161,7 @@ void print_summary(
 	else if (record_none_needed || (summary != media_auditor::NONE_NEEDED))
 	{
 		// output the summary of the audit
-		buffer.clear();
-		buffer.seekp(0);
-		auditor.summarize(name, &buffer);
-		buffer.put('\0');
-		osd_printf_info("%s", &buffer.vec()[0]);
+		osd_printf_info("%s", report);
 
 		// output the name of the driver and its parent
 		osd_printf_info("%sset %s ", type, name);
@@ -185,6 +196,149 @@ void print_summary(
 	}
 }
 
+
+void print_summary(
+		const media_auditor &auditor, media_auditor::summary summary, bool record_none_needed,
+		const char *type, const char *name, const char *parent,
+		unsigned &correct, unsigned &incorrect, unsigned &notfound,
+		util::ovectorstream &buffer)
+{
+	buffer.clear();
+	buffer.seekp(0);
+	if ((summary != media_auditor::NOTFOUND) && (record_none_needed || (summary != media_auditor::NONE_NEEDED)))
+		auditor.summarize(name, &buffer);
+	print_summary(
+			std::string_view(buffer.vec().data(), buffer.vec().size()), summary, record_none_needed,
+			type, name, parent,
+			correct, incorrect, notfound);
+}
+
+
+// ======================> parallel_auditor
+
+// runs audits on a work queue and reports them in submission order
+class parallel_auditor
+{
+public:
+	// audit runs on a worker with its own enumerator and auditor, and
+	// writes the auditor's summary to the stream it's given
+	using audit_func = std::function<media_auditor::summary (std::size_t, driver_enumerator &, media_auditor &, std::ostream &)>;
+	using report_func = std::function<void (std::size_t, media_auditor::summary, std::string_view)>;
+
+	parallel_auditor(emu_options &options)
+		: m_options(options)
+		, m_queue(osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_IO))
+	{
+	}
+
+	~parallel_auditor()
+	{
+		if (m_queue)
+			osd_work_queue_free(m_queue);
+	}
+
+	void run(std::size_t count, audit_func const &audit, report_func const &report)
+	{
+		for (std::size_t base = 0; count > base; base += BATCH_SIZE)
+		{
+			// queue a batch, running jobs inline for a single item or if queueing fails
+			std::vector<job> jobs(std::min(BATCH_SIZE, count - base));
+			for (std::size_t i = 0; jobs.size() > i; ++i)
+			{
+				job &j(jobs[i]);
+				j.host = this;
+				j.audit = &audit;
+				j.index = base + i;
+				if (m_queue && (1U < count))
+					j.item = osd_work_item_queue(m_queue, &parallel_auditor::run_job, &j, 0);
+				if (!j.item)
+					run_job(&j, 0);
+			}
+
+			// collect results in order as they finish
+			for (job &j : jobs)
+			{
+				if (j.item)
+				{
+					while (!osd_work_item_wait(j.item, osd_ticks_per_second()))
+						;
+					osd_work_item_release(j.item);
+					j.item = nullptr;
+				}
+			}
+			for (job &j : jobs)
+			{
+				if (j.error)
+					std::rethrow_exception(j.error);
+				report(j.index, j.summary, std::string_view(j.report.vec().data(), j.report.vec().size()));
+			}
+		}
+	}
+
+private:
+	static constexpr std::size_t BATCH_SIZE = 256;
+
+	struct job
+	{
+		parallel_auditor *      host = nullptr;
+		audit_func const *      audit = nullptr;
+		std::size_t             index = 0;
+		osd_work_item *         item = nullptr;
+		media_auditor::summary  summary = media_auditor::NOTFOUND;
+		util::ovectorstream     report;
+		std::exception_ptr      error;
+	};
+
+	static void *run_job(void *param, int threadid)
+	{
+		job &j(*reinterpret_cast<job *>(param));
+		try
+		{
+			driver_enumerator drivlist(j.host->m_options);
+			media_auditor auditor(drivlist);
+			j.summary = (*j.audit)(j.index, drivlist, auditor, j.report);
+		}
+		catch (...)
+		{
+			j.error = std::current_exception();
+		}
+		return nullptr;
+	}
+
+	emu_options &       m_options;
+	osd_work_queue *    m_queue;
+};
+
+
+void audit_software_list(
+		parallel_auditor &auditors, software_list_device &swlistdev,
+		unsigned &correct, unsigned &incorrect, unsigned &notfound)
+{
+	std::vector<software_info const *> const items = [&swlistdev] ()
+	{
+		std::vector<software_info const *> result;
+		for (software_info const &swinfo : swlistdev.get_info())
+			result.emplace_back(&swinfo);
+		return result;
+	}();
+
+	auditors.run(
+			items.size(),
+			[&swlistdev, &items] (std::size_t index, driver_enumerator &enumerator, media_auditor &auditor, std::ostream &report)
+			{
+				media_auditor::summary const summary = auditor.audit_software(swlistdev, *items[index], AUDIT_VALIDATE_FAST);
+				auditor.summarize(util::string_format("%s:%s", swlistdev.list_name(), items[index]->shortname()).c_str(), &report);
+				return summary;
+			},
+			[&swlistdev, &items, &correct, &incorrect, &notfound] (std::size_t index, media_auditor::summary summary, std::string_view report)
+			{
+				print_summary(
+						report, summary, false,
+						"rom", util::string_format("%s:%s", swlistdev.list_name(), items[index]->shortname()).c_str(), nullptr,
+						correct, incorrect, notfound);
+			});
+}
+
 } // anonymous namespace
 
 
@@ -245,8 +399,9 @@ void cli_frontend::start_execution(mame_machine_manager *manager, const std::vec
 	std::string_view exename = core_filename_extract_base(args[0], true);
 
 	// if we have a command, execute that
-	if (!m_options.command().empty())
+	if (!m_options.command().empty() && (m_options.command() != CLICOMMAND_RUNBATCH))
 	{
+		hash_cache::set_global(m_options.hash_cache());
 		execute_commands(exename);
 		return;
 	}
@@ -257,6 +412,7 @@ void cli_frontend::start_execution(mame_machine_manager *manager, const std::vec
 		mame_options::parse_standard_inis(m_options, option_errors);
 		m_osd.set_verbose(m_options.verbose());
 	}
+	hash_cache::set_global(m_options.hash_cache());
 
 	// otherwise, check for a valid system
 	load_translation(m_options);
@@ -268,6 +424,13 @@ void cli_frontend::start_execution(mame_machine_manager *manager, const std::vec
 	if (option_errors.tellp() > 0)
 		osd_printf_error("Error in command line:\n%s\n", strtrimspace(option_errors.str()));
 
+	// a batch runs systems from its own list rather than the command line
+	if (m_options.command() == CLICOMMAND_RUNBATCH)
+	{
+		run_batch(manager, m_options.command_arguments());
+		return;
+	}
+
 	// if we can't find it, give an appropriate error
 	const game_driver *system = mame_options::system(m_options);
 	if (system == nullptr && *(m_options.system_name()) != 0)
@@ -991,23 +1154,14 @@ void cli_frontend::verifyroms(const std::vector<std::string> &args)
 	unsigned incorrect = 0;
 	unsigned notfound = 0;
 
-	// iterate over drivers
+	// find the matching drivers
 	driver_enumerator drivlist(m_options);
-	media_auditor auditor(drivlist);
-	util::ovectorstream summary_string;
+	std::vector<int> drivers;
 	while (drivlist.next())
 	{
 		if (included(drivlist.driver().name))
 		{
-			// audit the ROMs in this set
-			media_auditor::summary summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
-
-			auto const clone_of = drivlist.clone();
-			print_summary(
-					auditor, summary, true,
-					"rom", drivlist.driver().name, (clone_of >= 0) ? drivlist.driver(clone_of).name : nullptr,
-					correct, incorrect, notfound,
-					summary_string);
+			drivers.emplace_back(drivlist.current());
 
 			// if it wasn't a wildcard, there can only be one
 			if (!iswild)
@@ -1015,6 +1169,29 @@ void cli_frontend::verifyroms(const std::vector<std::string> &args)
 		}
 	}
 
+	// audit the ROMs in each set
+	parallel_auditor auditors(m_options);
+	auditors.run(
+			drivers.size(),
+			[&drivers] (std::size_t index, driver_enumerator &enumerator, media_auditor &auditor, std::ostream &report)
+			{
+				enumerator.set_current(drivers[index]);
+				media_auditor::summary const summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
+				auditor.summarize(enumerator.driver().name, &report);
+				return summary;
+			},
+			[&drivers, &correct, &incorrect, &notfound] (std::size_t index, media_auditor::summary summary, std::string_view report)
+			{
+				auto const clone_of = driver_list::clone(drivers[index]);
+				print_summary(
+						report, summary, true,
+						"rom", driver_list::driver(drivers[index]).name, (clone_of >= 0) ? driver_list::driver(clone_of).name : nullptr,
+						correct, incorrect, notfound);
+			});
+
+	media_auditor auditor(drivlist);
+	util::ovectorstream summary_string;
+
 	if (iswild || !matchcount)
 	{
 		machine_config config(GAME_NAME(___empty), m_options);
@@ -1375,8 +1552,7 @@ void cli_frontend::verifysoftware(const std::vector<std::string> &args)
 	unsigned notfound = 0;
 	unsigned nrlists = 0;
 
-	media_auditor auditor(drivlist);
-	util::ovectorstream summary_string;
+	parallel_auditor auditors(m_options);
 	while (drivlist.next())
 	{
 		for (software_list_device &swlistdev : software_list_device_enumerator(drivlist.config()->root_device()))
@@ -1388,16 +1564,7 @@ void cli_frontend::verifysoftware(const std::vector<std::string> &args)
 					if (!swlistdev.get_info().empty())
 					{
 						nrlists++;
-						for (const software_info &swinfo : swlistdev.get_info())
-						{
-							media_auditor::summary summary = auditor.audit_software(swlistdev, swinfo, AUDIT_VALIDATE_FAST);
-
-							print_summary(
-									auditor, summary, false,
-									"rom", util::string_format("%s:%s", swlistdev.list_name(), swinfo.shortname()).c_str(), nullptr,
-									correct, incorrect, notfound,
-									summary_string);
-						}
+						audit_software_list(auditors, swlistdev, correct, incorrect, notfound);
 					}
 				}
 			}
@@ -1482,8 +1649,7 @@ void cli_frontend::verifysoftlist(const std::vector<std::string> &args)
 	unsigned matched = 0;
 
 	driver_enumerator drivlist(m_options);
-	media_auditor auditor(drivlist);
-	util::ovectorstream summary_string;
+	parallel_auditor auditors(m_options);
 
 	while (drivlist.next())
 	{
@@ -1496,16 +1662,7 @@ void cli_frontend::verifysoftlist(const std::vector<std::string> &args)
 					matched++;
 
 					// Get the actual software list contents
-					for (const software_info &swinfo : swlistdev.get_info())
-					{
-						media_auditor::summary summary = auditor.audit_software(swlistdev, swinfo, AUDIT_VALIDATE_FAST);
-
-						print_summary(
-								auditor, summary, false,
-								"rom", util::string_format("%s:%s", swlistdev.list_name(), swinfo.shortname()).c_str(), nullptr,
-								correct, incorrect, notfound,
-								summary_string);
-					}
+					audit_software_list(auditors, swlistdev, correct, incorrect, notfound);
 				}
 			}
 		}
@@ -1715,6 +1872,125 @@ const cli_frontend::info_command_struct *cli_frontend::find_command(const std::s
 }
 
 
+//-------------------------------------------------
+//  run_batch - run each system matching the
+//  given patterns, optionally spread across
+//  forked worker processes
+//-------------------------------------------------
+
+void cli_frontend::run_batch(mame_machine_manager *manager, const std::vector<std::string> &args)
+{
+	// gather the systems up front so every worker sees the same list
+	std::vector<std::string> systems;
+	driver_enumerator drivlist(m_options);
+	while (drivlist.next())
+	{
+		char const *const name = drivlist.driver().name;
+		if (args.empty() || std::any_of(args.begin(), args.end(), [name] (std::string const &pat) { return !core_strwildcmp(pat, name); }))
+			systems.emplace_back(name);
+	}
+	if (systems.empty())
+		throw emu_fatalerror(EMU_ERR_NO_SUCH_SYSTEM, "No matching systems found");
+
+	unsigned const jobs = std::clamp<int>(m_options.int_value(CLIOPTION_BATCHJOBS), 1, systems.size());
+#if defined(MAME_CLIFRONT_FORK_BATCH)
+	if (jobs > 1)
+	{
+		// everything up to here is shared with the workers through fork
+		std::fflush(stdout);
+		std::fflush(stderr);
+		std::vector<pid_t> workers;
+		for (unsigned job = 0; job < jobs; job++)
+		{
+			pid_t const pid = fork();
+			if (pid == 0)
+			{
+				// worker: run every jobs'th system, then leave without running the parent's cleanup
+				int const result = run_batch_systems(manager, systems, job, jobs);
+				std::fflush(stdout);
+				std::fflush(stderr);
+				_exit(result);
+			}
+			else if (pid < 0)
+			{
+				// couldn't start a worker; run its share here instead
+				osd_printf_warning("Couldn't start batch worker, running its systems in this process\n");
+				int const result = run_batch_systems(manager, systems, job, jobs);
+				if (m_result == EMU_ERR_NONE)
+					m_result = result;
+			}
+			else
+			{
+				workers.emplace_back(pid);
+			}
+		}
+
+		// collect the workers, keeping the first failure
+		for (pid_t pid : workers)
+		{
+			int status;
+			while ((waitpid(pid, &status, 0) < 0) && (errno == EINTR)) { }
+			int const result = WIFEXITED(status) ? WEXITSTATUS(status) : EMU_ERR_FATALERROR;
+			if (m_result == EMU_ERR_NONE)
+				m_result = result;
+		}
+		return;
+	}
+#endif
+
+	// run them all in this process
+	m_result = run_batch_systems(manager, systems, 0, 1);
+}
+
+
+//-------------------------------------------------
+//  run_batch_systems - run every step'th system
+//  starting from first, returning the first
+//  failure
+//-------------------------------------------------
+
+int cli_frontend::run_batch_systems(mame_machine_manager *manager, const std::vector<std::string> &systems, unsigned first, unsigned step)
+{
+	int result = EMU_ERR_NONE;
+	for (size_t index = first; index < systems.size(); index += step)
+	{
+		std::string const &name = systems[index];
+		int error;
+		try
+		{
+			m_options.set_system_name(name);
+			error = manager->execute();
+		}
+		catch (emu_fatalerror &fatal)
+		{
+			osd_printf_error("%s: %s\n", name, strtrimspace(fatal.what()));
+			error = (fatal.exitcode() != 0) ? fatal.exitcode() : EMU_ERR_FATALERROR;
+		}
+		catch (std::exception &ex)
+		{
+			osd_printf_error("%s: caught unhandled %s exception: %s\n", name, typeid(ex).name(), ex.what());
+			error = EMU_ERR_FATALERROR;
+		}
+		catch (...)
+		{
+			osd_printf_error("%s: caught unhandled exception\n", name);
+			error = EMU_ERR_FATALERROR;
+		}
+
+		// one line per system so the results can be collected from the output
+		osd_printf_info("%-16s %d\n", name, error);
+		if (result == EMU_ERR_NONE)
+			result = error;
+
+		// leave nothing from this system behind for the next one
+		m_options.set_system_name("");
+		m_options.set_value(OPTION_BIOS, "", OPTION_PRIORITY_CMDLINE);
+		util::archive_file::cache_clear();
+	}
+	return result;
+}
+
+
 //-------------------------------------------------
 //  execute_commands - execute various frontend
 //  commands
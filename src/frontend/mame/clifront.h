@@ -75,6 +75,8 @@ private:
 	void display_help(std::string_view exename);
 	void output_single_softlist(std::ostream &out, software_list_device &swlist);
 	void start_execution(mame_machine_manager *manager, const std::vector<std::string> &args);
+	void run_batch(mame_machine_manager *manager, const std::vector<std::string> &args);
+	int run_batch_systems(mame_machine_manager *manager, const std::vector<std::string> &systems, unsigned first, unsigned step);
 	static const info_command_struct *find_command(const std::string &s);
 
 	// internal state
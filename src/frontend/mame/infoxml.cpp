@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cstring>
 #include <future>
 #include <locale>
@@ -106,6 +107,7 @@ using device_type_set = std::set<std::add_pointer_t<device_type>, device_type_co
 using device_type_vector = std::vector<std::add_pointer_t<device_type> >;
 
 // internal helper
+template <typename T> bool task_ready(std::future<T> const &task, bool can_queue_more);
 void output_header(std::ostream &out, bool dtd);
 void output_footer(std::ostream &out);
 
@@ -507,7 +509,7 @@ void info_xml_creator::output(std::ostream &out, const std::function<bool(const
 	// waiting on the task in the front of the queue
 	std::atomic<unsigned int> active_task_count = 0;
 	unsigned int const maximum_active_task_count = std::thread::hardware_concurrency() + 10;
-	unsigned int const maximum_outstanding_task_count = maximum_active_task_count + 20;
+	unsigned int const maximum_outstanding_task_count = maximum_active_task_count * 4;
 
 	// loop until we're done enumerating drivers, and until there are no outstanding tasks
 	while (!filtered_drivlist.done() || !tasks.empty())
@@ -550,6 +552,10 @@ void info_xml_creator::output(std::ostream &out, const std::function<bool(const
 		// we've put as many outstanding tasks out as we can; are there any tasks outstanding?
 		if (!tasks.empty())
 		{
+			// if the oldest task is slow, go back and start more as others finish rather than idling
+			if (!filtered_drivlist.done() && !task_ready(tasks.front(), tasks.size() < maximum_outstanding_task_count))
+				continue;
+
 			// wait for the oldest task to complete and get the info, in the spirit of determinism
 			prepared_info pi = tasks.front().get();
 			tasks.pop();
@@ -637,6 +643,21 @@ std::vector<std::reference_wrapper<const game_driver> > filtered_driver_enumerat
 }
 
 
+//-------------------------------------------------
+//  task_ready - wait for a task to finish, but
+//  only briefly if there's room to queue more
+//  work in the meantime
+//-------------------------------------------------
+
+template <typename T>
+bool task_ready(std::future<T> const &task, bool can_queue_more)
+{
+	if (!can_queue_more)
+		return true;
+	return task.wait_for(std::chrono::milliseconds(1)) == std::future_status::ready;
+}
+
+
 //-------------------------------------------------
 //  output_header - print the XML DTD and open
 //  the root element
@@ -881,7 +902,7 @@ void output_devices(std::ostream &out, emu_options &lookup_options, device_type_
 				std::queue<std::future<std::string> > tasks;
 				std::atomic<unsigned int> active_task_count = 0;
 				unsigned int const maximum_active_task_count = std::thread::hardware_concurrency() + 10;
-				unsigned int const maximum_outstanding_task_count = maximum_active_task_count + 20;
+				unsigned int const maximum_outstanding_task_count = maximum_active_task_count * 4;
 
 				// loop until we're done enumerating devices and there are no outstanding tasks
 				auto it = std::begin(types);
@@ -939,6 +960,10 @@ void output_devices(std::ostream &out, emu_options &lookup_options, device_type_
 					// we've put as many outstanding tasks out as we can; are there any tasks outstanding?
 					if (!tasks.empty())
 					{
+						// if the oldest task is slow, go back and start more as others finish rather than idling
+						if ((std::end(types) != it) && !task_ready(tasks.front(), tasks.size() < maximum_outstanding_task_count))
+							continue;
+
 						// wait for the oldest task to complete and get the info, in the spirit of determinism
 						std::string snippet = tasks.front().get();
 						tasks.pop();
@@ -605,13 +605,65 @@ size_t lua_engine::enumerate_functions(const char *id, T &&callback)
 	return count;
 }
 
+size_t lua_engine::profile_index(sol::protected_function const &func, char const *hook)
+{
+	// functions are identified by their Lua object, which stays alive while registered
+	func.push(m_lua_state);
+	void const *const key = lua_topointer(m_lua_state, -1);
+	auto const found = m_profile_index.find(std::make_pair(key, hook));
+	if (found != m_profile_index.end())
+	{
+		lua_pop(m_lua_state, 1);
+		return found->second;
+	}
+
+	lua_Debug ar;
+	lua_getinfo(m_lua_state, ">S", &ar);
+	callback_profile &entry = m_profiles.emplace_back();
+	entry.source = util::string_format("%s:%d", ar.short_src, ar.linedefined);
+	entry.hook = hook;
+	m_profile_index.emplace(std::make_pair(key, hook), m_profiles.size() - 1);
+	return m_profiles.size() - 1;
+}
+
+std::string lua_engine::callback_profile_text() const
+{
+	std::vector<callback_profile const *> sorted;
+	for (callback_profile const &entry : m_profiles)
+		if (entry.calls)
+			sorted.emplace_back(&entry);
+	if (sorted.empty())
+		return std::string();
+	std::sort(
+			sorted.begin(),
+			sorted.end(),
+			[] (callback_profile const *a, callback_profile const *b) { return a->total > b->total; });
+
+	double const us = 1'000'000.0 / double(osd_ticks_per_second());
+	std::ostringstream text;
+	text << "Lua callbacks (total ms, average us, peak us, calls)\n";
+	for (callback_profile const *entry : sorted)
+	{
+		util::stream_format(
+				text,
+				"%9.3f %9.1f %9.1f %8u  %s %s\n",
+				double(entry->total) * us / 1000.0,
+				double(entry->total) * us / double(entry->calls),
+				double(entry->peak) * us,
+				entry->calls,
+				entry->hook,
+				entry->source);
+	}
+	return std::move(text).str();
+}
+
 bool lua_engine::execute_function(const char *id)
 {
 	size_t count = enumerate_functions(
 			id,
-			[this] (const sol::protected_function &func)
+			[this, id] (const sol::protected_function &func)
 			{
-				auto ret = invoke(func);
+				auto ret = invoke_profiled(profile_index(func, id), func);
 				if (!ret.valid())
 				{
 					sol::error err = ret;
@@ -656,6 +708,20 @@ void lua_engine::on_machine_stop()
 
 	m_notifiers->on_stop();
 	execute_function("LUA_ON_STOP");
+
+	// report and reset callback timing
+	if (machine().options().lua_profile())
+	{
+		std::string const text = callback_profile_text();
+		if (!text.empty())
+			osd_printf_info("%s", text);
+	}
+	for (callback_profile &entry : m_profiles)
+	{
+		entry.calls = 0;
+		entry.total = 0;
+		entry.peak = 0;
+	}
 }
 
 void lua_engine::on_machine_before_load_settings()
@@ -760,10 +826,11 @@ void lua_engine::attach_notifiers()
 void lua_engine::initialize()
 {
 
-	static const enum_parser<movie_recording::format, 2> s_movie_recording_format_parser =
+	static const enum_parser<movie_recording::format, 3> s_movie_recording_format_parser =
 	{
 		{ "avi", movie_recording::format::AVI },
-		{ "mng", movie_recording::format::MNG }
+		{ "mng", movie_recording::format::MNG },
+		{ "raw", movie_recording::format::RAW }
 	};
 
 
@@ -1455,6 +1522,11 @@ void lua_engine::initialize()
 	machine_type["paused"] = sol::property(&running_machine::paused);
 	machine_type["exit_pending"] = sol::property(&running_machine::exit_pending);
 	machine_type["hard_reset_pending"] = sol::property(&running_machine::hard_reset_pending);
+	machine_type["timeslices"] = sol::property([] (running_machine &m) { return m.scheduler().timeslice_count(); });
+	machine_type["timers_fired"] = sol::property([] (running_machine &m) { return m.scheduler().timer_fire_count(); });
+	machine_type["host_timing"] = sol::property(
+			[] (running_machine &m) { return m.scheduler().host_timing(); },
+			[] (running_machine &m, bool enable) { m.scheduler().set_host_timing(enable); });
 	machine_type["devices"] = sol::property([] (running_machine &m) { return devenum<device_enumerator>(m.root_device()); });
 	machine_type["palettes"] = sol::property([] (running_machine &m) { return devenum<palette_interface_enumerator>(m.root_device()); });
 	machine_type["screens"] = sol::property([] (running_machine &m) { return devenum<screen_device_enumerator>(m.root_device()); });
@@ -1555,6 +1627,23 @@ void lua_engine::initialize()
 					return sol::lua_nil;
 				return sol::make_object(s, device_state_entries(*state));
 			});
+	device_type["schedstats"] = sol::property(
+			[this] (device_t &dev) -> sol::object
+			{
+				device_execute_interface const *exec;
+				if (!dev.interface(exec))
+					return sol::lua_nil;
+				sol::table table = sol().create_table();
+				table["timeslices"] = exec->timeslice_count();
+				table["cycles"] = exec->total_cycles();
+				table["abort_explicit"] = exec->abort_count(ABORT_REASON_EXPLICIT);
+				table["abort_trigger"] = exec->abort_count(ABORT_REASON_TRIGGER);
+				table["abort_suspend"] = exec->abort_count(ABORT_REASON_SUSPEND);
+				table["abort_timer"] = exec->abort_count(ABORT_REASON_TIMER);
+				table["minimum_quantum"] = exec->minimum_quantum_time();
+				table["host_seconds"] = double(exec->host_ticks()) / double(osd_ticks_per_second());
+				return table;
+			});
 	// FIXME: turn into a wrapper - it's stupid slow to walk on every property access
 	// also, this mixes up things like RAM areas with stuff saved by the device itself, so there's potential for key conflicts
 	device_type["items"] = sol::property(
@@ -2035,6 +2124,25 @@ void lua_engine::initialize()
 			luaL_pushresultsize(&buff, size);
 			return sol::make_reference(s, sol::stack_reference(s, -1));
 		};
+	video_type["frame_timings"] =
+		[this] (video_manager &vm)
+		{
+			sol::table result = sol().create_table();
+			for (u32 index = 0; vm.frame_timing_count() > index; index++)
+			{
+				video_manager::frame_timing const &entry = vm.frame_timing_entry(index);
+				sol::table timing = sol().create_table();
+				timing["emutime"] = entry.emutime;
+				timing["emulate"] = entry.emulate;
+				timing["render"] = entry.render;
+				timing["throttle"] = entry.throttle;
+				timing["present"] = entry.present;
+				timing["latency"] = entry.latency;
+				timing["sound_fill"] = entry.sound_fill;
+				result[index + 1] = timing;
+			}
+			return result;
+		};
 	video_type["speed_factor"] = sol::property(&video_manager::speed_factor);
 	video_type["throttled"] = sol::property(&video_manager::throttled, &video_manager::set_throttled);
 	video_type["throttle_rate"] = sol::property(&video_manager::throttle_rate, &video_manager::set_throttle_rate);
@@ -2178,6 +2286,8 @@ bool lua_engine::frame_hook()
 void lua_engine::close()
 {
 	m_notifiers.reset();
+	m_profiles.clear();
+	m_profile_index.clear();
 	m_menu.clear();
 	m_update_tasks.clear();
 	m_frame_tasks.clear();
@@ -55,6 +55,18 @@ public:
 
 	bool frame_hook();
 
+	// time spent in each registered callback
+	struct callback_profile
+	{
+		std::string source;     // where the function was defined
+		char const *hook;       // what the function was registered for
+		u64 calls = 0;
+		osd_ticks_t total = 0;
+		osd_ticks_t peak = 0;
+	};
+	std::vector<callback_profile> const &callback_profiles() const { return m_profiles; }
+	std::string callback_profile_text() const;
+
 	std::optional<long> menu_populate(const std::string &menu, std::vector<std::tuple<std::string, std::string, std::string> > &menu_list, std::string &flags);
 	std::pair<bool, std::optional<long> > menu_callback(const std::string &menu, int index, const std::string &event);
 
@@ -133,6 +145,19 @@ public:
 		return cr(std::forward<Params>(args)...);
 	}
 
+	template <typename Func, typename... Params>
+	sol::protected_function_result invoke_profiled(size_t profile, Func &&func, Params&&... args)
+	{
+		osd_ticks_t const start = osd_ticks();
+		auto result = invoke(std::forward<Func>(func), std::forward<Params>(args)...);
+		osd_ticks_t const elapsed = osd_ticks() - start;
+		callback_profile &entry = m_profiles[profile];
+		entry.calls++;
+		entry.total += elapsed;
+		entry.peak = std::max(entry.peak, elapsed);
+		return result;
+	}
+
 	template <typename Func, typename... Params>
 	static auto invoke_direct(Func &&func, Params&&... args)
 	{
@@ -180,6 +205,10 @@ private:
 	std::vector<int> m_update_tasks;
 	std::vector<int> m_frame_tasks;
 
+	// callback timing
+	std::vector<callback_profile> m_profiles;
+	std::map<std::pair<void const *, char const *>, size_t> m_profile_index;
+
 	template <typename... T>
 	auto make_notifier_adder(util::notifier<T...> &notifier, const char *desc);
 	template <typename T, typename D, typename R, typename... A>
@@ -201,6 +230,7 @@ private:
 	template <typename T> size_t enumerate_functions(const char *id, T &&callback);
 	bool execute_function(const char *id);
 	sol::object call_plugin(const std::string &name, sol::object in);
+	size_t profile_index(sol::protected_function const &func, char const *hook);
 
 	void close();
 
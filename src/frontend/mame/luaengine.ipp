@@ -587,9 +587,9 @@ auto lua_engine::make_notifier_adder(util::notifier<T...> &notifier, const char
 		{
 			return notifier.subscribe(
 					delegate<void (T...)>(
-						[this, desc, cbfunc = sol::protected_function(m_lua_state, cb)] (T... args)
+						[this, desc, profile = profile_index(cb, desc), cbfunc = sol::protected_function(m_lua_state, cb)] (T... args)
 						{
-							auto status(invoke(cbfunc, std::forward<T>(args)...));
+							auto status(invoke_profiled(profile, cbfunc, std::forward<T>(args)...));
 							if (!status.valid())
 							{
 								auto err(status.template get<sol::error>());
@@ -120,6 +120,49 @@ void share_write(memory_share &share, offs_t address, T val)
 	}
 }
 
+//-------------------------------------------------
+//  ram_view - read-only view of host memory that
+//  is read in place; offsets are in bytes and
+//  values are assembled like share readers
+//  -> manager:machine():memory().shares[":ram"]:view():read_u16(0x10)
+//-------------------------------------------------
+
+struct ram_view
+{
+	ram_view(u8 const *b, offs_t l, offs_t m, endianness_t e) : base(b), length(l), lowmask(m), endianness(e) { }
+
+	u8 byte(offs_t addr) const
+	{
+		if (endianness == ENDIANNESS_BIG)
+			return base[(BYTE8_XOR_BE(addr) & lowmask) | (addr & ~lowmask)];
+		else
+			return base[(BYTE8_XOR_LE(addr) & lowmask) | (addr & ~lowmask)];
+	}
+
+	template <typename T>
+	T read(offs_t address) const
+	{
+		T mem_content = 0;
+		for (int i = 0; i < sizeof(T); i++)
+		{
+			offs_t addr = (endianness == ENDIANNESS_LITTLE) ? (address + sizeof(T) - 1 - i) : (address + i);
+			if (addr < length)
+			{
+				if constexpr (sizeof(T) > 1)
+					mem_content <<= 8;
+				mem_content |= byte(addr);
+			}
+		}
+
+		return mem_content;
+	}
+
+	u8 const *base;
+	offs_t length;
+	offs_t lowmask;
+	endianness_t endianness;
+};
+
 } // anonymous namespace
 
 
@@ -647,6 +690,100 @@ void lua_engine::initialize_memory(sol::table &emu)
 				luaL_pushresultsize(&buff, byte_count);
 				return sol::make_reference(s, sol::stack_reference(s, -1));
 			});
+	addr_space_type.set_function("write_range",
+			[] (addr_space &sp, sol::this_state s, u64 first, std::string_view data, int width, sol::object opt_step)
+			{
+				u64 step = 1;
+				if (opt_step.is<u64>())
+				{
+					step = opt_step.as<u64>();
+					if (step < 1)
+					{
+						luaL_error(s, "Invalid step");
+						return;
+					}
+				}
+
+				if (first > sp.space.addrmask())
+				{
+					luaL_error(s, "Invalid offset");
+					return;
+				}
+
+				char const *src = data.data();
+				switch (width)
+				{
+				case 8:
+					for (size_t count = data.size(); count; count--, first += step, src++)
+						sp.mem_write<u8>(first, *src);
+					break;
+				case 16:
+					for (size_t count = data.size() / 2; count; count--, first += step, src += 2)
+					{
+						u16 value;
+						std::memcpy(&value, src, sizeof(value));
+						sp.mem_write<u16>(first, value);
+					}
+					break;
+				case 32:
+					for (size_t count = data.size() / 4; count; count--, first += step, src += 4)
+					{
+						u32 value;
+						std::memcpy(&value, src, sizeof(value));
+						sp.mem_write<u32>(first, value);
+					}
+					break;
+				case 64:
+					for (size_t count = data.size() / 8; count; count--, first += step, src += 8)
+					{
+						u64 value;
+						std::memcpy(&value, src, sizeof(value));
+						sp.mem_write<u64>(first, value);
+					}
+					break;
+				default:
+					luaL_error(s, "Invalid width. Must be 8/16/32/64");
+					break;
+				}
+			});
+	addr_space_type.set_function("read_direct_range",
+			[] (addr_space &sp, sol::this_state s, offs_t address, offs_t length)
+			{
+				buffer_helper buf(s);
+				auto space = buf.prepare(length);
+				u8 *const dest = reinterpret_cast<u8 *>(space.get());
+				for (offs_t i = 0; i < length; i++)
+					dest[i] = sp.direct_mem_read<u8>(address + i);
+				space.add(length);
+				buf.push();
+				return sol::make_reference(s, sol::stack_reference(s, -1));
+			});
+	addr_space_type.set_function("write_direct_range",
+			[] (addr_space &sp, offs_t address, std::string_view data)
+			{
+				for (size_t i = 0; i < data.size(); i++)
+					sp.direct_mem_write<u8>(address + i, u8(data[i]));
+			});
+	addr_space_type.set_function("view",
+			[] (addr_space &sp, offs_t first, offs_t last) -> std::optional<ram_view>
+			{
+				// only a single run of host memory addressed in bytes can be viewed
+				offs_t const lowmask = sp.space.data_width() / 8 - 1;
+				if (sp.space.addr_shift() || (last < first) || (first & lowmask) || ((last + 1) & lowmask))
+					return std::nullopt;
+				u8 const *const base = reinterpret_cast<u8 const *>(sp.space.get_read_ptr(first));
+				if (!base)
+					return std::nullopt;
+				offs_t const length = last - first + 1;
+				for (offs_t offset = 0x100; offset < length; offset += 0x100)
+				{
+					if (reinterpret_cast<u8 const *>(sp.space.get_read_ptr(first + offset)) != (base + offset))
+						return std::nullopt;
+				}
+				if (reinterpret_cast<u8 const *>(sp.space.get_read_ptr(last & ~lowmask)) != (base + ((last & ~lowmask) - first)))
+					return std::nullopt;
+				return ram_view(base, length, lowmask, sp.space.endianness());
+			});
 	addr_space_type.set_function("add_change_notifier",
 			[this] (addr_space &sp, sol::protected_function &&cb)
 			{
@@ -678,6 +815,57 @@ void lua_engine::initialize_memory(sol::table &emu)
 			{
 				return std::make_unique<tap_helper>(*this, sp.space, read_or_write::WRITE, start, end, std::move(name), std::move(cb));
 			});
+	addr_space_type.set_function("heatmap_enable", [] (addr_space &sp, bool enable) { sp.space.set_heatmap_enabled(enable); });
+	addr_space_type.set_function("heatmap_clear",
+			[] (addr_space &sp)
+			{
+				if (sp.space.heatmap())
+					sp.space.heatmap()->reset();
+			});
+	addr_space_type["heatmap"] = sol::property(
+			[] (addr_space &sp, sol::this_state s) -> sol::object
+			{
+				memory_heatmap const *const heatmap = sp.space.heatmap();
+				if (!heatmap)
+					return sol::lua_nil;
+
+				sol::state_view lua(s);
+				auto const handlers =
+					[&lua] (std::vector<memory_heatmap::handler_count> const &counts)
+					{
+						sol::table result = lua.create_table();
+						int i = 1;
+						for (memory_heatmap::handler_count const &handler : counts)
+						{
+							if (!handler.count)
+								continue;
+							sol::table entry = lua.create_table();
+							entry["address_start"] = handler.start;
+							entry["address_end"] = handler.end;
+							entry["name"] = handler.name;
+							entry["count"] = handler.count;
+							result[i++] = entry;
+						}
+						return result;
+					};
+				auto const pages =
+					[&lua, heatmap] (std::vector<u64> const &counts)
+					{
+						sol::table result = lua.create_table();
+						for (offs_t page = 0; page != counts.size(); page++)
+							if (counts[page])
+								result[page << heatmap->page_shift()] = counts[page];
+						return result;
+					};
+
+				sol::table result = lua.create_table();
+				result["page_size"] = offs_t(1) << heatmap->page_shift();
+				result["read_handlers"] = handlers(heatmap->handler_reads());
+				result["write_handlers"] = handlers(heatmap->handler_writes());
+				result["read_pages"] = pages(heatmap->page_reads());
+				result["write_pages"] = pages(heatmap->page_writes());
+				return result;
+			});
 	addr_space_type["name"] = sol::property([] (addr_space &sp) { return sp.space.name(); });
 	addr_space_type["shift"] = sol::property([] (addr_space &sp) { return sp.space.addr_shift(); });
 	addr_space_type["index"] = sol::property([] (addr_space &sp) { return sp.space.spacenum(); });
@@ -751,6 +939,20 @@ void lua_engine::initialize_memory(sol::table &emu)
 				buf.push();
 				return sol::make_reference(s, sol::stack_reference(s, -1));
 			});
+	region_type.set_function(
+			"write",
+			[] (memory_region &region, offs_t offset, std::string_view data)
+			{
+				const offs_t limit = std::min<offs_t>(region.bytes(), offset + data.size());
+				if (limit > offset)
+					std::memcpy(&region.as_u8(offset), data.data(), limit - offset);
+			});
+	region_type.set_function(
+			"view",
+			[] (memory_region &region)
+			{
+				return ram_view(region.base(), region.bytes(), region.bytewidth() - 1, region.endianness());
+			});
 	region_type.set_function("read_i8", &region_read<s8>);
 	region_type.set_function("read_u8", &region_read<u8>);
 	region_type.set_function("read_i16", &region_read<s16>);
@@ -776,6 +978,34 @@ void lua_engine::initialize_memory(sol::table &emu)
 
 
 	auto share_type = sol().registry().new_usertype<memory_share>("share", sol::no_constructor);
+	share_type.set_function(
+			"read",
+			[] (memory_share &share, sol::this_state s, offs_t offset, offs_t length)
+			{
+				buffer_helper buf(s);
+				const offs_t limit = std::min<offs_t>(share.bytes(), offset + length);
+				const offs_t copyable = (limit > offset) ? (limit - offset) : 0;
+				auto space = buf.prepare(copyable);
+				if (copyable)
+					std::memcpy(space.get(), reinterpret_cast<u8 const *>(share.ptr()) + offset, copyable);
+				space.add(copyable);
+				buf.push();
+				return sol::make_reference(s, sol::stack_reference(s, -1));
+			});
+	share_type.set_function(
+			"write",
+			[] (memory_share &share, offs_t offset, std::string_view data)
+			{
+				const offs_t limit = std::min<offs_t>(share.bytes(), offset + data.size());
+				if (limit > offset)
+					std::memcpy(reinterpret_cast<u8 *>(share.ptr()) + offset, data.data(), limit - offset);
+			});
+	share_type.set_function(
+			"view",
+			[] (memory_share &share)
+			{
+				return ram_view(reinterpret_cast<u8 const *>(share.ptr()), share.bytes(), share.bytewidth() - 1, share.endianness());
+			});
 	share_type.set_function("read_i8", &share_read<s8>);
 	share_type.set_function("read_u8", &share_read<u8>);
 	share_type.set_function("read_i16", &share_read<s16>);
@@ -799,4 +1029,36 @@ void lua_engine::initialize_memory(sol::table &emu)
 	share_type["bitwidth"] = sol::property(&memory_share::bitwidth);
 	share_type["bytewidth"] = sol::property(&memory_share::bytewidth);
 
+
+
+	auto view_type = sol().registry().new_usertype<ram_view>("memview", sol::no_constructor);
+	view_type.set_function(
+			"read",
+			[] (ram_view &view, sol::this_state s, offs_t offset, offs_t length)
+			{
+				buffer_helper buf(s);
+				const offs_t limit = std::min<offs_t>(view.length, offset + length);
+				const offs_t copyable = (limit > offset) ? (limit - offset) : 0;
+				auto space = buf.prepare(copyable);
+				u8 *const dest = reinterpret_cast<u8 *>(space.get());
+				if (!view.lowmask)
+					std::memcpy(dest, view.base + offset, copyable);
+				else
+					for (offs_t i = 0; i < copyable; i++)
+						dest[i] = view.byte(offset + i);
+				space.add(copyable);
+				buf.push();
+				return sol::make_reference(s, sol::stack_reference(s, -1));
+			});
+	view_type.set_function("read_i8", &ram_view::read<s8>);
+	view_type.set_function("read_u8", &ram_view::read<u8>);
+	view_type.set_function("read_i16", &ram_view::read<s16>);
+	view_type.set_function("read_u16", &ram_view::read<u16>);
+	view_type.set_function("read_i32", &ram_view::read<s32>);
+	view_type.set_function("read_u32", &ram_view::read<u32>);
+	view_type.set_function("read_i64", &ram_view::read<s64>);
+	view_type.set_function("read_u64", &ram_view::read<u64>);
+	view_type["size"] = sol::property([] (ram_view &v) { return v.length; });
+	view_type["endianness"] = sol::property([] (ram_view &v) { return v.endianness; });
+
 }
@@ -58,26 +58,36 @@ void mame_options::parse_standard_inis(emu_options &options, std::ostream &error
 		else
 			parse_one_ini(options, "horizont", OPTION_PRIORITY_ORIENTATION_INI, &error_stream);
 
-		machine_config config(*cursystem, options);
-		for (const screen_device &device : screen_device_enumerator(config.root_device()))
+		// instantiating the machine configuration is expensive, so only look
+		// at its screens if there's a screen type INI that could apply
+		auto const ini_exists = [&options] (const char *basename)
 		{
-			// parse "raster.ini" for raster games
-			if (device.screen_type() == SCREEN_TYPE_RASTER)
-			{
-				parse_one_ini(options, "raster", OPTION_PRIORITY_SCREEN_INI, &error_stream);
-				break;
-			}
-			// parse "vector.ini" for vector games
-			if (device.screen_type() == SCREEN_TYPE_VECTOR)
-			{
-				parse_one_ini(options, "vector", OPTION_PRIORITY_SCREEN_INI, &error_stream);
-				break;
-			}
-			// parse "lcd.ini" for lcd games
-			if (device.screen_type() == SCREEN_TYPE_LCD)
+			emu_file file(options.ini_path(), OPEN_FLAG_READ);
+			return !file.open(std::string(basename) + ".ini");
+		};
+		if (options.read_config() && (ini_exists("raster") || ini_exists("vector") || ini_exists("lcd")))
+		{
+			machine_config config(*cursystem, options);
+			for (const screen_device &device : screen_device_enumerator(config.root_device()))
 			{
-				parse_one_ini(options, "lcd", OPTION_PRIORITY_SCREEN_INI, &error_stream);
-				break;
+				// parse "raster.ini" for raster games
+				if (device.screen_type() == SCREEN_TYPE_RASTER)
+				{
+					parse_one_ini(options, "raster", OPTION_PRIORITY_SCREEN_INI, &error_stream);
+					break;
+				}
+				// parse "vector.ini" for vector games
+				if (device.screen_type() == SCREEN_TYPE_VECTOR)
+				{
+					parse_one_ini(options, "vector", OPTION_PRIORITY_SCREEN_INI, &error_stream);
+					break;
+				}
+				// parse "lcd.ini" for lcd games
+				if (device.screen_type() == SCREEN_TYPE_LCD)
+				{
+					parse_one_ini(options, "lcd", OPTION_PRIORITY_SCREEN_INI, &error_stream);
+					break;
+				}
 			}
 		}
 	}
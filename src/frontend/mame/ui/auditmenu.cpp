@@ -163,6 +163,7 @@ bool menu_audit::handle(event const *ev)
 				m_phase = phase::AUDIT;
 				m_fast = ITEMREF_START_FAST == ev->itemref;
 				m_prompt = util::string_format(_("Press %1$s to cancel\n"), ui().get_general_input_setting(IPT_UI_BACK));
+				emu_file::cache_clear();
 				m_future.resize(std::thread::hardware_concurrency());
 				for (auto &future : m_future)
 					future = std::async(std::launch::async, [this] () { return do_audit(); });
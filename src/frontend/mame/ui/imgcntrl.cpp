@@ -19,6 +19,7 @@
 #include "audit.h"
 #include "drivenum.h"
 #include "emuopts.h"
+#include "fileio.h"
 #include "image.h"
 #include "softlist_dev.h"
 
@@ -181,6 +182,7 @@ void menu_control_device_image::load_software_part()
 
 	driver_enumerator drivlist(machine().options(), machine().options().system_name());
 	drivlist.next();
+	emu_file::cache_clear();
 	media_auditor auditor(drivlist);
 	media_auditor::summary summary = auditor.audit_software(*m_sld, *m_swi, AUDIT_VALIDATE_FAST);
 	// if everything looks good, load software
@@ -585,7 +585,8 @@ bool menu_select_game::inkey_select(const event *menu_event)
 			}
 		}
 
-		// audit the system ROMs first to see if we're going to work
+		// audit the system ROMs first to see if we're going to work, noticing files added since the last attempt
+		emu_file::cache_clear();
 		media_auditor auditor(enumerator);
 		media_auditor::summary const summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
 
@@ -658,7 +659,8 @@ bool menu_select_game::inkey_select_favorite(const event *menu_event)
 			}
 		}
 
-		// audit the system ROMs first to see if we're going to work
+		// audit the system ROMs first to see if we're going to work, noticing files added since the last attempt
+		emu_file::cache_clear();
 		media_auditor auditor(enumerator);
 		media_auditor::summary const summary = auditor.audit_media(AUDIT_VALIDATE_FAST);
 
@@ -974,16 +976,21 @@ void menu_select_game::draw_left_panel(u32 flags)
 //-------------------------------------------------
 
 void menu_select_game::get_selection(ui_software_info const *&software, ui_system_info const *&system) const
+{
+	get_item_selection(get_selection_ptr(), software, system);
+}
+
+void menu_select_game::get_item_selection(void *ref, ui_software_info const *&software, ui_system_info const *&system) const
 {
 	if (m_populated_favorites)
 	{
-		software = reinterpret_cast<ui_software_info const *>(get_selection_ptr());
+		software = reinterpret_cast<ui_software_info const *>(ref);
 		system = software ? &m_persistent_data.systems()[driver_list::find(software->driver->name)] : nullptr;
 	}
 	else
 	{
 		software = nullptr;
-		system = reinterpret_cast<ui_system_info const *>(get_selection_ptr());
+		system = reinterpret_cast<ui_system_info const *>(ref);
 	}
 }
 
@@ -67,6 +67,7 @@ private:
 
 	// get selected software and/or driver
 	virtual void get_selection(ui_software_info const *&software, ui_system_info const *&system) const override;
+	virtual void get_item_selection(void *ref, ui_software_info const *&software, ui_system_info const *&system) const override;
 	virtual void show_config_menu(int index) override;
 	virtual bool accept_search() const override { return !isfavorite(); }
 
@@ -173,6 +173,59 @@ void load_driver_image(bitmap_argb32 &bitmap, emu_file &file, game_driver const
 	}
 }
 
+
+using artwork_load_func = std::function<void (bitmap_argb32 &, std::string const &)>;
+
+bool artwork_request(
+		ui_software_info const *software,
+		ui_system_info const *system,
+		std::string &key,
+		artwork_load_func &load)
+{
+	// everything the loader needs is captured by value since it runs on another thread
+	game_driver const *driver(nullptr);
+	if (software && (!software->startempty || !system))
+	{
+		if (software->startempty == 1)
+		{
+			// driver snapshot
+			driver = software->driver;
+		}
+		else
+		{
+			// first attempt from name list, second attempt from driver name + part name
+			std::string first(util::path_concat(software->listname, software->shortname));
+			std::string second(util::path_concat(software->driver->name + software->part, software->shortname));
+			key = first + '\n' + second;
+			load =
+					[first = std::move(first), second = std::move(second)] (bitmap_argb32 &bitmap, std::string const &searchpath)
+					{
+						emu_file snapfile(searchpath, OPEN_FLAG_READ);
+						load_image(bitmap, snapfile, first);
+						if (!bitmap.valid())
+							load_image(bitmap, snapfile, second);
+					};
+			return true;
+		}
+	}
+	else if (system)
+	{
+		driver = system->driver;
+	}
+
+	if (!driver)
+		return false;
+
+	key = driver->name;
+	load =
+			[driver] (bitmap_argb32 &bitmap, std::string const &searchpath)
+			{
+				emu_file snapfile(searchpath, OPEN_FLAG_READ);
+				load_driver_image(bitmap, snapfile, *driver);
+			};
+	return true;
+}
+
 } // anonymous namespace
 
 
@@ -231,6 +284,17 @@ menu_select_launch::system_flags::system_flags(machine_static_info const &info)
 }
 
 
+menu_select_launch::system_flags::system_flags(system_list::static_flags const &flags)
+	: m_machine_flags(flags.machine_flags)
+	, m_unemulated_features(flags.unemulated_features)
+	, m_imperfect_features(flags.imperfect_features)
+	, m_has_keyboard(flags.has_keyboard)
+	, m_has_analog(flags.has_analog)
+	, m_status_color(flags.status_color)
+{
+}
+
+
 void menu_select_launch::reselect_last::reset()
 {
 	s_driver.clear();
@@ -414,11 +478,104 @@ bool menu_select_launch::bios_selection::handle(event const *ev)
 }
 
 
+menu_select_launch::artwork_loader::artwork_loader()
+	: m_exit(false)
+	, m_decoded(MAX_DECODED)
+{
+}
+
+
+menu_select_launch::artwork_loader::~artwork_loader()
+{
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_exit = true;
+		m_condition.notify_all();
+	}
+	if (m_thread.joinable())
+		m_thread.join();
+}
+
+
+menu_select_launch::artwork_loader::bitmap_cptr menu_select_launch::artwork_loader::get(std::string const &key, load_func &&load, bool wanted)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+
+	// already decoded?
+	auto const found(m_decoded.find(key));
+	if (m_decoded.end() != found)
+		return found->second;
+
+#if defined(__EMSCRIPTEN__)
+	// no worker thread - decode wanted images immediately and skip prefetching
+	if (!wanted)
+		return nullptr;
+	auto bitmap(std::make_shared<bitmap_argb32>());
+	load(*bitmap);
+	return m_decoded.emplace(key, std::move(bitmap)).first->second;
+#else
+	// already queued? move it to the front if it's wanted now
+	auto const pending(std::find_if(m_pending.begin(), m_pending.end(), [&key] (auto const &job) { return job.first == key; }));
+	if (m_pending.end() != pending)
+	{
+		if (wanted && (m_pending.begin() != pending))
+		{
+			auto job(std::move(*pending));
+			m_pending.erase(pending);
+			m_pending.emplace_front(std::move(job));
+		}
+		return nullptr;
+	}
+
+	// queue it, dropping the stalest prefetches
+	if (wanted)
+		m_pending.emplace_front(key, std::move(load));
+	else
+		m_pending.emplace_back(key, std::move(load));
+	while (m_pending.size() > MAX_PENDING)
+		m_pending.pop_back();
+
+	if (!m_thread.joinable())
+		m_thread = std::thread([this] () { worker(); });
+	m_condition.notify_one();
+	return nullptr;
+#endif
+}
+
+
+void menu_select_launch::artwork_loader::worker()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true)
+	{
+		m_condition.wait(lock, [this] () { return m_exit || !m_pending.empty(); });
+		if (m_exit)
+			return;
+
+		// decode without holding the lock so the UI thread can keep queueing
+		std::pair<std::string, load_func> job(std::move(m_pending.front()));
+		m_pending.pop_front();
+		lock.unlock();
+		auto bitmap(std::make_shared<bitmap_argb32>());
+		try
+		{
+			job.second(*bitmap);
+		}
+		catch (...)
+		{
+			bitmap->reset();
+		}
+		lock.lock();
+		m_decoded.emplace(std::move(job.first), std::move(bitmap));
+	}
+}
+
+
 menu_select_launch::cache::cache(running_machine &machine)
 	: m_snapx_bitmap(std::make_unique<bitmap_argb32>(0, 0))
 	, m_snapx_texture(nullptr, machine.render())
-	, m_snapx_driver(nullptr)
-	, m_snapx_software(nullptr)
+	, m_snapx_key()
+	, m_artwork()
 	, m_no_avail_bitmap(256, 256)
 	, m_toolbar_bitmaps()
 	, m_toolbar_textures()
@@ -502,6 +659,7 @@ void menu_select_launch::cache::cache_toolbar(running_machine &machine, float wi
 
 menu_select_launch::~menu_select_launch()
 {
+	system_list::instance().save_static_flags(ui().options());
 }
 
 
@@ -705,10 +863,26 @@ menu_select_launch::system_flags const &menu_select_launch::get_system_flags(gam
 	if (m_flags.end() != found)
 		return found->second;
 
+	// try the persistent cache before building a machine configuration
+	system_list &persistent(system_list::instance());
+	int const index(driver_list::find(driver));
+	system_list::static_flags const *const cached(persistent.find_static_flags(ui().options(), index));
+	if (cached)
+		return m_flags.emplace(&driver, *cached).first->second;
+
 	// aggregate flags
 	emu_options clean_options;
 	machine_config const mconfig(driver, clean_options);
-	return m_flags.emplace(&driver, machine_static_info(ui().options(), mconfig)).first->second;
+	machine_static_info const info(ui().options(), mconfig);
+	system_list::static_flags flags;
+	flags.machine_flags = info.machine_flags();
+	flags.unemulated_features = info.unemulated_features();
+	flags.imperfect_features = info.imperfect_features();
+	flags.has_keyboard = info.has_keyboard();
+	flags.has_analog = info.has_analog();
+	flags.status_color = info.status_color();
+	persistent.add_static_flags(index, flags);
+	return m_flags.emplace(&driver, flags).first->second;
 }
 
 
@@ -788,8 +962,7 @@ void menu_select_launch::recompute_metrics(uint32_t width, uint32_t height, floa
 	m_pointer_action = pointer_action::NONE;
 
 	// force right panel images to be redrawn
-	m_cache.set_snapx_driver(nullptr);
-	m_cache.set_snapx_software(nullptr);
+	m_cache.reset_snapx();
 }
 
 
@@ -3646,53 +3819,65 @@ void menu_select_launch::arts_render(u32 flags)
 	ui_system_info const *system;
 	get_selection(software, system);
 
-	if (software && (!software->startempty || !system))
+	std::string key;
+	artwork_load_func load;
+	if (artwork_request(software, system, key, load))
 	{
-		m_cache.set_snapx_driver(nullptr);
+		key = util::string_format("%u\n%s", m_image_view, key);
 
 		// loads the image if necessary
-		if (!m_cache.snapx_software_is(software) || !snapx_valid() || m_switch_image)
+		if (!m_cache.snapx_is(key) || !snapx_valid() || m_switch_image)
 		{
-			emu_file snapfile(get_arts_searchpath(), OPEN_FLAG_READ);
-			bitmap_argb32 tmp_bitmap;
-
-			if (software->startempty == 1)
+			std::string const searchpath(get_arts_searchpath());
+			artwork_loader::bitmap_cptr const image(m_cache.artwork().get(
+					searchpath + '\n' + key,
+					[searchpath, load = std::move(load)] (bitmap_argb32 &bitmap) { load(bitmap, searchpath); },
+					true));
+			if (image)
 			{
-				// Load driver snapshot
-				load_driver_image(tmp_bitmap, snapfile, *software->driver);
+				bitmap_argb32 tmp_bitmap;
+				if (image->valid())
+				{
+					tmp_bitmap.allocate(image->width(), image->height());
+					for (int y = 0; y < image->height(); y++)
+						std::copy_n(&image->pix(y), image->width(), &tmp_bitmap.pix(y));
+				}
+
+				m_cache.set_snapx(std::move(key));
+				m_switch_image = false;
+				arts_render_images(std::move(tmp_bitmap));
 			}
 			else
 			{
-				// First attempt from name list
-				load_image(tmp_bitmap, snapfile, util::path_concat(software->listname, software->shortname));
-
-				// Second attempt from driver name + part name
-				if (!tmp_bitmap.valid())
-					load_image(tmp_bitmap, snapfile, util::path_concat(software->driver->name + software->part, software->shortname));
+				// still decoding - don't leave the previous selection's image up meanwhile
+				m_cache.reset_snapx();
+				m_cache.snapx_bitmap().reset();
 			}
 
-			m_cache.set_snapx_software(software);
-			m_switch_image = false;
-			arts_render_images(std::move(tmp_bitmap));
-		}
-
-		// if the image is available, loaded and valid, display it
-		draw_snapx();
-	}
-	else if (system)
-	{
-		m_cache.set_snapx_software(nullptr);
-
-		// loads the image if necessary
-		if (!m_cache.snapx_driver_is(system->driver) || !snapx_valid() || m_switch_image)
-		{
-			emu_file snapfile(get_arts_searchpath(), OPEN_FLAG_READ);
-			bitmap_argb32 tmp_bitmap;
-			load_driver_image(tmp_bitmap, snapfile, *system->driver);
-
-			m_cache.set_snapx_driver(system->driver);
-			m_switch_image = false;
-			arts_render_images(std::move(tmp_bitmap));
+			// get the neighbouring items decoding while this one is looked at
+			int const selected(selected_index());
+			for (int const offset : { 1, -1, 2, -2 })
+			{
+				int const index(selected + offset);
+				if ((0 > index) || (item_count() <= index))
+					continue;
+				void *const ref(item(index).ref());
+				if (uintptr_t(ref) <= m_skip_main_items)
+					continue;
+
+				ui_software_info const *nearby_software;
+				ui_system_info const *nearby_system;
+				get_item_selection(ref, nearby_software, nearby_system);
+				std::string nearby_key;
+				artwork_load_func nearby_load;
+				if (artwork_request(nearby_software, nearby_system, nearby_key, nearby_load))
+				{
+					m_cache.artwork().get(
+							util::string_format("%s\n%u\n%s", searchpath, m_image_view, nearby_key),
+							[searchpath, load = std::move(nearby_load)] (bitmap_argb32 &bitmap) { load(bitmap, searchpath); },
+							false);
+				}
+			}
 		}
 
 		// if the image is available, loaded and valid, display it
@@ -13,6 +13,7 @@
 #pragma once
 
 #include "ui/menu.h"
+#include "ui/systemlist.h"
 #include "ui/utils.h"
 
 #include "audit.h"
@@ -20,10 +21,16 @@
 #include "lrucache.h"
 
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <string>
 #include <string_view>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -82,6 +89,7 @@ protected:
 	{
 	public:
 		system_flags(machine_static_info const &info);
+		system_flags(system_list::static_flags const &flags);
 		system_flags(system_flags const &) = default;
 		system_flags(system_flags &&) = default;
 		system_flags &operator=(system_flags const &) = default;
@@ -223,6 +231,34 @@ private:
 	class software_parts;
 	class bios_selection;
 
+	// decodes right panel artwork on a worker thread so browsing doesn't wait for it
+	class artwork_loader
+	{
+	public:
+		using bitmap_cptr = std::shared_ptr<bitmap_argb32 const>;
+		using load_func = std::function<void (bitmap_argb32 &)>;
+
+		artwork_loader();
+		~artwork_loader();
+
+		// returns the decoded image if it's ready, or queues it - wanted images
+		// go to the front of the queue, prefetches to the back
+		bitmap_cptr get(std::string const &key, load_func &&load, bool wanted);
+
+	private:
+		static constexpr std::size_t MAX_PENDING = 8;
+		static constexpr std::size_t MAX_DECODED = 16;
+
+		void worker();
+
+		std::mutex                                      m_mutex;
+		std::condition_variable                         m_condition;
+		std::thread                                     m_thread;
+		bool                                            m_exit;
+		std::deque<std::pair<std::string, load_func> >  m_pending;
+		util::lru_cache_map<std::string, bitmap_cptr>   m_decoded;
+	};
+
 	class cache
 	{
 	public:
@@ -231,10 +267,11 @@ private:
 
 		bitmap_argb32 &snapx_bitmap() { return *m_snapx_bitmap; }
 		render_texture *snapx_texture() { return m_snapx_texture.get(); }
-		bool snapx_driver_is(game_driver const *value) const { return m_snapx_driver == value; }
-		bool snapx_software_is(ui_software_info const *software) const { return m_snapx_software == software; }
-		void set_snapx_driver(game_driver const *value) { m_snapx_driver = value; }
-		void set_snapx_software(ui_software_info const *software) { m_snapx_software = software; }
+		bool snapx_is(std::string const &key) const { return m_snapx_key == key; }
+		void set_snapx(std::string &&key) { m_snapx_key = std::move(key); }
+		void reset_snapx() { m_snapx_key.clear(); }
+
+		artwork_loader &artwork() { return m_artwork; }
 
 		bitmap_argb32 &no_avail_bitmap() { return m_no_avail_bitmap; }
 
@@ -246,8 +283,8 @@ private:
 	private:
 		bitmap_ptr              m_snapx_bitmap;
 		texture_ptr             m_snapx_texture;
-		game_driver const       *m_snapx_driver;
-		ui_software_info const  *m_snapx_software;
+		std::string             m_snapx_key;
+		artwork_loader          m_artwork;
 
 		bitmap_argb32           m_no_avail_bitmap;
 
@@ -303,8 +340,9 @@ private:
 	void infos_render(u32 flags);
 	void general_info(ui_system_info const *system, game_driver const &driver, std::string &buffer);
 
-	// get selected software and/or driver
+	// get selected software and/or driver, or those for another item
 	virtual void get_selection(ui_software_info const *&software, ui_system_info const *&system) const = 0;
+	virtual void get_item_selection(void *ref, ui_software_info const *&software, ui_system_info const *&system) const = 0;
 
 	// show configuration menu
 	virtual void show_config_menu(int index) = 0;
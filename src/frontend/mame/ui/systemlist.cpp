@@ -15,12 +15,15 @@
 
 #include "drivenum.h"
 #include "fileio.h"
+#include "main.h"
 
 #include "util/corestr.h"
+#include "util/multibyte.h"
 #include "util/unicode.h"
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <functional>
 #include <locale>
 #include <string_view>
@@ -28,6 +31,20 @@
 
 namespace ui {
 
+namespace {
+
+char const STATIC_FLAGS_MAGIC[8] = { 'M', 'A', 'M', 'E', 'S', 'Y', 'S', 'F' };
+constexpr u32 STATIC_FLAGS_FORMAT = 1;
+constexpr std::size_t STATIC_FLAGS_RECORD = 18; // valid, flags, unemulated, imperfect, input bits, colour
+
+std::string static_flags_filename()
+{
+	return std::string(emulator_info::get_configname()) + "_sysflags.bin";
+}
+
+} // anonymous namespace
+
+
 void system_list::cache_data(ui_options const &options)
 {
 	std::unique_lock<std::mutex> lock(m_mutex);
@@ -85,7 +102,115 @@ system_list::system_list()
 	: m_started(false)
 	, m_available(AVAIL_NONE)
 	, m_bios_count(0)
+	, m_static_flags_loaded(false)
+	, m_static_flags_dirty(false)
+{
+}
+
+
+system_list::static_flags const *system_list::find_static_flags(ui_options const &options, int index)
+{
+	if (!m_static_flags_loaded)
+		load_static_flags(options);
+
+	assert((0 <= index) && (m_static_flags.size() > unsigned(index)));
+	static_flags const &result(m_static_flags[index]);
+	return result.valid ? &result : nullptr;
+}
+
+
+void system_list::add_static_flags(int index, static_flags const &flags)
+{
+	assert(m_static_flags_loaded);
+	assert((0 <= index) && (m_static_flags.size() > unsigned(index)));
+	m_static_flags[index] = flags;
+	m_static_flags[index].valid = true;
+	m_static_flags_dirty = true;
+}
+
+
+void system_list::save_static_flags(ui_options const &options)
 {
+	if (!m_static_flags_dirty)
+		return;
+
+	// header identifies the exact build, since driver indices and flags change between builds
+	std::string_view const build(emulator_info::get_build_version());
+	std::vector<u8> data(sizeof(STATIC_FLAGS_MAGIC) + 12 + build.length() + (m_static_flags.size() * STATIC_FLAGS_RECORD));
+	u8 *dst(&data[0]);
+	std::memcpy(dst, STATIC_FLAGS_MAGIC, sizeof(STATIC_FLAGS_MAGIC));
+	dst += sizeof(STATIC_FLAGS_MAGIC);
+	put_u32le(dst, STATIC_FLAGS_FORMAT);
+	put_u32le(dst + 4, u32(build.length()));
+	std::memcpy(dst + 8, build.data(), build.length());
+	dst += 8 + build.length();
+	put_u32le(dst, u32(m_static_flags.size()));
+	dst += 4;
+	for (static_flags const &flags : m_static_flags)
+	{
+		dst[0] = flags.valid ? 1 : 0;
+		put_u32le(dst + 1, u32(flags.machine_flags));
+		put_u32le(dst + 5, u32(flags.unemulated_features));
+		put_u32le(dst + 9, u32(flags.imperfect_features));
+		dst[13] = (flags.has_keyboard ? 0x01 : 0x00) | (flags.has_analog ? 0x02 : 0x00);
+		put_u32le(dst + 14, u32(flags.status_color));
+		dst += STATIC_FLAGS_RECORD;
+	}
+
+	emu_file file(options.ui_path(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+	if (!file.open(static_flags_filename()))
+	{
+		if (file.write(&data[0], data.size()) == data.size())
+			m_static_flags_dirty = false;
+		file.close();
+	}
+}
+
+
+void system_list::load_static_flags(ui_options const &options)
+{
+	m_static_flags_loaded = true;
+	m_static_flags_dirty = false;
+	m_static_flags.clear();
+	m_static_flags.resize(driver_list::total());
+
+	emu_file file(options.ui_path(), OPEN_FLAG_READ);
+	if (file.open(static_flags_filename()))
+		return;
+
+	// read the whole thing - it's small
+	std::vector<u8> data;
+	data.resize(file.size());
+	if (data.empty() || (file.read(&data[0], data.size()) != data.size()))
+		return;
+
+	// check that it was written by this build for the same driver list
+	std::string_view const build(emulator_info::get_build_version());
+	std::size_t const header(sizeof(STATIC_FLAGS_MAGIC) + 12 + build.length());
+	if ((data.size() < header) ||
+			std::memcmp(&data[0], STATIC_FLAGS_MAGIC, sizeof(STATIC_FLAGS_MAGIC)) ||
+			(get_u32le(&data[8]) != STATIC_FLAGS_FORMAT) ||
+			(get_u32le(&data[12]) != build.length()) ||
+			std::memcmp(&data[16], build.data(), build.length()) ||
+			(get_u32le(&data[header - 4]) != m_static_flags.size()) ||
+			(data.size() != (header + (m_static_flags.size() * STATIC_FLAGS_RECORD))))
+	{
+		osd_printf_verbose("Discarding out-of-date system flags cache %s\n", file.fullpath());
+		return;
+	}
+
+	u8 const *src(&data[header]);
+	for (static_flags &flags : m_static_flags)
+	{
+		flags.valid = src[0] != 0;
+		flags.machine_flags = ::machine_flags::type(get_u32le(src + 1));
+		flags.unemulated_features = device_t::feature_type(get_u32le(src + 5));
+		flags.imperfect_features = device_t::feature_type(get_u32le(src + 9));
+		flags.has_keyboard = (src[13] & 0x01) != 0;
+		flags.has_analog = (src[13] & 0x02) != 0;
+		flags.status_color = rgb_t(get_u32le(src + 14));
+		src += STATIC_FLAGS_RECORD;
+	}
 }
 
 
@@ -46,6 +46,18 @@ public:
 		AVAIL_FILTER_DATA           = 1U << 8
 	};
 
+	// overall emulation status that otherwise needs a machine configuration
+	struct static_flags
+	{
+		bool                    valid = false;
+		::machine_flags::type   machine_flags = ::machine_flags::type(0);
+		device_t::feature_type  unemulated_features = device_t::feature::NONE;
+		device_t::feature_type  imperfect_features = device_t::feature::NONE;
+		bool                    has_keyboard = false;
+		bool                    has_analog = false;
+		rgb_t                   status_color;
+	};
+
 	using system_vector = std::vector<ui_system_info>;
 	using system_reference = std::reference_wrapper<ui_system_info>;
 	using system_reference_vector = std::vector<system_reference>;
@@ -91,6 +103,11 @@ public:
 		return m_filter_data;
 	}
 
+	// static flags are kept on disk between sessions and discarded when the build changes
+	static_flags const *find_static_flags(ui_options const &options, int index);
+	void add_static_flags(int index, static_flags const &flags);
+	void save_static_flags(ui_options const &options);
+
 	static system_list &instance();
 
 private:
@@ -102,6 +119,7 @@ private:
 	void populate_list(bool copydesc);
 	void load_titles(util::core_file &file);
 	void populate_parents();
+	void load_static_flags(ui_options const &options);
 
 	// synchronisation
 	std::mutex                      m_mutex;
@@ -115,6 +133,11 @@ private:
 	system_reference_vector         m_sorted_list;
 	machine_filter_data             m_filter_data;
 	int                             m_bios_count;
+
+	// persistent static flags, indexed by driver
+	std::vector<static_flags>       m_static_flags;
+	bool                            m_static_flags_loaded;
+	bool                            m_static_flags_dirty;
 };
 
 } // namespace ui
@@ -48,6 +48,7 @@
 #include "../osd/modules/lib/osdlib.h"
 #include "../osd/modules/lib/osdobj_common.h"
 
+#include <algorithm>
 #include <functional>
 #include <type_traits>
 
@@ -327,7 +328,9 @@ void mame_ui_manager::exit()
 	machine().render().texture_free(m_mouse_arrow_texture);
 	m_mouse_arrow_texture = nullptr;
 
-	// free the font
+	// free the font and the layouts that refer to it
+	m_text_layout_map.clear();
+	m_text_layouts.clear();
 	m_font.reset();
 
 	// free persistent data for other classes
@@ -1024,6 +1027,57 @@ void mame_ui_manager::draw_text(render_container &container, std::string_view bu
 //  and full size computation
 //-------------------------------------------------
 
+//-------------------------------------------------
+//  cached_text_layout - get a layout for a
+//  string; menus redraw the same items every
+//  frame, so recently used layouts are kept
+//  rather than measuring and wrapping each
+//  string again
+//-------------------------------------------------
+
+ui::text_layout &mame_ui_manager::cached_text_layout(
+		std::string_view text,
+		float xscale, float yscale, float width,
+		ui::text_layout::text_justify justify, ui::text_layout::word_wrapping wrap,
+		rgb_t fgcolor, rgb_t bgcolor)
+{
+	constexpr size_t MAX_CACHED_LAYOUTS = 256;
+
+	// the key is every input to the layout followed by the text itself
+	std::string key;
+	key.reserve(sizeof(float) * 3 + sizeof(u32) * 2 + 2 + text.length());
+	auto const append = [&key] (auto const &value) { key.append(reinterpret_cast<char const *>(&value), sizeof(value)); };
+	append(xscale);
+	append(yscale);
+	append(width);
+	append(u32(fgcolor));
+	append(u32(bgcolor));
+	key.push_back(char(justify));
+	key.push_back(char(wrap));
+	key.append(text);
+
+	// move a hit to the front so it is the last to be evicted
+	auto const found = m_text_layout_map.find(key);
+	if (m_text_layout_map.end() != found)
+	{
+		m_text_layouts.splice(m_text_layouts.begin(), m_text_layouts, found->second);
+		return found->second->second;
+	}
+
+	// otherwise lay it out and make room for it
+	if (m_text_layouts.size() >= MAX_CACHED_LAYOUTS)
+	{
+		m_text_layout_map.erase(m_text_layouts.back().first);
+		m_text_layouts.pop_back();
+	}
+	ui::text_layout layout(*get_font(), xscale, yscale, width, justify, wrap);
+	layout.add_text(text, fgcolor, bgcolor);
+	m_text_layouts.emplace_front(std::move(key), std::move(layout));
+	m_text_layout_map.emplace(m_text_layouts.front().first, m_text_layouts.begin());
+	return m_text_layouts.front().second;
+}
+
+
 void mame_ui_manager::draw_text_full(
 		render_container &container,
 		std::string_view origs,
@@ -1051,16 +1105,13 @@ void mame_ui_manager::draw_text_full(
 		float *totalwidth, float *totalheight,
 		float text_size)
 {
-	// create the layout
-	ui::text_layout layout(
-			*get_font(), machine().render().ui_aspect(&container) * text_size, text_size,
-			origwrapwidth, justify, wrap);
-
-	// append text to it
-	layout.add_text(
+	// get the layout, reusing it if the same text was laid out recently
+	ui::text_layout &layout(cached_text_layout(
 			origs,
+			machine().render().ui_aspect(&container) * text_size, text_size,
+			origwrapwidth, justify, wrap,
 			fgcolor,
-			(draw == OPAQUE_) ? bgcolor : rgb_t::transparent());
+			(draw == OPAQUE_) ? bgcolor : rgb_t::transparent()));
 
 	// and emit it (if we are asked to do so)
 	if (draw != NONE)
@@ -1400,12 +1451,42 @@ bool mame_ui_manager::can_paste()
 
 void mame_ui_manager::draw_fps_counter(render_container &container)
 {
+	float height;
 	draw_text_full(
 			container,
 			machine().video().speed_text(),
 			0.0f, 0.0f, 1.0f,
 			ui::text_layout::text_justify::RIGHT, ui::text_layout::word_wrapping::WORD,
-			OPAQUE_, rgb_t::white(), rgb_t::black(), nullptr, nullptr);
+			OPAQUE_, rgb_t::white(), rgb_t::black(), nullptr, &height);
+
+	// draw a histogram of recent frame times below the text, one bucket per millisecond
+	video_manager const &video = machine().video();
+	u32 const count = std::min<u32>(video.frame_timing_count(), 256);
+	if (!video.show_frame_timing() || !count)
+		return;
+
+	constexpr int BUCKETS = 50;
+	u32 buckets[BUCKETS] = { 0 };
+	for (u32 index = video.frame_timing_count() - count; video.frame_timing_count() > index; index++)
+	{
+		video_manager::frame_timing const &entry = video.frame_timing_entry(index);
+		u32 const frame = entry.emulate + entry.render + entry.throttle + entry.present;
+		buckets[std::min<u32>(frame / 1000, BUCKETS - 1)]++;
+	}
+	u32 const tallest = *std::max_element(std::begin(buckets), std::end(buckets));
+
+	float const x0 = 0.75f, x1 = 1.0f;
+	float const y0 = height, y1 = std::min(height + 0.1f, 1.0f);
+	float const barwidth = (x1 - x0) / BUCKETS;
+	container.add_rect(x0, y0, x1, y1, rgb_t(0xc0, 0x00, 0x00, 0x00), PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA));
+	for (int bucket = 0; BUCKETS > bucket; bucket++)
+	{
+		if (!buckets[bucket])
+			continue;
+		float const top = y1 - ((y1 - y0) * buckets[bucket] / tallest);
+		rgb_t const color = (BUCKETS - 1 == bucket) ? rgb_t(0xff, 0xff, 0x40, 0x40) : rgb_t::white();
+		container.add_rect(x0 + (bucket * barwidth), top, x0 + ((bucket + 1) * barwidth), y1, color, PRIMFLAG_BLENDMODE(BLENDMODE_ALPHA));
+	}
 }
 
 
@@ -1415,7 +1496,8 @@ void mame_ui_manager::draw_fps_counter(render_container &container)
 
 void mame_ui_manager::draw_profiler(render_container &container)
 {
-	std::string_view text = g_profiler.text(machine());
+	std::string text(g_profiler.text(machine()));
+	text.append(mame_machine_manager::instance()->lua()->callback_profile_text());
 	draw_text_full(
 			container,
 			text,
@@ -29,6 +29,7 @@
 #include <chrono>
 #include <ctime>
 #include <functional>
+#include <list>
 #include <set>
 #include <string>
 #include <string_view>
@@ -252,6 +253,7 @@ public:
 
 	// metrics
 	void update_target_font_height();
+	ui::text_layout &cached_text_layout(std::string_view text, float xscale, float yscale, float width, ui::text_layout::text_justify justify, ui::text_layout::word_wrapping wrap, rgb_t fgcolor, rgb_t bgcolor);
 
 	// other
 	void process_ui_events();
@@ -290,9 +292,12 @@ private:
 	using active_pointer_vector = std::vector<active_pointer>;
 	using pointer_options_vector = std::vector<pointer_options>;
 	using display_pointer_vector = std::vector<display_pointer>;
+	using text_layout_list = std::list<std::pair<std::string, ui::text_layout> >;
 
 	// instance variables
 	std::unique_ptr<render_font> m_font;
+	text_layout_list        m_text_layouts;     // recently used layouts, most recent first
+	std::unordered_map<std::string_view, text_layout_list::iterator> m_text_layout_map;
 	handler_callback_func   m_handler_callback;
 	ui_callback_type        m_handler_callback_type;
 	bool                    m_ui_active;
@@ -199,6 +199,17 @@ cassette_image::error cassette_image::lookup_sample(int channel, size_t sample,
 
 
 
+int32_t cassette_image::peek_sample(int channel, size_t sample) const noexcept
+{
+	// reads never need to grow the waveform; missing blocks are silence
+	size_t sample_blocknum = (sample / SAMPLES_PER_BLOCK) * m_channels + channel;
+	if ((sample_blocknum >= m_blocks.size()) || !m_blocks[sample_blocknum])
+		return 0;
+	return m_blocks[sample_blocknum][sample % SAMPLES_PER_BLOCK];
+}
+
+
+
 cassette_image::cassette_image(const Format *format, util::random_read_write::ptr &&io, int flags) :
 	m_format(format),
 	m_io(std::move(io)),
@@ -409,7 +420,6 @@ cassette_image::error cassette_image::get_samples(int channel,
 {
 	error err;
 	manipulation_ranges ranges;
-	int32_t *source_ptr;
 
 	err = compute_manipulation_ranges(channel, time_index, sample_period, ranges);
 	if (err != error::SUCCESS)
@@ -424,11 +434,7 @@ cassette_image::error cassette_image::get_samples(int channel,
 			/* find the sample that we are putting */
 			double d = map_double(ranges.sample_last + 1 - ranges.sample_first, 0, sample_count, sample_index) + ranges.sample_first;
 			size_t cassette_sample_index = (size_t) d;
-			err = lookup_sample(channel, cassette_sample_index, source_ptr);
-			if (err != error::SUCCESS)
-				return err;
-
-			sum += *source_ptr;
+			sum += peek_sample(channel, cassette_sample_index);
 		}
 
 		/* average out the samples */
@@ -542,6 +548,13 @@ cassette_image::error cassette_image::put_samples(int channel,
 cassette_image::error cassette_image::get_sample(int channel,
 	double time_index, double sample_period, int32_t *sample)
 {
+	// instantaneous reads of one channel are what tape loading does most
+	if ((sample_period == 0.0) && (channel >= 0))
+	{
+		*sample = peek_sample(channel, my_round(time_index * m_sample_frequency));
+		return error::SUCCESS;
+	}
+
 	return get_samples(channel, time_index,
 			sample_period, 1, 0, sample, WAVEFORM_32BIT);
 }
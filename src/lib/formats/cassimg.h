@@ -207,6 +207,7 @@ private:
 	error perform_save();
 	error compute_manipulation_ranges(int channel, double time_index, double sample_period, manipulation_ranges &ranges) const;
 	error lookup_sample(int channel, size_t sample, int32_t *&ptr);
+	int32_t peek_sample(int channel, size_t sample) const noexcept;
 
 	const Format *m_format;
 	util::random_read_write::ptr m_io;
@@ -513,6 +513,7 @@ int floppy_image_format_t::calc_sector_index(int num, int interleave, int skew,
 void floppy_image_format_t::generate_track(const desc_e *desc, int track, int head, const desc_s *sect, int sect_count, int track_size, floppy_image &image)
 {
 	std::vector<uint32_t> buffer;
+	buffer.reserve(track_size);
 
 	gen_crc_info crcs[MAX_CRC_COUNT];
 	collect_crcs(desc, crcs);
@@ -858,6 +859,13 @@ void floppy_image_format_t::generate_track_from_bitstream(int track, int head, c
 	std::vector<uint32_t> &dest = image.get_buffer(track, head, subtrack);
 	dest.clear();
 
+	// size the buffer once rather than growing it a transition at a time
+	int transitions = 0;
+	for(int i=0; i != track_size; i++)
+		if(trackbuf[i >> 3] & (0x80 >> (i & 7)))
+			transitions++;
+	dest.reserve(transitions);
+
 	for(int i=0; i != track_size; i++)
 		if(trackbuf[i >> 3] & (0x80 >> (i & 7)))
 			dest.push_back(floppy_image::MG_F | (i*2+1));
@@ -878,6 +886,7 @@ void floppy_image_format_t::generate_track_from_levels(int track, int head, cons
 
 	std::vector<uint32_t> &dest = image.get_buffer(track, head);
 	dest.clear();
+	dest.reserve(std::count_if(trackbuf.begin(), trackbuf.end(), [] (uint32_t elem) { return (elem & floppy_image::MG_MASK) != MG_0; }));
 
 	uint32_t total_time = 0;
 	for(auto & elem : trackbuf) {
@@ -1821,6 +1830,7 @@ void floppy_image_format_t::build_wd_track_mfm(int track, int head, floppy_image
 void floppy_image_format_t::build_pc_track_fm(int track, int head, floppy_image &image, int cell_count, int sector_count, const desc_pc_sector *sects, int gap_3, int gap_4a, int gap_1, int gap_2)
 {
 	std::vector<uint32_t> track_data;
+	track_data.reserve(cell_count);
 
 	// gap 4a, IAM and gap 1
 	if(gap_4a != -1) {
@@ -1887,6 +1897,7 @@ void floppy_image_format_t::build_pc_track_fm(int track, int head, floppy_image
 void floppy_image_format_t::build_pc_track_mfm(int track, int head, floppy_image &image, int cell_count, int sector_count, const desc_pc_sector *sects, int gap_3, int gap_4a, int gap_1, int gap_2)
 {
 	std::vector<uint32_t> track_data;
+	track_data.reserve(cell_count);
 
 	// gap 4a, IAM and gap 1
 	if(gap_4a != -1) {
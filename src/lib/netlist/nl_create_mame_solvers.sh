@@ -1,14 +1,22 @@
 #!/bin/sh
 
+# Create static solvers for all netlists used by MAME drivers.
+#
+# Must be run from the MAME root directory. Use --check to verify the
+# shipped file is current without replacing it. Solvers whose topology
+# hash does not match at runtime fall back to the generic GCR code.
+
 GENERATED=src/lib/netlist/generated/static_solvers.cpp
 FILES=`find src/mame -name "nl_*.cpp" | grep -v pongdoubles`
 
 OUTDIR=/tmp/static_syms
 
-if [ _$OS = "_Windows_NT" ]; then
-	NLTOOL=./nltool.exe
-else
-	NLTOOL=./nltool
+if [ -z "${NLTOOL}" ]; then
+	if [ _$OS = "_Windows_NT" ]; then
+		NLTOOL=./nltool.exe
+	else
+		NLTOOL=./nltool
+	fi
 fi
 
 rm -rf ${OUTDIR}
@@ -17,8 +25,26 @@ mkdir ${OUTDIR}
 #--dir src/lib/netlist/generated/static --static-include
 
 if ${NLTOOL} --cmd static --output=${GENERATED}.tmp --include=src/mame/shared ${FILES} ; then
-	mv -f ${GENERATED}.tmp ${GENERATED}
-	echo Created ${GENERATED} file
+	if [ _$1 = "_--check" ]; then
+		# the order of the output follows the order of the input files, so
+		# only compare the symbols that are provided
+		grep -o '{"nl_gcr_[^"]*"' ${GENERATED}.tmp | sort > ${OUTDIR}/new.txt
+		grep -o '{"nl_gcr_[^"]*"' ${GENERATED} | sort > ${OUTDIR}/old.txt
+		if cmp -s ${OUTDIR}/new.txt ${OUTDIR}/old.txt ; then
+			rm -f ${GENERATED}.tmp
+			echo ${GENERATED} is up to date
+		else
+			rm -f ${GENERATED}.tmp
+			echo ${GENERATED} is out of date, please regenerate
+			diff ${OUTDIR}/old.txt ${OUTDIR}/new.txt
+			exit 1
+		fi
+	else
+		mv -f ${GENERATED}.tmp ${GENERATED}
+		echo Created ${GENERATED} file
+	fi
 else
+	rm -f ${GENERATED}.tmp
 	echo Failed to create ${GENERATED}
+	exit 1
 fi
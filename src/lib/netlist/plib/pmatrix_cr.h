@@ -297,43 +297,80 @@ namespace plib
 			return { fill_max, ops };
 		}
 
-		template <typename V>
-		void gaussian_elimination(V & RHS) noexcept
+		// The column searches done by gaussian elimination only depend on the
+		// matrix structure. Resolve them once after build_from_fill_mat so that
+		// each elimination step is a plain indexed multiply-add.
+		//
+		// For each row i and each row j below it, m_ge_ops holds the index of
+		// A(j,i), the row j, the number of updated elements n and n pairs of
+		// source A(i,k) and destination A(j,k) indices.
+		void build_gaussian_elimination_scheme()
 		{
 			const std::size_t iN = base_type::size();
 
-			for (std::size_t i = 0; i < iN - 1; i++)
+			m_ge_ops.clear();
+			for (std::size_t i = 0; i + 1 < iN; i++)
 			{
-				std::size_t nzbdp = 0;
-				std::size_t pi = base_type::diagonal[i];
-				auto f = reciprocal(base_type::A[pi++]);
+				const std::size_t pi = base_type::diagonal[i] + 1;
 				const std::size_t piie = base_type::row_idx[i+1];
 
 				const auto *nz = base_type::m_nzbd[i];
-				while (auto j = nz[nzbdp++]) // NOLINT(bugprone-infinite-loop)
+				for (std::size_t nzbdp = 0; nz[nzbdp] != 0; nzbdp++)
 				{
-					// proceed to column i
-
+					const std::size_t j = nz[nzbdp];
 					std::size_t pj = base_type::row_idx[j];
-					std::size_t pje = base_type::row_idx[j+1];
+					const std::size_t pje = base_type::row_idx[j+1];
 
 					while (base_type::col_idx[pj] < i)
 						pj++;
 
-					const typename base_type::value_type f1 = - base_type::A[pj++] * f;
+					m_ge_ops.push_back(narrow_cast<index_type>(pj++));
+					m_ge_ops.push_back(narrow_cast<index_type>(j));
+					const std::size_t count_pos = m_ge_ops.size();
+					m_ge_ops.push_back(0);
 
-					// subtract row i from j
 					// fill-in available assumed, i.e. matrix was prepared
-
+					std::size_t n = 0;
 					for (std::size_t pii = pi; pii<piie && pj < pje; pii++)
 					{
 						while (base_type::col_idx[pj] < base_type::col_idx[pii])
 							pj++;
 						if (base_type::col_idx[pj] == base_type::col_idx[pii])
-							base_type::A[pj++] += base_type::A[pii] * f1;
+						{
+							m_ge_ops.push_back(narrow_cast<index_type>(pii));
+							m_ge_ops.push_back(narrow_cast<index_type>(pj++));
+							n++;
+						}
 					}
+					m_ge_ops[count_pos] = narrow_cast<index_type>(n);
+				}
+			}
+		}
+
+		template <typename V>
+		void gaussian_elimination(V & RHS) noexcept
+		{
+			const std::size_t iN = base_type::size();
+			const index_type *op = m_ge_ops.data();
+			auto *const A = &base_type::A[0];
+
+			for (std::size_t i = 0; i < iN - 1; i++)
+			{
+				const auto f = reciprocal(A[base_type::diagonal[i]]);
+				const auto RHSi = RHS[i];
+
+				for (std::size_t e = base_type::nzbd_count(i); e-- > 0; )
+				{
+					const typename base_type::value_type f1 = - A[op[0]] * f;
+					const std::size_t j = op[1];
+					const std::size_t n = op[2];
+					op += 3;
+
+					// subtract row i from j
+					for (std::size_t k = 0; k < n; k++, op += 2)
+						A[op[1]] += A[op[0]] * f1;
 
-					RHS[j] += f1 * RHS[i];
+					RHS[j] += f1 * RHSi;
 				}
 			}
 		}
@@ -481,6 +518,7 @@ namespace plib
 			//  printf("%d %d\n", (int) k, (int) m_ge_par[k].size());
 		}
 		std::vector<std::vector<std::size_t>> m_ge_par; // parallel execution support for Gauss
+		std::vector<index_type> m_ge_ops;               // precomputed elimination steps, see build_gaussian_elimination_scheme
 	};
 
 	template<typename B>
@@ -14,8 +14,10 @@
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace plib {
 
@@ -83,6 +85,132 @@ namespace plib {
 		long m_count;
 	};
 
+	/// \brief pool of worker threads running a loop in parallel
+	///
+	/// for_each() distributes the indices of a loop over the workers and the
+	/// calling thread and returns once all of them have been processed, i.e.
+	/// every call is a barrier. Workers spin briefly between calls, since
+	/// the loops are typically run once per time step, and sleep when no
+	/// work arrives for a while.
+	///
+	class pworker_pool
+	{
+	public:
+		pworker_pool() noexcept = default;
+
+		pworker_pool(const pworker_pool& other) = delete;
+		pworker_pool& operator=(const pworker_pool& other) = delete;
+		pworker_pool(pworker_pool&& other) = delete;
+		pworker_pool& operator=(pworker_pool&& other) = delete;
+
+		~pworker_pool() { stop(); }
+
+		/// \brief start the pool
+		///
+		/// \param threads total number of threads including the caller
+		///
+		void start(std::size_t threads)
+		{
+			stop();
+			m_stop = false;
+			const unsigned generation = m_generation;
+			for (std::size_t i = 1; i < threads; i++)
+				m_workers.emplace_back([this, generation] { worker(generation); });
+		}
+
+		void stop()
+		{
+			if (m_workers.empty())
+				return;
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_stop = true;
+				m_generation++;
+			}
+			m_cv.notify_all();
+			for (auto &w : m_workers)
+				w.join();
+			m_workers.clear();
+		}
+
+		std::size_t threads() const noexcept { return m_workers.size() + 1; }
+
+		/// \brief call what(i) for every i in [0, count) and wait for completion
+		///
+		template <typename T>
+		void for_each(std::size_t count, const T &what)
+		{
+			if (m_workers.empty() || count < 2)
+			{
+				for (std::size_t i = 0; i < count; i++)
+					what(i);
+				return;
+			}
+
+			m_func = [](const void *ctx, std::size_t i) { (*static_cast<const T *>(ctx))(i); };
+			m_ctx = &what;
+			m_count = count;
+			m_next = 0;
+			m_active = m_workers.size();
+			m_generation++;
+			if (m_sleeping != 0)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_cv.notify_all();
+			}
+
+			run();
+			while (m_active != 0)
+				std::this_thread::yield();
+		}
+
+	private:
+		static constexpr unsigned SPIN_COUNT = 10000;
+
+		void run()
+		{
+			for (std::size_t i = m_next++; i < m_count; i = m_next++)
+				m_func(m_ctx, i);
+		}
+
+		void worker(unsigned seen)
+		{
+			while (true)
+			{
+				for (unsigned spin = 0; m_generation == seen && spin < SPIN_COUNT; spin++)
+					std::this_thread::yield();
+				if (m_generation == seen)
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_sleeping++;
+					m_cv.wait(lock, [this, seen] { return m_generation != seen; });
+					m_sleeping--;
+				}
+				seen = m_generation;
+				if (m_stop)
+					return;
+				run();
+				m_active--;
+			}
+		}
+
+		std::vector<std::thread> m_workers;
+		std::mutex m_mutex;
+		std::condition_variable m_cv;
+
+		void (*m_func)(const void *, std::size_t) = nullptr;
+		const void *m_ctx = nullptr;
+		std::size_t m_count = 0;
+		bool m_stop = false;
+
+		PALIGNAS_CACHELINE()
+		std::atomic<unsigned> m_generation = 0;
+		std::atomic<unsigned> m_sleeping = 0;
+		PALIGNAS_CACHELINE()
+		std::atomic<std::size_t> m_next = 0;
+		PALIGNAS_CACHELINE()
+		std::atomic<std::size_t> m_active = 0;
+	};
 
 } // namespace plib
 
@@ -103,8 +103,9 @@ namespace plib
 			result[i] += s * v[i];
 	}
 
+	// result and v must not overlap, which lets the compiler vectorize the loop
 	template<typename T>
-	void vec_add_mult_scalar_p(const std::size_t n, T * result, const T * v, T scalar) noexcept
+	void vec_add_mult_scalar_p(const std::size_t n, T * __restrict result, const T * __restrict v, T scalar) noexcept
 	{
 		for ( std::size_t i = 0; i < n; i++ )
 			result[i] += scalar * v[i];
@@ -89,6 +89,7 @@ public:
 		opt_ttr (*this,     "t", "time_to_run", 1,          "time to run the emulation (seconds)"),
 		opt_boost_lib(*this,  "",  "boost-lib", "builtin",   "generic: will use generic solvers.\nbuiltin: Use optimized solvers compiled in.\nsome_lib.so: Use library with precompiled solvers."),
 		opt_stats(*this,    "s", "statistics",              "gather runtime statistics"),
+		opt_profile(*this,  "",  "profile",     "",         "write per solver timing, iteration and matrix statistics in JSON format to the given file. Implies --statistics."),
 		opt_logs(*this,     "l", "log" ,                    "define terminal to log. This option may be specified repeatedly."),
 		opt_inp(*this,      "i", "input",       "",         "input file to process (default is none)"),
 		opt_load_state(*this,"", "load-state",   "",        "load state from file and continue from there"),
@@ -162,6 +163,7 @@ private:
 	plib::option_num<netlist::nl_fptype> opt_ttr;
 	plib::option_str    opt_boost_lib;
 	plib::option_bool   opt_stats;
+	plib::option_str    opt_profile;
 	plib::option_vec    opt_logs;
 	plib::option_str    opt_inp;
 	plib::option_str    opt_load_state;
@@ -201,6 +203,7 @@ private:
 	void run_with_progress(netlist_tool_t &nt, netlist::netlist_time_ext start, netlist::netlist_time_ext duration);
 
 	void run();
+	void write_profile(netlist_tool_t &nt, netlist::nl_fptype emulated, netlist::nl_fptype elapsed);
 	void validate();
 	void convert();
 
@@ -474,7 +477,7 @@ void tool_app_t::run()
 
 	netlist_tool_t nt(plib::plog_delegate(&tool_app_t::logger, this), "netlist", opt_boost_lib());
 
-	nt.exec().enable_stats(opt_stats());
+	nt.exec().enable_stats(opt_stats() || opt_profile.was_specified());
 
 	if (!opt_verb())
 		nt.log().verbose.set_enabled(false);
@@ -556,6 +559,54 @@ void tool_app_t::run()
 	std_out("{1:f} seconds emulation took {2:f} real time ==> {3:5.2f}%\n",
 			(duration - start).as_fp<netlist::nl_fptype>(), emulation_time,
 			(duration - start).as_fp<netlist::nl_fptype>() / emulation_time * netlist::nlconst::hundred());
+
+	if (opt_profile.was_specified())
+		write_profile(nt, (duration - start).as_fp<netlist::nl_fptype>(), emulation_time);
+}
+
+void tool_app_t::write_profile(netlist_tool_t &nt, netlist::nl_fptype emulated, netlist::nl_fptype elapsed)
+{
+	auto *solver = nt.exec().solver();
+	if (solver == nullptr)
+		throw netlist::nl_exception("nltool: netlist has no solver to profile");
+
+	plib::ofstream strm(plib::filesystem::u8path(opt_profile()));
+	if (strm.fail())
+		throw netlist::nl_exception(netlist::MF_FILE_OPEN_ERROR(opt_profile()));
+	strm.imbue(std::locale::classic());
+	plib::putf8_fmt_writer w(&strm);
+
+	// device names need no escaping; braces are written with write_line
+	// so they aren't taken for format specifiers
+	w.write_line("{");
+	w("\t\"netlist\": \"{1}\",\n", opt_files()[0]);
+	w("\t\"emulated_time\": {1},\n", emulated);
+	w("\t\"real_time\": {1},\n", elapsed);
+	w("\t\"solvers\": [\n");
+	const auto profile(solver->profile());
+	for (std::size_t i = 0; i < profile.size(); i++)
+	{
+		const auto &p = profile[i];
+		w.write_line("\t\t{");
+		w("\t\t\t\"name\": \"{1}\",\n", p.name);
+		w("\t\t\t\"nets\": {1},\n", p.nets);
+		w("\t\t\t\"dynamic_devices\": {1},\n", p.dynamic_devices);
+		w("\t\t\t\"time_step_devices\": {1},\n", p.time_step_devices);
+		w("\t\t\t\"static_solver\": {1},\n", p.static_solver ? "true" : "false");
+		w("\t\t\t\"total_time\": {1},\n", p.total_time);
+		w("\t\t\t\"calls\": {1},\n", p.calls);
+		w("\t\t\t\"calculations\": {1},\n", p.calculations);
+		w("\t\t\t\"newton_raphson_loops\": {1},\n", p.newton_raphson_loops);
+		w("\t\t\t\"newton_raphson_fails\": {1},\n", p.newton_raphson_fails);
+		w("\t\t\t\"time_step_reductions\": {1},\n", p.time_step_reductions);
+		w("\t\t\t\"iterative_total\": {1},\n", p.iterative_total);
+		w("\t\t\t\"iterative_fails\": {1},\n", p.iterative_fails);
+		w("\t\t\t\"non_zeros\": {1},\n", p.non_zeros);
+		w("\t\t\t\"non_zeros_eliminated\": {1}\n", p.non_zeros_eliminated);
+		w.write_line(pstring(i + 1 < profile.size() ? "\t\t}," : "\t\t}"));
+	}
+	w.write_line("\t]");
+	w.write_line("}");
 }
 
 void tool_app_t::validate()
@@ -71,6 +71,7 @@ namespace netlist::solver
 	, m_stat_newton_raphson(*this, "m_stat_newton_raphson", 0)
 	, m_stat_newton_raphson_fail(*this, "m_stat_newton_raphson_fail", 0)
 	, m_stat_vsolver_calls(*this, "m_stat_vsolver_calls", 0)
+	, m_stat_time_step_reductions(*this, "m_stat_time_step_reductions", 0)
 	, m_last_step(*this, "m_last_step", netlist_time_ext::zero())
 	, m_step_funcs(m_arena)
 	, m_dynamic_funcs(m_arena)
@@ -615,9 +616,14 @@ namespace netlist::solver
 		if (m_params.m_dynamic_ts)
 		{
 			if (time_step_device_count() > 0)
-				return compute_next_time_step(delta.as_fp<nl_fptype>(),
-											  m_params.m_min_time_step,
-											  m_params.m_max_time_step);
+			{
+				const netlist_time next_time_step = compute_next_time_step(
+					delta.as_fp<nl_fptype>(), m_params.m_min_time_step,
+					m_params.m_max_time_step);
+				if (next_time_step < delta)
+					++m_stat_time_step_reductions;
+				return next_time_step;
+			}
 		}
 
 		if (time_step_device_count() > 0)
@@ -759,4 +765,35 @@ namespace netlist::solver
 		}
 	}
 
+	solver_profile_t matrix_solver_t::profile() const
+	{
+		solver_profile_t p;
+		p.name = this->name();
+		p.nets = m_terms.size();
+		p.dynamic_devices = dynamic_device_count();
+		p.time_step_devices = time_step_device_count();
+		p.calls = m_stat_vsolver_calls;
+		p.calculations = m_stat_calculations;
+		p.newton_raphson_loops = m_stat_newton_raphson;
+		p.newton_raphson_fails = m_stat_newton_raphson_fail;
+		p.time_step_reductions = m_stat_time_step_reductions;
+		p.iterative_total = m_iterative_total;
+		p.iterative_fails = m_iterative_fail;
+
+		// elimination works on the diagonal and the elements right of and
+		// below it; the latter include fill-in
+		for (const auto &t : m_terms)
+		{
+			p.non_zeros += t.m_nz.size();
+			p.non_zeros_eliminated += 1 + t.m_nzbd.size();
+			for (const auto &j : t.m_nzrd)
+				if (j < m_terms.size())
+					p.non_zeros_eliminated++;
+		}
+
+		if (stats() != nullptr)
+			p.total_time = stats()->m_stat_total_time.as_seconds<double>();
+		return p;
+	}
+
 } // namespace netlist::solver
@@ -293,6 +293,29 @@ namespace netlist::solver
 									 // logic
 	};
 
+	/// \brief cumulative statistics of a solver
+	///
+	/// Times are only gathered if statistics are enabled.
+	///
+	struct solver_profile_t
+	{
+		pstring     name;
+		std::size_t nets = 0;
+		std::size_t dynamic_devices = 0;
+		std::size_t time_step_devices = 0;
+		std::size_t calls = 0;                //!< calls to solve
+		std::size_t calculations = 0;         //!< matrix solves
+		std::size_t newton_raphson_loops = 0; //!< total NR iterations
+		std::size_t newton_raphson_fails = 0; //!< solves exceeding NR_LOOPS
+		std::size_t time_step_reductions = 0; //!< next step shorter than the last
+		std::size_t iterative_total = 0;      //!< iterations of iterative solvers
+		std::size_t iterative_fails = 0;      //!< iterative solver fails
+		std::size_t non_zeros = 0;            //!< matrix elements before elimination
+		std::size_t non_zeros_eliminated = 0; //!< matrix elements including fill-in
+		bool        static_solver = false;    //!< uses a precompiled solver
+		double      total_time = 0.0;         //!< seconds spent solving
+	};
+
 	class matrix_solver_t : public device_t
 	{
 	public:
@@ -369,6 +392,8 @@ namespace netlist::solver
 
 		virtual void log_stats();
 
+		virtual solver_profile_t profile() const;
+
 		virtual std::pair<pstring, pstring> create_solver_code(
 			[[maybe_unused]] solver::static_compile_target target)
 		{
@@ -446,6 +471,7 @@ namespace netlist::solver
 		state_var<std::size_t> m_stat_newton_raphson;
 		state_var<std::size_t> m_stat_newton_raphson_fail;
 		state_var<std::size_t> m_stat_vsolver_calls;
+		state_var<std::size_t> m_stat_time_step_reductions;
 
 		state_var<netlist_time_ext>                     m_last_step;
 		plib::arena_vector<arena_type, nl_delegate_ts>  m_step_funcs;
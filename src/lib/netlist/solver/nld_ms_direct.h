@@ -66,17 +66,21 @@ namespace netlist::solver
 			for (std::size_t i = 0; i < kN; i++)
 			{
 				// FIXME: Singular matrix?
-				const auto &Ai = m_A[i];
+				const FT * __restrict Ai = &m_A[i][0];
 				const FT f = plib::reciprocal(Ai[i]);
 				const auto &nzrd = this->m_terms[i].m_nzrd;
 				const auto &nzbd = this->m_terms[i].m_nzbd;
+				const auto *const nzrdp = nzrd.data();
+				const std::size_t nzrde = nzrd.size();
 
+				// rows i and j never overlap, so the scattered update below
+				// can be vectorized on targets with gather/scatter support
 				for (auto &j : nzbd)
 				{
-					auto &Aj = m_A[j];
+					FT * __restrict Aj = &m_A[j][0];
 					const FT f1 = -f * Aj[i];
-					for (auto &k : nzrd)
-						Aj[k] += Ai[k] * f1;
+					for (std::size_t k = 0; k < nzrde; k++)
+						Aj[nzrdp[k]] += Ai[nzrdp[k]] * f1;
 					this->m_RHS[j] += this->m_RHS[i] * f1;
 				}
 			}
@@ -62,6 +62,7 @@ namespace netlist::solver
 			this->log_fill(fill, mat);
 
 			mat.build_from_fill_mat(fill);
+			mat.build_gaussian_elimination_scheme();
 
 			for (mat_index_type k=0; k<iN; k++)
 			{
@@ -110,6 +111,14 @@ namespace netlist::solver
 
 		std::pair<pstring, pstring> create_solver_code(static_compile_target target) override;
 
+		solver_profile_t profile() const override
+		{
+			auto p(base_type::profile());
+			p.non_zeros_eliminated = mat.nz_num;
+			p.static_solver = m_proc.resolved();
+			return p;
+		}
+
 	private:
 
 		using mat_index_type = typename plib::pmatrix_cr<arena_type, FT, SIZE>::index_type;
@@ -26,6 +26,7 @@
 #include "plib/ptimed_queue.h"
 
 #include <algorithm>
+#include <thread>
 #include <type_traits>
 
 namespace netlist::devices
@@ -75,12 +76,7 @@ namespace netlist::devices
 	NETLIB_HANDLER(solver, fb_step)
 	{
 		const netlist_time_ext now(exec().time());
-		const std::size_t      nthreads = m_params.m_parallel() < 2
-											  ? 1
-											  : std::min(
-											 static_cast<std::size_t>(
-												 m_params.m_parallel()),
-											 plib::omp::get_max_threads());
+		const std::size_t      nthreads = m_pool ? m_pool->threads() : 1;
 		const netlist_time_ext sched(
 			now
 			+ (nthreads <= 1 ? netlist_time_ext::zero()
@@ -104,10 +100,9 @@ namespace netlist::devices
 			m_queue.pop();
 		}
 
-		// FIXME: Disabled for now since parallel processing will decrease
-		// performance
-		//        for tested applications. More testing required here
-		if (true || nthreads < 2)
+		// Parallel processing is only enabled by the PARALLEL parameter,
+		// since it decreases performance for netlists with small groups.
+		if (nthreads < 2 || p < 2)
 		{
 			if (!KEEP_STATS)
 			{
@@ -135,10 +130,25 @@ namespace netlist::devices
 		}
 		else
 		{
-			plib::omp::set_num_threads(nthreads);
-			plib::omp::for_static(static_cast<std::size_t>(0), p,
-								  [&tmp, &nt, now](std::size_t i)
-								  { nt[i] = tmp[i]->solve(now, "parallel"); });
+			// solvers only touch the nets of their own group, so groups due
+			// at the same time can be solved concurrently; for_each returns
+			// once all of them are done
+			if constexpr (KEEP_STATS)
+				stats()->m_stat_total_time.stop();
+			m_pool->for_each(p,
+				[&tmp, &nt, now](std::size_t i)
+				{
+					if constexpr (KEEP_STATS)
+					{
+						tmp[i]->stats()->m_stat_call_count.inc();
+						auto g(tmp[i]->stats()->m_stat_total_time.guard());
+						nt[i] = tmp[i]->solve(now, "parallel");
+					}
+					else
+						nt[i] = tmp[i]->solve(now, "parallel");
+				});
+			if constexpr (KEEP_STATS)
+				stats()->m_stat_total_time.start();
 			for (std::size_t i = 0; i < p; i++)
 			{
 				if (nt[i] != netlist_time::zero())
@@ -573,6 +583,26 @@ namespace netlist::devices
 			m_mat_params.push_back(std::move(params));
 			m_mat_solvers.push_back(std::move(ms));
 		}
+
+		// worker threads for solving independent groups concurrently
+		const std::size_t nthreads = std::min<std::size_t>({
+			static_cast<std::size_t>(std::max(m_params.m_parallel(), 0)),
+			std::max<std::size_t>(std::thread::hardware_concurrency(), 1),
+			m_mat_solvers.size() });
+		if (nthreads > 1)
+		{
+			log().verbose("Solving {1} net groups on {2} threads", m_mat_solvers.size(), nthreads);
+			m_pool = std::make_unique<plib::pworker_pool>();
+			m_pool->start(nthreads);
+		}
+	}
+
+	std::vector<solver::solver_profile_t> NETLIB_NAME(solver)::profile() const
+	{
+		std::vector<solver::solver_profile_t> ret;
+		for (const auto &s : m_mat_solvers)
+			ret.push_back(s->profile());
+		return ret;
 	}
 
 	solver::static_compile_container NETLIB_NAME(solver)::create_solver_code(
@@ -14,6 +14,7 @@
 #include "core/logic.h"
 #include "core/state_var.h"
 
+#include "../plib/pmulti_threading.h"
 #include "../plib/pstream.h"
 
 #include <map>
@@ -55,6 +56,8 @@ namespace netlist::devices
 
 		void reschedule(solver::matrix_solver_t *solv, netlist_time ts);
 
+		std::vector<solver::solver_profile_t> profile() const;
+
 	private:
 		using params_uptr = solver_arena::unique_ptr<
 			solver::solver_parameters_t>;
@@ -72,6 +75,9 @@ namespace netlist::devices
 		solver::solver_parameters_t m_params;
 		queue_type                  m_queue;
 
+		// only allocated if PARALLEL asks for more than one thread
+		std::unique_ptr<plib::pworker_pool> m_pool;
+
 		template <typename FT, int SIZE>
 		solver_ptr create_solver(std::size_t size, const pstring &solver_name,
 								 const solver::solver_parameters_t *params,
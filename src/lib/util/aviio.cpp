@@ -19,9 +19,13 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <condition_variable>
 #include <cstdlib>
 #include <cstring>
+#include <deque>
 #include <iostream>
+#include <mutex>
+#include <thread>
 #include <utility>
 
 
@@ -66,6 +70,14 @@ static constexpr int SOUND_BUFFER_MSEC = 2000;      // milliseconds of sound buf
 
 static constexpr int AVI_INTEGRAL_MULTIPLE = 4;
 
+/**
+ * @def MAX_PENDING_WRITES
+ *
+ * @brief   Maximum number of appended frames or sound blocks queued for the background writer.
+ */
+
+static constexpr std::size_t MAX_PENDING_WRITES = 16;
+
 
 namespace {
 /***************************************************************************
@@ -282,10 +294,11 @@ public:
 		m_rootchunk.listtype = 0;
 	}
 
-	avi_file_impl(osd_file::ptr &&file, movie_info const &info) : avi_file_impl()
+	avi_file_impl(osd_file::ptr &&file, movie_info const &info, bool background) : avi_file_impl()
 	{
 		m_file = std::move(file);
 		m_type = FILETYPE_CREATE;
+		m_background = background;
 
 		// copy the movie info
 		m_info = info;
@@ -322,6 +335,7 @@ public:
 	error read_movie_data();
 	error write_initial_headers();
 	error soundbuf_initialize();
+	void start_writer();
 
 private:
 	enum : std::uint32_t
@@ -396,6 +410,9 @@ private:
 		, m_soundbuf_samples(0)
 		, m_soundbuf_chunks(0)
 		, m_soundbuf_frames(0)
+		, m_background(false)
+		, m_writer_exit(false)
+		, m_writer_error(error::NONE)
 	{
 		std::fill(std::begin(m_soundbuf_chansamples), std::end(m_soundbuf_chansamples), 0);
 	}
@@ -442,6 +459,22 @@ private:
 	error soundbuf_write_chunk(std::uint32_t framenum);
 	error soundbuf_flush(bool only_flush_full);
 
+	// media write helpers, called directly or from the background writer
+	error write_video_chunk(std::uint8_t const *data, std::uint32_t length);
+	error buffer_sound_samples(int channel, std::int16_t const *samples, std::uint32_t numsamples, std::uint32_t sampleskip);
+
+	// background writer helpers
+	struct pending_write
+	{
+		std::vector<std::uint8_t> data;         // packed video frame or sound samples
+		int                 channel;            // sound channel, or -1 for video
+		std::uint32_t       numsamples;         // number of sound samples
+	};
+	std::vector<std::uint8_t> acquire_buffer(std::uint32_t length);
+	error queue_write(std::vector<std::uint8_t> &&data, int channel, std::uint32_t numsamples);
+	void stop_writer();
+	void writer_thread();
+
 	// debugging
 	void display_chunk_recursive(avi_chunk const *chunk, int indent);
 
@@ -470,6 +503,17 @@ private:
 	std::uint32_t       m_soundbuf_chansamples[MAX_SOUND_CHANNELS]; // samples in buffer for each channel
 	std::uint32_t       m_soundbuf_chunks;      // number of chunks completed so far
 	std::uint32_t       m_soundbuf_frames;      // number of frames ahead of the video
+
+	// only used when writing in the background
+	bool                m_background;           // append calls are queued for the writer thread
+	std::thread         m_writer;               // thread that does chunk writes in order
+	std::mutex          m_writer_mutex;         // protects the remaining writer state
+	std::condition_variable m_writer_ready;     // signalled when a write is queued or on exit
+	std::condition_variable m_writer_space;     // signalled when a queued write completes
+	std::deque<pending_write> m_writer_queue;   // appends waiting to be written
+	std::vector<std::vector<std::uint8_t> > m_writer_free; // buffers available for reuse
+	bool                m_writer_exit;          // writer should drain the queue and stop
+	error               m_writer_error;         // first error encountered by the writer
 };
 
 
@@ -1316,8 +1360,13 @@ avi_file_impl::~avi_file_impl()
 	// if we're creating a new file, finalize it by writing out the non-media chunks
 	if (m_type == FILETYPE_CREATE)
 	{
+		// let the writer finish anything still queued
+		stop_writer();
+		avierr = m_writer_error;
+
 		// flush any pending sound data
-		avierr = soundbuf_flush(false);
+		if (avierr == error::NONE)
+			avierr = soundbuf_flush(false);
 
 		// close the movi chunk
 		if (avierr == error::NONE)
@@ -1667,13 +1716,20 @@ avi_file::error avi_file_impl::append_video_frame(bitmap_yuy16 &bitmap)
 	if (stream->format() != FORMAT_UYVY && stream->format() != FORMAT_VYUY && stream->format() != FORMAT_YUY2 && stream->format() != FORMAT_HFYU)
 		return error::UNSUPPORTED_VIDEO_FORMAT;
 
-	// write out any sound data first
-	avierr = soundbuf_write_chunk(stream->chunks());
-	if (avierr != error::NONE)
-		return avierr;
+	maxlength = 2 * stream->width() * stream->height();
+	if (m_background)
+	{
+		// compress into a buffer of our own and let the writer take it from there
+		std::vector<std::uint8_t> buffer;
+		try { buffer = acquire_buffer(maxlength); }
+		catch (...) { return error::NO_MEMORY; }
+		avierr = stream->yuy16_compress_to_yuy(bitmap, &buffer[0], maxlength);
+		if (avierr != error::NONE)
+			return avierr;
+		return queue_write(std::move(buffer), -1, 0);
+	}
 
 	// make sure we have enough room
-	maxlength = 2 * stream->width() * stream->height();
 	avierr = expand_tempbuffer(maxlength);
 	if (avierr != error::NONE)
 		return avierr;
@@ -1684,18 +1740,7 @@ avi_file::error avi_file_impl::append_video_frame(bitmap_yuy16 &bitmap)
 		return avierr;
 
 	// write the data
-	avierr = chunk_write(get_chunkid_for_stream(stream), &m_tempbuffer[0], maxlength);
-	if (avierr != error::NONE)
-		return avierr;
-
-	// set the info for this new chunk
-	avierr = stream->set_chunk_info(stream->chunks(), m_writeoffs - maxlength - 8, maxlength + 8);
-	if (avierr != error::NONE)
-		return avierr;
-
-	stream->set_samples(m_info.video_numsamples = stream->chunks());
-
-	return error::NONE;
+	return write_video_chunk(&m_tempbuffer[0], maxlength);
 }
 
 
@@ -1729,13 +1774,20 @@ avi_file::error avi_file_impl::append_video_frame(bitmap_rgb32 &bitmap)
 	if (stream->depth() != 24)
 		return error::UNSUPPORTED_VIDEO_FORMAT;
 
-	// write out any sound data first
-	avierr = soundbuf_write_chunk(stream->chunks());
-	if (avierr != error::NONE)
-		return avierr;
+	maxlength = 3 * stream->width() * stream->height();
+	if (m_background)
+	{
+		// convert into a buffer of our own and let the writer take it from there
+		std::vector<std::uint8_t> buffer;
+		try { buffer = acquire_buffer(maxlength); }
+		catch (...) { return error::NO_MEMORY; }
+		avierr = stream->rgb32_compress_to_rgb(bitmap, &buffer[0], maxlength);
+		if (avierr != error::NONE)
+			return avierr;
+		return queue_write(std::move(buffer), -1, 0);
+	}
 
 	// make sure we have enough room
-	maxlength = 3 * stream->width() * stream->height();
 	avierr = expand_tempbuffer(maxlength);
 	if (avierr != error::NONE)
 		return avierr;
@@ -1746,12 +1798,31 @@ avi_file::error avi_file_impl::append_video_frame(bitmap_rgb32 &bitmap)
 		return avierr;
 
 	// write the data
-	avierr = chunk_write(get_chunkid_for_stream(stream), &m_tempbuffer[0], maxlength);
+	return write_video_chunk(&m_tempbuffer[0], maxlength);
+}
+
+
+/*-------------------------------------------------
+    write_video_chunk - write a compressed video
+    frame, preceded by any sound that is due
+-------------------------------------------------*/
+
+avi_file::error avi_file_impl::write_video_chunk(std::uint8_t const *data, std::uint32_t length)
+{
+	avi_stream *const stream = get_video_stream();
+
+	// write out any sound data first
+	error avierr = soundbuf_write_chunk(stream->chunks());
+	if (avierr != error::NONE)
+		return avierr;
+
+	// write the data
+	avierr = chunk_write(get_chunkid_for_stream(stream), data, length);
 	if (avierr != error::NONE)
 		return avierr;
 
 	// set the info for this new chunk
-	avierr = stream->set_chunk_info(stream->chunks(), m_writeoffs - maxlength - 8, maxlength + 8);
+	avierr = stream->set_chunk_info(stream->chunks(), m_writeoffs - length - 8, length + 8);
 	if (avierr != error::NONE)
 		return avierr;
 
@@ -1781,6 +1852,29 @@ avi_file::error avi_file_impl::append_video_frame(bitmap_rgb32 &bitmap)
  */
 
 avi_file::error avi_file_impl::append_sound_samples(int channel, const std::int16_t *samples, std::uint32_t numsamples, std::uint32_t sampleskip)
+{
+	if (m_background)
+	{
+		// gather the samples for this channel and let the writer buffer them
+		std::vector<std::uint8_t> buffer;
+		try { buffer = acquire_buffer(numsamples * sizeof(std::int16_t)); }
+		catch (...) { return error::NO_MEMORY; }
+		std::int16_t *const dest = reinterpret_cast<std::int16_t *>(&buffer[0]);
+		for (std::uint32_t sampnum = 0; sampnum < numsamples; sampnum++, samples += sampleskip + 1)
+			dest[sampnum] = *samples;
+		return queue_write(std::move(buffer), channel, numsamples);
+	}
+
+	return buffer_sound_samples(channel, samples, numsamples, sampleskip);
+}
+
+
+/*-------------------------------------------------
+    buffer_sound_samples - add samples to the
+    sound buffer and write any full chunks
+-------------------------------------------------*/
+
+avi_file::error avi_file_impl::buffer_sound_samples(int channel, std::int16_t const *samples, std::uint32_t numsamples, std::uint32_t sampleskip)
 {
 	std::uint32_t sampoffset = m_soundbuf_chansamples[channel];
 	std::uint32_t sampnum;
@@ -3443,11 +3537,12 @@ avi_file::error avi_file::open(std::string const &filename, ptr &file)
  * @param   filename        Filename of the file.
  * @param   info            The information.
  * @param [in,out]  file    If non-null, the file.
+ * @param   background      Queue appended frames and samples for a writer thread.
  *
  * @return  An avi_error.
  */
 
-avi_file::error avi_file::create(std::string const &filename, movie_info const &info, ptr &file)
+avi_file::error avi_file::create(std::string const &filename, movie_info const &info, ptr &file, bool background)
 {
 	// validate video info
 	if ((info.video_format != 0 && info.video_format != FORMAT_UYVY && info.video_format != FORMAT_VYUY && info.video_format != FORMAT_YUY2) ||
@@ -3473,7 +3568,10 @@ avi_file::error avi_file::create(std::string const &filename, movie_info const &
 	// allocate the file
 	error avierr;
 	std::unique_ptr<avi_file_impl> newfile;
-	try { newfile = std::make_unique<avi_file_impl>(std::move(f), info); }
+#if defined(__EMSCRIPTEN__)
+	background = false;
+#endif
+	try { newfile = std::make_unique<avi_file_impl>(std::move(f), info, background); }
 	catch (...)
 	{
 		avierr = error::NO_MEMORY;
@@ -3490,6 +3588,8 @@ avi_file::error avi_file::create(std::string const &filename, movie_info const &
 	if (avierr != error::NONE)
 		goto error;
 
+	// headers are out of the way, so appends can start going to the writer
+	newfile->start_writer();
 	file = std::move(newfile);
 	return error::NONE;
 
@@ -3501,6 +3601,121 @@ error:
 }
 
 
+/*-------------------------------------------------
+    start_writer - start the background writer
+    thread if it was requested
+-------------------------------------------------*/
+
+void avi_file_impl::start_writer()
+{
+	if (m_background)
+		m_writer = std::thread([this] () { writer_thread(); });
+}
+
+
+/*-------------------------------------------------
+    stop_writer - wait for queued writes to
+    complete and stop the background writer
+-------------------------------------------------*/
+
+void avi_file_impl::stop_writer()
+{
+	if (!m_writer.joinable())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(m_writer_mutex);
+		m_writer_exit = true;
+	}
+	m_writer_ready.notify_all();
+	m_writer.join();
+	m_background = false;
+}
+
+
+/*-------------------------------------------------
+    acquire_buffer - get a buffer for a queued
+    write, reusing one the writer has finished
+    with where possible
+-------------------------------------------------*/
+
+std::vector<std::uint8_t> avi_file_impl::acquire_buffer(std::uint32_t length)
+{
+	std::vector<std::uint8_t> result;
+	{
+		std::lock_guard<std::mutex> lock(m_writer_mutex);
+		if (!m_writer_free.empty())
+		{
+			result = std::move(m_writer_free.back());
+			m_writer_free.pop_back();
+		}
+	}
+	result.resize(length);
+	return result;
+}
+
+
+/*-------------------------------------------------
+    queue_write - hand a frame or block of sound
+    samples to the writer, waiting if too many
+    are already queued
+-------------------------------------------------*/
+
+avi_file::error avi_file_impl::queue_write(std::vector<std::uint8_t> &&data, int channel, std::uint32_t numsamples)
+{
+	{
+		std::unique_lock<std::mutex> lock(m_writer_mutex);
+		m_writer_space.wait(lock, [this] () { return (m_writer_error != error::NONE) || (m_writer_queue.size() < MAX_PENDING_WRITES); });
+
+		// report errors from earlier writes to the caller
+		if (m_writer_error != error::NONE)
+			return m_writer_error;
+
+		m_writer_queue.emplace_back(pending_write{ std::move(data), channel, numsamples });
+	}
+	m_writer_ready.notify_one();
+	return error::NONE;
+}
+
+
+/*-------------------------------------------------
+    writer_thread - write queued frames and sound
+    samples in the order they were appended
+-------------------------------------------------*/
+
+void avi_file_impl::writer_thread()
+{
+	std::unique_lock<std::mutex> lock(m_writer_mutex);
+	while (true)
+	{
+		m_writer_ready.wait(lock, [this] () { return m_writer_exit || !m_writer_queue.empty(); });
+		if (m_writer_queue.empty())
+			break;
+
+		// do the file I/O without holding the lock
+		pending_write write(std::move(m_writer_queue.front()));
+		m_writer_queue.pop_front();
+		lock.unlock();
+		error const avierr = (write.channel < 0)
+				? write_video_chunk(&write.data[0], write.data.size())
+				: buffer_sound_samples(write.channel, reinterpret_cast<std::int16_t const *>(&write.data[0]), write.numsamples, 0);
+		lock.lock();
+
+		if (avierr != error::NONE)
+		{
+			// give up on everything else; the next append will report the error
+			m_writer_error = avierr;
+			m_writer_queue.clear();
+		}
+		else if (m_writer_free.size() < MAX_PENDING_WRITES)
+		{
+			m_writer_free.emplace_back(std::move(write.data));
+		}
+		m_writer_space.notify_all();
+	}
+}
+
+
 /*-------------------------------------------------
     avi_error_string - get the error string for
     an avi_error
@@ -115,7 +115,7 @@ public:
 	***********************************************************************/
 
 	static error open(std::string const &filename, ptr &file);
-	static error create(std::string const &filename, movie_info const &info, ptr &file);
+	static error create(std::string const &filename, movie_info const &info, ptr &file, bool background = false);
 	virtual ~avi_file();
 
 	virtual void display_chunks() = 0;
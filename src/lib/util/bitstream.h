@@ -105,6 +105,17 @@ inline uint32_t bitstream_in::peek(int numbits)
 	// fetch data if we need more
 	if (numbits > m_bits)
 	{
+		// take whole bytes while we're byte-aligned, which is the common case
+		if (!m_dbitoffs)
+		{
+			while ((m_bits <= 24) && (m_doffset < m_dlength))
+			{
+				m_buffer |= uint32_t(m_read[m_doffset++]) << (24 - m_bits);
+				m_bits += 8;
+			}
+		}
+
+		// then top up bit by bit, padding with zeroes past the end
 		while (m_bits < 32)
 		{
 			uint32_t newbits = 0;
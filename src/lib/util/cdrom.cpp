@@ -553,6 +553,40 @@ bool cdrom_file::read_subcode(uint32_t lbasector, void *buffer, bool phys)
 }
 
 
+/*-------------------------------------------------
+    read_data_async - queue a read_data on the
+    CHD's worker thread
+-------------------------------------------------*/
+
+/**
+ * @fn  chd_async_read::ptr read_data_async(uint32_t lbasector, void *buffer, uint32_t datatype, bool phys)
+ *
+ * @brief   Cdrom read data asynchronously.  Nothing else may access the
+ *          CD-ROM until the returned token reports completion.
+ *
+ * @param   lbasector       The lbasector.
+ * @param [in,out]  buffer  If non-null, the buffer.
+ * @param   datatype        The datatype.
+ * @param   phys            true to physical.
+ *
+ * @return  A token that reports completion.
+ */
+
+chd_async_read::ptr cdrom_file::read_data_async(uint32_t lbasector, void *buffer, uint32_t datatype, bool phys)
+{
+	auto const work =
+		[this, lbasector, buffer, datatype, phys] () -> std::error_condition
+		{
+			return read_data(lbasector, buffer, datatype, phys) ? std::error_condition() : std::errc::io_error;
+		};
+
+	// image files are read directly
+	if (!chd)
+		return chd_async_read::completed(work());
+	return chd->queue_async(work);
+}
+
+
 
 /***************************************************************************
     HANDY UTILITIES
@@ -1288,43 +1322,32 @@ const uint16_t cdrom_file::qoffsets[ECC_Q_NUM_BYTES][ECC_Q_COMP] =
 };
 
 
-//-------------------------------------------------
-//  ecc_source_byte - return data from the sector
-//  at the given offset, masking anything
-//  particular to a mode
-//-------------------------------------------------
-
-uint8_t cdrom_file::ecc_source_byte(const uint8_t *sector, uint32_t offset)
-{
-	// in mode 2 always treat these as 0 bytes
-	return (sector[MODE_OFFSET] == 2 && offset < 4) ? 0x00 : sector[SYNC_OFFSET + SYNC_NUM_BYTES + offset];
-}
-
 /**
- * @fn  void ecc_compute_bytes(const uint8_t *sector, const uint16_t *row, int rowlen, uint8_t &val1, uint8_t &val2)
+ * @fn  void ecc_compute_bytes(const uint8_t *source, const uint16_t *row, int rowlen, uint8_t &val1, uint8_t &val2)
  *
  * @brief   -------------------------------------------------
  *            ecc_compute_bytes - calculate an ECC value (P or Q)
  *          -------------------------------------------------.
  *
- * @param   sector          The sector.
+ * @param   source          The sector data following the sync bytes, with
+ *                          the header already cleared for mode 2.
  * @param   row             The row.
  * @param   rowlen          The rowlen.
  * @param [in,out]  val1    The first value.
  * @param [in,out]  val2    The second value.
  */
 
-void cdrom_file::ecc_compute_bytes(const uint8_t *sector, const uint16_t *row, int rowlen, uint8_t &val1, uint8_t &val2)
+void cdrom_file::ecc_compute_bytes(const uint8_t *source, const uint16_t *row, int rowlen, uint8_t &val1, uint8_t &val2)
 {
-	val1 = val2 = 0;
+	uint8_t a = 0, b = 0;
 	for (int component = 0; component < rowlen; component++)
 	{
-		val1 ^= ecc_source_byte(sector, row[component]);
-		val2 ^= ecc_source_byte(sector, row[component]);
-		val1 = ecclow[val1];
+		uint8_t const data = source[row[component]];
+		a = ecclow[a ^ data];
+		b ^= data;
 	}
-	val1 = ecchigh[ecclow[val1] ^ val2];
-	val2 ^= val1;
+	val1 = ecchigh[ecclow[a] ^ b];
+	val2 = b ^ val1;
 }
 
 /**
@@ -1341,11 +1364,22 @@ void cdrom_file::ecc_compute_bytes(const uint8_t *sector, const uint16_t *row, i
 
 bool cdrom_file::ecc_verify(const uint8_t *sector)
 {
+	// mode 2 treats the header as zero; clear it in a copy once rather
+	// than testing for it on every source byte
+	uint8_t copy[ECC_Q_OFFSET + 2 * ECC_Q_NUM_BYTES];
+	if (sector[MODE_OFFSET] == 2)
+	{
+		memcpy(copy, sector, sizeof(copy));
+		memset(&copy[SYNC_OFFSET + SYNC_NUM_BYTES], 0, 4);
+		sector = copy;
+	}
+	const uint8_t *const source = &sector[SYNC_OFFSET + SYNC_NUM_BYTES];
+
 	// first verify P bytes
 	for (int byte = 0; byte < ECC_P_NUM_BYTES; byte++)
 	{
 		uint8_t val1, val2;
-		ecc_compute_bytes(sector, poffsets[byte], ECC_P_COMP, val1, val2);
+		ecc_compute_bytes(source, poffsets[byte], ECC_P_COMP, val1, val2);
 		if (sector[ECC_P_OFFSET + byte] != val1 || sector[ECC_P_OFFSET + ECC_P_NUM_BYTES + byte] != val2)
 			return false;
 	}
@@ -1354,7 +1388,7 @@ bool cdrom_file::ecc_verify(const uint8_t *sector)
 	for (int byte = 0; byte < ECC_Q_NUM_BYTES; byte++)
 	{
 		uint8_t val1, val2;
-		ecc_compute_bytes(sector, qoffsets[byte], ECC_Q_COMP, val1, val2);
+		ecc_compute_bytes(source, qoffsets[byte], ECC_Q_COMP, val1, val2);
 		if (sector[ECC_Q_OFFSET + byte] != val1 || sector[ECC_Q_OFFSET + ECC_Q_NUM_BYTES + byte] != val2)
 			return false;
 	}
@@ -1374,13 +1408,26 @@ bool cdrom_file::ecc_verify(const uint8_t *sector)
 
 void cdrom_file::ecc_generate(uint8_t *sector)
 {
-	// first verify P bytes
+	// mode 2 treats the header as zero; clear it while generating
+	uint8_t *const source = &sector[SYNC_OFFSET + SYNC_NUM_BYTES];
+	uint8_t header[4];
+	bool const mode2 = sector[MODE_OFFSET] == 2;
+	if (mode2)
+	{
+		memcpy(header, source, 4);
+		memset(source, 0, 4);
+	}
+
+	// first generate P bytes
 	for (int byte = 0; byte < ECC_P_NUM_BYTES; byte++)
-		ecc_compute_bytes(sector, poffsets[byte], ECC_P_COMP, sector[ECC_P_OFFSET + byte], sector[ECC_P_OFFSET + ECC_P_NUM_BYTES + byte]);
+		ecc_compute_bytes(source, poffsets[byte], ECC_P_COMP, sector[ECC_P_OFFSET + byte], sector[ECC_P_OFFSET + ECC_P_NUM_BYTES + byte]);
 
-	// then verify Q bytes
+	// then generate Q bytes
 	for (int byte = 0; byte < ECC_Q_NUM_BYTES; byte++)
-		ecc_compute_bytes(sector, qoffsets[byte], ECC_Q_COMP, sector[ECC_Q_OFFSET + byte], sector[ECC_Q_OFFSET + ECC_Q_NUM_BYTES + byte]);
+		ecc_compute_bytes(source, qoffsets[byte], ECC_Q_COMP, sector[ECC_Q_OFFSET + byte], sector[ECC_Q_OFFSET + ECC_Q_NUM_BYTES + byte]);
+
+	if (mode2)
+		memcpy(source, header, 4);
 }
 
 /**
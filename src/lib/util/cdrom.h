@@ -123,6 +123,7 @@ public:
 	/* core read access */
 	bool read_data(uint32_t lbasector, void *buffer, uint32_t datatype, bool phys=false);
 	bool read_subcode(uint32_t lbasector, void *buffer, bool phys=false);
+	chd_async_read::ptr read_data_async(uint32_t lbasector, void *buffer, uint32_t datatype, bool phys=false);
 
 	/* handy utilities */
 	uint32_t get_track(uint32_t frame) const;
@@ -247,8 +248,7 @@ private:
 	inline uint32_t logical_to_chd_lba(uint32_t physlba, uint32_t &tracknum) const;
 
 	static void get_info_from_type_string(const char *typestring, uint32_t *trktype, uint32_t *datasize);
-	static uint8_t ecc_source_byte(const uint8_t *sector, uint32_t offset);
-	static void ecc_compute_bytes(const uint8_t *sector, const uint16_t *row, int rowlen, uint8_t &val1, uint8_t &val2);
+	static void ecc_compute_bytes(const uint8_t *source, const uint16_t *row, int rowlen, uint8_t &val1, uint8_t &val2);
 	std::error_condition read_partial_sector(void *dest, uint32_t lbasector, uint32_t chdsector, uint32_t tracknum, uint32_t startoffs, uint32_t length, bool phys);
 
 	static std::string get_file_path(std::string &path);
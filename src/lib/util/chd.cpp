@@ -20,6 +20,7 @@
 
 #include "eminline.h"
 
+#include <zdict.h>
 #include <zlib.h>
 
 #include <cassert>
@@ -165,7 +166,20 @@ inline void chd_file::file_read(uint64_t offset, void *dest, uint32_t length) co
 	if (!m_file)
 		throw std::error_condition(error::NOT_OPEN);
 
-	// seek and read
+	// copy straight from the mapping if there is one covering the range
+	if (m_mapped)
+	{
+		uint64_t maplength;
+		auto const *const data = reinterpret_cast<const uint8_t *>(m_mapped->mapped_data(maplength));
+		if (data && (offset <= maplength) && (length <= (maplength - offset)))
+		{
+			memcpy(dest, data + offset, length);
+			return;
+		}
+	}
+
+	// seek and read; the read-ahead worker may be reading at the same time
+	std::lock_guard<std::mutex> lock(m_file_mutex);
 	std::error_condition err;
 	err = m_file->seek(offset, SEEK_SET);
 	if (err)
@@ -623,6 +637,7 @@ std::error_condition chd_file::create(
 
 	// take ownership of the file
 	m_file = std::move(file);
+	m_mapped = dynamic_cast<util::memory_view *>(m_file.get());
 	return create_common();
 }
 
@@ -664,6 +679,7 @@ std::error_condition chd_file::create(
 
 	// take ownership of the file
 	m_file = std::move(file);
+	m_mapped = dynamic_cast<util::memory_view *>(m_file.get());
 	return create_common();
 }
 
@@ -820,6 +836,7 @@ std::error_condition chd_file::open(
 
 	// open the file
 	m_file = std::move(file);
+	m_mapped = dynamic_cast<util::memory_view *>(m_file.get());
 	m_parent = std::shared_ptr<chd_file>(std::shared_ptr<chd_file>(), parent);
 	m_cachehunk = ~0;
 	return open_common(writeable, open_parent);
@@ -835,8 +852,25 @@ std::error_condition chd_file::open(
 
 void chd_file::close()
 {
+	// finish outstanding asynchronous reads and stop the read-ahead worker
+	// before tearing anything down
+	if (m_async_queue)
+	{
+		while (!osd_work_queue_wait(m_async_queue, osd_ticks_per_second()))
+			;
+		osd_work_queue_free(m_async_queue);
+		m_async_queue = nullptr;
+	}
+	stop_readahead();
+	if (m_readahead_queue)
+	{
+		osd_work_queue_free(m_readahead_queue);
+		m_readahead_queue = nullptr;
+	}
+
 	// reset file characteristics
 	m_file.reset();
+	m_mapped = nullptr;
 	m_allow_reads = false;
 	m_allow_writes = false;
 
@@ -868,10 +902,20 @@ void chd_file::close()
 	for (auto & elem : m_decompressor)
 		elem.reset();
 	m_compressed.clear();
+	m_prefetch.clear();
+	m_prefetch_hunk = ~0U;
 
 	// reset caching
 	m_cache.clear();
 	m_cachehunk = ~0;
+	m_hunk_cache.reset();
+	m_readahead_contexts.clear();
+	m_cache_hunks = 0;
+	m_readahead_hunks = 0;
+	m_readahead_threads = 1;
+	m_last_hunk = ~0U;
+	m_readahead_next = 0;
+	m_readahead_end = 0;
 }
 
 /**
@@ -899,6 +943,124 @@ void chd_file::close()
 
 std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 {
+	// bypass the cache when it is disabled or there is nothing to cache
+	if (!m_hunk_cache || !buffer || hunknum >= m_hunkcount)
+	{
+		std::lock_guard<std::mutex> decompresslock(m_decompress_mutex);
+		return read_hunk_uncached(hunknum, buffer, nullptr);
+	}
+
+	// get read-ahead going on the following hunks before decompressing this one
+	bool const sequential = (hunknum == m_last_hunk + 1);
+	m_last_hunk = hunknum;
+	if (sequential && m_readahead_hunks)
+		schedule_readahead(hunknum + 1);
+
+	// wait for a read-ahead worker that is already decompressing this hunk
+	std::unique_lock<std::mutex> cachelock(m_hunk_cache_mutex);
+	m_hunk_ready.wait(cachelock, [this, hunknum] () { return !hunk_in_flight(hunknum); });
+	auto const found = m_hunk_cache->find(hunknum);
+	if (found != m_hunk_cache->end())
+	{
+		memcpy(buffer, &found->second[0], m_hunkbytes);
+		return std::error_condition();
+	}
+
+	// decompress it ourselves outside the cache lock
+	m_hunks_in_flight.push_back(hunknum);
+	cachelock.unlock();
+	std::error_condition err;
+	{
+		std::lock_guard<std::mutex> decompresslock(m_decompress_mutex);
+		err = read_hunk_uncached(hunknum, buffer, nullptr);
+	}
+	cachelock.lock();
+	m_hunks_in_flight.erase(std::find(m_hunks_in_flight.begin(), m_hunks_in_flight.end(), hunknum));
+	if (!err)
+		cache_insert(hunknum, reinterpret_cast<const uint8_t *>(buffer));
+	m_hunk_ready.notify_all();
+	return err;
+}
+
+/**
+ * @fn  std::error_condition chd_file::prefetch_hunk(uint32_t hunknum)
+ *
+ * @brief   -------------------------------------------------
+ *            prefetch_hunk - read the compressed data for a
+ *            hunk ahead of time so that a later read_hunk
+ *            only has to decompress it; used by callers that
+ *            bypass the hunk cache but can predict their next
+ *            read.  Only compressed V5 hunks are fetched, and
+ *            only one is held at a time
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The hunknum.
+ *
+ * @return  A std::error_condition.
+ */
+
+std::error_condition chd_file::prefetch_hunk(uint32_t hunknum)
+{
+	// wrap this for clean reporting
+	try
+	{
+		// punt if no file
+		if (!m_file)
+			throw std::error_condition(error::NOT_OPEN);
+
+		// return an error if out of range
+		if (hunknum >= m_hunkcount)
+			throw std::error_condition(error::HUNK_OUT_OF_RANGE);
+
+		// nothing to gain for anything other than compressed V5 hunks
+		if (m_version < 5 || !compressed() || m_allow_writes)
+			return std::error_condition();
+		uint8_t const *const rawmap = &m_rawmap[m_mapentrybytes * hunknum];
+		if (rawmap[0] > COMPRESSION_TYPE_3)
+			return std::error_condition();
+
+		std::lock_guard<std::mutex> decompresslock(m_decompress_mutex);
+		if (hunknum == m_prefetch_hunk)
+			return std::error_condition();
+		m_prefetch_hunk = ~0U;
+		m_prefetch.resize(get_u24be(&rawmap[1]));
+		file_read(get_u48be(&rawmap[4]), m_prefetch.data(), m_prefetch.size());
+		m_prefetch_hunk = hunknum;
+		return std::error_condition();
+	}
+	catch (std::error_condition const &err)
+	{
+		return err;
+	}
+	catch (std::bad_alloc const &)
+	{
+		return std::errc::not_enough_memory;
+	}
+}
+
+
+/**
+ * @fn  std::error_condition chd_file::read_hunk_uncached(uint32_t hunknum, void *buffer, readahead_context *context)
+ *
+ * @brief   -------------------------------------------------
+ *            read_hunk_uncached - read and decompress a
+ *            single hunk, bypassing the hunk cache
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum         The hunknum.
+ * @param [in,out]  buffer  If non-null, the buffer.
+ * @param [in,out]  context Read-ahead worker codecs, or nullptr to use the
+ *                          file's own (the caller must then hold
+ *                          m_decompress_mutex).
+ *
+ * @return  A std::error_condition.
+ */
+
+std::error_condition chd_file::read_hunk_uncached(uint32_t hunknum, void *buffer, readahead_context *context)
+{
+	chd_decompressor::ptr *const decompressor = context ? context->decompressor : m_decompressor;
+	uint8_t *const compbuf = context ? context->compressed.data() : m_compressed.data();
+
 	// wrap this for clean reporting
 	try
 	{
@@ -928,8 +1090,8 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 				{
 					case V34_MAP_ENTRY_TYPE_COMPRESSED:
 						blocklen = get_u16be(&rawmap[12]) + (rawmap[14] << 16);
-						file_read(blockoffs, &m_compressed[0], blocklen);
-						m_decompressor[0]->decompress(&m_compressed[0], blocklen, dest, m_hunkbytes);
+						file_read(blockoffs, compbuf, blocklen);
+						decompressor[0]->decompress(compbuf, blocklen, dest, m_hunkbytes);
 						if (!(rawmap[15] & V34_MAP_ENTRY_FLAG_NO_CRC) && dest != nullptr && util::crc32_creator::simple(dest, m_hunkbytes) != blockcrc)
 							throw std::error_condition(error::DECOMPRESSION_ERROR);
 						return std::error_condition();
@@ -949,12 +1111,15 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 						return std::error_condition();
 
 					case V34_MAP_ENTRY_TYPE_SELF_HUNK:
-						return read_hunk(blockoffs, dest);
+						return read_hunk_uncached(blockoffs, dest, context);
 
 					case V34_MAP_ENTRY_TYPE_PARENT_HUNK:
 						if (m_parent_missing)
 							throw std::error_condition(error::REQUIRES_PARENT);
-						return m_parent->read_hunk(blockoffs, dest);
+						{
+							std::lock_guard<std::mutex> parentlock(m_parent_mutex);
+							return m_parent->read_hunk(blockoffs, dest);
+						}
 				}
 				break;
 
@@ -971,7 +1136,10 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 					else if (m_parent_missing)
 						throw std::error_condition(error::REQUIRES_PARENT);
 					else if (m_parent)
+					{
+						std::lock_guard<std::mutex> parentlock(m_parent_mutex);
 						m_parent->read_hunk(hunknum, dest);
+					}
 					else
 						memset(dest, 0, m_hunkbytes);
 					return std::error_condition();
@@ -987,13 +1155,22 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 					case COMPRESSION_TYPE_1:
 					case COMPRESSION_TYPE_2:
 					case COMPRESSION_TYPE_3:
-						file_read(blockoffs, &m_compressed[0], blocklen);
-						m_decompressor[rawmap[0]]->decompress(&m_compressed[0], blocklen, dest, m_hunkbytes);
-						if (!m_decompressor[rawmap[0]]->lossy() && dest != nullptr && util::crc16_creator::simple(dest, m_hunkbytes) != blockcrc)
+					{
+						// use data fetched ahead of time if prefetch_hunk got there first
+						uint8_t const *src = compbuf;
+						if (!context && hunknum == m_prefetch_hunk && m_prefetch.size() == blocklen)
+							src = m_prefetch.data();
+						else
+							file_read(blockoffs, compbuf, blocklen);
+						if (!context)
+							m_prefetch_hunk = ~0U;
+						decompressor[rawmap[0]]->decompress(src, blocklen, dest, m_hunkbytes);
+						if (!decompressor[rawmap[0]]->lossy() && dest != nullptr && util::crc16_creator::simple(dest, m_hunkbytes) != blockcrc)
 							throw std::error_condition(error::DECOMPRESSION_ERROR);
-						if (m_decompressor[rawmap[0]]->lossy() && util::crc16_creator::simple(&m_compressed[0], blocklen) != blockcrc)
+						if (decompressor[rawmap[0]]->lossy() && util::crc16_creator::simple(src, blocklen) != blockcrc)
 							throw std::error_condition(error::DECOMPRESSION_ERROR);
 						return std::error_condition();
+					}
 
 					case COMPRESSION_NONE:
 						file_read(blockoffs, dest, m_hunkbytes);
@@ -1002,12 +1179,15 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 						return std::error_condition();
 
 					case COMPRESSION_SELF:
-						return read_hunk(blockoffs, dest);
+						return read_hunk_uncached(blockoffs, dest, context);
 
 					case COMPRESSION_PARENT:
 						if (m_parent_missing)
 							throw std::error_condition(error::REQUIRES_PARENT);
-						return m_parent->read_bytes(uint64_t(blockoffs) * uint64_t(m_parent->unit_bytes()), dest, m_hunkbytes);
+						{
+							std::lock_guard<std::mutex> parentlock(m_parent_mutex);
+							return m_parent->read_bytes(uint64_t(blockoffs) * uint64_t(m_parent->unit_bytes()), dest, m_hunkbytes);
+						}
 				}
 				break;
 		}
@@ -1022,6 +1202,274 @@ std::error_condition chd_file::read_hunk(uint32_t hunknum, void *buffer)
 	}
 }
 
+/**
+ * @fn  const void *chd_file::hunk_pointer(uint32_t hunknum) const
+ *
+ * @brief   -------------------------------------------------
+ *            hunk_pointer - return a pointer to a hunk
+ *            stored uncompressed in a memory-mapped file,
+ *            for reading without a copy
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The hunknum.
+ *
+ * @return  Pointer to the hunk data, or nullptr if the hunk is not
+ *          stored in this file uncompressed or the file is not mapped.
+ *          Becomes invalid if the file is closed or resized.
+ */
+
+const void *chd_file::hunk_pointer(uint32_t hunknum) const
+{
+	// only v5 uncompressed files keep hunks verbatim without a CRC to check
+	if (!m_mapped || (m_version < 5) || compressed() || (hunknum >= m_hunkcount))
+		return nullptr;
+
+	uint64_t const blockoffs = mulu_32x32(get_u32be(&m_rawmap[m_mapentrybytes * hunknum]), m_hunkbytes);
+	if (!blockoffs)
+		return nullptr;
+
+	uint64_t maplength;
+	auto const *const data = reinterpret_cast<const uint8_t *>(m_mapped->mapped_data(maplength));
+	if (!data || (blockoffs > maplength) || (m_hunkbytes > (maplength - blockoffs)))
+		return nullptr;
+	return data + blockoffs;
+}
+
+/**
+ * @fn  void chd_file::set_cache_hunks(uint32_t count)
+ *
+ * @brief   -------------------------------------------------
+ *            set_cache_hunks - set the number of
+ *            decompressed hunks to keep; zero disables the
+ *            cache, and writeable files are never cached
+ *          -------------------------------------------------.
+ *
+ * @param   count   Number of hunks.
+ */
+
+void chd_file::set_cache_hunks(uint32_t count)
+{
+	stop_readahead();
+	if (m_allow_writes || !m_file)
+		count = 0;
+	m_cache_hunks = count;
+	if (count)
+		m_hunk_cache = std::make_unique<hunk_cache>(count);
+	else
+		m_hunk_cache.reset();
+	m_last_hunk = ~0U;
+}
+
+/**
+ * @fn  void chd_file::set_readahead_hunks(uint32_t count)
+ *
+ * @brief   -------------------------------------------------
+ *            set_readahead_hunks - set how many hunks to
+ *            decompress ahead of sequential reads; limited
+ *            to half the cache so read-ahead cannot evict
+ *            the hunks it has just produced
+ *          -------------------------------------------------.
+ *
+ * @param   count   Number of hunks.
+ */
+
+void chd_file::set_readahead_hunks(uint32_t count)
+{
+	stop_readahead();
+	m_readahead_hunks = std::min(count, m_cache_hunks / 2);
+}
+
+/**
+ * @fn  void chd_file::set_readahead_threads(uint32_t count)
+ *
+ * @brief   -------------------------------------------------
+ *            set_readahead_threads - set how many hunks may
+ *            be decompressed ahead at once; each worker gets
+ *            its own set of codecs
+ *          -------------------------------------------------.
+ *
+ * @param   count   Number of workers.
+ */
+
+void chd_file::set_readahead_threads(uint32_t count)
+{
+	stop_readahead();
+	if (m_readahead_queue)
+	{
+		osd_work_queue_free(m_readahead_queue);
+		m_readahead_queue = nullptr;
+	}
+	m_readahead_contexts.clear();
+	m_readahead_threads = std::max<uint32_t>(count, 1);
+}
+
+/**
+ * @fn  void chd_file::cache_insert(uint32_t hunknum, const uint8_t *data)
+ *
+ * @brief   -------------------------------------------------
+ *            cache_insert - add a decompressed hunk to the
+ *            cache, recycling the least recently used
+ *            entry's buffer when full; the caller must hold
+ *            m_hunk_cache_mutex
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The hunknum.
+ * @param   data    The decompressed data.
+ */
+
+void chd_file::cache_insert(uint32_t hunknum, const uint8_t *data)
+{
+	std::vector<uint8_t> buffer;
+	if (m_hunk_cache->size() >= m_hunk_cache->max_size())
+	{
+		auto oldest = m_hunk_cache->begin();
+		buffer = std::move(oldest->second);
+		m_hunk_cache->erase(oldest);
+	}
+	buffer.resize(m_hunkbytes);
+	memcpy(&buffer[0], data, m_hunkbytes);
+	(*m_hunk_cache)[hunknum] = std::move(buffer);
+}
+
+/**
+ * @fn  void chd_file::schedule_readahead(uint32_t hunknum)
+ *
+ * @brief   -------------------------------------------------
+ *            schedule_readahead - make sure the hunks
+ *            following a sequential read are being
+ *            decompressed in the background
+ *          -------------------------------------------------.
+ *
+ * @param   hunknum The first hunk to read ahead.
+ */
+
+void chd_file::schedule_readahead(uint32_t hunknum)
+{
+	std::lock_guard<std::mutex> cachelock(m_hunk_cache_mutex);
+	uint32_t const end = std::min<uint64_t>(uint64_t(hunknum) + m_readahead_hunks, m_hunkcount);
+	if (m_readahead_next < hunknum || m_readahead_next > end)
+		m_readahead_next = hunknum;
+	m_readahead_end = end;
+	if (m_readahead_next >= m_readahead_end)
+		return;
+
+	// allocate the workers on first use
+	if (m_readahead_contexts.empty())
+	{
+		for (uint32_t ctxnum = 0; ctxnum < m_readahead_threads; ctxnum++)
+		{
+			auto context = std::make_unique<readahead_context>();
+			context->file = this;
+			for (int decompnum = 0; decompnum < std::size(m_compression); decompnum++)
+				context->decompressor[decompnum] = chd_codec_list::new_decompressor(m_compression[decompnum], *this);
+			context->compressed.resize(m_hunkbytes);
+			context->buffer.resize(m_hunkbytes);
+			m_readahead_contexts.emplace_back(std::move(context));
+		}
+	}
+	if (!m_readahead_queue)
+		m_readahead_queue = osd_work_queue_alloc((m_readahead_threads > 1) ? WORK_QUEUE_FLAG_MULTI : WORK_QUEUE_FLAG_IO);
+	if (!m_readahead_queue)
+		return;
+
+	// start idle workers until there is one for each outstanding hunk
+	uint32_t busy = 0;
+	for (auto const &context : m_readahead_contexts)
+		busy += context->busy ? 1 : 0;
+	for (auto &context : m_readahead_contexts)
+	{
+		if (busy >= (m_readahead_end - m_readahead_next))
+			break;
+		if (!context->busy)
+		{
+			context->busy = true;
+			if (osd_work_item_queue(m_readahead_queue, readahead_static, context.get(), WORK_ITEM_FLAG_AUTO_RELEASE))
+				busy++;
+			else
+				context->busy = false;
+		}
+	}
+}
+
+/**
+ * @fn  void chd_file::stop_readahead()
+ *
+ * @brief   -------------------------------------------------
+ *            stop_readahead - cancel outstanding read-ahead
+ *            and wait for the workers to finish
+ *          -------------------------------------------------.
+ */
+
+void chd_file::stop_readahead()
+{
+	if (!m_readahead_queue)
+		return;
+	{
+		std::lock_guard<std::mutex> cachelock(m_hunk_cache_mutex);
+		m_readahead_end = m_readahead_next;
+	}
+	while (!osd_work_queue_wait(m_readahead_queue, osd_ticks_per_second()))
+		;
+}
+
+/**
+ * @fn  void *chd_file::readahead_static(void *param, int threadid)
+ *
+ * @brief   -------------------------------------------------
+ *            readahead_static - work item callback for
+ *            read-ahead
+ *          -------------------------------------------------.
+ *
+ * @param [in,out]  param   If non-null, the parameter.
+ * @param   threadid        The threadid.
+ *
+ * @return  null if it fails, else a void*.
+ */
+
+void *chd_file::readahead_static(void *param, int threadid)
+{
+	auto &context = *reinterpret_cast<readahead_context *>(param);
+	context.file->readahead(context);
+	return nullptr;
+}
+
+/**
+ * @fn  void chd_file::readahead(readahead_context &context)
+ *
+ * @brief   -------------------------------------------------
+ *            readahead - decompress hunks in the requested
+ *            range that are not already cached or being
+ *            decompressed by someone else
+ *          -------------------------------------------------.
+ *
+ * @param [in,out]  context The worker's codecs and buffers.
+ */
+
+void chd_file::readahead(readahead_context &context)
+{
+	std::unique_lock<std::mutex> cachelock(m_hunk_cache_mutex);
+	while (m_readahead_next < m_readahead_end)
+	{
+		uint32_t const hunknum = m_readahead_next++;
+		if (m_hunk_cache->count(hunknum) || hunk_in_flight(hunknum))
+			continue;
+
+		m_hunks_in_flight.push_back(hunknum);
+		cachelock.unlock();
+		std::error_condition const err = read_hunk_uncached(hunknum, &context.buffer[0], &context);
+		cachelock.lock();
+		m_hunks_in_flight.erase(std::find(m_hunks_in_flight.begin(), m_hunks_in_flight.end(), hunknum));
+		if (!err)
+			cache_insert(hunknum, &context.buffer[0]);
+		m_hunk_ready.notify_all();
+
+		// stop on errors and let the foreground read report them
+		if (err)
+			break;
+	}
+	context.busy = false;
+}
+
 /**
  * @fn  std::error_condition chd_file::write_hunk(uint32_t hunknum, const void *buffer)
  *
@@ -1253,6 +1701,164 @@ std::error_condition chd_file::write_bytes(uint64_t offset, const void *buffer,
 	return std::error_condition();
 }
 
+/**
+ * @fn  chd_async_read::ptr chd_file::read_units_async(uint64_t unitnum, void *buffer, uint32_t count)
+ *
+ * @brief   -------------------------------------------------
+ *            read_units_async - queue a read of units from
+ *            the CHD file on a worker thread
+ *          -------------------------------------------------.
+ *
+ * @param   unitnum         The unitnum.
+ * @param [in,out]  buffer  If non-null, the buffer.
+ * @param   count           Number of units.
+ *
+ * @return  A token that reports completion.
+ */
+
+chd_async_read::ptr chd_file::read_units_async(uint64_t unitnum, void *buffer, uint32_t count)
+{
+	return read_bytes_async(unitnum * uint64_t(m_unitbytes), buffer, count * m_unitbytes);
+}
+
+/**
+ * @fn  chd_async_read::ptr chd_file::read_bytes_async(uint64_t offset, void *buffer, uint32_t bytes)
+ *
+ * @brief   -------------------------------------------------
+ *            read_bytes_async - queue a read of bytes from
+ *            the CHD file on a worker thread
+ *          -------------------------------------------------.
+ *
+ * @param   offset          The offset.
+ * @param [in,out]  buffer  If non-null, the buffer.
+ * @param   bytes           The bytes.
+ *
+ * @return  A token that reports completion.
+ */
+
+chd_async_read::ptr chd_file::read_bytes_async(uint64_t offset, void *buffer, uint32_t bytes)
+{
+	return queue_async([this, offset, buffer, bytes] () { return read_bytes(offset, buffer, bytes); });
+}
+
+/**
+ * @fn  chd_async_read::ptr chd_file::queue_async(std::function<std::error_condition ()> &&work)
+ *
+ * @brief   -------------------------------------------------
+ *            queue_async - run a read operation against
+ *            this file on a worker thread; falls back to
+ *            running it immediately if no queue is available
+ *          -------------------------------------------------.
+ *
+ * @param [in,out]  work    The operation to perform.
+ *
+ * @return  A token that reports completion.
+ */
+
+chd_async_read::ptr chd_file::queue_async(std::function<std::error_condition ()> &&work)
+{
+	if (!m_file)
+		return chd_async_read::completed(error::NOT_OPEN);
+
+	auto request = std::make_shared<chd_async_read>(std::move(work));
+	if (!m_async_queue)
+		m_async_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	if (m_async_queue)
+	{
+		auto param = std::make_unique<chd_async_read::ptr>(request);
+		if (osd_work_item_queue(m_async_queue, async_work_static, param.get(), WORK_ITEM_FLAG_AUTO_RELEASE))
+		{
+			param.release();
+			return request;
+		}
+	}
+
+	// no worker available; just do it now
+	request->run();
+	return request;
+}
+
+/**
+ * @fn  void *chd_file::async_work_static(void *param, int threadid)
+ *
+ * @brief   -------------------------------------------------
+ *            async_work_static - work item callback for
+ *            asynchronous reads
+ *          -------------------------------------------------.
+ *
+ * @param [in,out]  param   If non-null, the parameter.
+ * @param   threadid        The threadid.
+ *
+ * @return  null if it fails, else a void*.
+ */
+
+void *chd_file::async_work_static(void *param, int threadid)
+{
+	std::unique_ptr<chd_async_read::ptr> request(reinterpret_cast<chd_async_read::ptr *>(param));
+	(*request)->run();
+	return nullptr;
+}
+
+/**
+ * @fn  chd_async_read::ptr chd_async_read::completed(std::error_condition err)
+ *
+ * @brief   -------------------------------------------------
+ *            completed - create a token for a read that has
+ *            already finished
+ *          -------------------------------------------------.
+ *
+ * @param   err The result of the read.
+ *
+ * @return  A completed token.
+ */
+
+chd_async_read::ptr chd_async_read::completed(std::error_condition err)
+{
+	auto request = std::make_shared<chd_async_read>(nullptr);
+	request->m_result = err;
+	request->m_done.store(true, std::memory_order_release);
+	return request;
+}
+
+/**
+ * @fn  std::error_condition chd_async_read::wait()
+ *
+ * @brief   -------------------------------------------------
+ *            wait - block until the read has finished
+ *          -------------------------------------------------.
+ *
+ * @return  The result of the read.
+ */
+
+std::error_condition chd_async_read::wait()
+{
+	if (!done())
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_cond.wait(lock, [this] () { return done(); });
+	}
+	return m_result;
+}
+
+/**
+ * @fn  void chd_async_read::run()
+ *
+ * @brief   -------------------------------------------------
+ *            run - perform the read and signal completion
+ *          -------------------------------------------------.
+ */
+
+void chd_async_read::run()
+{
+	m_result = m_work();
+	m_work = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_done.store(true, std::memory_order_release);
+	}
+	m_cond.notify_all();
+}
+
 /**
  * @fn  std::error_condition chd_file::read_metadata(chd_metadata_tag searchtag, uint32_t searchindex, std::string &output)
  *
@@ -1648,6 +2254,10 @@ std::error_condition chd_file::codec_configure(chd_codec_type codec, int param,
 		for (int codecnum = 0; codecnum < std::size(m_compression); codecnum++)
 			if (m_compression[codecnum] == codec)
 			{
+				// configured codecs deliver data outside the hunk buffer, which
+				// the decompression cache cannot reproduce
+				set_cache_hunks(0);
+				set_readahead_hunks(0);
 				m_decompressor[codecnum]->configure(param, config);
 				return std::error_condition();
 			}
@@ -2506,6 +3116,15 @@ void chd_file::create_open_common()
 	// allocate the temporary compressed buffer and a buffer for caching
 	m_compressed.resize(m_hunkbytes);
 	m_cache.resize(m_hunkbytes);
+
+	// read-only files get a decompression cache; read-ahead is left off when
+	// there is a parent, since the parent may be shared with other readers
+	if (!m_allow_writes)
+	{
+		set_cache_hunks(std::max(DEFAULT_CACHE_BYTES / m_hunkbytes, 2 * DEFAULT_READAHEAD_HUNKS));
+		if (!m_parent)
+			set_readahead_hunks(DEFAULT_READAHEAD_HUNKS);
+	}
 }
 
 /**
@@ -2805,7 +3424,7 @@ chd_file_compressor::chd_file_compressor()
 
 	// allocate work queues
 	m_read_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
-	m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_STEAL);
 }
 
 /**
@@ -2865,6 +3484,9 @@ void chd_file_compressor::compress_begin()
 		item.m_hash.resize(hunk_bytes() / unit_bytes());
 	}
 
+	// train a dictionary before the codecs look for it
+	train_zstd_dictionary();
+
 	// initialize codec instances
 	for (auto & elem : m_codecs)
 	{
@@ -2876,6 +3498,55 @@ void chd_file_compressor::compress_begin()
 	m_write_hunk = 0;
 }
 
+/**
+ * @fn  void chd_file_compressor::train_zstd_dictionary()
+ *
+ * @brief   -------------------------------------------------
+ *            train_zstd_dictionary - train a Zstandard dictionary from hunks sampled
+ *            across the input and store it in the metadata, so small hunks compress
+ *            nearly as well as large ones; if training fails, the dictionary codecs
+ *            fall back to compressing each hunk on its own
+ *          -------------------------------------------------.
+ */
+
+void chd_file_compressor::train_zstd_dictionary()
+{
+	// only needed by the dictionary codecs, and only once
+	if (std::find(std::begin(m_compression), std::end(m_compression), CHD_CODEC_ZSTD_DICT) == std::end(m_compression) &&
+			std::find(std::begin(m_compression), std::end(m_compression), CHD_CODEC_CD_ZSTD_DICT) == std::end(m_compression))
+		return;
+	std::vector<uint8_t> dictionary;
+	if (!read_metadata(ZSTD_DICTIONARY_METADATA_TAG, 0, dictionary))
+		return;
+
+	// sample whole hunks spread evenly across the input, skipping blank ones
+	uint32_t const samples = uint32_t(std::min<uint64_t>(hunk_count(), std::max<uint32_t>(ZSTD_SAMPLE_BYTES / hunk_bytes(), 1)));
+	std::vector<uint8_t> sampledata(uint64_t(samples) * hunk_bytes());
+	std::vector<size_t> samplesizes;
+	size_t total = 0;
+	for (uint32_t samplenum = 0; samplenum < samples; samplenum++)
+	{
+		uint64_t const offset = (uint64_t(samplenum) * hunk_count() / samples) * hunk_bytes();
+		uint8_t *const dest = &sampledata[total];
+		uint32_t const length = read_data(dest, offset, uint32_t(std::min<uint64_t>(hunk_bytes(), logical_bytes() - offset)));
+		if (length != 0 && std::find_if(dest, dest + length, [dest] (uint8_t value) { return value != dest[0]; }) != dest + length)
+		{
+			samplesizes.push_back(length);
+			total += length;
+		}
+	}
+
+	// train and store; the dictionary only changes the encoding, so leave it out of the SHA-1
+	dictionary.resize(ZSTD_DICTIONARY_BYTES);
+	size_t const result = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(), sampledata.data(), samplesizes.data(), samplesizes.size());
+	if (ZDICT_isError(result))
+		return;
+	dictionary.resize(result);
+	std::error_condition err = write_metadata(ZSTD_DICTIONARY_METADATA_TAG, 0, dictionary, 0);
+	if (err)
+		throw err;
+}
+
 /**
  * @fn  std::error_condition chd_file_compressor::compress_continue(double &progress, double &ratio)
  *
@@ -2896,11 +3567,13 @@ std::error_condition chd_file_compressor::compress_continue(double &progress, do
 		return std::errc::io_error;
 
 	// if done reading, queue some more
-	while (m_read_queue_offset < m_logicalbytes && osd_work_queue_items(m_read_queue) < 2)
+	// reads are queued in small batches, so compression can start on each batch
+	// as soon as it arrives rather than waiting for half the buffer to drain
+	while (m_read_queue_offset < m_logicalbytes && osd_work_queue_items(m_read_queue) < MAX_QUEUED_READS)
 	{
-		// see if we have enough free work items to read the next half of a buffer
+		// see if we have enough free work items to read the next batch
 		uint32_t startitem = m_read_queue_offset / hunk_bytes();
-		uint32_t enditem = startitem + WORK_BUFFER_HUNKS / 2;
+		uint32_t enditem = startitem + READ_BATCH_HUNKS;
 		uint32_t curitem;
 		for (curitem = startitem; curitem < enditem; curitem++)
 			if (m_work_item[curitem % WORK_BUFFER_HUNKS].m_status != WS_READY)
@@ -2919,7 +3592,7 @@ std::error_condition chd_file_compressor::compress_continue(double &progress, do
 		for (curitem = startitem; curitem < enditem; curitem++)
 			m_work_item[curitem % WORK_BUFFER_HUNKS].m_status = WS_READING;
 		osd_work_item_queue(m_read_queue, async_read_static, this, WORK_ITEM_FLAG_AUTO_RELEASE);
-		m_read_queue_offset += WORK_BUFFER_HUNKS * hunk_bytes() / 2;
+		m_read_queue_offset += READ_BATCH_HUNKS * hunk_bytes();
 	}
 
 	// flush out any finished items
@@ -3157,7 +3830,7 @@ void chd_file_compressor::async_read()
 
 	// determine parameters for the read
 	uint32_t work_buffer_bytes = WORK_BUFFER_HUNKS * hunk_bytes();
-	uint32_t numbytes = work_buffer_bytes / 2;
+	uint32_t numbytes = READ_BATCH_HUNKS * hunk_bytes();
 	if (m_read_done_offset + numbytes > logical_bytes())
 		numbytes = logical_bytes() - m_read_done_offset;
 
@@ -3166,7 +3839,7 @@ void chd_file_compressor::async_read()
 	{
 		// do the read
 		uint8_t *dest = &m_work_buffer[0] + (m_read_done_offset % work_buffer_bytes);
-		assert(dest == &m_work_buffer[0] || dest == &m_work_buffer[work_buffer_bytes/2]);
+		assert(!((dest - &m_work_buffer[0]) % (READ_BATCH_HUNKS * hunk_bytes())));
 		uint64_t end_offset = m_read_done_offset + numbytes;
 
 		// if walking the parent, read in hunks from the parent CHD
@@ -15,15 +15,20 @@
 #include "chdcodec.h"
 #include "hashing.h"
 #include "ioprocs.h"
+#include "lrucache.h"
 
 #include "osdcore.h"
 
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <system_error>
+#include <vector>
 
 
 /***************************************************************************
@@ -243,12 +248,48 @@ extern const char *AV_METADATA_FORMAT;
 // A/V laserdisc frame metadata
 constexpr chd_metadata_tag AV_LD_METADATA_TAG = CHD_MAKE_TAG('A','V','L','D');
 
+// shared Zstandard dictionary for the dictionary codecs
+constexpr chd_metadata_tag ZSTD_DICTIONARY_METADATA_TAG = CHD_MAKE_TAG('Z','D','C','T');
+
 
 
 //**************************************************************************
 //  TYPE DEFINITIONS
 //**************************************************************************
 
+// ======================> chd_async_read
+
+// completion token for an asynchronous read from a chd_file
+class chd_async_read
+{
+	friend class chd_file;
+
+public:
+	using ptr = std::shared_ptr<chd_async_read>;
+
+	// construction/destruction
+	chd_async_read(std::function<std::error_condition ()> &&work) : m_work(std::move(work)), m_done(false) { }
+
+	// create a token for a read that was satisfied immediately
+	static ptr completed(std::error_condition err);
+
+	// getters
+	bool done() const noexcept { return m_done.load(std::memory_order_acquire); }
+
+	// block until the read has finished and return its result
+	std::error_condition wait();
+
+private:
+	void run();
+
+	std::function<std::error_condition ()> m_work; // the read to perform
+	std::error_condition    m_result;           // result once done
+	std::atomic<bool>       m_done;             // has the read finished?
+	std::mutex              m_mutex;            // guards waiting for completion
+	std::condition_variable m_cond;             // signalled on completion
+};
+
+
 // ======================> chd_file
 
 // core file class
@@ -264,6 +305,10 @@ class chd_file
 	static constexpr uint32_t V5_HEADER_SIZE = 124;
 	static constexpr uint32_t MAX_HEADER_SIZE = V5_HEADER_SIZE;
 
+	// default decompression cache configuration for read-only files
+	static constexpr uint32_t DEFAULT_CACHE_BYTES = 1024 * 1024;
+	static constexpr uint32_t DEFAULT_READAHEAD_HUNKS = 4;
+
 public:
 	// error types
 	enum class error
@@ -310,6 +355,7 @@ public:
 	uint32_t unit_bytes() const noexcept { return m_unitbytes; }
 	uint64_t unit_count() const noexcept { return m_unitcount; }
 	bool compressed() const { return (m_compression[0] != CHD_CODEC_NONE); }
+	bool is_writeable() const { return m_allow_writes && !compressed(); }
 	chd_codec_type compression(int index) const noexcept { return m_compression[index]; }
 	chd_file *parent() const noexcept { return m_parent.get(); }
 	bool parent_missing() const noexcept;
@@ -322,6 +368,15 @@ public:
 	void set_raw_sha1(util::sha1_t rawdata);
 	void set_parent_sha1(util::sha1_t parent);
 
+	// decompression cache; only files opened read-only are cached, and
+	// sequential reads decompress up to readahead hunks ahead on a worker
+	uint32_t cache_hunks() const noexcept { return m_cache_hunks; }
+	uint32_t readahead_hunks() const noexcept { return m_readahead_hunks; }
+	uint32_t readahead_threads() const noexcept { return m_readahead_threads; }
+	void set_cache_hunks(uint32_t count);
+	void set_readahead_hunks(uint32_t count);
+	void set_readahead_threads(uint32_t count);
+
 	// file create
 	std::error_condition create(std::string_view filename, uint64_t logicalbytes, uint32_t hunkbytes, uint32_t unitbytes, const chd_codec_type (&compression)[4]);
 	std::error_condition create(util::random_read_write::ptr &&file, uint64_t logicalbytes, uint32_t hunkbytes, uint32_t unitbytes, const chd_codec_type (&compression)[4]);
@@ -337,12 +392,20 @@ public:
 
 	// read/write
 	std::error_condition read_hunk(uint32_t hunknum, void *buffer);
+	std::error_condition prefetch_hunk(uint32_t hunknum);
 	std::error_condition write_hunk(uint32_t hunknum, const void *buffer);
+	const void *hunk_pointer(uint32_t hunknum) const;
 	std::error_condition read_units(uint64_t unitnum, void *buffer, uint32_t count = 1);
 	std::error_condition write_units(uint64_t unitnum, const void *buffer, uint32_t count = 1);
 	std::error_condition read_bytes(uint64_t offset, void *buffer, uint32_t bytes);
 	std::error_condition write_bytes(uint64_t offset, const void *buffer, uint32_t bytes);
 
+	// asynchronous reads; the buffer must stay valid and the file must not
+	// otherwise be accessed until the returned token reports completion
+	chd_async_read::ptr read_units_async(uint64_t unitnum, void *buffer, uint32_t count = 1);
+	chd_async_read::ptr read_bytes_async(uint64_t offset, void *buffer, uint32_t bytes);
+	chd_async_read::ptr queue_async(std::function<std::error_condition ()> &&work);
+
 	// metadata management
 	std::error_condition read_metadata(chd_metadata_tag searchtag, uint32_t searchindex, std::string &output);
 	std::error_condition read_metadata(chd_metadata_tag searchtag, uint32_t searchindex, std::vector<uint8_t> &output);
@@ -370,6 +433,17 @@ public:
 private:
 	struct metadata_entry;
 	struct metadata_hash;
+	using hunk_cache = util::lru_cache_map<uint32_t, std::vector<uint8_t> >;
+
+	// codecs and buffers owned by one read-ahead worker
+	struct readahead_context
+	{
+		chd_file *              file = nullptr;     // owning file
+		chd_decompressor::ptr   decompressor[4];    // private decompression codecs
+		std::vector<uint8_t>    compressed;         // compressed data buffer
+		std::vector<uint8_t>    buffer;             // decompressed hunk
+		bool                    busy = false;       // queued or running?
+	};
 
 	// inline helpers
 	util::sha1_t be_read_sha1(const uint8_t *base) const;
@@ -397,9 +471,18 @@ private:
 	void metadata_set_previous_next(uint64_t prevoffset, uint64_t nextoffset);
 	void metadata_update_hash();
 	static int CLIB_DECL metadata_hash_compare(const void *elem1, const void *elem2);
+	std::error_condition read_hunk_uncached(uint32_t hunknum, void *buffer, readahead_context *context);
+	bool hunk_in_flight(uint32_t hunknum) const { return std::find(m_hunks_in_flight.begin(), m_hunks_in_flight.end(), hunknum) != m_hunks_in_flight.end(); }
+	void cache_insert(uint32_t hunknum, const uint8_t *data);
+	void schedule_readahead(uint32_t hunknum);
+	void stop_readahead();
+	static void *readahead_static(void *param, int threadid);
+	void readahead(readahead_context &context);
+	static void *async_work_static(void *param, int threadid);
 
 	// file characteristics
 	util::random_read_write::ptr m_file;        // handle to the open core file
+	util::memory_view *     m_mapped = nullptr; // m_file if it can be addressed directly
 	bool                    m_allow_reads;      // permit reads from this CHD?
 	bool                    m_allow_writes;     // permit writes to this CHD?
 
@@ -430,10 +513,32 @@ private:
 	// compression management
 	chd_decompressor::ptr   m_decompressor[4];  // array of decompression codecs
 	std::vector<uint8_t>    m_compressed;       // temporary buffer for compressed data
+	std::vector<uint8_t>    m_prefetch;         // compressed data fetched ahead by prefetch_hunk
+	uint32_t                m_prefetch_hunk = ~0U; // which hunk is in m_prefetch?
 
 	// caching
 	std::vector<uint8_t>    m_cache;            // single-hunk cache for partial reads/writes
 	uint32_t                m_cachehunk;        // which hunk is in the cache?
+
+	// multi-hunk decompression cache and read-ahead
+	std::unique_ptr<hunk_cache> m_hunk_cache;   // recently decompressed hunks, or nullptr if disabled
+	uint32_t                m_cache_hunks = 0;  // capacity of the cache in hunks
+	uint32_t                m_readahead_hunks = 0; // hunks to decompress ahead of sequential reads
+	uint32_t                m_last_hunk = ~0U;  // last hunk requested through read_hunk
+	uint32_t                m_readahead_next = 0; // next hunk for the worker to decompress
+	uint32_t                m_readahead_end = 0; // end of the requested read-ahead range
+	uint32_t                m_readahead_threads = 1; // number of read-ahead workers
+	std::vector<std::unique_ptr<readahead_context> > m_readahead_contexts; // read-ahead workers, allocated on first use
+	std::vector<uint32_t>   m_hunks_in_flight;  // hunks currently being decompressed
+	osd_work_queue *        m_readahead_queue = nullptr; // queue for read-ahead work
+	std::mutex              m_hunk_cache_mutex; // guards the cache, read-ahead range and workers
+	std::condition_variable m_hunk_ready;       // signalled when a hunk finishes decompressing
+	std::mutex              m_decompress_mutex; // serializes use of m_decompressor and m_compressed
+	std::mutex              m_parent_mutex;     // serializes access to the parent
+	mutable std::mutex      m_file_mutex;       // keeps each seek and read together
+
+	// asynchronous reads
+	osd_work_queue *        m_async_queue = nullptr; // queue for asynchronous read requests
 };
 
 
@@ -456,6 +561,11 @@ protected:
 	virtual uint32_t read_data(void *dest, uint64_t offset, uint32_t length) = 0;
 
 private:
+	// dictionary training for the Zstandard dictionary codecs
+	static constexpr uint32_t ZSTD_DICTIONARY_BYTES = 64 * 1024;
+	static constexpr uint32_t ZSTD_SAMPLE_BYTES = 100 * ZSTD_DICTIONARY_BYTES;
+	void train_zstd_dictionary();
+
 	// hash map for looking up values
 	class hashmap
 	{
@@ -567,6 +677,8 @@ private:
 
 	// work item thread
 	static constexpr int WORK_BUFFER_HUNKS = 256;
+	static constexpr int READ_BATCH_HUNKS = WORK_BUFFER_HUNKS / 8;  // hunks read by each I/O work item
+	static constexpr int MAX_QUEUED_READS = 4;                      // I/O work items queued ahead
 	osd_work_queue *        m_work_queue;       // queue for doing work on other threads
 	std::vector<uint8_t>    m_work_buffer;      // buffer containing hunk data to work on
 	std::vector<uint8_t>    m_compressed_buffer;// buffer containing compressed data
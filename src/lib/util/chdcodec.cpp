@@ -117,9 +117,29 @@ public:
 	// core functionality
 	virtual uint32_t compress(const uint8_t *src, uint32_t srclen, uint8_t *dest) override;
 
+protected:
+	// dictionary management
+	void load_dictionary();
+
 private:
 	// internal state
 	ZSTD_CStream *          m_stream;
+	ZSTD_CDict *            m_dict;
+};
+
+
+// ======================> chd_zstd_dict_compressor
+
+// Zstandard compressor using the dictionary stored in the CHD metadata
+class chd_zstd_dict_compressor : public chd_zstd_compressor
+{
+public:
+	// construction/destruction
+	chd_zstd_dict_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy)
+		: chd_zstd_compressor(chd, hunkbytes, lossy)
+	{
+		load_dictionary();
+	}
 };
 
 
@@ -136,9 +156,32 @@ public:
 	// core functionality
 	virtual void decompress(const uint8_t *src, uint32_t complen, uint8_t *dest, uint32_t destlen) override;
 
-private:
+protected:
+	// dictionary management
+	void load_dictionary();
+
 	// internal state
+	bool                    m_want_dict;
+
+private:
 	ZSTD_DStream *          m_stream;
+	ZSTD_DDict *            m_dict;
+};
+
+
+// ======================> chd_zstd_dict_decompressor
+
+// Zstandard decompressor using the dictionary stored in the CHD metadata
+class chd_zstd_dict_decompressor : public chd_zstd_decompressor
+{
+public:
+	// construction/destruction
+	chd_zstd_dict_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy)
+		: chd_zstd_decompressor(chd, hunkbytes, lossy)
+	{
+		// the dictionary may not have been written yet, so load it on first use
+		m_want_dict = true;
+	}
 };
 
 
@@ -536,12 +579,14 @@ const codec_entry f_codec_list[] =
 	{ CHD_CODEC_LZMA,       false,  "LZMA",                 &codec_entry::construct_compressor<chd_lzma_compressor>,     &codec_entry::construct_decompressor<chd_lzma_decompressor> },
 	{ CHD_CODEC_HUFFMAN,    false,  "Huffman",              &codec_entry::construct_compressor<chd_huffman_compressor>,  &codec_entry::construct_decompressor<chd_huffman_decompressor> },
 	{ CHD_CODEC_FLAC,       false,  "FLAC",                 &codec_entry::construct_compressor<chd_flac_compressor>,     &codec_entry::construct_decompressor<chd_flac_decompressor> },
+	{ CHD_CODEC_ZSTD_DICT,  false,  "Zstandard (dictionary)", &codec_entry::construct_compressor<chd_zstd_dict_compressor>, &codec_entry::construct_decompressor<chd_zstd_dict_decompressor> },
 
 	// general codecs with CD frontend
 	{ CHD_CODEC_CD_ZLIB,    false,  "CD Deflate",           &codec_entry::construct_compressor<chd_cd_compressor<chd_zlib_compressor, chd_zlib_compressor> >,        &codec_entry::construct_decompressor<chd_cd_decompressor<chd_zlib_decompressor, chd_zlib_decompressor> > },
 	{ CHD_CODEC_CD_ZSTD,    false,  "CD Zstandard",         &codec_entry::construct_compressor<chd_cd_compressor<chd_zstd_compressor, chd_zstd_compressor> >,        &codec_entry::construct_decompressor<chd_cd_decompressor<chd_zstd_decompressor, chd_zstd_decompressor> > },
 	{ CHD_CODEC_CD_LZMA,    false,  "CD LZMA",              &codec_entry::construct_compressor<chd_cd_compressor<chd_lzma_compressor, chd_zlib_compressor> >,        &codec_entry::construct_decompressor<chd_cd_decompressor<chd_lzma_decompressor, chd_zlib_decompressor> > },
 	{ CHD_CODEC_CD_FLAC,    false,  "CD FLAC",              &codec_entry::construct_compressor<chd_cd_flac_compressor>,                                              &codec_entry::construct_decompressor<chd_cd_flac_decompressor> },
+	{ CHD_CODEC_CD_ZSTD_DICT, false, "CD Zstandard (dictionary)", &codec_entry::construct_compressor<chd_cd_compressor<chd_zstd_dict_compressor, chd_zstd_compressor> >, &codec_entry::construct_decompressor<chd_cd_decompressor<chd_zstd_dict_decompressor, chd_zstd_decompressor> > },
 
 	// A/V codecs
 	{ CHD_CODEC_AVHUFF,     false,  "A/V Huffman",          &codec_entry::construct_compressor<chd_avhuff_compressor>,   &codec_entry::construct_decompressor<chd_avhuff_decompressor> },
@@ -1035,6 +1080,7 @@ void chd_zlib_decompressor::decompress(const uint8_t *src, uint32_t complen, uin
 chd_zstd_compressor::chd_zstd_compressor(chd_file &chd, uint32_t hunkbytes, bool lossy)
 	: chd_compressor(chd, hunkbytes, lossy)
 	, m_stream(nullptr)
+	, m_dict(nullptr)
 {
 	// initialize the stream
 	m_stream = ZSTD_createCStream();
@@ -1052,6 +1098,25 @@ chd_zstd_compressor::chd_zstd_compressor(chd_file &chd, uint32_t hunkbytes, bool
 chd_zstd_compressor::~chd_zstd_compressor()
 {
 	ZSTD_freeCStream(m_stream);
+	ZSTD_freeCDict(m_dict);
+}
+
+
+//-------------------------------------------------
+//  load_dictionary - prepare the dictionary from
+//  the CHD metadata, if there is one; without it
+//  hunks are compressed independently
+//-------------------------------------------------
+
+void chd_zstd_compressor::load_dictionary()
+{
+	std::vector<uint8_t> dictionary;
+	if (chd().read_metadata(ZSTD_DICTIONARY_METADATA_TAG, 0, dictionary) || dictionary.empty())
+		return;
+
+	m_dict = ZSTD_createCDict(dictionary.data(), dictionary.size(), ZSTD_maxCLevel());
+	if (!m_dict)
+		throw std::bad_alloc();
 }
 
 
@@ -1063,7 +1128,9 @@ chd_zstd_compressor::~chd_zstd_compressor()
 uint32_t chd_zstd_compressor::compress(const uint8_t *src, uint32_t srclen, uint8_t *dest)
 {
 	// reset the compressor
-	auto result = ZSTD_initCStream(m_stream, ZSTD_maxCLevel());
+	auto result = m_dict ? ZSTD_CCtx_reset(m_stream, ZSTD_reset_session_only) : ZSTD_initCStream(m_stream, ZSTD_maxCLevel());
+	if (!ZSTD_isError(result) && m_dict)
+		result = ZSTD_CCtx_refCDict(m_stream, m_dict);
 	if (ZSTD_isError(result))
 		throw std::error_condition(chd_file::error::COMPRESSION_ERROR);
 
@@ -1099,7 +1166,9 @@ uint32_t chd_zstd_compressor::compress(const uint8_t *src, uint32_t srclen, uint
 
 chd_zstd_decompressor::chd_zstd_decompressor(chd_file &chd, uint32_t hunkbytes, bool lossy)
 	: chd_decompressor(chd, hunkbytes, lossy)
+	, m_want_dict(false)
 	, m_stream(nullptr)
+	, m_dict(nullptr)
 {
 	// initialize the stream
 	m_stream = ZSTD_createDStream();
@@ -1117,6 +1186,25 @@ chd_zstd_decompressor::chd_zstd_decompressor(chd_file &chd, uint32_t hunkbytes,
 chd_zstd_decompressor::~chd_zstd_decompressor()
 {
 	ZSTD_freeDStream(m_stream);
+	ZSTD_freeDDict(m_dict);
+}
+
+
+//-------------------------------------------------
+//  load_dictionary - prepare the dictionary from
+//  the CHD metadata once, if there is one
+//-------------------------------------------------
+
+void chd_zstd_decompressor::load_dictionary()
+{
+	m_want_dict = false;
+	std::vector<uint8_t> dictionary;
+	if (chd().read_metadata(ZSTD_DICTIONARY_METADATA_TAG, 0, dictionary) || dictionary.empty())
+		return;
+
+	m_dict = ZSTD_createDDict(dictionary.data(), dictionary.size());
+	if (!m_dict)
+		throw std::bad_alloc();
 }
 
 
@@ -1128,7 +1216,11 @@ chd_zstd_decompressor::~chd_zstd_decompressor()
 void chd_zstd_decompressor::decompress(const uint8_t *src, uint32_t complen, uint8_t *dest, uint32_t destlen)
 {
 	// reset the decompressor
-	auto result = ZSTD_initDStream(m_stream);
+	if (m_want_dict)
+		load_dictionary();
+	auto result = m_dict ? ZSTD_DCtx_reset(m_stream, ZSTD_reset_session_only) : ZSTD_initDStream(m_stream);
+	if (!ZSTD_isError(result) && m_dict)
+		result = ZSTD_DCtx_refDDict(m_stream, m_dict);
 	if (ZSTD_isError(result))
 		throw std::error_condition(chd_file::error::DECOMPRESSION_ERROR);
 
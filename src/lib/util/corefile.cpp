@@ -66,6 +66,8 @@ public:
 	virtual int vprintf(util::format_argument_pack<char> const &args) override { return m_file.vprintf(args); }
 	virtual std::error_condition truncate(std::uint64_t offset) override { return m_file.truncate(offset); }
 
+	virtual void const *mapped_data(std::uint64_t &length) noexcept override { return m_file.mapped_data(length); }
+
 private:
 	core_file &m_file;
 };
@@ -179,6 +181,8 @@ public:
 
 	virtual std::error_condition truncate(std::uint64_t offset) override;
 
+	virtual void const *mapped_data(std::uint64_t &length) noexcept override { length = size(); return m_data; }
+
 protected:
 	void *allocate() noexcept
 	{
@@ -214,6 +218,15 @@ public:
 		: core_basic_file(openmode, length)
 		, m_file(std::move(file))
 	{
+		// map existing files so reads can be served from the page cache without a system call
+		if ((openmode & OPEN_FLAG_READ) && !(openmode & OPEN_FLAG_CREATE))
+		{
+			void const *data;
+			if (!m_file->map(data, m_maplength))
+				m_mapdata = reinterpret_cast<std::uint8_t const *>(data);
+			else
+				m_maplength = 0U;
+		}
 	}
 	~core_osd_file() override;
 
@@ -227,6 +240,8 @@ public:
 
 	virtual std::error_condition truncate(std::uint64_t offset) override;
 
+	virtual void const *mapped_data(std::uint64_t &length) noexcept override { length = m_maplength; return m_mapdata; }
+
 protected:
 	bool is_buffered(std::uint64_t offset) const noexcept { return (offset >= m_bufferbase) && (offset < (m_bufferbase + m_bufferbytes)); }
 
@@ -234,6 +249,8 @@ private:
 	static constexpr std::size_t FILE_BUFFER_SIZE = 512;
 
 	osd_file::ptr   m_file;                     // OSD file handle
+	std::uint8_t const *m_mapdata = nullptr;    // start of read-only mapping, if any
+	std::uint64_t   m_maplength = 0U;           // bytes covered by the mapping
 	std::uint64_t   m_bufferbase = 0U;          // base offset of internal buffer
 	std::uint32_t   m_bufferbytes = 0U;         // bytes currently loaded into buffer
 	std::uint8_t    m_buffer[FILE_BUFFER_SIZE]; // buffer data
@@ -717,6 +734,14 @@ std::error_condition core_osd_file::read_some_at(std::uint64_t offset, void *buf
 	// flush any buffered char
 	clear_putback();
 
+	// copy straight from the mapping if it covers the whole request
+	if (m_mapdata && (offset <= m_maplength) && (length <= (m_maplength - offset)))
+	{
+		std::memcpy(buffer, m_mapdata + offset, length);
+		actual = length;
+		return std::error_condition();
+	}
+
 	actual = 0U;
 	std::error_condition err;
 
@@ -803,6 +828,10 @@ std::error_condition core_osd_file::write_some_at(std::uint64_t offset, void con
 
 std::error_condition core_osd_file::truncate(std::uint64_t offset)
 {
+	// truncating releases the mapping
+	m_mapdata = nullptr;
+	m_maplength = 0U;
+
 	// truncate file
 	std::error_condition err = m_file->truncate(offset);
 	if (err)
@@ -35,7 +35,7 @@ namespace util {
     TYPE DEFINITIONS
 ***************************************************************************/
 
-class core_file : public random_read_write
+class core_file : public random_read_write, public memory_view
 {
 public:
 	typedef std::unique_ptr<core_file> ptr;
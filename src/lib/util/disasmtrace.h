@@ -0,0 +1,62 @@
+// license:BSD-3-Clause
+// copyright-holders:agent
+/***************************************************************************
+
+    disasmtrace.h
+
+    Binary execution trace file format, written by the debugger's
+    binary trace mode and read back by unidasm.
+
+    All multi-byte values are little-endian.  A file starts with:
+
+        char[8]   magic ("MAMETRC\0")
+        u8        format version
+        s8        address bus shift of the program space
+        u8        logical address width in bits
+        u8        reserved (zero)
+        u8 len    device tag, followed by len bytes
+        u8 len    device short name, followed by len bytes
+        u16       number of registers, each as:
+                      u8 size in bytes, u8 len, len bytes of symbol
+
+    followed by a stream of records, each starting with a type byte:
+
+        INSTRUCTION   u32 pc, u8 count, count bytes of opcode data
+                      (count is in bytes; each opcode unit is stored
+                      least significant byte first)
+        INTERRUPT     s32 IRQ line, u32 pc
+        LOOPS         u32 number of instructions skipped by loop
+                      detection
+        TEXT          u32 len, len bytes of text
+        REGISTER      u16 register number, u64 new value (precedes the
+                      instruction it was observed before)
+
+***************************************************************************/
+
+#ifndef MAME_UTIL_DISASMTRACE_H
+#define MAME_UTIL_DISASMTRACE_H
+
+#pragma once
+
+#include "osdcomm.h"
+
+
+namespace util::disasm_trace {
+
+// file header
+constexpr char MAGIC[8] = { 'M', 'A', 'M', 'E', 'T', 'R', 'C', '\0' };
+constexpr osd::u8 VERSION = 1;
+
+// record types
+enum : osd::u8
+{
+	RECORD_INSTRUCTION = 1,
+	RECORD_INTERRUPT,
+	RECORD_LOOPS,
+	RECORD_TEXT,
+	RECORD_REGISTER
+};
+
+} // namespace util::disasm_trace
+
+#endif // MAME_UTIL_DISASMTRACE_H
@@ -28,7 +28,9 @@ hard_disk_file::hard_disk_file(chd_file *_chd)
 {
 	chd = _chd;
 	fhandle = nullptr;
+	mapped = nullptr;
 	fileoffset = 0;
+	writeerr = false;
 
 	std::string metadata;
 	std::error_condition err;
@@ -56,6 +58,8 @@ hard_disk_file::hard_disk_file(util::random_read_write &corefile, uint32_t skipo
 
 	chd = nullptr;
 	fhandle = &corefile;
+	mapped = dynamic_cast<util::memory_view *>(&corefile);
+	writeerr = false;
 	hdinfo.sectorbytes = 512;
 	hdinfo.cylinders = 0;
 	hdinfo.heads = 0;
@@ -87,6 +91,7 @@ hard_disk_file::hard_disk_file(util::random_read_write &corefile, uint32_t skipo
 
 hard_disk_file::~hard_disk_file()
 {
+	flush();
 	if (fhandle)
 		fhandle->flush();
 }
@@ -109,8 +114,18 @@ hard_disk_file::~hard_disk_file()
 
 bool hard_disk_file::read(uint32_t lbasector, void *buffer)
 {
+	// copy straight out of a mapped image or the write-back cache if possible
+	const void *const data = sector_pointer(lbasector);
+	if (data)
+	{
+		memcpy(buffer, data, hdinfo.sectorbytes);
+		return true;
+	}
+
 	if (chd)
 	{
+		// the CHD can't be read while the worker thread is writing to it
+		finish_writeback();
 		std::error_condition err = chd->read_units(lbasector, buffer);
 		return !err;
 	}
@@ -125,6 +140,95 @@ bool hard_disk_file::read(uint32_t lbasector, void *buffer)
 }
 
 
+/*-------------------------------------------------
+    sector_pointer - get direct access to a
+    sector in a memory-mapped image
+-------------------------------------------------*/
+
+/**
+ * @fn  const void *sector_pointer(uint32_t lbasector) const
+ *
+ * @brief   Hard disk direct sector access.  Only available for raw images
+ *          and uncompressed CHDs that are mapped into memory; the pointer
+ *          is invalidated if the image is closed or resized.
+ *
+ * @param   lbasector       The sector number (Linear Block Address).
+ *
+ * @return  Pointer to the sector data, or nullptr if not available.
+ */
+
+const void *hard_disk_file::sector_pointer(uint32_t lbasector) const
+{
+	if (chd)
+	{
+		// data that hasn't reached the CHD yet takes priority
+		const uint8_t *const cached = cached_sector(lbasector);
+		if (cached)
+			return cached;
+		if (writeback && !writeback->done())
+			return nullptr;
+
+		// the sector must not straddle a hunk
+		uint64_t const offset = uint64_t(lbasector) * hdinfo.sectorbytes;
+		uint32_t const hunkbytes = chd->hunk_bytes();
+		uint32_t const hunkoffs = offset % hunkbytes;
+		if ((hunkoffs + hdinfo.sectorbytes) > hunkbytes)
+			return nullptr;
+		auto const *const hunk = reinterpret_cast<const uint8_t *>(chd->hunk_pointer(offset / hunkbytes));
+		return hunk ? (hunk + hunkoffs) : nullptr;
+	}
+	else if (mapped)
+	{
+		uint64_t length;
+		auto const *const data = reinterpret_cast<const uint8_t *>(mapped->mapped_data(length));
+		uint64_t const offset = fileoffset + (uint64_t(lbasector) * hdinfo.sectorbytes);
+		if (!data || (offset > length) || (hdinfo.sectorbytes > (length - offset)))
+			return nullptr;
+		return data + offset;
+	}
+	else
+	{
+		return nullptr;
+	}
+}
+
+
+/*-------------------------------------------------
+    read_async - queue a sector read on the CHD's
+    worker thread
+-------------------------------------------------*/
+
+/**
+ * @fn  std::shared_ptr<chd_async_read> read_async(uint32_t lbasector, void *buffer)
+ *
+ * @brief   Hard disk read without blocking.  Nothing else may access the
+ *          hard disk until the returned token reports completion.
+ *
+ * @param   lbasector       The sector number (Linear Block Address) to read.
+ * @param   buffer          The buffer where the hard disk data will be placed.
+ *
+ * @return  A token that reports completion.
+ */
+
+std::shared_ptr<chd_async_read> hard_disk_file::read_async(uint32_t lbasector, void *buffer)
+{
+	if (chd)
+	{
+		const uint8_t *const cached = cached_sector(lbasector);
+		if (cached)
+		{
+			memcpy(buffer, cached, hdinfo.sectorbytes);
+			return chd_async_read::completed(std::error_condition());
+		}
+		finish_writeback();
+		return chd->read_units_async(lbasector, buffer);
+	}
+
+	// plain image files are read directly
+	return chd_async_read::completed(read(lbasector, buffer) ? std::error_condition() : std::errc::io_error);
+}
+
+
 /*-------------------------------------------------
     write - write  sectors to a hard disk
 -------------------------------------------------*/
@@ -144,8 +248,25 @@ bool hard_disk_file::write(uint32_t lbasector, const void *buffer)
 {
 	if (chd)
 	{
-		std::error_condition err = chd->write_units(lbasector, buffer);
-		return !err;
+		// fail at once if the data could never reach the image
+		if (!chd->is_writeable())
+			return false;
+
+		// a failed write-back can't be reported when it happens, so report it here
+		if (writeback && writeback->done())
+			finish_writeback();
+		if (writeerr)
+		{
+			writeerr = false;
+			return false;
+		}
+
+		// hold the sector until enough have built up to write them back together
+		auto const *const src = reinterpret_cast<const uint8_t *>(buffer);
+		dirty[lbasector].assign(src, src + chd->unit_bytes());
+		if (dirty.size() >= WRITEBACK_SECTORS)
+			start_writeback();
+		return true;
 	}
 	else
 	{
@@ -158,6 +279,94 @@ bool hard_disk_file::write(uint32_t lbasector, const void *buffer)
 }
 
 
+/*-------------------------------------------------
+    flush - write back any cached sectors and
+    wait for them to reach the image
+-------------------------------------------------*/
+
+/**
+ * @fn  bool flush()
+ *
+ * @brief   Hard disk cache flush.
+ *
+ * @return  True if every write since the last flush reached the image.
+ */
+
+bool hard_disk_file::flush()
+{
+	if (!chd)
+		return true;
+
+	start_writeback();
+	bool const result = finish_writeback() && !writeerr;
+	writeerr = false;
+	return result;
+}
+
+
+/*-------------------------------------------------
+    cached_sector - find a CHD sector that hasn't
+    been written back yet
+-------------------------------------------------*/
+
+const uint8_t *hard_disk_file::cached_sector(uint32_t lbasector) const
+{
+	auto found = dirty.find(lbasector);
+	if (dirty.end() != found)
+		return found->second.data();
+
+	// the worker only reads this map, so looking in it is safe
+	found = writing.find(lbasector);
+	return (writing.end() != found) ? found->second.data() : nullptr;
+}
+
+
+/*-------------------------------------------------
+    start_writeback - hand the dirty sectors to
+    the CHD's worker thread
+-------------------------------------------------*/
+
+void hard_disk_file::start_writeback()
+{
+	finish_writeback();
+	if (dirty.empty())
+		return;
+
+	writing.swap(dirty);
+	writeback = chd->queue_async(
+			[this] ()
+			{
+				std::error_condition result;
+				for (auto const &sector : writing)
+				{
+					std::error_condition const err = chd->write_units(sector.first, sector.second.data());
+					if (err)
+						result = err;
+				}
+				return result;
+			});
+}
+
+
+/*-------------------------------------------------
+    finish_writeback - wait for the pending
+    write-back, if any, to complete
+-------------------------------------------------*/
+
+bool hard_disk_file::finish_writeback()
+{
+	if (!writeback)
+		return true;
+
+	bool const result = !writeback->wait();
+	writeback.reset();
+	writing.clear();
+	if (!result)
+		writeerr = true;
+	return result;
+}
+
+
 /*-------------------------------------------------
     set_block_size - sets the block size
     for a non-CHD-backed hard disk (a bare file).
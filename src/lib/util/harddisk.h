@@ -16,10 +16,13 @@
 #include "utilfwd.h"
 
 #include <cstdint>
+#include <map>
+#include <memory>
 #include <system_error>
 #include <vector>
 
 
+class chd_async_read;
 class chd_file;
 
 class hard_disk_file {
@@ -43,16 +46,33 @@ public:
 
 	bool read(uint32_t lbasector, void *buffer);
 	bool write(uint32_t lbasector, const void *buffer);
+	bool flush();
+	const void *sector_pointer(uint32_t lbasector) const;
+	std::shared_ptr<chd_async_read> read_async(uint32_t lbasector, void *buffer);
 
 	std::error_condition get_inquiry_data(std::vector<uint8_t> &data) const;
 	std::error_condition get_cis_data(std::vector<uint8_t> &data) const;
 	std::error_condition get_disk_key_data(std::vector<uint8_t> &data) const;
 
 private:
+	using sector_map = std::map<uint32_t, std::vector<uint8_t>>;
+
+	// CHD writes are held back and written out in batches on the CHD's worker thread
+	static constexpr size_t WRITEBACK_SECTORS = 2048;
+
+	const uint8_t *cached_sector(uint32_t lbasector) const;
+	void start_writeback();
+	bool finish_writeback();
+
 	chd_file *                  chd;        // CHD file
 	util::random_read_write *   fhandle;    // file if not a CHD
+	util::memory_view *         mapped;     // fhandle if it can be addressed directly
 	info                        hdinfo;     // hard disk info
 	uint32_t                    fileoffset; // offset in the file where the HDD image starts.  not valid for CHDs.
+	sector_map                  dirty;      // CHD sectors written since the last write-back
+	sector_map                  writing;    // CHD sectors being written back
+	std::shared_ptr<chd_async_read> writeback; // pending write-back, if any
+	bool                        writeerr;   // a write-back failed since the last flush
 };
 
 #endif // MAME_LIB_UTIL_HARDDISK_H
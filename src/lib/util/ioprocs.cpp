@@ -113,7 +113,7 @@ protected:
 // RAM read implementation
 
 template <typename T, bool Owned>
-class ram_read_adapter : public ram_adapter_base<T, Owned>, public virtual random_read
+class ram_read_adapter : public ram_adapter_base<T, Owned>, public virtual random_read, public memory_view
 {
 public:
 	template <typename U>
@@ -121,6 +121,12 @@ public:
 	{
 	}
 
+	virtual void const *mapped_data(std::uint64_t &length) noexcept override
+	{
+		length = this->m_size;
+		return this->m_data;
+	}
+
 	virtual std::error_condition read_some(void *buffer, std::size_t length, std::size_t &actual) noexcept override
 	{
 		do_read(this->m_pointer, buffer, length, actual);
@@ -668,6 +674,22 @@ public:
 };
 
 
+// memory-mapped osd_file read implementation
+
+class osd_file_mapped_read_adapter : public ram_read_adapter<std::uint8_t const *const, false>
+{
+public:
+	osd_file_mapped_read_adapter(osd_file::ptr &&file, void const *data, std::size_t size) noexcept
+		: ram_read_adapter<std::uint8_t const *const, false>(data, size)
+		, m_file(std::move(file))
+	{
+	}
+
+private:
+	osd_file::ptr const m_file; // keeps the mapping alive
+};
+
+
 // osd_file read/write implementation
 
 class osd_file_read_write_adapter : public osd_file_read_adapter, public random_read_write
@@ -961,6 +983,17 @@ random_read::ptr osd_file_read(osd_file &file) noexcept
 	return random_read::ptr(new (std::nothrow) osd_file_read_adapter(file));
 }
 
+random_read::ptr osd_file_read_mapped(osd_file::ptr &&file) noexcept
+{
+	// the file is left untouched if it can't be mapped
+	random_read::ptr result;
+	void const *data;
+	std::uint64_t length;
+	if (file && !file->map(data, length) && (std::numeric_limits<std::size_t>::max() >= length))
+		result.reset(new (std::nothrow) osd_file_mapped_read_adapter(std::move(file), data, std::size_t(length)));
+	return result;
+}
+
 
 // creating osd_file read/write adapters
 
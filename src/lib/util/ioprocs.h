@@ -232,6 +232,32 @@ public:
 };
 
 
+/// \brief Interface to a byte sequence that is directly addressable
+///
+/// Implemented by byte sequences held in memory or mapped into the
+/// address space, allowing callers to read without copying.  Use
+/// dynamic_cast to test whether a stream supports it.
+/// \sa random_read
+class memory_view
+{
+public:
+	virtual ~memory_view() = default;
+
+	/// \brief Get a pointer to the contents
+	///
+	/// Gets a pointer to the start of the byte sequence.  The pointer
+	/// is invalidated by operations that change the length of the
+	/// sequence, and may cover less than its current length if it has
+	/// grown since it was mapped.
+	/// \param [out] length Receives the number of bytes that can be
+	///   accessed through the pointer.  Not valid if the result is
+	///   nullptr.
+	/// \return Pointer to the contents, or nullptr if they are not
+	///   currently addressable.
+	virtual void const *mapped_data(std::uint64_t &length) noexcept = 0;
+};
+
+
 /// \brief Read from the current position in the stream
 ///
 /// Reads up to the specified number of bytes from the stream into the
@@ -368,6 +394,7 @@ random_read_write::ptr stdio_read_write_noclose(FILE *file, std::uint8_t filler)
 
 random_read::ptr osd_file_read(std::unique_ptr<osd_file> &&file) noexcept;
 random_read::ptr osd_file_read(osd_file &file) noexcept;
+random_read::ptr osd_file_read_mapped(std::unique_ptr<osd_file> &&file) noexcept;
 
 random_read_write::ptr osd_file_read_write(std::unique_ptr<osd_file> &&file) noexcept;
 random_read_write::ptr osd_file_read_write(osd_file &file) noexcept;
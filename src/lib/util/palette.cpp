@@ -208,6 +208,7 @@ palette_t::palette_t(uint32_t numcolors, uint32_t numgroups)
 		m_brightness(0.0f),
 		m_contrast(1.0f),
 		m_gamma(1.0f),
+		m_gamma_identity(true),
 		m_entry_color(numcolors),
 		m_entry_contrast(numcolors),
 		m_adjusted_color(numcolors * numgroups + 2),
@@ -324,11 +325,14 @@ void palette_t::set_gamma(float gamma)
 
 	// recompute the gamma map
 	gamma = 1.0f / gamma;
+	m_gamma_identity = true;
 	for (int index = 0; index < 256; index++)
 	{
 		float fval = float(index) * (1.0f / 255.0f);
 		float fresult = pow(fval, gamma);
 		m_gamma_map[index] = rgb_t::clamp(255.0f * fresult);
+		if (m_gamma_map[index] != index)
+			m_gamma_identity = false;
 	}
 
 	// update across all indices in all groups
@@ -548,11 +552,13 @@ void palette_t::normalize_range(uint32_t start, uint32_t end, int lum_min, int l
 
 void palette_t::update_adjusted_color(uint32_t group, uint32_t index)
 {
-	// compute the adjusted value
-	rgb_t adjusted = adjust_palette_entry(m_entry_color[index],
-											m_group_bright[group] + m_brightness,
-											m_group_contrast[group] * m_entry_contrast[index] * m_contrast,
-											m_gamma_map);
+	// compute the adjusted value; with no brightness, contrast or gamma to apply it is
+	// just the raw color, which saves the float math on bulk palette uploads
+	float const brightness = m_group_bright[group] + m_brightness;
+	float const contrast = m_group_contrast[group] * m_entry_contrast[index] * m_contrast;
+	rgb_t adjusted = (m_gamma_identity && (brightness == 0.0f) && (contrast == 1.0f))
+			? m_entry_color[index]
+			: adjust_palette_entry(m_entry_color[index], brightness, contrast, m_gamma_map);
 
 	// if not different, ignore
 	uint32_t finalindex = group * m_numcolors + index;
@@ -206,6 +206,7 @@ private:
 	float              m_contrast;              // overall contrast value
 	float              m_gamma;                 // overall gamma value
 	uint8_t            m_gamma_map[256];        // gamma map
+	bool               m_gamma_identity;        // gamma map leaves every level unchanged
 
 	std::vector<rgb_t> m_entry_color;           // array of raw colors
 	std::vector<float> m_entry_contrast;        // contrast value for each entry
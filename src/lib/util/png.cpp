@@ -24,7 +24,9 @@
 #include <cstdlib>
 #include <cstring>
 #include <new>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 
 namespace util {
@@ -968,13 +970,157 @@ static std::error_condition write_chunk(write_stream &fp, const uint8_t *data, u
 }
 
 
+/*-------------------------------------------------
+    deflate_error - convert a zlib error code
+-------------------------------------------------*/
+
+static std::error_condition deflate_error(int zerr) noexcept
+{
+	if (Z_ERRNO == zerr)
+		return std::error_condition(errno, std::generic_category());
+	else if (Z_MEM_ERROR == zerr)
+		return std::errc::not_enough_memory;
+	else
+		return png_error::COMPRESS_ERROR;
+}
+
+
+/*-------------------------------------------------
+    deflate_segment - compress one piece of a
+    parallel deflate as a raw deflate stream that
+    ends on a byte boundary
+-------------------------------------------------*/
+
+namespace {
+
+struct deflate_segment
+{
+	uint8_t const *         data = nullptr;
+	uint32_t                length = 0;
+	bool                    last = false;
+	int                     level = Z_BEST_SPEED;
+	std::vector<uint8_t>    output;
+	uLong                   adler = 0;
+	int                     zerr = Z_OK;
+
+	void run() noexcept
+	{
+		adler = adler32(adler32(0, nullptr, 0), data, length);
+
+		z_stream stream;
+		memset(&stream, 0, sizeof(stream));
+		zerr = deflateInit2(&stream, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+		if (Z_OK != zerr)
+			return;
+
+		// the bound covers a finished stream; a sync flush adds at most a few bytes more
+		try { output.resize(deflateBound(&stream, length) + 16); }
+		catch (std::bad_alloc const &) { deflateEnd(&stream); zerr = Z_MEM_ERROR; return; }
+
+		stream.next_in = const_cast<Bytef *>(data);
+		stream.avail_in = length;
+		stream.next_out = &output[0];
+		stream.avail_out = output.size();
+		zerr = deflate(&stream, last ? Z_FINISH : Z_SYNC_FLUSH);
+		if ((last && (Z_STREAM_END == zerr)) || (!last && (Z_OK == zerr) && !stream.avail_in))
+			zerr = Z_OK;
+		else if (Z_OK == zerr)
+			zerr = Z_BUF_ERROR;
+		output.resize(output.size() - stream.avail_out);
+		deflateEnd(&stream);
+	}
+};
+
+} // anonymous namespace
+
+
+/*-------------------------------------------------
+    deflate_parallel - compress a buffer as a
+    zlib stream made of independently deflated
+    segments, compressing segments concurrently
+-------------------------------------------------*/
+
+static std::error_condition deflate_parallel(uint8_t const *data, uint32_t length, unsigned segments, std::vector<uint8_t> &output) noexcept
+{
+	std::vector<deflate_segment> work;
+	std::vector<std::thread> threads;
+	try
+	{
+		work.resize(segments);
+		threads.reserve(segments - 1);
+	}
+	catch (std::bad_alloc const &)
+	{
+		return std::errc::not_enough_memory;
+	}
+
+	// split the input evenly
+	uint32_t const seglength = (length + segments - 1) / segments;
+	for (unsigned i = 0; i < segments; i++)
+	{
+		work[i].data = data + std::min(length, i * seglength);
+		work[i].length = std::min(length - std::min(length, i * seglength), seglength);
+		work[i].last = (segments - 1) == i;
+	}
+
+	// compress all but the first segment on other threads; do any that fail to start here
+	for (unsigned i = 1; i < segments; i++)
+	{
+		try { threads.emplace_back([&segment = work[i]] () { segment.run(); }); }
+		catch (...) { work[i].run(); }
+	}
+	work[0].run();
+	for (std::thread &thread : threads)
+		thread.join();
+
+	// stitch the segments together with a zlib header and trailer
+	size_t total = 2 + 4;
+	for (deflate_segment const &segment : work)
+	{
+		if (Z_OK != segment.zerr)
+			return deflate_error(segment.zerr);
+		total += segment.output.size();
+	}
+	try { output.resize(total); }
+	catch (std::bad_alloc const &) { return std::errc::not_enough_memory; }
+
+	uint8_t *dst = &output[0];
+	*dst++ = 0x78; // deflate, 32K window
+	*dst++ = 0x01; // fastest compression level, check bits
+	uLong adler = work[0].adler;
+	for (unsigned i = 0; i < segments; i++)
+	{
+		dst = std::copy(work[i].output.begin(), work[i].output.end(), dst);
+		if (i)
+			adler = adler32_combine(adler, work[i].adler, work[i].length);
+	}
+	put_32bit(dst, uint32_t(adler));
+	return std::error_condition();
+}
+
+
 /*-------------------------------------------------
     write_deflated_chunk - write an in-memory
     chunk to the given file by deflating it
 -------------------------------------------------*/
 
-static std::error_condition write_deflated_chunk(random_write &fp, uint8_t *data, uint32_t type, uint32_t length) noexcept
+static std::error_condition write_deflated_chunk(random_write &fp, uint8_t *data, uint32_t type, uint32_t length, png_compression compression) noexcept
 {
+	// large images are worth splitting across threads when speed matters more than size
+	if (png_compression::FAST == compression)
+	{
+		constexpr uint32_t SEGMENT_MIN = 256 * 1024;
+		unsigned const segments = std::min<unsigned>(std::thread::hardware_concurrency(), length / SEGMENT_MIN);
+		if (segments > 1)
+		{
+			std::vector<uint8_t> zdata;
+			std::error_condition const err = deflate_parallel(data, length, segments, zdata);
+			if (err)
+				return err;
+			return write_chunk(fp, &zdata[0], type, zdata.size());
+		}
+	}
+
 	std::error_condition err;
 	std::uint64_t lengthpos;
 	err = fp.tell(lengthpos);
@@ -1001,7 +1147,7 @@ static std::error_condition write_deflated_chunk(random_write &fp, uint8_t *data
 	memset(&stream, 0, sizeof(stream));
 	stream.next_in = data;
 	stream.avail_in = length;
-	zerr = deflateInit(&stream, Z_DEFAULT_COMPRESSION);
+	zerr = deflateInit(&stream, (png_compression::FAST == compression) ? Z_BEST_SPEED : Z_DEFAULT_COMPRESSION);
 	if (Z_ERRNO == zerr)
 		return std::error_condition(errno, std::generic_category());
 	else if (Z_MEM_ERROR == zerr)
@@ -1213,7 +1359,7 @@ static std::error_condition convert_bitmap_to_image_rgb(png_info &pnginfo, bitma
     chunks to the given file
 -------------------------------------------------*/
 
-static std::error_condition write_png_stream(random_write &fp, png_info &pnginfo, const bitmap_t &bitmap, int palette_length, const rgb_t *palette) noexcept
+static std::error_condition write_png_stream(random_write &fp, png_info &pnginfo, const bitmap_t &bitmap, int palette_length, const rgb_t *palette, png_compression compression) noexcept
 {
 	uint8_t tempbuff[16];
 	std::error_condition error;
@@ -1247,7 +1393,7 @@ static std::error_condition write_png_stream(random_write &fp, png_info &pnginfo
 		return error;
 
 	// write a single IDAT chunk
-	error = write_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, pnginfo.height * (compute_rowbytes(pnginfo) + 1));
+	error = write_deflated_chunk(fp, pnginfo.image.get(), PNG_CN_IDAT, pnginfo.height * (compute_rowbytes(pnginfo) + 1), compression);
 	if (error)
 		return error;
 
@@ -1294,7 +1440,7 @@ static std::error_condition write_png_stream(random_write &fp, png_info &pnginfo
 }
 
 
-std::error_condition png_write_bitmap(random_write &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette) noexcept
+std::error_condition png_write_bitmap(random_write &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette, png_compression compression) noexcept
 {
 	// use a dummy pnginfo if none passed to us
 	png_info pnginfo;
@@ -1307,7 +1453,7 @@ std::error_condition png_write_bitmap(random_write &fp, png_info *info, bitmap_t
 		return err;
 
 	// write the rest of the PNG data
-	return write_png_stream(fp, *info, bitmap, palette_length, palette);
+	return write_png_stream(fp, *info, bitmap, palette_length, palette, compression);
 }
 
 
@@ -1334,9 +1480,9 @@ std::error_condition mng_capture_start(random_write &fp, bitmap_t const &bitmap,
 }
 
 
-std::error_condition mng_capture_frame(random_write &fp, png_info &info, bitmap_t const &bitmap, int palette_length, rgb_t const *palette) noexcept
+std::error_condition mng_capture_frame(random_write &fp, png_info &info, bitmap_t const &bitmap, int palette_length, rgb_t const *palette, png_compression compression) noexcept
 {
-	return write_png_stream(fp, info, bitmap, palette_length, palette);
+	return write_png_stream(fp, info, bitmap, palette_length, palette, compression);
 }
 
 
@@ -44,6 +44,13 @@ enum class png_error : int
 	UNSUPPORTED_FORMAT
 };
 
+/* Compression effort when writing */
+enum class png_compression : int
+{
+	DEFAULT,    // zlib default level
+	FAST        // fastest zlib level, with large images compressed on several threads
+};
+
 std::error_category const &png_category() noexcept;
 inline std::error_condition make_error_condition(png_error err) noexcept { return std::error_condition(int(err), png_category()); }
 
@@ -104,10 +111,10 @@ private:
 
 std::error_condition png_read_bitmap(read_stream &fp, bitmap_argb32 &bitmap) noexcept;
 
-std::error_condition png_write_bitmap(random_write &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette) noexcept;
+std::error_condition png_write_bitmap(random_write &fp, png_info *info, bitmap_t const &bitmap, int palette_length, const rgb_t *palette, png_compression compression = png_compression::DEFAULT) noexcept;
 
 std::error_condition mng_capture_start(random_write &fp, bitmap_t const &bitmap, unsigned rate) noexcept;
-std::error_condition mng_capture_frame(random_write &fp, png_info &info, bitmap_t const &bitmap, int palette_length, rgb_t const *palette) noexcept;
+std::error_condition mng_capture_frame(random_write &fp, png_info &info, bitmap_t const &bitmap, int palette_length, rgb_t const *palette, png_compression compression = png_compression::DEFAULT) noexcept;
 std::error_condition mng_capture_stop(random_write &fp) noexcept;
 
 } // namespace util
@@ -41,6 +41,8 @@
 
 namespace util {
 
+std::uint32_t archive_name_key(std::string_view name) noexcept; // in unzip.cpp
+
 namespace {
 
 /***************************************************************************
@@ -138,26 +140,43 @@ public:
 	{
 		if (m_out_buffer)
 			ISzAlloc_Free(&m_alloc_imp, m_out_buffer);
+		for (decoded_block const &block : m_block_cache)
+			ISzAlloc_Free(&m_alloc_imp, block.buffer);
 		if (m_inited)
 			SzArEx_Free(&m_db, &m_alloc_imp);
 	}
 
 	static ptr find_cached(std::string_view filename) noexcept
 	{
-		std::lock_guard<std::mutex> guard(s_cache_mutex);
-		for (std::size_t cachenum = 0; cachenum < s_cache.size(); cachenum++)
+		ptr result;
+		{
+			std::lock_guard<std::mutex> guard(s_cache_mutex);
+			for (std::size_t cachenum = 0; cachenum < s_cache.size(); cachenum++)
+			{
+				// if we have a valid entry and it matches our filename, use it and remove from the cache
+				if (s_cache[cachenum] && (filename == s_cache[cachenum]->m_filename))
+				{
+					using std::swap;
+					swap(s_cache[cachenum], result);
+					break;
+				}
+			}
+		}
+
+		// the cached database is only good if the file hasn't been replaced since
+		if (result)
 		{
-			// if we have a valid entry and it matches our filename, use it and remove from the cache
-			if (s_cache[cachenum] && (filename == s_cache[cachenum]->m_filename))
+			if (result->unchanged())
 			{
-				using std::swap;
-				ptr result;
-				swap(s_cache[cachenum], result);
 				osd_printf_verbose("un7z: found %s in cache\n", filename);
-				return result;
+			}
+			else
+			{
+				osd_printf_verbose("un7z: discarding stale cache entry for %s\n", filename);
+				result.reset();
 			}
 		}
-		return ptr();
+		return result;
 	}
 
 	static void close(ptr &&archive) noexcept;
@@ -174,27 +193,31 @@ public:
 
 	int first_file() noexcept
 	{
-		return search(0, 0, std::string_view(), false, false, false);
+		return search(0, int(m_db.NumFiles), 0, std::string_view(), false, false, false);
 	}
 
 	int next_file() noexcept
 	{
-		return (m_curr_file_idx < 0) ? -1 : search(m_curr_file_idx + 1, 0, std::string_view(), false, false, false);
+		return (m_curr_file_idx < 0) ? -1 : search(m_curr_file_idx + 1, int(m_db.NumFiles), 0, std::string_view(), false, false, false);
 	}
 
 	int search(std::uint32_t crc) noexcept
 	{
-		return search(0, crc, std::string_view(), true, false, false);
+		return search(0, int(m_db.NumFiles), crc, std::string_view(), true, false, false);
 	}
 
 	int search(std::string_view filename, bool partialpath) noexcept
 	{
-		return search(0, 0, filename, false, true, partialpath);
+		if (build_index())
+			return search_index(archive_name_key(filename), 0, filename, false, partialpath);
+		return search(0, int(m_db.NumFiles), 0, filename, false, true, partialpath);
 	}
 
 	int search(std::uint32_t crc, std::string_view filename, bool partialpath) noexcept
 	{
-		return search(0, crc, filename, true, true, partialpath);
+		if (build_index())
+			return search_index(archive_name_key(filename), crc, filename, true, partialpath);
+		return search(0, int(m_db.NumFiles), crc, filename, true, true, partialpath);
 	}
 
 	bool current_is_directory() const noexcept { return m_curr_is_dir; }
@@ -211,21 +234,54 @@ private:
 	m7z_file_impl &operator=(const m7z_file_impl &) = delete;
 	m7z_file_impl &operator=(m7z_file_impl &&) = delete;
 
+	using index_entry = std::pair<std::uint32_t, int>; // name key, file index
+
 	int search(
 			int i,
+			int end,
 			std::uint32_t search_crc,
 			std::string_view search_filename,
 			bool matchcrc,
 			bool matchname,
 			bool partialpath) noexcept;
+	int search_index(
+			std::uint32_t key,
+			std::uint32_t search_crc,
+			std::string_view search_filename,
+			bool matchcrc,
+			bool partialpath) noexcept;
+	bool build_index() noexcept;
 	void make_utf8_name(int index);
+	void select_block(UInt32 block_index) noexcept;
+
+	bool unchanged() const noexcept
+	{
+		try
+		{
+			auto const entry(osd_stat(m_filename));
+			return entry && (entry->size == m_archive_stream.length) && (entry->last_modified == m_modified);
+		}
+		catch (...)
+		{
+			return false;
+		}
+	}
 	void set_curr_modified() noexcept;
 
+	struct decoded_block
+	{
+		UInt32          index;
+		Byte *          buffer;
+		std::size_t     size;
+	};
+
 	static constexpr std::size_t            CACHE_SIZE = 8;
+	static constexpr std::size_t            BLOCK_CACHE_BYTES = 32 * 1024 * 1024; // decoded solid blocks kept besides the current one
 	static std::array<ptr, CACHE_SIZE>      s_cache;
 	static std::mutex                       s_cache_mutex;
 
 	const std::string                       m_filename;             // copy of _7Z filename (for caching)
+	std::chrono::system_clock::time_point   m_modified;             // modification time of archive when database was read
 
 	int                                     m_curr_file_idx;        // current file index
 	bool                                    m_curr_is_dir;          // current file is directory
@@ -245,10 +301,15 @@ private:
 	ISzAlloc                                m_alloc_temp_imp;
 	bool                                    m_inited;
 
+	bool                                    m_indexed;              // name index has been built
+	std::vector<index_entry>                m_name_index;           // final path component hashes, sorted
+
 	// cached stuff for solid blocks
 	UInt32                                  m_block_index;
 	Byte *                                  m_out_buffer;
 	std::size_t                             m_out_buffer_size;
+	std::vector<decoded_block>              m_block_cache;          // other decoded blocks, most recently used first
+	std::size_t                             m_block_cache_bytes;
 	Byte                                    m_look_stream_buf[65'536];
 };
 
@@ -283,6 +344,9 @@ public:
 
 	virtual std::error_condition decompress(void *buffer, std::size_t length) noexcept override { return m_impl->decompress(buffer, length); }
 
+	// members are read through the 7-Zip decoder even when they're stored
+	virtual std::error_condition stored_data_offset(std::uint64_t &offset) noexcept override { return archive_file::error::UNSUPPORTED; }
+
 private:
 	m7z_file_impl::ptr m_impl;
 };
@@ -314,9 +378,12 @@ m7z_file_impl::m7z_file_impl(std::string &&filename) noexcept
 	, m_uchar_buf()
 	, m_utf8_buf()
 	, m_inited(false)
+	, m_indexed(false)
 	, m_block_index(0)
 	, m_out_buffer(nullptr)
 	, m_out_buffer_size(0)
+	, m_block_cache()
+	, m_block_cache_bytes(0)
 {
 	m_alloc_imp.Alloc = &SzAlloc;
 	m_alloc_imp.Free = &SzFree;
@@ -387,6 +454,20 @@ std::error_condition m7z_file_impl::initialize() noexcept
 		}
 	}
 
+	// note the modification time so a cached database can be checked later
+	if (!m_filename.empty())
+	{
+		try
+		{
+			auto const entry(osd_stat(m_filename));
+			if (entry)
+				m_modified = entry->last_modified;
+		}
+		catch (...)
+		{
+		}
+	}
+
 	return std::error_condition();
 }
 
@@ -467,6 +548,11 @@ std::error_condition m7z_file_impl::decompress(void *buffer, std::size_t length)
 		osd_printf_verbose("un7z: reopened archive file %s\n", m_filename);
 	}
 
+	// swap in a previously decoded block, or keep the current one when a different block is decoded
+	UInt32 const block_index(m_db.FileToFolder[m_curr_file_idx]);
+	if ((UInt32(-1) != block_index) && (!m_out_buffer || (block_index != m_block_index)))
+		select_block(block_index);
+
 	std::size_t offset(0);
 	std::size_t out_size_processed(0);
 	SRes const res = SzArEx_Extract(
@@ -492,8 +578,65 @@ std::error_condition m7z_file_impl::decompress(void *buffer, std::size_t length)
 }
 
 
+/*-------------------------------------------------
+    select_block - make a cached decoded block
+    current, or retire the current block to the
+    cache so that decoding another one doesn't
+    discard it
+-------------------------------------------------*/
+
+void m7z_file_impl::select_block(UInt32 block_index) noexcept
+{
+	auto const found(std::find_if(
+			m_block_cache.begin(),
+			m_block_cache.end(),
+			[block_index] (decoded_block const &block) { return block.index == block_index; }));
+	decoded_block const wanted(
+			(m_block_cache.end() != found) ? *found : decoded_block{ block_index, nullptr, 0 });
+	if (m_block_cache.end() != found)
+	{
+		m_block_cache_bytes -= found->size;
+		m_block_cache.erase(found);
+	}
+
+	// the outgoing block goes to the front of the cache if it fits
+	if (m_out_buffer)
+	{
+		if (m_out_buffer_size <= BLOCK_CACHE_BYTES)
+		{
+			try
+			{
+				m_block_cache.insert(m_block_cache.begin(), decoded_block{ m_block_index, m_out_buffer, m_out_buffer_size });
+				m_block_cache_bytes += m_out_buffer_size;
+				m_out_buffer = nullptr;
+			}
+			catch (...)
+			{
+			}
+		}
+		if (m_out_buffer)
+			ISzAlloc_Free(&m_alloc_imp, m_out_buffer);
+	}
+
+	// drop the least recently used blocks to stay within budget
+	while (m_block_cache_bytes > BLOCK_CACHE_BYTES)
+	{
+		osd_printf_verbose("un7z: discarding decoded block %u of %s\n", unsigned(m_block_cache.back().index), m_filename);
+		ISzAlloc_Free(&m_alloc_imp, m_block_cache.back().buffer);
+		m_block_cache_bytes -= m_block_cache.back().size;
+		m_block_cache.pop_back();
+	}
+
+	// a null buffer makes SzArEx_Extract decode the block
+	m_block_index = wanted.index;
+	m_out_buffer = wanted.buffer;
+	m_out_buffer_size = wanted.size;
+}
+
+
 int m7z_file_impl::search(
 		int i,
+		int end,
 		std::uint32_t search_crc,
 		std::string_view search_filename,
 		bool matchcrc,
@@ -502,8 +645,11 @@ int m7z_file_impl::search(
 {
 	try
 	{
-		for ( ; i < m_db.NumFiles; i++)
+		for ( ; i < end; i++)
 		{
+			// CRC-only searches don't need the name unless there's a match
+			if (matchcrc && !matchname && (!SzBitArray_Check(m_db.CRCs.Defs, i) || (m_db.CRCs.Vals[i] != search_crc)))
+				continue;
 			make_utf8_name(i);
 			bool const is_dir(SzArEx_IsDir(&m_db, i));
 			const std::uint64_t size(SzArEx_GetFileSize(&m_db, i));
@@ -550,6 +696,68 @@ int m7z_file_impl::search(
 }
 
 
+/*-------------------------------------------------
+    search_index - look up candidates in the name
+    index and return the first one that matches
+-------------------------------------------------*/
+
+int m7z_file_impl::search_index(
+		std::uint32_t key,
+		std::uint32_t search_crc,
+		std::string_view search_filename,
+		bool matchcrc,
+		bool partialpath) noexcept
+{
+	// candidates with the same key are in archive order
+	auto const [first, last] = std::equal_range(
+			m_name_index.begin(),
+			m_name_index.end(),
+			index_entry(key, 0),
+			[] (index_entry const &a, index_entry const &b) { return a.first < b.first; });
+	for (auto it = first; last != it; ++it)
+	{
+		int const result(search(it->second, it->second + 1, search_crc, search_filename, matchcrc, true, partialpath));
+		if (0 <= result)
+			return result;
+	}
+	return -1;
+}
+
+
+/*-------------------------------------------------
+    build_index - convert all the names once and
+    index them by their final path component
+-------------------------------------------------*/
+
+bool m7z_file_impl::build_index() noexcept
+{
+	if (m_indexed)
+		return true;
+
+	try
+	{
+		m_name_index.clear();
+		m_name_index.reserve(m_db.NumFiles);
+		for (int i = 0; int(m_db.NumFiles) > i; i++)
+		{
+			make_utf8_name(i);
+			m_name_index.emplace_back(archive_name_key(std::string_view(m_utf8_buf.data(), m_utf8_buf.size())), i);
+		}
+
+		// sorting on the pair keeps equal keys in archive order
+		std::sort(m_name_index.begin(), m_name_index.end());
+		m_indexed = true;
+		osd_printf_verbose("un7z: indexed %u entries in %s\n", unsigned(m_name_index.size()), m_filename);
+	}
+	catch (...)
+	{
+		// fall back to scanning the database
+		m_name_index.clear();
+	}
+	return m_indexed;
+}
+
+
 void m7z_file_impl::make_utf8_name(int index)
 {
 	std::size_t len, out_pos;
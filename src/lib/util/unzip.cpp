@@ -27,6 +27,7 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cctype>
 #include <cerrno>
 #include <chrono>
 #include <cstring>
@@ -41,6 +42,26 @@
 
 namespace util {
 
+/*-------------------------------------------------
+    archive_name_key - hash the final component
+    of a member path without regard to case, for
+    archive directory index lookups
+-------------------------------------------------*/
+
+std::uint32_t archive_name_key(std::string_view name) noexcept
+{
+	auto const slash(name.find_last_of('/'));
+	if (std::string_view::npos != slash)
+		name.remove_prefix(slash + 1);
+
+	// FNV-1a over the lowercased characters, matching core_strnicmp
+	std::uint32_t result(2166136261U);
+	for (char const ch : name)
+		result = (result ^ std::uint32_t(std::tolower(std::uint8_t(ch)))) * 16777619U;
+	return result;
+}
+
+
 namespace {
 
 /***************************************************************************
@@ -90,20 +111,35 @@ public:
 
 	static ptr find_cached(std::string_view filename) noexcept
 	{
-		std::lock_guard<std::mutex> guard(s_cache_mutex);
-		for (std::size_t cachenum = 0; cachenum < s_cache.size(); cachenum++)
+		ptr result;
+		{
+			std::lock_guard<std::mutex> guard(s_cache_mutex);
+			for (std::size_t cachenum = 0; cachenum < s_cache.size(); cachenum++)
+			{
+				// if we have a valid entry and it matches our filename, use it and remove from the cache
+				if (s_cache[cachenum] && (filename == s_cache[cachenum]->m_filename))
+				{
+					using std::swap;
+					swap(s_cache[cachenum], result);
+					break;
+				}
+			}
+		}
+
+		// the cached directory is only good if the file hasn't been replaced since
+		if (result)
 		{
-			// if we have a valid entry and it matches our filename, use it and remove from the cache
-			if (s_cache[cachenum] && (filename == s_cache[cachenum]->m_filename))
+			if (result->unchanged())
 			{
-				using std::swap;
-				ptr result;
-				swap(s_cache[cachenum], result);
 				osd_printf_verbose("unzip: found %s in cache\n", filename);
-				return result;
+			}
+			else
+			{
+				osd_printf_verbose("unzip: discarding stale cache entry for %s\n", filename);
+				result.reset();
 			}
 		}
-		return ptr();
+		return result;
 	}
 
 	static void close(ptr &&zip) noexcept;
@@ -172,6 +208,25 @@ public:
 		}
 		osd_printf_verbose("unzip: read %s central directory\n", m_filename);
 
+		// note the modification time so a cached directory can be checked later
+		if (!m_filename.empty())
+		{
+			try
+			{
+				auto const entry(osd_stat(m_filename));
+				if (entry)
+					m_modified = entry->last_modified;
+			}
+			catch (...)
+			{
+			}
+		}
+
+		// the name and CRC indexes are built on first search
+		m_indexed = false;
+		m_name_index.clear();
+		m_crc_index.clear();
+
 		return std::error_condition();
 	}
 
@@ -188,18 +243,24 @@ public:
 
 	int search(std::uint32_t crc) noexcept
 	{
+		if (build_index())
+			return search_index(m_crc_index, crc, crc, std::string_view(), true, false, false);
 		m_cd_pos = 0;
 		return search(crc, std::string_view(), true, false, false);
 	}
 
 	int search(std::string_view filename, bool partialpath) noexcept
 	{
+		if (build_index())
+			return search_index(m_name_index, archive_name_key(filename), 0, filename, false, true, partialpath);
 		m_cd_pos = 0;
 		return search(0, filename, false, true, partialpath);
 	}
 
 	int search(std::uint32_t crc, std::string_view filename, bool partialpath) noexcept
 	{
+		if (build_index())
+			return search_index(m_name_index, archive_name_key(filename), crc, filename, true, true, partialpath);
 		m_cd_pos = 0;
 		return search(crc, filename, true, true, partialpath);
 	}
@@ -220,6 +281,7 @@ public:
 	std::uint32_t current_crc() const noexcept { return m_header.crc; }
 
 	std::error_condition decompress(void *buffer, std::size_t length) noexcept;
+	std::error_condition stored_data_offset(std::uint64_t &offset) noexcept;
 
 private:
 	zip_file_impl(const zip_file_impl &) = delete;
@@ -227,7 +289,26 @@ private:
 	zip_file_impl &operator=(const zip_file_impl &) = delete;
 	zip_file_impl &operator=(zip_file_impl &&) = delete;
 
+	using index_entry = std::pair<std::uint32_t, std::uint32_t>; // key, central directory position
+
 	int search(std::uint32_t search_crc, std::string_view search_filename, bool matchcrc, bool matchname, bool partialpath) noexcept;
+	int search_index(std::vector<index_entry> const &index, std::uint32_t key, std::uint32_t search_crc, std::string_view search_filename, bool matchcrc, bool matchname, bool partialpath) noexcept;
+	bool read_header() noexcept;
+	bool header_matches(std::uint32_t search_crc, std::string_view search_filename, bool matchcrc, bool matchname, bool partialpath) const noexcept;
+	bool build_index() noexcept;
+
+	bool unchanged() const noexcept
+	{
+		try
+		{
+			auto const entry(osd_stat(m_filename));
+			return entry && (entry->size == m_length) && (entry->last_modified == m_modified);
+		}
+		catch (...)
+		{
+			return false;
+		}
+	}
 
 	std::error_condition reopen() noexcept
 	{
@@ -330,13 +411,14 @@ private:
 	};
 
 	static constexpr std::size_t        DECOMPRESS_BUFSIZE = 16384;
-	static constexpr std::size_t        CACHE_SIZE = 8; // number of open files to cache
+	static constexpr std::size_t        CACHE_SIZE = 32; // number of closed archive directories to cache
 	static std::array<ptr, CACHE_SIZE>  s_cache;
 	static std::mutex                   s_cache_mutex;
 
 	const std::string           m_filename;                 // copy of ZIP filename (for caching)
 	random_read::ptr            m_file;                     // file handle
 	std::uint64_t               m_length = 0;               // length of zip file
+	std::chrono::system_clock::time_point m_modified;       // modification time of zip file when directory was read
 
 	ecd                         m_ecd;                      // end of central directory
 
@@ -345,6 +427,10 @@ private:
 	file_header                 m_header;                   // current file header
 	bool                        m_curr_is_dir = false;      // current file is directory
 
+	bool                        m_indexed = false;          // name and CRC indexes have been built
+	std::vector<index_entry>    m_name_index;               // final path component hashes, sorted
+	std::vector<index_entry>    m_crc_index;                // CRCs, sorted
+
 	std::array<std::uint8_t, DECOMPRESS_BUFSIZE> m_buffer;  // buffer for decompression
 };
 
@@ -378,6 +464,7 @@ public:
 	virtual std::uint32_t current_crc() const noexcept override { return m_impl->current_crc(); }
 
 	virtual std::error_condition decompress(void *buffer, std::size_t length) noexcept override { return m_impl->decompress(buffer, length); }
+	virtual std::error_condition stored_data_offset(std::uint64_t &offset) noexcept override { return m_impl->stored_data_offset(offset); }
 
 private:
 	zip_file_impl::ptr m_impl;
@@ -760,14 +847,101 @@ void zip_file_impl::close(ptr &&zip) noexcept
 -------------------------------------------------*/
 
 int zip_file_impl::search(std::uint32_t search_crc, std::string_view search_filename, bool matchcrc, bool matchname, bool partialpath) noexcept
+{
+	while (read_header())
+	{
+		if (header_matches(search_crc, search_filename, matchcrc, matchname, partialpath))
+			return 0;
+	}
+	return -1;
+}
+
+
+/*-------------------------------------------------
+    search_index - look up candidates in a sorted
+    index and return the first one that matches
+-------------------------------------------------*/
+
+int zip_file_impl::search_index(std::vector<index_entry> const &index, std::uint32_t key, std::uint32_t search_crc, std::string_view search_filename, bool matchcrc, bool matchname, bool partialpath) noexcept
+{
+	// candidates with the same key are in central directory order
+	auto const [first, last] = std::equal_range(
+			index.begin(),
+			index.end(),
+			index_entry(key, 0),
+			[] (index_entry const &a, index_entry const &b) { return a.first < b.first; });
+	for (auto it = first; last != it; ++it)
+	{
+		m_cd_pos = it->second;
+		if (read_header() && header_matches(search_crc, search_filename, matchcrc, matchname, partialpath))
+			return 0;
+	}
+
+	// leave the position at the end like an exhaustive search would
+	m_cd_pos = std::uint32_t(m_ecd.cd_size);
+	return -1;
+}
+
+
+/*-------------------------------------------------
+    build_index - parse the whole central
+    directory once and index it by name and CRC
+-------------------------------------------------*/
+
+bool zip_file_impl::build_index() noexcept
+{
+	if (m_indexed)
+		return true;
+
+	try
+	{
+		m_name_index.clear();
+		m_crc_index.clear();
+		m_name_index.reserve(std::size_t(m_ecd.cd_total_entries));
+		m_crc_index.reserve(std::size_t(m_ecd.cd_total_entries));
+
+		m_cd_pos = 0;
+		std::uint32_t pos(m_cd_pos);
+		while (read_header())
+		{
+			if (!m_curr_is_dir)
+			{
+				m_name_index.emplace_back(archive_name_key(m_header.file_name), pos);
+				m_crc_index.emplace_back(m_header.crc, pos);
+			}
+			pos = m_cd_pos;
+		}
+
+		// sorting on the pair keeps equal keys in central directory order
+		std::sort(m_name_index.begin(), m_name_index.end());
+		std::sort(m_crc_index.begin(), m_crc_index.end());
+		m_indexed = true;
+		osd_printf_verbose("unzip: indexed %u entries in %s\n", unsigned(m_name_index.size()), m_filename);
+	}
+	catch (...)
+	{
+		// fall back to scanning the central directory
+		m_name_index.clear();
+		m_crc_index.clear();
+	}
+	return m_indexed;
+}
+
+
+/*-------------------------------------------------
+    read_header - parse the central directory
+    entry at the current position and advance
+-------------------------------------------------*/
+
+bool zip_file_impl::read_header() noexcept
 {
 	// if we're at or past the end, we're done
-	while ((m_cd_pos + central_dir_entry_reader::minimum_length()) <= m_ecd.cd_size)
+	if ((m_cd_pos + central_dir_entry_reader::minimum_length()) <= m_ecd.cd_size)
 	{
 		// make sure we have enough data
 		central_dir_entry_reader const reader(&m_cd[0] + m_cd_pos);
 		if (!reader.signature_correct() || ((m_cd_pos + reader.total_length()) > m_ecd.cd_size))
-			break;
+			return false;
 
 		// setting std::string can raise allocation exceptions
 		try
@@ -860,34 +1034,42 @@ int zip_file_impl::search(std::uint32_t search_crc, std::string_view search_file
 			m_header = std::move(header);
 			m_curr_is_dir = is_dir;
 			m_cd_pos += reader.total_length();
+			return true;
 		}
 		catch (...)
 		{
-			break;
 		}
+	}
+	return false;
+}
 
-		// quick return if not required to match on name
-		if (!matchname)
-		{
-			if (!matchcrc || ((search_crc == m_header.crc) && !m_curr_is_dir))
-				return 0;
-		}
-		else if (!m_curr_is_dir)
-		{
-			// check to see if it matches query
-			auto const partialoffset = m_header.file_name.length() - search_filename.length();
-			const bool namematch =
-					(search_filename.length() == m_header.file_name.length()) &&
-					(search_filename.empty() || !core_strnicmp(&search_filename[0], &m_header.file_name[0], search_filename.length()));
-			bool const partialmatch =
-					partialpath &&
-					((m_header.file_name.length() > search_filename.length()) && (m_header.file_name[partialoffset - 1] == '/')) &&
-					(search_filename.empty() || !core_strnicmp(&search_filename[0], &m_header.file_name[partialoffset], search_filename.length()));
-			if ((!matchcrc || (search_crc == m_header.crc)) && (namematch || partialmatch))
-				return 0;
-		}
+
+/*-------------------------------------------------
+    header_matches - check whether the current
+    entry satisfies a search
+-------------------------------------------------*/
+
+bool zip_file_impl::header_matches(std::uint32_t search_crc, std::string_view search_filename, bool matchcrc, bool matchname, bool partialpath) const noexcept
+{
+	// quick return if not required to match on name
+	if (!matchname)
+	{
+		return !matchcrc || ((search_crc == m_header.crc) && !m_curr_is_dir);
 	}
-	return -1;
+	else if (!m_curr_is_dir)
+	{
+		// check to see if it matches query
+		auto const partialoffset = m_header.file_name.length() - search_filename.length();
+		const bool namematch =
+				(search_filename.length() == m_header.file_name.length()) &&
+				(search_filename.empty() || !core_strnicmp(&search_filename[0], &m_header.file_name[0], search_filename.length()));
+		bool const partialmatch =
+				partialpath &&
+				((m_header.file_name.length() > search_filename.length()) && (m_header.file_name[partialoffset - 1] == '/')) &&
+				(search_filename.empty() || !core_strnicmp(&search_filename[0], &m_header.file_name[partialoffset], search_filename.length()));
+		return (!matchcrc || (search_crc == m_header.crc)) && (namematch || partialmatch);
+	}
+	return false;
 }
 
 
@@ -1191,6 +1373,21 @@ std::error_condition zip_file_impl::get_compressed_data_offset(std::uint64_t &of
 
 
 
+/*-------------------------------------------------
+    stored_data_offset - return the offset of the
+    data of the current file, if it is stored
+    uncompressed and can be read in place
+-------------------------------------------------*/
+
+std::error_condition zip_file_impl::stored_data_offset(std::uint64_t &offset) noexcept
+{
+	if ((m_header.compression != 0) || (m_header.compressed_length != m_header.uncompressed_length))
+		return archive_file::error::UNSUPPORTED;
+	return get_compressed_data_offset(offset);
+}
+
+
+
 /***************************************************************************
     DECOMPRESSION INTERFACES
 ***************************************************************************/
@@ -85,6 +85,9 @@ public:
 
 	// decompress the most recently found file in the ZIP
 	virtual std::error_condition decompress(void *buffer, std::size_t length) noexcept = 0;
+
+	// get the offset within the archive of the most recently found file, if it is stored uncompressed
+	virtual std::error_condition stored_data_offset(std::uint64_t &offset) noexcept = 0;
 };
 
 
@@ -30,6 +30,7 @@ class random_access;
 class random_read;
 class random_write;
 class random_read_write;
+class memory_view;
 
 // opresolv.h
 class option_guide;
@@ -1527,8 +1527,8 @@ void namcos22_state::draw_polygons()
 {
 	if (m_pdp_render_done && m_slave_simulation_active)
 	{
+		// this only fills the scene tree; render_scene waits for the workers
 		simulate_slavedsp();
-		m_poly->wait("draw_polygons");
 	}
 }
 
@@ -2534,7 +2534,13 @@ u32 namcos22s_state::screen_update_namcos22s(screen_device &screen, bitmap_rgb32
 	const u8 *rlut = (const u8 *)&m_mixer[0x100/4];
 	const u8 *glut = (const u8 *)&m_mixer[0x200/4];
 	const u8 *blut = (const u8 *)&m_mixer[0x300/4];
-	for (int y = cliprect.top(); y <= cliprect.bottom(); y++)
+	bool identity = true;
+	for (int i = 0; identity && i < 0x100; i++)
+	{
+		const int e = NATIVE_ENDIAN_VALUE_LE_BE(3, 0) ^ i;
+		identity = rlut[e] == i && glut[e] == i && blut[e] == i;
+	}
+	for (int y = cliprect.top(); !identity && y <= cliprect.bottom(); y++)
 	{
 		u32 *const dest = &bitmap.pix(y);
 		for (int x = cliprect.left(); x <= cliprect.right(); x++)
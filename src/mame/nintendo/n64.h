@@ -41,6 +41,7 @@ public:
 	virtual void machine_reset() override;
 	virtual void video_start() override;
 	void n64_machine_stop();
+	void rdp_wait_pending();
 
 	uint32_t screen_update(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect);
 	void screen_vblank(int state);
@@ -2780,5 +2780,6 @@ void n64_state::machine_start()
 
 void n64_state::machine_reset()
 {
+	m_rdp->wait_pending("Reset");
 	m_rsp->set_input_line(INPUT_LINE_HALT, ASSERT_LINE);
 }
@@ -121,6 +121,17 @@ void n64_state::video_start()
 
 	m_screen->register_screen_bitmap(m_interlace_bitmap[0]);
 	m_screen->register_screen_bitmap(m_interlace_bitmap[1]);
+
+	// queued spans write RDRAM and read TMEM, so they must finish before a state is saved, loaded or torn down
+	machine().save().register_presave(save_prepost_delegate(FUNC(n64_state::rdp_wait_pending), this));
+	machine().save().register_preload(save_prepost_delegate(FUNC(n64_state::rdp_wait_pending), this));
+	machine().save().register_postload(save_prepost_delegate(FUNC(n64_state::rdp_wait_pending), this));
+	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(&n64_state::rdp_wait_pending, this));
+}
+
+void n64_state::rdp_wait_pending()
+{
+	m_rdp->wait_pending("Machine state");
 }
 
 uint32_t n64_state::screen_update(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
@@ -1912,6 +1923,11 @@ void n64_rdp::draw_triangle(uint64_t *cmd_buf, bool shade, bool texture, bool zb
 		return;
 	}
 
+	// spans stay queued until a sync, so make sure their aux data won't run out
+	const uint32_t aux_needed = (((ylfar - ycur) >> 2) + 1) * sizeof(rdp_span_aux);
+	if (m_aux_buf_ptr + aux_needed >= EXTENT_AUX_COUNT)
+		wait_pending("aux buffer full");
+
 	bool new_object = true;
 	rdp_poly_state* object = nullptr;
 	bool valid = false;
@@ -2064,10 +2080,47 @@ void n64_rdp::draw_triangle(uint64_t *cmd_buf, bool shade, bool texture, bool zb
 	{
 		render_spans(yh >> 2, yl >> 2, tilenum, flip ? true : false, spans, rect, object);
 	}
-	m_aux_buf_ptr = 0;  // Spans can be reused once render completes
 	//wait("draw_triangle");
 }
 
+
+//-------------------------------------------------
+//  wait_pending - wait for all queued spans and
+//  release their aux data
+//-------------------------------------------------
+
+void n64_rdp::wait_pending(const char *debug_reason)
+{
+	wait(debug_reason);
+	m_aux_buf_ptr = 0;
+	std::fill(std::begin(m_pending_start), std::end(m_pending_start), ~uint32_t(0));
+	std::fill(std::begin(m_pending_end), std::end(m_pending_end), 0);
+}
+
+
+//-------------------------------------------------
+//  wait_for_texture_image - wait for queued spans
+//  if they may write the given rows of the current
+//  texture image, which covers rendering to a
+//  texture
+//-------------------------------------------------
+
+void n64_rdp::wait_for_texture_image(uint32_t firstrow, uint32_t lastrow, const char *debug_reason)
+{
+	// allow for a block load reading a few KB past the start of its row
+	const uint32_t rowbytes = (m_misc_state.m_ti_width << m_misc_state.m_ti_size) >> 1;
+	const uint32_t start = m_misc_state.m_ti_address + firstrow * rowbytes;
+	const uint32_t end = m_misc_state.m_ti_address + (lastrow + 1) * rowbytes + 0x4000;
+	for (int i = 0; i < 2; i++)
+	{
+		if (start < m_pending_end[i] && end > m_pending_start[i])
+		{
+			wait_pending(debug_reason);
+			return;
+		}
+	}
+}
+
 /*****************************************************************************/
 
 ////////////////////////
@@ -2182,7 +2235,8 @@ void n64_rdp::cmd_sync_tile(uint64_t *cmd_buf)
 
 void n64_rdp::cmd_sync_full(uint64_t *cmd_buf)
 {
-	//wait("SyncFull");
+	// everything must land in RDRAM before the CPU is told the RDP is done
+	wait_pending("SyncFull");
 	m_n64_periphs->dp_full_sync();
 }
 
@@ -2291,6 +2345,7 @@ void n64_rdp::cmd_load_tlut(uint64_t *cmd_buf)
 	//wait("LoadTLUT");
 	n64_tile_t* tile = m_tiles;
 	const uint64_t w1 = cmd_buf[0];
+	wait_for_texture_image(uint32_t(w1 >> 34) & 0x3ff, uint32_t(w1 >> 2) & 0x3ff, "LoadTLUT");
 
 	const int32_t tilenum = (w1 >> 24) & 0x7;
 	const int32_t sl = tile[tilenum].sl = int32_t(w1 >> 44) & 0xfff;
@@ -2363,6 +2418,7 @@ void n64_rdp::cmd_load_block(uint64_t *cmd_buf)
 	//wait("LoadBlock");
 	n64_tile_t* tile = m_tiles;
 	const uint64_t w1 = cmd_buf[0];
+	wait_for_texture_image(uint32_t(w1 >> 32) & 0xfff, uint32_t(w1 >> 32) & 0xfff, "LoadBlock");
 
 	const uint8_t tilenum = uint8_t(w1 >> 24) & 0x7;
 	uint16_t* tc = get_tmem16();
@@ -2576,6 +2632,7 @@ void n64_rdp::cmd_load_tile(uint64_t *cmd_buf)
 	//wait("LoadTile");
 	n64_tile_t* tile = m_tiles;
 	const uint64_t w1 = cmd_buf[0];
+	wait_for_texture_image(uint32_t(w1 >> 34) & 0x3ff, uint32_t(w1 >> 2) & 0x3ff, "LoadTile");
 	const int32_t tilenum = int32_t(w1 >> 24) & 0x7;
 
 	tile[tilenum].sl    = int32_t(w1 >> 44) & 0xfff;
@@ -2999,6 +3056,8 @@ n64_rdp::n64_rdp(n64_state &state, uint32_t* rdram, uint32_t* dmem) : poly_manag
 	m_aux_buf_ptr = 0;
 	m_aux_buf = nullptr;
 	m_pipe_clean = true;
+	std::fill(std::begin(m_pending_start), std::end(m_pending_start), ~uint32_t(0));
+	std::fill(std::begin(m_pending_end), std::end(m_pending_end), 0);
 
 	m_pending_mode_block = false;
 
@@ -3125,6 +3184,13 @@ void n64_rdp::render_spans(int32_t start, int32_t end, int32_t tilenum, bool fli
 	object->m_fill_color = m_fill_color;
 	object->rect = rect;
 
+	// note the colour and Z image rows these spans can write; loads from them must wait
+	const uint32_t fb_rowbytes = std::max<uint32_t>((m_misc_state.m_fb_width << m_misc_state.m_fb_size) >> 1, 1);
+	m_pending_start[0] = std::min<uint32_t>(m_pending_start[0], m_misc_state.m_fb_address + start * fb_rowbytes);
+	m_pending_end[0] = std::max<uint32_t>(m_pending_end[0], m_misc_state.m_fb_address + (end + 1) * fb_rowbytes);
+	m_pending_start[1] = std::min<uint32_t>(m_pending_start[1], m_misc_state.m_zb_address + start * m_misc_state.m_fb_width * 2);
+	m_pending_end[1] = std::max<uint32_t>(m_pending_end[1], m_misc_state.m_zb_address + (end + 1) * m_misc_state.m_fb_width * 2);
+
 	switch(m_other_modes.cycle_type)
 	{
 		case CYCLE_TYPE_1:
@@ -3143,7 +3209,6 @@ void n64_rdp::render_spans(int32_t start, int32_t end, int32_t tilenum, bool fli
 			render_extents<8>(clip, render_delegate(&n64_rdp::span_draw_fill, this), start, (end - start) + 1, spans + offset);
 			break;
 	}
-	wait("render spans");
 }
 
 void n64_rdp::rgbaz_clip(int32_t sr, int32_t sg, int32_t sb, int32_t sa, int32_t* sz, rdp_span_aux* userdata)
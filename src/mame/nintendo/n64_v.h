@@ -216,6 +216,7 @@ public:
 	void            tc_div_no_perspective(int32_t ss, int32_t st, int32_t sw, int32_t* sss, int32_t* sst);
 	uint32_t          get_log2(uint32_t lod_clamp);
 	void            render_spans(int32_t start, int32_t end, int32_t tilenum, bool flip, extent_t* spans, bool rect, rdp_poly_state* object);
+	void            wait_pending(const char *debug_reason);
 	int32_t           get_alpha_cvg(int32_t comb_alpha, rdp_span_aux* userdata, const rdp_poly_state &object);
 
 	void            z_store(const rdp_poly_state &object, uint32_t zcurpixel, uint32_t dzcurpixel, uint32_t z, uint32_t enc);
@@ -306,11 +307,17 @@ public:
 	uint32_t          m_aux_buf_ptr;
 	uint32_t          m_aux_buf_index;
 
+	// RDRAM written by queued spans, as [start, end) byte ranges for the colour and Z images
+	uint32_t          m_pending_start[2];
+	uint32_t          m_pending_end[2];
+
 	bool            rdp_range_check(uint32_t addr);
 
 	n64_tile_t      m_tiles[8];
 
 private:
+	void    wait_for_texture_image(uint32_t firstrow, uint32_t lastrow, const char *debug_reason);
+
 	void    compute_cvg_noflip(extent_t* spans, int32_t* majorx, int32_t* minorx, int32_t* majorxint, int32_t* minorxint, int32_t scanline, int32_t yh, int32_t yl, int32_t base);
 	void    compute_cvg_flip(extent_t* spans, int32_t* majorx, int32_t* minorx, int32_t* majorxint, int32_t* minorxint, int32_t scanline, int32_t yh, int32_t yl, int32_t base);
 
@@ -1354,6 +1354,7 @@ void snes_console_state::snes(machine_config &config)
 	SNES_PPU(config, m_ppu, MCLK_NTSC);
 	m_ppu->open_bus_callback().set(FUNC(snes_console_state::snes_open_bus_r));
 	m_ppu->set_screen("screen");
+	m_ppu->set_threaded(true);
 
 	SNES_CONTROL_PORT(config, m_ctrl1, snes_control_port_devices, "joypad");
 	m_ctrl1->set_onscreen_callback(FUNC(snes_console_state::onscreen_cb));
@@ -34,6 +34,10 @@ uint32_t snes_state::screen_update(screen_device &screen, bitmap_rgb32 &bitmap,
 	for (int y = cliprect.min_y; y <= cliprect.max_y; y++)
 		m_ppu->refresh_scanline(bitmap, y + 1);
 
+	/* the screen composites the line bitmaps once the last line is updated */
+	if (cliprect.max_y == screen.visible_area().max_y)
+		m_ppu->finish_lines();
+
 	return 0;
 }
 
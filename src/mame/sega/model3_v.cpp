@@ -508,6 +508,10 @@ void model3_state::invalidate_texture(int page, int texx, int texy, int texwidth
 	int wtiles = 1 << texwidth;
 	int htiles = 1 << texheight;
 
+	// queued polygons may still be sampling these textures
+	if (m_renderer)
+		m_renderer->wait_for_polys();
+
 	for (int y = 0; y < htiles; y++)
 		for (int x = 0; x < wtiles; x++)
 			while (m_texcache[page][texy + y][texx + x] != nullptr)
@@ -1201,6 +1205,7 @@ void model3_state::real3d_display_list_end()
 	}
 	m_texture_fifo_pos = 0;
 
+	m_renderer->wait_for_polys();
 	m_renderer->clear_fb();
 
 	reset_triangle_buffers();
@@ -1222,12 +1227,15 @@ void model3_state::real3d_display_list_end()
 			tiacount = m_tri_alpha_buffer_ptr - tia;
 		}
 
+		// the Z buffer is shared, so each viewport waits for the previous one
+		// before clearing it; the last one is left running alongside the
+		// emulation and is only waited for when the frame is drawn
 		if (ticount > 0 || tiacount > 0)
 		{
+			m_renderer->wait_for_polys();
 			m_renderer->clear_zb();
 			m_renderer->draw_opaque_triangles(&m_tri_buffer[ti], ticount);
 			m_renderer->draw_alpha_triangles(&m_tri_alpha_buffer[tia], tiacount);
-			m_renderer->wait_for_polys();
 		}
 	}
 }
@@ -1983,6 +1991,9 @@ void model3_state::real3d_traverse_display_list()
 
 void model3_renderer::draw(bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
+	// the last viewport of the frame may still be rasterizing
+	wait();
+
 	for (int j = cliprect.min_y; j <= cliprect.max_y; ++j)
 	{
 		uint32_t *const dst = &bitmap.pix(j);
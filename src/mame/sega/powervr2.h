@@ -59,6 +59,19 @@ public:
 	//  our implementation is not currently tile based, and thus the accumulation buffer is screen sized
 	std::unique_ptr<bitmap_rgb32> fake_accumulationbuffer_bitmap;
 
+	// the accumulation buffer is rendered as horizontal bands on the work queue;
+	// each band walks the whole display list but only touches its own rows
+	static constexpr int NUM_RENDER_BANDS = 32;
+	struct render_band
+	{
+		powervr2_device *device;
+		bitmap_rgb32 *bitmap;
+		rectangle clip;
+		uint32_t background;
+	};
+	render_band render_bands[NUM_RENDER_BANDS];
+	osd_work_queue *render_work_queue;
+
 	/*
 	 * Per-polygon base and offset colors.  These are scaled by per-vertex
 	 * weights.
@@ -340,6 +353,7 @@ public:
 protected:
 	virtual void device_start() override;
 	virtual void device_reset() override;
+	virtual void device_stop() override;
 	ioport_constructor device_input_ports() const override;
 
 private:
@@ -512,7 +526,7 @@ private:
 									float const offl[4], float const offr[4]);
 
 	template <pix_sample_fn sample_fn, int group_no>
-		inline void render_span(bitmap_rgb32 &bitmap, texinfo *ti,
+		inline void render_span(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti,
 								float y0, float y1,
 								float xl, float xr,
 								float ul, float ur,
@@ -528,18 +542,20 @@ private:
 								float const doldy[4], float const dordy[4]);
 
 	template <pix_sample_fn sample_fn, int group_no>
-		inline void render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti,
+		inline void render_tri_sorted(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti,
 										const vert *v0,
 										const vert *v1, const vert *v2);
 
 	template <int group_no>
-		void render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v);
+		void render_tri(bitmap_rgb32 &bitmap, const rectangle &cliprect, texinfo *ti, const vert *v);
 
 	template <int group_no>
 		void render_group_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 
 	void sort_vertices(const vert *v, int *i0, int *i1, int *i2);
 	void render_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect);
+	void render_band_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect, uint32_t background);
+	static void *render_band_callback(void *param, int threadid);
 	void pvr_accumulationbuffer_to_framebuffer(address_space &space, int x, int y);
 	void pvr_drawframebuffer(bitmap_rgb32 &bitmap,const rectangle &cliprect);
 	static uint32_t dilate0(uint32_t value,int bits);
@@ -185,6 +185,10 @@ protected:
 	void (saturn_state::*drawpixel)(int x, int y, int patterndata, int offsetcnt);
 	void drawpixel_poly(int x, int y, int patterndata, int offsetcnt);
 	void drawpixel_8bpp_trans(int x, int y, int patterndata, int offsetcnt);
+	void drawpixel_8bpp_bank_trans(int x, int y, int patterndata, int offsetcnt);
+	void drawpixel_8bpp_notrans(int x, int y, int patterndata, int offsetcnt);
+	void drawpixel_rgb_trans(int x, int y, int patterndata, int offsetcnt);
+	void drawpixel_rgb_notrans(int x, int y, int patterndata, int offsetcnt);
 	void drawpixel_4bpp_notrans(int x, int y, int patterndata, int offsetcnt);
 	void drawpixel_4bpp_trans(int x, int y, int patterndata, int offsetcnt);
 	void drawpixel_generic(int x, int y, int patterndata, int offsetcnt);
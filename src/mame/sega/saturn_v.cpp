@@ -885,6 +885,42 @@ void saturn_state::drawpixel_8bpp_trans(int x, int y, int patterndata, int offse
 	}
 }
 
+/* 64 and 128 colour bank modes: the bank overlaps the pen bits, so add rather than or */
+void saturn_state::drawpixel_8bpp_bank_trans(int x, int y, int patterndata, int offsetcnt)
+{
+	uint16_t pix;
+
+	pix = m_vdp1.gfx_decode[(patterndata+offsetcnt) & 0xfffff] & 0xff;
+	if ( pix != 0 )
+	{
+		m_vdp1.framebuffer_draw_lines[y][x] = pix + m_sprite_colorbank;
+	}
+}
+
+void saturn_state::drawpixel_8bpp_notrans(int x, int y, int patterndata, int offsetcnt)
+{
+	uint16_t pix;
+
+	pix = m_vdp1.gfx_decode[(patterndata+offsetcnt) & 0xfffff] & 0xff;
+	m_vdp1.framebuffer_draw_lines[y][x] = pix + m_sprite_colorbank;
+}
+
+void saturn_state::drawpixel_rgb_trans(int x, int y, int patterndata, int offsetcnt)
+{
+	uint16_t pix;
+
+	pix = m_vdp1.gfx_decode[(patterndata+offsetcnt*2+1) & 0xfffff] | (m_vdp1.gfx_decode[(patterndata+offsetcnt*2) & 0xfffff]<<8);
+	if ( pix != 0 )
+	{
+		m_vdp1.framebuffer_draw_lines[y][x] = pix;
+	}
+}
+
+void saturn_state::drawpixel_rgb_notrans(int x, int y, int patterndata, int offsetcnt)
+{
+	m_vdp1.framebuffer_draw_lines[y][x] = m_vdp1.gfx_decode[(patterndata+offsetcnt*2+1) & 0xfffff] | (m_vdp1.gfx_decode[(patterndata+offsetcnt*2) & 0xfffff]<<8);
+}
+
 void saturn_state::drawpixel_4bpp_notrans(int x, int y, int patterndata, int offsetcnt)
 {
 	uint16_t pix;
@@ -1116,6 +1152,20 @@ void saturn_state::stv_vdp1_set_drawpixel()
 		m_sprite_colorbank = (stv2_current_sprite.CMDCOLR&0xff00);
 		drawpixel = &saturn_state::drawpixel_8bpp_trans;
 	}
+	else if ( (sprite_mode == 0x10 || sprite_mode == 0x18) && !spd )
+	{
+		m_sprite_colorbank = (stv2_current_sprite.CMDCOLR&((sprite_mode == 0x10) ? 0xffc0 : 0xff80));
+		drawpixel = &saturn_state::drawpixel_8bpp_bank_trans;
+	}
+	else if ( (sprite_mode == 0x10 || sprite_mode == 0x18 || sprite_mode == 0x20) && spd )
+	{
+		m_sprite_colorbank = (stv2_current_sprite.CMDCOLR&((sprite_mode == 0x10) ? 0xffc0 : (sprite_mode == 0x18) ? 0xff80 : 0xff00));
+		drawpixel = &saturn_state::drawpixel_8bpp_notrans;
+	}
+	else if (sprite_mode == 0x28)
+	{
+		drawpixel = spd ? &saturn_state::drawpixel_rgb_notrans : &saturn_state::drawpixel_rgb_trans;
+	}
 	else if ((sprite_mode == 0x00) && spd)
 	{
 		m_sprite_colorbank = (stv2_current_sprite.CMDCOLR&0xfff0);
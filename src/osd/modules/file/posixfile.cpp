@@ -51,6 +51,7 @@
 #include <cerrno>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <vector>
@@ -61,6 +62,10 @@
 #include <cstdlib>
 #include <unistd.h>
 
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#endif
+
 
 
 namespace {
@@ -93,6 +98,7 @@ public:
 
 	virtual ~posix_osd_file() override
 	{
+		unmap();
 		::close(m_fd);
 	}
 
@@ -140,6 +146,9 @@ public:
 
 	virtual std::error_condition truncate(std::uint64_t offset) noexcept override
 	{
+		// pages past the new end would fault
+		unmap();
+
 		int result;
 
 #if defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || defined(__bsdi__) || defined(__DragonFly__) || defined(__EMSCRIPTEN__) || defined(_WIN32) || defined(SDLMAME_NO64BITIO) || defined(__ANDROID__)
@@ -160,8 +169,79 @@ public:
 		return std::error_condition();
 	}
 
+	virtual std::error_condition map(void const *&data, std::uint64_t &length) noexcept override
+	{
+#if defined(_WIN32)
+		return std::errc::not_supported;
+#else
+		if (!m_map)
+		{
+			// only regular files can be mapped, and the whole file must fit in the address space
+			struct stat st;
+			if (::fstat(m_fd, &st) < 0)
+				return std::error_condition(errno, std::generic_category());
+			if (!S_ISREG(st.st_mode) || (st.st_size <= 0) || (std::uint64_t(st.st_size) > std::numeric_limits<std::size_t>::max()))
+				return std::errc::not_supported;
+
+			void *const result = ::mmap(nullptr, std::size_t(st.st_size), PROT_READ, MAP_SHARED, m_fd, 0);
+			if (MAP_FAILED == result)
+				return std::error_condition(errno, std::generic_category());
+			m_map = result;
+			m_maplength = std::size_t(st.st_size);
+		}
+
+		data = m_map;
+		length = m_maplength;
+		return std::error_condition();
+#endif
+	}
+
+	virtual std::error_condition map_private(std::uint64_t offset, std::uint64_t length, void *&data) noexcept override
+	{
+#if defined(_WIN32)
+		return std::errc::not_supported;
+#else
+		if (m_map)
+			return std::errc::device_or_resource_busy;
+
+		// pages past the end of the file would fault
+		struct stat st;
+		if (::fstat(m_fd, &st) < 0)
+			return std::error_condition(errno, std::generic_category());
+		if (!S_ISREG(st.st_mode) || !length || (offset > std::uint64_t(st.st_size)) || (length > (std::uint64_t(st.st_size) - offset)))
+			return std::errc::invalid_argument;
+
+		// the mapping has to start on a page boundary
+		std::uint64_t const pagesize = std::uint64_t(::sysconf(_SC_PAGESIZE));
+		std::uint64_t const start = offset - (offset % pagesize);
+		std::uint64_t const total = length + (offset - start);
+		if ((total > std::numeric_limits<std::size_t>::max()) || (start > std::uint64_t(std::numeric_limits<off_t>::max())))
+			return std::errc::not_supported;
+
+		void *const result = ::mmap(nullptr, std::size_t(total), PROT_READ | PROT_WRITE, MAP_PRIVATE, m_fd, off_t(start));
+		if (MAP_FAILED == result)
+			return std::error_condition(errno, std::generic_category());
+		m_map = result;
+		m_maplength = std::size_t(total);
+		data = reinterpret_cast<std::uint8_t *>(result) + (offset - start);
+		return std::error_condition();
+#endif
+	}
+
+	virtual void unmap() noexcept override
+	{
+#if !defined(_WIN32)
+		if (m_map)
+			::munmap(m_map, m_maplength);
+#endif
+		m_map = nullptr;
+		m_maplength = 0U;
+	}
+
 private:
 	int m_fd;
+	void *m_map = nullptr;
+	std::size_t m_maplength = 0U;
 };
 
 
@@ -231,6 +311,8 @@ std::error_condition osd_file::open(std::string const &path, std::uint32_t openf
 		return posix_open_ptty(openflags, file, filesize, dst);
 	else if (posix_check_domain_path(path))
 		return posix_open_domain(path, openflags, file, filesize);
+	else if (posix_check_shmem_path(path))
+		return posix_open_shmem(path, openflags, file, filesize);
 
 	// select the file open modes
 	int access;
@@ -29,6 +29,9 @@ std::error_condition posix_open_socket(std::string const &path, std::uint32_t op
 bool posix_check_domain_path(std::string const &path) noexcept;
 std::error_condition posix_open_domain(std::string const &path, std::uint32_t openflags, osd_file::ptr &file, std::uint64_t &filesize) noexcept;
 
+bool posix_check_shmem_path(std::string const &path) noexcept;
+std::error_condition posix_open_shmem(std::string const &path, std::uint32_t openflags, osd_file::ptr &file, std::uint64_t &filesize) noexcept;
+
 bool posix_check_ptty_path(std::string const &path) noexcept;
 std::error_condition posix_open_ptty(std::uint32_t openflags, osd_file::ptr &file, std::uint64_t &filesize, std::string &name) noexcept;
 
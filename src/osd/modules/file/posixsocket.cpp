@@ -2,8 +2,8 @@
 // copyright-holders:Olivier Galibert, R. Belmont, Vas Crabb
 //============================================================
 //
-//  sdlsocket.c - SDL socket (inet, unix domain) access
-//  functions
+//  sdlsocket.c - SDL socket (inet, unix domain) and shared
+//  memory link access functions
 //
 //  SDLMAME by Olivier Galibert and R. Belmont
 //
@@ -11,6 +11,8 @@
 
 #include "posixfile.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cerrno>
 #include <cstdio>
@@ -21,8 +23,10 @@
 #include <netdb.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <sys/mman.h>
 #include <sys/select.h>
 #include <sys/socket.h>
+#include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/un.h>
 #include <unistd.h>
@@ -32,6 +36,7 @@ namespace {
 
 char const *const posixfile_socket_identifier  = "socket.";
 char const *const posixfile_domain_identifier  = "domain.";
+char const *const posixfile_shmem_identifier   = "shmem.";
 
 
 class posix_osd_socket : public osd_file
@@ -185,6 +190,103 @@ std::error_condition create_socket(T const &sa, int sock, std::uint32_t openflag
 	return std::error_condition();
 }
 
+
+// one direction of a shared memory link: a single producer, single consumer
+// byte ring shared between two processes
+struct shmem_ring
+{
+	static constexpr std::uint32_t SIZE = 0x10000;
+
+	std::atomic<std::uint32_t> head;
+	std::atomic<std::uint32_t> tail;
+	std::uint8_t data[SIZE];
+};
+
+struct shmem_link
+{
+	shmem_ring ring[2];
+};
+
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "shared memory link needs lock-free atomics");
+
+
+class posix_osd_shmem : public osd_file
+{
+public:
+	posix_osd_shmem(posix_osd_shmem const &) = delete;
+	posix_osd_shmem(posix_osd_shmem &&) = delete;
+	posix_osd_shmem& operator=(posix_osd_shmem const &) = delete;
+	posix_osd_shmem& operator=(posix_osd_shmem &&) = delete;
+
+	posix_osd_shmem(shmem_link *link, std::string &&name, bool creator) noexcept
+		: m_link(link)
+		, m_name(std::move(name))
+		, m_creator(creator)
+		, m_rx(link->ring[creator ? 1 : 0])
+		, m_tx(link->ring[creator ? 0 : 1])
+	{
+	}
+
+	virtual ~posix_osd_shmem()
+	{
+		::munmap(m_link, sizeof(*m_link));
+		if (m_creator)
+			::shm_unlink(m_name.c_str());
+	}
+
+	virtual std::error_condition read(void *buffer, std::uint64_t offset, std::uint32_t count, std::uint32_t &actual) noexcept override
+	{
+		std::uint32_t const tail = m_rx.tail.load(std::memory_order_relaxed);
+		std::uint32_t const avail = m_rx.head.load(std::memory_order_acquire) - tail;
+		actual = std::min(count, avail);
+		if (!actual)
+			return std::errc::operation_would_block;
+
+		std::uint32_t const start = tail & (shmem_ring::SIZE - 1);
+		std::uint32_t const first = std::min(actual, shmem_ring::SIZE - start);
+		std::memcpy(buffer, &m_rx.data[start], first);
+		std::memcpy(reinterpret_cast<std::uint8_t *>(buffer) + first, &m_rx.data[0], actual - first);
+		m_rx.tail.store(tail + actual, std::memory_order_release);
+		return std::error_condition();
+	}
+
+	virtual std::error_condition write(void const *buffer, std::uint64_t offset, std::uint32_t count, std::uint32_t &actual) noexcept override
+	{
+		// like a full socket buffer, a full ring accepts a short write
+		std::uint32_t const head = m_tx.head.load(std::memory_order_relaxed);
+		std::uint32_t const space = shmem_ring::SIZE - (head - m_tx.tail.load(std::memory_order_acquire));
+		actual = std::min(count, space);
+		if (!actual)
+			return count ? std::errc::operation_would_block : std::error_condition();
+
+		std::uint32_t const start = head & (shmem_ring::SIZE - 1);
+		std::uint32_t const first = std::min(actual, shmem_ring::SIZE - start);
+		std::memcpy(&m_tx.data[start], buffer, first);
+		std::memcpy(&m_tx.data[0], reinterpret_cast<std::uint8_t const *>(buffer) + first, actual - first);
+		m_tx.head.store(head + actual, std::memory_order_release);
+		return std::error_condition();
+	}
+
+	virtual std::error_condition truncate(std::uint64_t offset) noexcept override
+	{
+		// doesn't make sense on a link
+		return std::errc::bad_file_descriptor;
+	}
+
+	virtual std::error_condition flush() noexcept override
+	{
+		// writes are visible to the other side as soon as they're made
+		return std::error_condition();
+	}
+
+private:
+	shmem_link *const   m_link;
+	std::string const   m_name;
+	bool const          m_creator;
+	shmem_ring &        m_rx;
+	shmem_ring &        m_tx;
+};
+
 } // anonymous namespace
 
 
@@ -262,3 +364,62 @@ std::error_condition posix_open_domain(std::string const &path, std::uint32_t op
 
 	return create_socket(sau, sock, openflags, file, filesize);
 }
+
+
+/*
+    Checks whether the path is a shared memory link specification. A valid
+    specification has the format "shmem." name. The instance that opens the
+    link with OPEN_FLAG_CREATE owns it, like a listening socket; the other
+    instance must open it without that flag once it exists.
+*/
+bool posix_check_shmem_path(std::string const &path) noexcept
+{
+	if (strncmp(path.c_str(), posixfile_shmem_identifier, strlen(posixfile_shmem_identifier)) == 0 &&
+		path.length() > strlen(posixfile_shmem_identifier)) return true;
+	return false;
+}
+
+
+std::error_condition posix_open_shmem(std::string const &path, std::uint32_t openflags, osd_file::ptr &file, std::uint64_t &filesize) noexcept
+{
+	std::string name;
+	try { name = "/mame-" + path.substr(strlen(posixfile_shmem_identifier)); }
+	catch (...) { return std::errc::not_enough_memory; }
+
+	bool const creator = openflags & OPEN_FLAG_CREATE;
+	int const fd = ::shm_open(name.c_str(), creator ? (O_RDWR | O_CREAT | O_TRUNC) : O_RDWR, 0600);
+	if (fd < 0)
+		return std::error_condition(errno, std::generic_category());
+
+	if (creator && (::ftruncate(fd, sizeof(shmem_link)) < 0))
+	{
+		std::error_condition truncerr(errno, std::generic_category());
+		::close(fd);
+		::shm_unlink(name.c_str());
+		return truncerr;
+	}
+
+	void *const mem = ::mmap(nullptr, sizeof(shmem_link), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	std::error_condition const maperr((mem == MAP_FAILED) ? errno : 0, std::generic_category());
+	::close(fd);
+	if (mem == MAP_FAILED)
+	{
+		if (creator)
+			::shm_unlink(name.c_str());
+		return maperr;
+	}
+
+	// a freshly truncated object is zero-filled, so both rings start empty
+	shmem_link *const link = reinterpret_cast<shmem_link *>(mem);
+	osd_file::ptr result(new (std::nothrow) posix_osd_shmem(link, std::move(name), creator));
+	if (!result)
+	{
+		::munmap(mem, sizeof(shmem_link));
+		if (creator)
+			::shm_unlink(name.c_str());
+		return std::errc::not_enough_memory;
+	}
+	file = std::move(result);
+	filesize = 0;
+	return std::error_condition();
+}
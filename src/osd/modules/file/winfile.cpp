@@ -19,6 +19,7 @@
 
 #include <cassert>
 #include <cstring>
+#include <limits>
 #include <memory>
 
 // standard windows headers
@@ -52,6 +53,7 @@ public:
 
 	virtual ~win_osd_file() override
 	{
+		unmap();
 		FlushFileBuffers(m_handle);
 		CloseHandle(m_handle);
 	}
@@ -92,6 +94,9 @@ public:
 
 	virtual std::error_condition truncate(std::uint64_t offset) noexcept override
 	{
+		// the end of a file can't be moved while a view is mapped
+		unmap();
+
 		// attempt to set the file pointer
 		LARGE_INTEGER largeOffset;
 		largeOffset.QuadPart = offset;
@@ -111,8 +116,81 @@ public:
 		return std::error_condition();
 	}
 
+	virtual std::error_condition map(void const *&data, std::uint64_t &length) noexcept override
+	{
+		if (!m_view)
+		{
+			// the whole file must fit in the address space
+			LARGE_INTEGER size;
+			if (!GetFileSizeEx(m_handle, &size))
+				return win_error_to_error_condition(GetLastError());
+			if ((size.QuadPart <= 0) || (std::uint64_t(size.QuadPart) > (std::numeric_limits<SIZE_T>::max)()))
+				return std::errc::not_supported;
+
+			// the view keeps the mapping object alive after its handle is closed
+			HANDLE const mapping = CreateFileMapping(m_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (!mapping)
+				return win_error_to_error_condition(GetLastError());
+			void const *const view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			DWORD const err = GetLastError();
+			CloseHandle(mapping);
+			if (!view)
+				return win_error_to_error_condition(err);
+			m_view = view;
+			m_viewlength = std::uint64_t(size.QuadPart);
+		}
+
+		data = m_view;
+		length = m_viewlength;
+		return std::error_condition();
+	}
+
+	virtual std::error_condition map_private(std::uint64_t offset, std::uint64_t length, void *&data) noexcept override
+	{
+		if (m_view)
+			return std::errc::device_or_resource_busy;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(m_handle, &size))
+			return win_error_to_error_condition(GetLastError());
+		if (!length || (offset > std::uint64_t(size.QuadPart)) || (length > (std::uint64_t(size.QuadPart) - offset)))
+			return std::errc::invalid_argument;
+
+		// views have to start on an allocation granularity boundary
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		std::uint64_t const start = offset - (offset % info.dwAllocationGranularity);
+		std::uint64_t const total = length + (offset - start);
+		if (total > (std::numeric_limits<SIZE_T>::max)())
+			return std::errc::not_supported;
+
+		// the view keeps the mapping object alive after its handle is closed
+		HANDLE const mapping = CreateFileMapping(m_handle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+		if (!mapping)
+			return win_error_to_error_condition(GetLastError());
+		void *const view = MapViewOfFile(mapping, FILE_MAP_COPY, DWORD(start >> 32), DWORD(start), SIZE_T(total));
+		DWORD const err = GetLastError();
+		CloseHandle(mapping);
+		if (!view)
+			return win_error_to_error_condition(err);
+		m_view = view;
+		m_viewlength = total;
+		data = reinterpret_cast<std::uint8_t *>(view) + (offset - start);
+		return std::error_condition();
+	}
+
+	virtual void unmap() noexcept override
+	{
+		if (m_view)
+			UnmapViewOfFile(m_view);
+		m_view = nullptr;
+		m_viewlength = 0U;
+	}
+
 private:
 	HANDLE m_handle;
+	void const *m_view = nullptr;
+	std::uint64_t m_viewlength = 0U;
 };
 
 
@@ -242,6 +242,13 @@ void *virtual_memory_allocation::do_alloc(std::initializer_list<std::size_t> blo
 	void *const result(mmap(nullptr, s, prot, MAP_ANON | MAP_SHARED, fd, 0));
 	if (result == (void *)-1)
 		return nullptr;
+#if defined(MADV_HUGEPAGE)
+	// large blocks such as recompiler code caches suffer fewer TLB misses when
+	// backed by huge pages; this is only advice, and access can still be set
+	// with normal page granularity
+	if (s >= (std::size_t(2) << 20))
+		madvise(result, s, MADV_HUGEPAGE);
+#endif
 	size = s;
 	page_size = p;
 	return result;
@@ -144,6 +144,7 @@ const options_entry osd_options::s_option_entries[] =
 	{ nullptr,                                   nullptr,          core_options::option_type::HEADER,    "OSD SOUND OPTIONS" },
 	{ OSDOPTION_SOUND,                           OSDOPTVAL_AUTO,   core_options::option_type::STRING,    "sound output method: " },
 	{ OSDOPTION_AUDIO_LATENCY "(0-5)",           "2",              core_options::option_type::INTEGER,   "set audio latency (increase to reduce glitches, decrease for responsiveness)" },
+	{ OSDOPTION_AUDIO_RATE_CONTROL,              "1",              core_options::option_type::BOOLEAN,   "stretch audio slightly to keep the output buffer at its target level" },
 
 #ifndef NO_USE_PORTAUDIO
 	{ nullptr,                                   nullptr,          core_options::option_type::HEADER,    "PORTAUDIO OPTIONS" },
@@ -181,6 +182,9 @@ const options_entry osd_options::s_option_entries[] =
 	{ OSDOPTION_BGFX_SHADOW_MASK,                "slot-mask.png",   core_options::option_type::STRING,   "shadow mask texture name" },
 	{ OSDOPTION_BGFX_LUT,                        "lut-default.png", core_options::option_type::STRING,   "LUT texture name" },
 	{ OSDOPTION_BGFX_AVI_NAME,                   OSDOPTVAL_AUTO,    core_options::option_type::PATH,     "filename for BGFX output logging" },
+	{ OSDOPTION_BGFX_CACHE_PATH,                 "",                core_options::option_type::PATH,     "path to cache compiled BGFX shader programs in (empty to disable)" },
+	{ OSDOPTION_BGFX_RENDER_THREAD,              "1",               core_options::option_type::BOOLEAN,  "submit, present and wait for vertical sync on a separate BGFX render thread" },
+	{ OSDOPTION_BGFX_FRAME_LATENCY,              "0",               core_options::option_type::INTEGER,  "maximum number of frames queued for the GPU (1-3, 0 for backend default)" },
 
 	// End of list
 	{ nullptr }
@@ -538,6 +542,18 @@ void osd_common_t::set_mastervolume(int attenuation)
 }
 
 
+//-------------------------------------------------
+//  audio_buffer_fill - return the number of
+//  stereo samples waiting to be played, or -1 if
+//  unknown
+//-------------------------------------------------
+
+int osd_common_t::audio_buffer_fill()
+{
+	return m_sound ? m_sound->buffered_samples() : -1;
+}
+
+
 //-------------------------------------------------
 //  customize_input_type_list - provide OSD
 //  additions/modifications to the input list
@@ -665,9 +681,12 @@ bool osd_common_t::execute_command(const char *command)
 
 }
 
-static void output_notifier_callback(const char *outname, int32_t value, void *param)
+static void output_notifier_callback(output_manager::output_change const *changes, size_t count, void *param)
 {
-	static_cast<osd_common_t*>(param)->notify(outname, value);
+	// output modules get the latest value of each output once per frame
+	auto const &osd = *static_cast<osd_common_t*>(param);
+	for (size_t i = 0; i < count; i++)
+		osd.notify(changes[i].name, changes[i].value);
 }
 
 void osd_common_t::init_subsystems()
@@ -701,7 +720,7 @@ void osd_common_t::init_subsystems()
 	m_midi = &select_module_options<midi_module>(OSD_MIDI_PROVIDER);
 
 	m_output = &select_module_options<output_module>(OSD_OUTPUT_PROVIDER);
-	machine().output().set_global_notifier(output_notifier_callback, this);
+	machine().output().set_global_batch_notifier(output_notifier_callback, this);
 
 	input_init();
 }
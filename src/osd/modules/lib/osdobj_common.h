@@ -79,6 +79,7 @@
 
 #define OSDOPTION_SOUND                 "sound"
 #define OSDOPTION_AUDIO_LATENCY         "audio_latency"
+#define OSDOPTION_AUDIO_RATE_CONTROL    "audio_rate_control"
 
 #define OSDOPTION_PA_API                "pa_api"
 #define OSDOPTION_PA_DEVICE             "pa_device"
@@ -98,6 +99,9 @@
 #define OSDOPTION_BGFX_SHADOW_MASK      "bgfx_shadow_mask"
 #define OSDOPTION_BGFX_LUT              "bgfx_lut"
 #define OSDOPTION_BGFX_AVI_NAME         "bgfx_avi_name"
+#define OSDOPTION_BGFX_CACHE_PATH       "bgfx_cache_path"
+#define OSDOPTION_BGFX_RENDER_THREAD    "bgfx_render_thread"
+#define OSDOPTION_BGFX_FRAME_LATENCY    "bgfx_frame_latency"
 
 #define OSDOPTVAL_AUTO                  "auto"
 #define OSDOPTVAL_NONE                  "none"
@@ -166,6 +170,7 @@ public:
 	// sound options
 	const char *sound() const { return value(OSDOPTION_SOUND); }
 	int audio_latency() const { return int_value(OSDOPTION_AUDIO_LATENCY); }
+	bool audio_rate_control() const { return bool_value(OSDOPTION_AUDIO_RATE_CONTROL); }
 
 	// CoreAudio specific options
 	const char *audio_output() const { return value(OSDOPTION_AUDIO_OUTPUT); }
@@ -179,6 +184,9 @@ public:
 	const char *bgfx_shadow_mask() const { return value(OSDOPTION_BGFX_SHADOW_MASK); }
 	const char *bgfx_lut() const { return value(OSDOPTION_BGFX_LUT); }
 	const char *bgfx_avi_name() const { return value(OSDOPTION_BGFX_AVI_NAME); }
+	const char *bgfx_cache_path() const { return value(OSDOPTION_BGFX_CACHE_PATH); }
+	bool bgfx_render_thread() const { return bool_value(OSDOPTION_BGFX_RENDER_THREAD); }
+	int bgfx_frame_latency() const { return int_value(OSDOPTION_BGFX_FRAME_LATENCY); }
 
 	// PortAudio options
 	const char *pa_api() const { return value(OSDOPTION_PA_API); }
@@ -224,6 +232,7 @@ public:
 	virtual void update_audio_stream(const int16_t *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
 	virtual bool no_sound() override;
+	virtual int audio_buffer_fill() override;
 
 	// input overridables
 	virtual void customize_input_type_list(std::vector<input_type_entry> &typelist) override;
@@ -141,12 +141,13 @@ static void netdev_pcap_handler(u_char *user, const struct pcap_pkthdr *h, const
 
 	if(!ctx->p) return;
 
+	if(h->caplen > sizeof(ctx->packets[0])) return;
 	if(OSAtomicCompareAndSwapInt((ctx->head+1) & 0x1F, ctx->tail, &ctx->tail)) {
-		printf("buffer full, dropping packet\n");
+		osd_printf_verbose("pcap: buffer full, dropping packet\n");
 		return;
 	}
-	memcpy(ctx->packets[ctx->head], bytes, h->len);
-	ctx->packetlens[ctx->head] = h->len;
+	memcpy(ctx->packets[ctx->head], bytes, h->caplen);
+	ctx->packetlens[ctx->head] = h->caplen;
 	OSAtomicCompareAndSwapInt(ctx->head, (ctx->head+1) & 0x1F, &ctx->head);
 }
 
@@ -185,6 +186,7 @@ netdev_pcap::netdev_pcap(const char *name, network_handler &ifdev)
 	netdev_pcap::set_mac(&get_mac()[0]);
 
 #ifdef SDLMAME_MACOSX
+	m_ctx.pkt = nullptr;
 	m_ctx.head = 0;
 	m_ctx.tail = 0;
 	m_ctx.p = m_p;
@@ -217,30 +219,29 @@ int netdev_pcap::send(uint8_t *buf, int len)
 		return 0;
 	}
 	ret = (*module->pcap_sendpacket_dl)(m_p, buf, len);
-	printf("sent packet length %d, returned %d\n", len, ret);
-	return ret ? len : 0;
-	//return (!pcap_sendpacket_dl(m_p, buf, len))?len:0;
+	return ret ? 0 : len;
 }
 
 int netdev_pcap::recv_dev(uint8_t **buf)
 {
 #ifdef SDLMAME_MACOSX
-	uint8_t pktbuf[2048];
-	int ret;
-
 	// no device open?
 	if(!m_p) return 0;
 
+	// the slot handed out last time stays owned by the caller until now, so
+	// the blocker thread can't overwrite a frame that is still being read
+	if(m_ctx.pkt) {
+		OSAtomicCompareAndSwapInt(m_ctx.tail, (m_ctx.tail+1) & 0x1F, &m_ctx.tail);
+		m_ctx.pkt = nullptr;
+	}
+
 	// Empty
 	if(OSAtomicCompareAndSwapInt(m_ctx.head, m_ctx.tail, &m_ctx.tail)) {
 		return 0;
 	}
 
-	memcpy(pktbuf, m_ctx.packets[m_ctx.tail], m_ctx.packetlens[m_ctx.tail]);
-	ret = m_ctx.packetlens[m_ctx.tail];
-	OSAtomicCompareAndSwapInt(m_ctx.tail, (m_ctx.tail+1) & 0x1F, &m_ctx.tail);
-	*buf = pktbuf;
-	return ret;
+	*buf = m_ctx.pkt = m_ctx.packets[m_ctx.tail];
+	return m_ctx.packetlens[m_ctx.tail];
 #else
 	struct pcap_pkthdr *header;
 	if(!m_p) return 0;
@@ -211,7 +211,7 @@ int netdev_tap::recv_dev(uint8_t **buf)
 	{
 		// start a new asynchronous read
 		m_overlapped = {};
-		if (ReadFile(m_handle, m_buf, sizeof(m_buf), &bytes_transferred, &m_overlapped))
+		if (ReadFile(m_handle, m_buf, sizeof(m_buf) - 4, &bytes_transferred, &m_overlapped))
 		{
 			// handle unexpected synchronous completion
 			*buf = m_buf;
@@ -340,8 +340,9 @@ int netdev_tap::recv_dev(uint8_t **buf)
 	if(m_fd == -1) return 0;
 	// exit if we didn't receive anything, got an error, got a broadcast or multicast packet,
 	// are in promiscuous mode or got a packet with our mac.
+	// The read is short by four bytes to leave room for the FCS.
 	do {
-		len = read(m_fd, m_buf, sizeof(m_buf));
+		len = read(m_fd, m_buf, sizeof(m_buf) - 4);
 	} while((len > 0) && memcmp(&get_mac()[0], m_buf, 6) && !get_promisc() && !(m_buf[0] & 1));
 
 	if (len > 0)
@@ -92,7 +92,7 @@ void avi_write::begin_avi_recording(std::string_view name)
 		tempfile.close();
 
 		// create the file and free the string
-		avi_file::error avierr = avi_file::create(fullpath, info, m_output_file);
+		avi_file::error avierr = avi_file::create(fullpath, info, m_output_file, true);
 		if (avierr != avi_file::error::NONE)
 		{
 			osd_printf_error("Error creating AVI: %s\n", avi_file::error_string(avierr));
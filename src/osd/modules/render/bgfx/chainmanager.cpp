@@ -14,8 +14,9 @@
 #include <bx/readerwriter.h>
 #include <bx/file.h>
 
-#include "emucore.h"
+#include "emu.h"
 #include "render.h"
+#include "screen.h"
 #include "../frontend/mame/ui/slider.h"
 
 #include "modules/lib/osdobj_common.h"
@@ -83,6 +84,9 @@ chain_manager::chain_manager(
 	, m_screen_count(0)
 	, m_default_chain_index(-1)
 {
+	// bgfx references screen bitmaps for a couple of frames rather than copying them
+	machine.render().request_screen_buffers(3);
+
 	m_converters.clear();
 	refresh_available_chains();
 	parse_chain_selections(options.bgfx_screen_chains());
@@ -553,15 +557,27 @@ uint32_t chain_manager::update_screen_textures(uint32_t view, render_primitive *
 			palette = nullptr;
 		}
 
+		const render_texinfo &texinfo = prim.m_prim->texture;
+		while (screen >= m_screen_uploads.size())
+		{
+			m_screen_uploads.push_back({ ~0ULL, 0 });
+		}
+		screen_upload &upload = m_screen_uploads[screen];
+
+		// a screen rotating through three bitmaps won't redraw this one until bgfx is done with it
+		const screen_device *const device = prim.m_prim->container ? prim.m_prim->container->screen() : nullptr;
+		const bool reference = device && device->bitmap_buffers() >= 3;
+
 		bgfx::TextureFormat::Enum dst_format = bgfx::TextureFormat::BGRA8;
 		uint16_t pitch = prim.m_rowpixels;
 		int width_div_factor = 1;
 		int width_mul_factor = 1;
-		const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, prim.m_flags & PRIMFLAG_TEXFORMAT_MASK,
-			prim.m_rowpixels, prim.m_prim->texture.width_margin, tex_height, prim.m_prim->texture.palette, prim.m_prim->texture.base, pitch, width_div_factor, width_mul_factor);
 
 		if (!texture)
 		{
+			const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, prim.m_flags & PRIMFLAG_TEXFORMAT_MASK,
+				prim.m_rowpixels, texinfo.width_margin, tex_height, texinfo.palette, texinfo.base, pitch, width_div_factor, width_mul_factor, reference);
+
 			uint32_t flags = BGFX_SAMPLER_MIN_POINT | BGFX_SAMPLER_MAG_POINT | BGFX_SAMPLER_MIP_POINT;
 			if (!PRIMFLAG_GET_TEXWRAP(prim.m_flags))
 				flags |= BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP;
@@ -596,9 +612,23 @@ uint32_t chain_manager::update_screen_textures(uint32_t view, render_primitive *
 				m_screen_palettes[screen] = palette;
 			}
 		}
-		else
+		else if (upload.unique_id != texinfo.unique_id || upload.seqid != texinfo.seqid)
 		{
-			texture->update(mem, pitch, prim.m_prim->texture.width_margin);
+			if (texinfo.dirty_seqid == 0 || upload.unique_id != texinfo.unique_id || upload.seqid != texinfo.dirty_seqid)
+			{
+				const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, prim.m_flags & PRIMFLAG_TEXFORMAT_MASK,
+					prim.m_rowpixels, texinfo.width_margin, tex_height, texinfo.palette, texinfo.base, pitch, width_div_factor, width_mul_factor, reference);
+				texture->update(mem, pitch, texinfo.width_margin);
+			}
+			else if (texinfo.dirty_height != 0)
+			{
+				// only some rows changed since the version we uploaded last
+				const int src_bytes = (src_format == TEXFORMAT_PALETTE16 || src_format == TEXFORMAT_YUY16) ? 2 : 4;
+				uint8_t *const rowbase = reinterpret_cast<uint8_t *>(texinfo.base) + texinfo.dirty_top * prim.m_rowpixels * src_bytes;
+				const bgfx::Memory* mem = bgfx_util::mame_texture_data_to_bgfx_texture_data(dst_format, prim.m_flags & PRIMFLAG_TEXFORMAT_MASK,
+					prim.m_rowpixels, texinfo.width_margin, texinfo.dirty_height, texinfo.palette, rowbase, pitch, width_div_factor, width_mul_factor, reference);
+				texture->update_rows(mem, pitch, texinfo.width_margin, texinfo.dirty_top, texinfo.dirty_height);
+			}
 
 			if (prim.m_prim->texture.palette)
 			{
@@ -626,6 +656,7 @@ uint32_t chain_manager::update_screen_textures(uint32_t view, render_primitive *
 				}
 			}
 		}
+		upload = { texinfo.unique_id, texinfo.seqid };
 
 		const bool has_tint = (prim.m_prim->color.a != 1.0f) || (prim.m_prim->color.r != 1.0f) || (prim.m_prim->color.g != 1.0f) || (prim.m_prim->color.b != 1.0f);
 		bgfx_chain* chain = screen_chain(screen);
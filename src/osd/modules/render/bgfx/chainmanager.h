@@ -153,6 +153,14 @@ private:
 	std::vector<screen_prim>    m_screen_prims;
 	std::vector<uint8_t>        m_palette_temp;
 
+	// texture version last uploaded for each screen, for partial updates
+	struct screen_upload
+	{
+		uint64_t unique_id;
+		uint32_t seqid;
+	};
+	std::vector<screen_upload>  m_screen_uploads;
+
 	static inline constexpr uint32_t CHAIN_NONE = 0;
 };
 
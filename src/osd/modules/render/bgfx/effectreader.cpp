@@ -135,13 +135,13 @@ bool effect_reader::get_shader_data(
 		std::string &fragment_name,
 		bgfx::ShaderHandle &fragment_shader)
 {
-	vertex_shader = shaders.load_shader(options, vertex_name);
+	vertex_shader = shaders.get_or_load_shader(options, vertex_name);
 	if (vertex_shader.idx == bgfx::kInvalidHandle)
 	{
 		return false;
 	}
 
-	fragment_shader = shaders.load_shader(options, fragment_name);
+	fragment_shader = shaders.get_or_load_shader(options, fragment_name);
 	if (fragment_shader.idx == bgfx::kInvalidHandle)
 	{
 		return false;
@@ -63,3 +63,9 @@ void bgfx_texture::update(const bgfx::Memory *data, uint16_t pitch, uint16_t wid
 	m_width_margin = width_margin;
 	bgfx::updateTexture2D(m_texture, 0, 0, 0, 0, (m_rowpixels * m_width_mul_factor) / m_width_div_factor, m_height, data, pitch);
 }
+
+void bgfx_texture::update_rows(const bgfx::Memory *data, uint16_t pitch, uint16_t width_margin, uint16_t top, uint16_t height)
+{
+	m_width_margin = width_margin;
+	bgfx::updateTexture2D(m_texture, 0, 0, 0, top, (m_rowpixels * m_width_mul_factor) / m_width_div_factor, height, data, pitch);
+}
@@ -39,6 +39,7 @@ public:
 	virtual int width_mul_factor() const override { return m_width_mul_factor; }
 
 	void update(const bgfx::Memory *data, uint16_t pitch = UINT16_MAX, uint16_t width_margin = 0);
+	void update_rows(const bgfx::Memory *data, uint16_t pitch, uint16_t width_margin, uint16_t top, uint16_t height);
 
 protected:
 	std::string                 m_name;
@@ -14,12 +14,14 @@
 #include "render.h"
 
 
-const bgfx::Memory* bgfx_util::mame_texture_data_to_bgfx_texture_data(bgfx::TextureFormat::Enum &dst_format, uint32_t src_format, int rowpixels, int width_margin, int height, const rgb_t *palette, void *base, uint16_t &out_pitch, int &width_div_factor, int &width_mul_factor)
+const bgfx::Memory* bgfx_util::mame_texture_data_to_bgfx_texture_data(bgfx::TextureFormat::Enum &dst_format, uint32_t src_format, int rowpixels, int width_margin, int height, const rgb_t *palette, void *base, uint16_t &out_pitch, int &width_div_factor, int &width_mul_factor, bool reference)
 {
 	bgfx::TextureInfo info;
 	const bgfx::Memory *data = nullptr;
 	uint8_t *adjusted_base = (uint8_t *)base;
 
+	// when the caller guarantees the source stays untouched until bgfx has
+	// consumed it, hand bgfx the bitmap memory itself rather than a copy
 	switch (src_format)
 	{
 		case PRIMFLAG_TEXFORMAT(TEXFORMAT_YUY16):
@@ -33,7 +35,7 @@ const bgfx::Memory* bgfx_util::mame_texture_data_to_bgfx_texture_data(bgfx::Text
 			{
 				adjusted_base -= width_margin * 2;
 			}
-			data = bgfx::copy(adjusted_base, info.storageSize);
+			data = reference ? bgfx::makeRef(adjusted_base, info.storageSize) : bgfx::copy(adjusted_base, info.storageSize);
 			break;
 		case PRIMFLAG_TEXFORMAT(TEXFORMAT_PALETTE16):
 			dst_format = bgfx::TextureFormat::R8;
@@ -46,7 +48,7 @@ const bgfx::Memory* bgfx_util::mame_texture_data_to_bgfx_texture_data(bgfx::Text
 			{
 				adjusted_base -= width_margin * 2;
 			}
-			data = bgfx::copy(adjusted_base, info.storageSize);
+			data = reference ? bgfx::makeRef(adjusted_base, info.storageSize) : bgfx::copy(adjusted_base, info.storageSize);
 			break;
 		case PRIMFLAG_TEXFORMAT(TEXFORMAT_ARGB32):
 		case PRIMFLAG_TEXFORMAT(TEXFORMAT_RGB32):
@@ -60,7 +62,7 @@ const bgfx::Memory* bgfx_util::mame_texture_data_to_bgfx_texture_data(bgfx::Text
 			{
 				adjusted_base -= width_margin * 4;
 			}
-			data = bgfx::copy(adjusted_base, info.storageSize);
+			data = reference ? bgfx::makeRef(adjusted_base, info.storageSize) : bgfx::copy(adjusted_base, info.storageSize);
 			break;
 	}
 
@@ -29,6 +29,7 @@
 
 #define MAX_BLOOM_COUNT 15 // shader model 3.0 support up to 16 samplers, but we need the last for the original texture
 #define HALF_BLOOM_COUNT 8
+#define RENDER_TARGET_POOL_SIZE 4 // retired render targets kept for reuse
 
 //============================================================
 //  FORWARD DECLARATIONS
@@ -127,7 +128,7 @@ public:
 
 	uint32_t                get_flags() const { return m_flags; }
 
-	void                    set_data(const render_texinfo *texsource, uint32_t flags);
+	void                    set_data(const render_texinfo *texsource, uint32_t flags, int top, int height);
 
 	uint32_t                get_hash() const { return m_hash; }
 
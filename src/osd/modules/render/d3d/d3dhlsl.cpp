@@ -364,6 +364,11 @@ void shaders::remove_render_target(d3d_render_target *rt)
 	{
 		if ((*it).get() == rt)
 		{
+			// keep a few retired targets around, since windows and screens
+			// tend to switch back and forth between the same sizes
+			if (m_render_target_pool.size() >= RENDER_TARGET_POOL_SIZE)
+				m_render_target_pool.erase(m_render_target_pool.begin());
+			m_render_target_pool.push_back(std::move(*it));
 			m_render_target_list.erase(it);
 			break;
 		}
@@ -1822,6 +1827,22 @@ bool shaders::add_render_target(renderer_d3d9* d3d, render_primitive *prim, int
 {
 	remove_render_target(find_render_target(source_width, source_height, source_screen));
 
+	// reuse a pooled target with the same dimensions if there is one
+	for (auto it = m_render_target_pool.begin(); it != m_render_target_pool.end(); it++)
+	{
+		d3d_render_target &pooled = **it;
+		if (pooled.width == source_width && pooled.height == source_height && pooled.screen_index == source_screen &&
+			pooled.target_width == target_width && pooled.target_height == target_height)
+		{
+			// don't let the previous phosphor persistence show through
+			d3d->get_device()->ColorFill(pooled.cache_surface.Get(), nullptr, D3DCOLOR_ARGB(0, 0, 0, 0));
+
+			m_render_target_list.push_back(std::move(*it));
+			m_render_target_pool.erase(it);
+			return true;
+		}
+	}
+
 	auto target = std::make_unique<d3d_render_target>();
 
 	if (!target->init(d3d, source_width, source_height, target_width, target_height, source_screen))
@@ -1888,6 +1909,7 @@ void shaders::delete_resources()
 	}
 
 	m_render_target_list.clear();
+	m_render_target_pool.clear();
 
 	downsample_effect.reset();
 	bloom_effect.reset();
@@ -450,6 +450,7 @@ private:
 	poly_info *             curr_poly;
 
 	std::vector<std::unique_ptr<d3d_render_target>> m_render_target_list;
+	std::vector<std::unique_ptr<d3d_render_target>> m_render_target_pool; // recently retired targets, oldest first
 
 	std::vector<std::unique_ptr<slider> >    internal_sliders;
 	std::vector<ui::menu_item> m_sliders;
@@ -157,6 +157,79 @@ namespace osd {
 
 namespace {
 
+//============================================================
+//  Program binary cache
+//
+//  Backends that can retrieve compiled shader programs or
+//  pipelines from the driver hand them to the callback
+//  keyed by a hash of the shader binaries; storing them on
+//  disk saves recompiling them on the next start or when
+//  switching back to a chain
+//============================================================
+
+class bgfx_cache_callback : public bgfx::CallbackI
+{
+public:
+	bgfx_cache_callback(std::string &&path) : m_path(std::move(path)) { }
+
+	virtual void fatal(const char *file, uint16_t line, bgfx::Fatal::Enum code, const char *str) override
+	{
+		if (code == bgfx::Fatal::DebugCheck)
+			osd_printf_warning("BGFX: %s\n", str);
+		else
+			fatalerror("BGFX: fatal error 0x%08x: %s\n", unsigned(code), str);
+	}
+
+	virtual void traceVargs(const char *file, uint16_t line, const char *format, va_list args) override
+	{
+		char buffer[1024];
+		vsnprintf(buffer, sizeof(buffer), format, args);
+		osd_printf_verbose("BGFX: %s", buffer);
+	}
+
+	virtual void profilerBegin(const char *name, uint32_t abgr, const char *file, uint16_t line) override { }
+	virtual void profilerBeginLiteral(const char *name, uint32_t abgr, const char *file, uint16_t line) override { }
+	virtual void profilerEnd() override { }
+
+	virtual uint32_t cacheReadSize(uint64_t id) override
+	{
+		emu_file file(m_path, OPEN_FLAG_READ);
+		if (file.open(cache_name(id)))
+			return 0;
+		return uint32_t(file.size());
+	}
+
+	virtual bool cacheRead(uint64_t id, void *data, uint32_t size) override
+	{
+		emu_file file(m_path, OPEN_FLAG_READ);
+		if (file.open(cache_name(id)))
+			return false;
+		return file.read(data, size) == size;
+	}
+
+	virtual void cacheWrite(uint64_t id, const void *data, uint32_t size) override
+	{
+		emu_file file(m_path, OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS);
+		if (file.open(cache_name(id)) || (file.write(data, size) != size))
+			osd_printf_verbose("BGFX: Unable to write program cache entry %016x\n", id);
+	}
+
+	virtual void screenShot(const char *file, uint32_t width, uint32_t height, uint32_t pitch, const void *data, uint32_t size, bool yflip) override { }
+	virtual void captureBegin(uint32_t width, uint32_t height, uint32_t pitch, bgfx::TextureFormat::Enum format, bool yflip) override { }
+	virtual void captureEnd() override { }
+	virtual void captureFrame(const void *data, uint32_t size) override { }
+
+private:
+	// binaries from one backend are no use to another
+	static std::string cache_name(uint64_t id)
+	{
+		return util::string_format("%016x-%d.bin", id, int(bgfx::getRendererType()));
+	}
+
+	std::string const m_path;
+};
+
+
 class video_bgfx : public osd_module, public render_module, protected renderer_bgfx::parent_module
 {
 public:
@@ -186,6 +259,7 @@ private:
 	static bool set_platform_data(bgfx::PlatformData &platform_data, osd_window const &window);
 
 	bool m_bgfx_library_initialized;
+	std::unique_ptr<bgfx_cache_callback> m_cache_callback;
 };
 
 
@@ -253,6 +327,7 @@ void video_bgfx::exit()
 		imguiDestroy();
 		bgfx::shutdown();
 		m_bgfx_library_initialized = false;
+		m_cache_callback.reset();
 	}
 	m_max_texture_size = 0;
 	m_persistent_settings.reset();
@@ -297,6 +372,7 @@ void video_bgfx::last_renderer_destroyed()
 		imguiDestroy();
 		bgfx::shutdown();
 		m_bgfx_library_initialized = false;
+		m_cache_callback.reset();
 		m_max_texture_size = 0;
 	}
 }
@@ -339,6 +415,7 @@ bool video_bgfx::init_bgfx_library(osd_window &window)
 	init.resolution.height = wdim.height();
 	init.resolution.numBackBuffers = 1;
 	init.resolution.reset = video_config.waitvsync ? BGFX_RESET_VSYNC : BGFX_RESET_NONE;
+	init.resolution.maxFrameLatency = std::clamp(m_options->bgfx_frame_latency(), 0, 3);
 	if (!set_platform_data(init.platformData, window))
 	{
 		osd_printf_error("Setting BGFX platform data failed\n");
@@ -365,6 +442,24 @@ bool video_bgfx::init_bgfx_library(osd_window &window)
 	else
 		osd_printf_warning("Unknown BGFX backend type '%s', going with auto-detection.\n", backend);
 
+	// keep compiled programs across runs if asked to
+	char const *const cache_path = m_options->bgfx_cache_path();
+	if (cache_path && *cache_path)
+	{
+		m_cache_callback = std::make_unique<bgfx_cache_callback>(cache_path);
+		init.callback = m_cache_callback.get();
+	}
+
+	// BGFX creates its own render thread unless renderFrame is called
+	// first, in which case bgfx::frame presents on this thread; with the
+	// render thread, the emulation thread hands off the frame and only
+	// waits if the previous one still hasn't been presented
+	if (!m_options->bgfx_render_thread())
+		bgfx::renderFrame();
+	osd_printf_verbose("BGFX: %s render thread, maximum frame latency %d\n",
+			m_options->bgfx_render_thread() ? "using" : "not using",
+			int(init.resolution.maxFrameLatency));
+
 	if (!bgfx::init(init))
 		return false;
 
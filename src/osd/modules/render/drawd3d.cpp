@@ -697,7 +697,11 @@ void d3d_texture_manager::update_textures()
 				// if there is one, but with a different seqid, copy the data
 				if (texture->get_texinfo().seqid != prim.texture.seqid)
 				{
-					texture->set_data(&prim.texture, prim.flags);
+					// if only some rows changed since the version we hold, refresh just those
+					if (prim.texture.dirty_seqid == 0 || texture->get_texinfo().seqid != prim.texture.dirty_seqid)
+						texture->set_data(&prim.texture, prim.flags, 0, prim.texture.height);
+					else if (prim.texture.dirty_height != 0)
+						texture->set_data(&prim.texture, prim.flags, prim.texture.dirty_top, prim.texture.dirty_height);
 					texture->get_texinfo().seqid = prim.texture.seqid;
 				}
 			}
@@ -2065,7 +2069,7 @@ texture_info::texture_info(d3d_texture_manager &manager, const render_texinfo* t
 	// copy the data to the texture
 	assert(m_d3dtex);
 	assert(m_d3dfinaltex);
-	set_data(texsource, flags);
+	set_data(texsource, flags, 0, texsource->height);
 
 	return;
 
@@ -2362,16 +2366,30 @@ inline void texture_info::copyline_yuy16_to_argb(uint32_t *dst, const uint16_t *
 //  texture_set_data
 //============================================================
 
-void texture_info::set_data(const render_texinfo *texsource, uint32_t flags)
+void texture_info::set_data(const render_texinfo *texsource, uint32_t flags, int top, int height)
 {
 	D3DLOCKED_RECT rect;
 	HRESULT result;
 
+	// discarded textures must be refilled completely
+	if (m_type != TEXTURE_TYPE_PLAIN)
+	{
+		top = 0;
+		height = texsource->height;
+	}
+
+	// the border rows repeat the first and last source rows
+	int const srcheight = texsource->height;
+	int const miny = (top == 0) ? -m_yborderpix : top;
+	int const maxy = (top + height >= srcheight) ? srcheight + m_yborderpix : top + height;
+	RECT lockrect = { 0, miny + m_yborderpix, LONG(m_rawdims.c.x), maxy + m_yborderpix };
+	bool const full = (miny == -m_yborderpix && maxy == srcheight + m_yborderpix);
+
 	// lock the texture
 	switch (m_type)
 	{
 		default:
-		case TEXTURE_TYPE_PLAIN:    result = m_d3dtex->LockRect(0, &rect, nullptr, 0);                 break;
+		case TEXTURE_TYPE_PLAIN:    result = m_d3dtex->LockRect(0, &rect, full ? nullptr : &lockrect, 0);   break;
 		case TEXTURE_TYPE_DYNAMIC:  result = m_d3dtex->LockRect(0, &rect, nullptr, D3DLOCK_DISCARD);   break;
 		case TEXTURE_TYPE_SURFACE:  result = m_d3dsurface->LockRect(&rect, nullptr, D3DLOCK_DISCARD);  break;
 	}
@@ -2390,14 +2408,11 @@ void texture_info::set_data(const render_texinfo *texsource, uint32_t flags)
 	else
 #endif
 	{
-		int miny = 0 - m_yborderpix;
-		int maxy = texsource->height + m_yborderpix;
-
 		for (int dsty = miny; dsty < maxy; dsty++)
 		{
 			int srcy = (dsty < 0) ? 0 : (dsty >= texsource->height) ? texsource->height - 1 : dsty;
 
-			void *dst = (BYTE *)rect.pBits + (dsty + m_yborderpix) * rect.Pitch;
+			void *dst = (BYTE *)rect.pBits + (dsty - miny) * rect.Pitch;
 
 			switch (tex_format)
 			{
@@ -343,7 +343,8 @@ private:
 
 	int gl_checkFramebufferStatus() const;
 	int texture_fbo_create(uint32_t text_unit, uint32_t text_name, uint32_t fbo_name, int width, int height) const;
-	void texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags) const;
+	void texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags, uint32_t top, uint32_t height) const;
+	void texture_upload_rows(ogl_texture_info *texture, uint32_t top, uint32_t height) const;
 
 	int gl_check_error(bool log, const char *file, int line) const
 	{
@@ -2447,8 +2448,17 @@ static inline void copyline_yuy16_to_argb(uint32_t *dst, const uint16_t *src, in
 //  texture_set_data
 //============================================================
 
-void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags) const
+void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texinfo *texsource, uint32_t flags, uint32_t top, uint32_t height) const
 {
+	// a partial update only converts and uploads the given source rows; the
+	// mapped PBO is always refilled in full
+	if ( texture->type == TEXTURE_TYPE_DYNAMIC )
+	{
+		top = 0;
+		height = texsource->height;
+	}
+	const bool full = (top == 0 && height == texsource->height);
+
 	if ( texture->type == TEXTURE_TYPE_DYNAMIC )
 	{
 		assert(texture->pbo);
@@ -2466,7 +2476,7 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 	}
 
 	// always fill non-wrapping textures with an extra pixel on the top
-	if (texture->borderpix)
+	if (texture->borderpix && full)
 	{
 		memset(texture->data, 0,
 				(texsource->width * texture->xprescale + 2) * sizeof(uint32_t));
@@ -2478,7 +2488,7 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 		int y, y2;
 		uint8_t *dst;
 
-		for (y = 0; y < texsource->height; y++)
+		for (y = top; y < top + height; y++)
 		{
 			for (y2 = 0; y2 < texture->yprescale; y2++)
 			{
@@ -2511,7 +2521,7 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 	}
 
 	// always fill non-wrapping textures with an extra pixel on the bottom
-	if (texture->borderpix)
+	if (texture->borderpix && full)
 	{
 		memset((uint8_t *)texture->data +
 				(texsource->height + 1) * texture->rawwidth * sizeof(uint32_t),
@@ -2530,8 +2540,11 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 			glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->rawwidth);
 
 		// and upload the image
-		glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
-				GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data);
+		if (full)
+			glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
+					GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data);
+		else
+			texture_upload_rows(texture, top, height);
 	}
 	else if ( texture->type == TEXTURE_TYPE_DYNAMIC )
 	{
@@ -2557,11 +2570,28 @@ void renderer_ogl::texture_set_data(ogl_texture_info *texture, const render_texi
 			glPixelStorei(GL_UNPACK_ROW_LENGTH, texture->rawwidth);
 
 		// and upload the image
-		glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
-						GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data);
+		if (full)
+			glTexSubImage2D(texture->texTarget, 0, 0, 0, texture->rawwidth, texture->rawheight,
+							GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data);
+		else
+			texture_upload_rows(texture, top, height);
 	}
 }
 
+//============================================================
+//  texture_upload_rows
+//============================================================
+
+void renderer_ogl::texture_upload_rows(ogl_texture_info *texture, uint32_t top, uint32_t height) const
+{
+	// source rows map to prescaled texture rows below the top border
+	const uint32_t stride = texture->nocopy ? texture->texinfo.rowpixels : texture->rawwidth;
+	const uint32_t first = top * texture->yprescale + texture->borderpix;
+
+	glTexSubImage2D(texture->texTarget, 0, 0, first, texture->rawwidth, height * texture->yprescale,
+					GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, texture->data + first * stride);
+}
+
 //============================================================
 //  texture_find
 //============================================================
@@ -2820,11 +2850,21 @@ ogl_texture_info * renderer_ogl::texture_update(const render_primitive *prim, in
 		{
 			if (prim->texture.base != nullptr && texture->texinfo.seqid != prim->texture.seqid)
 			{
+				// if only some rows changed since the version we hold, refresh just those
+				const bool partial = prim->texture.dirty_seqid != 0 && texture->texinfo.seqid == prim->texture.dirty_seqid;
 				texture->texinfo.seqid = prim->texture.seqid;
 
 				// if we found it, but with a different seqid, copy the data
-				texture_set_data(texture, &prim->texture, prim->flags);
-				texBound=1;
+				if (!partial)
+				{
+					texture_set_data(texture, &prim->texture, prim->flags, 0, prim->texture.height);
+					texBound=1;
+				}
+				else if (prim->texture.dirty_height != 0)
+				{
+					texture_set_data(texture, &prim->texture, prim->flags, prim->texture.dirty_top, prim->texture.dirty_height);
+					texBound=1;
+				}
 			}
 		}
 
@@ -174,6 +174,9 @@ private:
 	osd_ticks_t         m_osd_tps;
 	int                 m_buffer_min_ct;
 
+	bool                m_use_rate_control;
+	sound_rate_control  m_rate_control;
+
 #if LOG_BUFCNT
 	std::stringstream   m_log;
 #endif
@@ -282,6 +285,10 @@ int sound_pa::init(osd_interface &osd, osd_options const &options)
 		m_skip_threshold = ((std::max<double>(callback_interval, 10.0) + (m_audio_latency - 1) * 20.0) / 1000.0) * m_sample_rate * 2 + 0.5f;
 	}
 
+	// aim for the middle of the allowed buffering, in stereo frames
+	m_use_rate_control = options.audio_rate_control();
+	m_rate_control.reset(m_skip_threshold / 4);
+
 	osd_printf_verbose("PortAudio: Using device \"%s\" on API \"%s\"\n", device_info->name, api_info->name);
 	osd_printf_verbose("PortAudio: Sample rate is %0.0f Hz, device output latency is %0.2f ms\n",
 		stream_info->sampleRate, stream_info->outputLatency * 1000.0);
@@ -423,6 +430,13 @@ void sound_pa::update_audio_stream(bool is_throttled, const s16 *buffer, int sam
 		m_has_overflowed = false;
 	}
 
+	// nudge the rate to keep the buffer near its target
+	if (m_use_rate_control)
+	{
+		samples_this_frame = m_rate_control.process(buffer, samples_this_frame, m_ab->count() / 2);
+		buffer = m_rate_control.data();
+	}
+
 	m_ab->write(buffer, samples_this_frame * 2, m_attenuation);
 
 	// for determining buffer overflows, take the sample here instead of in the callback
@@ -58,6 +58,8 @@ private:
 	std::vector<abuffer> m_buffers;
 
 	u32 m_last_sample;
+	bool m_use_rate_control;
+	sound_rate_control m_rate_control;
 	int m_new_volume_value;
 	bool m_setting_volume;
 	bool m_new_volume;
@@ -298,6 +300,10 @@ int sound_pulse::init(osd_interface &osd, osd_options const &options)
 
 	const int sample_rate = options.sample_rate();
 
+	// keep roughly one 20ms update queued per step of audio_latency, plus one
+	m_use_rate_control = options.audio_rate_control();
+	m_rate_control.reset((std::max(options.audio_latency(), 1) + 1) * sample_rate / 50);
+
 	pa_sample_spec ss;
 #ifdef LSB_FIRST
 	ss.format = PA_SAMPLE_S16LE;
@@ -330,6 +336,19 @@ int sound_pulse::init(osd_interface &osd, osd_options const &options)
 void sound_pulse::update_audio_stream(bool is_throttled, const s16 *buffer, int samples_this_frame)
 {
 	std::unique_lock<std::mutex> lock(m_mutex);
+
+	// nudge the rate to keep the queue near its target
+	if (m_use_rate_control)
+	{
+		int buffered = 0;
+		for (auto const &queued : m_buffers)
+			buffered += queued.data.size() - queued.cpos;
+		samples_this_frame = m_rate_control.process(buffer, samples_this_frame, buffered);
+		buffer = m_rate_control.data();
+	}
+	if (samples_this_frame <= 0)
+		return;
+
 	m_buffers.resize(m_buffers.size() + 1);
 	auto &buf = m_buffers.back();
 	buf.cpos = 0;
@@ -341,7 +360,7 @@ void sound_pulse::update_audio_stream(bool is_throttled, const s16 *buffer, int
 		// If there way too many buffers, drop some so only 10 are left (roughly 0.2s)
 		m_buffers.erase(m_buffers.begin(), m_buffers.begin() + m_buffers.size() - 10);
 
-	else if(m_buffers.size() >= 5)
+	else if(!m_use_rate_control && m_buffers.size() >= 5)
 		// If there are too many buffers, remove five sample per buffer
 		// to slowly resync to reduce latency (4 seconds to
 		// compensate one buffer roughly)
@@ -58,6 +58,7 @@ public:
 		buf_locked(0),
 		stream_buffer(nullptr),
 		stream_buffer_size(0),
+		use_rate_control(false),
 		buffer_underflows(0),
 		buffer_overflows(0)
 	{
@@ -71,6 +72,7 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, const int16_t *buffer, int samples_this_frame) override;
 	virtual void set_mastervolume(int attenuation) override;
+	virtual int buffered_samples() override;
 
 private:
 	class ring_buffer
@@ -106,6 +108,8 @@ private:
 	int              buf_locked;
 	std::unique_ptr<ring_buffer> stream_buffer;
 	uint32_t         stream_buffer_size;
+	bool             use_rate_control;
+	sound_rate_control rate_control;
 
 
 	// diagnostics
@@ -268,6 +272,16 @@ void sound_sdl::update_audio_stream(bool is_throttled, const int16_t *buffer, in
 		stream_in_initialized = 1;
 	}
 
+	// nudge the rate to keep the buffer half full
+	if (use_rate_control)
+	{
+		lock_buffer();
+		int const buffered = stream_buffer->data_size() / (sizeof(*buffer) * 2);
+		unlock_buffer();
+		samples_this_frame = rate_control.process(buffer, samples_this_frame, buffered);
+		buffer = rate_control.data();
+	}
+
 	size_t bytes_this_frame = samples_this_frame * sizeof(*buffer) * 2;
 	size_t free_size = stream_buffer->free_size();
 	size_t data_size = stream_buffer->data_size();
@@ -289,6 +303,23 @@ void sound_sdl::update_audio_stream(bool is_throttled, const int16_t *buffer, in
 
 
 
+//============================================================
+//  buffered_samples
+//============================================================
+
+int sound_sdl::buffered_samples()
+{
+	if (!stream_buffer)
+		return -1;
+
+	lock_buffer();
+	size_t const bytes = stream_buffer->data_size();
+	unlock_buffer();
+	return bytes / (sizeof(int16_t) * 2);
+}
+
+
+
 //============================================================
 //  set_mastervolume
 //============================================================
@@ -393,6 +424,10 @@ int sound_sdl::init(osd_interface &osd, const osd_options &options)
 		if (stream_buffer_size < 1024)
 			stream_buffer_size = 1024;
 
+		// the stream starts half full, so aim to keep it there
+		use_rate_control = options.audio_rate_control();
+		rate_control.reset(stream_buffer_size / (sizeof(int16_t) * 2) / 2);
+
 		// create the buffers
 		if (sdl_create_buffers())
 			goto cant_create_buffers;
@@ -9,7 +9,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
+#include <vector>
 
 //============================================================
 //  CONSTANTS
@@ -24,6 +26,86 @@ public:
 
 	virtual void update_audio_stream(bool is_throttled, const int16_t *buffer, int samples_this_frame) = 0;
 	virtual void set_mastervolume(int attenuation) = 0;
+
+	// stereo samples queued for output, or -1 if the module can't tell
+	virtual int buffered_samples() { return -1; }
+};
+
+
+//============================================================
+//  dynamic rate control
+//============================================================
+
+// Stretches or squeezes each block of stereo samples by a tiny amount
+// so the module's buffer converges on a target fill level, instead of
+// drifting until it underflows or has to drop audio.  The adjustment
+// is proportional to the distance from the target and never exceeds
+// MAX_ADJUST, which is well below the threshold of audible pitch change.
+
+class sound_rate_control
+{
+public:
+	static constexpr double MAX_ADJUST = 0.005;
+
+	sound_rate_control() { reset(0); }
+
+	// set the target fill level in stereo samples and forget any history
+	void reset(int target)
+	{
+		m_target = target;
+		m_position = 0.0;
+		m_ratio = 1.0;
+		m_last[0] = m_last[1] = 0;
+	}
+
+	// current output/input ratio
+	double ratio() const { return m_ratio; }
+
+	// resample a block given the number of stereo samples currently buffered;
+	// returns the number of stereo samples available from data()
+	int process(const int16_t *buffer, int samples, int buffered)
+	{
+		if (m_target <= 0 || samples <= 0)
+		{
+			m_output.assign(buffer, buffer + std::max(samples, 0) * 2);
+			return std::max(samples, 0);
+		}
+
+		// too full means produce fewer samples, too empty means produce more
+		double const error = std::clamp(double(buffered - m_target) / double(m_target), -1.0, 1.0);
+		m_ratio = 1.0 - MAX_ADJUST * error;
+		double const step = 1.0 / m_ratio;
+
+		// interpolate between the last sample of the previous block and this one
+		m_output.clear();
+		m_output.reserve(size_t(samples / m_ratio + 2.0) * 2);
+		double position = m_position;
+		for ( ; position < double(samples); position += step)
+		{
+			int const index = int(position);
+			double const frac = position - double(index);
+			for (int channel = 0; channel < 2; channel++)
+			{
+				int const prev = index ? buffer[(index - 1) * 2 + channel] : m_last[channel];
+				int const next = buffer[index * 2 + channel];
+				m_output.push_back(int16_t(prev + (next - prev) * frac));
+			}
+		}
+		m_position = position - double(samples);
+		m_last[0] = buffer[(samples - 1) * 2 + 0];
+		m_last[1] = buffer[(samples - 1) * 2 + 1];
+		return int(m_output.size() / 2);
+	}
+
+	// resampled samples from the last call to process
+	const int16_t *data() const { return m_output.data(); }
+
+private:
+	int m_target;                   // target fill level in stereo samples
+	double m_position;              // fractional position carried into the next block
+	double m_ratio;                 // last output/input ratio
+	int16_t m_last[2];              // last input sample of the previous block
+	std::vector<int16_t> m_output;  // resampled output
 };
 
 #endif // MAME_OSD_SOUND_SOUND_MODULE_H
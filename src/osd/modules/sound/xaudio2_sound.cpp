@@ -198,6 +198,8 @@ public:
 		m_buffer_size(0),
 		m_buffer_count(0),
 		m_writepos(0),
+		m_queued_bytes(0),
+		m_use_rate_control(false),
 		m_hEventBufferCompleted(nullptr),
 		m_hEventDataAvailable(nullptr),
 		m_hEventExiting(nullptr),
@@ -245,6 +247,9 @@ private:
 	DWORD                            m_buffer_size;
 	DWORD                            m_buffer_count;
 	DWORD                            m_writepos;
+	DWORD                            m_queued_bytes;
+	bool                             m_use_rate_control;
+	sound_rate_control               m_rate_control;
 	std::mutex                       m_buffer_lock;
 	HANDLE                           m_hEventBufferCompleted;
 	HANDLE                           m_hEventDataAvailable;
@@ -291,6 +296,7 @@ int sound_xaudio2::init(osd_interface &osd, osd_options const &options)
 
 	m_sample_rate = options.sample_rate();
 	m_audio_latency = options.audio_latency();
+	m_use_rate_control = options.audio_rate_control();
 
 	// Create the IXAudio2 object
 	HR_GOERR(OSD_DYNAMIC_CALL(XAudio2Create, m_xAudio2.GetAddressOf(), 0, XAUDIO2_DEFAULT_PROCESSOR));
@@ -391,7 +397,15 @@ void sound_xaudio2::update_audio_stream(
 
 	std::lock_guard<std::mutex> lock(m_buffer_lock);
 
+	// nudge the rate to keep the queue near its target
 	uint32_t bytes_left = bytes_this_frame;
+	if (m_use_rate_control)
+	{
+		samples_this_frame = m_rate_control.process(buffer, samples_this_frame, (m_queued_bytes + m_writepos) / m_sample_bytes);
+		buffer = m_rate_control.data();
+		bytes_left = samples_this_frame * m_sample_bytes;
+	}
+
 
 	while (bytes_left > 0)
 	{
@@ -514,8 +528,12 @@ void sound_xaudio2::create_buffers(const WAVEFORMATEX &format)
 		static_cast<unsigned int>(m_buffer_count),
 		static_cast<unsigned int>(m_buffer_size));
 
+	// keep about one buffer waiting behind the one being played
+	m_rate_control.reset(m_buffer_size / format.nBlockAlign);
+
 	// reset buffer states
 	m_writepos = 0;
+	m_queued_bytes = 0;
 	m_overflows = 0;
 	m_underflows = 0;
 }
@@ -654,6 +672,7 @@ BOOL sound_xaudio2::submit_next_queued()
 		auto buf = &m_queue.front();
 
 		// submit the buffer data
+		m_queued_bytes -= buf->AudioSize;
 		submit_buffer(std::move(buf->AudioData), buf->AudioSize);
 
 		// Remove it from the queue
@@ -682,6 +701,7 @@ void sound_xaudio2::roll_buffer()
 	xaudio2_buffer buf;
 	buf.AudioData = std::move(m_buffer);
 	buf.AudioSize = m_writepos;
+	m_queued_bytes += m_writepos;
 	m_queue.push(std::move(buf));
 
 	// Get a new buffer
@@ -695,6 +715,7 @@ void sound_xaudio2::roll_buffer()
 		xaudio2_buffer *next_buffer = &m_queue.front();
 
 		// return the oldest buffer to the pool, and remove it from queue
+		m_queued_bytes -= next_buffer->AudioSize;
 		m_buffer_pool->return_to_pool(next_buffer->AudioData.release());
 		m_queue.pop();
 
@@ -168,9 +168,40 @@ osd_ticks_t osd_ticks_per_second() noexcept
 //  osd_sleep
 //============================================================
 
+#ifdef _WIN32
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+namespace {
+
+// Sleep() only has millisecond granularity, which leaves the throttle
+// spinning for most of each frame; a high-resolution waitable timer
+// (Windows 10 1803 and later) wakes within a fraction of that
+struct sleep_timer
+{
+	sleep_timer() noexcept : handle(CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS)) { }
+	~sleep_timer() { if (handle) CloseHandle(handle); }
+	HANDLE handle;
+};
+
+} // anonymous namespace
+#endif
+
 void osd_sleep(osd_ticks_t duration) noexcept
 {
 #ifdef _WIN32
+	thread_local sleep_timer const timer;
+	if (timer.handle)
+	{
+		// due time is relative, in 100ns units
+		LARGE_INTEGER due;
+		due.QuadPart = -LONGLONG(duration * 10'000'000 / osd_ticks_per_second());
+		if (due.QuadPart && SetWaitableTimer(timer.handle, &due, 0, nullptr, nullptr, FALSE))
+			WaitForSingleObject(timer.handle, INFINITE);
+		return;
+	}
+
 // sleep_for appears to oversleep on Windows with gcc 8
 	Sleep(duration / (osd_ticks_per_second() / 1000));
 #else
@@ -141,6 +141,7 @@ void osd_sleep(osd_ticks_t duration) noexcept;
 #define WORK_QUEUE_FLAG_IO          0x0001
 #define WORK_QUEUE_FLAG_MULTI       0x0002
 #define WORK_QUEUE_FLAG_HIGH_FREQ   0x0004
+#define WORK_QUEUE_FLAG_STEAL       0x0008
 
 /* these flags can be set when queueing a work item to indicate how to handle
    its deconstruction */
@@ -177,6 +178,12 @@ typedef void *(*osd_work_callback)(void *param, int threadid);
                 general, this implies doing some spin-waiting internally
                 before falling back to OS-specific synchronization
 
+            WORK_QUEUE_FLAG_STEAL - indicates that items should be spread
+                over per-thread lists rather than one shared list, with
+                idle threads stealing from the others; this reduces lock
+                contention for large batches of similarly sized items, at
+                the expense of strict first-in first-out ordering
+
     Return value:
 
         A pointer to an allocated osd_work_queue object.
@@ -151,6 +151,39 @@ public:
 	/// \return Result of the operation.
 	virtual std::error_condition flush() noexcept = 0;
 
+	/// \brief Map the contents of an open file for reading
+	///
+	/// Maps the whole file into the address space read-only.  The
+	/// mapping covers the size of the file at the time it is created
+	/// and remains valid until unmap or truncate is called or the file
+	/// is closed; later writes through this handle are visible through
+	/// it.  Not all files support mapping.
+	/// \param [out] data Receives a pointer to the start of the file
+	///   if the operation succeeds.  Not valid if the operation fails.
+	/// \param [out] length Receives the number of bytes mapped if the
+	///   operation succeeds.  Not valid if the operation fails.
+	/// \return Result of the operation.
+	virtual std::error_condition map(void const *&data, std::uint64_t &length) noexcept { return std::errc::not_supported; }
+
+	/// \brief Map part of a file copy-on-write
+	///
+	/// Maps a range of the file into the address space.  Writes
+	/// through the mapping go to private copies of the affected pages
+	/// and never reach the file.  The mapping remains valid until
+	/// unmap is called or the file is closed, and only one mapping can
+	/// exist at a time.  Not all files support mapping.
+	/// \param [in] offset Offset of the first byte to map.
+	/// \param [in] length Number of bytes to map; must not extend past
+	///   the end of the file.
+	/// \param [out] data Receives a pointer to the byte at the
+	///   specified offset if the operation succeeds.  Not valid if the
+	///   operation fails.
+	/// \return Result of the operation.
+	virtual std::error_condition map_private(std::uint64_t offset, std::uint64_t length, void *&data) noexcept { return std::errc::not_supported; }
+
+	/// \brief Release a mapping created by map or map_private
+	virtual void unmap() noexcept { }
+
 	/// \brief Delete a file
 	///
 	/// \param [in] filename Path to the file to delete.
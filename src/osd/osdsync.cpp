@@ -18,6 +18,7 @@
 #endif
 #include <mutex>
 #include <atomic>
+#include <deque>
 #include <thread>
 #include <vector>
 #include <algorithm>
@@ -43,6 +44,7 @@
 
 #define ENV_PROCESSORS               "OSDPROCESSORS"
 #define ENV_WORKQUEUEMAXTHREADS      "OSDWORKQUEUEMAXTHREADS"
+#define ENV_WORKQUEUEAFFINITY        "OSDWORKQUEUEAFFINITY"
 
 #define SPIN_LOOP_TIME          (osd_ticks_per_second() / 10000)
 
@@ -108,6 +110,7 @@ struct work_thread_info
 		, handle(nullptr)
 		, wakeevent(true, false)  // manual reset, not signalled
 		, id(aid)
+		, stealseed(aid * 0x9e3779b9U + 1)
 #if KEEP_STATISTICS
 		, itemsdone(0)
 		, actruntime(0)
@@ -122,6 +125,9 @@ struct work_thread_info
 	std::thread *       handle;         // handle to the thread
 	osd_event           wakeevent;      // wake event for the thread
 	uint32_t            id;
+	std::mutex          dequelock;      // lock for protecting the deque
+	std::deque<osd_work_item *> deque;  // items owned by this thread (WORK_QUEUE_FLAG_STEAL)
+	uint32_t            stealseed;      // state for choosing steal victims
 
 #if KEEP_STATISTICS
 	int32_t             itemsdone;
@@ -140,6 +146,8 @@ struct osd_work_queue
 		, tailptr(nullptr)
 		, free(nullptr)
 		, items(0)
+		, pending(0)
+		, nextdeque(0)
 		, livethreads(0)
 		, waiting(0)
 		, exiting(0)
@@ -151,6 +159,7 @@ struct osd_work_queue
 		, setevents(0)
 		, extraitems(0)
 		, spinloops(0)
+		, steals(0)
 #endif
 	{
 	}
@@ -160,6 +169,8 @@ struct osd_work_queue
 	osd_work_item ** volatile tailptr;  // pointer to the tail pointer of work items in the queue
 	std::atomic<osd_work_item *> free;  // free list of work items
 	std::atomic<int32_t>  items;          // items in the queue
+	std::atomic<int32_t>  pending;        // items in per-thread deques not yet started
+	std::atomic<uint32_t> nextdeque;      // first deque to receive the next batch
 	std::atomic<int32_t>  livethreads;    // number of live threads
 	std::atomic<int32_t>  waiting;        // is someone waiting on the queue to complete?
 	std::atomic<int32_t>  exiting;        // should the threads exit on their next opportunity?
@@ -173,6 +184,7 @@ struct osd_work_queue
 	std::atomic<int32_t>  setevents;      // number of times we called SetEvent
 	std::atomic<int32_t>  extraitems;     // how many extra items we got after the first in the queue loop
 	std::atomic<int32_t>  spinloops;      // how many times spinning bought us more items
+	std::atomic<int32_t>  steals;         // how many items were taken from another thread's deque
 #endif
 };
 
@@ -215,6 +227,8 @@ static int effective_num_processors(bool heavy_mt);
 static void *worker_thread_entry(void *param);
 static void worker_thread_process(osd_work_queue *queue, work_thread_info *thread);
 static bool queue_has_list_items(osd_work_queue *queue);
+static osd_work_item *queue_take_item(osd_work_queue *queue, work_thread_info *thread);
+static osd_work_item *queue_steal_item(osd_work_queue *queue, work_thread_info *thread);
 
 //============================================================
 //  osd_thread_adjust_priority
@@ -244,6 +258,59 @@ int thread_adjust_priority(std::thread *thread, int adjust)
 	return true;
 }
 
+//============================================================
+//  parse_cpu_list - parse a list of processor numbers
+//  and ranges such as "2,4-7"
+//============================================================
+
+static std::vector<int> parse_cpu_list(const char *list)
+{
+	std::vector<int> result;
+	while (list && *list)
+	{
+		int first, last, chars;
+		if (sscanf(list, "%d-%d%n", &first, &last, &chars) != 2)
+		{
+			if (sscanf(list, "%d%n", &first, &chars) != 1)
+				break;
+			last = first;
+		}
+		for (int cpu = std::max(first, 0); cpu <= last; cpu++)
+			result.push_back(cpu);
+		list += chars;
+		if (*list != ',')
+			break;
+		list++;
+	}
+	return result;
+}
+
+
+//============================================================
+//  thread_set_affinity - restrict a thread to the given
+//  processors
+//============================================================
+
+static void thread_set_affinity(std::thread *thread, const int *cpus, size_t count)
+{
+#if defined(OSD_WINDOWS) || defined(SDLMAME_WIN32)
+	DWORD_PTR mask = 0;
+	for (size_t i = 0; i < count; i++)
+		if (cpus[i] < int(sizeof(mask) * 8))
+			mask |= DWORD_PTR(1) << cpus[i];
+	if (mask)
+		SetThreadAffinityMask((HANDLE)thread->native_handle(), mask);
+#elif defined(SDLMAME_LINUX)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	for (size_t i = 0; i < count; i++)
+		if (cpus[i] < CPU_SETSIZE)
+			CPU_SET(cpus[i], &set);
+	if (CPU_COUNT(&set))
+		pthread_setaffinity_np(thread->native_handle(), sizeof(set), &set);
+#endif
+}
+
 //============================================================
 //  osd_work_queue_alloc
 //============================================================
@@ -256,6 +323,7 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 	int osdthreadnum = 0;
 	int allocthreadnum;
 	const char *osdworkqueuemaxthreads = osd_getenv(ENV_WORKQUEUEMAXTHREADS);
+	const std::vector<int> affinity = parse_cpu_list(osd_getenv(ENV_WORKQUEUEAFFINITY));
 
 	// allocate a new queue
 	queue = new osd_work_queue();
@@ -312,6 +380,16 @@ osd_work_queue *osd_work_queue_alloc(int flags)
 			thread_adjust_priority(thread->handle, 1);
 		else
 			thread_adjust_priority(thread->handle, 0);
+
+		// if processors were given, pin each worker of a multi queue to one of them so
+		// workers don't migrate between cores, and keep other queues within the set
+		if (!affinity.empty())
+		{
+			if (flags & WORK_QUEUE_FLAG_MULTI)
+				thread_set_affinity(thread->handle, &affinity[threadnum % affinity.size()], 1);
+			else
+				thread_set_affinity(thread->handle, &affinity[0], affinity.size());
+		}
 	}
 
 	// start a timer going for "waittime" on the main thread
@@ -437,9 +515,16 @@ void osd_work_queue_free(osd_work_queue *queue)
 	}
 #endif
 
-	// free the list
+	// free the list, along with any items still in the per-thread deques
 	for (auto & th : queue->thread)
+	{
+		for (osd_work_item *item : th->deque)
+		{
+			delete item->event;
+			delete item;
+		}
 		delete th;
+	}
 	queue->thread.clear();
 
 	// free all items in the free list
@@ -465,6 +550,7 @@ void osd_work_queue_free(osd_work_queue *queue)
 	printf("SetEvent calls = %9d\n", queue->setevents.load());
 	printf("Extra items    = %9d\n", queue->extraitems.load());
 	printf("Spin loops     = %9d\n", queue->spinloops.load());
+	printf("Steals         = %9d\n", queue->steals.load());
 #endif
 
 	// free the queue itself
@@ -523,15 +609,36 @@ osd_work_item *osd_work_item_queue_multiple(osd_work_queue *queue, osd_work_call
 		parambase = (uint8_t *)parambase + paramstep;
 	}
 
-	// enqueue the whole thing within the critical section
+	if (queue->flags & WORK_QUEUE_FLAG_STEAL)
 	{
-		std::lock_guard<std::mutex> lock(queue->lock);
-		*queue->tailptr = itemlist;
-		queue->tailptr = item_tailptr;
+		// count the items first so nobody sees the queue as idle while they're being distributed
+		queue->items += numitems;
+		queue->pending += numitems;
+
+		// deal out contiguous runs so neighbouring items tend to run on the same thread
+		uint32_t const deques = queue->thread.size();
+		uint32_t const perdeque = (numitems + deques - 1) / deques;
+		uint32_t dequenum = queue->nextdeque.fetch_add(1) % deques;
+		for (osd_work_item *item = itemlist; item != nullptr; dequenum = (dequenum + 1) % deques)
+		{
+			work_thread_info *const thread = queue->thread[dequenum];
+			std::lock_guard<std::mutex> lock(thread->dequelock);
+			for (uint32_t count = 0; item != nullptr && count < perdeque; count++, item = item->next)
+				thread->deque.push_back(item);
+		}
 	}
+	else
+	{
+		// enqueue the whole thing within the critical section
+		{
+			std::lock_guard<std::mutex> lock(queue->lock);
+			*queue->tailptr = itemlist;
+			queue->tailptr = item_tailptr;
+		}
 
-	// increment the number of items in the queue
-	queue->items += numitems;
+		// increment the number of items in the queue
+		queue->items += numitems;
+	}
 	add_to_stat(queue->itemsqueued, numitems);
 
 	// look for free threads to do the work
@@ -700,11 +807,14 @@ static void *worker_thread_entry(void *param)
 			worker_thread_process(&queue, thread);
 
 			// if we're a high frequency queue, spin for a while before giving up
-			if (queue.flags & WORK_QUEUE_FLAG_HIGH_FREQ && queue.list.load() == nullptr)
+			if (queue.flags & WORK_QUEUE_FLAG_HIGH_FREQ && !queue_has_list_items(&queue))
 			{
 				// spin for a while looking for more work
 				begin_timing(thread->spintime);
-				spin_while<std::atomic<osd_work_item *>, osd_work_item *>(&queue.list, (osd_work_item *)nullptr, SPIN_LOOP_TIME);
+				if (queue.flags & WORK_QUEUE_FLAG_STEAL)
+					spin_while<std::atomic<int32_t>, int32_t>(&queue.pending, 0, SPIN_LOOP_TIME);
+				else
+					spin_while<std::atomic<osd_work_item *>, osd_work_item *>(&queue.list, (osd_work_item *)nullptr, SPIN_LOOP_TIME);
 				end_timing(thread->spintime);
 			}
 
@@ -736,36 +846,11 @@ static void worker_thread_process(osd_work_queue *queue, work_thread_info *threa
 	// loop until everything is processed
 	while (true)
 	{
-		osd_work_item *item = nullptr;
-
-		bool end_loop = false;
-
-		// use a critical section to synchronize the removal of items
-		{
-			std::lock_guard<std::mutex> lock(queue->lock);
-
-			if (queue->list.load() == nullptr)
-			{
-				end_loop = true;
-			}
-			else
-			{
-				// pull the item from the queue
-				item = (osd_work_item *)queue->list;
-				if (item != nullptr)
-				{
-					queue->list = item->next;
-					if (queue->list.load() == nullptr)
-						queue->tailptr = (osd_work_item **)&queue->list;
-				}
-			}
-		}
-
-		if (end_loop)
+		osd_work_item *item = queue_take_item(queue, thread);
+		if (item == nullptr)
 			break;
 
-		// process non-NULL items
-		if (item != nullptr)
+		// process the item
 		{
 			// call the callback and stash the result
 			begin_timing(thread->actruntime);
@@ -811,7 +896,94 @@ static void worker_thread_process(osd_work_queue *queue, work_thread_info *threa
 
 bool queue_has_list_items(osd_work_queue *queue)
 {
+	if (queue->flags & WORK_QUEUE_FLAG_STEAL)
+		return queue->pending > 0;
+
 	std::lock_guard<std::mutex> lock(queue->lock);
 	bool has_list_items = (queue->list.load() != nullptr);
 	return has_list_items;
 }
+
+
+//============================================================
+//  queue_take_item
+//============================================================
+
+static osd_work_item *queue_take_item(osd_work_queue *queue, work_thread_info *thread)
+{
+	osd_work_item *item = nullptr;
+
+	if (queue->flags & WORK_QUEUE_FLAG_STEAL)
+	{
+		// take from the front of our own deque, in the order the items were queued
+		{
+			std::lock_guard<std::mutex> lock(thread->dequelock);
+			if (!thread->deque.empty())
+			{
+				item = thread->deque.front();
+				thread->deque.pop_front();
+			}
+		}
+
+		// if that's empty, try to take work from someone else
+		if (item == nullptr)
+			item = queue_steal_item(queue, thread);
+		if (item != nullptr)
+			--queue->pending;
+		return item;
+	}
+
+	// use a critical section to synchronize the removal of items
+	std::lock_guard<std::mutex> lock(queue->lock);
+
+	// pull the item from the queue
+	item = (osd_work_item *)queue->list;
+	if (item != nullptr)
+	{
+		queue->list = item->next;
+		if (queue->list.load() == nullptr)
+			queue->tailptr = (osd_work_item **)&queue->list;
+	}
+	return item;
+}
+
+
+//============================================================
+//  queue_steal_item
+//============================================================
+
+static osd_work_item *queue_steal_item(osd_work_queue *queue, work_thread_info *thread)
+{
+	uint32_t const deques = queue->thread.size();
+
+	// keep trying while there's work that hasn't been started, only
+	// blocking on a busy deque after a pass where every attempt failed
+	for (bool blocking = false; queue->pending > 0; blocking = true)
+	{
+		// start at a random victim so thieves don't all pile onto the same deque
+		thread->stealseed ^= thread->stealseed << 13;
+		thread->stealseed ^= thread->stealseed >> 17;
+		thread->stealseed ^= thread->stealseed << 5;
+		uint32_t const start = thread->stealseed % deques;
+
+		for (uint32_t index = 0; index < deques; index++)
+		{
+			// our own deque is included in case more work arrived there;
+			// steal from the far end, away from where the owner is working
+			work_thread_info *const victim = queue->thread[(start + index) % deques];
+			std::unique_lock<std::mutex> lock(victim->dequelock, std::defer_lock);
+			if (blocking)
+				lock.lock();
+			else if (!lock.try_lock())
+				continue;
+			if (!victim->deque.empty())
+			{
+				osd_work_item *const item = victim->deque.back();
+				victim->deque.pop_back();
+				add_to_stat(queue->steals, 1);
+				return item;
+			}
+		}
+	}
+	return nullptr;
+}
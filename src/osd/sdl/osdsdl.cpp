@@ -198,6 +198,15 @@ void sdl_osd_interface::init(running_machine &machine)
 		options().set_value(OPTION_SECONDS_TO_RUN, bench, OPTION_PRIORITY_MAXIMUM);
 	}
 
+	// when only rendering audio to a WAV file or hashing frames, run as fast as possible without presenting anything
+	if (options().wav_only() || *options().hash_write())
+	{
+		options().set_value(OPTION_SLEEP, false, OPTION_PRIORITY_MAXIMUM);
+		options().set_value(OPTION_THROTTLE, false, OPTION_PRIORITY_MAXIMUM);
+		options().set_value(OSDOPTION_SOUND, "none", OPTION_PRIORITY_MAXIMUM);
+		options().set_value(OSDOPTION_VIDEO, "none", OPTION_PRIORITY_MAXIMUM);
+	}
+
 	// Some driver options - must be before audio init!
 	stemp = options().audio_driver();
 	if (stemp != nullptr && strcmp(stemp, OSDOPTVAL_AUTO) != 0)
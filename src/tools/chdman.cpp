@@ -21,6 +21,7 @@
 #include "strformat.h"
 #include "vbiparse.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
 #include <cstdio>
@@ -34,6 +35,7 @@
 #include <optional>
 #include <regex>
 #include <string_view>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -672,7 +674,8 @@ static const command_description s_commands[] =
 		{
 			REQUIRED OPTION_INPUT,
 			OPTION_INPUT_PARENT,
-			OPTION_FIX
+			OPTION_FIX,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -764,7 +767,8 @@ static const command_description s_commands[] =
 			OPTION_INPUT_START_BYTE,
 			OPTION_INPUT_START_HUNK,
 			OPTION_INPUT_LENGTH_BYTES,
-			OPTION_INPUT_LENGTH_HUNKS
+			OPTION_INPUT_LENGTH_HUNKS,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -777,7 +781,8 @@ static const command_description s_commands[] =
 			OPTION_INPUT_START_BYTE,
 			OPTION_INPUT_START_HUNK,
 			OPTION_INPUT_LENGTH_BYTES,
-			OPTION_INPUT_LENGTH_HUNKS
+			OPTION_INPUT_LENGTH_HUNKS,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -789,6 +794,7 @@ static const command_description s_commands[] =
 			OPTION_OUTPUT_FORCE,
 			REQUIRED OPTION_INPUT,
 			OPTION_INPUT_PARENT,
+			OPTION_NUMPROCESSORS,
 		}
 	},
 
@@ -801,7 +807,8 @@ static const command_description s_commands[] =
 			OPTION_INPUT_START_BYTE,
 			OPTION_INPUT_START_HUNK,
 			OPTION_INPUT_LENGTH_BYTES,
-			OPTION_INPUT_LENGTH_HUNKS
+			OPTION_INPUT_LENGTH_HUNKS,
+			OPTION_NUMPROCESSORS
 		}
 	},
 
@@ -1361,6 +1368,23 @@ static void parse_numprocessors(const parameters_map &params)
 }
 
 
+//-------------------------------------------------
+//  configure_parallel_read - let a CHD that will
+//  be read straight through decompress hunks
+//  ahead on all the available processors
+//-------------------------------------------------
+
+static void configure_parallel_read(chd_file &chd)
+{
+	extern int osd_num_processors;
+	uint32_t const threads = (osd_num_processors > 0) ? uint32_t(osd_num_processors) : std::max(std::thread::hardware_concurrency(), 1U);
+	uint32_t const readahead = 4 * threads;
+	chd.set_cache_hunks(std::max(chd.cache_hunks(), 2 * readahead));
+	chd.set_readahead_threads(threads);
+	chd.set_readahead_hunks(readahead);
+}
+
+
 //-------------------------------------------------
 //  compression_string - create a friendly string
 //  describing a set of compressors
@@ -1728,6 +1752,10 @@ static void do_verify(parameters_map &params)
 	chd_file input_chd;
 	parse_input_chd_parameters(params, input_chd, input_parent_chd);
 
+	// decompress on all processors while we hash
+	parse_numprocessors(params);
+	configure_parallel_read(input_chd);
+
 	// only makes sense for compressed CHDs with valid SHA-1's
 	if (!input_chd.compressed())
 		report_error(0, "No verification to be done; CHD is uncompressed");
@@ -2378,6 +2406,7 @@ static void do_copy(parameters_map &params)
 
 	// process numprocessors
 	parse_numprocessors(params);
+	configure_parallel_read(input_chd);
 
 	// print some info
 	util::stream_format(std::cout, "Output CHD:   %s\n", *output_chd_str);
@@ -2423,6 +2452,9 @@ static void do_copy(parameters_map &params)
 				cdda_swap = redo_cd = true;
 				continue;
 			}
+			// a Zstandard dictionary only suits the input's codecs, so train a fresh one if needed
+			if (metatag == ZSTD_DICTIONARY_METADATA_TAG)
+				continue;
 
 			// otherwise, clone it
 			err = chd->write_metadata(metatag, CHDMETAINDEX_APPEND, metadata, metaflags);
@@ -2469,6 +2501,10 @@ static void do_extract_raw(parameters_map &params)
 	// parse out input start/end
 	const auto [input_start, input_end] = parse_input_start_end(params, input_chd.logical_bytes(), input_chd.hunk_bytes(), input_chd.hunk_bytes());
 
+	// decompress on all processors while we write
+	parse_numprocessors(params);
+	configure_parallel_read(input_chd);
+
 	// verify output file doesn't exist
 	auto output_file_str = params.find(OPTION_OUTPUT);
 	if (output_file_str != params.end())
@@ -2542,6 +2578,10 @@ static void do_extract_cd(parameters_map &params)
 	chd_file input_chd;
 	parse_input_chd_parameters(params, input_chd, input_parent_chd);
 
+	// decompress on all processors while we write
+	parse_numprocessors(params);
+	configure_parallel_read(input_chd);
+
 	// further process input file
 	cdrom_file *cdrom = new cdrom_file(&input_chd);
 	const cdrom_file::toc &toc = cdrom->get_toc();
@@ -17,6 +17,7 @@
 
 #include "osdcomm.h"
 
+#include <atomic>
 #include <cassert>
 #include <cctype>
 #include <cstdarg>
@@ -25,6 +26,9 @@
 #include <cstring>
 #include <ctime>
 #include <exception>
+#include <fstream>
+#include <mutex>
+#include <thread>
 
 
 static formats_table formats;
@@ -36,6 +40,7 @@ static void display_usage(const char *first_argument)
 	fprintf(stderr, "Usage: \n");
 	fprintf(stderr, "       %s identify <inputfile> [<inputfile> ...]                                 -- Identify an image format\n", exe_name.c_str());
 	fprintf(stderr, "       %s flopconvert [input_format|auto] output_format <inputfile> <outputfile> -- Convert a floppy image\n", exe_name.c_str());
+	fprintf(stderr, "       %s flopbatch [-j threads] [-quick] [input_format|auto] output_format <outputdir> <inputfile|@listfile> [...] -- Convert many floppy images\n", exe_name.c_str());
 	fprintf(stderr, "       %s flopcreate output_format filesystem <outputfile>                       -- Create a preformatted floppy image\n", exe_name.c_str());
 	fprintf(stderr, "       %s flopdir input_format filesystem <image>                                -- List the contents of a floppy image\n", exe_name.c_str());
 	fprintf(stderr, "       %s flopread input_format filesystem <image> <path> <outputfile>           -- Extract a file from a floppy image\n", exe_name.c_str());
@@ -229,6 +234,133 @@ static int flopconvert(int argc, char *argv[])
 	return 0;
 }
 
+static int flopbatch(int argc, char *argv[])
+{
+	// options come before the formats
+	unsigned threads = std::thread::hardware_concurrency();
+	bool quick = false;
+	int arg = 2;
+	while(arg < argc && argv[arg][0] == '-') {
+		if(!strcmp(argv[arg], "-j") && arg + 1 < argc) {
+			threads = atoi(argv[arg + 1]);
+			arg += 2;
+		} else if(!strcmp(argv[arg], "-quick")) {
+			quick = true;
+			arg++;
+		} else
+			break;
+	}
+	if(!threads)
+		threads = 1;
+
+	if(argc - arg < 4) {
+		fprintf(stderr, "Incorrect number of arguments.\n\n");
+		display_usage(argv[0]);
+		return 1;
+	}
+
+	const char *const source_name = argv[arg];
+	const floppy_format_info *source_format = nullptr;
+	if(core_stricmp(source_name, "auto")) {
+		source_format = formats.find_floppy_format_info_by_key(source_name);
+		if(!source_format) {
+			fprintf(stderr, "Error: Format '%s' unknown\n", source_name);
+			return 1;
+		}
+	}
+
+	const floppy_format_info *dest_format = formats.find_floppy_format_info_by_key(argv[arg + 1]);
+	if(!dest_format) {
+		fprintf(stderr, "Error: Format '%s' unknown\n", argv[arg + 1]);
+		return 1;
+	}
+	if(!dest_format->m_format->supports_save()) {
+		fprintf(stderr, "Error: Saving to format '%s' unsupported\n", argv[arg + 1]);
+		return 1;
+	}
+
+	// outputs take the first extension of the destination format
+	std::string const outdir = argv[arg + 2];
+	std::string const outext(dest_format->m_format->extensions(), strcspn(dest_format->m_format->extensions(), ","));
+
+	// gather inputs; @file names a list with one path per line
+	std::vector<std::string> inputs;
+	for(int i = arg + 3; i < argc; i++) {
+		if(argv[i][0] == '@') {
+			std::ifstream list(&argv[i][1]);
+			if(!list) {
+				fprintf(stderr, "Error: Could not open list file %s\n", &argv[i][1]);
+				return 1;
+			}
+			std::string line;
+			while(std::getline(list, line))
+				if(!line.empty())
+					inputs.emplace_back(std::move(line));
+		} else
+			inputs.emplace_back(argv[i]);
+	}
+
+	std::atomic<size_t> next(0);
+	std::atomic<int> failures(0);
+	std::mutex report_mutex;
+	auto const report = [&report_mutex] (const char *status, const std::string &path, const std::string &detail) {
+		std::lock_guard<std::mutex> lock(report_mutex);
+		printf("%s %s%s\n", status, path.c_str(), detail.c_str());
+	};
+
+	auto const worker = [&] () {
+		for(size_t index = next++; index < inputs.size(); index = next++) {
+			const std::string &input = inputs[index];
+			try {
+				image_handler ih;
+				ih.set_on_disk_path(input);
+
+				const floppy_format_info *format = source_format;
+				if(!format) {
+					auto scores = ih.identify(formats, quick);
+					if(scores.empty() || (scores.size() >= 2 && scores[0].first == scores[1].first)) {
+						report("FAIL", input, scores.empty() ? " (unknown format)" : " (ambiguous format)");
+						failures++;
+						continue;
+					}
+					format = scores[0].second;
+				}
+
+				if(ih.floppy_load(*format)) {
+					report("FAIL", input, util::string_format(" (loading as %s failed)", format->m_format->name()));
+					failures++;
+					continue;
+				}
+
+				std::string output = outdir;
+				util::path_append(output, core_filename_extract_base(input, true));
+				output.append(".").append(outext);
+				ih.set_on_disk_path(output);
+				if(ih.floppy_save(*dest_format)) {
+					report("FAIL", input, util::string_format(" (saving %s failed)", output));
+					failures++;
+					continue;
+				}
+
+				report("OK  ", input, util::string_format(" -> %s", output));
+			} catch(const std::exception &err) {
+				report("FAIL", input, util::string_format(" (%s)", err.what()));
+				failures++;
+			}
+		}
+	};
+
+	// formats are stateless, so each thread only needs its own image_handler
+	std::vector<std::thread> pool;
+	for(unsigned i = 1; i < threads && i < inputs.size(); i++)
+		pool.emplace_back(worker);
+	worker();
+	for(auto &t : pool)
+		t.join();
+
+	return failures ? 1 : 0;
+}
+
 static fs::meta_data extract_meta_data(int &argc, char *argv[])
 {
 	fs::meta_data result;
@@ -703,6 +835,8 @@ int CLIB_DECL main(int argc, char *argv[])
 			return identify(argc, argv);
 		else if(!core_stricmp("flopconvert", argv[1]))
 			return flopconvert(argc, argv);
+		else if(!core_stricmp("flopbatch", argv[1]))
+			return flopbatch(argc, argv);
 		else if(!core_stricmp("flopcreate", argv[1]))
 			return flopcreate(argc, argv);
 		else if(!core_stricmp("flopdir", argv[1]))
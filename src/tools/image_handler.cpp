@@ -224,7 +224,7 @@ void image_handler::set_on_disk_path(std::string path)
 	m_on_disk_path = path;
 }
 
-std::vector<std::pair<u8, const floppy_format_info *>> image_handler::identify(const formats_table &formats)
+std::vector<std::pair<u8, const floppy_format_info *>> image_handler::identify(const formats_table &formats, bool quick)
 {
 	std::vector<std::pair<u8, const floppy_format_info *>> res;
 	std::vector<uint32_t> variants;
@@ -236,18 +236,37 @@ std::vector<std::pair<u8, const floppy_format_info *>> image_handler::identify(c
 		return res;
 	}
 
-	auto io = util::stdio_read(f, 0xff);
+	// every format probes the image, so read it once rather than going
+	// back to the file for each of them
+	std::vector<u8> data;
+	u8 buf[0x10000];
+	size_t actual;
+	while((actual = fread(buf, 1, sizeof(buf), f)) != 0)
+		data.insert(data.end(), buf, buf + actual);
+	fclose(f);
+
+	auto io = util::ram_read(data.data(), data.size(), 0xff);
+
+	auto const probe = [&] (bool ext_match) {
+		for(const auto &e : formats.floppy_format_info_by_key) {
+			if(quick && (e.second->m_format->extension_matches(m_on_disk_path.c_str()) != ext_match))
+				continue;
+			u8 score = e.second->m_format->identify(*io, floppy_image::FF_UNKNOWN, variants);
+			if(score && e.second->m_format->extension_matches(m_on_disk_path.c_str()))
+				score |= floppy_image_format_t::FIFID_EXT;
+			if(score)
+				res.emplace_back(std::make_pair(score, e.second));
+		}
 
-	for(const auto &e : formats.floppy_format_info_by_key) {
-		u8 score = e.second->m_format->identify(*io, floppy_image::FF_UNKNOWN, variants);
-		if(score && e.second->m_format->extension_matches(m_on_disk_path.c_str()))
-			score |= floppy_image_format_t::FIFID_EXT;
-		if(score)
-			res.emplace_back(std::make_pair(score, e.second));
-	}
+		// Sort results by decreasing score
+		std::stable_sort(res.begin(), res.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+	};
 
-	// Sort results by decreasing score
-	std::stable_sort(res.begin(), res.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+	// In quick mode, formats claiming the file's extension go first, and
+	// the rest are only tried if none of them recognised its contents
+	probe(true);
+	if(quick && (res.empty() || !(res[0].first & (floppy_image_format_t::FIFID_SIGN | floppy_image_format_t::FIFID_STRUCT))))
+		probe(false);
 
 	return res;
 }
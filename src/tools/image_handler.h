@@ -82,7 +82,7 @@ public:
 	void set_on_disk_path(std::string path);
 	const std::string &get_on_disk_path() const { return m_on_disk_path; }
 
-	std::vector<std::pair<u8, const floppy_format_info *>> identify(const formats_table &formats);
+	std::vector<std::pair<u8, const floppy_format_info *>> identify(const formats_table &formats, bool quick = false);
 
 	bool floppy_load(const floppy_format_info &format);
 	bool floppy_save(const floppy_format_info &format) const;
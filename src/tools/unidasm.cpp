@@ -216,6 +216,7 @@ using util::BIT;
 #include "cpu/z8000/8000dasm.h"
 
 #include "corestr.h"
+#include "disasmtrace.h"
 #include "eminline.h"
 #include "endianness.h"
 #include "ioprocs.h"
@@ -383,6 +384,9 @@ struct options
 	uint32_t                skip;
 	uint32_t                count;
 	bool                    octal;
+	bool                    trace;
+	bool                    findpc;
+	offs_t                  tracepc;
 };
 
 static const dasm_table_entry dasm_table[] =
@@ -1178,6 +1182,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 	bool pending_arch = false;
 	bool pending_skip = false;
 	bool pending_count = false;
+	bool pending_pc = false;
 
 	memset(opts, 0, sizeof(*opts));
 
@@ -1187,7 +1192,7 @@ static int parse_options(int argc, char *argv[], options *opts)
 
 		// is it a switch?
 		if(curarg[0] == '-' && curarg[1] != '\0') {
-			if(pending_base || pending_arch || pending_skip || pending_count)
+			if(pending_base || pending_arch || pending_skip || pending_count || pending_pc)
 				goto usage;
 
 			if(tolower((uint8_t)curarg[1]) == 'a')
@@ -1210,6 +1215,10 @@ static int parse_options(int argc, char *argv[], options *opts)
 				opts->xchbytes = true;
 			else if(tolower((uint8_t)curarg[1]) == 'o')
 				opts->octal = true;
+			else if(tolower((uint8_t)curarg[1]) == 't')
+				opts->trace = true;
+			else if(tolower((uint8_t)curarg[1]) == 'p')
+				pending_pc = true;
 			else
 				goto usage;
 
@@ -1242,6 +1251,13 @@ static int parse_options(int argc, char *argv[], options *opts)
 				goto usage;
 			pending_count = false;
 
+		} else if(pending_pc) {
+			// pc to search a trace for
+			if(parse_number(curarg, "%x", &opts->tracepc) != 1)
+				goto usage;
+			opts->findpc = true;
+			pending_pc = false;
+
 		} else if(opts->filename == nullptr) {
 			// filename
 			opts->filename = curarg;
@@ -1253,11 +1269,11 @@ static int parse_options(int argc, char *argv[], options *opts)
 	}
 
 	// if we have a dangling option, error
-	if(pending_base || pending_arch || pending_skip || pending_count)
+	if(pending_base || pending_arch || pending_skip || pending_count || pending_pc)
 		goto usage;
 
-	// if no file or no architecture, fail
-	if(opts->filename == nullptr || opts->dasm == nullptr)
+	// if no file or no architecture, fail; traces can name their own architecture
+	if(opts->filename == nullptr || (opts->dasm == nullptr && !opts->trace) || (opts->findpc && !opts->trace))
 		goto usage;
 
 	return 0;
@@ -1266,6 +1282,7 @@ usage:
 	printf("Usage: %s <filename> -arch <architecture> [-basepc <pc>] \n", argv[0]);
 	printf("   [-norawbytes] [-xchbytes] [-flipped] [-upper] [-lower]\n");
 	printf("   [-skip <n>] [-count <n>] [-octal]\n");
+	printf("   %s <filename> -trace [-arch <architecture>] [-pc <pc>] [-upper] [-lower]\n", argv[0]);
 	printf("\n");
 	printf("Supported architectures:");
 	const int colwidth = 1 + std::strlen(std::max_element(std::begin(dasm_table), std::end(dasm_table), [](const dasm_table_entry &a, const dasm_table_entry &b) { return std::strlen(a.name) < std::strlen(b.name); })->name);
@@ -1484,8 +1501,9 @@ int disasm_file(util::random_read &file, u64 length, options &opts)
 	// Do the disassembly
 	std::vector<dasm_line> dasm_lines;
 	offs_t curpc = opts.basepc;
+	std::ostringstream stream; // reused, constructing a stream per instruction is costly
 	for(u32 i=0; i < count;) {
-		std::ostringstream stream;
+		stream.str(std::string());
 		offs_t result = disasm->disassemble(stream, curpc, *popcodes, *pparams);
 		offs_t len = result & util::disasm_interface::LENGTHMASK;
 		dasm_lines.emplace_back(dasm_line{ curpc, len, stream.str() });
@@ -1646,8 +1664,178 @@ int disasm_file(util::random_read &file, u64 length, options &opts)
 }
 
 
+int disasm_trace(util::random_read &file, u64 length, options &opts)
+{
+	namespace dt = util::disasm_trace;
+
+	std::vector<u8> trace(length);
+	auto const [filerr, actual] = read_at(file, 0, trace.data(), length);
+	if(filerr || actual != length) {
+		std::fprintf(stderr, "Error reading from file '%s'\n", opts.filename);
+		return 1;
+	}
+
+	// Helpers for pulling little-endian values out of the trace
+	size_t pos = 0;
+	auto const available = [&trace, &pos](size_t bytes) { return (trace.size() - pos) >= bytes; };
+	auto const get8 = [&trace, &pos]() -> u8 { return trace[pos++]; };
+	auto const get16 = [&get8]() -> u16 { u16 const lo = get8(); return lo | (u16(get8()) << 8); };
+	auto const get32 = [&get16]() -> u32 { u32 const lo = get16(); return lo | (u32(get16()) << 16); };
+	auto const get64 = [&get32]() -> u64 { u64 const lo = get32(); return lo | (u64(get32()) << 32); };
+	auto const getstr = [&trace, &pos](size_t len) { std::string result(reinterpret_cast<const char *>(&trace[pos]), len); pos += len; return result; };
+	auto const truncated = [&opts]() { std::fprintf(stderr, "File '%s' is truncated\n", opts.filename); return 1; };
+
+	// Parse the header
+	if(!available(sizeof(dt::MAGIC) + 6) || std::memcmp(trace.data(), dt::MAGIC, sizeof(dt::MAGIC))) {
+		std::fprintf(stderr, "File '%s' is not a binary trace\n", opts.filename);
+		return 1;
+	}
+	pos = sizeof(dt::MAGIC);
+	if(get8() != dt::VERSION) {
+		std::fprintf(stderr, "File '%s' has an unsupported trace version\n", opts.filename);
+		return 1;
+	}
+	int const addrshift = int8_t(get8());
+	int const addrwidth = get8();
+	get8();
+	if(!available(trace[pos] + 1))
+		return truncated();
+	std::string const tag = getstr(get8());
+	if(!available(1) || !available(trace[pos] + 3))
+		return truncated();
+	std::string const name = getstr(get8());
+	std::vector<std::pair<u8, std::string> > registers(get16());
+	for(auto &reg : registers) {
+		if(!available(2) || !available(trace[pos + 1] + 2))
+			return truncated();
+		reg.first = get8();
+		reg.second = getstr(get8());
+	}
+
+	// Use the architecture the trace names unless overridden
+	if(!opts.dasm) {
+		auto const arch = std::find_if(
+				std::begin(dasm_table),
+				std::end(dasm_table),
+				[&name] (dasm_table_entry const &e) { return !core_stricmp(name, e.name); });
+		if(std::end(dasm_table) == arch) {
+			std::fprintf(stderr, "No disassembler for '%s' (traced from %s), please specify -arch\n", name.c_str(), tag.c_str());
+			return 1;
+		}
+		opts.dasm = &*arch;
+	}
+
+	std::unique_ptr<util::disasm_interface> disasm(opts.dasm->alloc());
+	unidasm_data_buffer buffer(disasm.get(), opts.dasm);
+	int const granularity = (addrshift < 0) ? (1 << -addrshift) : 1;
+	int const pcchars = (addrwidth + 3) / 4;
+
+	auto const tf = [&opts](std::string str) {
+		if(opts.lower)
+			std::transform(str.begin(), str.end(), str.begin(), [](char c) { return tolower(c); });
+		else if(opts.upper)
+			std::transform(str.begin(), str.end(), str.begin(), [](char c) { return toupper(c); });
+		return str;
+	};
+
+	// Walk the records
+	std::string regtext;
+	u64 instructions = 0;
+	while(pos < trace.size()) {
+		switch(get8()) {
+		case dt::RECORD_INSTRUCTION: {
+			if(!available(5))
+				return truncated();
+			offs_t const pc = get32();
+			u8 const count = get8();
+			if(!available(count))
+				return truncated();
+
+			// opcode units are stored least significant byte first
+			buffer.data.assign(trace.begin() + pos, trace.begin() + pos + count);
+			buffer.data.resize(count + 16, 0x00);
+			if(opts.dasm->endian == be && granularity > 1)
+				for(int offset = 0; (offset + granularity) <= count; offset += granularity)
+					std::reverse(buffer.data.begin() + offset, buffer.data.begin() + offset + granularity);
+			buffer.size = count;
+			buffer.base_pc = pc;
+			pos += count;
+
+			instructions++;
+			if(!opts.findpc || (pc == opts.tracepc)) {
+				std::ostringstream stream;
+				disasm->disassemble(stream, pc, buffer, buffer);
+				if(opts.findpc)
+					util::stream_format(std::cout, "%10u  ", instructions);
+				if(regtext.empty())
+					util::stream_format(std::cout, "%s: %s\n", tf(util::string_format("%0*X", pcchars, pc)), tf(stream.str()));
+				else
+					util::stream_format(std::cout, "%s: %-32s %s\n", tf(util::string_format("%0*X", pcchars, pc)), tf(stream.str()), regtext);
+			}
+			regtext.clear();
+			break;
+		}
+
+		case dt::RECORD_INTERRUPT: {
+			if(!available(8))
+				return truncated();
+			int const irqline = int32_t(get32());
+			offs_t const pc = get32();
+			if(!opts.findpc)
+				util::stream_format(std::cout, "\n   (interrupted at %0*X, IRQ %d)\n\n", pcchars, pc, irqline);
+			break;
+		}
+
+		case dt::RECORD_LOOPS: {
+			if(!available(4))
+				return truncated();
+			u32 const loops = get32();
+			if(!opts.findpc)
+				util::stream_format(std::cout, "\n   (loops for %d instructions)\n\n", loops);
+			break;
+		}
+
+		case dt::RECORD_TEXT: {
+			if(!available(4))
+				return truncated();
+			u32 const len = get32();
+			if(!available(len))
+				return truncated();
+			std::string const text = getstr(len);
+			if(!opts.findpc)
+				std::cout << text;
+			break;
+		}
+
+		case dt::RECORD_REGISTER: {
+			if(!available(10))
+				return truncated();
+			u16 const index = get16();
+			u64 const value = get64();
+			if(index >= registers.size()) {
+				std::fprintf(stderr, "Invalid register in trace at offset %u\n", unsigned(pos - 11));
+				return 1;
+			}
+			if(!regtext.empty())
+				regtext += ' ';
+			regtext += util::string_format("%s=%0*X", registers[index].second, registers[index].first * 2, value);
+			break;
+		}
+
+		default:
+			std::fprintf(stderr, "Invalid record in trace at offset %u\n", unsigned(pos - 1));
+			return 1;
+		}
+	}
+	return 0;
+}
+
+
 int main(int argc, char *argv[])
 {
+	// all listing output goes through std::cout, so it needn't be kept in step with stdio
+	std::ios_base::sync_with_stdio(false);
+
 	// Parse options first
 	options opts;
 	if(parse_options(argc, argv, &opts))
@@ -1707,7 +1895,7 @@ int main(int argc, char *argv[])
 		}
 	}
 
-	int result = disasm_file(*file, length, opts);
+	int result = opts.trace ? disasm_trace(*file, length, opts) : disasm_file(*file, length, opts);
 
 	file.reset();
 	std::free(data);
@@ -9,3 +9,10 @@ TEST_CASE("convert 1 sec to attotime", "[emu]")
    attotime value = attotime::from_seconds(1);
    REQUIRE(value.as_attoseconds() == 1000000000000000000);
 }
+
+TEST_CASE("convert attotime to ticks", "[emu]")
+{
+   REQUIRE(attotime::from_seconds(3).as_ticks(1000) == 3000);
+   REQUIRE(attotime(0, ATTOSECONDS_PER_SECOND - 1).as_ticks(0xffffffff) == 0xfffffffe);
+   REQUIRE(attotime::from_usec(1500).as_ticks(8000000) == 12000);
+}
@@ -34,12 +34,6 @@ TEST_CASE("check rgb", "[emu][video]")
 
 	    The following functions are not tested yet:
 	    rgbaint_t()
-	    clamp_and_clear(const u32)
-	    sign_extend(const u32, const u32)
-	    min(const s32)
-	    max(const s32)
-	    blend(const rgbaint_t&, u8)
-	    scale_and_clamp(const rgbaint_t&)
 	    scale_imm_and_clamp(const s32)
 	    scale2_add_and_clamp(const rgbaint_t&, const rgbaint_t&, const rgbaint_t&)
 	    scale_add_and_clamp(const rgbaint_t&, const rgbaint_t&);
@@ -1033,4 +1027,105 @@ TEST_CASE("check rgb", "[emu][video]")
 		rgb.cmplt_imm_rgba(actual_a + 1, std::numeric_limits<s32>::min(), std::numeric_limits<s32>::max(), actual_b);
 		check_expected();
 	}
+
+	// test minimum against immediate
+	SECTION("rgbaint_t::min")
+	{
+		actual_a = random_i32();
+		actual_r = random_i32();
+		actual_g = random_i32();
+		actual_b = random_i32();
+		imm = random_i32();
+		expected_a = (actual_a < imm) ? actual_a : imm;
+		expected_r = (actual_r < imm) ? actual_r : imm;
+		expected_g = (actual_g < imm) ? actual_g : imm;
+		expected_b = (actual_b < imm) ? actual_b : imm;
+		rgb.set(actual_a, actual_r, actual_g, actual_b);
+		rgb.min(imm);
+		check_expected();
+	}
+
+	// test maximum against immediate
+	SECTION("rgbaint_t::max")
+	{
+		actual_a = random_i32();
+		actual_r = random_i32();
+		actual_g = random_i32();
+		actual_b = random_i32();
+		imm = random_i32();
+		expected_a = (actual_a > imm) ? actual_a : imm;
+		expected_r = (actual_r > imm) ? actual_r : imm;
+		expected_g = (actual_g > imm) ? actual_g : imm;
+		expected_b = (actual_b > imm) ? actual_b : imm;
+		rgb.set(actual_a, actual_r, actual_g, actual_b);
+		rgb.max(imm);
+		check_expected();
+	}
+
+	// test sign extension of 8-bit values
+	SECTION("rgbaint_t::sign_extend")
+	{
+		actual_a = random_i32() & 0xff;
+		actual_r = random_i32() & 0xff;
+		actual_g = (random_i32() & 0x7f) | 0x80;
+		actual_b = random_i32() & 0x7f;
+		expected_a = s8(actual_a);
+		expected_r = s8(actual_r);
+		expected_g = s8(actual_g);
+		expected_b = actual_b;
+		rgb.set(actual_a, actual_r, actual_g, actual_b);
+		rgb.sign_extend(0x80, 0xffffff00);
+		check_expected();
+	}
+
+	// test clearing values with sign bits set and clamping the rest
+	SECTION("rgbaint_t::clamp_and_clear")
+	{
+		actual_a = random_i32() & 0xff;
+		actual_r = (random_i32() & 0xff) | 0x100;
+		actual_g = (random_i32() & 0x1ff) | 0x200;
+		actual_b = -((random_i32() & 0xff) + 1);
+		expected_a = actual_a;
+		expected_r = 0xff;
+		expected_g = 0;
+		expected_b = 0;
+		rgb.set(actual_a, actual_r, actual_g, actual_b);
+		rgb.clamp_and_clear(0xfffffe00);
+		check_expected();
+	}
+
+	// test blending two colours
+	SECTION("rgbaint_t::blend")
+	{
+		actual_a = random_i32() & 0xff;
+		actual_r = random_i32() & 0xff;
+		actual_g = random_i32() & 0xff;
+		actual_b = random_i32() & 0xff;
+		other.set(random_i32() & 0xff, random_i32() & 0xff, random_i32() & 0xff, random_i32() & 0xff);
+		imm = random_i32() & 0xff;
+		expected_a = (actual_a * imm + other.get_a32() * (256 - imm)) >> 8;
+		expected_r = (actual_r * imm + other.get_r32() * (256 - imm)) >> 8;
+		expected_g = (actual_g * imm + other.get_g32() * (256 - imm)) >> 8;
+		expected_b = (actual_b * imm + other.get_b32() * (256 - imm)) >> 8;
+		rgb.set(actual_a, actual_r, actual_g, actual_b);
+		rgb.blend(other, u8(imm));
+		check_expected();
+	}
+
+	// test scaling by 8.8 factors with clamping
+	SECTION("rgbaint_t::scale_and_clamp")
+	{
+		actual_a = random_i32() & 0xff;
+		actual_r = random_i32() & 0xff;
+		actual_g = random_i32() & 0xff;
+		actual_b = random_i32() & 0xff;
+		other.set(random_i32() & 0x1ff, random_i32() & 0x1ff, random_i32() & 0x1ff, -(random_i32() & 0xff) - 1);
+		expected_a = std::min<s32>((actual_a * other.get_a32()) >> 8, 255);
+		expected_r = std::min<s32>((actual_r * other.get_r32()) >> 8, 255);
+		expected_g = std::min<s32>((actual_g * other.get_g32()) >> 8, 255);
+		expected_b = 0;
+		rgb.set(actual_a, actual_r, actual_g, actual_b);
+		rgb.scale_and_clamp(other);
+		check_expected();
+	}
 }